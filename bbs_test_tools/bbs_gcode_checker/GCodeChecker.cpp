@@ -3,6 +3,9 @@
 #include <math.h>
 #include <map>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 namespace BambuStudio {
 
 //BBS: only check wodth when dE is longer than this value
@@ -11,6 +14,9 @@ const double WIDTH_THRESHOLD = 0.05;
 const double RADIUS_THRESHOLD = 0.005;
 const double MULTI_NOZZLE_TEMP_THRESHOLD = 100;
 
+//BBS: lines tokenized in parallel before they are checked in order
+const size_t LINES_PER_BLOCK = 65536;
+
 const double filament_diameter = 1.75;
 const double Pi = 3.14159265358979323846;
 
@@ -34,40 +40,123 @@ const std::string Physical_Extruder_Map_Tag = " physical_extruder_map =";
 
 GCodeCheckResult GCodeChecker::parse_file(const std::string& path)
 {
-    std::ifstream file(path);
+    m_summary = GCodeCheckSummary();
+    auto time = std::chrono::steady_clock::now();
+    auto seconds_since = [](std::chrono::steady_clock::time_point &time) {
+        auto now = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(now - time).count();
+        time = now;
+        return seconds;
+    };
+
+    //BBS: read the whole file at once, the lines are split in place
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
     if (file.fail()) {
         std::cout << "Failed to open file " << path << std::endl;
+        m_summary.result = GCodeCheckResult::ParseFailed;
         return GCodeCheckResult::ParseFailed;
     }
-    std::string line_raw;
-    std::string line;
-    int line_number = 0; 
-
-
-    while (std::getline(file, line_raw)) {
-        line_number++;
+    std::vector<char> buffer(size_t(file.tellg()) + 1, 0);
+    file.seekg(0);
+    file.read(buffer.data(), std::streamsize(buffer.size() - 1));
+    if (file.fail()) {
+        std::cout << "Failed to read file " << path << std::endl;
+        m_summary.result = GCodeCheckResult::ParseFailed;
+        return GCodeCheckResult::ParseFailed;
+    }
+    file.close();
+    m_summary.read_time = seconds_since(time);
+
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    m_summary.threads = threads;
+
+    std::vector<GCodeLine> lines;
+    lines.reserve(LINES_PER_BLOCK);
+    char *next = buffer.data();
+    char *end = buffer.data() + buffer.size() - 1;
+    int line_number = 0;
+    while (next < end) {
+        lines.clear();
+        while (next < end && lines.size() < LINES_PER_BLOCK) {
+            char *line_end = static_cast<char *>(memchr(next, '\n', end - next));
+            if (line_end == nullptr)
+                line_end = end;
+            *line_end = 0;
+            if (line_end > next && line_end[-1] == '\r')
+                line_end[-1] = 0;
+            lines.emplace_back().m_line = next;
+            next = line_end + 1;
+        }
 
-        const char *c = line_raw.c_str();
-        c = skip_whitespaces(c);
-        if (std::toupper(*c) == 'N')
-            c = skip_word(c);
-        c = skip_whitespaces(c);
-        line = c;
-        if (parse_line(line) != GCodeCheckResult::Success) {
-            std::cerr << "Failed to parse line " << line_number
-                << ": " << line_raw << std::endl;
-            return GCodeCheckResult::ParseFailed;
+        //BBS: tokenizing does not depend on the previous lines, split the block between the threads
+        const size_t chunk = (lines.size() + threads - 1) / threads;
+        auto tokenize_chunk = [&lines](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                tokenize_line(lines[i]);
+        };
+        std::vector<std::thread> workers;
+        for (size_t begin = chunk; begin < lines.size(); begin += chunk)
+            workers.emplace_back(tokenize_chunk, begin, std::min(begin + chunk, lines.size()));
+        tokenize_chunk(0, std::min(chunk, lines.size()));
+        for (std::thread &worker : workers)
+            worker.join();
+        m_summary.tokenize_time += seconds_since(time);
+
+        //BBS: positions, temperatures and extruders are carried from line to line, check in order
+        for (GCodeLine &gcode_line : lines) {
+            line_number++;
+            GCodeCheckResult ret = parse_line(gcode_line);
+            if (ret != GCodeCheckResult::Success) {
+                std::cerr << "Failed to parse line " << line_number
+                    << ": " << gcode_line.m_line << std::endl;
+                m_summary.check_time += seconds_since(time);
+                m_summary.lines = line_number;
+                m_summary.failed_line = line_number;
+                m_summary.result = ret;
+                return GCodeCheckResult::ParseFailed;
+            }
         }
+        m_summary.check_time += seconds_since(time);
     }
+    m_summary.lines = line_number;
 
     if (m_layer_num == 0) {
         std::cout << "Invalid gcode file without layer change comment" << std::endl;
+        m_summary.result = GCodeCheckResult::ParseFailed;
         return GCodeCheckResult::ParseFailed;
     }
 
     return GCodeCheckResult::Success;
 }
 
+bool GCodeChecker::write_summary(const std::string& path) const
+{
+    std::ofstream file(path);
+    if (file.fail()) {
+        std::cout << "Failed to open summary file " << path << std::endl;
+        return false;
+    }
+
+    const char *result = m_summary.result == GCodeCheckResult::Success ? "success" :
+                         m_summary.result == GCodeCheckResult::CheckFailed ? "check_failed" : "parse_failed";
+    file << "{\n"
+         << "    \"result\": \"" << result << "\",\n"
+         << "    \"failed_line\": " << m_summary.failed_line << ",\n"
+         << "    \"lines\": " << m_summary.lines << ",\n"
+         << "    \"commands\": " << m_summary.commands << ",\n"
+         << "    \"comments\": " << m_summary.comments << ",\n"
+         << "    \"layers\": " << m_layer_num << ",\n"
+         << "    \"width_checks\": " << m_summary.width_checks << ",\n"
+         << "    \"threads\": " << m_summary.threads << ",\n"
+         << "    \"timing\": {\n"
+         << "        \"read\": " << m_summary.read_time << ",\n"
+         << "        \"tokenize\": " << m_summary.tokenize_time << ",\n"
+         << "        \"check\": " << m_summary.check_time << "\n"
+         << "    }\n"
+         << "}\n";
+    return !file.fail();
+}
+
 bool GCodeChecker::include_chinese(const char* str)
 {
    char c;
@@ -82,28 +171,101 @@ bool GCodeChecker::include_chinese(const char* str)
    return false;
 }
 
-GCodeCheckResult GCodeChecker::parse_line(const std::string& line)
+void GCodeChecker::tokenize_line(GCodeLine& gcode_line)
 {
-    // update start position
-    m_start_position = m_end_position;
+    const char *c = skip_whitespaces(gcode_line.m_line);
+    if (std::toupper(*c) == 'N')
+        c = skip_word(c);
+    c = skip_whitespaces(c);
+    gcode_line.m_raw = c;
 
-    GCodeCheckResult ret;
-    const char *c = skip_whitespaces(line.c_str());
+    GCodeCheckResult &ret = gcode_line.m_result;
     if (include_chinese(c)) {
         //chinese is forbidden
-        return GCodeCheckResult::ParseFailed;
-    } if (is_end_of_line(*c)) {
+        ret = GCodeCheckResult::ParseFailed;
+    } else if (is_end_of_line(*c)) {
         //BBS: skip empty line
-        return GCodeCheckResult::Success;
+        gcode_line.m_type = ELineType::Empty;
     } else if (is_comment_line(*c)) {
-        GCodeLine gcode_line;
-        gcode_line.m_raw = c;
+        gcode_line.m_type = ELineType::Comment;
+    } else {
+        gcode_line.m_type = ELineType::Command;
+        gcode_line.m_cmd_letter = char(::toupper(*c));
+        gcode_line.m_cmd_id = is_end_of_word(c[1]) ? 0 : ::atoi(c + 1);
+        switch (gcode_line.m_cmd_letter) {
+            case 'G':
+            {
+                switch (gcode_line.m_cmd_id)
+                {
+                    case 0:
+                    case 1:  { ret = parse_G0_G1(gcode_line); break; }
+                    case 2:
+                    case 3:  { ret = parse_G2_G3(gcode_line); break; }
+                    //BBS: G90 and G91 are single commands with no argument
+                    case 90: { ret = check_single_word(gcode_line, "Invalid G90 gcode with invalid end!"); break; }
+                    case 91: { ret = check_single_word(gcode_line, "Invalid G91 gcode with invalid end!"); break; }
+                    case 92: { ret = check_G92(gcode_line); break; }
+                    default: { break; }
+                }
+                break;
+            }
+            case 'M':
+            {
+                switch (gcode_line.m_cmd_id)
+                {
+                    //BBS: M82 and M83 are single commands with no argument
+                    case 82: { ret = check_single_word(gcode_line, "Invalid M82 gcode with invalid end!"); break; }
+                    case 83: { ret = check_single_word(gcode_line, "Invalid M83 gcode with invalid end!"); break; }
+                    default: { break; }
+                }
+                break;
+            }
+            case 'T':
+                break;
+            case 'S': {
+                if (strncmp(c, "SYNC", 4) != 0) {
+                    // Invalid SYNC command
+                    ret = GCodeCheckResult::ParseFailed;
+                }
+                break;
+            }
+            default: {
+                //BBS: other g command? impossible! must be invalid
+                ret = GCodeCheckResult::ParseFailed;
+                break;
+            }
+        }
+    }
+}
+
+GCodeCheckResult GCodeChecker::check_single_word(GCodeLine& gcode_line, const char* error)
+{
+    if (!is_single_gcode_word(gcode_line.m_raw)) {
+        gcode_line.m_error = error;
+        return GCodeCheckResult::ParseFailed;
+    }
+    return GCodeCheckResult::Success;
+}
+
+GCodeCheckResult GCodeChecker::parse_line(GCodeLine& gcode_line)
+{
+    // update start position
+    m_start_position = m_end_position;
+
+    if (gcode_line.m_result != GCodeCheckResult::Success) {
+        if (gcode_line.m_error != nullptr)
+            std::cout << gcode_line.m_error << std::endl;
+        return gcode_line.m_result;
+    }
+
+    GCodeCheckResult ret;
+    if (gcode_line.m_type == ELineType::Comment) {
+        m_summary.comments++;
         ret = parse_comment(gcode_line);
         if (ret != GCodeCheckResult::Success)
             return ret;
-    } else {
-        GCodeLine gcode_line;
-        gcode_line.m_raw = c;
+    } else if (gcode_line.m_type == ELineType::Command) {
+        m_summary.commands++;
         ret = parse_command(gcode_line);
         if (ret != GCodeCheckResult::Success)
             return ret;
@@ -117,7 +279,7 @@ GCodeCheckResult GCodeChecker::parse_line(const std::string& line)
 
 GCodeCheckResult GCodeChecker::parse_comment(GCodeLine& line)
 {
-    const char *c = line.m_raw.c_str();
+    const char *c = line.m_raw;
     c++;
     std::string comment = c;
     // extrusion role tag
@@ -275,17 +437,13 @@ GCodeCheckResult GCodeChecker::parse_comment(GCodeLine& line)
 
 GCodeCheckResult GCodeChecker::parse_command(GCodeLine& gcode_line)
 {
-    const std::string cmd = gcode_line.cmd();
+    //BBS: the syntax was checked by tokenize_line(), only the state is updated here
     GCodeCheckResult ret = GCodeCheckResult::Success;
-    switch (::toupper(cmd[0])) {
+    switch (gcode_line.m_cmd_letter) {
         case 'G':
         {
-            switch (::atoi(&cmd[1]))
+            switch (gcode_line.m_cmd_id)
             {
-                case 0:
-                case 1:  { ret = parse_G0_G1(gcode_line); break; }  // Move
-                case 2:
-                case 3:  { ret = parse_G2_G3(gcode_line); break; }  // Move
                 case 90: { ret = parse_G90(gcode_line); break; }    // Set to Absolute Positioning
                 case 91: { ret = parse_G91(gcode_line); break; }    // Set to Relative Positioning
                 case 92: { ret = parse_G92(gcode_line); break; }    // Set Position
@@ -294,7 +452,7 @@ GCodeCheckResult GCodeChecker::parse_command(GCodeLine& gcode_line)
             break;
         }
         case 'M':{
-            switch (::atoi(&cmd[1]))
+            switch (gcode_line.m_cmd_id)
             {
                 case 82: { ret = parse_M82(gcode_line); break; }    // Set to Absolute extrusion
                 case 83: { ret = parse_M83(gcode_line); break; }    // Set to Relative extrusion
@@ -316,7 +474,7 @@ GCodeCheckResult GCodeChecker::parse_command(GCodeLine& gcode_line)
         }
         case 'T':{
 
-            int pt = ::atoi(&cmd[1]);
+            int pt = gcode_line.m_cmd_id;
             if (pt == 1000 || pt == 1100 || pt == 255 || pt == 1001 || pt == 65535 || pt == 65279) {
                 break;
             }
@@ -336,19 +494,7 @@ GCodeCheckResult GCodeChecker::parse_command(GCodeLine& gcode_line)
             flow_ratio = filament_flow_ratio[pt];
             break;
         }
-        case 'S': {
-            if (cmd.compare(0, 4, "SYNC") == 0) {
-                // Valid SYNC command
-            }
-            else {
-                // Invalid SYNC command
-                ret = GCodeCheckResult::ParseFailed;
-            }
-            break;
-        }
         default: {
-            //BBS: other g command? impossible! must be invalid
-            ret = GCodeCheckResult::ParseFailed;
             break;
         }
     }
@@ -358,9 +504,7 @@ GCodeCheckResult GCodeChecker::parse_command(GCodeLine& gcode_line)
 
 GCodeCheckResult GCodeChecker::parse_axis(GCodeLine& gcode_line)
 {
-    const std::string cmd = gcode_line.m_raw;
-    const char* c = cmd.c_str();
-    c = skip_word(c);
+    const char* c = skip_word(gcode_line.m_raw);
     while (! is_end_of_gcode_line(*c)) {
         c = skip_whitespaces(c);
         if (is_end_of_gcode_line(*c))
@@ -378,7 +522,7 @@ GCodeCheckResult GCodeChecker::parse_axis(GCodeLine& gcode_line)
         case 'P': axis = P; break;
         default:
             //BBS: invalid command which has invalid axis
-            std::cout << "Invalid gcode because of invalid axis!" << std::endl;
+            gcode_line.m_error = "Invalid gcode because of invalid axis!";
             return GCodeCheckResult::ParseFailed;
         }
 
@@ -388,20 +532,20 @@ GCodeCheckResult GCodeChecker::parse_axis(GCodeLine& gcode_line)
 	        gcode_line.m_axis[int(axis)] = v;
             if (gcode_line.m_mask & (1 << int(axis))) {
                 //BBS: invalid command which has duplicated axis
-                std::cout << "Invalid gcode because of duplicated axis!" << std::endl;
+                gcode_line.m_error = "Invalid gcode because of duplicated axis!";
                 return GCodeCheckResult::ParseFailed;
             } else {
                 gcode_line.m_mask |= 1 << int(axis);
             }
             if (c == pend) {
                 //BBS: invalid command which has invalid axis value
-                std::cout << "Invalid gcode because of invalid axis value!" << std::endl;
+                gcode_line.m_error = "Invalid gcode because of invalid axis value!";
                 return GCodeCheckResult::ParseFailed;
             }
             c = pend;
         } else {
             //BBS: invalid command for invalid axis value
-            std::cout << "Invalid gcode because of invalid axis value!" << std::endl;
+            gcode_line.m_error = "Invalid gcode because of invalid axis value!";
             return GCodeCheckResult::ParseFailed;
         }
     }
@@ -418,13 +562,13 @@ GCodeCheckResult GCodeChecker::parse_G0_G1(GCodeLine& gcode_line)
     if ((!gcode_line.m_mask) ||
         gcode_line.has(I) ||
         gcode_line.has(J)) {
-        std::cout << "Invalid G0_G1 gcode because of no axis or invalid axis!" << std::endl;
+        gcode_line.m_error = "Invalid G0_G1 gcode because of no axis or invalid axis!";
         return GCodeCheckResult::ParseFailed;
     }
 
     //BBS: invalid G1 command which has zero speed
     if (gcode_line.has(F) && gcode_line.get(F) == 0.0) {
-        std::cout << "Invalid G0_G1 gcode because has F axis but 0 speed!" << std::endl;
+        gcode_line.m_error = "Invalid G0_G1 gcode because has F axis but 0 speed!";
         return GCodeCheckResult::ParseFailed;
     }
 
@@ -438,24 +582,24 @@ GCodeCheckResult GCodeChecker::parse_G2_G3(GCodeLine& gcode_line)
 
     //BBS: invalid G2_G3 command which has no axis or Z axis
     if (!gcode_line.m_mask) {
-        std::cout << "Invalid G2_G3 gcode because of no axis or has Z axis!" << std::endl;
+        gcode_line.m_error = "Invalid G2_G3 gcode because of no axis or has Z axis!";
         return GCodeCheckResult::ParseFailed;
     }
     //BBS: invalid G2_G3 command which has zero speed
     if (gcode_line.has(F) && gcode_line.get(F) == 0.0) {
-        std::cout << "Invalid G2_G3 gcode because has F axis but 0 speed!" << std::endl;
+        gcode_line.m_error = "Invalid G2_G3 gcode because has F axis but 0 speed!";
         return GCodeCheckResult::ParseFailed;
     }
     //BBS: invalid G2_G3 command which has no I and J axis
     if (!gcode_line.has(I) &&
         !gcode_line.has(J)) {
-        std::cout << "Invalid G2_G3 gcode because of no I and J axis at same time!" << std::endl;
+        gcode_line.m_error = "Invalid G2_G3 gcode because of no I and J axis at same time!";
         return GCodeCheckResult::ParseFailed;
     }
     //BBS: invalid G2_G3 command which has no X and Y axis at same time
     if (!gcode_line.has(X) && !gcode_line.has(Y) && !gcode_line.has(I) && !gcode_line.has(J)) {
         if (!gcode_line.has(X) || !gcode_line.has(P) || (int)gcode_line.get(P) != 1) {
-            std::cout << "Invalid G2_G3 gcode because of no X and Y axis at same time!" << std::endl;
+            gcode_line.m_error = "Invalid G2_G3 gcode because of no X and Y axis at same time!";
             return GCodeCheckResult::ParseFailed;
         }
     }
@@ -465,29 +609,17 @@ GCodeCheckResult GCodeChecker::parse_G2_G3(GCodeLine& gcode_line)
 
 GCodeCheckResult GCodeChecker::parse_G90(const GCodeLine& gcode_line)
 {
-    const char* c = gcode_line.m_raw.c_str();
-    //BBS: G90 is single command with no argument
-    if (!is_single_gcode_word(c)) {
-        std::cout << "Invalid G90 gcode with invalid end!" << std::endl;
-        return GCodeCheckResult::ParseFailed;
-    }
     m_global_positioning_type = EPositioningType::Absolute;
     return GCodeCheckResult::Success;
 }
 
 GCodeCheckResult GCodeChecker::parse_G91(const GCodeLine& gcode_line)
 {
-    const char* c = gcode_line.m_raw.c_str();
-    //BBS: G91 is single command with no argument
-    if (!is_single_gcode_word(c)) {
-        std::cout << "Invalid G91 gcode with invalid end!" << std::endl;
-        return GCodeCheckResult::ParseFailed;
-    }
     m_global_positioning_type = EPositioningType::Relative;
     return GCodeCheckResult::Success;
 }
 
-GCodeCheckResult GCodeChecker::parse_G92(GCodeLine& gcode_line)
+GCodeCheckResult GCodeChecker::check_G92(GCodeLine& gcode_line)
 {
     if (parse_axis(gcode_line) != GCodeCheckResult::Success)
         return GCodeCheckResult::ParseFailed;
@@ -497,10 +629,15 @@ GCodeCheckResult GCodeChecker::parse_G92(GCodeLine& gcode_line)
         gcode_line.has(F) ||
         gcode_line.has(I) ||
         gcode_line.has(J)) {
-        std::cout << "Invalid G2_G3 gcode because of no axis or invalid axis!" << std::endl;
+        gcode_line.m_error = "Invalid G2_G3 gcode because of no axis or invalid axis!";
         return GCodeCheckResult::ParseFailed;
     }
 
+    return GCodeCheckResult::Success;
+}
+
+GCodeCheckResult GCodeChecker::parse_G92(GCodeLine& gcode_line)
+{
     bool any_found = false;
     if (gcode_line.has(X)){
         m_origin[X] = m_end_position[X] - gcode_line.get(X);
@@ -533,31 +670,19 @@ GCodeCheckResult GCodeChecker::parse_G92(GCodeLine& gcode_line)
 
 GCodeCheckResult GCodeChecker::parse_M82(const GCodeLine& gcode_line)
 {
-    const char* c = gcode_line.m_raw.c_str();
-    //BBS: M82 is single command with no argument
-    if (!is_single_gcode_word(c)) {
-        std::cout << "Invalid M82 gcode with invalid end!" << std::endl;
-        return GCodeCheckResult::ParseFailed;
-    }
     m_e_local_positioning_type = EPositioningType::Absolute;
     return GCodeCheckResult::Success;
 }
 
 GCodeCheckResult GCodeChecker::parse_M83(const GCodeLine& gcode_line)
 {
-    const char* c = gcode_line.m_raw.c_str();
-    //BBS: M83 is single command with no argument
-    if (!is_single_gcode_word(c)) {
-        std::cout << "Invalid M83 gcode with invalid end!" << std::endl;
-        return GCodeCheckResult::ParseFailed;
-    }
     m_e_local_positioning_type = EPositioningType::Relative;
     return GCodeCheckResult::Success;
 }
 
 GCodeCheckResult GCodeChecker::parse_M104_M109(const GCodeLine &gcode_line)
 {   
-    const char *c = gcode_line.m_raw.c_str();
+    const char *c = gcode_line.m_raw;
     const char *rs = strchr(c,'S');
 
     std::string strS = rs;
@@ -600,7 +725,7 @@ GCodeCheckResult GCodeChecker::parse_M104_M109(const GCodeLine &gcode_line)
 
 GCodeCheckResult GCodeChecker::parse_M1020(const GCodeLine& gcode_line)
 {
-    const char* c = gcode_line.m_raw.c_str();
+    const char* c = gcode_line.m_raw;
     const char* rs = strchr(c, 'S');
 
     if (rs != nullptr) {
@@ -685,10 +810,8 @@ GCodeCheckResult GCodeChecker::check_line_width(const GCodeLine& gcode_line)
 
     GCodeCheckResult ret = GCodeCheckResult::Success;
     //BBS: only need to handle G0 G1 G2 G3
-    const std::string cmd = gcode_line.cmd();
-    int cmd_id = ::atoi(&cmd[1]);
-    if (::toupper(cmd[0]) == 'G')
-        switch (::atoi(&cmd[1]))
+    if (gcode_line.m_cmd_letter == 'G')
+        switch (gcode_line.m_cmd_id)
         {
             case 0:
             case 1:  { ret = check_G0_G1_width(gcode_line); break; }
@@ -777,6 +900,7 @@ GCodeCheckResult GCodeChecker::check_G0_G1_width(const GCodeLine& line)
                 real_height = line.get(Z) - (z_height - m_height);
             }
             double width_real = calculate_G1_width(source, target, delta_pos[E], real_height, is_bridge);
+            m_summary.width_checks++;
             if (fabs(width_real - m_width) > WIDTH_THRESHOLD) {
                 std::cout << "Invalid G0_G1 because has abnormal line width." << std::endl;
                 std::cout << "Width: " << m_width << " Width_real: " << width_real << std::endl;
@@ -833,8 +957,7 @@ GCodeCheckResult GCodeChecker::check_G2_G3_width(const GCodeLine& line)
     std::array<double, 2> source = { m_start_position[X], m_start_position[Y] };
     std::array<double, 2> target = { m_end_position[X], m_end_position[Y] };
     std::array<double, 2> center = { absolute_position(I, line),absolute_position(J, line) };
-    const std::string& cmd = line.cmd();
-    bool is_ccw = (::atoi(&cmd[1]) == 2) ? false : true;
+    bool is_ccw = (line.m_cmd_id == 2) ? false : true;
     double delta_e = m_end_position[E] - m_start_position[E];
     EMoveType type = move_type(delta_e);
 
@@ -856,6 +979,7 @@ GCodeCheckResult GCodeChecker::check_G2_G3_width(const GCodeLine& line)
 
         if (!is_bridge) {
             double width_real = calculate_G2_G3_width(source, target, center, is_ccw, delta_e, m_height, is_bridge);
+            m_summary.width_checks++;
             if (fabs(width_real - m_width) > WIDTH_THRESHOLD) {
                 std::cout << "Invalid G2_G3 because has abnormal line width." << std::endl;
                 std::cout << "Width: " << m_width << " Width_real: " << width_real << std::endl;
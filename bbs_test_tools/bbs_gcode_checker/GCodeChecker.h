@@ -6,6 +6,7 @@
 #include <vector>
 #include <array>
 #include <map>
+#include <cstdint>
 namespace BambuStudio {
 
 enum class GCodeCheckResult : unsigned char
@@ -31,6 +32,29 @@ enum class EMoveType : unsigned char
     Count
 };
 
+enum class ELineType : unsigned char
+{
+    Empty,
+    Comment,
+    Command
+};
+
+//BBS: statistics of one parse_file() run, written by write_summary()
+struct GCodeCheckSummary
+{
+    GCodeCheckResult result = GCodeCheckResult::Success;
+    size_t   lines = 0;
+    size_t   commands = 0;
+    size_t   comments = 0;
+    size_t   width_checks = 0;
+    size_t   failed_line = 0;
+    unsigned threads = 1;
+    // seconds spent reading the file, tokenizing the lines in parallel and checking them in order
+    double   read_time = 0.0;
+    double   tokenize_time = 0.0;
+    double   check_time = 0.0;
+};
+
 enum Axis {
     X=0,
     Y,
@@ -74,16 +98,25 @@ public:
     public:
         GCodeLine() {}
         const std::string cmd() const {
-            const char *cmd = GCodeChecker::skip_whitespaces(m_raw.c_str());
+            const char *cmd = GCodeChecker::skip_whitespaces(m_raw);
             return std::string(cmd, GCodeChecker::skip_word(cmd) - cmd);
         }
 
         bool has(Axis axis) const { return (m_mask & (1 << int(axis))) != 0;  }
         double get(Axis axis) const { return m_axis[int(axis)]; }
 
-        std::string   m_raw;
+        // Both point into the zero terminated line of the file buffer, m_raw after the line number and whitespaces.
+        const char   *m_line = "";
+        const char   *m_raw = "";
         double        m_axis[NUM_AXES] = { 0.0f };
         uint32_t      m_mask = 0;
+        //BBS: filled by tokenize_line(), which does not depend on the checker state
+        ELineType     m_type = ELineType::Empty;
+        char          m_cmd_letter = 0;
+        int           m_cmd_id = 0;
+        GCodeCheckResult m_result = GCodeCheckResult::Success;
+        // printed when the line is reached by the ordered check
+        const char   *m_error = nullptr;
     };
 
     enum class EPositioningType : unsigned char
@@ -94,15 +127,21 @@ public:
 
     GCodeChecker() {}
     GCodeCheckResult parse_file(const std::string& path);
+    const GCodeCheckSummary& summary() const { return m_summary; }
+    bool write_summary(const std::string& path) const;
 
 private:
-    bool include_chinese(const char* str);
-    GCodeCheckResult parse_line(const std::string& line);
+    static bool include_chinese(const char* str);
+    //BBS: stateless part of the parsing, safe to run on several lines in parallel
+    static void tokenize_line(GCodeLine& gcode_line);
+    static GCodeCheckResult parse_axis(GCodeLine& gcode_line);
+    static GCodeCheckResult parse_G0_G1(GCodeLine& gcode_line);
+    static GCodeCheckResult parse_G2_G3(GCodeLine& gcode_line);
+    static GCodeCheckResult check_single_word(GCodeLine& gcode_line, const char* error);
+    static GCodeCheckResult check_G92(GCodeLine& gcode_line);
 
+    GCodeCheckResult parse_line(GCodeLine& gcode_line);
     GCodeCheckResult parse_command(GCodeLine& gcode_line);
-    GCodeCheckResult parse_axis(GCodeLine& gcode_line);
-    GCodeCheckResult parse_G0_G1(GCodeLine& gcode_line);
-    GCodeCheckResult parse_G2_G3(GCodeLine& gcode_line);
     GCodeCheckResult parse_G90(const GCodeLine& gcode_line);
     GCodeCheckResult parse_G91(const GCodeLine& gcode_line);
     GCodeCheckResult parse_G92(GCodeLine& gcode_line);
@@ -149,7 +188,7 @@ public:
     }
     static bool starts_with(const std::string &comment, const std::string &tag) {
         size_t tag_len = tag.size();
-        return comment.size() >= tag_len && comment.substr(0, tag_len) == tag;
+        return comment.size() >= tag_len && comment.compare(0, tag_len, tag) == 0;
     }
     static ExtrusionRole string_to_role(const std::string& role);
     //BBS: Returns true if the number was parsed correctly into out and the number spanned the whole input string.
@@ -231,6 +270,8 @@ private:
     bool has_scarf_joint_seam = false;
     bool is_wipe_tower = false;
     bool is_multi_nozzle = false;
+
+    GCodeCheckSummary m_summary;
 };
 
 }
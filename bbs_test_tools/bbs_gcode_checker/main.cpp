@@ -5,7 +5,8 @@ using namespace BambuStudio;
 
 int main(int argc, char *argv[])
 {
-    if (argc != 2) {
+    //BBS: the optional second argument is the path of a json summary with the check timings
+    if (argc != 2 && argc != 3) {
         cout << "Invalid input arguments" << endl;
         return -1;
     }
@@ -14,7 +15,10 @@ int main(int argc, char *argv[])
     GCodeChecker checker;
 
     //BBS: parse and check whether has invalid gcode
-    if (checker.parse_file(path) != GCodeCheckResult::Success) {
+    GCodeCheckResult result = checker.parse_file(path);
+    if (argc == 3)
+        checker.write_summary(argv[2]);
+    if (result != GCodeCheckResult::Success) {
         cout << "Failed to parse and check file " << path << endl;
         return -1;
     }
@@ -181,6 +181,8 @@ typedef struct  _sliced_plate_info{
     size_t generate_support_material_time {0};
     size_t triangle_count{0};
     std::string warning_message;
+    //BBS: SlicingProfiler records of the plate
+    json step_profile;
 
     float total_predication{0.f};
     float main_predication{0.f};
@@ -389,6 +391,10 @@ typedef struct _cli_callback_mgr {
 cli_callback_mgr_t g_cli_callback_mgr;
 void cli_status_callback(const PrintBase::SlicingStatus& slicing_status)
 {
+    if (slicing_status.flags & PrintBase::SlicingStatus::UPDATE_SLICING_PROFILE) {
+        BOOST_LOG_TRIVIAL(debug) << __FUNCTION__ << boost::format(": step profile %1%")%slicing_status.text;
+        return;
+    }
     if (slicing_status.warning_step != -1) {
         g_slicing_warnings.push_back(slicing_status);
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": percent=%1%, warning_step=%2%, message=%3%, message_type=%4%, flag=%5%")
@@ -533,6 +539,30 @@ void record_exit_reson(std::string outputdir, int code, int plate_id, std::strin
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(", saved config to %1%\n")%result_file;
     }
     catch (...) {}
+
+    //BBS: per step profile of the sliced plates, next to result.json
+    try {
+        json profile_json = json::array();
+        for (const sliced_plate_info_t& sliced_plate_info : sliced_info.sliced_plates)
+        {
+            if (sliced_plate_info.step_profile.empty())
+                continue;
+            json plate_json;
+            plate_json["id"] = sliced_plate_info.plate_id;
+            plate_json["steps"] = sliced_plate_info.step_profile;
+            profile_json.push_back(std::move(plate_json));
+        }
+        if (!profile_json.empty()) {
+            std::string profile_file = outputdir.empty() ? "slicing_profile.json" : (outputdir + "/slicing_profile.json");
+            boost::nowide::ofstream c;
+            c.open(profile_file, std::ios::out | std::ios::trunc);
+            c << std::setw(4) << profile_json << std::endl;
+            c.close();
+
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(", saved slicing profile to %1%\n")%profile_file;
+        }
+    }
+    catch (...) {}
 #endif
 }
 
@@ -1529,6 +1559,11 @@ int CLI::run(int argc, char **argv)
     if (enable_timelapse_option)
         enable_timelapse = enable_timelapse_option->value;
 
+    int max_slicing_threads = 0;
+    ConfigOptionInt* max_slicing_threads_option = m_config.option<ConfigOptionInt>("max_slicing_threads");
+    if (max_slicing_threads_option)
+        max_slicing_threads = max_slicing_threads_option->value;
+
     ConfigOptionBool* allow_rotations_option = m_config.option<ConfigOptionBool>("allow_rotations");
     if (allow_rotations_option)
         allow_rotations = allow_rotations_option->value;
@@ -1545,6 +1580,14 @@ int CLI::run(int argc, char **argv)
     if (allow_newer_file_option)
         allow_newer_file = allow_newer_file_option->value;
 
+    int gcode_pipeline_tokens = 0, gcode_pipeline_memory = 0;
+    ConfigOptionInt* gcode_pipeline_tokens_option = m_config.option<ConfigOptionInt>("gcode_pipeline_tokens");
+    if (gcode_pipeline_tokens_option)
+        gcode_pipeline_tokens = std::max(0, gcode_pipeline_tokens_option->value);
+    ConfigOptionInt* gcode_pipeline_memory_option = m_config.option<ConfigOptionInt>("gcode_pipeline_memory");
+    if (gcode_pipeline_memory_option)
+        gcode_pipeline_memory = std::max(0, gcode_pipeline_memory_option->value);
+
     ConfigOptionBool* avoid_extrusion_cali_region_option = m_config.option<ConfigOptionBool>("avoid_extrusion_cali_region");
     if (avoid_extrusion_cali_region_option)
         avoid_extrusion_cali_region = avoid_extrusion_cali_region_option->value;
@@ -1987,7 +2030,7 @@ int CLI::run(int argc, char **argv)
         }
     }
 
-    auto load_config_file = [config_substitution_rule](const std::string& file, DynamicPrintConfig& config, std::string& config_type,
+    auto parse_config_file = [config_substitution_rule](const std::string& file, DynamicPrintConfig& config, std::string& config_type,
                                 std::string& config_name, std::string& filament_id, std::string& config_from) {
         if (! boost::filesystem::exists(file)) {
             boost::nowide::cerr << __FUNCTION__<< ": can not find setting file: " << file << std::endl;
@@ -2055,6 +2098,36 @@ int CLI::run(int argc, char **argv)
         }
         return 0;
     };
+    // The same setting files are loaded again for every filament slot and for the system presets they inherit from,
+    // keep the parsed result of each file instead of parsing its json again.
+    struct LoadedConfigFile
+    {
+        int                 ret { 0 };
+        DynamicPrintConfig  config;
+        std::string         config_type, config_name, filament_id, config_from;
+    };
+    std::map<std::string, LoadedConfigFile> loaded_config_files;
+    auto load_config_file = [&parse_config_file, &loaded_config_files](const std::string& file, DynamicPrintConfig& config, std::string& config_type,
+                                std::string& config_name, std::string& filament_id, std::string& config_from) {
+        auto it = loaded_config_files.find(file);
+        if (it == loaded_config_files.end()) {
+            LoadedConfigFile loaded;
+            loaded.ret = parse_config_file(file, loaded.config, loaded.config_type, loaded.config_name, loaded.filament_id, loaded.config_from);
+            if (loaded.ret == CLI_FILE_NOTFOUND)
+                // not cached, the file may still be created
+                return loaded.ret;
+            it = loaded_config_files.emplace(file, std::move(loaded)).first;
+        }
+        else
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< ":reuse the already loaded setting file "<< file << std::endl;
+        const LoadedConfigFile& loaded = it->second;
+        config      = loaded.config;
+        config_type = loaded.config_type;
+        config_name = loaded.config_name;
+        filament_id = loaded.filament_id;
+        config_from = loaded.config_from;
+        return loaded.ret;
+    };
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< ":before load settings, file count="<< load_configs.size() << std::endl;
     //std::vector<std::string> filament_compatible_printers;
     // load config files supplied via --load
@@ -5609,6 +5682,8 @@ int CLI::run(int argc, char **argv)
                         part_plate->get_print(&print, &gcode_result, &print_index);
 
                         print_fff = dynamic_cast<Print *>(print);
+                        print_fff->set_gcode_pipeline_tokens(size_t(gcode_pipeline_tokens));
+                        print_fff->set_gcode_pipeline_memory_budget(size_t(gcode_pipeline_memory));
                         /*if (outfile_config.empty())
                         {
                             outfile = "plate_" + std::to_string(index + 1) + ".gcode";
@@ -5983,6 +6058,7 @@ int CLI::run(int argc, char **argv)
                                 BOOST_LOG_TRIVIAL(info) << "set print's callback to default_status_callback.";
                                 print->set_status_callback(default_status_callback);
 #endif
+                                print->set_max_concurrency(max_slicing_threads);
                                 //check whether it is bbl printer
                                 std::string& printer_model_string = new_print_config.opt_string("printer_model", true);
                                 bool is_bbl_vendor_preset = false;
@@ -6153,7 +6229,8 @@ int CLI::run(int argc, char **argv)
                                     BOOST_LOG_TRIVIAL(info) << "plate "<< index+1<< ":will export Slicing data to " << export_slice_data_dir;
                                     std::string plate_dir = export_slice_data_dir+"/"+std::to_string(index+1);
                                     bool with_space = (get_logging_level() >= 4)?true:false;
-                                    int ret = print->export_cached_data(plate_dir, with_space);
+                                    //BBS: keep the readable json cache at debug level, the binary one otherwise
+                                    int ret = print->export_cached_data(plate_dir, with_space, with_space?PrintBase::CachedDataFormat::Json:PrintBase::CachedDataFormat::Binary);
                                     if (ret) {
                                         BOOST_LOG_TRIVIAL(error) << "plate "<< index+1<< ": export Slicing data error, ret=" << ret;
                                         export_slicedata_error = true;
@@ -6169,6 +6246,7 @@ int CLI::run(int argc, char **argv)
                                 sliced_plate_info.make_perimeters_time = slice_time[TIME_MAKE_PERIMETERS];
                                 sliced_plate_info.infill_time = slice_time[TIME_INFILL];
                                 sliced_plate_info.generate_support_material_time = slice_time[TIME_GENERATE_SUPPORT];
+                                sliced_plate_info.step_profile = print->slicing_profiler().to_json();
 
                                 //get predication and filament change
                                 PrintEstimatedStatistics& print_estimated_stat = gcode_result->print_statistics;
@@ -25,9 +25,7 @@
 #include <string.h>
 #include <math.h>
 
-// Boost pool: Don't use mutexes to synchronize memory allocation.
-#define BOOST_POOL_NO_MT
-#include <boost/pool/object_pool.hpp>
+#include <vector>
 
 #include "stl.h"
 
@@ -118,17 +116,9 @@ void stl_fix_normal_directions(stl_file *stl)
   	if (stl->stats.number_of_facets == 0)
   		return;
 
-	struct stl_normal {
-    	int         facet_num;
-    	stl_normal *next;
-  	};
-
-  	// Initialize linked list.
-  	boost::object_pool<stl_normal> pool;
-   	stl_normal *head = pool.construct();
-  	stl_normal *tail = pool.construct();
-	head->next = tail;
-	tail->next = tail;
+	// Stack of the facets to fix. A facet may be pushed multiple times, it is skipped if already fixed when popped.
+	std::vector<int> facets_to_fix;
+	facets_to_fix.reserve(stl->stats.number_of_facets);
 
 	// Initialize list that keeps track of already fixed facets.
 	std::vector<char> norm_sw(stl->stats.number_of_facets, 0);
@@ -172,11 +162,8 @@ void stl_fix_normal_directions(stl_file *stl)
       		if (stl->neighbors_start[facet_num].neighbor[j] != -1) {
         		// If we haven't fixed this facet yet, add it to the list:
         		if (norm_sw[stl->neighbors_start[facet_num].neighbor[j]] != 1) {
-	          		// Add node to beginning of list.
-	          		stl_normal *newn = pool.construct();
-	          		newn->facet_num = stl->neighbors_start[facet_num].neighbor[j];
-	          		newn->next = head->next;
-	          		head->next = newn;
+	          		// Push the facet to the stack.
+	          		facets_to_fix.emplace_back(stl->neighbors_start[facet_num].neighbor[j]);
 	        	}
 	      	}
 	    }
@@ -186,16 +173,14 @@ void stl_fix_normal_directions(stl_file *stl)
     		break;
 
     	// Get next facet to fix from top of list.
-    	if (head->next != tail) {
-      		facet_num = head->next->facet_num;
+    	if (! facets_to_fix.empty()) {
+      		facet_num = facets_to_fix.back();
             assert(facet_num < stl->stats.number_of_facets);
       		if (norm_sw[facet_num] != 1) { // If facet is in list mutiple times
         		norm_sw[facet_num] = 1; // Record this one as being fixed.
         		++ checked;
       		}
-      		stl_normal *temp = head->next;	// Delete this facet from the list.
-      		head->next = head->next->next;
-      		// pool.destroy(temp);
+      		facets_to_fix.pop_back(); // Delete this facet from the stack.
     	} else { // If we ran out of facets to fix: All of the facets in this part have been fixed.
       		++ stl->stats.number_of_parts;
       		if (checked >= int(stl->stats.number_of_facets))
@@ -216,9 +201,6 @@ void stl_fix_normal_directions(stl_file *stl)
       			}
     	}
   	}
-
-	// pool.destroy(head);
-	// pool.destroy(tail);
 }
 
 void stl_fix_normal_values(stl_file *stl)
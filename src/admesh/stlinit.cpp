@@ -232,6 +232,14 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first, Impor
 
   	char normal_buf[3][32];
 
+	// Binary facets are read from the file in blocks, a fread() per facet dominated loading of big files.
+	const uint32_t    binary_block_facets = 4096;
+	std::vector<char> binary_block;
+	size_t            binary_block_pos  = 0;
+	size_t            binary_block_size = 0;
+	if (stl->stats.type == binary)
+		binary_block.assign(binary_block_facets * SIZEOF_STL_FACET, 0);
+
 	uint32_t facets_num = stl->stats.number_of_facets;
 	uint32_t unit = facets_num / LOAD_STL_UNIT_NUM + 1;
     for (uint32_t i = first_facet; i < facets_num; ++ i) {
@@ -250,8 +258,14 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first, Impor
 
 
       		// Read a single facet from a binary .STL file. We assume little-endian architecture!
-      		if (fread(&facet, 1, SIZEOF_STL_FACET, fp) != SIZEOF_STL_FACET)
-      			return false;
+      		if (binary_block_pos == binary_block_size) {
+      			binary_block_pos  = 0;
+      			binary_block_size = fread(binary_block.data(), SIZEOF_STL_FACET, std::min(binary_block_facets, facets_num - i), fp) * SIZEOF_STL_FACET;
+      			if (binary_block_size == 0)
+      				return false;
+      		}
+      		memcpy(&facet, binary_block.data() + binary_block_pos, SIZEOF_STL_FACET);
+      		binary_block_pos += SIZEOF_STL_FACET;
 
 
 #if BOOST_ENDIAN_BIG_BYTE
@@ -50,10 +50,10 @@
 #include <assert.h>
 #include <libslic3r/Int128.hpp>
 
-// Profiling support using the Shiny intrusive profiler
+// Profiling support using the thread safe intrusive profiler of libslic3r
 //#define CLIPPERLIB_PROFILE
 #if defined(SLIC3R_PROFILE) && defined(CLIPPERLIB_PROFILE)
-	#include <Shiny/Shiny.h>
+	#include <libslic3r/Profiler.hpp>
 	#define CLIPPERLIB_PROFILE_FUNC() PROFILE_FUNC()
 	#define CLIPPERLIB_PROFILE_BLOCK(name) PROFILE_BLOCK(name)
 #else
@@ -772,7 +772,7 @@ bool ClipperBase::AddPath(const Path &pg, PolyType PolyTyp, bool Closed)
     return false;
 
   // Allocate a new edge array.
-  std::vector<TEdge> edges(highI + 1);
+  std::vector<TEdge> edges = AllocateEdges(highI + 1);
   // Fill in the edge array.
   bool result = AddPathInternal(pg, highI, PolyTyp, Closed, edges.data());
   if (result)
@@ -959,10 +959,26 @@ bool ClipperBase::AddPathInternal(const Path &pg, int highI, PolyType PolyTyp, b
 }
 //------------------------------------------------------------------------------
 
+std::vector<TEdge> ClipperBase::AllocateEdges(size_t num_edges)
+{
+  if (m_edges_free.empty())
+    return std::vector<TEdge>(num_edges);
+  std::vector<TEdge> edges = std::move(m_edges_free.back());
+  m_edges_free.pop_back();
+  edges.assign(num_edges, TEdge());
+  return edges;
+}
+//------------------------------------------------------------------------------
+
 void ClipperBase::Clear()
 {
   CLIPPERLIB_PROFILE_FUNC();
   m_MinimaList.clear();
+  if (m_RecycleMemory) {
+    for (std::vector<TEdge> &edges : m_edges)
+      m_edges_free.emplace_back(std::move(edges));
+  } else
+    m_edges_free.clear();
   m_edges.clear();
 #ifndef CLIPPERLIB_INT32
   m_UseFullRange = false;
@@ -1047,6 +1063,7 @@ IntRect ClipperBase::GetBounds()
 
 Clipper::Clipper(int initOptions) : 
   ClipperBase(),
+  m_OutPtsChunksUsed(0),
   m_OutPtsFree(nullptr),
   m_OutPtsChunkSize(32),
   m_OutPtsChunkLast(32),
@@ -1189,23 +1206,32 @@ OutPt* Clipper::AllocateOutPt()
     m_OutPtsFree = pt->Next;
   } else if (m_OutPtsChunkLast < m_OutPtsChunkSize) {
     // Get a point from the last chunk.
-    pt = m_OutPts.back() + (m_OutPtsChunkLast ++);
+    pt = m_OutPts[m_OutPtsChunksUsed - 1] + (m_OutPtsChunkLast ++);
   } else {
-    // The last chunk is full. Allocate a new one.
-    m_OutPts.push_back(new OutPt[m_OutPtsChunkSize]);
+    // The last chunk is full. Reuse a recycled chunk or allocate a new one.
+    if (m_OutPtsChunksUsed == m_OutPts.size())
+      m_OutPts.push_back(new OutPt[m_OutPtsChunkSize]);
     m_OutPtsChunkLast = 1;
-    pt = m_OutPts.back();
+    pt = m_OutPts[m_OutPtsChunksUsed ++];
   }
   return pt;
 }
 
 void Clipper::DisposeAllOutRecs()
 {
-  for (OutPt *pts : m_OutPts)
-    delete[] pts;
-  for (OutRec *rec : m_PolyOuts)
-    delete rec;
-  m_OutPts.clear();
+  if (m_RecycleMemory) {
+    m_PolyOutsFree.insert(m_PolyOutsFree.end(), m_PolyOuts.begin(), m_PolyOuts.end());
+  } else {
+    for (OutPt *pts : m_OutPts)
+      delete[] pts;
+    for (OutRec *rec : m_PolyOuts)
+      delete rec;
+    for (OutRec *rec : m_PolyOutsFree)
+      delete rec;
+    m_OutPts.clear();
+    m_PolyOutsFree.clear();
+  }
+  m_OutPtsChunksUsed = 0;
   m_OutPtsFree = nullptr;
   m_OutPtsChunkLast = m_OutPtsChunkSize;
   m_PolyOuts.clear();
@@ -1988,7 +2014,13 @@ void Clipper::AppendPolygon(TEdge *e1, TEdge *e2) const
 
 OutRec* Clipper::CreateOutRec()
 {
-  OutRec* result = new OutRec;
+  OutRec* result;
+  if (m_PolyOutsFree.empty())
+    result = new OutRec;
+  else {
+    result = m_PolyOutsFree.back();
+    m_PolyOutsFree.pop_back();
+  }
   result->IsHole = false;
   result->IsOpen = false;
   result->FirstLeft = 0;
@@ -296,8 +296,9 @@ public:
 #ifndef CLIPPERLIB_INT32
     m_UseFullRange(false), 
 #endif // CLIPPERLIB_INT32
-    m_HasOpenPaths(false) {}
-  ~ClipperBase() { Clear(); }
+    m_HasOpenPaths(false),
+    m_RecycleMemory(false) {}
+  ~ClipperBase() { m_RecycleMemory = false; Clear(); }
   bool AddPath(const Path &pg, PolyType PolyTyp, bool Closed);
 
   template<typename PathsProvider>
@@ -330,7 +331,7 @@ public:
       return false;
 
     // Allocate a new edge array.
-    std::vector<TEdge> edges(num_edges_total);
+    std::vector<TEdge> edges = AllocateEdges(num_edges_total);
     // Fill in the edge array.
     bool result = false;
     TEdge *p_edge = edges.data();
@@ -357,7 +358,12 @@ public:
   // When enabled the PreserveCollinear property prevents this default behavior to allow these inner vertices to appear in the solution.
   bool PreserveCollinear() const {return m_PreserveCollinear;};
   void PreserveCollinear(bool value) {m_PreserveCollinear = value;};
+  // Keep the memory of the edges and of the output polygons after Clear() / Execute() to be reused by the following operations
+  // instead of returning it to the heap. The memory is released by RecycleMemory(false) followed by Clear() or by the destructor.
+  bool RecycleMemory() const { return m_RecycleMemory; }
+  void RecycleMemory(bool value) { m_RecycleMemory = value; }
 protected:
+  std::vector<TEdge> AllocateEdges(size_t num_edges);
   bool AddPathInternal(const Path &pg, int highI, PolyType PolyTyp, bool Closed, TEdge* edges);
   TEdge* AddBoundsToLML(TEdge *e, bool IsClosed);
   void Reset();
@@ -378,10 +384,13 @@ protected:
 
   // A vector of edges per each input path.
   std::vector<std::vector<TEdge>> m_edges;
+  // Edge arrays released by Clear() while m_RecycleMemory is set.
+  std::vector<std::vector<TEdge>> m_edges_free;
   // Don't remove intermediate vertices of a collinear sequence of points.
   bool             m_PreserveCollinear;
   // Is any of the paths inserted by AddPath() or AddPaths() open?
   bool             m_HasOpenPaths;
+  bool             m_RecycleMemory;
 };
 //------------------------------------------------------------------------------
 
@@ -389,7 +398,7 @@ class Clipper : public ClipperBase
 {
 public:
   Clipper(int initOptions = 0);
-  ~Clipper() { Clear(); }
+  ~Clipper() { m_RecycleMemory = false; Clear(); }
   void Clear() { ClipperBase::Clear(); DisposeAllOutRecs(); }
   bool Execute(ClipType clipType,
       Paths &solution,
@@ -424,6 +433,10 @@ private:
   std::vector<OutRec*>  m_PolyOuts;
   // Output points, allocated by a continuous sets of m_OutPtsChunkSize.
   std::vector<OutPt*>   m_OutPts;
+  // Number of chunks of m_OutPts in use, the others are kept for reuse if m_RecycleMemory is set.
+  size_t                m_OutPtsChunksUsed;
+  // Output polygons released while m_RecycleMemory is set.
+  std::vector<OutRec*>  m_PolyOutsFree;
   // List of free output points, to be used before taking a point from m_OutPts or allocating a new chunk.
   OutPt                *m_OutPtsFree;
   size_t                m_OutPtsChunkSize;
@@ -3181,6 +3181,7 @@ void    ImFont::ClearOutputData()
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    MissingGlyphs.clear();
 }
 
 void ImFont::BuildLookupTable()
@@ -3231,6 +3232,8 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i < max_codepoint + 1; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+    //BBS: the lookups above are not rendered characters
+    MissingGlyphs.clear();
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -3331,11 +3334,13 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    const ImWchar i = c < (size_t)IndexLookup.Size ? IndexLookup.Data[c] : (ImWchar)-1;
+    if (i == (ImWchar)-1) {
+        //BBS: remember the missing character, so that the application may add it to the atlas
+        if (!MissingGlyphs.contains(c))
+            MissingGlyphs.push_back(c);
         return FallbackGlyph;
+    }
     return &Glyphs.Data[i];
 }
 
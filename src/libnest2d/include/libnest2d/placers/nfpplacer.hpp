@@ -8,6 +8,9 @@
 #include <iterator>
 #include <future>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #ifndef NDEBUG
 #include <iostream>
@@ -457,6 +460,106 @@ _Circle<TPoint<RawShape>> boundingCircle(const RawShape& sh) {
     return minimizeCircle(sh);
 }
 
+/**
+ * Cache of convex no-fit polygons of a placer, thus of a single arrange run.
+ * Identical parts, e.g. the copies of an object or the items of fill bed, meet
+ * the same pairs of fixed and orbiting contours again. The pairs are matched up
+ * to a translation of either shape, as the inflation and rotation are already
+ * baked into the contours.
+ */
+template<class RawShape>
+class NfpCache {
+    using Vertex  = TPoint<RawShape>;
+    using Contour = std::vector<Vertex>;
+
+    struct Key {
+        Contour fixed, orbiting;
+        bool operator==(const Key &o) const { return fixed == o.fixed && orbiting == o.orbiting; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &k) const { return hash(k.fixed) * 31 + hash(k.orbiting); }
+    };
+
+    // Beyond this the cache is dropped as a whole, there is no point in an LRU for a single arrange run.
+    static constexpr size_t MaxEntries = 20000;
+
+    std::unordered_map<Key, nfp::NfpResult<RawShape>, KeyHash> entries_;
+    std::mutex mutex_;
+
+    static Contour normalized(const RawShape &sh)
+    {
+        Contour c;
+        c.reserve(shapelike::contourVertexCount(sh));
+        if (shapelike::contourVertexCount(sh) == 0)
+            return c;
+        Vertex o = *shapelike::cbegin(sh);
+        for (auto it = shapelike::cbegin(sh); it != shapelike::cend(sh); ++it)
+            c.emplace_back(*it - o);
+        return c;
+    }
+
+    static void translate(nfp::NfpResult<RawShape> &nfp, const Vertex &d)
+    {
+        shapelike::translate(nfp.first, d);
+        nfp.second = nfp.second + d;
+    }
+
+public:
+    // Hash of the contour relative to its first vertex.
+    template<class Container> static size_t hash(const Container &contour)
+    {
+        size_t h = contour.size();
+        if (contour.empty())
+            return h;
+        Vertex o = *contour.begin();
+        for (const Vertex &v : contour) {
+            Vertex d = v - o;
+            h ^= std::hash<long long>()(static_cast<long long>(getX(d))) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<long long>()(static_cast<long long>(getY(d))) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+
+    static size_t hash(const RawShape &sh) { return hash(normalized(sh)); }
+
+    // Returns the convex NFP of the two shapes, computing it outside of the lock on a miss.
+    nfp::NfpResult<RawShape> convexNfp(const RawShape &fixed, const RawShape &orbiting)
+    {
+        if (shapelike::contourVertexCount(fixed) == 0 || shapelike::contourVertexCount(orbiting) == 0)
+            return nfp::noFitPolygon<nfp::NfpLevel::CONVEX_ONLY>(fixed, orbiting);
+
+        // NFP(A + a, B + b) = NFP(A, B) + a - b, entries are stored for a = b = 0.
+        Vertex offset = *shapelike::cbegin(fixed) - *shapelike::cbegin(orbiting);
+        Key key{normalized(fixed), normalized(orbiting)};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = entries_.find(key);
+            if (it != entries_.end()) {
+                nfp::NfpResult<RawShape> res = it->second;
+                translate(res, offset);
+                return res;
+            }
+        }
+
+        nfp::NfpResult<RawShape> res = nfp::noFitPolygon<nfp::NfpLevel::CONVEX_ONLY>(fixed, orbiting);
+        nfp::NfpResult<RawShape> stored = res;
+        translate(stored, Vertex(-offset));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entries_.size() >= MaxEntries)
+            entries_.clear();
+        entries_.emplace(std::move(key), std::move(stored));
+        return res;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+};
+
 template<class RawShape, class TBin = _Box<TPoint<RawShape>>>
 class _NofitPolyPlacer: public PlacerBoilerplate<_NofitPolyPlacer<RawShape, TBin>,
         RawShape, TBin, NfpPConfig<RawShape>> {
@@ -481,6 +584,8 @@ private:
     double score_ = 0;  // BBS: total costs of putting all the items
     int plate_id = 0;   // BBS
     Pile merged_pile_;
+    // Shared by the copies of the placer, released with the last one at the end of the arrange run.
+    std::shared_ptr<NfpCache<RawShape>> nfp_cache_ = std::make_shared<NfpCache<RawShape>>();
 
 public:
 
@@ -605,6 +710,60 @@ private:
 
     using Shapes = TMultiShape<RawShape>;
 
+    // Groups shapes whose contours are equal up to a translation, e.g. copies of one part
+    // placed with the same rotation. Their NFPs against a given orbiting shape are translated
+    // copies of each other, so only one NFP per group has to be computed. Returns for every
+    // shape the index of its group representative, the representatives are stored in reps.
+    template<class ShapeAt>
+    static std::vector<size_t> translationClasses(size_t count, ShapeAt &&shape_at, std::vector<size_t> &reps)
+    {
+        std::vector<size_t> cls(count);
+        std::unordered_map<size_t, std::vector<size_t>> buckets;
+        reps.clear();
+
+        auto same_contour = [&shape_at](size_t a, size_t b) {
+            const RawShape &sa = shape_at(a), &sb = shape_at(b);
+            if (sl::contourVertexCount(sa) != sl::contourVertexCount(sb)) return false;
+            auto ia = sl::cbegin(sa), ib = sl::cbegin(sb);
+            TPoint<RawShape> oa = *ia, ob = *ib;
+            for (; ia != sl::cend(sa); ++ia, ++ib)
+                if (TPoint<RawShape>(*ia - oa) != TPoint<RawShape>(*ib - ob)) return false;
+            return true;
+        };
+
+        for (size_t n = 0; n < count; ++n) {
+            const RawShape &sh = shape_at(n);
+            cls[n] = n;
+            if (sl::contourVertexCount(sh) == 0) {
+                reps.emplace_back(n);
+                continue;
+            }
+
+            std::vector<size_t> &bucket = buckets[NfpCache<RawShape>::hash(sh)];
+            auto rep = std::find_if(bucket.begin(), bucket.end(), [&](size_t r) { return same_contour(r, n); });
+            if (rep != bucket.end())
+                cls[n] = *rep;
+            else {
+                bucket.emplace_back(n);
+                reps.emplace_back(n);
+            }
+        }
+
+        return cls;
+    }
+
+    // Fills the NFPs of the non representative shapes from the one computed for their group.
+    template<class ShapeAt>
+    static void copyTranslatedNfps(Shapes &nfps, const std::vector<size_t> &cls, ShapeAt &&shape_at)
+    {
+        for (size_t n = 0; n < cls.size(); ++n) {
+            if (cls[n] == n) continue;
+            TPoint<RawShape> d = *sl::cbegin(shape_at(n)) - *sl::cbegin(shape_at(cls[n]));
+            nfps[n] = nfps[cls[n]];
+            sl::translate(nfps[n], d);
+        }
+    }
+
     Shapes calcnfp(const Item &trsh, const Box& bed ,Lvl<nfp::NfpLevel::CONVEX_ONLY>)
     {
         using namespace nfp;
@@ -628,16 +787,24 @@ private:
         }
         // /////////////////////////////////////////////////////////////////////
 
-        __parallel::enumerate(items_.begin(), items_.end(),
-                              [&nfps, &trsh](const Item& sh, size_t n)
+        std::vector<size_t> reps;
+        std::vector<size_t> cls = translationClasses(items_.size(),
+            [this](size_t n) -> const RawShape& { return items_[n].get().transformedShape(); }, reps);
+
+        __parallel::enumerate(reps.begin(), reps.end(),
+                              [this, &nfps, &trsh](size_t idx, size_t)
         {
+            const Item& sh = items_[idx];
             auto& fixedp = sh.transformedShape();
             auto& orbp = trsh.transformedShape();
-            auto subnfp_r = noFitPolygon<NfpLevel::CONVEX_ONLY>(fixedp, orbp);
+            auto subnfp_r = nfp_cache_->convexNfp(fixedp, orbp);
             correctNfpPosition(subnfp_r, sh, trsh);
-            nfps[n] = subnfp_r.first;
+            nfps[idx] = subnfp_r.first;
         });
 
+        copyTranslatedNfps(nfps, cls,
+            [this](size_t n) -> const RawShape& { return items_[n].get().transformedShape(); });
+
         RawShape innerNfp = nfpInnerRectBed(bed, trsh.transformedShape()).first;
         Shapes finalNFP = nfp::subtract({ innerNfp }, nfps);
         return finalNFP;
@@ -650,11 +817,16 @@ private:
         Shapes nfps(stationarys.size());
         Item   slidingItem(sliding);
         slidingItem.transformedShape();
-        __parallel::enumerate(stationarys.begin(), stationarys.end(), [&nfps, sliding, &slidingItem](const RawShape &stationary, size_t n) {
-            auto subnfp_r = noFitPolygon<NfpLevel::CONVEX_ONLY>(stationary, sliding);
+        auto stationary_at = [&stationarys](size_t n) -> const RawShape& { return stationarys[n]; };
+        std::vector<size_t> reps;
+        std::vector<size_t> cls = translationClasses(stationarys.size(), stationary_at, reps);
+        __parallel::enumerate(reps.begin(), reps.end(), [this, &nfps, &stationarys, &sliding, &slidingItem](size_t idx, size_t) {
+            const RawShape &stationary = stationarys[idx];
+            auto subnfp_r = nfp_cache_->convexNfp(stationary, sliding);
             correctNfpPosition(subnfp_r, stationary, slidingItem);
-            nfps[n] = subnfp_r.first;
+            nfps[idx] = subnfp_r.first;
         });
+        copyTranslatedNfps(nfps, cls, stationary_at);
 
         RawShape innerNfp = nfpInnerRectBed(bed, sliding).first;
         return nfp::subtract({innerNfp}, nfps);
@@ -118,6 +118,24 @@ public:
 
         auto& cancelled = this->stopcond_;
 
+        // A plate whose free area is smaller than the bare item can not take it, so the NFP placement
+        // on that plate can be skipped. This is what keeps arranging many parts across many plates
+        // from trying every item on every full plate. The items placed by the placer do not overlap
+        // and stay in the bin, which is grown by the inflation an item may keep after fitting without it.
+        auto binbb = sl::boundingBox(bin);
+        auto fits_by_area = [&binbb](Placer &placer, const Item &item, double item_area) {
+            double used = 0.;
+            auto   infl = std::max(item.inflation(), decltype(item.inflation())(0));
+            for (const Item &placed : placer.getItems()) {
+                if (placed.isFixed() || placed.is_virt_object || placed.is_wipe_tower) continue;
+                used += placed.area();
+                infl = std::max(infl, placed.inflation());
+            }
+            double w = double(getX(binbb.maxCorner())) - double(getX(binbb.minCorner())) + 2. * infl;
+            double h = double(getY(binbb.maxCorner())) - double(getY(binbb.minCorner())) + 2. * infl;
+            return item_area <= w * h - used;
+        };
+
         //this->template remove_unpackable_items<Placer>(store_, bin, pconfig);
 
         for (auto it = store_.begin(); it != store_.end() && !cancelled(); ++it) {
@@ -130,6 +148,7 @@ public:
             double score = LARGE_COST_TO_REJECT+1, best_score = LARGE_COST_TO_REJECT+1;
             double score_all_plates = 0, score_all_plates_best = std::numeric_limits<double>::max();
             typename Placer::PackResult result, result_best, result_firstfit;
+            const double item_area = std::abs(sl::area(it->get().rawShape()));
             int j = 0;
             while (!was_packed && !cancelled() && placers.size() <= MAX_NUM_PLATES) {
                 for(; j < placers.size() && !was_packed && !cancelled() && j<MAX_NUM_PLATES; j++) {
@@ -138,6 +157,13 @@ public:
                             this->unfitindicator_(it->get().name + " cant be placed in plate_id=" + std::to_string(j) + "/" + std::to_string(placers.size()) + ", continue to next plate");
                         continue;
                     }
+                    if (!it->get().is_wipe_tower && !fits_by_area(placers[j], it->get(), item_area)) {
+                        // same state as a failed pack leaves the item in
+                        it->get().translation({0, 0});
+                        if (this->unfitindicator_)
+                            this->unfitindicator_(it->get().name + " is larger than the free area of plate_id=" + std::to_string(j) + ", skip it");
+                        continue;
+                    }
                     result = placers[j].pack(*it, rem(it, store_));
                     score = result.score();
                     score_all_plates = score + COST_OF_NEW_PLATE * j; // add a larger cost to larger plate id to encourace to use less plates
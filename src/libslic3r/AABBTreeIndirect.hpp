@@ -265,13 +265,15 @@ namespace detail {
 	// SSE support requires 16 byte alignment of the AABB nodes, representing the bounding boxes with 4+4 floats,
 	// storing the node index as the 4th element of the bounding box min value etc.
 	// https://www.flipcode.com/archives/SSE_RayBox_Intersection_Test.shtml
+	// Returns the ray parameter of the box entry point in t_entry, which may be negative if the origin is inside the box.
 	template <typename Derivedsource, typename Deriveddir, typename Scalar>
 	inline bool ray_box_intersect_invdir(
   		const Eigen::MatrixBase<Derivedsource> 	&origin,
   		const Eigen::MatrixBase<Deriveddir> 	&inv_dir,
   		Eigen::AlignedBox<Scalar,3> 			 box,
   		const Scalar 							&t0,
-  		const Scalar 							&t1) {
+  		const Scalar 							&t1,
+  		Scalar 									&t_entry) {
 		// http://people.csail.mit.edu/amy/papers/box-jgt.pdf
 		// "An Efficient and Robust Ray–Box Intersection Algorithm"
 		if (inv_dir.x() < 0)
@@ -302,9 +304,21 @@ namespace detail {
 			tmin = tzmin;
 		if (tzmax < tmax)
 			tmax = tzmax;
+		t_entry = tmin;
         return tmin < t1 && tmax > t0;
 	}
 
+	template <typename Derivedsource, typename Deriveddir, typename Scalar>
+	inline bool ray_box_intersect_invdir(
+  		const Eigen::MatrixBase<Derivedsource> 	&origin,
+  		const Eigen::MatrixBase<Deriveddir> 	&inv_dir,
+  		const Eigen::AlignedBox<Scalar,3> 		&box,
+  		const Scalar 							&t0,
+  		const Scalar 							&t1) {
+		Scalar t_entry;
+		return ray_box_intersect_invdir(origin, inv_dir, box, t0, t1, t_entry);
+	}
+
 	// The following intersect_triangle() is derived from raytri.c routine intersect_triangle1()
 	// Ray-Triangle Intersection Test Routines
 	// Different optimizations of my and Ben Trumbore's
@@ -392,8 +406,10 @@ namespace detail {
 		return eps;
 	}
 
+	// Bounding box of node_idx is known to be intersected by the ray before min_t.
+	// The children are visited front to back, so that the far child is usually culled by the hit found in the near one.
     template<typename RayIntersectorType, typename Scalar>
-	static inline bool intersect_ray_recursive_first_hit(
+	static inline bool intersect_ray_node_first_hit(
         RayIntersectorType 	   &ray_intersector,
         size_t 				    node_idx,
         Scalar                  min_t,
@@ -401,9 +417,6 @@ namespace detail {
 	{
         const auto &node = ray_intersector.tree.node(node_idx);
         assert(node.is_valid());
-		
-        if (! ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir, node.bbox.template cast<Scalar>(), Scalar(0), min_t))
-			return false;
 
 	  	if (node.is_leaf()) {
 		    // shoot ray, record hit
@@ -413,30 +426,48 @@ namespace detail {
 		    		ray_intersector.origin, ray_intersector.dir, 
 		    		ray_intersector.vertices[face(0)], ray_intersector.vertices[face(1)], ray_intersector.vertices[face(2)], 
                     t, u, v, ray_intersector.eps)
-		    	&& t > 0.) {
+		    	&& t > 0. && t < min_t) {
                 hit = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
 				return true;
 		    } else
 		    	return false;
-	  	} else {
-			// Left / right child node index.
-			size_t left  = node_idx * 2 + 1;
-			size_t right = left + 1;
-			igl::Hit left_hit;
-			igl::Hit right_hit;
-	        bool left_ret = intersect_ray_recursive_first_hit(ray_intersector, left,  min_t, left_hit);
-			if (left_ret && left_hit.t < min_t) {
-	    		min_t = left_hit.t;
-	    		hit   = left_hit;
-	  		} else
-			    left_ret = false;
-	        bool right_ret = intersect_ray_recursive_first_hit(ray_intersector, right, min_t, right_hit);
-			if (right_ret && right_hit.t < min_t)
-				hit = right_hit;
-			else
-				right_ret = false;
-			return left_ret || right_ret;
+	  	}
+
+		// Left / right child node index, ordered by the distance of their bounding box entry points.
+		size_t children[2] = { node_idx * 2 + 1, node_idx * 2 + 2 };
+		Scalar t_entry[2];
+		bool   intersects[2];
+		for (size_t i = 0; i < 2; ++ i)
+			intersects[i] = ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir,
+				ray_intersector.tree.node(children[i]).bbox.template cast<Scalar>(), Scalar(0), min_t, t_entry[i]);
+		if (intersects[0] && intersects[1] && t_entry[1] < t_entry[0]) {
+			std::swap(children[0], children[1]);
+			std::swap(t_entry[0], t_entry[1]);
 		}
+		bool ret = false;
+		for (size_t i = 0; i < 2; ++ i)
+			if (intersects[i] && t_entry[i] < min_t) {
+				igl::Hit child_hit;
+				if (intersect_ray_node_first_hit(ray_intersector, children[i], min_t, child_hit)) {
+					min_t = child_hit.t;
+					hit   = child_hit;
+					ret   = true;
+				}
+			}
+		return ret;
+	}
+
+    template<typename RayIntersectorType, typename Scalar>
+	static inline bool intersect_ray_recursive_first_hit(
+        RayIntersectorType 	   &ray_intersector,
+        size_t 				    node_idx,
+        Scalar                  min_t,
+        igl::Hit 			   &hit)
+	{
+        const auto &node = ray_intersector.tree.node(node_idx);
+        assert(node.is_valid());
+        return ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir, node.bbox.template cast<Scalar>(), Scalar(0), min_t) &&
+               intersect_ray_node_first_hit(ray_intersector, node_idx, min_t, hit);
 	}
 
     template<typename RayIntersectorType>
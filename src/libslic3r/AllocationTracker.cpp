@@ -0,0 +1,171 @@
+#include "AllocationTracker.hpp"
+
+#ifdef SLIC3R_ALLOCATION_TRACKING
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(WIN32)
+    #include <malloc.h>
+#elif defined(__APPLE__)
+    #include <malloc/malloc.h>
+#else
+    #include <malloc.h>
+#endif
+
+namespace Slic3r { namespace AllocationTracker {
+
+// Plain globals with constant initialization, so that allocations made during the static initialization are counted.
+static std::atomic<uint64_t> s_allocated_bytes { 0 };
+static std::atomic<uint64_t> s_allocations { 0 };
+static std::atomic<int64_t>  s_live_bytes { 0 };
+static std::atomic<int64_t>  s_peak_live_bytes { 0 };
+
+static inline void on_allocated(size_t size)
+{
+    s_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    int64_t live = s_live_bytes.fetch_add(int64_t(size), std::memory_order_relaxed) + int64_t(size);
+    int64_t peak = s_peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak && ! s_peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) ;
+}
+
+static inline void on_released(size_t size)
+{
+    s_live_bytes.fetch_sub(int64_t(size), std::memory_order_relaxed);
+}
+
+// The sizes are queried from the C runtime, so that the unsized operator delete releases exactly what was counted.
+static inline size_t usable_size(void *ptr)
+{
+#if defined(WIN32)
+    return _msize(ptr);
+#elif defined(__APPLE__)
+    return malloc_size(ptr);
+#else
+    return malloc_usable_size(ptr);
+#endif
+}
+
+static inline void* allocate(size_t size)
+{
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr != nullptr)
+        on_allocated(usable_size(ptr));
+    return ptr;
+}
+
+static inline void release(void *ptr)
+{
+    if (ptr != nullptr) {
+        on_released(usable_size(ptr));
+        std::free(ptr);
+    }
+}
+
+static inline void* allocate_aligned(size_t size, size_t alignment)
+{
+    if (size == 0)
+        size = 1;
+#if defined(WIN32)
+    void *ptr = _aligned_malloc(size, alignment);
+    if (ptr != nullptr)
+        on_allocated(_aligned_msize(ptr, alignment, 0));
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, std::max(alignment, sizeof(void*)), size) != 0)
+        ptr = nullptr;
+    if (ptr != nullptr)
+        on_allocated(usable_size(ptr));
+#endif
+    return ptr;
+}
+
+static inline void release_aligned(void *ptr, size_t alignment)
+{
+    if (ptr != nullptr) {
+#if defined(WIN32)
+        on_released(_aligned_msize(ptr, alignment, 0));
+        _aligned_free(ptr);
+#else
+        on_released(usable_size(ptr));
+        std::free(ptr);
+#endif
+    }
+}
+
+bool enabled() { return true; }
+
+Stats stats()
+{
+    Stats out;
+    out.allocated_bytes = s_allocated_bytes.load(std::memory_order_relaxed);
+    out.allocations     = s_allocations.load(std::memory_order_relaxed);
+    out.live_bytes      = s_live_bytes.load(std::memory_order_relaxed);
+    out.peak_live_bytes = s_peak_live_bytes.load(std::memory_order_relaxed);
+    return out;
+}
+
+} } // namespace Slic3r::AllocationTracker
+
+using namespace Slic3r::AllocationTracker;
+
+// Replacements of the global allocation functions.
+static void* allocate_or_throw(size_t size)
+{
+    for (;;) {
+        if (void *ptr = allocate(size); ptr != nullptr)
+            return ptr;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+static void* allocate_aligned_or_throw(size_t size, std::align_val_t alignment)
+{
+    for (;;) {
+        if (void *ptr = allocate_aligned(size, size_t(alignment)); ptr != nullptr)
+            return ptr;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new  (size_t size)                                             { return allocate_or_throw(size); }
+void* operator new[](size_t size)                                             { return allocate_or_throw(size); }
+void* operator new  (size_t size, const std::nothrow_t&) noexcept             { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept             { return allocate(size); }
+void* operator new  (size_t size, std::align_val_t alignment)                 { return allocate_aligned_or_throw(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment)                 { return allocate_aligned_or_throw(size, alignment); }
+void* operator new  (size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate_aligned(size, size_t(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate_aligned(size, size_t(alignment)); }
+
+void operator delete  (void *ptr) noexcept                                    { release(ptr); }
+void operator delete[](void *ptr) noexcept                                    { release(ptr); }
+void operator delete  (void *ptr, size_t) noexcept                            { release(ptr); }
+void operator delete[](void *ptr, size_t) noexcept                            { release(ptr); }
+void operator delete  (void *ptr, const std::nothrow_t&) noexcept             { release(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept             { release(ptr); }
+void operator delete  (void *ptr, std::align_val_t alignment) noexcept        { release_aligned(ptr, size_t(alignment)); }
+void operator delete[](void *ptr, std::align_val_t alignment) noexcept        { release_aligned(ptr, size_t(alignment)); }
+void operator delete  (void *ptr, size_t, std::align_val_t alignment) noexcept { release_aligned(ptr, size_t(alignment)); }
+void operator delete[](void *ptr, size_t, std::align_val_t alignment) noexcept { release_aligned(ptr, size_t(alignment)); }
+void operator delete  (void *ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { release_aligned(ptr, size_t(alignment)); }
+void operator delete[](void *ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { release_aligned(ptr, size_t(alignment)); }
+
+#else /* SLIC3R_ALLOCATION_TRACKING */
+
+namespace Slic3r { namespace AllocationTracker {
+
+bool  enabled() { return false; }
+Stats stats()   { return Stats(); }
+
+} } // namespace Slic3r::AllocationTracker
+
+#endif /* SLIC3R_ALLOCATION_TRACKING */
@@ -0,0 +1,33 @@
+#ifndef slic3r_AllocationTracker_hpp_
+#define slic3r_AllocationTracker_hpp_
+
+#include <cstdint>
+
+namespace Slic3r {
+
+// BBS: process wide counters of the heap allocations made through the global operator new / delete.
+// The counters are only maintained if BambuStudio is compiled with SLIC3R_ALLOCATION_TRACKING, as the replacement
+// of the global allocation functions costs a few atomic operations per allocation. Allocations made directly
+// by malloc() or by the TBB scalable allocator are not counted.
+namespace AllocationTracker {
+
+struct Stats
+{
+    // Sum of the sizes of all the allocations.
+    uint64_t allocated_bytes { 0 };
+    uint64_t allocations { 0 };
+    // Bytes allocated and not released yet.
+    int64_t  live_bytes { 0 };
+    // Maximum of live_bytes.
+    int64_t  peak_live_bytes { 0 };
+};
+
+// Was BambuStudio compiled with SLIC3R_ALLOCATION_TRACKING?
+bool  enabled();
+// Zeroed stats if not enabled().
+Stats stats();
+
+} // namespace AllocationTracker
+} // namespace Slic3r
+
+#endif /* slic3r_AllocationTracker_hpp_ */
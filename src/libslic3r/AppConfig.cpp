@@ -183,6 +183,15 @@ void AppConfig::set_defaults()
         set_bool("show_shells_in_preview", true);
     if (get("enable_lod").empty())
         set_bool("enable_lod", true);
+    // G-code preview memory budget in MB, 0 for unlimited.
+    if (get("gcode_preview_memory_budget").empty())
+        set("gcode_preview_memory_budget", "0");
+    // Store the processed G-code in the 3mf next to the G-code of the plates, larger files but faster preview after reopening.
+    if (get("store_gcode_result_in_3mf").empty())
+        set_bool("store_gcode_result_in_3mf", false);
+    // Memory of the slicing caches in MB, 0 disables them.
+    if (get("slicing_cache_size").empty())
+        set("slicing_cache_size", "384");
     if (get("gamma_correct_in_import_obj").empty())
         set_bool("gamma_correct_in_import_obj", false);
     if (get("enable_opengl_multi_instance").empty())
@@ -375,7 +375,7 @@ SkeletalTrapezoidation::SkeletalTrapezoidation(const Polygons& polys, const Bead
                                                double transitioning_angle, coord_t discretization_step_size,
                                                coord_t transition_filter_dist, coord_t allowed_filter_deviation,
                                                coord_t beading_propagation_transition_dist, bool enable_hole_compensation,
-                                               const std::vector<int>& hole_indices
+                                               const std::vector<int>& hole_indices, SkeletalTrapezoidationWorkspace &workspace
     ): transitioning_angle(transitioning_angle),
     discretization_step_size(discretization_step_size),
     transition_filter_dist(transition_filter_dist),
@@ -383,11 +383,28 @@ SkeletalTrapezoidation::SkeletalTrapezoidation(const Polygons& polys, const Bead
     beading_propagation_transition_dist(beading_propagation_transition_dist),
     beading_strategy(beading_strategy),
     enable_hole_compensation(enable_hole_compensation),
-    hole_indices(hole_indices)
+    hole_indices(hole_indices),
+    workspace(workspace),
+    vd_edge_to_he_edge(workspace.vd_edge_to_he_edge),
+    vd_node_to_he_node(workspace.vd_node_to_he_node)
 {
     constructFromPolygons(polys);
 }
 
+void SkeletalTrapezoidationWorkspace::clear()
+{
+    voronoi_diagram.clear();
+    segments.clear();
+    vd_edge_to_he_edge.clear();
+    vd_node_to_he_node.clear();
+}
+
+SkeletalTrapezoidationWorkspace &SkeletalTrapezoidationWorkspace::thread_local_workspace()
+{
+    thread_local SkeletalTrapezoidationWorkspace workspace;
+    return workspace;
+}
+
 void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 {
 #ifdef ARACHNE_DEBUG
@@ -404,10 +421,9 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
         return !grid.has_intersecting_edges();
     }());
 
-    vd_edge_to_he_edge.clear();
-    vd_node_to_he_node.clear();
+    workspace.clear();
 
-    std::vector<Segment> segments;
+    std::vector<Segment> &segments = workspace.segments;
     for (size_t poly_idx = 0; poly_idx < polys.size(); poly_idx++)
         for (size_t point_idx = 0; point_idx < polys[poly_idx].size(); point_idx++)
             segments.emplace_back(&polys, poly_idx, point_idx);
@@ -421,7 +437,7 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
     }
 #endif
 
-    VD voronoi_diagram;
+    VD &voronoi_diagram = workspace.voronoi_diagram;
     voronoi_diagram.construct_voronoi(segments.cbegin(), segments.cend());
 
 #ifdef ARACHNE_DEBUG_VORONOI
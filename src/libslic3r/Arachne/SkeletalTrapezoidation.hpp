@@ -28,6 +28,8 @@ namespace Slic3r::Arachne {
 
 using VD = Slic3r::Geometry::VoronoiDiagram;
 
+class SkeletalTrapezoidationWorkspace;
+
 /*!
  * Main class of the dynamic beading strategies.
  *
@@ -103,6 +105,8 @@ public:
      * \param beading_propagation_transition_dist When there are different
      * beadings propagated from below and from above, use this transitioning
      * distance.
+     * \param workspace Buffers reused between consecutive trapezoidations,
+     * they must not be shared with another living SkeletalTrapezoidation.
      */
     SkeletalTrapezoidation(const Polygons& polys,
                            const BeadingStrategy& beading_strategy,
@@ -112,7 +116,8 @@ public:
     , coord_t allowed_filter_deviation
     , coord_t beading_propagation_transition_dist
     , bool enable_hole_compensation
-    , const std::vector<int>& hole_indices);
+    , const std::vector<int>& hole_indices
+    , SkeletalTrapezoidationWorkspace &workspace);
 
     /*!
      * A skeletal graph through the polygons that we need to fill with beads.
@@ -167,12 +172,15 @@ protected:
      */
     void constructFromPolygons(const Polygons& polys);
 
+    SkeletalTrapezoidationWorkspace &workspace;
+
     /*!
      * mapping each voronoi VD edge to the corresponding halfedge HE edge
      * In case the result segment is discretized, we map the VD edge to the *last* HE edge
+     * Both maps are owned by the workspace.
      */
-    EdgeMap vd_edge_to_he_edge;
-    NodeMap vd_node_to_he_node;
+    EdgeMap &vd_edge_to_he_edge;
+    NodeMap &vd_node_to_he_node;
     node_t &makeNode(const VD::vertex_type &vd_node, Point p); //!< Get the node which the VD node maps to, or create a new mapping if there wasn't any yet.
 
     /*!
@@ -581,5 +589,27 @@ protected:
     void generateLocalMaximaSingleBeads();
 };
 
+/*!
+ * Buffers of SkeletalTrapezoidation which are worth keeping between the outlines
+ * processed one after another, e.g. the islands of a layer.
+ *
+ * Everything is cleared instead of released, so the Voronoi diagram, its builder,
+ * the input segments and the maps from the Voronoi diagram to the half-edge graph
+ * keep their capacity for the next outline.
+ */
+class SkeletalTrapezoidationWorkspace
+{
+public:
+    VD                                          voronoi_diagram;
+    std::vector<SkeletalTrapezoidation::Segment> segments;
+    SkeletalTrapezoidation::EdgeMap             vd_edge_to_he_edge;
+    SkeletalTrapezoidation::NodeMap             vd_node_to_he_node;
+
+    void clear();
+
+    // Workspace of the calling thread, reused by all the WallToolPaths generated by that thread.
+    static SkeletalTrapezoidationWorkspace &thread_local_workspace();
+};
+
 } // namespace Slic3r::Arachne
 #endif // VORONOI_QUADRILATERALIZATION_H
@@ -439,6 +439,25 @@ void removeColinearEdges(Polygons &thiss, const double max_deviation_angle = 0.0
 }
 
 const std::vector<VariableWidthLines> &WallToolPaths::generate()
+{
+    return this->generate(SkeletalTrapezoidationWorkspace::thread_local_workspace());
+}
+
+void WallToolPaths::generateBatch(std::vector<WallToolPaths> &wall_tool_paths)
+{
+    SkeletalTrapezoidationWorkspace &workspace = SkeletalTrapezoidationWorkspace::thread_local_workspace();
+    // Size the input segments for the biggest outline at once.
+    size_t max_points = 0;
+    for (const WallToolPaths &paths : wall_tool_paths)
+        max_points = std::max(max_points, count_points(paths.outline));
+    workspace.segments.reserve(max_points);
+
+    for (WallToolPaths &paths : wall_tool_paths)
+        if (!paths.toolpaths_generated)
+            paths.generate(workspace);
+}
+
+const std::vector<VariableWidthLines> &WallToolPaths::generate(SkeletalTrapezoidationWorkspace &workspace)
 {
     if (this->inset_count < 1)
         return toolpaths;
@@ -527,7 +546,8 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
         allowed_filter_deviation,
         wall_transition_length,
         apply_hole_compensation,
-        hole_indices
+        hole_indices,
+        workspace
     );
     wall_maker.generateToolpaths(toolpaths);
 
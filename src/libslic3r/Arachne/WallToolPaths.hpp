@@ -20,6 +20,8 @@ constexpr coord_t meshfix_maximum_resolution               = scaled<coord_t>(0.5
 constexpr coord_t meshfix_maximum_deviation                = scaled<coord_t>(0.025);
 constexpr coord_t meshfix_maximum_extrusion_area_deviation = scaled<coord_t>(2.);
 
+class SkeletalTrapezoidationWorkspace;
+
 class WallToolPathsParams
 {
 public:
@@ -51,6 +53,18 @@ public:
      */
     const std::vector<VariableWidthLines> &generate();
 
+    /*!
+     * Generates the Toolpaths, reusing the buffers of \p workspace instead of the ones of the calling thread.
+     * \return A reference to the newly create  ToolPaths
+     */
+    const std::vector<VariableWidthLines> &generate(SkeletalTrapezoidationWorkspace &workspace);
+
+    /*!
+     * Generates the Toolpaths of several independent outlines one after another, e.g. of all the islands of a layer,
+     * so that all of them share one workspace of the calling thread.
+     */
+    static void generateBatch(std::vector<WallToolPaths> &wall_tool_paths);
+
     /*!
      * Gets the toolpaths, if this called before \p generate() it will first generate the Toolpaths
      * \return a reference to the toolpaths
@@ -26,6 +26,17 @@
 
 namespace Slic3r {
 
+// ExPolygons of src with their bounding box overlapping bbox. Clipping against them gives the same result as clipping against whole src
+// inside bbox, while the brims of the far away objects are not touched.
+static ExPolygons expolygons_near(const ExPolygons &src, const BoundingBox &bbox)
+{
+    ExPolygons out;
+    for (const ExPolygon &expoly : src)
+        if (get_extents(expoly.contour).overlap(bbox))
+            out.emplace_back(expoly);
+    return out;
+}
+
 static void append_and_translate(ExPolygons &dst, const ExPolygons &src, const PrintInstance &instance) {
     size_t dst_idx = dst.size();
     expolygons_append(dst, src);
@@ -41,7 +52,7 @@ static void append_and_translate(ExPolygons& dst, const ExPolygons& src,
     Point instance_shift = instance.shift_without_plate_offset();
     for (size_t src_idx = 0; src_idx < srcShifted.size(); ++src_idx)
         srcShifted[src_idx].translate(instance_shift);
-    srcShifted = diff_ex(srcShifted, dst);
+    srcShifted = diff_ex(srcShifted, expolygons_near(dst, get_extents(srcShifted)));
     //expolygons_append(dst, temp2);
     expolygons_append(brimAreaMap[instance.print_object->id()], std::move(srcShifted));
 }
@@ -840,6 +851,154 @@ static ExPolygons make_brim_ears(const PrintObject* object, const double& flowWi
     return mouse_ears_ex;
 }
 
+// Brim area of a single object, not yet placed on the bed.
+struct ObjectBrimArea
+{
+    ExPolygons brim_area;
+    ExPolygons no_brim_area;
+    Polygons   holes;
+    ExPolygons object_island;
+};
+
+static void object_brim_area(const Print &print, const PrintObject *object, const float no_brim_offset, ObjectBrimArea &out)
+{
+    Flow flow = print.brim_flow();
+
+    auto save_polygon_if_is_inner_island = [](const Polygons& holes_area, const Polygon& contour, int& hole_index) {
+        for (size_t i = 0; i < holes_area.size(); i++) {
+            Polygons contour_polys;
+            contour_polys.push_back(contour);
+            if (diff_ex(contour_polys, { holes_area[i] }).empty()) {
+                // BBS: this is an inner island inside holes_area[i], save
+                hole_index = i;
+                return;
+            }
+        }
+        hole_index = -1;
+    };
+    const float scaled_flow_width = print.brim_flow().scaled_spacing();
+    const BrimType     brim_type = object->config().brim_type.value;
+    float              brim_offset = scale_(object->config().brim_object_gap.value);
+    double             flowWidth = print.brim_flow().scaled_spacing() * SCALING_FACTOR;
+    float              brim_width = scale_(floor(object->config().brim_width.value / flowWidth / 2) * flowWidth * 2);
+    const float        scaled_additional_brim_width = scale_(floor(5 / flowWidth / 2) * flowWidth * 2);
+    const float        scaled_half_min_adh_length = scale_(1.1);
+    bool               has_brim_auto = object->config().brim_type == btAutoBrim;
+    bool         use_brim_ears = object->config().brim_type == btBrimEars;
+    // if (object->model_object()->brim_points.size()>0 && has_brim_auto)
+    //     use_brim_ears = true;
+    const bool         has_inner_brim = brim_type == btInnerOnly || brim_type == btOuterAndInner || use_brim_ears;
+    const bool         has_outer_brim = brim_type == btOuterOnly || brim_type == btOuterAndInner || brim_type == btAutoBrim || use_brim_ears;
+
+    double             deltaT = getTemperatureFromExtruder(object);
+    double             adhension = getadhesionCoeff(object);
+    double             maxSpeed = Model::findMaxSpeed(object->model_object());
+
+    //BBS: collect holes area which is used to limit the brim of inner island
+    Polygons holes_area;
+    for (const ExPolygon& ex_poly : object->layers().front()->lslices)
+        polygons_append(holes_area, ex_poly.holes);
+
+    // BBS: brims are generated by volume groups
+    for (const auto& volumeGroup : object->firstLayerObjGroups()) {
+        // if this object has raft only update no_brim_area_object
+        if (object->has_raft()) continue;
+        // find volumePtrs included in this group
+        std::vector<ModelVolume*> groupVolumePtrs;
+        for (auto& volumeID : volumeGroup.volume_ids) {
+            ModelVolume* currentModelVolumePtr = nullptr;
+            //BBS: support shared object logic
+            const PrintObject* shared_object = object->get_shared_object();
+            if (!shared_object)
+                shared_object = object;
+            for (auto volumePtr : shared_object->model_object()->volumes) {
+                if (volumePtr->id() == volumeID) {
+                    currentModelVolumePtr = volumePtr;
+                    break;
+                }
+            }
+            if (currentModelVolumePtr != nullptr) groupVolumePtrs.push_back(currentModelVolumePtr);
+        }
+        if (groupVolumePtrs.empty()) continue;
+        double groupHeight = 0.;
+        // config brim width in auto-brim mode
+        if (has_brim_auto) {
+            double brimWidthRaw = configBrimWidthByVolumeGroups(adhension, maxSpeed, groupVolumePtrs, volumeGroup.slices, groupHeight);
+            brim_width = scale_(floor(brimWidthRaw / flowWidth / 2) * flowWidth * 2);
+        }
+
+        for (const ExPolygon& ex_poly : volumeGroup.slices) {
+            // BBS: additional brim width will be added if part's adhension area is too small and brim is not generated
+            float brim_width_mod;
+            if (0 && brim_width < scale_(5.) && has_brim_auto && groupHeight > 10.) {
+                brim_width_mod = ex_poly.area() / ex_poly.contour.length() < scaled_half_min_adh_length
+                    && brim_width < scaled_flow_width ? brim_width + scaled_additional_brim_width : brim_width;
+            }
+            else {
+                brim_width_mod = brim_width;
+            }
+            //BBS: brim width should be limited to the 1.5*boundingboxSize of a single polygon.
+            if (has_brim_auto) {
+                BoundingBox bbox2 = ex_poly.contour.bounding_box();
+                brim_width_mod = std::min(brim_width_mod, float(std::max(bbox2.size()(0), bbox2.size()(1))));
+            }
+            brim_width_mod = floor(brim_width_mod / scaled_flow_width / 2) * scaled_flow_width * 2;
+
+            Polygons ex_poly_holes_reversed = ex_poly.holes;
+            polygons_reverse(ex_poly_holes_reversed);
+
+            if (has_outer_brim) {
+
+                // BBS: to find whether an island is in a hole of its object
+                int contour_hole_index = -1;
+                save_polygon_if_is_inner_island(holes_area, ex_poly.contour, contour_hole_index);
+
+                // BBS: inner and outer boundary are offset from the same polygon incase of round off error.
+                auto innerExpoly = offset_ex(ex_poly.contour, brim_offset, jtRound, SCALED_RESOLUTION);
+                ExPolygons outerExpoly;
+                if (use_brim_ears) {
+                    outerExpoly = make_brim_ears(object, flowWidth, brim_offset, flow, true);
+                    //outerExpoly = offset_ex(outerExpoly, brim_width_mod, jtRound, SCALED_RESOLUTION);
+                }else {
+                    outerExpoly = offset_ex(innerExpoly, brim_width_mod, jtRound, SCALED_RESOLUTION);
+                }
+
+                if (contour_hole_index < 0) {
+                    append(out.brim_area, diff_ex(outerExpoly, innerExpoly));
+                }else {
+                    ExPolygons brimBeforeClip = diff_ex(outerExpoly, innerExpoly);
+
+                    // BBS: an island's brim should not be outside of its belonging hole
+                    Polygons selectedHole = { holes_area[contour_hole_index] };
+                    ExPolygons clippedBrim = intersection_ex(brimBeforeClip, selectedHole);
+                    append(out.brim_area, clippedBrim);
+                }
+            }
+            if (has_inner_brim) {
+                ExPolygons outerExpoly;
+                auto innerExpoly = offset_ex(ex_poly_holes_reversed, -brim_width - brim_offset);
+                if (use_brim_ears) {
+                    outerExpoly = make_brim_ears(object, flowWidth, brim_offset, flow, false);
+                }else {
+                    outerExpoly = offset_ex(ex_poly_holes_reversed, -brim_offset);
+                }
+                append(out.brim_area, diff_ex(outerExpoly, innerExpoly));
+            }
+            if (!has_inner_brim) {
+                // BBS: brim should be apart from holes
+                append(out.no_brim_area, diff_ex(ex_poly_holes_reversed, offset_ex(ex_poly_holes_reversed, -scale_(5.))));
+            }
+            if (!has_outer_brim)
+                append(out.no_brim_area, diff_ex(offset(ex_poly.contour, no_brim_offset), ex_poly_holes_reversed));
+            if (!has_inner_brim && !has_outer_brim)
+                append(out.no_brim_area, offset_ex(ex_poly_holes_reversed, -no_brim_offset));
+            append(out.holes, ex_poly_holes_reversed);
+        }
+    }
+    out.object_island = offset_ex(object->layers().front()->lslices, brim_offset, jtRound, SCALED_RESOLUTION);
+    append(out.no_brim_area, out.object_island);
+}
+
 //BBS: create all brims
 static ExPolygons outer_inner_brim_area(const Print& print,
     const float no_brim_offset, std::map<ObjectID, ExPolygons>& brimAreaMap,
@@ -862,159 +1021,36 @@ static ExPolygons outer_inner_brim_area(const Print& print,
     for (const auto& objectWithExtruder : objPrintVec)
         brimToWrite.insert({ objectWithExtruder.first, {true,true} });
 
+    // The brim areas of the objects are independent of each other, compute them in parallel.
+    std::map<ObjectID, size_t> object_area_idx;
+    std::vector<const PrintObject*> area_objects;
+    for (const auto& objectWithExtruder : objPrintVec)
+        if (object_area_idx.emplace(objectWithExtruder.first, area_objects.size()).second)
+            area_objects.emplace_back(print.get_object(objectWithExtruder.first));
+    std::vector<ObjectBrimArea> object_areas(area_objects.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, area_objects.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            object_brim_area(print, area_objects[i], no_brim_offset, object_areas[i]);
+    });
+
     ExPolygons objectIslands;
-    auto save_polygon_if_is_inner_island = [](const Polygons& holes_area, const Polygon& contour, int& hole_index) {
-        for (size_t i = 0; i < holes_area.size(); i++) {
-            Polygons contour_polys;
-            contour_polys.push_back(contour);
-            if (diff_ex(contour_polys, { holes_area[i] }).empty()) {
-                // BBS: this is an inner island inside holes_area[i], save
-                hole_index = i;
-                return;
-            }
-        }
-        hole_index = -1;
-    };
     const float scaled_flow_width = print.brim_flow().scaled_spacing();
     for (unsigned int extruderNo : printExtruders) {
         ++extruderNo;
         for (const auto& objectWithExtruder : objPrintVec) {
             const PrintObject* object = print.get_object(objectWithExtruder.first);
-            const BrimType     brim_type = object->config().brim_type.value;
-            float              brim_offset = scale_(object->config().brim_object_gap.value);
-            double             flowWidth = print.brim_flow().scaled_spacing() * SCALING_FACTOR;
-            float              brim_width = scale_(floor(object->config().brim_width.value / flowWidth / 2) * flowWidth * 2);
-            const float        scaled_additional_brim_width = scale_(floor(5 / flowWidth / 2) * flowWidth * 2);
-            const float        scaled_half_min_adh_length = scale_(1.1);
-            bool               has_brim_auto = object->config().brim_type == btAutoBrim;
-            bool         use_brim_ears = object->config().brim_type == btBrimEars;
-            // if (object->model_object()->brim_points.size()>0 && has_brim_auto)
-            //     use_brim_ears = true;
-            const bool         has_inner_brim = brim_type == btInnerOnly || brim_type == btOuterAndInner || use_brim_ears;
-            const bool         has_outer_brim = brim_type == btOuterOnly || brim_type == btOuterAndInner || brim_type == btAutoBrim || use_brim_ears;
-
-            ExPolygons         brim_area_object;
-            ExPolygons         no_brim_area_object;
             ExPolygons         brim_area_support;
             ExPolygons         no_brim_area_support;
-            Polygons           holes_object;
             Polygons           holes_support;
             if (objectWithExtruder.second == extruderNo && brimToWrite.at(object->id()).obj) {
-                double             deltaT = getTemperatureFromExtruder(object);
-                double             adhension = getadhesionCoeff(object);
-                double             maxSpeed = Model::findMaxSpeed(object->model_object());
-
-                //BBS: collect holes area which is used to limit the brim of inner island
-                Polygons holes_area;
-                for (const ExPolygon& ex_poly : object->layers().front()->lslices)
-                    polygons_append(holes_area, ex_poly.holes);
-
-                // BBS: brims are generated by volume groups
-                for (const auto& volumeGroup : object->firstLayerObjGroups()) {
-                    // if this object has raft only update no_brim_area_object
-                    if (object->has_raft()) continue;
-                    // find volumePtrs included in this group
-                    std::vector<ModelVolume*> groupVolumePtrs;
-                    for (auto& volumeID : volumeGroup.volume_ids) {
-                        ModelVolume* currentModelVolumePtr = nullptr;
-                        //BBS: support shared object logic
-                        const PrintObject* shared_object = object->get_shared_object();
-                        if (!shared_object)
-                            shared_object = object;
-                        for (auto volumePtr : shared_object->model_object()->volumes) {
-                            if (volumePtr->id() == volumeID) {
-                                currentModelVolumePtr = volumePtr;
-                                break;
-                            }
-                        }
-                        if (currentModelVolumePtr != nullptr) groupVolumePtrs.push_back(currentModelVolumePtr);
-                    }
-                    if (groupVolumePtrs.empty()) continue;
-                    double groupHeight = 0.;
-                    // config brim width in auto-brim mode
-                    if (has_brim_auto) {
-                        double brimWidthRaw = configBrimWidthByVolumeGroups(adhension, maxSpeed, groupVolumePtrs, volumeGroup.slices, groupHeight);
-                        brim_width = scale_(floor(brimWidthRaw / flowWidth / 2) * flowWidth * 2);
-                    }
-
-                    for (const ExPolygon& ex_poly : volumeGroup.slices) {
-                        // BBS: additional brim width will be added if part's adhension area is too small and brim is not generated
-                        float brim_width_mod;
-                        if (0 && brim_width < scale_(5.) && has_brim_auto && groupHeight > 10.) {
-                            brim_width_mod = ex_poly.area() / ex_poly.contour.length() < scaled_half_min_adh_length
-                                && brim_width < scaled_flow_width ? brim_width + scaled_additional_brim_width : brim_width;
-                        }
-                        else {
-                            brim_width_mod = brim_width;
-                        }
-                        //BBS: brim width should be limited to the 1.5*boundingboxSize of a single polygon.
-                        if (has_brim_auto) {
-                            BoundingBox bbox2 = ex_poly.contour.bounding_box();
-                            brim_width_mod = std::min(brim_width_mod, float(std::max(bbox2.size()(0), bbox2.size()(1))));
-                        }
-                        brim_width_mod = floor(brim_width_mod / scaled_flow_width / 2) * scaled_flow_width * 2;
-
-                        Polygons ex_poly_holes_reversed = ex_poly.holes;
-                        polygons_reverse(ex_poly_holes_reversed);
-
-                        if (has_outer_brim) {
-
-                            // BBS: to find whether an island is in a hole of its object
-                            int contour_hole_index = -1;
-                            save_polygon_if_is_inner_island(holes_area, ex_poly.contour, contour_hole_index);
-
-                            // BBS: inner and outer boundary are offset from the same polygon incase of round off error.
-                            auto innerExpoly = offset_ex(ex_poly.contour, brim_offset, jtRound, SCALED_RESOLUTION);
-                            ExPolygons outerExpoly;
-                            if (use_brim_ears) {
-                                outerExpoly = make_brim_ears(object, flowWidth, brim_offset, flow, true);
-                                //outerExpoly = offset_ex(outerExpoly, brim_width_mod, jtRound, SCALED_RESOLUTION);
-                            }else {
-                                outerExpoly = offset_ex(innerExpoly, brim_width_mod, jtRound, SCALED_RESOLUTION);
-                            }
-
-                            if (contour_hole_index < 0) {
-                                append(brim_area_object, diff_ex(outerExpoly, innerExpoly));
-                            }else {
-                                ExPolygons brimBeforeClip = diff_ex(outerExpoly, innerExpoly);
-
-                                // BBS: an island's brim should not be outside of its belonging hole
-                                Polygons selectedHole = { holes_area[contour_hole_index] };
-                                ExPolygons clippedBrim = intersection_ex(brimBeforeClip, selectedHole);
-                                append(brim_area_object, clippedBrim);
-                            }
-                        }
-                        if (has_inner_brim) {
-                            ExPolygons outerExpoly;
-                            auto innerExpoly = offset_ex(ex_poly_holes_reversed, -brim_width - brim_offset);
-                            if (use_brim_ears) {
-                                outerExpoly = make_brim_ears(object, flowWidth, brim_offset, flow, false);
-                            }else {
-                                outerExpoly = offset_ex(ex_poly_holes_reversed, -brim_offset);
-                            }
-                            append(brim_area_object, diff_ex(outerExpoly, innerExpoly));
-                        }
-                        if (!has_inner_brim) {
-                            // BBS: brim should be apart from holes
-                            append(no_brim_area_object, diff_ex(ex_poly_holes_reversed, offset_ex(ex_poly_holes_reversed, -scale_(5.))));
-                        }
-                        if (!has_outer_brim)
-                            append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset), ex_poly_holes_reversed));
-                        if (!has_inner_brim && !has_outer_brim)
-                            append(no_brim_area_object, offset_ex(ex_poly_holes_reversed, -no_brim_offset));
-                        append(holes_object, ex_poly_holes_reversed);
-                    }
-                }
-                auto objectIsland = offset_ex(object->layers().front()->lslices, brim_offset, jtRound, SCALED_RESOLUTION);
-                append(no_brim_area_object, objectIsland);
-
+                const ObjectBrimArea &object_area = object_areas[object_area_idx.at(object->id())];
                 brimToWrite.at(object->id()).obj = false;
                 for (const PrintInstance& instance : object->instances()) {
-                    if (!brim_area_object.empty())
-                        append_and_translate(brim_area, brim_area_object, instance, print, brimAreaMap);
-                    append_and_translate(no_brim_area, no_brim_area_object, instance);
-                    append_and_translate(holes, holes_object, instance);
-                    append_and_translate(objectIslands, objectIsland, instance);
+                    if (!object_area.brim_area.empty())
+                        append_and_translate(brim_area, object_area.brim_area, instance, print, brimAreaMap);
+                    append_and_translate(no_brim_area, object_area.no_brim_area, instance);
+                    append_and_translate(holes, object_area.holes, instance);
+                    append_and_translate(objectIslands, object_area.object_island, instance);
 
                 }
                 if (brimAreaMap.find(object->id()) != brimAreaMap.end())
@@ -1067,44 +1103,66 @@ static ExPolygons outer_inner_brim_area(const Print& print,
         expolygons_append(no_brim_area, expolyFromLines);
     }
 
-    for (const PrintObject* object : print.objects()) {
-        ExPolygons extruder_no_brim_area = no_brim_area;
-        auto iter = std::find_if(objPrintVec.begin(), objPrintVec.end(), [object](const std::pair<ObjectID, unsigned int>& item) {
-            return item.first == object->id();
-        });
+    std::vector<ExPolygons> extruder_bed_no_brim_area(extruder_unprintable_area.size());
+    for (size_t extruder_id = 0; extruder_id < extruder_unprintable_area.size(); ++extruder_id) {
+        const Polygons &bedPoly   = extruder_unprintable_area[extruder_id];
+        ExPolygons      bedExPoly = diff_ex((offset(bedPoly, scale_(30.), jtRound, SCALED_RESOLUTION)), {bedPoly});
+        if (!bedExPoly.empty())
+            extruder_bed_no_brim_area[extruder_id].push_back(std::move(bedExPoly.front()));
+    }
 
-        if (iter != objPrintVec.end()) {
-            int extruder_id = filament_map[iter->second - 1] - 1;
-            auto bedPoly = extruder_unprintable_area[extruder_id];
-            auto bedExPoly   = diff_ex((offset(bedPoly, scale_(30.), jtRound, SCALED_RESOLUTION)), {bedPoly});
-            if (!bedExPoly.empty()) {
-                extruder_no_brim_area.push_back(bedExPoly.front());
-            }
-            extruder_no_brim_area = offset2_ex(extruder_no_brim_area, scaled_flow_width, -scaled_flow_width); // connect scattered small areas to prevent generating very small brims
+    // Each object is only clipped by the no brim areas in its neighbourhood, the objects are processed in parallel.
+    // The areas closer than 3 flow widths are taken, as offset2_ex() below does not propagate further.
+    std::vector<const PrintObject*> brim_objects(print.objects().begin(), print.objects().end());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, brim_objects.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t object_idx = range.begin(); object_idx < range.end(); ++object_idx) {
+            const PrintObject *object = brim_objects[object_idx];
+            auto brim_it         = brimAreaMap.find(object->id());
+            auto support_brim_it = supportBrimAreaMap.find(object->id());
+            if (brim_it == brimAreaMap.end() && support_brim_it == supportBrimAreaMap.end())
+                continue;
+            BoundingBox bbox;
+            if (brim_it != brimAreaMap.end())
+                bbox.merge(get_extents(brim_it->second));
+            if (support_brim_it != supportBrimAreaMap.end())
+                bbox.merge(get_extents(support_brim_it->second));
+            if (!bbox.defined)
+                continue;
+            bbox.offset(3 * scaled_flow_width);
+            ExPolygons extruder_no_brim_area = expolygons_near(no_brim_area, bbox);
+            auto iter = std::find_if(objPrintVec.begin(), objPrintVec.end(), [object](const std::pair<ObjectID, unsigned int>& item) {
+                return item.first == object->id();
+            });
 
-        }
+            if (iter != objPrintVec.end()) {
+                int extruder_id = filament_map[iter->second - 1] - 1;
+                expolygons_append(extruder_no_brim_area, extruder_bed_no_brim_area[extruder_id]);
+                extruder_no_brim_area = offset2_ex(extruder_no_brim_area, scaled_flow_width, -scaled_flow_width); // connect scattered small areas to prevent generating very small brims
+            }
 
-        if (brimAreaMap.find(object->id()) != brimAreaMap.end()) {
-            brimAreaMap[object->id()] = diff_ex(brimAreaMap[object->id()], extruder_no_brim_area);
+            if (brim_it != brimAreaMap.end())
+                brim_it->second = diff_ex(brim_it->second, extruder_no_brim_area);
+            if (support_brim_it != supportBrimAreaMap.end())
+                support_brim_it->second = diff_ex(support_brim_it->second, extruder_no_brim_area);
         }
-
-        if (supportBrimAreaMap.find(object->id()) != supportBrimAreaMap.end())
-            supportBrimAreaMap[object->id()] = diff_ex(supportBrimAreaMap[object->id()], extruder_no_brim_area);
-    }
+    });
 
     brim_area.clear();
     for (const PrintObject* object : print.objects()) {
         // BBS: brim should be contacted to at least one object's island or brim area
         if (brimAreaMap.find(object->id()) != brimAreaMap.end()) {
-            // find other objects' brim area
+            auto tempAreas = brimAreaMap[object->id()];
+            BoundingBox bbox = get_extents(tempAreas);
+            bbox.offset(print.brim_flow().scaled_spacing() * 3);
+
+            // find other objects' brim area, only the neighbouring ones may touch this brim
             ExPolygons otherExPolys;
             for (const PrintObject* otherObject : print.objects()) {
                 if ((otherObject->id() != object->id()) && (brimAreaMap.find(otherObject->id()) != brimAreaMap.end())) {
-                    expolygons_append(otherExPolys, brimAreaMap[otherObject->id()]);
+                    expolygons_append(otherExPolys, expolygons_near(brimAreaMap[otherObject->id()], bbox));
                 }
             }
-
-            auto tempAreas = brimAreaMap[object->id()];
+            const ExPolygons nearObjectIslands = expolygons_near(objectIslands, bbox);
             brimAreaMap[object->id()].clear();
             brimAreaMap[object->id()].reserve(tempAreas.size());
             brim_area.reserve(brim_area.size() + tempAreas.size());
@@ -1112,13 +1170,13 @@ static ExPolygons outer_inner_brim_area(const Print& print,
             std::vector<int> retained{};
             tbb::spin_mutex brimMutex;
             tbb::parallel_for(tbb::blocked_range<int>(0, tempAreas.size()),
-                [&tempAreas, &objectIslands, &print, &otherExPolys, &brimMutex, &retained](const tbb::blocked_range<int>& range) {
+                [&tempAreas, &nearObjectIslands, &print, &otherExPolys, &brimMutex, &retained](const tbb::blocked_range<int>& range) {
                     for (auto ia = range.begin(); ia != range.end(); ++ia) {
                         tbb::spin_mutex::scoped_lock lock;
                         ExPolygons otherExPoly;
 
                         auto offsetedTa = offset_ex(tempAreas[ia], print.brim_flow().scaled_spacing() * 2, jtRound, SCALED_RESOLUTION);
-                        if (overlaps(offsetedTa, objectIslands) ||
+                        if (overlaps(offsetedTa, nearObjectIslands) ||
                             overlaps(offsetedTa, otherExPolys)) {
                             lock.acquire(brimMutex);
                             retained.push_back(ia);
@@ -1127,6 +1185,8 @@ static ExPolygons outer_inner_brim_area(const Print& print,
                     }
                 });
 
+            // keep the order of the brim areas independent of the thread scheduling
+            std::sort(retained.begin(), retained.end());
             for (auto& index : retained) {
                 brimAreaMap[object->id()].push_back(tempAreas[index]);
                 brim_area.push_back(tempAreas[index]);
@@ -1732,16 +1792,22 @@ void make_brim(const Print& print, PrintTryCancel try_cancel, Polygons& islands_
     for (size_t iia = 0; iia < islands_area.size(); ++iia)
         islands_area[iia].translate(plate_shift);
 
-    for (auto iter = brimAreaMap.begin(); iter != brimAreaMap.end(); ++iter) {
-        if (!iter->second.empty()) {
-            brimMap.insert(std::make_pair(iter->first, makeBrimInfill(iter->second, print, islands_area)));
-        };
-    }
-    for (auto iter = supportBrimAreaMap.begin(); iter != supportBrimAreaMap.end(); ++iter) {
-        if (!iter->second.empty()) {
-            supportBrimMap.insert(std::make_pair(iter->first, makeBrimInfill(iter->second, print, islands_area)));
-        };
-    }
+    // BBS: the brim extrusions of the objects are generated in parallel
+    auto make_brim_infills = [&print, &islands_area](const std::map<ObjectID, ExPolygons> &areaMap, std::map<ObjectID, ExtrusionEntityCollection> &outMap) {
+        std::vector<std::map<ObjectID, ExPolygons>::const_iterator> areas;
+        for (auto iter = areaMap.begin(); iter != areaMap.end(); ++iter)
+            if (!iter->second.empty())
+                areas.emplace_back(iter);
+        std::vector<ExtrusionEntityCollection> infills(areas.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, areas.size()), [&areas, &infills, &print, &islands_area](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i)
+                infills[i] = makeBrimInfill(areas[i]->second, print, islands_area);
+        });
+        for (size_t i = 0; i < areas.size(); ++i)
+            outMap.insert(std::make_pair(areas[i]->first, std::move(infills[i])));
+    };
+    make_brim_infills(brimAreaMap, brimMap);
+    make_brim_infills(supportBrimAreaMap, supportBrimMap);
 
     size_t          num_loops = size_t(floor(brim_width_max / flow.spacing()));
     BOOST_LOG_TRIVIAL(debug) << "brim_width_max, num_loops: " << brim_width_max << ", " << num_loops;
@@ -2,16 +2,22 @@
 #include "Geometry.hpp"
 #include "ShortestPath.hpp"
 
+#include "clipper2/clipper.h"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
 // #define CLIPPER_UTILS_DEBUG
 
 #ifdef CLIPPER_UTILS_DEBUG
 #include "SVG.hpp"
 #endif /* CLIPPER_UTILS_DEBUG */
 
-// Profiling support using the Shiny intrusive profiler
+// Profiling support using the thread safe intrusive profiler
 //#define CLIPPER_UTILS_PROFILE
 #if defined(SLIC3R_PROFILE) && defined(CLIPPER_UTILS_PROFILE)
-	#include <Shiny/Shiny.h>
+	#include "Profiler.hpp"
 	#define CLIPPERUTILS_PROFILE_FUNC() PROFILE_FUNC()
 	#define CLIPPERUTILS_PROFILE_BLOCK(name) PROFILE_BLOCK(name)
 #else
@@ -60,6 +66,201 @@ namespace ClipperUtils {
 Points EmptyPathsProvider::s_empty_points;
 Points SinglePathProvider::s_end;
 
+struct ThreadScratch {
+    int                                  depth { 0 };
+    // The shared Clipper is being used by a ScratchClipper.
+    bool                                 busy  { false };
+    std::unique_ptr<ClipperLib::Clipper> clipper;
+};
+static thread_local ThreadScratch s_thread_scratch;
+
+ScratchScope::ScratchScope()
+{
+    if (s_thread_scratch.depth ++ == 0) {
+        s_thread_scratch.clipper = std::make_unique<ClipperLib::Clipper>();
+        s_thread_scratch.clipper->RecycleMemory(true);
+    }
+}
+
+ScratchScope::~ScratchScope()
+{
+    assert(s_thread_scratch.depth > 0 && ! s_thread_scratch.busy);
+    if (-- s_thread_scratch.depth == 0)
+        s_thread_scratch.clipper.reset();
+}
+
+// Clipper for a single boolean operation: the shared Clipper of the thread inside a ScratchScope, a private one otherwise.
+class ScratchClipper
+{
+public:
+    ScratchClipper() {
+        if (s_thread_scratch.depth > 0 && ! s_thread_scratch.busy) {
+            s_thread_scratch.busy = true;
+            m_clipper = s_thread_scratch.clipper.get();
+        } else {
+            m_local.emplace();
+            m_clipper = &*m_local;
+        }
+    }
+    ~ScratchClipper() {
+        if (! m_local) {
+            // Restore the state of a newly constructed Clipper, keeping its memory.
+            m_clipper->Clear();
+            m_clipper->ReverseSolution(false);
+            m_clipper->StrictlySimple(false);
+            m_clipper->PreserveCollinear(false);
+            s_thread_scratch.busy = false;
+        }
+    }
+    ScratchClipper(const ScratchClipper&) = delete;
+    ScratchClipper& operator=(const ScratchClipper&) = delete;
+
+    ClipperLib::Clipper& operator*() { return *m_clipper; }
+
+private:
+    ClipperLib::Clipper                *m_clipper;
+    std::optional<ClipperLib::Clipper>  m_local;
+};
+
+static std::atomic<uint32_t> s_clipper2_operations { 0 };
+
+void set_clipper2_operations(uint32_t operations) { s_clipper2_operations.store(operations, std::memory_order_relaxed); }
+uint32_t clipper2_operations() { return s_clipper2_operations.load(std::memory_order_relaxed); }
+
+static inline bool clipper2_enabled(uint32_t operation) { return (clipper2_operations() & operation) != 0; }
+static inline bool clipper2_enabled(ClipperLib::ClipType clip_type)
+{
+    switch (clip_type) {
+    case ClipperLib::ctIntersection: return clipper2_enabled(c2Intersection);
+    case ClipperLib::ctUnion:        return clipper2_enabled(c2Union);
+    case ClipperLib::ctDifference:   return clipper2_enabled(c2Difference);
+    default:                         return clipper2_enabled(c2Xor);
+    }
+}
+
+static inline Clipper2Lib::ClipType clipper2_clip_type(ClipperLib::ClipType clip_type)
+{
+    switch (clip_type) {
+    case ClipperLib::ctIntersection: return Clipper2Lib::ClipType::Intersection;
+    case ClipperLib::ctUnion:        return Clipper2Lib::ClipType::Union;
+    case ClipperLib::ctDifference:   return Clipper2Lib::ClipType::Difference;
+    default:                         return Clipper2Lib::ClipType::Xor;
+    }
+}
+
+static inline Clipper2Lib::FillRule clipper2_fill_rule(ClipperLib::PolyFillType fill_type)
+{
+    switch (fill_type) {
+    case ClipperLib::pftEvenOdd:     return Clipper2Lib::FillRule::EvenOdd;
+    case ClipperLib::pftNonZero:     return Clipper2Lib::FillRule::NonZero;
+    case ClipperLib::pftPositive:    return Clipper2Lib::FillRule::Positive;
+    default:                         return Clipper2Lib::FillRule::Negative;
+    }
+}
+
+static inline Clipper2Lib::JoinType clipper2_join_type(ClipperLib::JoinType join_type)
+{
+    switch (join_type) {
+    case ClipperLib::jtSquare:       return Clipper2Lib::JoinType::Square;
+    case ClipperLib::jtRound:        return Clipper2Lib::JoinType::Round;
+    default:                         return Clipper2Lib::JoinType::Miter;
+    }
+}
+
+template<typename PathsProvider>
+static Clipper2Lib::Paths64 to_paths64(PathsProvider &&paths)
+{
+    Clipper2Lib::Paths64 out;
+    out.reserve(paths.size());
+    for (const auto &path : paths) {
+        Clipper2Lib::Path64 &path64 = out.emplace_back();
+        path64.reserve(path.size());
+        for (const auto &pt : path)
+            path64.emplace_back(pt.x(), pt.y());
+    }
+    return out;
+}
+
+static Points from_path64(const Clipper2Lib::Path64 &path64)
+{
+    Points points;
+    points.reserve(path64.size());
+    for (const Clipper2Lib::Point64 &pt : path64)
+        points.emplace_back(coord_t(pt.x), coord_t(pt.y));
+    return points;
+}
+
+template<typename TPath>
+static std::vector<TPath> from_paths64(const Clipper2Lib::Paths64 &paths)
+{
+    std::vector<TPath> out;
+    out.reserve(paths.size());
+    for (const Clipper2Lib::Path64 &path64 : paths)
+        out.emplace_back(from_path64(path64));
+    return out;
+}
+
+// Outer contours of the PolyTree64 are at the even levels, holes at the odd levels.
+static void polytree64_to_expolygons(const Clipper2Lib::PolyPath64 &parent, ExPolygons &out)
+{
+    for (const auto &outer : parent) {
+        size_t idx = out.size();
+        out.emplace_back();
+        out[idx].contour.points = from_path64(outer->Polygon());
+        out[idx].holes.reserve(outer->Count());
+        for (const auto &hole : *outer)
+            out[idx].holes.emplace_back(from_path64(hole->Polygon()));
+        for (const auto &hole : *outer)
+            polytree64_to_expolygons(*hole, out);
+    }
+}
+
+template<class TSubj, class TClip, class TSolution>
+static void clipper2_execute(ClipperLib::ClipType clip_type, TSubj &&subject, TClip &&clip, ClipperLib::PolyFillType fill_type, TSolution &solution)
+{
+    Clipper2Lib::Clipper64 clipper;
+    clipper.AddSubject(to_paths64(std::forward<TSubj>(subject)));
+    clipper.AddClip(to_paths64(std::forward<TClip>(clip)));
+    clipper.Execute(clipper2_clip_type(clip_type), clipper2_fill_rule(fill_type), solution);
+}
+
+template<class TSubj, class TClip>
+static ClipperLib::Paths clipper2_do(ClipperLib::ClipType clip_type, TSubj &&subject, TClip &&clip, ClipperLib::PolyFillType fill_type)
+{
+    Clipper2Lib::Paths64 solution;
+    clipper2_execute(clip_type, std::forward<TSubj>(subject), std::forward<TClip>(clip), fill_type, solution);
+    return from_paths64<ClipperLib::Path>(solution);
+}
+
+template<class TSubj, class TClip>
+static ExPolygons clipper2_do_ex(ClipperLib::ClipType clip_type, TSubj &&subject, TClip &&clip, ClipperLib::PolyFillType fill_type)
+{
+    Clipper2Lib::PolyTree64 solution;
+    clipper2_execute(clip_type, std::forward<TSubj>(subject), std::forward<TClip>(clip), fill_type, solution);
+    ExPolygons out;
+    polytree64_to_expolygons(solution, out);
+    return out;
+}
+
+// Offset of closed contours, CCW contours outside, CW contours (holes) inside, producing a union of the offsetted contours.
+template<typename TResult, typename PathsProvider>
+static TResult clipper2_offset(PathsProvider &&paths, float delta, ClipperLib::JoinType join_type, double miter_limit)
+{
+    Clipper2Lib::ClipperOffset co(join_type == ClipperLib::jtRound ? 2. : miter_limit, join_type == ClipperLib::jtRound ? miter_limit : 0.);
+    co.AddPaths(to_paths64(std::forward<PathsProvider>(paths)), clipper2_join_type(join_type), Clipper2Lib::EndType::Polygon);
+    if constexpr (std::is_same_v<TResult, ExPolygons>) {
+        Clipper2Lib::PolyTree64 solution;
+        co.Execute(delta, solution);
+        ExPolygons out;
+        polytree64_to_expolygons(solution, out);
+        return out;
+    } else {
+        Clipper2Lib::Paths64 solution;
+        co.Execute(delta, solution);
+        return from_paths64<Polygon>(solution);
+    }
+}
+
 // Clip source polygon to be used as a clipping polygon with a bouding box around the source (to be clipped) polygon.
 // Useful as an optimization for expensive ClipperLib operations, for example when clipping source polygons one by one
 // with a set of polygons covering the whole layer below.
@@ -313,7 +514,11 @@ TResult clipper_do(
     TClip &&                       clip,
     const ClipperLib::PolyFillType fillType)
 {
-    ClipperLib::Clipper clipper;
+    if constexpr (std::is_same_v<TResult, ClipperLib::Paths>)
+        if (ClipperUtils::clipper2_enabled(clipType))
+            return ClipperUtils::clipper2_do(clipType, std::forward<TSubj>(subject), std::forward<TClip>(clip), fillType);
+    ClipperUtils::ScratchClipper scratch;
+    ClipperLib::Clipper &clipper = *scratch;
     clipper.AddPaths(std::forward<TSubj>(subject), ClipperLib::ptSubject, true);
     clipper.AddPaths(std::forward<TClip>(clip),    ClipperLib::ptClip,    true);
     TResult retval;
@@ -342,7 +547,8 @@ TResult clipper_union(
     // fillType pftNonZero and pftPositive "should" produce the same result for "normalized with implicit union" set of polygons
     const ClipperLib::PolyFillType fillType = ClipperLib::pftNonZero)
 {
-    ClipperLib::Clipper clipper;
+    ClipperUtils::ScratchClipper scratch;
+    ClipperLib::Clipper &clipper = *scratch;
     clipper.AddPaths(std::forward<TSubj>(subject), ClipperLib::ptSubject, true);
     TResult retval;
     clipper.Execute(ClipperLib::ctUnion, retval, fillType, fillType);
@@ -385,7 +591,8 @@ static TResult shrink_paths(PathsProvider &&paths, float offset, ClipperLib::Joi
     //assert(offset > 0);
     TResult out;
     if (auto raw = raw_offset(std::forward<PathsProvider>(paths), - offset, joinType, miterLimit); ! raw.empty()) {
-        ClipperLib::Clipper clipper;
+        ClipperUtils::ScratchClipper scratch;
+        ClipperLib::Clipper &clipper = *scratch;
         clipper.AddPaths(raw, ClipperLib::ptSubject, true);
         ClipperLib::IntRect r = clipper.GetBounds();
         clipper.AddPath({ { r.left - 10, r.bottom + 10 }, { r.right + 10, r.bottom + 10 }, { r.right + 10, r.top - 10 }, { r.left - 10, r.top - 10 } }, ClipperLib::ptSubject, true);
@@ -411,9 +618,17 @@ Slic3r::Polygons offset(const Slic3r::Polygon &polygon, const float delta, Clipp
     { return to_polygons(raw_offset(ClipperUtils::SinglePathProvider(polygon.points), delta, joinType, miterLimit)); }
 
 Slic3r::Polygons offset(const Slic3r::Polygons &polygons, const float delta, ClipperLib::JoinType joinType, double miterLimit)
-    { return to_polygons(offset_paths<ClipperLib::Paths>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit)); }
+{
+    if (ClipperUtils::clipper2_enabled(ClipperUtils::c2Offset))
+        return ClipperUtils::clipper2_offset<Polygons>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit);
+    return to_polygons(offset_paths<ClipperLib::Paths>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit));
+}
 Slic3r::ExPolygons offset_ex(const Slic3r::Polygons &polygons, const float delta, ClipperLib::JoinType joinType, double miterLimit)
-    { return PolyTreeToExPolygons(offset_paths<ClipperLib::PolyTree>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit)); }
+{
+    if (ClipperUtils::clipper2_enabled(ClipperUtils::c2Offset))
+        return ClipperUtils::clipper2_offset<ExPolygons>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit);
+    return PolyTreeToExPolygons(offset_paths<ClipperLib::PolyTree>(ClipperUtils::PolygonsProvider(polygons), delta, joinType, miterLimit));
+}
 
 Slic3r::Polygons offset(const Slic3r::Polyline &polyline, const float delta, ClipperLib::JoinType joinType, double miterLimit, ClipperLib::EndType end_type)
     { assert(delta > 0); return to_polygons(clipper_union<ClipperLib::Paths>(raw_offset_polyline(ClipperUtils::SinglePathProvider(polyline.points), delta, joinType, miterLimit, end_type))); }
@@ -559,7 +774,11 @@ static ClipperLib::PolyTree expolygons_offset_pt(const ExPolygonVector &expolygo
 Slic3r::Polygons offset(const Slic3r::ExPolygon &expolygon, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return to_polygons(expolygon_offset(expolygon, delta, joinType, miterLimit)); }
 Slic3r::Polygons offset(const Slic3r::ExPolygons &expolygons, const float delta, ClipperLib::JoinType joinType, double miterLimit)
-    { return to_polygons(expolygons_offset(expolygons, delta, joinType, miterLimit)); }
+{
+    if (ClipperUtils::clipper2_enabled(ClipperUtils::c2Offset))
+        return ClipperUtils::clipper2_offset<Polygons>(ClipperUtils::ExPolygonsProvider(expolygons), delta, joinType, miterLimit);
+    return to_polygons(expolygons_offset(expolygons, delta, joinType, miterLimit));
+}
 Slic3r::Polygons offset(const Slic3r::Surfaces &surfaces, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return to_polygons(expolygons_offset(surfaces, delta, joinType, miterLimit)); }
 Slic3r::Polygons offset(const Slic3r::SurfacesPtr &surfaces, const float delta, ClipperLib::JoinType joinType, double miterLimit)
@@ -568,7 +787,11 @@ Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygon &expolygon, const float del
     //FIXME one may spare one Clipper Union call.
     { return ClipperPaths_to_Slic3rExPolygons(expolygon_offset(expolygon, delta, joinType, miterLimit)); }
 Slic3r::ExPolygons offset_ex(const Slic3r::ExPolygons &expolygons, const float delta, ClipperLib::JoinType joinType, double miterLimit)
-    { return PolyTreeToExPolygons(expolygons_offset_pt(expolygons, delta, joinType, miterLimit)); }
+{
+    if (ClipperUtils::clipper2_enabled(ClipperUtils::c2Offset))
+        return ClipperUtils::clipper2_offset<ExPolygons>(ClipperUtils::ExPolygonsProvider(expolygons), delta, joinType, miterLimit);
+    return PolyTreeToExPolygons(expolygons_offset_pt(expolygons, delta, joinType, miterLimit));
+}
 Slic3r::ExPolygons offset_ex(const Slic3r::Surfaces &surfaces, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return PolyTreeToExPolygons(expolygons_offset_pt(surfaces, delta, joinType, miterLimit)); }
 Slic3r::ExPolygons offset_ex(const Slic3r::SurfacesPtr &surfaces, const float delta, ClipperLib::JoinType joinType, double miterLimit)
@@ -666,6 +889,21 @@ inline ClipperLib::PolyTree clipper_do_polytree(
         clipper_do_polytree(clipType, std::forward<PathProvider1>(subject), std::forward<PathProvider2>(clip), fillType);
 }
 
+template<typename PathProvider1, typename PathProvider2>
+static ExPolygons clipper_do_ex(
+    const ClipperLib::ClipType       clipType,
+    PathProvider1                  &&subject,
+    PathProvider2                  &&clip,
+    const ClipperLib::PolyFillType   fillType,
+    const ApplySafetyOffset          do_safety_offset = ApplySafetyOffset::No)
+{
+    if (ClipperUtils::clipper2_enabled(clipType))
+        return do_safety_offset == ApplySafetyOffset::Yes ?
+            ClipperUtils::clipper2_do_ex(clipType, std::forward<PathProvider1>(subject), safety_offset(std::forward<PathProvider2>(clip)), fillType) :
+            ClipperUtils::clipper2_do_ex(clipType, std::forward<PathProvider1>(subject), std::forward<PathProvider2>(clip), fillType);
+    return PolyTreeToExPolygons(clipper_do_polytree(clipType, std::forward<PathProvider1>(subject), std::forward<PathProvider2>(clip), fillType, do_safety_offset));
+}
+
 template<class TSubj, class TClip>
 static inline Polygons _clipper(ClipperLib::ClipType clipType, TSubj &&subject, TClip &&clip, ApplySafetyOffset do_safety_offset)
 {
@@ -736,7 +974,7 @@ Slic3r::Polygons union_(const Slic3r::Polygons &subject, const Slic3r::ExPolygon
     { return _clipper(ClipperLib::ctUnion, ClipperUtils::PolygonsProvider(subject), ClipperUtils::ExPolygonProvider(subject2), ApplySafetyOffset::No); }
 template <typename TSubject, typename TClip>
 static ExPolygons _clipper_ex(ClipperLib::ClipType clipType, TSubject &&subject,  TClip &&clip, ApplySafetyOffset do_safety_offset, ClipperLib::PolyFillType fill_type = ClipperLib::pftNonZero)
-    { return PolyTreeToExPolygons(clipper_do_polytree(clipType, std::forward<TSubject>(subject), std::forward<TClip>(clip), fill_type, do_safety_offset)); }
+    { return clipper_do_ex(clipType, std::forward<TSubject>(subject), std::forward<TClip>(clip), fill_type, do_safety_offset); }
 
 Slic3r::ExPolygons diff_ex(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip, ApplySafetyOffset do_safety_offset)
     { return _clipper_ex(ClipperLib::ctDifference, ClipperUtils::PolygonsProvider(subject), ClipperUtils::PolygonsProvider(clip), do_safety_offset); }
@@ -813,14 +1051,13 @@ Slic3r::ExPolygons intersection_ex(const Slic3r::SurfacesPtr &subject, const Sli
 Slic3r::ExPolygons union_ex(const Slic3r::Polygons &subject, ClipperLib::PolyFillType fill_type)
     { return _clipper_ex(ClipperLib::ctUnion, ClipperUtils::PolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ApplySafetyOffset::No, fill_type); }
 Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons &subject)
-    { return PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero)); }
+    { return clipper_do_ex(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero); }
 Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons &subject, const Slic3r::Polygons &subject2)
 {
-    return PolyTreeToExPolygons(
-        clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::PolygonsProvider(subject2), ClipperLib::pftNonZero));
+    return clipper_do_ex(ClipperLib::ctUnion, ClipperUtils::ExPolygonsProvider(subject), ClipperUtils::PolygonsProvider(subject2), ClipperLib::pftNonZero);
 }
     Slic3r::ExPolygons union_ex(const Slic3r::Surfaces &subject)
-    { return PolyTreeToExPolygons(clipper_do_polytree(ClipperLib::ctUnion, ClipperUtils::SurfacesProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero)); }
+    { return clipper_do_ex(ClipperLib::ctUnion, ClipperUtils::SurfacesProvider(subject), ClipperUtils::EmptyPathsProvider(), ClipperLib::pftNonZero); }
 // BBS
 Slic3r::ExPolygons union_ex(const Slic3r::ExPolygons& poly1, const Slic3r::ExPolygons& poly2, bool safety_offset_)
     {
@@ -840,7 +1077,8 @@ Slic3r::ExPolygons xor_ex(const Slic3r::ExPolygons &subject, const Slic3r::ExPol
 template<typename PathsProvider1, typename PathsProvider2>
 Polylines _clipper_pl_open(ClipperLib::ClipType clipType, PathsProvider1 &&subject, PathsProvider2 &&clip)
 {
-    ClipperLib::Clipper clipper;
+    ClipperUtils::ScratchClipper scratch;
+    ClipperLib::Clipper &clipper = *scratch;
     clipper.AddPaths(std::forward<PathsProvider1>(subject), ClipperLib::ptSubject, false);
     clipper.AddPaths(std::forward<PathsProvider2>(clip), ClipperLib::ptClip, true);
     ClipperLib::PolyTree retval;
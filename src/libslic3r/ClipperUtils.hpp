@@ -331,6 +331,35 @@ namespace ClipperUtils {
     [[nodiscard]] Polygons clip_clipper_polygons_with_subject_bbox(const ExPolygon &src, const BoundingBox &bbox, const bool get_entire_polygons = false);
     [[nodiscard]] Polygons clip_clipper_polygons_with_subject_bbox(const ExPolygons &src, const BoundingBox &bbox, const bool get_entire_polygons = false);
 
+    // BBS: While a scope is alive, the boolean operations of this file executed by the calling thread share a single Clipper
+    // engine, which keeps the memory of its edges and output polygons between the calls instead of returning it to the heap.
+    // The memory is released in bulk when the outermost scope of the thread ends. Meant to wrap the body of a per layer task
+    // running many boolean operations on small inputs, where malloc / free of the Clipper temporaries contend between threads.
+    class ScratchScope
+    {
+    public:
+        ScratchScope();
+        ~ScratchScope();
+        ScratchScope(const ScratchScope&) = delete;
+        ScratchScope& operator=(const ScratchScope&) = delete;
+    };
+
+    // BBS: Operations of this file, which may be executed by the Clipper2 library instead of the legacy Clipper.
+    // Clipper2 produces the same regions, though not necessarily bit identical: the polygons may start at another vertex,
+    // collinear vertices may be dropped and the arcs and miters of the offsets are approximated differently.
+    // Therefore Clipper2 is disabled by default and it is enabled per operation once its results are verified.
+    enum Clipper2Operation : uint32_t {
+        c2Union         = 1 << 0,
+        c2Intersection  = 1 << 1,
+        c2Difference    = 1 << 2,
+        c2Xor           = 1 << 3,
+        // offset() / offset_ex() of Polygons and ExPolygons.
+        c2Offset        = 1 << 4,
+        c2All           = c2Union | c2Intersection | c2Difference | c2Xor | c2Offset,
+    };
+    // Bit mask of Clipper2Operation, process wide.
+    void                   set_clipper2_operations(uint32_t operations);
+    uint32_t               clipper2_operations();
     }
 
 // Perform union of input polygons using the non-zero rule, convert to ExPolygons.
@@ -30,6 +30,8 @@ using namespace Slic3r;
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/Cartesian_converter.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/task_group.h>
 
 // libslic3r
 #include "TriangleMesh.hpp" // its_merge
@@ -545,27 +547,36 @@ SurfaceCut Slic3r::cut_surface(const ExPolygons &shapes,
 
     // for filttrate opposite triangles and a little more
     const float max_angle = 89.9f;
-    priv::CutMeshes cgal_models; // source for patch
-    priv::CutMeshes cgal_neg_models; // model used for differenciate patches
-    cgal_models.reserve(models.size());
-    for (const indexed_triangle_set &its : models) {
-        std::vector<bool> skip_indicies(its.indices.size(), {false});
-        priv::set_skip_for_out_of_aoi(skip_indicies, its, projection, shapes_bb);
-
-        // create model for differenciate cutted patches
-        bool flip = true;
-        cgal_neg_models.push_back(priv::to_cgal(its, skip_indicies, flip));
-
-        // cut out more than only opposit triangles
-        priv::set_skip_by_angle(skip_indicies, its, projection, max_angle);
-        cgal_models.push_back(priv::to_cgal(its, skip_indicies));
-    }
+    priv::CutMeshes cgal_models(models.size()); // source for patch
+    priv::CutMeshes cgal_neg_models(models.size()); // model used for differenciate patches
+    // conversions to CGAL are independent, shape is converted while the models are
+    priv::CutMesh cgal_shape;
+    tbb::task_group task_group;
+    task_group.run([&cgal_shape, &shapes, &projection]() { cgal_shape = priv::to_cgal(shapes, projection); });
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, models.size(), 1),
+    [&models, &projection, &shapes_bb, max_angle, &cgal_models, &cgal_neg_models](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            const indexed_triangle_set &its = models[i];
+            std::vector<bool> skip_indicies(its.indices.size(), {false});
+            priv::set_skip_for_out_of_aoi(skip_indicies, its, projection, shapes_bb);
+
+            // cut out more than only opposit triangles
+            std::vector<bool> skip_by_angle = skip_indicies;
+            priv::set_skip_by_angle(skip_by_angle, its, projection, max_angle);
+
+            // create model for differenciate cutted patches
+            bool flip = true;
+            tbb::parallel_invoke(
+                [&]() { cgal_neg_models[i] = priv::to_cgal(its, skip_indicies, flip); },
+                [&]() { cgal_models[i] = priv::to_cgal(its, skip_by_angle); });
+        }
+    }); // END parallel for
+    task_group.wait();
 #ifdef DEBUG_OUTPUT_DIR
     priv::store(cgal_models, DEBUG_OUTPUT_DIR + "model/");// model[0-N].off
     priv::store(cgal_neg_models, DEBUG_OUTPUT_DIR + "model_neg/"); // model[0-N].off
 #endif // DEBUG_OUTPUT_DIR
 
-    priv::CutMesh cgal_shape = priv::to_cgal(shapes, projection);
 #ifdef DEBUG_OUTPUT_DIR
     CGAL::IO::write_OFF(DEBUG_OUTPUT_DIR + "shape.off", cgal_shape); // only debug
 #endif // DEBUG_OUTPUT_DIR
@@ -809,13 +820,10 @@ void priv::set_skip_for_out_of_aoi(std::vector<bool>          &skip_indicies,
     }); // END parallel for
 
     // inspect all triangles, when it is out of bounding box
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
-    [&its, &is_on_sides, &skip_indicies](const tbb::blocked_range<size_t> &range) {
-        for (size_t i = range.begin(); i < range.end(); ++i) {
-            if (is_all_on_one_side(its.indices[i], is_on_sides))
-                skip_indicies[i] = true;
-        }
-    }); // END parallel for
+    // NOTE: serial, std::vector<bool> packs the flags into shared words, it can't be written from multiple threads
+    for (size_t i = 0; i < its.indices.size(); ++i)
+        if (is_all_on_one_side(its.indices[i], is_on_sides))
+            skip_indicies[i] = true;
 }
 
 indexed_triangle_set Slic3r::its_mask(const indexed_triangle_set &its,
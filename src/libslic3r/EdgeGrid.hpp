@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <math.h>
 
+#include <array>
+
 #include "Point.hpp"
 #include "BoundingBox.hpp"
 #include "ExPolygon.hpp"
@@ -309,12 +311,27 @@ public:
 		assert(ixb >= 0 && size_t(ixb) < m_cols);
 		assert(iyb >= 0 && size_t(iyb) < m_rows);
 
-		std::vector<std::tuple<float, float, Slic3r::Point>> start_pos;
-        std::vector<std::tuple<float, float, Slic3r::Point>> end_pos;
-        start_pos.push_back(std::make_tuple(ix, iy, p1));
-        end_pos.push_back(std::make_tuple(ixb, iyb, p2));
+		if (! need_consider_eps) {
+			// Common case, no need to collect the alternative end points.
+			visit_intersect_line_impl(ix, iy, p1, ixb, iyb, p2, visitor);
+			return;
+		}
 
-		if (need_consider_eps) {
+		// The end points and up to four of their eps-shifted alternatives falling into neighbor cells.
+		// Fixed size storage, this function is called for every segment rasterized or intersected.
+		struct CellPoint {
+			coord_t       ix;
+			coord_t       iy;
+			Slic3r::Point pt;
+		};
+		std::array<CellPoint, 5> start_pos;
+		std::array<CellPoint, 5> end_pos;
+		size_t                   num_start_pos = 0;
+		size_t                   num_end_pos   = 0;
+		start_pos[num_start_pos ++] = { ix, iy, p1 };
+		end_pos[num_end_pos ++]     = { ixb, iyb, p2 };
+
+		{
             auto calculate_upper = [&](coord_t value, double eps) {
 				return coord_t((value + eps) / m_resolution);
 			};
@@ -324,43 +341,44 @@ public:
             const double eps = scale_(10 * EPSILON);
             if (coord_t ix_u = calculate_upper(p1(0), eps);
 				ix_u != ix) {
-                start_pos.push_back(std::make_tuple(ix_u, iy, Slic3r::Point(coord_t(p1(0) + eps), p1(1))));
+                start_pos[num_start_pos ++] = { ix_u, iy, Slic3r::Point(coord_t(p1(0) + eps), p1(1)) };
             }
             if (coord_t ix_l = calculate_lower(p1(0), eps);
 				ix_l != ix) {
-                start_pos.push_back(std::make_tuple(ix_l, iy, Slic3r::Point(coord_t(p1(0) - eps), p1(1))));
+                start_pos[num_start_pos ++] = { ix_l, iy, Slic3r::Point(coord_t(p1(0) - eps), p1(1)) };
             }
             if (coord_t iy_u = calculate_upper(p1(1), eps);
 				iy_u != iy) {
-                start_pos.push_back(std::make_tuple(ix, iy_u, Slic3r::Point(p1(0), coord_t(p1(1) + eps))));
+                start_pos[num_start_pos ++] = { ix, iy_u, Slic3r::Point(p1(0), coord_t(p1(1) + eps)) };
             }
             if (coord_t iy_l = calculate_lower(p1(1), eps);
 				iy_l != iy) {
-                start_pos.push_back(std::make_tuple(ix, iy_l, Slic3r::Point(p1(0), coord_t(p1(1) - eps))));
+                start_pos[num_start_pos ++] = { ix, iy_l, Slic3r::Point(p1(0), coord_t(p1(1) - eps)) };
             }
 
             if (coord_t ixb_u = calculate_upper(p2(0), eps);
 				ixb_u != ixb) {
-                end_pos.push_back(std::make_tuple(ixb_u, iyb, Slic3r::Point(coord_t(p2(0) + eps), p2(1))));
+                end_pos[num_end_pos ++] = { ixb_u, iyb, Slic3r::Point(coord_t(p2(0) + eps), p2(1)) };
             }
             if (coord_t ixb_l = calculate_lower(p2(0), eps);
 				ixb_l != ixb) {
-                end_pos.push_back(std::make_tuple(ixb_l, iyb, Slic3r::Point(coord_t(p2(0) - eps), p2(1))));
+                end_pos[num_end_pos ++] = { ixb_l, iyb, Slic3r::Point(coord_t(p2(0) - eps), p2(1)) };
             }
             if (coord_t iyb_u = calculate_upper(p2(1), eps);
 				iyb_u != iyb) {
-                end_pos.push_back(std::make_tuple(ixb, iyb_u, Slic3r::Point(p2(0), coord_t(p2(1) + eps))));
+                end_pos[num_end_pos ++] = { ixb, iyb_u, Slic3r::Point(p2(0), coord_t(p2(1) + eps)) };
             }
             if (coord_t iyb_l = calculate_lower(p2(1), eps);
 				iyb_l != iyb) {
-                end_pos.push_back(std::make_tuple(ixb, iyb_l, Slic3r::Point(p2(0), coord_t(p2(1) - eps))));
+                end_pos[num_end_pos ++] = { ixb, iyb_l, Slic3r::Point(p2(0), coord_t(p2(1) - eps)) };
             }
 		}
 
-		for (size_t start_idx = 0; start_idx < start_pos.size(); ++start_idx) {
-            for (size_t end_idx = 0; end_idx < end_pos.size(); ++end_idx) {
-                visit_intersect_line_impl(std::get<0>(start_pos[start_idx]), std::get<1>(start_pos[start_idx]), std::get<2>(start_pos[start_idx]),
-                                          std::get<0>(end_pos[end_idx]), std::get<1>(end_pos[end_idx]), std::get<2>(end_pos[end_idx]), visitor);
+		for (size_t start_idx = 0; start_idx < num_start_pos; ++start_idx) {
+            for (size_t end_idx = 0; end_idx < num_end_pos; ++end_idx) {
+                const CellPoint &start = start_pos[start_idx];
+                const CellPoint &end   = end_pos[end_idx];
+                visit_intersect_line_impl(start.ix, start.iy, start.pt, end.ix, end.iy, end.pt, visitor);
 			}
 		}
 	}
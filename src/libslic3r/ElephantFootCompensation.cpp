@@ -13,6 +13,8 @@
 #include <cmath>
 #include <cassert>
 
+#include <tbb/parallel_for.h>
+
 // #define CONTOUR_DISTANCE_DEBUG_SVG
 
 namespace Slic3r {
@@ -626,21 +628,19 @@ ExPolygon  elephant_foot_compensation(const ExPolygon  &input, const Flow &exter
 
 ExPolygons elephant_foot_compensation(const ExPolygons &input, const Flow &external_perimeter_flow, const double compensation)
 {
-	ExPolygons out;
-    ExPolygons simplified_exps = expolygons_simplify(input, SCALED_EPSILON);
-    out.reserve(simplified_exps.size());
-    for (const ExPolygon &expoly : simplified_exps)
-		out.emplace_back(elephant_foot_compensation(expoly, external_perimeter_flow, compensation));
-	return out;
+    // The contour shall be wide enough to apply the external perimeter plus compensation on both sides.
+    double min_contour_width = double(external_perimeter_flow.width() + external_perimeter_flow.spacing());
+    return elephant_foot_compensation(input, min_contour_width, compensation);
 }
 
 ExPolygons elephant_foot_compensation(const ExPolygons &input, double min_contour_width, const double compensation)
 {
-	ExPolygons out;
-    ExPolygons simplified_exps = expolygons_simplify(input, SCALED_EPSILON);
-    out.reserve(simplified_exps.size());
-    for (const ExPolygon &expoly : simplified_exps)
-		out.emplace_back(elephant_foot_compensation(expoly, min_contour_width, compensation));
+    ExPolygons out = expolygons_simplify(input, SCALED_EPSILON);
+    // Each island is compensated against its own edge grid, thus the islands are processed in parallel.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, out.size()), [&out, min_contour_width, compensation](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i)
+            out[i] = elephant_foot_compensation(out[i], min_contour_width, compensation);
+    });
 	return out;
 }
 
@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <boost/nowide/convert.hpp>
 #include <boost/log/trivial.hpp>
+#include <tbb/parallel_for.h>
 #include <ClipperUtils.hpp> // union_ex + for boldness(polygon extend(offset))
 #include "IntersectionPoints.hpp"
 
@@ -1244,13 +1245,18 @@ const int CANCEL_CHECK = 10;
 namespace {
 HealedExPolygons union_with_delta(const ExPolygonsWithIds &shapes, float delta, unsigned max_heal_iteration)
 {
+    // offset letters independently, long texts keep all cores busy
+    std::vector<ExPolygons> offseted(shapes.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, shapes.size()), [&shapes, &offseted, delta](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            if (!shapes[i].expoly.empty())
+                offseted[i] = offset_ex(shapes[i].expoly, delta);
+    });
+
     // unify to one expolygons
     ExPolygons expolygons;
-    for (const ExPolygonsWithId &shape : shapes) {
-        if (shape.expoly.empty())
-            continue;
-        expolygons_append(expolygons, offset_ex(shape.expoly, delta));
-    }
+    for (ExPolygons &shape : offseted)
+        expolygons_append(expolygons, std::move(shape));
     ExPolygons result = union_ex(expolygons);
     result            = offset_ex(result, -delta);
     bool is_healed    = heal_expolygons(result, max_heal_iteration);
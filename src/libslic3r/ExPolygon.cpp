@@ -116,6 +116,18 @@ bool ExPolygon::contains(const Point &point, bool border_result /* = true */) co
     return true;
 }
 
+std::vector<bool> ExPolygon::contains_points(const Points &points, bool border_result) const
+{
+    std::vector<bool> out = Slic3r::contains_points(contour, points, border_result);
+    for (const Polygon &hole : this->holes) {
+        std::vector<bool> in_hole = Slic3r::contains_points(hole, points, ! border_result);
+        for (size_t i = 0; i < out.size(); ++ i)
+            if (in_hole[i])
+                out[i] = false;
+    }
+    return out;
+}
+
 bool ExPolygon::on_boundary(const Point &point, double eps) const
 {
     if (this->contour.on_boundary(point, eps))
@@ -365,7 +377,7 @@ void ExPolygon::medial_axis(double min_width, double max_width, ThickPolylines*
         }
     }
 
-    polylines->insert(polylines->end(), pp.begin(), pp.end());
+    polylines->insert(polylines->end(), std::make_move_iterator(pp.begin()), std::make_move_iterator(pp.end()));
 }
 
 void ExPolygon::medial_axis(double min_width, double max_width, Polylines* polylines) const
@@ -52,6 +52,8 @@ public:
     bool contains(const Polyline &polyline) const;
     bool contains(const Polylines &polylines) const;
     bool contains(const Point &point, bool border_result = true) const;
+    // Batch version of contains(const Point&), see contains_points(const Polygon&, ...).
+    std::vector<bool> contains_points(const Points &points, bool border_result = true) const;
     // Approximate on boundary test.
     bool on_boundary(const Point &point, double eps) const;
     // Projection of a point onto the polygon.
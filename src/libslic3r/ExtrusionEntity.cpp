@@ -31,6 +31,17 @@ void ExtrusionPath::clip_end(double distance)
     this->polyline.clip_end(distance);
 }
 
+void ExtrusionPath::translate(const Point &vector)
+{
+    this->polyline.translate(vector);
+    for (PathFittingData &fitting : this->polyline.fitting_result)
+        if (fitting.is_arc_move()) {
+            fitting.arc_data.center      += vector;
+            fitting.arc_data.start_point += vector;
+            fitting.arc_data.end_point   += vector;
+        }
+}
+
 void ExtrusionPath::simplify(double tolerance)
 {
     this->polyline.simplify(tolerance);
@@ -87,6 +98,12 @@ void ExtrusionMultiPath::reverse()
     std::reverse(this->paths.begin(), this->paths.end());
 }
 
+void ExtrusionMultiPath::translate(const Point &vector)
+{
+    for (ExtrusionPath &path : this->paths)
+        path.translate(vector);
+}
+
 double ExtrusionMultiPath::length() const
 {
     double len = 0;
@@ -157,6 +174,12 @@ void ExtrusionLoop::reverse()
     std::reverse(this->paths.begin(), this->paths.end());
 }
 
+void ExtrusionLoop::translate(const Point &vector)
+{
+    for (ExtrusionPath &path : this->paths)
+        path.translate(vector);
+}
+
 Polygon ExtrusionLoop::polygon() const
 {
     Polygon polygon;
@@ -611,6 +634,15 @@ std::vector<const ExtrusionPath *> ExtrusionLoopSloped::get_all_paths() const
     return r;
 }
 
+void ExtrusionLoopSloped::translate(const Point &vector)
+{
+    ExtrusionLoop::translate(vector);
+    for (ExtrusionPathSloped &path : starts)
+        path.translate(vector);
+    for (ExtrusionPathSloped &path : ends)
+        path.translate(vector);
+}
+
 std::string ExtrusionEntity::role_to_string(ExtrusionRole role)
 {
     switch (role) {
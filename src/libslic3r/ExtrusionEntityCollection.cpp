@@ -74,6 +74,12 @@ void ExtrusionEntityCollection::reverse()
     std::reverse(this->entities.begin(), this->entities.end());
 }
 
+void ExtrusionEntityCollection::translate(const Point &vector)
+{
+    for (ExtrusionEntity *ptr : this->entities)
+        ptr->translate(vector);
+}
+
 void ExtrusionEntityCollection::replace(size_t i, const ExtrusionEntity &entity)
 {
     delete this->entities[i];
@@ -98,6 +104,29 @@ ExtrusionEntityCollection ExtrusionEntityCollection::chained_path_from(const Ext
     return out;
 }
 
+std::vector<std::pair<const ExtrusionEntity*, bool>> ExtrusionEntityCollection::chained_order_from(const Point &start_near, ExtrusionRole role) const
+{
+    std::vector<std::pair<const ExtrusionEntity*, bool>> out;
+    if (this->no_sort) {
+        out.reserve(this->entities.size());
+        for (const ExtrusionEntity *ee : this->entities)
+            out.emplace_back(ee, false);
+        return out;
+    }
+    ExtrusionEntitiesPtr filtered = filter_by_extrusion_role(this->entities, role);
+    // Chaining crashes on empty collections.
+    filtered.erase(std::remove_if(filtered.begin(), filtered.end(),
+        [](const ExtrusionEntity *ee) { return ee->is_collection() && static_cast<const ExtrusionEntityCollection*>(ee)->empty(); }),
+        filtered.end());
+    if (filtered.empty())
+        return out;
+    std::vector<std::pair<size_t, bool>> chain = chain_extrusion_entities(filtered, &start_near);
+    out.reserve(chain.size());
+    for (const std::pair<size_t, bool> &idx : chain)
+        out.emplace_back(filtered[idx.first], idx.second);
+    return out;
+}
+
 void ExtrusionEntityCollection::polygons_covered_by_width(Polygons &out, const float scaled_epsilon) const
 {
     for (const ExtrusionEntity *entity : this->entities)
@@ -101,7 +101,11 @@ public:
     static ExtrusionEntityCollection chained_path_from(const ExtrusionEntitiesPtr &extrusion_entities, const Point &start_near, ExtrusionRole role = erMixed);
     ExtrusionEntityCollection chained_path_from(const Point &start_near, ExtrusionRole role = erMixed) const 
     	{ return this->no_sort ? *this : chained_path_from(this->entities, start_near, role); }
+    // Same ordering as chained_path_from(), but the entities are not cloned: returns the entities of this collection in the chained order
+    // together with a flag whether the entity shall be extruded reversed. The entities stay owned by this collection.
+    std::vector<std::pair<const ExtrusionEntity*, bool>> chained_order_from(const Point &start_near, ExtrusionRole role = erMixed) const;
     void reverse() override;
+    void translate(const Point &vector) override;
     const Point& first_point() const override { return this->entities.front()->first_point(); }
     const Point& last_point() const override { return this->entities.back()->last_point(); }
     // Produce a list of 2D polygons covered by the extruded paths, offsetted by the extrusion width.
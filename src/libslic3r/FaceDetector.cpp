@@ -2,7 +2,9 @@
 #include "TriangleMesh.hpp"
 #include "SLA/IndexedMesh.hpp"
 #include "Model.hpp"
-#include <unordered_set>
+
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
 
 namespace Slic3r {
 static const double BBOX_OFFSET = 2.0;
@@ -31,59 +33,52 @@ void FaceDetector::detect_exterior_face()
     BoundingBoxf3 bbox = object_mesh.bounding_box();
     bbox.offset(BBOX_OFFSET);
 
-    std::unordered_set<size_t> hit_face_indices;
+    // The rays are cast in parallel, each row of rays collects its hits into the thread local storage.
+    tbb::enumerable_thread_specific<std::vector<size_t>> hit_faces_tls;
+    // Casts rays along the axis from both sides of the bounding box, for all sample points of the plane spanned by the two other axes.
+    auto cast_rays = [this, &bbox, &indexed_mesh, &hit_faces_tls](int axis) {
+        const int    axis1 = (axis + 1) % 3;
+        const int    axis2 = (axis + 2) % 3;
+        const size_t num_rows = size_t(std::max(0., std::ceil((bbox.max(axis1) - bbox.min(axis1)) / m_sample_interval)));
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_rows), [&](const tbb::blocked_range<size_t> &range) {
+            std::vector<size_t> &hit_faces = hit_faces_tls.local();
+            Vec3d dir = Vec3d::Zero();
+            for (size_t row = range.begin(); row < range.end(); ++ row) {
+                Vec3d pt;
+                pt(axis1) = bbox.min(axis1) + double(row) * m_sample_interval;
+                for (pt(axis2) = bbox.min(axis2); pt(axis2) < bbox.max(axis2); pt(axis2) += m_sample_interval) {
+                    pt(axis)  = bbox.min(axis);
+                    dir(axis) = 1.;
+                    if (auto hit_result = indexed_mesh.query_ray_hit(pt, dir); hit_result.is_hit())
+                        hit_faces.emplace_back(hit_result.face());
 
+                    pt(axis)  = bbox.max(axis);
+                    dir(axis) = -1.;
+                    if (auto hit_result = indexed_mesh.query_ray_hit(pt, dir); hit_result.is_hit())
+                        hit_faces.emplace_back(hit_result.face());
+                }
+            }
+        });
+    };
     // x-axis rays
-    for (double y = bbox.min.y(); y < bbox.max.y(); y += m_sample_interval) {
-        for (double z = bbox.min.z(); z < bbox.max.z(); z += m_sample_interval) {
-            auto hit_result = indexed_mesh.query_ray_hit({ bbox.min.x(), y, z }, { 1.0, 0.0, 0.0 });
-            if (hit_result.is_hit())
-                hit_face_indices.insert(hit_result.face());
-
-            hit_result = indexed_mesh.query_ray_hit({ bbox.max.x(), y, z }, { -1.0, 0.0, 0.0 });
-            if (hit_result.is_hit())
-                hit_face_indices.insert(hit_result.face());
-        }
-    }
-
+    cast_rays(0);
     // y-axis rays
-    for (double x = bbox.min.x(); x < bbox.max.x(); x += m_sample_interval) {
-        for (double z = bbox.min.z(); z < bbox.max.z(); z += m_sample_interval) {
-            auto hit_result = indexed_mesh.query_ray_hit({ x, bbox.min.y(), z }, { 0.0, 1.0, 0.0 });
-            if (hit_result.is_hit())
-                hit_face_indices.insert(hit_result.face());
-
-            hit_result = indexed_mesh.query_ray_hit({ x, bbox.max.y(), z }, { 0.0, -1.0, 0.0 });
-            if (hit_result.is_hit())
-                hit_face_indices.insert(hit_result.face());
-        }
-    }
-
+    cast_rays(1);
     // z-axis rays
-    for (double x = bbox.min.x(); x < bbox.max.x(); x += m_sample_interval) {
-        for (double y = bbox.min.y(); y < bbox.max.y(); y += m_sample_interval) {
-            auto hit_result = indexed_mesh.query_ray_hit({ x, y, bbox.min.z() }, { 0.0, 0.0, 1.0 });
-            if (hit_result.is_hit())
-                hit_face_indices.insert(hit_result.face());
+    cast_rays(2);
 
-            hit_result = indexed_mesh.query_ray_hit({ x, y, bbox.max.z() }, { 0.0, 0.0, -1.0 });
-            if (hit_result.is_hit())
-                hit_face_indices.insert(hit_result.face());
-        }
-    }
+    std::vector<size_t> hit_face_indices;
+    for (const std::vector<size_t> &hit_faces : hit_faces_tls)
+        append(hit_face_indices, hit_faces);
+    sort_remove_duplicates(hit_face_indices);
 
+    // The hit faces are sorted, thus the facet ranges of the volumes are walked just once.
+    auto range = volume_facet_ranges.begin();
     for (size_t facet_idx : hit_face_indices) {
-        TriangleMesh* tm = nullptr;
-        uint32_t vol_facet_idx = 0;
-        for (auto range : volume_facet_ranges) {
-            if (facet_idx >= range.facet_begin && facet_idx < range.facet_end) {
-                tm = range.tm;
-                vol_facet_idx = facet_idx - range.facet_begin;
-                break;
-            }
-        }
-
-        tm->its.get_property(vol_facet_idx).type = EnumFaceTypes::eExteriorAppearance;
+        while (facet_idx >= range->facet_end)
+            ++ range;
+        assert(facet_idx >= range->facet_begin);
+        range->tm->its.get_property(uint32_t(facet_idx - range->facet_begin)).type = EnumFaceTypes::eExteriorAppearance;
     }
 }
 
@@ -5,6 +5,11 @@
 #include <random>
 #include <cassert>
 #include <sstream>
+#include <array>
+#include <atomic>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 
 namespace Slic3r
 {
@@ -355,7 +360,7 @@ namespace Slic3r
         return labels;
     }
 
-    std::vector<int> KMediods2::assign_cluster_label(const std::vector<int>& center, const std::map<int, int>& unplaceable_limtis, const std::vector<int>& group_size, const FGStrategy& strategy)
+    std::vector<int> KMediods2::assign_cluster_label(const std::vector<int>& center, const std::map<int, int>& unplaceable_limtis, const std::vector<int>& group_size, const FGStrategy& strategy, int* cost)
     {
         struct Comp {
             bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) {
@@ -363,21 +368,30 @@ namespace Slic3r
             }
         };
 
-        std::vector<std::set<int>>groups(2);
+        // the labels are filled directly, only the group sizes are tracked
+        std::vector<int>labels(m_elem_count);
+        std::vector<size_t>group_count(2, 0);
+        auto insert_to_group = [&labels, &group_count](int gid, int elem) {
+            labels[elem] = gid;
+            ++group_count[gid];
+        };
+        // distances of the elements to the centers, to get the cost of the grouping without querying the evaluator again
+        std::vector<std::array<int, 2>> distances(m_elem_count, { 0, 0 });
         std::vector<int>new_max_group_size = group_size;
         // store filament idx and distance gap between center 0 and center 1
         std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, Comp>min_heap;
 
         for (int i = 0; i < m_elem_count; ++i) {
+            int distance_to_0 = m_evaluator->get_distance(i, center[0]);
+            int distance_to_1 = m_evaluator->get_distance(i, center[1]);
+            distances[i] = { distance_to_0, distance_to_1 };
             if (auto it = unplaceable_limtis.find(i); it != unplaceable_limtis.end()) {
                 int gid = it->second;
                 assert(gid == 0 || gid == 1);
-                groups[1 - gid].insert(i);   // insert to group
+                insert_to_group(1 - gid, i);   // insert to group
                 new_max_group_size[1 - gid] = std::max(new_max_group_size[1 - gid] - 1, 0); // decrease group_size
                 continue;
             }
-            int distance_to_0 = m_evaluator->get_distance(i, center[0]);
-            int distance_to_1 = m_evaluator->get_distance(i, center[1]);
             min_heap.push({ i,distance_to_0 - distance_to_1 });
         }
 
@@ -387,15 +401,15 @@ namespace Slic3r
             while (!min_heap.empty()) {
                 auto top = min_heap.top();
                 min_heap.pop();
-                if (groups[0].size() < new_max_group_size[0] && (top.second <= 0 || groups[1].size() >= new_max_group_size[1]))
-                    groups[0].insert(top.first);
-                else if (groups[1].size() < new_max_group_size[1] && (top.second > 0 || groups[0].size() >= new_max_group_size[0]))
-                    groups[1].insert(top.first);
+                if (group_count[0] < new_max_group_size[0] && (top.second <= 0 || group_count[1] >= new_max_group_size[1]))
+                    insert_to_group(0, top.first);
+                else if (group_count[1] < new_max_group_size[1] && (top.second > 0 || group_count[0] >= new_max_group_size[0]))
+                    insert_to_group(1, top.first);
                 else {
                     if (top.second <= 0)
-                        groups[0].insert(top.first);
+                        insert_to_group(0, top.first);
                     else
-                        groups[1].insert(top.first);
+                        insert_to_group(1, top.first);
                 }
             }
         }
@@ -404,17 +418,18 @@ namespace Slic3r
                 auto top = min_heap.top();
                 min_heap.pop();
                 if (top.second <= 0)
-                    groups[0].insert(top.first);
+                    insert_to_group(0, top.first);
                 else
-                    groups[1].insert(top.first);
+                    insert_to_group(1, top.first);
             }
         }
 
-        std::vector<int>labels(m_elem_count);
-        for (auto& f : groups[0])
-            labels[f] = 0;
-        for (auto& f : groups[1])
-            labels[f] = 1;
+        if (cost) {
+            // the same as calc_cost(labels, center)
+            *cost = 0;
+            for (int i = 0; i < m_elem_count; ++i)
+                *cost += distances[i][labels[i]];
+        }
 
         return labels;
     }
@@ -446,37 +461,52 @@ namespace Slic3r
             return;
         }
 
-        std::vector<int>best_labels;
-        int best_cost = std::numeric_limits<int>::max();
-
-        for (int center_0 = 0; center_0 < m_elem_count; ++center_0) {
-            if (auto iter = m_unplaceable_limits.find(center_0); iter != m_unplaceable_limits.end() && iter->second == 0)
-                continue;
-            for (int center_1 = 0; center_1 < m_elem_count; ++center_1) {
-                if (center_0 == center_1)
-                    continue;
-                if (auto iter = m_unplaceable_limits.find(center_1); iter != m_unplaceable_limits.end() && iter->second == 1)
+        // Each pair of centers is evaluated independently, the rows of the center_0 are processed in parallel.
+        // The results are merged in the order of the sequential enumeration, so that the best grouping and the
+        // memoryed groups do not depend on the thread scheduling.
+        struct CenterPairResult
+        {
+            std::vector<int> labels;
+            int              cost;
+        };
+        std::vector<std::vector<CenterPairResult>> results(m_elem_count);
+        std::atomic<bool> timeout{ false };
+        tbb::parallel_for(tbb::blocked_range<int>(0, m_elem_count, 1), [&](const tbb::blocked_range<int>& range) {
+            for (int center_0 = range.begin(); center_0 < range.end(); ++center_0) {
+                if (auto iter = m_unplaceable_limits.find(center_0); iter != m_unplaceable_limits.end() && iter->second == 0)
                     continue;
+                for (int center_1 = 0; center_1 < m_elem_count; ++center_1) {
+                    if (timeout.load(std::memory_order_relaxed))
+                        return;
+                    if (center_0 == center_1)
+                        continue;
+                    if (auto iter = m_unplaceable_limits.find(center_1); iter != m_unplaceable_limits.end() && iter->second == 1)
+                        continue;
 
-                std::vector<int>new_centers = { center_0,center_1 };
-                std::vector<int>new_labels = assign_cluster_label(new_centers, m_unplaceable_limits, m_max_cluster_size, g_strategy);
+                    std::vector<int>new_centers = { center_0,center_1 };
+                    int new_cost = 0;
+                    std::vector<int>new_labels = assign_cluster_label(new_centers, m_unplaceable_limits, m_max_cluster_size, g_strategy, &new_cost);
+                    results[center_0].push_back({ std::move(new_labels), new_cost });
 
-                int new_cost = calc_cost(new_labels, new_centers);
-                if (new_cost < best_cost) {
-                    best_cost = new_cost;
-                    best_labels = new_labels;
+                    if (T.time_machine_end() > timeout_ms)
+                        timeout.store(true, std::memory_order_relaxed);
                 }
+            }
+        });
 
+        std::vector<int>best_labels;
+        int best_cost = std::numeric_limits<int>::max();
+        for (std::vector<CenterPairResult>& row : results) {
+            for (CenterPairResult& result : row) {
                 {
-                    MemoryedGroup g(new_labels,new_cost,1);
+                    MemoryedGroup g(result.labels, result.cost, 1);
                     update_memoryed_groups(g, memory_threshold, memoryed_groups);
                 }
-
-                if (T.time_machine_end() > timeout_ms)
-                    break;
+                if (result.cost < best_cost) {
+                    best_cost = result.cost;
+                    best_labels = std::move(result.labels);
+                }
             }
-            if (T.time_machine_end() > timeout_ms)
-                break;
         }
         this->m_cluster_labels = best_labels;
     }
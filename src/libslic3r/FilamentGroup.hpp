@@ -182,7 +182,8 @@ namespace Slic3r
 
     private:
         std::vector<int>cluster_small_data(const std::map<int, int>& unplaceable_limits, const std::vector<int>& group_size);
-        std::vector<int>assign_cluster_label(const std::vector<int>& center, const std::map<int, int>& unplaceable_limits, const std::vector<int>& group_size, const FGStrategy& strategy);
+        // cost, if set, receives the cost of the returned labels
+        std::vector<int>assign_cluster_label(const std::vector<int>& center, const std::map<int, int>& unplaceable_limits, const std::vector<int>& group_size, const FGStrategy& strategy, int* cost = nullptr);
         int calc_cost(const std::vector<int>& labels, const std::vector<int>& medoids);
     protected:
         FilamentGroupUtils::MemoryedGroupHeap memoryed_groups;
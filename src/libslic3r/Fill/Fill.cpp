@@ -848,6 +848,8 @@ void Layer::make_ironing()
 				by_extruder.emplace_back(ironing_params);
 			}
 		}
+	if (by_extruder.empty())
+		return;
 	std::sort(by_extruder.begin(), by_extruder.end());
 
     FillParams 			fill_params;
@@ -921,6 +923,12 @@ void Layer::make_ironing()
 				}
 			}
 
+			if (polys.empty() && infills.empty()) {
+				// Most layers of a TopSurfaces / TopmostOnly object have nothing to iron,
+				// don't offset the whole layer outline just to intersect it with nothing.
+				i = j;
+				continue;
+			}
 			if (! infills.empty() || j > i + 1) {
 				// Ironing over more than a single region or over solid internal infill.
 				if (! infills.empty())
@@ -932,7 +940,15 @@ void Layer::make_ironing()
 			// Trim the top surfaces with half the nozzle diameter.
 			//BBS: ironing inset
             double ironing_areas_offset = ironing_params.inset == 0 ? float(scale_(0.5 * nozzle_dmr)) : scale_(ironing_params.inset);
-			ironing_areas = intersection_ex(polys, offset(this->lslices, - ironing_areas_offset));
+			// Only the islands overlapping the surfaces to iron need to be shrunk. The islands don't overlap,
+			// thus shrinking them one by one gives the same result as shrinking all of them at once.
+			const BoundingBox polys_bbox  = get_extents(polys);
+			const bool        has_bboxes  = this->lslices_bboxes.size() == this->lslices.size();
+			Polygons          trimmed_islands;
+			for (size_t k = 0; k < this->lslices.size(); ++ k)
+				if (! has_bboxes || this->lslices_bboxes[k].overlap(polys_bbox))
+					polygons_append(trimmed_islands, offset(this->lslices[k], - float(ironing_areas_offset)));
+			ironing_areas = intersection_ex(polys, trimmed_islands);
 		}
 
         // Create the filler object.
@@ -19,6 +19,7 @@
 // Boost pool: Don't use mutexes to synchronize memory allocation.
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
+#include <tbb/parallel_for.h>
 
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/point.hpp>
@@ -259,6 +260,8 @@ struct Octree
     // Octree will allocate its Cubes from the pool. The pool only supports deletion of the complete pool,
     // perfect for building up our octree.
     boost::object_pool<Cube>    pool;
+    // The subtrees of the eight children of the root cube are built in parallel, each allocating its cubes from its own pool.
+    std::array<boost::object_pool<Cube>, 8> subtree_pools;
     Cube*                       root_cube { nullptr };
     Vec3d                       origin;
     std::vector<CubeProperties> cubes_properties;
@@ -266,7 +269,9 @@ struct Octree
     Octree(const Vec3d &origin, const std::vector<CubeProperties> &cubes_properties)
         : root_cube(pool.construct(origin)), origin(origin), cubes_properties(cubes_properties) {}
 
-    void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth);
+    void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, boost::object_pool<Cube> &pool);
+    // Insert a triangle into the i-th child of current_cube at the given depth of current_cube.
+    void insert_triangle_into_child(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, size_t i, boost::object_pool<Cube> &pool);
 };
 
 void OctreeDeleter::operator()(Octree *p) {
@@ -1484,23 +1489,27 @@ OctreePtr build_octree(
         double edge_length_half = 0.5 * cubes_properties.back().edge_length;
         Vec3d  diag_half(edge_length_half, edge_length_half, edge_length_half);
         int    max_depth = int(cubes_properties.size()) - 1;
-        auto process_triangle = [octree_ptr, max_depth, diag_half](const Vec3d &a, const Vec3d &b, const Vec3d &c) {
-            octree_ptr->insert_triangle(
-                a, b, c,
-                octree_ptr->root_cube,
-                BoundingBoxf3(octree_ptr->root_cube->center - diag_half, octree_ptr->root_cube->center + diag_half),
-                max_depth);
-        };
         auto up_vector = support_overhangs_only ? Vec3d(transform_to_octree() * Vec3d(0., 0., 1.)) : Vec3d();
-        for (auto &tri : triangle_mesh.indices) {
-            auto a = triangle_mesh.vertices[tri[0]].cast<double>();
-            auto b = triangle_mesh.vertices[tri[1]].cast<double>();
-            auto c = triangle_mesh.vertices[tri[2]].cast<double>();
-            if (! support_overhangs_only || is_overhang_triangle(a, b, c, up_vector))
-                process_triangle(a, b, c);
-        }
-        for (size_t i = 0; i < overhang_triangles.size(); i += 3)
-            process_triangle(overhang_triangles[i], overhang_triangles[i + 1], overhang_triangles[i + 2]);
+        // Subdivide the subtrees of the eight children of the root cube in parallel.
+        // Each task tests all the triangles against its child of the root cube, which is cheap compared to the subdivision.
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, 8, 1), [&](const tbb::blocked_range<size_t> &range) {
+            const BoundingBoxf3 root_bbox(octree_ptr->root_cube->center - diag_half, octree_ptr->root_cube->center + diag_half);
+            for (size_t child_idx = range.begin(); child_idx < range.end(); ++ child_idx) {
+                boost::object_pool<Cube> &pool = octree_ptr->subtree_pools[child_idx];
+                auto process_triangle = [octree_ptr, max_depth, &root_bbox, child_idx, &pool](const Vec3d &a, const Vec3d &b, const Vec3d &c) {
+                    octree_ptr->insert_triangle_into_child(a, b, c, octree_ptr->root_cube, root_bbox, max_depth, child_idx, pool);
+                };
+                for (auto &tri : triangle_mesh.indices) {
+                    auto a = triangle_mesh.vertices[tri[0]].cast<double>();
+                    auto b = triangle_mesh.vertices[tri[1]].cast<double>();
+                    auto c = triangle_mesh.vertices[tri[2]].cast<double>();
+                    if (! support_overhangs_only || is_overhang_triangle(a, b, c, up_vector))
+                        process_triangle(a, b, c);
+                }
+                for (size_t i = 0; i < overhang_triangles.size(); i += 3)
+                    process_triangle(overhang_triangles[i], overhang_triangles[i + 1], overhang_triangles[i + 2]);
+            }
+        });
         {
             // Transform the octree to world coordinates to reduce computation when extracting infill lines.
             auto rot = transform_to_world().toRotationMatrix();
@@ -1512,40 +1521,43 @@ OctreePtr build_octree(
     return octree;
 }
 
-void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth)
+void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, boost::object_pool<Cube> &pool)
 {
     assert(current_cube);
     assert(depth > 0);
 
-    --depth;
-
     // Squared radius of a sphere around the child cube.
     // const double r2_cube = Slic3r::sqr(0.5 * this->cubes_properties[depth].height + EPSILON);
 
-    for (size_t i = 0; i < 8; ++ i) {
-        const Vec3d &child_center_dir = child_centers[i];
-        // Calculate a slightly expanded bounding box of a child cube to cope with triangles touching a cube wall and other numeric errors.
-        // We will rather densify the octree a bit more than necessary instead of missing a triangle.
-        BoundingBoxf3 bbox;
-        for (int k = 0; k < 3; ++ k) {
-            if (child_center_dir[k] == -1.) {
-                bbox.min[k] = current_bbox.min[k];
-                bbox.max[k] = current_cube->center[k] + EPSILON;
-            } else {
-                bbox.min[k] = current_cube->center[k] - EPSILON;
-                bbox.max[k] = current_bbox.max[k];
-            }
-        }
-        Vec3d child_center = current_cube->center + (child_center_dir * (this->cubes_properties[depth].edge_length / 2.));
-        //if (dist2_to_triangle(a, b, c, child_center) < r2_cube) {
-        // dist2_to_triangle and r2_cube are commented out too.
-        if (triangle_AABB_intersects(a, b, c, bbox)) {
-            if (! current_cube->children[i])
-                current_cube->children[i] = this->pool.construct(child_center);
-            if (depth > 0)
-                this->insert_triangle(a, b, c, current_cube->children[i], bbox, depth);
+    for (size_t i = 0; i < 8; ++ i)
+        this->insert_triangle_into_child(a, b, c, current_cube, current_bbox, depth, i, pool);
+}
+
+void Octree::insert_triangle_into_child(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, size_t i, boost::object_pool<Cube> &pool)
+{
+    --depth;
+
+    const Vec3d &child_center_dir = child_centers[i];
+    // Calculate a slightly expanded bounding box of a child cube to cope with triangles touching a cube wall and other numeric errors.
+    // We will rather densify the octree a bit more than necessary instead of missing a triangle.
+    BoundingBoxf3 bbox;
+    for (int k = 0; k < 3; ++ k) {
+        if (child_center_dir[k] == -1.) {
+            bbox.min[k] = current_bbox.min[k];
+            bbox.max[k] = current_cube->center[k] + EPSILON;
+        } else {
+            bbox.min[k] = current_cube->center[k] - EPSILON;
+            bbox.max[k] = current_bbox.max[k];
         }
     }
+    //if (dist2_to_triangle(a, b, c, child_center) < r2_cube) {
+    // dist2_to_triangle and r2_cube are commented out too.
+    if (triangle_AABB_intersects(a, b, c, bbox)) {
+        if (! current_cube->children[i])
+            current_cube->children[i] = pool.construct(Vec3d(current_cube->center + (child_center_dir * (this->cubes_properties[depth].edge_length / 2.))));
+        if (depth > 0)
+            this->insert_triangle(a, b, c, current_cube->children[i], bbox, depth, pool);
+    }
 }
 
 } // namespace FillAdaptive
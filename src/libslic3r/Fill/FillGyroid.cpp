@@ -102,7 +102,8 @@ static std::vector<Vec2d> make_one_period(double width, double scaleFactor, doub
     return points;
 }
 
-static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double line_spacing, double width, double height)
+static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double line_spacing, double width, double height,
+                                   std::vector<Vec2d> &cached_period_odd, std::vector<Vec2d> &cached_period_even)
 {
     const double scaleFactor = scale_(line_spacing) / density_adjusted;
 
@@ -127,9 +128,17 @@ static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double
         std::swap(width,height);
     }
 
-    std::vector<Vec2d> one_period_odd = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
+    // A full period does not depend on the island size, thus it is shared by all islands of this layer.
+    // A period truncated to a narrow island is only valid for that island.
+    const bool         full_period = width >= 2*M_PI;
+    std::vector<Vec2d> truncated_period_odd, truncated_period_even;
+    std::vector<Vec2d> &one_period_odd  = full_period ? cached_period_odd : truncated_period_odd;
+    std::vector<Vec2d> &one_period_even = full_period ? cached_period_even : truncated_period_even;
+    if (one_period_odd.empty()) {
+        one_period_odd  = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
+        one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, !flip, tolerance);
+    }
     flip = !flip;                                                                   // even polylines are a bit shifted
-    std::vector<Vec2d> one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance);
     Polylines result;
 
     for (double y0 = lower_bound; y0 < upper_bound + EPSILON; y0 += M_PI) {
@@ -168,13 +177,24 @@ void FillGyroid::_fill_surface_single(
     // align bounding box to a multiple of our grid module
     bb.merge(align_to_grid(bb.min, Point(2*M_PI*distance, 2*M_PI*distance)));
 
+    // the cached wave periods are only valid for the Z height, density and spacing they were generated with
+    if (m_period_cache.z != this->z || m_period_cache.density != density_adjusted || m_period_cache.spacing != this->spacing) {
+        m_period_cache.z       = this->z;
+        m_period_cache.density = density_adjusted;
+        m_period_cache.spacing = this->spacing;
+        m_period_cache.odd.clear();
+        m_period_cache.even.clear();
+    }
+
     // generate pattern
     Polylines polylines = make_gyroid_waves(
         scale_(this->z),
         density_adjusted,
         this->spacing,
         ceil(bb.size()(0) / distance) + 1.,
-        ceil(bb.size()(1) / distance) + 1.);
+        ceil(bb.size()(1) / distance) + 1.,
+        m_period_cache.odd,
+        m_period_cache.even);
 
 	// shift the polyline to the grid origin
 	for (Polyline &pl : polylines)
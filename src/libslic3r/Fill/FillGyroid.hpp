@@ -35,6 +35,17 @@ protected:
         const std::pair<float, Point>   &direction, 
         ExPolygon                        expolygon,
         Polylines                       &polylines_out) override;
+
+    // One period of the odd and even waves, reused by all islands filled at the same Z height with the same density and spacing.
+    struct PeriodCache
+    {
+        coordf_t           z       { -1. };
+        double             density { -1. };
+        coordf_t           spacing { -1. };
+        std::vector<Vec2d> odd;
+        std::vector<Vec2d> even;
+    };
+    PeriodCache m_period_cache;
 };
 
 } // namespace Slic3r
@@ -37,12 +37,13 @@ void FillHoneycomb::_fill_surface_single(
         // adjust actual bounding box to the nearest multiple of our hex pattern
         // and align it so that it matches across layers
         
-        BoundingBox bounding_box = expolygon.contour.bounding_box();
+        BoundingBox bounding_box;
         {
-            // rotate bounding box according to infill direction
-            Polygon bb_polygon = bounding_box.polygon();
-            bb_polygon.rotate(direction.first, m.hex_center);
-            bounding_box = bb_polygon.bounding_box();
+            // rotate the contour according to infill direction, its bounding box is tighter than the rotated bounding box
+            // of the unrotated contour, so less of the pattern is generated just to be clipped away
+            Polygon contour = expolygon.contour;
+            contour.rotate(direction.first, m.hex_center);
+            bounding_box = contour.bounding_box();
             
             // extend bounding box so that our pattern will be aligned with other layers
             // $bounding_box->[X1] and [Y1] represent the displacement between new bounding box offset and old one
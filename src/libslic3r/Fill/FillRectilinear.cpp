@@ -825,6 +825,36 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
         segs[i].idx = i;
         segs[i].pos = x0 + i * line_spacing;
     }
+    // il, ir are the left / right indices of vertical lines intersecting a segment with x range <l, r>.
+    auto vertical_lines_range = [x0, line_spacing, n_vlines](coord_t l, coord_t r) {
+        int il = (l - x0) / line_spacing;
+        while (il * line_spacing + x0 < l)
+            ++ il;
+        il = std::max(int(0), il);
+        int ir = (r - x0 + line_spacing) / line_spacing;
+        while (ir * line_spacing + x0 > r)
+            -- ir;
+        ir = std::min(int(n_vlines) - 1, ir);
+        return std::make_pair(il, ir);
+    };
+    {
+        // Count the intersections of each vertical line first, so that each vertical line allocates its intersections just once.
+        std::vector<size_t> num_intersections(n_vlines, 0);
+        for (size_t iContour = 0; iContour < poly_with_offset.n_contours; ++ iContour) {
+            const Points &contour = poly_with_offset.contour(iContour).points;
+            if (contour.size() < 2)
+                continue;
+            for (size_t iSegment = 0; iSegment < contour.size(); ++ iSegment) {
+                const Point &p1 = contour[((iSegment == 0) ? contour.size() : iSegment) - 1];
+                const Point &p2 = contour[iSegment];
+                auto [il, ir] = vertical_lines_range(std::min(p1.x(), p2.x()), std::max(p1.x(), p2.x()));
+                for (int i = il; i <= ir; ++ i)
+                    ++ num_intersections[i];
+            }
+        }
+        for (size_t i = 0; i < n_vlines; ++ i)
+            segs[i].intersections.reserve(num_intersections[i]);
+    }
     // For each contour
     for (size_t iContour = 0; iContour < poly_with_offset.n_contours; ++ iContour) {
         const Points &contour = poly_with_offset.contour(iContour).points;
@@ -840,15 +870,7 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
             coord_t r = p2(0);
             if (l > r)
                 std::swap(l, r);
-            // il, ir are the left / right indices of vertical lines intersecting a segment
-            int il = (l - x0) / line_spacing;
-            while (il * line_spacing + x0 < l)
-                ++ il;
-            il = std::max(int(0), il);
-            int ir = (r - x0 + line_spacing) / line_spacing;
-            while (ir * line_spacing + x0 > r)
-                -- ir;
-            ir = std::min(int(segs.size()) - 1, ir);
+            auto [il, ir] = vertical_lines_range(l, r);
             if (il > ir)
                 // No vertical line intersects this segment.
                 continue;
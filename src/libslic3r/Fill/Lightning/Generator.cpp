@@ -9,6 +9,10 @@
 #include "../../Print.hpp"
 
 #include "ExPolygon.hpp"
+#include "DistanceField.hpp"
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
 
 /* Possible future tasks/optimizations,etc.:
  * - Improve connecting heuristic to favor connecting to shorter trees
@@ -132,24 +136,29 @@ Generator::Generator(PrintObject* m_object, std::vector<Polygons>& contours, std
 
 void Generator::generateInitialInternalOverhangs(const PrintObject &print_object, const std::function<void()> &throw_on_cancel_callback)
 {
-    m_overhang_per_layer.resize(print_object.layers().size());
-
-    Polygons infill_area_above;
-    //Iterate from top to bottom, to subtract the overhang areas above from the overhang areas on the layer below, to get only overhang in the top layer where it is overhanging.
-    for (int layer_nr = int(print_object.layers().size()) - 1; layer_nr >= 0; --layer_nr) {
-        throw_on_cancel_callback();
-        Polygons infill_area_here;
-        for (const LayerRegion* layerm : print_object.get_layer(layer_nr)->regions())
-            for (const Surface& surface : layerm->fill_surfaces.surfaces)
-                if (surface.surface_type == stInternal || surface.surface_type == stInternalVoid)
-                    append(infill_area_here, to_polygons(surface.expolygon));
-
-        //Remove the part of the infill area that is already supported by the walls.
-        Polygons overhang = diff(offset(infill_area_here, -float(m_wall_supporting_radius)), infill_area_above);
-
-        m_overhang_per_layer[layer_nr] = overhang;
-        infill_area_above = std::move(infill_area_here);
-    }
+    const int num_layers = int(print_object.layers().size());
+    m_overhang_per_layer.resize(num_layers);
+
+    std::vector<Polygons> infill_areas(num_layers);
+    tbb::parallel_for(tbb::blocked_range<int>(0, num_layers), [&print_object, &infill_areas, &throw_on_cancel_callback](const tbb::blocked_range<int> &range) {
+        for (int layer_nr = range.begin(); layer_nr < range.end(); ++ layer_nr) {
+            throw_on_cancel_callback();
+            for (const LayerRegion* layerm : print_object.get_layer(layer_nr)->regions())
+                for (const Surface& surface : layerm->fill_surfaces.surfaces)
+                    if (surface.surface_type == stInternal || surface.surface_type == stInternalVoid)
+                        append(infill_areas[layer_nr], to_polygons(surface.expolygon));
+        }
+    });
+
+    // Subtract the infill area above from the overhang areas on the layer below, to get only overhang in the top layer where it is overhanging.
+    tbb::parallel_for(tbb::blocked_range<int>(0, num_layers), [this, num_layers, &infill_areas, &throw_on_cancel_callback](const tbb::blocked_range<int> &range) {
+        for (int layer_nr = range.begin(); layer_nr < range.end(); ++ layer_nr) {
+            throw_on_cancel_callback();
+            //Remove the part of the infill area that is already supported by the walls.
+            m_overhang_per_layer[layer_nr] = diff(offset(infill_areas[layer_nr], -float(m_wall_supporting_radius)),
+                layer_nr + 1 < num_layers ? infill_areas[layer_nr + 1] : Polygons());
+        }
+    });
 }
 
 const Layer& Generator::getTreesForLayer(const size_t& layer_id) const
@@ -160,106 +169,119 @@ const Layer& Generator::getTreesForLayer(const size_t& layer_id) const
 
 void Generator::generateTrees(const PrintObject &print_object, const std::function<void()> &throw_on_cancel_callback)
 {
-    m_lightning_layers.resize(print_object.layers().size());
-    bboxs.resize(print_object.layers().size());
     std::vector<Polygons> infill_outlines(print_object.layers().size(), Polygons());
-
-    // For-each layer from top to bottom:
-    for (int layer_id = int(print_object.layers().size()) - 1; layer_id >= 0; layer_id--) {
-        throw_on_cancel_callback();
-        for (const LayerRegion *layerm : print_object.get_layer(layer_id)->regions())
-            for (const Surface &surface : layerm->fill_surfaces.surfaces)
-                if (surface.surface_type == stInternal || surface.surface_type == stInternalVoid)
-                    append(infill_outlines[layer_id], to_polygons(surface.expolygon));
-    }
-
-    // For various operations its beneficial to quickly locate nearby features on the polygon:
-    const size_t top_layer_id = print_object.layers().size() - 1;
-    EdgeGrid::Grid outlines_locator(get_extents(infill_outlines[top_layer_id]).inflated(SCALED_EPSILON));
-    outlines_locator.create(infill_outlines[top_layer_id], locator_cell_size);
-
-    // For-each layer from top to bottom:
-    for (int layer_id = int(top_layer_id); layer_id >= 0; layer_id--) {
-        throw_on_cancel_callback();
-        Layer             &current_lightning_layer = m_lightning_layers[layer_id];
-        const Polygons    &current_outlines        = infill_outlines[layer_id];
-        const BoundingBox &current_outlines_bbox   = get_extents(current_outlines);
-
-        bboxs[layer_id] = get_extents(current_outlines);
-
-        // register all trees propagated from the previous layer as to-be-reconnected
-        std::vector<NodeSPtr> to_be_reconnected_tree_roots = current_lightning_layer.tree_roots;
-
-        current_lightning_layer.generateNewTrees(m_overhang_per_layer[layer_id], current_outlines, current_outlines_bbox, outlines_locator, m_supporting_radius, m_wall_supporting_radius, throw_on_cancel_callback);
-        current_lightning_layer.reconnectRoots(to_be_reconnected_tree_roots, current_outlines, current_outlines_bbox, outlines_locator, m_supporting_radius, m_wall_supporting_radius);
-
-        // Initialize trees for next lower layer from the current one.
-        if (layer_id == 0)
-            return;
-
-        const Polygons &below_outlines      = infill_outlines[layer_id - 1];
-        BoundingBox     below_outlines_bbox = get_extents(below_outlines).inflated(SCALED_EPSILON);
-        if (const BoundingBox &outlines_locator_bbox = outlines_locator.bbox(); outlines_locator_bbox.defined)
-            below_outlines_bbox.merge(outlines_locator_bbox);
-
-        if (!current_lightning_layer.tree_roots.empty())
-            below_outlines_bbox.merge(get_extents(current_lightning_layer.tree_roots).inflated(SCALED_EPSILON));
-
-        outlines_locator.set_bbox(below_outlines_bbox);
-        outlines_locator.create(below_outlines, locator_cell_size);
-
-        std::vector<NodeSPtr>& lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
-        for (auto& tree : current_lightning_layer.tree_roots)
-            tree->propagateToNextLayer(lower_trees, below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print_object.layers().size()), [&print_object, &infill_outlines, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_id = range.begin(); layer_id < range.end(); ++ layer_id) {
+            throw_on_cancel_callback();
+            for (const LayerRegion *layerm : print_object.get_layer(layer_id)->regions())
+                for (const Surface &surface : layerm->fill_surfaces.surfaces)
+                    if (surface.surface_type == stInternal || surface.surface_type == stInternalVoid)
+                        append(infill_outlines[layer_id], to_polygons(surface.expolygon));
+        }
+    });
+
+    this->propagateTrees(infill_outlines, throw_on_cancel_callback);
 }
 
 void Generator::generateTreesforSupport(std::vector<Polygons>& contours, const std::function<void()> &throw_on_cancel_callback)
 {
     if (contours.empty()) return;
 
-    m_lightning_layers.resize(contours.size());
-    bboxs.resize(contours.size());
-
-    // For various operations its beneficial to quickly locate nearby features on the polygon:
-    const size_t top_layer_id = contours.size() - 1;
-    EdgeGrid::Grid outlines_locator(get_extents(contours[top_layer_id]).inflated(SCALED_EPSILON));
-    outlines_locator.create(contours[top_layer_id], locator_cell_size);
-
-    // For-each layer from top to bottom:
-    for (int layer_id = int(top_layer_id); layer_id >= 0; layer_id--) {
-		throw_on_cancel_callback();
-        Layer& current_lightning_layer = m_lightning_layers[layer_id];
-        const Polygons& current_outlines = contours[layer_id];
-        const BoundingBox& current_outlines_bbox = get_extents(current_outlines);
-
-        bboxs[layer_id] = get_extents(current_outlines);
-
-        // register all trees propagated from the previous layer as to-be-reconnected
-        std::vector<NodeSPtr> to_be_reconnected_tree_roots = current_lightning_layer.tree_roots;
-
-        current_lightning_layer.generateNewTrees(m_overhang_per_layer[layer_id], current_outlines, current_outlines_bbox, outlines_locator, m_supporting_radius, m_wall_supporting_radius, throw_on_cancel_callback);
-        current_lightning_layer.reconnectRoots(to_be_reconnected_tree_roots, current_outlines, current_outlines_bbox, outlines_locator, m_supporting_radius, m_wall_supporting_radius);
-
-        // Initialize trees for next lower layer from the current one.
-        if (layer_id == 0)
-            return;
-
-        const Polygons& below_outlines = contours[layer_id - 1];
-        BoundingBox     below_outlines_bbox = get_extents(below_outlines).inflated(SCALED_EPSILON);
-        if (const BoundingBox& outlines_locator_bbox = outlines_locator.bbox(); outlines_locator_bbox.defined)
-            below_outlines_bbox.merge(outlines_locator_bbox);
-
-        if (!current_lightning_layer.tree_roots.empty())
-            below_outlines_bbox.merge(get_extents(current_lightning_layer.tree_roots).inflated(SCALED_EPSILON));
-
-        outlines_locator.set_bbox(below_outlines_bbox);
-        outlines_locator.create(below_outlines, locator_cell_size);
+    this->propagateTrees(contours, throw_on_cancel_callback);
+}
 
-        std::vector<NodeSPtr>& lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
-        for (auto& tree : current_lightning_layer.tree_roots)
-            tree->propagateToNextLayer(lower_trees, below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+void Generator::propagateTrees(const std::vector<Polygons> &outlines, const std::function<void()> &throw_on_cancel_callback)
+{
+    m_lightning_layers.resize(outlines.size());
+    bboxs.resize(outlines.size());
+    if (outlines.empty())
+        return;
+
+    // The distance fields only depend on the outlines and the overhangs, not on the trees. They are constructed in parallel
+    // in batches of layers, the next lower batch in the background while the trees are propagated through the current one.
+    const int batch_size = std::max(4, 2 * int(tbb::this_task_arena::max_concurrency()));
+    std::vector<std::unique_ptr<DistanceField>> distance_fields(outlines.size());
+    auto build_distance_fields = [this, &outlines, &distance_fields](int layer_begin, int layer_end) {
+        tbb::parallel_for(tbb::blocked_range<int>(layer_begin, layer_end), [this, &outlines, &distance_fields](const tbb::blocked_range<int> &range) {
+            for (int layer_id = range.begin(); layer_id < range.end(); ++ layer_id)
+                distance_fields[layer_id] = std::make_unique<DistanceField>(m_supporting_radius, outlines[layer_id], get_extents(outlines[layer_id]), m_overhang_per_layer[layer_id]);
+        });
+    };
+    tbb::task_group background;
+    // Lowest layer of the batch of distance fields being built in the background.
+    int             background_begin = int(outlines.size());
+    // Lowest layer with its distance field already built.
+    int             ready_begin      = int(outlines.size());
+    auto start_next_batch = [&](int layer_end) {
+        background_begin = std::max(0, layer_end - batch_size);
+        if (background_begin < layer_end)
+            background.run([&build_distance_fields, layer_begin = background_begin, layer_end]{ build_distance_fields(layer_begin, layer_end); });
+    };
+
+    try {
+        start_next_batch(int(outlines.size()));
+
+        // For various operations its beneficial to quickly locate nearby features on the polygon:
+        const size_t top_layer_id = outlines.size() - 1;
+        EdgeGrid::Grid outlines_locator(get_extents(outlines[top_layer_id]).inflated(SCALED_EPSILON));
+        outlines_locator.create(outlines[top_layer_id], locator_cell_size);
+
+        // For-each layer from top to bottom:
+        for (int layer_id = int(top_layer_id); layer_id >= 0; layer_id--) {
+            throw_on_cancel_callback();
+            if (layer_id < ready_begin) {
+                // Entering a new batch: Wait for its distance fields, start building the next one.
+                background.wait();
+                ready_begin = background_begin;
+                start_next_batch(background_begin);
+            }
+            Layer             &current_lightning_layer = m_lightning_layers[layer_id];
+            const Polygons    &current_outlines        = outlines[layer_id];
+            const BoundingBox &current_outlines_bbox   = get_extents(current_outlines);
+
+            bboxs[layer_id] = get_extents(current_outlines);
+
+            // register all trees propagated from the previous layer as to-be-reconnected
+            std::vector<NodeSPtr> to_be_reconnected_tree_roots = current_lightning_layer.tree_roots;
+
+            assert(distance_fields[layer_id]);
+            current_lightning_layer.generateNewTrees(*distance_fields[layer_id], current_outlines, current_outlines_bbox, outlines_locator, m_supporting_radius, m_wall_supporting_radius, throw_on_cancel_callback);
+            distance_fields[layer_id].reset();
+            current_lightning_layer.reconnectRoots(to_be_reconnected_tree_roots, current_outlines, current_outlines_bbox, outlines_locator, m_supporting_radius, m_wall_supporting_radius);
+
+            // Initialize trees for next lower layer from the current one.
+            if (layer_id == 0)
+                break;
+
+            const Polygons &below_outlines      = outlines[layer_id - 1];
+            BoundingBox     below_outlines_bbox = get_extents(below_outlines).inflated(SCALED_EPSILON);
+            if (const BoundingBox &outlines_locator_bbox = outlines_locator.bbox(); outlines_locator_bbox.defined)
+                below_outlines_bbox.merge(outlines_locator_bbox);
+
+            if (!current_lightning_layer.tree_roots.empty())
+                below_outlines_bbox.merge(get_extents(current_lightning_layer.tree_roots).inflated(SCALED_EPSILON));
+
+            outlines_locator.set_bbox(below_outlines_bbox);
+            outlines_locator.create(below_outlines, locator_cell_size);
+
+            // The trees are independent of each other, propagate them in parallel, then collect the trees of the layer below
+            // in the order of the trees above, as if they were propagated serially.
+            const std::vector<NodeSPtr> &trees = current_lightning_layer.tree_roots;
+            std::vector<std::vector<NodeSPtr>> lower_trees_per_tree(trees.size());
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, trees.size()), [this, &trees, &lower_trees_per_tree, &below_outlines, &outlines_locator](const tbb::blocked_range<size_t> &range) {
+                for (size_t tree_idx = range.begin(); tree_idx < range.end(); ++ tree_idx)
+                    trees[tree_idx]->propagateToNextLayer(lower_trees_per_tree[tree_idx], below_outlines, outlines_locator, m_prune_length, m_straightening_max_distance, locator_cell_size / 2);
+            });
+            std::vector<NodeSPtr> &lower_trees = m_lightning_layers[layer_id - 1].tree_roots;
+            for (std::vector<NodeSPtr> &lower : lower_trees_per_tree)
+                append(lower_trees, std::move(lower));
+        }
+    } catch (...) {
+        background.cancel();
+        background.wait();
+        throw;
     }
+    background.wait();
 }
 
 } // namespace Slic3r::FillLightning
@@ -79,6 +79,8 @@ protected:
      */
     void generateTrees(const PrintObject &print_object, const std::function<void()> &throw_on_cancel_callback);
     void generateTreesforSupport(std::vector<Polygons>& contours, const std::function<void()> &throw_on_cancel_callback);
+    // Propagate the trees from the top layer of outlines to the bottom one.
+    void propagateTrees(const std::vector<Polygons> &outlines, const std::function<void()> &throw_on_cancel_callback);
 
     float m_infill_extrusion_width;
 
@@ -16,6 +16,7 @@
 namespace Slic3r::FillLightning
 {
 
+class DistanceField;
 class Node;
 using NodeSPtr = std::shared_ptr<Node>;
 using SparseNodeGrid = std::unordered_multimap<Point, std::weak_ptr<Node>, PointHash>;
@@ -47,6 +48,18 @@ public:
         coord_t wall_supporting_radius,
         const std::function<void()> &throw_on_cancel_callback
     );
+    // Variant of the above with the distance field of current_overhang already constructed,
+    // the distance field does not depend on the trees, thus it may be constructed in advance.
+    void generateNewTrees
+    (
+        DistanceField& distance_field,
+        const Polygons& current_outlines,
+        const BoundingBox& current_outlines_bbox,
+        const EdgeGrid::Grid& outline_locator,
+        coord_t supporting_radius,
+        coord_t wall_supporting_radius,
+        const std::function<void()> &throw_on_cancel_callback
+    );
 
     /*! Determine & connect to connection point in tree/outline.
      * \param min_dist_from_boundary_for_tree If the unsupported point is closer to the boundary than this then don't consider connecting it to a tree
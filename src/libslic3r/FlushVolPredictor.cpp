@@ -4,6 +4,7 @@
 #include <sstream>
 #include <cmath>
 #include <optional>
+#include <mutex>
 
 namespace FlushPredict
 {
@@ -178,6 +179,8 @@ private:
     uint64_t generate_hash_key(const RGB& from, const RGB& to);
     std::unordered_map<uint64_t, float> m_flush_map;
     std::vector<RGB> m_colors;
+    // LAB of m_colors, converted once when loading: predict() compares every query against the whole list.
+    std::vector<FlushPredict::LABColor> m_labs;
     bool m_valid{ false };
 };
 
@@ -235,6 +238,7 @@ FlushVolPredictor::FlushVolPredictor(const std::string& data_file)
                 return;
             }
             m_colors.emplace_back(c);
+            m_labs.emplace_back(FlushPredict::RGB2LAB(c));
         }
     }
     std::getline(in, line); // skip colume name line
@@ -271,19 +275,15 @@ bool FlushVolPredictor::predict(const RGB& from, const RGB& to, float& flush)
         return false;
 
     // find similar colors in color list
-    std::optional<RGB> similar_from, similar_to;
-    for (auto& color : m_colors) {
-        if (FlushPredict::is_similar_color(color, from)) {
-            similar_from = color;
-            break;
-        }
-    }
-    for (auto& color : m_colors) {
-        if (FlushPredict::is_similar_color(color, to)) {
-            similar_to = color;
-            break;
-        }
-    }
+    auto find_similar = [this](const RGB& rgb) -> std::optional<RGB> {
+        const FlushPredict::LABColor lab = FlushPredict::RGB2LAB(rgb);
+        for (size_t i = 0; i < m_colors.size(); ++i)
+            if (FlushPredict::calc_color_distance(m_labs[i], lab) <= FlushPredict::similar_color_distance_threshold)
+                return m_colors[i];
+        return std::nullopt;
+    };
+    std::optional<RGB> similar_from = find_similar(from);
+    std::optional<RGB> similar_to   = find_similar(to);
 
     // `from` and `to` should have similar colors in list
     if (!similar_from || !similar_to)
@@ -300,9 +300,12 @@ bool FlushVolPredictor::predict(const RGB& from, const RGB& to, float& flush)
 
 
 static std::unordered_map<FlushPredict::FlushMachineType, FlushVolPredictor> predictor_instances;
+static std::mutex predictor_instances_mutex;
 
 GenericFlushPredictor::GenericFlushPredictor(const MachineType& type)
 {
+    // The tables are loaded once per machine type and shared, the predictors may be constructed from worker threads.
+    std::lock_guard<std::mutex> lock(predictor_instances_mutex);
     auto iter = predictor_instances.find(type);
     if (iter != predictor_instances.end())
         predictor = &iter->second;
@@ -38,8 +38,10 @@ namespace FlushPredict
     // calculate DeltaE2000
     float calc_color_distance(const LABColor& lab1, const LABColor& lab2);
     float calc_color_distance(const RGBColor& rgb1, const RGBColor& rgb2);
+    // DeltaE up to which we consider two colors to be the same
+    constexpr float similar_color_distance_threshold = 5.0f;
     // check if DeltaE is within the threshold. We consider colors within the threshold to be the same
-    bool is_similar_color(const RGBColor& from, const RGBColor& to, float distance_threshold = 5.0);
+    bool is_similar_color(const RGBColor& from, const RGBColor& to, float distance_threshold = similar_color_distance_threshold);
 
 }
 
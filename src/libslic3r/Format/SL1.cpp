@@ -506,7 +506,11 @@ void SL1Archive::export_print(Zipper& zipper,
             std::string imgname = project + string_printf("%.5d", i++) + "." +
                                   rst.extension();
             
-            zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
+            // The PNG layers are deflated already, compressing them again only costs time.
+            if (std::string(rst.extension()) == "png")
+                zipper.add_entry(imgname.c_str(), rst.data(), rst.size(), Zipper::NO_COMPRESSION);
+            else
+                zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
         }
     } catch(std::exception& e) {
         BOOST_LOG_TRIVIAL(error) << e.what();
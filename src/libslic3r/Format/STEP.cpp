@@ -460,31 +460,22 @@ void Step::clean_mesh_data()
 
 unsigned int Step::get_triangle_num(double linear_defletion, double angle_defletion)
 {
+    // the mesh dialog asks again each time the deflection is changed, a setting seen before is answered from the cache
+    auto cached = m_triangle_num_cache.find({ linear_defletion, angle_defletion });
+    if (cached != m_triangle_num_cache.end())
+        return cached->second;
+
     unsigned int tri_num = 0;
     try {
-        Handle(StepProgressIncdicator) progress = new StepProgressIncdicator(m_stop_mesh);
-        clean_mesh_data();
-        IMeshTools_Parameters param;
-        param.Deflection = linear_defletion;
-        param.Angle = angle_defletion;
-        param.InParallel = true;
-        for (int i = 0; i < m_name_solids.size(); ++i) {
-            BRepMesh_IncrementalMesh mesh(m_name_solids[i].solid, param, progress->Start());
-            for (TopExp_Explorer anExpSF(m_name_solids[i].solid, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
-                TopLoc_Location aLoc;
-                Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(anExpSF.Current()), aLoc);
-                if (!aTriangulation.IsNull()) {
-                    tri_num += aTriangulation->NbTriangles();
-                }
-            }
-            if (m_stop_mesh.load()) {
-                return 0;
-            }
+        tri_num = get_triangle_num_tbb(linear_defletion, angle_defletion);
+        if (m_stop_mesh.load()) {
+            return 0;
         }
     } catch(Exception e) {
         return 0;
     }
-    
+
+    m_triangle_num_cache[{ linear_defletion, angle_defletion }] = tri_num;
     return tri_num;
 }
 
@@ -492,11 +483,19 @@ unsigned int Step::get_triangle_num_tbb(double linear_defletion, double angle_de
 {
     unsigned int tri_num = 0;
     clean_mesh_data();
+    IMeshTools_Parameters param;
+    param.Deflection = linear_defletion;
+    param.Angle = angle_defletion;
+    param.InParallel = true;
     tbb::parallel_for(tbb::blocked_range<size_t>(0, m_name_solids.size()),
     [&](const tbb::blocked_range<size_t>& range) {
         for (size_t i = range.begin(); i < range.end(); i++) {
+            if (m_stop_mesh.load())
+                return;
+            // each solid gets its own progress indicator, they are not thread safe
+            Handle(StepProgressIncdicator) progress = new StepProgressIncdicator(m_stop_mesh);
             unsigned int solids_tri_num = 0;
-            BRepMesh_IncrementalMesh mesh(m_name_solids[i].solid, linear_defletion, false, angle_defletion, true);
+            BRepMesh_IncrementalMesh mesh(m_name_solids[i].solid, param, progress->Start());
             for (TopExp_Explorer anExpSF(m_name_solids[i].solid, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
                 TopLoc_Location aLoc;
                 Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(anExpSF.Current()), aLoc);
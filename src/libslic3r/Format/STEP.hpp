@@ -7,6 +7,7 @@
 #include <boost/filesystem.hpp>
 #include <Message_ProgressIndicator.hxx>
 #include <atomic>
+#include <map>
 
 namespace fs = boost::filesystem;
 
@@ -104,6 +105,8 @@ private:
     Handle(TDocStd_Document) m_doc;
     Handle(XCAFDoc_ShapeTool) m_shape_tool;
     std::vector<NamedSolid> m_name_solids;
+    // triangle count of the whole file for each (linear, angle) deflection pair already meshed
+    std::map<std::pair<double, double>, unsigned int> m_triangle_num_cache;
 };
 
 }; // namespace Slic3r
@@ -0,0 +1,673 @@
+#include "../libslic3r.h"
+#include "../Exception.hpp"
+#include "../Layer.hpp"
+#include "../Print.hpp"
+#include "../Utils.hpp"
+
+#include "SliceCache.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+#include <boost/format.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+namespace Slic3r {
+namespace SliceCache {
+
+// "BBSSLICE" followed by the format version.
+static const char     CACHE_MAGIC[8] = { 'B', 'B', 'S', 'S', 'L', 'I', 'C', 'E' };
+// Written behind the version to refuse files created on a machine with a different byte order.
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+enum class EntityTag : uint8_t
+{
+    Path,
+    MultiPath,
+    Loop,
+    Collection
+};
+
+namespace {
+
+class Writer
+{
+public:
+    std::vector<char>   buffer;
+
+    template<typename T> void put(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written");
+        const char *p = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), p, p + sizeof(T));
+    }
+    void put_size(size_t size) { this->put(uint32_t(size)); }
+    void put_string(const std::string &str) {
+        this->put_size(str.size());
+        buffer.insert(buffer.end(), str.begin(), str.end());
+    }
+    // Coordinates are always stored as 64 bits integers, independent of the size of coord_t.
+    void put_point(const Point &pt) {
+        this->put(int64_t(pt.x()));
+        this->put(int64_t(pt.y()));
+    }
+    void put_bbox(const BoundingBox &bbox) {
+        this->put(uint8_t(bbox.defined));
+        this->put_point(bbox.min);
+        this->put_point(bbox.max);
+    }
+
+    // Point counts of all rings first, then a single flat array with the coordinates of all of them.
+    template<typename RangeOfPoints> void put_rings(const std::vector<const RangeOfPoints*> &rings) {
+        size_t num_points = 0;
+        this->put_size(rings.size());
+        for (const RangeOfPoints *ring : rings) {
+            this->put_size(ring->size());
+            num_points += ring->size();
+        }
+        size_t pos = buffer.size();
+        buffer.resize(pos + num_points * 2 * sizeof(int64_t));
+        char *dst = buffer.data() + pos;
+        for (const RangeOfPoints *ring : rings)
+            for (const Point &pt : *ring) {
+                int64_t xy[2] = { int64_t(pt.x()), int64_t(pt.y()) };
+                memcpy(dst, xy, sizeof(xy));
+                dst += sizeof(xy);
+            }
+    }
+
+    // Number of expolygons, number of rings of each expolygon, then the rings.
+    template<typename Range, typename GetExPolygon> void put_expolygons(const Range &range, GetExPolygon get_expolygon) {
+        std::vector<const Points*> rings;
+        this->put_size(range.size());
+        for (const auto &item : range) {
+            const ExPolygon &expoly = get_expolygon(item);
+            this->put_size(expoly.holes.size() + 1);
+            rings.emplace_back(&expoly.contour.points);
+            for (const Polygon &hole : expoly.holes)
+                rings.emplace_back(&hole.points);
+        }
+        this->put_rings(rings);
+    }
+    void put_expolygons(const ExPolygons &expolys) {
+        this->put_expolygons(expolys, [](const ExPolygon &expoly) -> const ExPolygon& { return expoly; });
+    }
+
+    void put_surfaces(const Surfaces &surfaces) {
+        this->put_expolygons(surfaces, [](const Surface &surface) -> const ExPolygon& { return surface.expolygon; });
+        for (const Surface &surface : surfaces) {
+            this->put(int32_t(surface.surface_type));
+            this->put(surface.thickness);
+            this->put(surface.thickness_layers);
+            this->put(surface.bridge_angle);
+            this->put(surface.extra_perimeters);
+            this->put(uint8_t(surface.counter_circle_compensation));
+            this->put_size(surface.holes_circle_compensation.size());
+            for (int hole_idx : surface.holes_circle_compensation)
+                this->put(int32_t(hole_idx));
+        }
+    }
+
+    void put_arc(const ArcSegment &arc) {
+        this->put(uint8_t(arc.is_arc));
+        this->put(arc.length);
+        this->put(arc.angle_radians);
+        this->put(arc.polar_start_theta);
+        this->put(arc.polar_end_theta);
+        this->put_point(arc.start_point);
+        this->put_point(arc.end_point);
+        this->put(uint8_t(arc.direction));
+        this->put(arc.radius);
+        this->put_point(arc.center);
+    }
+
+    void put_fitting(const std::vector<PathFittingData> &fitting_result) {
+        this->put_size(fitting_result.size());
+        for (const PathFittingData &fitting : fitting_result) {
+            this->put(uint64_t(fitting.start_point_index));
+            this->put(uint64_t(fitting.end_point_index));
+            this->put(uint8_t(fitting.path_type));
+            this->put(uint8_t(fitting.arc_data.is_arc));
+            if (fitting.arc_data.is_arc)
+                this->put_arc(fitting.arc_data);
+        }
+    }
+
+    void put_polylines(const Polylines &polylines) {
+        std::vector<const Points*> rings;
+        rings.reserve(polylines.size());
+        for (const Polyline &polyline : polylines)
+            rings.emplace_back(&polyline.points);
+        this->put_rings(rings);
+        for (const Polyline &polyline : polylines)
+            this->put_fitting(polyline.fitting_result);
+    }
+
+    void put_path(const ExtrusionPath &path) {
+        this->put_rings(std::vector<const Points*>{ &path.polyline.points });
+        this->put_fitting(path.polyline.fitting_result);
+        this->put(path.overhang_degree);
+        this->put(int32_t(path.curve_degree));
+        this->put(path.mm3_per_mm);
+        this->put(path.width);
+        this->put(path.height);
+        this->put(uint8_t(path.role()));
+        this->put(uint8_t(path.is_force_no_extrusion()));
+    }
+
+    void put_paths(const ExtrusionPaths &paths) {
+        this->put_size(paths.size());
+        for (const ExtrusionPath &path : paths)
+            this->put_path(path);
+    }
+
+    void put_entity(const ExtrusionEntity *entity) {
+        if (const ExtrusionEntityCollection *collection = dynamic_cast<const ExtrusionEntityCollection*>(entity)) {
+            this->put(EntityTag::Collection);
+            this->put_collection(*collection);
+        } else if (const ExtrusionPath *path = dynamic_cast<const ExtrusionPath*>(entity)) {
+            this->put(EntityTag::Path);
+            this->put_path(*path);
+        } else if (const ExtrusionMultiPath *multipath = dynamic_cast<const ExtrusionMultiPath*>(entity)) {
+            this->put(EntityTag::MultiPath);
+            this->put_paths(multipath->paths);
+        } else if (const ExtrusionLoop *loop = dynamic_cast<const ExtrusionLoop*>(entity)) {
+            this->put(EntityTag::Loop);
+            this->put(int32_t(loop->loop_role()));
+            this->put_paths(loop->paths);
+        } else
+            throw Slic3r::InvalidArgument("slice cache: invalid extrusion entity type");
+    }
+
+    void put_collection(const ExtrusionEntityCollection &collection) {
+        this->put(uint8_t(collection.no_sort));
+        this->put_size(collection.entities.size());
+        for (const ExtrusionEntity *entity : collection.entities)
+            this->put_entity(entity);
+    }
+
+    void put_layer(const Layer &layer) {
+        this->put_expolygons(layer.lslices);
+        this->put_size(layer.lslices_bboxes.size());
+        for (const BoundingBox &bbox : layer.lslices_bboxes)
+            this->put_bbox(bbox);
+        this->put_expolygons(layer.loverhangs);
+        this->put_bbox(layer.loverhangs_bbox);
+
+        this->put_size(layer.regions().size());
+        for (const LayerRegion *layerm : layer.regions()) {
+            this->put_surfaces(layerm->slices.surfaces);
+            this->put_expolygons(layerm->raw_slices);
+            this->put_collection(layerm->thin_fills);
+            this->put_expolygons(layerm->fill_expolygons);
+            this->put_surfaces(layerm->fill_surfaces.surfaces);
+            this->put_expolygons(layerm->fill_no_overlap_expolygons);
+            this->put_polylines(layerm->unsupported_bridge_edges);
+            this->put_collection(layerm->perimeters);
+            this->put_collection(layerm->fills);
+        }
+    }
+};
+
+class Reader
+{
+public:
+    Reader(const char *data, size_t size) : m_data(data), m_end(data + size) {}
+
+    size_t remaining() const { return size_t(m_end - m_data); }
+
+    template<typename T> T get() {
+        static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be read");
+        T value;
+        this->check(sizeof(T));
+        memcpy(&value, m_data, sizeof(T));
+        m_data += sizeof(T);
+        return value;
+    }
+    size_t get_size() { return size_t(this->get<uint32_t>()); }
+    std::string get_string() {
+        size_t len = this->get_size();
+        this->check(len);
+        std::string out(m_data, len);
+        m_data += len;
+        return out;
+    }
+    Point get_point() {
+        int64_t x = this->get<int64_t>();
+        int64_t y = this->get<int64_t>();
+        return Point(coord_t(x), coord_t(y));
+    }
+    BoundingBox get_bbox() {
+        BoundingBox bbox;
+        bool defined = this->get<uint8_t>() != 0;
+        bbox.min     = this->get_point();
+        bbox.max     = this->get_point();
+        bbox.defined = defined;
+        return bbox;
+    }
+
+    // Counterpart of Writer::put_rings(), returns one Points per ring.
+    std::vector<Points> get_rings() {
+        size_t num_rings = this->get_size();
+        std::vector<size_t> counts(num_rings);
+        size_t num_points = 0;
+        for (size_t &cnt : counts) {
+            cnt = this->get_size();
+            num_points += cnt;
+        }
+        this->check(num_points * 2 * sizeof(int64_t));
+        std::vector<Points> rings(num_rings);
+        for (size_t i = 0; i < num_rings; ++ i) {
+            Points &pts = rings[i];
+            pts.reserve(counts[i]);
+            for (size_t j = 0; j < counts[i]; ++ j) {
+                int64_t xy[2];
+                memcpy(xy, m_data, sizeof(xy));
+                m_data += sizeof(xy);
+                pts.emplace_back(coord_t(xy[0]), coord_t(xy[1]));
+            }
+        }
+        return rings;
+    }
+
+    ExPolygons get_expolygons() {
+        size_t num_expolys = this->get_size();
+        std::vector<size_t> ring_counts(num_expolys);
+        for (size_t &cnt : ring_counts)
+            cnt = this->get_size();
+        std::vector<Points> rings = this->get_rings();
+        ExPolygons out(num_expolys);
+        size_t ring_idx = 0;
+        for (size_t i = 0; i < num_expolys; ++ i) {
+            if (ring_counts[i] == 0 || ring_idx + ring_counts[i] > rings.size())
+                throw Slic3r::FileIOError("slice cache: inconsistent expolygon table");
+            ExPolygon &expoly = out[i];
+            expoly.contour.points = std::move(rings[ring_idx ++]);
+            expoly.holes.reserve(ring_counts[i] - 1);
+            for (size_t j = 1; j < ring_counts[i]; ++ j)
+                expoly.holes.emplace_back(std::move(rings[ring_idx ++]));
+        }
+        return out;
+    }
+
+    Surfaces get_surfaces() {
+        ExPolygons expolys = this->get_expolygons();
+        Surfaces   out;
+        out.reserve(expolys.size());
+        for (ExPolygon &expoly : expolys) {
+            Surface surface(SurfaceType(this->get<int32_t>()), std::move(expoly));
+            surface.thickness                   = this->get<double>();
+            surface.thickness_layers            = this->get<unsigned short>();
+            surface.bridge_angle                = this->get<double>();
+            surface.extra_perimeters            = this->get<unsigned short>();
+            surface.counter_circle_compensation = this->get<uint8_t>() != 0;
+            surface.holes_circle_compensation.resize(this->get_size());
+            for (int &hole_idx : surface.holes_circle_compensation)
+                hole_idx = this->get<int32_t>();
+            out.emplace_back(std::move(surface));
+        }
+        return out;
+    }
+
+    ArcSegment get_arc() {
+        ArcSegment arc;
+        arc.is_arc            = this->get<uint8_t>() != 0;
+        arc.length            = this->get<double>();
+        arc.angle_radians     = this->get<double>();
+        arc.polar_start_theta = this->get<double>();
+        arc.polar_end_theta   = this->get<double>();
+        arc.start_point       = this->get_point();
+        arc.end_point         = this->get_point();
+        arc.direction         = ArcDirection(this->get<uint8_t>());
+        arc.radius            = this->get<double>();
+        arc.center            = this->get_point();
+        return arc;
+    }
+
+    void get_fitting(std::vector<PathFittingData> &fitting_result) {
+        fitting_result.resize(this->get_size());
+        for (PathFittingData &fitting : fitting_result) {
+            fitting.start_point_index = size_t(this->get<uint64_t>());
+            fitting.end_point_index   = size_t(this->get<uint64_t>());
+            fitting.path_type         = EMovePathType(this->get<uint8_t>());
+            if (this->get<uint8_t>() != 0)
+                fitting.arc_data = this->get_arc();
+        }
+    }
+
+    Polylines get_polylines() {
+        std::vector<Points> rings = this->get_rings();
+        Polylines out(rings.size());
+        for (size_t i = 0; i < rings.size(); ++ i) {
+            out[i].points = std::move(rings[i]);
+            this->get_fitting(out[i].fitting_result);
+        }
+        return out;
+    }
+
+    void get_path(ExtrusionPath &path) {
+        std::vector<Points> rings = this->get_rings();
+        if (rings.size() != 1)
+            throw Slic3r::FileIOError("slice cache: invalid extrusion path");
+        path.polyline.points = std::move(rings.front());
+        this->get_fitting(path.polyline.fitting_result);
+        path.overhang_degree = this->get<double>();
+        path.curve_degree    = this->get<int32_t>();
+        path.mm3_per_mm      = this->get<double>();
+        path.width           = this->get<float>();
+        path.height          = this->get<float>();
+        path.set_extrusion_role(ExtrusionRole(this->get<uint8_t>()));
+        path.set_force_no_extrusion(this->get<uint8_t>() != 0);
+    }
+
+    void get_paths(ExtrusionPaths &paths) {
+        paths.resize(this->get_size());
+        for (ExtrusionPath &path : paths)
+            this->get_path(path);
+    }
+
+    ExtrusionEntity* get_entity() {
+        switch (this->get<EntityTag>()) {
+        case EntityTag::Path: {
+            std::unique_ptr<ExtrusionPath> path = std::make_unique<ExtrusionPath>();
+            this->get_path(*path);
+            return path.release();
+        }
+        case EntityTag::MultiPath: {
+            std::unique_ptr<ExtrusionMultiPath> multipath = std::make_unique<ExtrusionMultiPath>();
+            this->get_paths(multipath->paths);
+            return multipath.release();
+        }
+        case EntityTag::Loop: {
+            std::unique_ptr<ExtrusionLoop> loop = std::make_unique<ExtrusionLoop>(ExtrusionLoopRole(this->get<int32_t>()));
+            this->get_paths(loop->paths);
+            return loop.release();
+        }
+        case EntityTag::Collection: {
+            std::unique_ptr<ExtrusionEntityCollection> collection = std::make_unique<ExtrusionEntityCollection>();
+            this->get_collection(*collection);
+            return collection.release();
+        }
+        default:
+            throw Slic3r::FileIOError("slice cache: unknown extrusion entity type");
+        }
+    }
+
+    void get_collection(ExtrusionEntityCollection &collection) {
+        collection.no_sort = this->get<uint8_t>() != 0;
+        size_t num_entities = this->get_size();
+        collection.entities.reserve(collection.entities.size() + num_entities);
+        for (size_t i = 0; i < num_entities; ++ i)
+            collection.entities.emplace_back(this->get_entity());
+    }
+
+    void get_layer(Layer &layer) {
+        append(layer.lslices, this->get_expolygons());
+        size_t num_bboxes = this->get_size();
+        layer.lslices_bboxes.reserve(num_bboxes);
+        for (size_t i = 0; i < num_bboxes; ++ i)
+            layer.lslices_bboxes.emplace_back(this->get_bbox());
+        append(layer.loverhangs, this->get_expolygons());
+        layer.loverhangs_bbox = this->get_bbox();
+
+        size_t num_regions = this->get_size();
+        if (num_regions != layer.region_count())
+            throw Slic3r::FileIOError("slice cache: layer region count mismatch");
+        for (size_t region_id = 0; region_id < num_regions; ++ region_id) {
+            LayerRegion *layerm = layer.get_region(int(region_id));
+            layerm->slices.surfaces = this->get_surfaces();
+            layerm->raw_slices = this->get_expolygons();
+            this->get_collection(layerm->thin_fills);
+            layerm->fill_expolygons = this->get_expolygons();
+            layerm->fill_surfaces.surfaces = this->get_surfaces();
+            layerm->fill_no_overlap_expolygons = this->get_expolygons();
+            layerm->unsupported_bridge_edges = this->get_polylines();
+            this->get_collection(layerm->perimeters);
+            this->get_collection(layerm->fills);
+        }
+    }
+
+private:
+    void check(size_t bytes) const {
+        if (size_t(m_end - m_data) < bytes)
+            throw Slic3r::FileIOError("slice cache: unexpected end of data");
+    }
+
+    const char *m_data;
+    const char *m_end;
+};
+
+static void put_layer_record(Writer &writer, const LayerRecord &record)
+{
+    writer.put(int32_t(record.id));
+    writer.put(int32_t(record.interface_id));
+    writer.put(double(record.height));
+    writer.put(double(record.print_z));
+    writer.put(double(record.slice_z));
+    writer.put_size(record.region_hashes.size());
+    for (size_t hash : record.region_hashes)
+        writer.put(uint64_t(hash));
+    writer.put(record.offset);
+    writer.put(record.size);
+}
+
+static LayerRecord get_layer_record(Reader &reader)
+{
+    LayerRecord record;
+    record.id           = reader.get<int32_t>();
+    record.interface_id = reader.get<int32_t>();
+    record.height       = reader.get<double>();
+    record.print_z      = reader.get<double>();
+    record.slice_z      = reader.get<double>();
+    record.region_hashes.resize(reader.get_size());
+    for (size_t &hash : record.region_hashes)
+        hash = size_t(reader.get<uint64_t>());
+    record.offset       = reader.get<uint64_t>();
+    record.size         = reader.get<uint64_t>();
+    return record;
+}
+
+} // anonymous namespace
+
+int export_object(const PrintObject &object, const std::string &name, size_t identify_id,
+                  const std::vector<groupedVolumeSlices> &first_layer_groups, const std::string &file_name)
+{
+    try {
+        // Encode the layer payloads in parallel, each into its own buffer.
+        const size_t layer_count         = object.layer_count();
+        const size_t support_layer_count = object.support_layer_count();
+        std::vector<std::vector<char>> payloads(layer_count + support_layer_count + 1);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, layer_count + support_layer_count),
+            [&object, &payloads, layer_count](const tbb::blocked_range<size_t> &range) {
+                for (size_t idx = range.begin(); idx < range.end(); ++ idx) {
+                    Writer writer;
+                    if (idx < layer_count)
+                        writer.put_layer(*object.get_layer(int(idx)));
+                    else {
+                        const SupportLayer *support_layer = object.support_layers()[idx - layer_count];
+                        writer.put_layer(*support_layer);
+                        writer.put_expolygons(support_layer->support_islands);
+                        writer.put_collection(support_layer->support_fills);
+                    }
+                    payloads[idx] = std::move(writer.buffer);
+                }
+            });
+        {
+            Writer writer;
+            writer.put_size(first_layer_groups.size());
+            for (const groupedVolumeSlices &group : first_layer_groups) {
+                writer.put(int32_t(group.groupId));
+                writer.put_size(group.volume_ids.size());
+                for (const ObjectID &volume_id : group.volume_ids)
+                    writer.put(uint64_t(volume_id.id));
+                writer.put_expolygons(group.slices);
+            }
+            payloads.back() = std::move(writer.buffer);
+        }
+
+        // Payload offsets are relative to the end of the header.
+        uint64_t offset = 0;
+        auto next_range = [&payloads, &offset](size_t idx, LayerRecord &record) {
+            record.offset = offset;
+            record.size   = payloads[idx].size();
+            offset       += record.size;
+        };
+        Writer header;
+        header.buffer.insert(header.buffer.end(), std::begin(CACHE_MAGIC), std::end(CACHE_MAGIC));
+        header.put(FORMAT_VERSION);
+        header.put(BYTE_ORDER_MARK);
+        header.put_string(name);
+        header.put(uint64_t(identify_id));
+        header.put_size(layer_count);
+        header.put_size(support_layer_count);
+        for (size_t idx = 0; idx < layer_count; ++ idx) {
+            const Layer *layer = object.get_layer(int(idx));
+            LayerRecord  record;
+            record.id      = int(layer->id());
+            record.height  = layer->height;
+            record.print_z = layer->print_z;
+            record.slice_z = layer->slice_z;
+            for (const LayerRegion *layerm : layer->regions())
+                record.region_hashes.emplace_back(layerm->region().config_hash());
+            next_range(idx, record);
+            put_layer_record(header, record);
+        }
+        for (size_t idx = 0; idx < support_layer_count; ++ idx) {
+            const SupportLayer *support_layer = object.support_layers()[idx];
+            LayerRecord         record;
+            record.id           = int(support_layer->id());
+            record.interface_id = int(support_layer->interface_id());
+            record.height       = support_layer->height;
+            record.print_z      = support_layer->print_z;
+            record.slice_z      = support_layer->slice_z;
+            next_range(layer_count + idx, record);
+            put_layer_record(header, record);
+        }
+        header.put(offset);
+        header.put(uint64_t(payloads.back().size()));
+
+        boost::nowide::ofstream out(file_name, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (! out.is_open()) {
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << boost::format(": can not open %1% for writing") % file_name;
+            return CLI_EXPORT_CACHE_WRITE_FAILED;
+        }
+        out.write(header.buffer.data(), header.buffer.size());
+        for (const std::vector<char> &payload : payloads)
+            out.write(payload.data(), payload.size());
+        out.close();
+        if (out.fail()) {
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << boost::format(": failed writing %1%") % file_name;
+            return CLI_EXPORT_CACHE_WRITE_FAILED;
+        }
+    } catch (std::exception &err) {
+        BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ": save to " << file_name << " got a generic exception, reason = " << err.what();
+        return CLI_EXPORT_CACHE_WRITE_FAILED;
+    }
+    return 0;
+}
+
+int ObjectReader::open(const std::string &file_name)
+{
+    this->close();
+    try {
+        m_file.open(file_name);
+    } catch (std::exception &err) {
+        BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ": can not map " << file_name << ", reason = " << err.what();
+        return CLI_IMPORT_CACHE_LOAD_FAILED;
+    }
+    if (! m_file.is_open()) {
+        BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << boost::format(": can not map %1%") % file_name;
+        return CLI_IMPORT_CACHE_LOAD_FAILED;
+    }
+
+    try {
+        if (m_file.size() < sizeof(CACHE_MAGIC) || memcmp(m_file.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0) {
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << boost::format(": %1% is not a slice cache file") % file_name;
+            this->close();
+            return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+        }
+        Reader   reader(m_file.data() + sizeof(CACHE_MAGIC), m_file.size() - sizeof(CACHE_MAGIC));
+        uint32_t version    = reader.get<uint32_t>();
+        uint32_t byte_order = reader.get<uint32_t>();
+        if (version != FORMAT_VERSION || byte_order != BYTE_ORDER_MARK) {
+            BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": %1% has version %2%, expected %3%, or a foreign byte order") % file_name % version % FORMAT_VERSION;
+            this->close();
+            return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+        }
+        m_name        = reader.get_string();
+        m_identify_id = size_t(reader.get<uint64_t>());
+        m_layers.resize(reader.get_size());
+        m_support_layers.resize(reader.get_size());
+        for (LayerRecord &record : m_layers)
+            record = get_layer_record(reader);
+        for (LayerRecord &record : m_support_layers)
+            record = get_layer_record(reader);
+        m_groups_offset = reader.get<uint64_t>();
+        m_groups_size   = reader.get<uint64_t>();
+
+        // Rebase the payload ranges to the start of the file and validate them.
+        const uint64_t header_size = uint64_t(m_file.size() - reader.remaining());
+        auto rebase = [this, header_size](uint64_t &offset, uint64_t size) {
+            offset += header_size;
+            if (offset > m_file.size() || size > m_file.size() - offset)
+                throw Slic3r::FileIOError("slice cache: payload out of range");
+        };
+        for (LayerRecord &record : m_layers)
+            rebase(record.offset, record.size);
+        for (LayerRecord &record : m_support_layers)
+            rebase(record.offset, record.size);
+        rebase(m_groups_offset, m_groups_size);
+    } catch (std::exception &err) {
+        BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ": parse " << file_name << " got a generic exception, reason = " << err.what();
+        this->close();
+        return CLI_IMPORT_CACHE_LOAD_FAILED;
+    }
+    return 0;
+}
+
+void ObjectReader::close()
+{
+    if (m_file.is_open())
+        m_file.close();
+    m_name.clear();
+    m_identify_id = 0;
+    m_layers.clear();
+    m_support_layers.clear();
+    m_groups_offset = 0;
+    m_groups_size   = 0;
+}
+
+void ObjectReader::load_layer(size_t layer_index, Layer &layer) const
+{
+    const LayerRecord &record = m_layers[layer_index];
+    Reader reader(m_file.data() + record.offset, size_t(record.size));
+    reader.get_layer(layer);
+}
+
+void ObjectReader::load_support_layer(size_t layer_index, SupportLayer &support_layer) const
+{
+    const LayerRecord &record = m_support_layers[layer_index];
+    Reader reader(m_file.data() + record.offset, size_t(record.size));
+    reader.get_layer(support_layer);
+    append(support_layer.support_islands, reader.get_expolygons());
+    reader.get_collection(support_layer.support_fills);
+}
+
+std::vector<groupedVolumeSlices> ObjectReader::load_first_layer_groups() const
+{
+    Reader reader(m_file.data() + m_groups_offset, size_t(m_groups_size));
+    std::vector<groupedVolumeSlices> groups(reader.get_size());
+    for (groupedVolumeSlices &group : groups) {
+        group.groupId = reader.get<int32_t>();
+        group.volume_ids.resize(reader.get_size());
+        for (ObjectID &volume_id : group.volume_ids)
+            volume_id.id = size_t(reader.get<uint64_t>());
+        group.slices = reader.get_expolygons();
+    }
+    return groups;
+}
+
+} // namespace SliceCache
+} // namespace Slic3r
@@ -0,0 +1,90 @@
+#ifndef slic3r_Format_SliceCache_hpp_
+#define slic3r_Format_SliceCache_hpp_
+
+#include "../libslic3r.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace Slic3r {
+
+class Layer;
+class SupportLayer;
+class PrintObject;
+struct groupedVolumeSlices;
+
+// BBS: binary replacement of the per object json slice cache written by Print::export_cached_data().
+// The file is made of a fixed header, a table of layer records (ids, heights, region hashes and the
+// byte range of the layer payload) followed by the payloads themselves. Geometry is stored as flat
+// coordinate arrays preceded by their offset tables, so a layer can be decoded directly from a
+// memory mapped file without touching any other layer.
+namespace SliceCache {
+
+// Bump whenever the layout of any record changes, caches of other versions are refused.
+static constexpr uint32_t FORMAT_VERSION = 1;
+// Extension of the binary cache files, the json cache keeps using ".json".
+static constexpr const char *FILE_EXTENSION = ".bin";
+
+struct LayerRecord
+{
+    int                     id              { 0 };
+    int                     interface_id    { -1 };  // support layers only
+    coordf_t                height          { 0. };
+    coordf_t                print_z         { 0. };
+    coordf_t                slice_z         { 0. };
+    std::vector<size_t>     region_hashes;
+    uint64_t                offset          { 0 };
+    uint64_t                size            { 0 };
+};
+
+// Serialize the layers, support layers and first layer groups of a print object.
+// The volume ids of first_layer_groups are expected to be already converted to volume indices.
+// Returns 0 on success, CLI_EXPORT_CACHE_WRITE_FAILED otherwise.
+int export_object(const PrintObject &object, const std::string &name, size_t identify_id,
+                  const std::vector<groupedVolumeSlices> &first_layer_groups, const std::string &file_name);
+
+// Read only view over a binary cache file. The file stays mapped for the lifetime of the reader
+// and the layers are decoded lazily, thus load_layer() may be called from several threads at once.
+class ObjectReader
+{
+public:
+    ObjectReader() = default;
+    ~ObjectReader() { this->close(); }
+    ObjectReader(const ObjectReader &) = delete;
+    ObjectReader& operator=(const ObjectReader &) = delete;
+
+    // Returns 0 on success, CLI_IMPORT_CACHE_LOAD_FAILED if the file can not be mapped or
+    // CLI_IMPORT_CACHE_DATA_CAN_NOT_USE if it was written by an incompatible version.
+    int                                 open(const std::string &file_name);
+    void                                close();
+    bool                                is_open() const { return m_file.is_open(); }
+
+    const std::string&                  name() const { return m_name; }
+    size_t                              identify_id() const { return m_identify_id; }
+    const std::vector<LayerRecord>&     layers() const { return m_layers; }
+    const std::vector<LayerRecord>&     support_layers() const { return m_support_layers; }
+
+    // Decode the payload of a single layer into an already created layer with its regions.
+    // Throws Slic3r::FileIOError if the payload is damaged.
+    void                                load_layer(size_t layer_index, Layer &layer) const;
+    void                                load_support_layer(size_t layer_index, SupportLayer &support_layer) const;
+    // Volume ids are returned as volume indices, same as they were exported.
+    std::vector<groupedVolumeSlices>    load_first_layer_groups() const;
+
+private:
+    boost::iostreams::mapped_file_source    m_file;
+    std::string                             m_name;
+    size_t                                  m_identify_id { 0 };
+    std::vector<LayerRecord>                m_layers;
+    std::vector<LayerRecord>                m_support_layers;
+    uint64_t                                m_groups_offset { 0 };
+    uint64_t                                m_groups_size { 0 };
+};
+
+} // namespace SliceCache
+} // namespace Slic3r
+
+#endif /* slic3r_Format_SliceCache_hpp_ */
@@ -7,6 +7,7 @@
 #include "../GCode.hpp"
 #include "../Geometry.hpp"
 #include "../GCode/ThumbnailData.hpp"
+#include "../GCode/GCodeResultCache.hpp"
 #include "../Semver.hpp"
 #include "../Time.hpp"
 
@@ -156,6 +157,8 @@ const std::string MODEL_RELS_FILE = "3D/_rels/3dmodel.model.rels";
 const std::string METADATA_DIR = "Metadata/";
 const std::string ACCESOR_DIR = "accesories/";
 const std::string GCODE_EXTENSION = ".gcode";
+// processed G-code stored by GCodeResultCache next to "plate_N.gcode"
+const std::string GCODE_RESULT_EXTENSION = std::string(".gcode") + Slic3r::GCodeResultCache::FILE_EXTENSION;
 const std::string THUMBNAIL_EXTENSION = ".png";
 const std::string CALIBRATION_INFO_EXTENSION = ".json";
 const std::string CONTENT_TYPES_FILE = "[Content_Types].xml";
@@ -463,6 +466,49 @@ int bbs_get_attribute_value_int(const char** attributes, unsigned int attributes
     return value;
 }
 
+// Single pass readers of the <vertex> and <triangle> attributes, these elements make up almost all of a model file.
+// Missing values are set equal to ZERO / empty.
+Slic3r::Vec3f bbs_get_vertex_attributes(const char** attributes, unsigned int attributes_size)
+{
+    Slic3r::Vec3f vertex = Slic3r::Vec3f::Zero();
+    if ((attributes == nullptr) || (attributes_size % 2 != 0))
+        return vertex;
+
+    for (unsigned int a = 0; a < attributes_size; a += 2) {
+        const char *key = attributes[a];
+        // "x", "y" or "z"
+        if (key[0] >= X_ATTR[0] && key[0] <= Z_ATTR[0] && key[1] == '\0') {
+            const char *text = attributes[a + 1];
+            fast_float::from_chars(text, text + strlen(text), vertex(key[0] - X_ATTR[0]));
+        }
+    }
+    return vertex;
+}
+
+void bbs_get_triangle_attributes(const char** attributes, unsigned int attributes_size, Slic3r::Vec3i& indices,
+    std::string& custom_supports, std::string& custom_seam, std::string& mmu_segmentation, std::string& face_property)
+{
+    indices = Slic3r::Vec3i::Zero();
+    if ((attributes == nullptr) || (attributes_size % 2 != 0))
+        return;
+
+    for (unsigned int a = 0; a < attributes_size; a += 2) {
+        const char *key  = attributes[a];
+        const char *text = attributes[a + 1];
+        // "v1", "v2" or "v3"
+        if (key[0] == V1_ATTR[0] && key[1] >= V1_ATTR[1] && key[1] <= V3_ATTR[1] && key[2] == '\0')
+            boost::spirit::qi::parse(text, text + strlen(text), boost::spirit::qi::int_, indices(key[1] - V1_ATTR[1]));
+        else if (::strcmp(key, CUSTOM_SUPPORTS_ATTR) == 0)
+            custom_supports = text;
+        else if (::strcmp(key, CUSTOM_SEAM_ATTR) == 0)
+            custom_seam = text;
+        else if (::strcmp(key, MMU_SEGMENTATION_ATTR) == 0)
+            mmu_segmentation = text;
+        else if (::strcmp(key, FACE_PROPERTY_ATTR) == 0)
+            face_property = text;
+    }
+}
+
 bool bbs_get_attribute_value_bool(const char** attributes, unsigned int attributes_size, const char* attribute_key)
 {
     const char* text = bbs_get_attribute_value_charptr(attributes, attributes_size, attribute_key);
@@ -1768,6 +1814,10 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             dont_load_config = true;
         }
 
+        // plate gcode, thumbnails and calibration files only need to be copied out to the backup directory,
+        // they are extracted in parallel once the loop below is done
+        std::vector<mz_uint> metadata_files;
+
         // we then loop again the entries to read other files stored in the archive
         for (mz_uint i = 0; i < num_entries; ++i) {
             if (mz_zip_reader_file_stat(&archive, i, &stat)) {
@@ -1863,17 +1913,17 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                     if (m_load_aux && !m_load_restore)
                         _extract_auxiliary_file_from_archive(archive, stat, model);
                 }
-                else if (!dont_load_config && boost::algorithm::istarts_with(name, METADATA_DIR) && boost::algorithm::iends_with(name, GCODE_EXTENSION)) {
-                    //load gcode files
-                    _extract_file_from_archive(archive, stat);
+                else if (!dont_load_config && boost::algorithm::istarts_with(name, METADATA_DIR) && (boost::algorithm::iends_with(name, GCODE_EXTENSION) || boost::algorithm::iends_with(name, GCODE_RESULT_EXTENSION))) {
+                    //load gcode files and their processed results
+                    metadata_files.push_back(stat.m_file_index);
                 }
                 else if (!dont_load_config && boost::algorithm::istarts_with(name, METADATA_DIR) && boost::algorithm::iends_with(name, THUMBNAIL_EXTENSION)) {
                     //BBS parsing pattern thumbnail and plate thumbnails
-                    _extract_file_from_archive(archive, stat);
+                    metadata_files.push_back(stat.m_file_index);
                 }
                 else if (!dont_load_config && boost::algorithm::istarts_with(name, METADATA_DIR) && boost::algorithm::iends_with(name, CALIBRATION_INFO_EXTENSION)) {
                     //BBS parsing pattern config files
-                    _extract_file_from_archive(archive, stat);
+                    metadata_files.push_back(stat.m_file_index);
                 }
                 else {
                     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" << __LINE__ << boost::format(", %1% skipped, already parsed or a directory or not supported\n")%name;
@@ -1883,6 +1933,21 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 
         lock.close();
 
+        // the zip reader is not thread safe, each task opens the archive on its own
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, metadata_files.size()), [this, &filename, &metadata_files](const tbb::blocked_range<size_t>& range) {
+            mz_zip_archive archive;
+            mz_zip_zero_struct(&archive);
+            if (!open_zip_reader(&archive, filename)) {
+                add_error("Unable to open the zipfile " + filename);
+                return;
+            }
+            mz_zip_archive_file_stat stat;
+            for (size_t i = range.begin(); i < range.end(); ++i)
+                if (mz_zip_reader_file_stat(&archive, metadata_files[i], &stat))
+                    _extract_file_from_archive(archive, stat);
+            close_zip_reader(&archive);
+        });
+
         if (!m_is_bbl_3mf) {
             // if the 3mf was not produced by BambuStudio and there is more than one instance,
             // split the object in as many objects as instances
@@ -3575,10 +3640,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         // appends the vertex coordinates
         // missing values are set equal to ZERO
         if (m_curr_object)
-            m_curr_object->geometry.vertices.emplace_back(
-                m_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, X_ATTR),
-                m_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, Y_ATTR),
-                m_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, Z_ATTR));
+            m_curr_object->geometry.vertices.emplace_back(m_unit_factor * bbs_get_vertex_attributes(attributes, num_attributes));
         return true;
     }
 
@@ -3614,16 +3676,16 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         // appends the triangle's vertices indices
         // missing values are set equal to ZERO
         if (m_curr_object) {
-            m_curr_object->geometry.triangles.emplace_back(
-                bbs_get_attribute_value_int(attributes, num_attributes, V1_ATTR),
-                bbs_get_attribute_value_int(attributes, num_attributes, V2_ATTR),
-                bbs_get_attribute_value_int(attributes, num_attributes, V3_ATTR));
-
-            m_curr_object->geometry.custom_supports.push_back(bbs_get_attribute_value_string(attributes, num_attributes, CUSTOM_SUPPORTS_ATTR));
-            m_curr_object->geometry.custom_seam.push_back(bbs_get_attribute_value_string(attributes, num_attributes, CUSTOM_SEAM_ATTR));
-            m_curr_object->geometry.mmu_segmentation.push_back(bbs_get_attribute_value_string(attributes, num_attributes, MMU_SEGMENTATION_ATTR));
+            Geometry &geometry = m_curr_object->geometry;
+            Vec3i     indices;
+            geometry.custom_supports.emplace_back();
+            geometry.custom_seam.emplace_back();
+            geometry.mmu_segmentation.emplace_back();
             // BBS
-            m_curr_object->geometry.face_properties.push_back(bbs_get_attribute_value_string(attributes, num_attributes, FACE_PROPERTY_ATTR));
+            geometry.face_properties.emplace_back();
+            bbs_get_triangle_attributes(attributes, num_attributes, indices,
+                geometry.custom_supports.back(), geometry.custom_seam.back(), geometry.mmu_segmentation.back(), geometry.face_properties.back());
+            geometry.triangles.emplace_back(indices);
         }
         return true;
     }
@@ -5173,10 +5235,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         // appends the vertex coordinates
         // missing values are set equal to ZERO
         if (current_object)
-            current_object->geometry.vertices.emplace_back(
-                object_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, X_ATTR),
-                object_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, Y_ATTR),
-                object_unit_factor * bbs_get_attribute_value_float(attributes, num_attributes, Z_ATTR));
+            current_object->geometry.vertices.emplace_back(object_unit_factor * bbs_get_vertex_attributes(attributes, num_attributes));
         return true;
     }
 
@@ -5212,16 +5271,16 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         // appends the triangle's vertices indices
         // missing values are set equal to ZERO
         if (current_object) {
-            current_object->geometry.triangles.emplace_back(
-                bbs_get_attribute_value_int(attributes, num_attributes, V1_ATTR),
-                bbs_get_attribute_value_int(attributes, num_attributes, V2_ATTR),
-                bbs_get_attribute_value_int(attributes, num_attributes, V3_ATTR));
-
-            current_object->geometry.custom_supports.push_back(bbs_get_attribute_value_string(attributes, num_attributes, CUSTOM_SUPPORTS_ATTR));
-            current_object->geometry.custom_seam.push_back(bbs_get_attribute_value_string(attributes, num_attributes, CUSTOM_SEAM_ATTR));
-            current_object->geometry.mmu_segmentation.push_back(bbs_get_attribute_value_string(attributes, num_attributes, MMU_SEGMENTATION_ATTR));
+            Geometry &geometry = current_object->geometry;
+            Vec3i     indices;
+            geometry.custom_supports.emplace_back();
+            geometry.custom_seam.emplace_back();
+            geometry.mmu_segmentation.emplace_back();
             // BBS
-            current_object->geometry.face_properties.push_back(bbs_get_attribute_value_string(attributes, num_attributes, FACE_PROPERTY_ATTR));
+            geometry.face_properties.emplace_back();
+            bbs_get_triangle_attributes(attributes, num_attributes, indices,
+                geometry.custom_supports.back(), geometry.custom_seam.back(), geometry.mmu_segmentation.back(), geometry.face_properties.back());
+            geometry.triangles.emplace_back(indices);
         }
         return true;
     }
@@ -5519,10 +5578,12 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         bool m_from_backup_save{ false };   // the object save is from backup store
         bool m_split_model { false };       // save object per file with Production Extention
         bool m_save_gcode { false };        // whether to save gcode for normal save
+        bool m_save_gcode_result { false }; // whether to save the processed gcode next to the gcode
         bool m_skip_model { false };        // skip model when exporting .gcode.3mf
         bool m_skip_auxiliary { false };    // skip normal axuiliary files
         bool m_use_loaded_id { false };        // whether to use loaded id for identify_id
         bool m_share_mesh { false };        // whether to share mesh between objects
+        int  m_model_compression { MZ_DEFAULT_COMPRESSION }; // deflate level of the model files, backups favor speed over size
         std::string m_thumbnail_middle = PRINTER_THUMBNAIL_MIDDLE_FILE;
         std::string m_thumbnail_small  = PRINTER_THUMBNAIL_SMALL_FILE;
         std::map<void const *, std::pair<ObjectData*, ModelVolume const *>> m_shared_meshes;
@@ -5557,7 +5618,15 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 
         bool _add_content_types_file_to_archive(mz_zip_archive& archive);
 
-        bool _add_thumbnail_file_to_archive(mz_zip_archive& archive, const ThumbnailData& thumbnail_data, const char* local_path, int index, bool generate_small_thumbnail = false);
+        // PNG images of a plate thumbnail, encoded ahead of adding them to the archive.
+        struct ThumbnailPng
+        {
+            std::string png;
+            std::string small_png;
+            bool        has_small = false;
+        };
+        static void _encode_thumbnail_png(const ThumbnailData& thumbnail_data, bool generate_small_thumbnail, ThumbnailPng& out);
+        bool _add_thumbnail_file_to_archive(mz_zip_archive& archive, const ThumbnailPng& thumbnail_png, const char* local_path, int index);
         bool _add_calibration_file_to_archive(mz_zip_archive& archive, const ThumbnailData& thumbnail_data, int index);
         bool _add_bbox_file_to_archive(mz_zip_archive& archive, const PlateBBoxData& id_bboxes, int index);
         bool _add_relationships_file_to_archive(mz_zip_archive &                archive,
@@ -5614,10 +5683,12 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         m_skip_static = store_params.strategy & SaveStrategy::SkipStatic;
         m_split_model = store_params.strategy & SaveStrategy::SplitModel;
         m_save_gcode = store_params.strategy & SaveStrategy::WithGcode;
+        m_save_gcode_result = store_params.strategy & SaveStrategy::WithGcodeResult;
         m_skip_model  = store_params.strategy & SaveStrategy::SkipModel;
         m_skip_auxiliary = store_params.strategy & SaveStrategy::SkipAuxiliary;
         m_share_mesh       = store_params.strategy & SaveStrategy::ShareMesh;
         m_from_backup_save = store_params.strategy & SaveStrategy::Backup;
+        m_model_compression = m_from_backup_save ? MZ_BEST_SPEED : MZ_DEFAULT_COMPRESSION;
 
         m_use_loaded_id = store_params.strategy & SaveStrategy::UseLoadedId;
 
@@ -5653,6 +5724,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
     {
         m_production_ext = true;
         m_from_backup_save = true;
+        m_model_compression = MZ_BEST_SPEED;
         Model const & model = *object.get_model();
 
         mz_zip_archive archive;
@@ -5810,11 +5882,32 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                     return false;
             }
 
+            // Deflating the PNGs is the expensive part, encode all of them in parallel first,
+            // then add the encoded images to the archive sequentially.
+            std::vector<ThumbnailPng> thumbnail_pngs(thumbnail_data.size());
+            std::vector<ThumbnailPng> no_light_thumbnail_pngs(no_light_thumbnail_data.size());
+            std::vector<ThumbnailPng> top_thumbnail_pngs(top_thumbnail_data.size());
+            std::vector<ThumbnailPng> pick_thumbnail_pngs(pick_thumbnail_data.size());
+            std::vector<std::tuple<const ThumbnailData*, bool, ThumbnailPng*>> thumbnails_to_encode;
+            auto collect_thumbnails = [&thumbnails_to_encode](const std::vector<ThumbnailData*>& thumbnails, std::vector<ThumbnailPng>& pngs, bool generate_small_thumbnail) {
+                for (size_t index = 0; index < thumbnails.size(); ++index)
+                    if (thumbnails[index]->is_valid())
+                        thumbnails_to_encode.emplace_back(thumbnails[index], generate_small_thumbnail, &pngs[index]);
+            };
+            collect_thumbnails(thumbnail_data, thumbnail_pngs, true);
+            collect_thumbnails(no_light_thumbnail_data, no_light_thumbnail_pngs, false);
+            collect_thumbnails(top_thumbnail_data, top_thumbnail_pngs, false);
+            collect_thumbnails(pick_thumbnail_data, pick_thumbnail_pngs, false);
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, thumbnails_to_encode.size(), 1), [&thumbnails_to_encode](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i < range.end(); ++i)
+                    _encode_thumbnail_png(*std::get<0>(thumbnails_to_encode[i]), std::get<1>(thumbnails_to_encode[i]), *std::get<2>(thumbnails_to_encode[i]));
+            });
+
             for (unsigned int index = 0; index < thumbnail_data.size(); index++)
             {
                 if (thumbnail_data[index]->is_valid())
                 {
-                    if (!_add_thumbnail_file_to_archive(archive, *thumbnail_data[index], "Metadata/plate", index, true)) {
+                    if (!_add_thumbnail_file_to_archive(archive, thumbnail_pngs[index], "Metadata/plate", index)) {
                         return false;
                     }
 
@@ -5825,7 +5918,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 
             for (unsigned int index = 0; index < no_light_thumbnail_data.size(); index++) {
                 if (no_light_thumbnail_data[index]->is_valid()) {
-                    if (!_add_thumbnail_file_to_archive(archive, *no_light_thumbnail_data[index], "Metadata/plate_no_light", index)) {
+                    if (!_add_thumbnail_file_to_archive(archive, no_light_thumbnail_pngs[index], "Metadata/plate_no_light", index)) {
                         return false;
                     }
 
@@ -5839,7 +5932,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                 if (top_thumbnail_data[index]->is_valid())
                 {
                     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(",add top thumbnail %1%'s data into 3mf")%(index+1);
-                    if (!_add_thumbnail_file_to_archive(archive, *top_thumbnail_data[index], "Metadata/top", index)) {
+                    if (!_add_thumbnail_file_to_archive(archive, top_thumbnail_pngs[index], "Metadata/top", index)) {
                         return false;
                     }
                     top_thumbnail_status[index] = true;
@@ -5848,7 +5941,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                 if (pick_thumbnail_data[index]->is_valid())
                 {
                     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(",add pick thumbnail %1%'s data into 3mf")%(index+1);
-                    if (!_add_thumbnail_file_to_archive(archive, *pick_thumbnail_data[index], "Metadata/pick", index)) {
+                    if (!_add_thumbnail_file_to_archive(archive, pick_thumbnail_pngs[index], "Metadata/pick", index)) {
                         return false;
                     }
                     pick_thumbnail_status[index] = true;
@@ -6215,24 +6308,17 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         return true;
     }
 
-    bool _BBS_3MF_Exporter::_add_thumbnail_file_to_archive(mz_zip_archive& archive, const ThumbnailData& thumbnail_data, const char* local_path, int index, bool generate_small_thumbnail)
+    void _BBS_3MF_Exporter::_encode_thumbnail_png(const ThumbnailData& thumbnail_data, bool generate_small_thumbnail, ThumbnailPng& out)
     {
-        bool res = false;
-
         size_t png_size = 0;
         void* png_data = tdefl_write_image_to_png_file_in_memory_ex((const void*)thumbnail_data.pixels.data(), thumbnail_data.width, thumbnail_data.height, 4, &png_size, MZ_DEFAULT_COMPRESSION, 1);
         if (png_data != nullptr) {
-            std::string thumbnail_name = (boost::format("%1%_%2%.png")%local_path % (index + 1)).str();
-            res = mz_zip_writer_add_mem(&archive, thumbnail_name.c_str(), (const void*)png_data, png_size, MZ_NO_COMPRESSION);
+            out.png.assign((const char*)png_data, png_size);
             mz_free(png_data);
         }
 
-        if (!res) {
-            add_error("Unable to add thumbnail file to archive");
-            BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add thumbnail file to archive\n");
-        }
-
         if (generate_small_thumbnail && thumbnail_data.is_valid()) {
+            out.has_small = true;
             //generate small size of thumbnail
             std::vector<unsigned char> small_pixels;
             small_pixels.resize(PLATE_THUMBNAIL_SMALL_WIDTH * PLATE_THUMBNAIL_SMALL_HEIGHT * 4);
@@ -6266,11 +6352,33 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             }
             size_t small_png_size = 0;
             void* small_png_data = tdefl_write_image_to_png_file_in_memory_ex((const void*)small_pixels.data(), PLATE_THUMBNAIL_SMALL_WIDTH, PLATE_THUMBNAIL_SMALL_HEIGHT, 4, &small_png_size, MZ_DEFAULT_COMPRESSION, 1);
-            if (png_data != nullptr) {
-                std::string thumbnail_name = (boost::format("%1%_%2%_small.png") % local_path % (index + 1)).str();
-                res = mz_zip_writer_add_mem(&archive, thumbnail_name.c_str(), (const void*)small_png_data, small_png_size, MZ_NO_COMPRESSION);
+            if (small_png_data != nullptr) {
+                out.small_png.assign((const char*)small_png_data, small_png_size);
                 mz_free(small_png_data);
             }
+        }
+    }
+
+    bool _BBS_3MF_Exporter::_add_thumbnail_file_to_archive(mz_zip_archive& archive, const ThumbnailPng& thumbnail_png, const char* local_path, int index)
+    {
+        bool res = false;
+
+        if (!thumbnail_png.png.empty()) {
+            std::string thumbnail_name = (boost::format("%1%_%2%.png")%local_path % (index + 1)).str();
+            res = mz_zip_writer_add_mem(&archive, thumbnail_name.c_str(), (const void*)thumbnail_png.png.data(), thumbnail_png.png.size(), MZ_NO_COMPRESSION);
+        }
+
+        if (!res) {
+            add_error("Unable to add thumbnail file to archive");
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add thumbnail file to archive\n");
+        }
+
+        if (thumbnail_png.has_small) {
+            res = false;
+            if (!thumbnail_png.small_png.empty()) {
+                std::string thumbnail_name = (boost::format("%1%_%2%_small.png") % local_path % (index + 1)).str();
+                res = mz_zip_writer_add_mem(&archive, thumbnail_name.c_str(), (const void*)thumbnail_png.small_png.data(), thumbnail_png.small_png.size(), MZ_NO_COMPRESSION);
+            }
 
             if (!res) {
                 add_error("Unable to add small thumbnail file to archive");
@@ -6433,7 +6541,7 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 #if WRITE_ZIP_LANGUAGE_ENCODING
             nullptr, nullptr, 0, MZ_DEFAULT_LEVEL, nullptr, 0, nullptr, 0)) {
 #else
-            nullptr, nullptr, 0, MZ_DEFAULT_COMPRESSION, extra.c_str(), extra.length(), extra.c_str(), extra.length())) {
+            nullptr, nullptr, 0, m_model_compression, extra.c_str(), extra.length(), extra.c_str(), extra.length())) {
 #endif
             add_error("Unable to add model file to archive");
             BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add model file to archive\n");
@@ -8003,6 +8111,18 @@ bool _BBS_3MF_Exporter::_add_gcode_file_to_archive(mz_zip_archive& archive, cons
                     mz_zip_writer_add_staged_data(&context, buf.data(), ifs.gcount());
                 }
                 mz_zip_writer_add_staged_finish(&context);
+
+                // BBS: the processed G-code, so that reopening the project does not parse the G-code again. Not sent to the printers.
+                // Opt-in, as the moves are stored raw and take several times the size of the compressed G-code.
+                const std::string src_result_file = src_gcode_file + GCodeResultCache::FILE_EXTENSION;
+                boost::system::error_code ec;
+                if (m_save_gcode_result && !m_skip_model && boost::filesystem::exists(src_result_file, ec)) {
+                    std::string result_data;
+                    boost::filesystem::load_string_file(src_result_file, result_data);
+                    std::string result_in_3mf = gcode_in_3mf + GCodeResultCache::FILE_EXTENSION;
+                    if (!mz_zip_writer_add_mem(&archive, result_in_3mf.c_str(), (const void *) result_data.data(), result_data.size(), MZ_DEFAULT_COMPRESSION))
+                        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << ":" << __LINE__ << boost::format(", store %1% to 3mf failed\n") % result_in_3mf;
+                }
             }
             void *ppBuf; size_t pSize;
             mz_zip_writer_finalize_heap_archive(&archive, &ppBuf, &pSize);
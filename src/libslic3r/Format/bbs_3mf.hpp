@@ -133,6 +133,8 @@ enum class SaveStrategy
     SkipAuxiliary       = 1 << 9,
     UseLoadedId         = 1 << 10,
     ShareMesh           = 1 << 11,
+    // with WithGcode, also store the processed G-code (GCodeResultCache) next to the G-code of the plates
+    WithGcodeResult     = 1 << 13,
 
     SplitModel = 0x1000 | ProductionExt,
     Encrypted  = SecureContentExt | SplitModel,
@@ -8,8 +8,21 @@
 
 #include "libslic3r/LocalesUtils.hpp"
 
+#include <fast_float/fast_float.h>
+
 namespace ObjParser {
 #define EATWS()  while (*line == ' ' || *line == '\t') ++line
+
+// Drop-in replacement of strtod() based on fast_float, an OBJ file is mostly made of numbers.
+static double obj_strtod(const char *line, char **endptr)
+{
+	const char *begin = (*line == '+') ? line + 1 : line;
+	double      value = 0.;
+	auto [ptr, ec] = fast_float::from_chars(begin, begin + strlen(begin), value);
+	*endptr = const_cast<char*>(ec == std::errc::invalid_argument ? line : ptr);
+	return value;
+}
+
 static bool obj_parseline(const char *line, ObjData &data)
 {
 	if (*line == 0)
@@ -38,14 +51,14 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double u = strtod(line, &endptr);
+			double u = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
 			double v = 0;
 			if (*line != 0) {
-				v = strtod(line, &endptr);
+				v = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -53,7 +66,7 @@ static bool obj_parseline(const char *line, ObjData &data)
 			}
 			/*double w = 0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -75,17 +88,17 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double x = strtod(line, &endptr);
+			double x = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double y = strtod(line, &endptr);
+			double y = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double z = strtod(line, &endptr);
+			double z = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
@@ -105,19 +118,19 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double u = strtod(line, &endptr);
+			double u = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
-			double v = strtod(line, &endptr);
+			double v = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
 			double w = 0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -137,17 +150,17 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double x = strtod(line, &endptr);
+			double x = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double y = strtod(line, &endptr);
+			double y = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double z = strtod(line, &endptr);
+			double z = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
@@ -157,24 +170,24 @@ static bool obj_parseline(const char *line, ObjData &data)
                 if (!data.has_vertex_color) {
                     data.has_vertex_color = true;
                 }
-                color_x = strtod(line, &endptr);
+                color_x = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
                     return false;
                 line = endptr;
                 EATWS();
-                color_y = strtod(line, &endptr);
+                color_y = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
                      return false;
                 line = endptr;
                 EATWS();
-                color_z = strtod(line, &endptr);
+                color_z = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
                     return false;
                 line = endptr;
                 EATWS();
                 color_w = 1.0;//default define alpha = 1.0
                 if (*line != 0) {
-                    color_w = strtod(line, &endptr);
+                    color_w = obj_strtod(line, &endptr);
                     if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0)) return false;
                     line = endptr;
                     EATWS();
@@ -409,14 +422,14 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             if (cur_char == 's') {
                 EATWS();
                 char * endptr = 0;
-                double ns     = strtod(line, &endptr);
+                double ns     = obj_strtod(line, &endptr);
                 if (data.new_mtl_unmap.find(cur_mtl_name) != data.new_mtl_unmap.end()) {
 					data.new_mtl_unmap[cur_mtl_name]->Ns = (float) ns;
 				}
             } else if (cur_char == 'i') {
                 EATWS();
                 char * endptr = 0;
-                double ni    = strtod(line, &endptr);
+                double ni    = obj_strtod(line, &endptr);
                 if (data.new_mtl_unmap.find(cur_mtl_name) != data.new_mtl_unmap.end()) {
 					data.new_mtl_unmap[cur_mtl_name]->Ni = (float) ni;
 				}
@@ -428,15 +441,15 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             if (cur_char == 'a') {
                 EATWS();
                 char * endptr = 0;
-                double x      = strtod(line, &endptr);
+                double x      = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double y = strtod(line, &endptr);
+                double y = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double z = strtod(line, &endptr);
+                double z = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0)) return false;
                 line = endptr;
                 EATWS();
@@ -448,15 +461,15 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             } else if (cur_char == 'd') {
                 EATWS();
                 char * endptr = 0;
-                double x      = strtod(line, &endptr);
+                double x      = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double y = strtod(line, &endptr);
+                double y = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double z = strtod(line, &endptr);
+                double z = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0)) return false;
                 line = endptr;
                 EATWS();
@@ -468,15 +481,15 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             } else if (cur_char == 's') {
                 EATWS();
                 char * endptr = 0;
-                double x      = strtod(line, &endptr);
+                double x      = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double y = strtod(line, &endptr);
+                double y = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double z = strtod(line, &endptr);
+                double z = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0)) return false;
                 line = endptr;
                 EATWS();
@@ -488,15 +501,15 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             } else if (cur_char == 'e') {
                 EATWS();
                 char * endptr = 0;
-                double x      = strtod(line, &endptr);
+                double x      = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double y = strtod(line, &endptr);
+                double y = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double z = strtod(line, &endptr);
+                double z = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0)) return false;
                 line = endptr;
                 EATWS();
@@ -513,7 +526,7 @@ static bool        mtl_parseline(const char *line, MtlData &data)
 				return false;
             EATWS();
             char * endptr = 0;
-            double illum  = strtod(line, &endptr);
+            double illum  = obj_strtod(line, &endptr);
             if (data.new_mtl_unmap.find(cur_mtl_name) != data.new_mtl_unmap.end()) {
 				data.new_mtl_unmap[cur_mtl_name]->illum = (float) illum;
 			}
@@ -522,7 +535,7 @@ static bool        mtl_parseline(const char *line, MtlData &data)
         case 'd': {
             EATWS();
             char * endptr = 0;
-            double d  = strtod(line, &endptr);
+            double d  = obj_strtod(line, &endptr);
             if (data.new_mtl_unmap.find(cur_mtl_name) != data.new_mtl_unmap.end()) {
 				data.new_mtl_unmap[cur_mtl_name]->d = (float) d;
 			}
@@ -533,7 +546,7 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             if (cur_char == 'r') {
                 EATWS();
                 char * endptr = 0;
-                double tr     = strtod(line, &endptr);
+                double tr     = obj_strtod(line, &endptr);
                 if (data.new_mtl_unmap.find(cur_mtl_name) != data.new_mtl_unmap.end()) {
                     data.new_mtl_unmap[cur_mtl_name]->Tr = (float) tr;
                 }
@@ -541,15 +554,15 @@ static bool        mtl_parseline(const char *line, MtlData &data)
             } else if (cur_char == 'f') {
                 EATWS();
                 char * endptr = 0;
-                double x      = strtod(line, &endptr);
+                double x      = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double y = strtod(line, &endptr);
+                double y = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t')) return false;
                 line = endptr;
                 EATWS();
-                double z = strtod(line, &endptr);
+                double z = obj_strtod(line, &endptr);
                 if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0)) return false;
                 line = endptr;
                 EATWS();
@@ -53,7 +53,7 @@
     using slic3r_tbb_filtermode = tbb::filter;
 #endif
 
-#include <Shiny/Shiny.h>
+#include "Profiler.hpp"
 
 #include "miniz_extension.hpp"
 
@@ -1544,7 +1544,10 @@ void GCode::do_export(Print* print, const char* path, GCodeProcessorResult* resu
             m_print->get_physical_unprintable_filaments(m_print->get_slice_used_filaments(false)));
     }
 
-    m_processor.finalize(true);
+    {
+        SlicingProfiler::Scope profile(print->slicing_profiler(), "gcode_processor_finalize");
+        m_processor.finalize(true);
+    }
 //    DoExport::update_print_estimated_times_stats(m_processor, print->m_print_statistics);
     DoExport::update_print_estimated_stats(m_processor, m_writer.extruders(), print->m_print_statistics);
     if (result != nullptr) {
@@ -1574,6 +1577,7 @@ void GCode::do_export(Print* print, const char* path, GCodeProcessorResult* resu
     // Write the profiler measurements to file
     PROFILE_UPDATE();
     PROFILE_OUTPUT(debug_out_path("gcode-export-profile.txt").c_str());
+    PROFILE_OUTPUT_TRACE(debug_out_path("gcode-export-profile.trace.json").c_str());
 }
 
 // free functions called by GCode::_do_export()
@@ -2825,8 +2829,10 @@ void GCode::process_layers(
     std::vector<GCode::LayerResult> layers_results;
     layers_results.resize(layers_to_print.size());
 
+    GCodePipelineTracker tracker(this->pipeline_tokens(print, layers_to_print.size()));
+
     // The pipeline is variable: The vase mode filter is optional.
-    const auto generator = tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+    const auto generator = tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.source("generate",
         [this, &print, &tool_ordering, &print_object_instances_ordering, &layers_to_print, &layer_to_print_idx](tbb::flow_control& fc) -> GCode::LayerResult {
             if (layer_to_print_idx == layers_to_print.size()) {
                 fc.stop();
@@ -2844,60 +2850,60 @@ void GCode::process_layers(
                 res.gcode_store_pos = layer_to_print_idx - 1;
                 return std::move(res);
             }
-        });
+        }, [&layers_to_print, &layer_to_print_idx]() { return layer_to_print_idx == layers_to_print.size(); }));
     if (m_spiral_vase) {
         float nozzle_diameter  = EXTRUDER_CONFIG(nozzle_diameter);
         float max_xy_smoothing = m_config.get_abs_value("spiral_mode_max_xy_smoothing", nozzle_diameter);
         this->m_spiral_vase->set_max_xy_smoothing(max_xy_smoothing);
     }
     const auto spiral_mode = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(
-        slic3r_tbb_filtermode::serial_in_order, [&spiral_mode = *this->m_spiral_vase.get(), & layers_to_print](GCode::LayerResult in) -> GCode::LayerResult {
+        slic3r_tbb_filtermode::serial_in_order, tracker.stage("spiral_vase", [&spiral_mode = *this->m_spiral_vase.get(), & layers_to_print](GCode::LayerResult in) -> GCode::LayerResult {
             spiral_mode.enable(in.spiral_vase_enable);
             bool last_layer = in.layer_id == layers_to_print.size() - 1;
             return {spiral_mode.process_layer(std::move(in.gcode), last_layer), in.layer_id, in.spiral_vase_enable, in.cooling_buffer_flush, in.gcode_store_pos};
-        });
+        }));
 
     std::vector<std::vector<PerExtruderAdjustments>> layers_extruder_adjustments(layers_to_print.size());
 
-    const auto parsing = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+    const auto parsing = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("parse",
     [&gcode_editer = *this->m_gcode_editer.get(), &layers_extruder_adjustments, object_label](GCode::LayerResult in) -> GCode::LayerResult{
         //record gcode
         in.gcode = gcode_editer.process_layer(std::move(in.gcode), in.layer_id, layers_extruder_adjustments[in.gcode_store_pos], object_label, in.cooling_buffer_flush, false);
          return std::move(in);
-    });
+    }));
 
     //step2: cooling
     std::vector<std::vector<OutwallCollection>> layers_wall_collection(layers_to_print.size());
 
     CoolingBuffer cooling_processor;
 
-    const auto cooling = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+    const auto cooling = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("cooling",
     [&cooling_processor, &layers_extruder_adjustments](GCode::LayerResult in) -> GCode::LayerResult {
         in.layer_time = cooling_processor.calculate_layer_slowdown(layers_extruder_adjustments[in.gcode_store_pos]);
          return std::move(in);
-    });
+    }));
 
     // step 4.1: record node date
     SmoothCalculator smooth_calculator(object_label.size());
 
-    const auto build_node = tbb::make_filter<GCode::LayerResult, void>(slic3r_tbb_filtermode::serial_in_order,
+    const auto build_node = tbb::make_filter<GCode::LayerResult, void>(slic3r_tbb_filtermode::serial_in_order, tracker.sink("build_node",
     [&smooth_calculator, &layers_wall_collection, &layers_extruder_adjustments, object_label, &layers_results](GCode::LayerResult in){
          smooth_calculator.build_node(layers_wall_collection[in.gcode_store_pos], object_label, layers_extruder_adjustments[in.gcode_store_pos]);
          layers_results[in.gcode_store_pos] = std::move(in);
          return;
-    });
+    }, [](const GCode::LayerResult &in) { return in.gcode.size(); }));
 
     // step 5: rewite
-    const auto write_gocde= tbb::make_filter<GCode::LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    const auto write_gocde= tbb::make_filter<GCode::LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("write_gcode",
     [&gcode_editer = *this->m_gcode_editer.get(), &layers_extruder_adjustments](GCode::LayerResult in) -> std::string {
          return gcode_editer.write_layer_gcode(std::move(in.gcode), in.layer_id, in.layer_time, layers_extruder_adjustments[in.gcode_store_pos]);
-    });
+    }));
 
     std::vector<GCode::LayerResult> gcode_res;
 
     // BBS: apply new feedrate of outwall and recalculate layer time
     int layer_idx = 0;
-     const auto calculate_layer_time= tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, [&layer_idx, &smooth_calculator, &layers_extruder_adjustments, &gcode_res](tbb::flow_control& fc) -> GCode::LayerResult {
+     const auto calculate_layer_time= tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.source("calculate_layer_time", [&layer_idx, &smooth_calculator, &layers_extruder_adjustments, &gcode_res](tbb::flow_control& fc) -> GCode::LayerResult {
          if(layer_idx == gcode_res.size()){
             fc.stop();
             return{};
@@ -2907,20 +2913,24 @@ void GCode::process_layers(
              }
              return gcode_res[layer_idx++];
         }
-        });
+        }, [&layer_idx, &gcode_res]() { return size_t(layer_idx) == gcode_res.size(); }));
 
 
-    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
-    [&output_stream](std::string s) { output_stream.write(s); });
+    // BBS: the G-code processor analyses a layer in memory while the previous one is being written.
+    const auto analyze = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("analyze",
+    [&output_stream](std::string s) -> std::string { output_stream.analyze(s); return s; }));
+
+    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order, tracker.sink("output",
+    [&output_stream](std::string s) { output_stream.write_analyzed(s); }, [](const std::string &s) { return s.size(); }));
 
     // BBS: apply cooling
     // The pipeline elements are joined using const references, thus no copying is performed.
     if (m_spiral_vase)
-        tbb::parallel_pipeline(12, generator & spiral_mode & parsing & cooling & write_gocde & output);
+        tbb::parallel_pipeline(tracker.max_tokens(), generator & spiral_mode & parsing & cooling & write_gocde & analyze & output);
     else if (!m_config.z_direction_outwall_speed_continuous)
-        tbb::parallel_pipeline(12, generator & parsing & cooling & write_gocde & output);
+        tbb::parallel_pipeline(tracker.max_tokens(), generator & parsing & cooling & write_gocde & analyze & output);
     else {
-        tbb::parallel_pipeline(12, generator & parsing & cooling & build_node);
+        tbb::parallel_pipeline(tracker.max_tokens(), generator & parsing & cooling & build_node);
         std::string message;
         message = _L("Smoothing z direction speed");
         m_print->set_status(85, message);
@@ -2936,8 +2946,9 @@ void GCode::process_layers(
         smooth_calculator.smooth_layer_speed();
         message = _L("Exporting G-code");
         m_print->set_status(90, message);
-        tbb::parallel_pipeline(12, calculate_layer_time & write_gocde & output);
+        tbb::parallel_pipeline(tracker.max_tokens(), calculate_layer_time & write_gocde & analyze & output);
     }
+    this->pipeline_finished(tracker);
 }
 
 // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
@@ -2965,9 +2976,11 @@ void GCode::process_layers(
     std::vector<GCode::LayerResult> layers_results;
     layers_results.resize(layers_to_print.size());
 
+    GCodePipelineTracker tracker(this->pipeline_tokens(print, layers_to_print.size()));
+
     //step 1: generator
     // The pipeline is variable: The vase mode filter is optional.
-    const auto generator = tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+    const auto generator = tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.source("generate",
         [this, &print, &tool_ordering, &layers_to_print, &layer_to_print_idx, single_object_idx, prime_extruder](tbb::flow_control& fc) -> GCode::LayerResult {
             if (layer_to_print_idx == layers_to_print.size()) {
                 fc.stop();
@@ -2982,18 +2995,18 @@ void GCode::process_layers(
                 res.gcode_store_pos = layer_to_print_idx - 1;
                 return std::move(res);
             }
-        });
+        }, [&layers_to_print, &layer_to_print_idx]() { return layer_to_print_idx == layers_to_print.size(); }));
     if (m_spiral_vase) {
         float nozzle_diameter  = EXTRUDER_CONFIG(nozzle_diameter);
         float max_xy_smoothing = m_config.get_abs_value("spiral_mode_max_xy_smoothing", nozzle_diameter);
         this->m_spiral_vase->set_max_xy_smoothing(max_xy_smoothing);
     }
     const auto spiral_mode = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(
-        slic3r_tbb_filtermode::serial_in_order, [&spiral_mode = *this->m_spiral_vase.get(), &layers_to_print](GCode::LayerResult in) -> GCode::LayerResult {
+        slic3r_tbb_filtermode::serial_in_order, tracker.stage("spiral_vase", [&spiral_mode = *this->m_spiral_vase.get(), &layers_to_print](GCode::LayerResult in) -> GCode::LayerResult {
             spiral_mode.enable(in.spiral_vase_enable);
             bool last_layer = in.layer_id == layers_to_print.size() - 1;
             return {spiral_mode.process_layer(std::move(in.gcode), last_layer), in.layer_id, in.spiral_vase_enable, in.cooling_buffer_flush, in.gcode_store_pos};
-        });
+        }));
 
     //BBS: get objects and nodes info, for better arrange
     const ConstPrintObjectPtrsAdaptor &objects = print.objects();
@@ -3001,45 +3014,45 @@ void GCode::process_layers(
     // step 2: parse
     std::vector<std::vector<PerExtruderAdjustments>> layers_extruder_adjustments(layers_to_print.size());
 
-    const auto parsing = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+    const auto parsing = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("parse",
     [&gcode_editer = *this->m_gcode_editer.get(), &layers_extruder_adjustments, object_label](GCode::LayerResult in) -> GCode::LayerResult{
         //record gcode
         in.gcode = gcode_editer.process_layer(std::move(in.gcode), in.layer_id, layers_extruder_adjustments[in.gcode_store_pos], object_label, in.cooling_buffer_flush, false);
          return std::move(in);
-    });
+    }));
 
     // step 3: cooling
     std::vector<std::vector<OutwallCollection>> layers_wall_collection(layers_to_print.size());
     CoolingBuffer cooling_processor;
 
-    const auto cooling = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+    const auto cooling = tbb::make_filter<GCode::LayerResult, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("cooling",
     [&cooling_processor, &layers_extruder_adjustments](GCode::LayerResult in) -> GCode::LayerResult {
         in.layer_time = cooling_processor.calculate_layer_slowdown(layers_extruder_adjustments[in.gcode_store_pos]);
          return std::move(in);
-    });
+    }));
 
     // step 4.1: record node date
     SmoothCalculator smooth_calculator(object_label.size());
 
-    const auto build_node = tbb::make_filter<GCode::LayerResult, void>(slic3r_tbb_filtermode::serial_in_order,
+    const auto build_node = tbb::make_filter<GCode::LayerResult, void>(slic3r_tbb_filtermode::serial_in_order, tracker.sink("build_node",
     [&smooth_calculator, &layers_wall_collection, &layers_extruder_adjustments, object_label, &layers_results](GCode::LayerResult in){
          smooth_calculator.build_node(layers_wall_collection[in.gcode_store_pos], object_label, layers_extruder_adjustments[in.gcode_store_pos]);
          layers_results[in.gcode_store_pos] = std::move(in);
          return;
-    });
+    }, [](const GCode::LayerResult &in) { return in.gcode.size(); }));
 
     // step 5: rewite
-    const auto write_gocde= tbb::make_filter<GCode::LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    const auto write_gocde= tbb::make_filter<GCode::LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("write_gcode",
     [&gcode_editer = *this->m_gcode_editer.get(), &layers_extruder_adjustments](GCode::LayerResult in) -> std::string {
          return gcode_editer.write_layer_gcode(std::move(in.gcode), in.layer_id, in.layer_time, layers_extruder_adjustments[in.gcode_store_pos]);
-    });
+    }));
 
     std::vector<GCode::LayerResult> gcode_res;
 
      // BBS: apply new feedrate of outwall and recalculate layer time
      int layer_idx = 0;
      //restart pipeline
-     const auto calculate_layer_time = tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, [&layer_idx, &gcode_res, &smooth_calculator, &layers_extruder_adjustments](tbb::flow_control& fc) -> GCode::LayerResult {
+     const auto calculate_layer_time = tbb::make_filter<void, GCode::LayerResult>(slic3r_tbb_filtermode::serial_in_order, tracker.source("calculate_layer_time", [&layer_idx, &gcode_res, &smooth_calculator, &layers_extruder_adjustments](tbb::flow_control& fc) -> GCode::LayerResult {
          if(layer_idx == gcode_res.size()){
             fc.stop();
             return{};
@@ -3049,20 +3062,24 @@ void GCode::process_layers(
              }
              return gcode_res[layer_idx++];
         }
-        });
+        }, [&layer_idx, &gcode_res]() { return size_t(layer_idx) == gcode_res.size(); }));
 
 
-    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
-    [&output_stream](std::string s) { output_stream.write(s); });
+    // BBS: the G-code processor analyses a layer in memory while the previous one is being written.
+    const auto analyze = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("analyze",
+    [&output_stream](std::string s) -> std::string { output_stream.analyze(s); return s; }));
+
+    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order, tracker.sink("output",
+    [&output_stream](std::string s) { output_stream.write_analyzed(s); }, [](const std::string &s) { return s.size(); }));
 
     // BBS: apply cooling
     // The pipeline elements are joined using const references, thus no copying is performed.
     if (m_spiral_vase)
-        tbb::parallel_pipeline(12, generator & spiral_mode & parsing & cooling & write_gocde & output);
+        tbb::parallel_pipeline(tracker.max_tokens(), generator & spiral_mode & parsing & cooling & write_gocde & analyze & output);
     else if (!m_config.z_direction_outwall_speed_continuous)
-        tbb::parallel_pipeline(12, generator & parsing & cooling & write_gocde & output);
+        tbb::parallel_pipeline(tracker.max_tokens(), generator & parsing & cooling & write_gocde & analyze & output);
     else {
-        tbb::parallel_pipeline(12, generator & parsing & cooling & build_node);
+        tbb::parallel_pipeline(tracker.max_tokens(), generator & parsing & cooling & build_node);
         // step 4.2: smoothing
         // break pipeline and do z smoothing
         // append data
@@ -3076,8 +3093,24 @@ void GCode::process_layers(
 
         smooth_calculator.smooth_layer_speed();
 
-        tbb::parallel_pipeline(12, calculate_layer_time & write_gocde & output);
+        tbb::parallel_pipeline(tracker.max_tokens(), calculate_layer_time & write_gocde & analyze & output);
     }
+    this->pipeline_finished(tracker);
+}
+
+size_t GCode::pipeline_tokens(const Print &print, size_t num_layers) const
+{
+    return gcode_pipeline_tokens(print.gcode_pipeline_tokens(), print.gcode_pipeline_memory_budget(), m_pipeline_layer_bytes, num_layers);
+}
+
+void GCode::pipeline_finished(const GCodePipelineTracker &tracker)
+{
+    GCodePipelineStats stats = tracker.stats();
+    // The G-code of the next objects (sequential mode) is expected to be of a similar size.
+    if (stats.layers > 0)
+        m_pipeline_layer_bytes = stats.average_layer_bytes();
+    BOOST_LOG_TRIVIAL(info) << "G-code export pipeline: " << stats.to_string();
+    m_pipeline_stats.emplace_back(std::move(stats));
 }
 
 std::string GCode::placeholder_parser_process(const std::string &name, const std::string &templ, unsigned int current_filament_id, const DynamicConfig *config_override)
@@ -4964,8 +4997,15 @@ std::string GCode::extrude_infill(const Print &print, const std::vector<ObjectBy
                 for (const ExtrusionEntity *fill : extrusions) {
                     auto *eec = dynamic_cast<const ExtrusionEntityCollection*>(fill);
                     if (eec) {
-                        for (ExtrusionEntity *ee : eec->chained_path_from(m_last_pos).entities)
-                            gcode += this->extrude_entity(*ee, extrusion_name);
+                        // Don't clone the whole collection just to order it, copy only the entities to be extruded reversed.
+                        for (const std::pair<const ExtrusionEntity*, bool> &ee : eec->chained_order_from(m_last_pos)) {
+                            if (ee.second) {
+                                std::unique_ptr<ExtrusionEntity> reversed(ee.first->clone());
+                                reversed->reverse();
+                                gcode += this->extrude_entity(*reversed, extrusion_name);
+                            } else
+                                gcode += this->extrude_entity(*ee.first, extrusion_name);
+                        }
                     } else
                         gcode += this->extrude_entity(*fill, extrusion_name);
                 }
@@ -5017,33 +5057,47 @@ std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fill
 
 bool GCode::GCodeOutputStream::is_error() const
 {
-    return ::ferror(this->f);
+    return m_file.is_error();
 }
 
 void GCode::GCodeOutputStream::flush()
 {
-    ::fflush(this->f);
+    m_file.flush();
 }
 
 void GCode::GCodeOutputStream::close()
 {
-    if (this->f) {
-        ::fclose(this->f);
-        this->f = nullptr;
-    }
+    m_file.close();
 }
 
 void GCode::GCodeOutputStream::write(const char *what)
 {
-    if (what != nullptr) {
-        const char* gcode = what;
+    if (what != nullptr)
+        this->write(what, ::strlen(what));
+}
+
+void GCode::GCodeOutputStream::write(const char *what, size_t len)
+{
+    if (len > 0) {
         // writes string to file
-        fwrite(gcode, 1, ::strlen(gcode), this->f);
-        //FIXME don't allocate a string, maybe process a batch of lines?
-        m_processor.process_buffer(std::string(gcode));
+        m_file.write(what, len);
+        // BBS: the G-code is parsed in place, no copy of the layer.
+        m_processor.process_buffer(what, what + len);
     }
 }
 
+void GCode::GCodeOutputStream::analyze(const std::string &what)
+{
+    if (! what.empty())
+        m_processor.process_buffer(what.c_str(), what.c_str() + what.size());
+}
+
+void GCode::GCodeOutputStream::write_analyzed(const std::string &what)
+{
+    if (! what.empty())
+        m_file.write(what.c_str(), what.size());
+}
+
 void GCode::GCodeOutputStream::writeln(const std::string &what)
 {
     if (! what.empty())
@@ -5597,14 +5651,18 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
             sloped != nullptr) {
             double path_length  = 0.;
             double total_length = sloped == nullptr ? 0. : path.polyline.length() * SCALING_FACTOR;
-            for (const Line &line : path.polyline.lines()) {
+            // Walk the points directly, the path is extruded once per instance, don't allocate its lines each time.
+            const Points &points = path.polyline.points;
+            for (size_t point_idx = 1; point_idx < points.size(); ++ point_idx) {
+                const Line   line(points[point_idx - 1], points[point_idx]);
                 const double line_length = line.length() * SCALING_FACTOR;
                 // BBS: extursion cmd should E0 on cmd line
                 if (line_length < EPSILON) continue;
                 path_length += line_length;
 
                 if (sloped == nullptr) {
-                    gcode += m_writer.extrude_to_xy(
+                    m_writer.extrude_to_xy(
+                        gcode,
                         this->point_to_gcode(line.b),
                         e_per_mm * line_length,
                         comment);
@@ -5636,7 +5694,8 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
                         if (line_length < EPSILON)
                             continue;
                         path_length += line_length;
-                        gcode += m_writer.extrude_to_xy(
+                        m_writer.extrude_to_xy(
+                            gcode,
                             this->point_to_gcode(line.b),
                             e_per_mm * line_length,
                             comment, path.is_force_no_extrusion());
@@ -5652,7 +5711,8 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
                         continue;
                     const Vec2d center_offset = this->point_to_gcode(arc.center) - this->point_to_gcode(arc.start_point);
                     path_length += arc_length;
-                    gcode += m_writer.extrude_arc_to_xy(
+                    m_writer.extrude_arc_to_xy(
+                            gcode,
                             this->point_to_gcode(arc.end_point),
                             center_offset,
                             e_per_mm * arc_length,
@@ -5793,7 +5853,7 @@ std::string GCode::travel_to(const Point &point, ExtrusionRole role, std::string
         if (m_spiral_vase) {
             // No lazy z lift for spiral vase mode
             for (size_t i = 1; i < travel.size(); ++i)
-                gcode += m_writer.travel_to_xy(this->point_to_gcode(travel.points[i]), comment);
+                m_writer.travel_to_xy(gcode, this->point_to_gcode(travel.points[i]), comment);
         } else {
             if (travel.size() == 2) {
                 // No extra movements emitted by avoid_crossing_perimeters, simply move to the end point with z change
@@ -5816,7 +5876,7 @@ std::string GCode::travel_to(const Point &point, ExtrusionRole role, std::string
                         gcode += m_writer.travel_to_xyz(dest3d, comment);
                     } else {
                         // For all points in between, no z change
-                        gcode += m_writer.travel_to_xy(this->point_to_gcode(travel.points[i]), comment );
+                        m_writer.travel_to_xy(gcode, this->point_to_gcode(travel.points[i]), comment );
                     }
                 }
             }
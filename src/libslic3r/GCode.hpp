@@ -16,6 +16,8 @@
 #include "GCode/WipeTower.hpp"
 #include "GCode/SeamPlacer.hpp"
 #include "GCode/GCodeProcessor.hpp"
+#include "GCode/GCodeFileWriter.hpp"
+#include "GCode/PipelineStats.hpp"
 #include "EdgeGrid.hpp"
 #include "GCode/ThumbnailData.hpp"
 #include "libslic3r/ObjectID.hpp"
@@ -186,6 +188,8 @@ public:
     // throws CanceledException through print->throw_if_canceled().
     void            do_export(Print* print, const char* path, GCodeProcessorResult* result = nullptr, ThumbnailsGeneratorCallback thumbnail_cb = nullptr);
     void            export_layer_filaments(GCodeProcessorResult* result);
+    // Counters of the layer pipelines of the last do_export(), one per process_layers() pass.
+    const std::vector<GCodePipelineStats>& pipeline_stats() const { return m_pipeline_stats; }
     //BBS: set offset for gcode writer
     void set_gcode_offset(double x, double y) { m_writer.set_xy_offset(x, y); m_processor.set_xy_offset(x, y);}
 
@@ -272,18 +276,26 @@ public:
 private:
     class GCodeOutputStream {
     public:
-        GCodeOutputStream(FILE *f, GCodeProcessor &processor) : f(f), m_processor(processor) {}
+        // BBS: async_flush writes the large chunks of G-code on a background thread.
+        GCodeOutputStream(FILE *f, GCodeProcessor &processor, bool async_flush = true) : m_file(f, async_flush), m_processor(processor) {}
         ~GCodeOutputStream() { this->close(); }
 
-        bool is_open() const { return f; }
+        bool is_open() const { return m_file.is_open(); }
         bool is_error() const;
 
         void flush();
         void close();
 
         // Write a string into a file.
-        void write(const std::string& what) { this->write(what.c_str()); }
+        void write(const std::string& what) { this->write(what.c_str(), what.size()); }
         void write(const char* what);
+        // what[len] has to be a zero or a new line for the G-code processor.
+        void write(const char* what, size_t len);
+        // BBS: split write() for the layer pipeline, analyze() feeds the G-code processor in memory,
+        // write_analyzed() stores the same G-code. Both have to be called in the same order of the layers,
+        // they may run concurrently on different layers.
+        void analyze(const std::string& what);
+        void write_analyzed(const std::string& what);
 
         // Write a string into a file.
         // Add a newline, if the string does not end with a newline already.
@@ -294,7 +306,7 @@ private:
         void write_format(const char* format, ...);
 
     private:
-        FILE *f = nullptr;
+        GCodeFileWriter m_file;
         GCodeProcessor &m_processor;
     };
     void            _do_export(Print &print, GCodeOutputStream &file, ThumbnailsGeneratorCallback thumbnail_cb);
@@ -374,6 +386,9 @@ private:
         GCodeOutputStream                       &output_stream,
         // BBS
         const bool                               prime_extruder = false);
+    // Layers in flight for the pipeline of process_layers().
+    size_t pipeline_tokens(const Print &print, size_t num_layers) const;
+    void   pipeline_finished(const GCodePipelineTracker &tracker);
 
     //BBS
     void check_placeholder_parser_failed();
@@ -528,6 +543,9 @@ private:
     bool                                m_last_scarf_seam_flag;
     std::unique_ptr<GCodeEditor>        m_gcode_editer;
     std::unique_ptr<SpiralVase>         m_spiral_vase;
+    // Average size of the G-code of a layer exported by the last process_layers(), 0 before the first one.
+    size_t                              m_pipeline_layer_bytes{ 0 };
+    std::vector<GCodePipelineStats>     m_pipeline_stats;
 #ifdef HAS_PRESSURE_EQUALIZER
     std::unique_ptr<PressureEqualizer>  m_pressure_equalizer;
 #endif /* HAS_PRESSURE_EQUALIZER */
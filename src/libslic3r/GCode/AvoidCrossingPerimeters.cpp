@@ -668,6 +668,21 @@ static size_t avoid_perimeters(const AvoidCrossingPerimeters::Boundary &boundary
     return num_intersections;
 }
 
+// Plans the travel only once for the same clipped travel line over the same boundary and with the same perimeter spacing.
+// called by AvoidCrossingPerimeters::travel_to()
+static size_t avoid_perimeters_cached(AvoidCrossingPerimeters::Boundary &boundary,
+                                      const Point                       &start,
+                                      const Point                       &end,
+                                      const Layer                       &layer,
+                                      Polyline                          &result_out)
+{
+    auto [it, inserted] = boundary.travels.try_emplace(AvoidCrossingPerimeters::Boundary::TravelKey{ start, end, get_perimeter_spacing(layer) });
+    if (inserted)
+        it->second.intersection_count = avoid_perimeters(boundary, start, end, layer, it->second.polyline);
+    result_out = it->second.polyline;
+    return it->second.intersection_count;
+}
+
 // Check if anyone of ExPolygons contains whole travel.
 // called by need_wipe() and AvoidCrossingPerimeters::travel_to()
 // FIXME Lukas H.: Maybe similar approach could also be used for ExPolygon::contains()
@@ -1168,18 +1183,20 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
       
         // Trim the travel line by the bounding box.
         if (!m_internal.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_internal.bbox)) {
-            travel_intersection_count = avoid_perimeters(m_internal, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
+            travel_intersection_count = avoid_perimeters_cached(m_internal, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
             result_pl.points.front()  = start;
             result_pl.points.back()   = end;
         }
     } else if(use_external) {
         // Initialize m_external only when exist any external travel for the current layer.
-        if (m_external.boundaries.empty())
+        if (m_external.boundaries.empty()) {
             init_boundary(&m_external, get_boundary_external(*gcodegen.layer()));
+            m_external_perimeter_spacing = get_perimeter_spacing_external(*gcodegen.layer());
+        }
 
         // Trim the travel line by the bounding box.
         if (!m_external.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_external.bbox)) {
-            travel_intersection_count = avoid_perimeters(m_external, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
+            travel_intersection_count = avoid_perimeters_cached(m_external, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
             result_pl.points.front()  = start;
             result_pl.points.back()   = end;
         }
@@ -1220,8 +1237,20 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
 
 void AvoidCrossingPerimeters::init_layer(const Layer &layer)
 {
+    if (&layer == m_layer)
+        // Another instance of the same object or another extruder on the same layer, keep the boundaries and the planned travels.
+        return;
+    m_layer = &layer;
     m_internal.clear();
-    m_external.clear();
+
+    // The external boundary is shared by all objects printed at the same height.
+    bool support_layer = dynamic_cast<const SupportLayer *>(&layer) != nullptr;
+    if (std::abs(layer.print_z - m_external_print_z) > EPSILON || support_layer != m_external_support_layer ||
+        (! m_external.boundaries.empty() && get_perimeter_spacing_external(layer) != m_external_perimeter_spacing)) {
+        m_external.clear();
+        m_external_print_z       = layer.print_z;
+        m_external_support_layer = support_layer;
+    }
 
     BoundingBox bbox_slice(get_extents(layer.lslices));
     bbox_slice.offset(SCALED_EPSILON);
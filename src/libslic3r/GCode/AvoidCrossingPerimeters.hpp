@@ -5,6 +5,8 @@
 #include "../ExPolygon.hpp"
 #include "../EdgeGrid.hpp"
 
+#include <unordered_map>
+
 namespace Slic3r {
 
 // Forward declarations.
@@ -43,10 +45,31 @@ public:
         // Used for detection of intersection between line and any polygon from boundaries
         EdgeGrid::Grid                  grid;
 
+        // Travels planned over these boundaries and their number of intersections with the boundaries, keyed by the clipped travel line.
+        // Instances of an object share their travels in the object's coordinate system, thus the detours are only planned once.
+        // The planning depends on the perimeter spacing of the object being printed, which is part of the key, as the external
+        // boundary is shared by all the objects printed at the same height.
+        struct Travel {
+            Polyline                    polyline;
+            size_t                      intersection_count;
+        };
+        struct TravelKey {
+            Point                       start;
+            Point                       end;
+            float                       perimeter_spacing;
+            bool operator==(const TravelKey &rhs) const { return start == rhs.start && end == rhs.end && perimeter_spacing == rhs.perimeter_spacing; }
+        };
+        struct TravelHash {
+            size_t operator()(const TravelKey &travel) const
+                { return (PointHash{}(travel.start) * 31 ^ PointHash{}(travel.end)) * 31 ^ std::hash<float>{}(travel.perimeter_spacing); }
+        };
+        std::unordered_map<TravelKey, Travel, TravelHash> travels;
+
         void clear()
         {
             boundaries.clear();
             boundaries_params.clear();
+            travels.clear();
         }
     };
 
@@ -58,6 +81,14 @@ private:
     // we enable it by default for the first travel move in print
     bool           m_disabled_once { true };
 
+    // Layer of the last init_layer(). The boundaries are kept when the same layer is initialized again,
+    // for example for the next instance of an object or after a tool change.
+    const Layer   *m_layer { nullptr };
+    // Key of m_external, which only depends on the print_z and not on the object being printed.
+    double         m_external_print_z { -1. };
+    bool           m_external_support_layer { false };
+    float          m_external_perimeter_spacing { 0.f };
+
     // Used for detection of line or polyline is inside of any polygon.
     EdgeGrid::Grid m_grid_lslice;
     // Store all needed data for travels inside object
@@ -3,6 +3,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/concurrent_vector.h>
 
+#include <algorithm>
 #include <map>
 #include <functional>
 #include <atomic>
@@ -142,6 +143,18 @@ LineWithIDs LinesBucketQueue::getCurLines() const
     return lines;
 }
 
+std::vector<LinesBucketRange> LinesBucketQueue::getCurRanges() const
+{
+    std::vector<LinesBucketRange> ranges;
+    for (const LinesBucket &bucket : line_buckets) {
+        if (bucket.valid()) {
+            auto [b, e] = bucket.curRange();
+            ranges.push_back({ &bucket, b, e });
+        }
+    }
+    return ranges;
+}
+
 void getExtrusionPathsFromEntity(const ExtrusionEntityCollection *entity, ExtrusionPaths &paths)
 {
     std::function<void(const ExtrusionEntityCollection *, ExtrusionPaths &)> getExtrusionPathImpl = [&](const ExtrusionEntityCollection *entity, ExtrusionPaths &paths) {
@@ -203,19 +216,65 @@ ObjectExtrusions getAllLayersExtrusionPathsFromObject(PrintObject *obj)
 ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines)
 {
     using namespace RasterizationImpl;
-    std::map<IndexPair, std::vector<int>> indexToLine;
-
-    for (int i = 0; i < lines.size(); ++i) {
-        const LineWithID &l1      = lines[i];
-        auto              indexes = line_rasterization(l1._line);
-        for (auto index : indexes) {
-            const auto &possibleIntersectIdxs = indexToLine[index];
-            for (auto possibleIntersectIdx : possibleIntersectIdxs) {
-                const LineWithID &l2 = lines[possibleIntersectIdx];
-                if (auto interRes = line_intersect(l1, l2); interRes.has_value()) { return interRes; }
+
+    // Lines of two objects may only intersect inside the overlap of the bounding boxes of the two objects.
+    // Objects of a plate rarely overlap, thus most of the layers are resolved here without rasterizing a single line.
+    std::vector<std::pair<const void*, BoundingBox>> id_bboxes;
+    std::vector<int>                                 line_id_idx(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const LineWithID &l = lines[i];
+        // Lines of a single object are stored next to each other.
+        int idx = id_bboxes.empty() || id_bboxes.back().first != l._id ?
+            int(std::find_if(id_bboxes.begin(), id_bboxes.end(), [&l](const auto &v) { return v.first == l._id; }) - id_bboxes.begin()) :
+            int(id_bboxes.size()) - 1;
+        if (idx == int(id_bboxes.size()))
+            id_bboxes.emplace_back(l._id, BoundingBox());
+        id_bboxes[idx].second.merge(l._line.a);
+        id_bboxes[idx].second.merge(l._line.b);
+        line_id_idx[i] = idx;
+    }
+    std::vector<std::vector<BoundingBox>> id_overlaps(id_bboxes.size());
+    bool                                  any_overlap = false;
+    for (size_t i = 0; i < id_bboxes.size(); ++i)
+        for (size_t j = i + 1; j < id_bboxes.size(); ++j)
+            if (const BoundingBox &bb1 = id_bboxes[i].second, &bb2 = id_bboxes[j].second; bb1.overlap(bb2)) {
+                BoundingBox overlap(Point(std::max(bb1.min.x(), bb2.min.x()), std::max(bb1.min.y(), bb2.min.y())),
+                                    Point(std::min(bb1.max.x(), bb2.max.x()), std::min(bb1.max.y(), bb2.max.y())));
+                id_overlaps[i].emplace_back(overlap);
+                id_overlaps[j].emplace_back(overlap);
+                any_overlap = true;
             }
-            indexToLine[index].push_back(i);
-        }
+    if (! any_overlap)
+        return {};
+
+    // Rasterize the lines touching an overlap, sort them by grid cell and check only the lines of different objects sharing a cell.
+    struct CellLine
+    {
+        IndexPair cell;
+        int       id_idx;
+        int       line_idx;
+        bool operator<(const CellLine &rhs) const { return cell < rhs.cell || (cell == rhs.cell && id_idx < rhs.id_idx); }
+    };
+    std::vector<CellLine> cell_lines;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const Line       &line = lines[i]._line;
+        const BoundingBox bbox(Point(std::min(line.a.x(), line.b.x()), std::min(line.a.y(), line.b.y())),
+                               Point(std::max(line.a.x(), line.b.x()), std::max(line.a.y(), line.b.y())));
+        const std::vector<BoundingBox> &overlaps = id_overlaps[line_id_idx[i]];
+        if (std::any_of(overlaps.begin(), overlaps.end(), [&bbox](const BoundingBox &overlap) { return overlap.overlap(bbox); }))
+            for (const IndexPair &cell : line_rasterization(line))
+                cell_lines.push_back({ cell, line_id_idx[i], int(i) });
+    }
+    std::sort(cell_lines.begin(), cell_lines.end());
+
+    for (auto cell_begin = cell_lines.begin(); cell_begin != cell_lines.end();) {
+        auto cell_end = std::find_if(cell_begin, cell_lines.end(), [cell = cell_begin->cell](const CellLine &cl) { return cl.cell != cell; });
+        // Lines of the cell are sorted by object, compare each line with the lines of the objects following it.
+        for (auto it1 = cell_begin; it1 != cell_end; ++it1)
+            for (auto it2 = std::upper_bound(it1, cell_end, *it1, [](const CellLine &l, const CellLine &r) { return l.id_idx < r.id_idx; }); it2 != cell_end; ++it2)
+                if (auto interRes = line_intersect(lines[it1->line_idx], lines[it2->line_idx]); interRes.has_value())
+                    return interRes;
+        cell_begin = cell_end;
     }
     return {};
 }
@@ -245,32 +304,38 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(PrintObjectP
         conflictQueue.emplace_back_bucket(std::move(layers.support), obj, obj->instances().front().shift);
     }
 
-    std::vector<LineWithIDs> layersLines;
-    std::vector<float>       bottomZs;
+    // Only remember the piles of each height band, their lines are extracted by the parallel workers.
+    std::vector<std::vector<LinesBucketRange>> layersRanges;
+    std::vector<float>                         bottomZs;
     while (conflictQueue.valid()) {
-        LineWithIDs lines = conflictQueue.getCurLines();
+        std::vector<LinesBucketRange> ranges = conflictQueue.getCurRanges();
         float curBottomZ = conflictQueue.getCurrBottomZ();
         bottomZs.push_back(curBottomZ);
-        layersLines.push_back(std::move(lines));
+        layersRanges.push_back(std::move(ranges));
     }
 
-    bool                                                          find = false;
-    tbb::concurrent_vector<std::pair<ConflictComputeResult, float>> conflict;
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, layersLines.size()), [&](tbb::blocked_range<size_t> range) {
-        for (size_t i = range.begin(); i < range.end(); i++) {
-            auto interRes = find_inter_of_lines(layersLines[i]);
-            if (interRes.has_value()) {
-                find = true;
-                conflict.emplace_back(interRes.value(), bottomZs[i]);
+    // The lowest conflict is reported, the height bands above an already found conflict are skipped.
+    std::atomic<size_t>             conflictLayer(layersRanges.size());
+    std::vector<ConflictComputeOpt> conflicts(layersRanges.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, layersRanges.size()), [&](tbb::blocked_range<size_t> range) {
+        for (size_t i = range.begin(); i < range.end() && i < conflictLayer.load(std::memory_order_relaxed); i++) {
+            LineWithIDs lines;
+            // A height band with lines of a single object has nothing to check.
+            if (! layersRanges[i].empty() && std::any_of(layersRanges[i].begin(), layersRanges[i].end(), [id = layersRanges[i].front().bucket->_id](const LinesBucketRange &r) { return r.bucket->_id != id; }))
+                for (const LinesBucketRange &r : layersRanges[i])
+                    append(lines, r.bucket->lines(r.begin, r.end));
+            if (auto interRes = find_inter_of_lines(lines); interRes.has_value()) {
+                conflicts[i] = interRes;
+                for (size_t prev = conflictLayer.load(); i < prev && ! conflictLayer.compare_exchange_weak(prev, i);) ;
                 break;
             }
         }
     });
 
-    if (find) {
-        const void *ptr1           = conflict[0].first._obj1;
-        const void *ptr2           = conflict[0].first._obj2;
-        float       conflictPrintZ = conflict[0].second;
+    if (size_t layer = conflictLayer.load(); layer < layersRanges.size()) {
+        const void *ptr1           = conflicts[layer]->_obj1;
+        const void *ptr2           = conflicts[layer]->_obj2;
+        float       conflictPrintZ = bottomZs[layer];
         if (wtdptr.has_value()) {
             const FakeWipeTower *wtdp = wtdptr.value();
             if (ptr1 == wtdp || ptr2 == wtdp) {
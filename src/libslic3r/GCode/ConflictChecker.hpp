@@ -83,6 +83,11 @@ public:
     LineWithIDs curLines() const
     {
         auto [b, e] = curRange();
+        return lines(b, e);
+    }
+    // Lines of the piles [b, e), shifted by the offset of the bucket.
+    LineWithIDs lines(int b, int e) const
+    {
         LineWithIDs lines;
         for (int i = b; i < e; ++i) {
             for (const ExtrusionPath &path : _piles[i].paths) {
@@ -107,6 +112,14 @@ struct LinesBucketPtrComp
     bool operator()(const LinesBucket *left, const LinesBucket *right) { return *left > *right; }
 };
 
+// Piles [begin, end) of a LinesBucket at a single bottom z.
+struct LinesBucketRange
+{
+    const LinesBucket *bucket;
+    int                begin;
+    int                end;
+};
+
 class LinesBucketQueue
 {
 public:
@@ -118,6 +131,8 @@ public:
     bool        valid() const { return line_bucket_ptr_queue.empty() == false; }
     float       getCurrBottomZ();
     LineWithIDs getCurLines() const;
+    // Like getCurLines(), but the lines are extracted later by LinesBucket::lines(), so that each layer may be processed in parallel.
+    std::vector<LinesBucketRange> getCurRanges() const;
 };
 
 void getExtrusionPathsFromEntity(const ExtrusionEntityCollection *entity, ExtrusionPaths &paths);
@@ -4,6 +4,7 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/log/trivial.hpp>
 #include <iostream>
+#include <string_view>
 #include <float.h>
 
 #if 0
@@ -87,7 +88,8 @@ std::string GCodeEditor::process_layer(std::string &&                       gcod
         // and one object layer.
         // record parse gcode info to per_extruder_adjustments
         per_extruder_adjustments = this->parse_layer_gcode(m_gcode, m_current_pos, object_label, spiral_vase, layer_id > 0);
-        out = m_gcode;
+        // The parsed lines refer to the G-code by offsets, thus the buffer may be handed over as it is.
+        out = std::move(m_gcode);
         m_gcode.clear();
     }
     return out;
@@ -131,12 +133,15 @@ std::vector<PerExtruderAdjustments> GCodeEditor::parse_layer_gcode(
     bool not_join_cooling = false;
     std::pair<int, int> node_pos;
     int line_idx = -1;
+    // Reused for all the lines of the layer to avoid an allocation per line.
+    std::string        sline;
+    std::vector<float> new_pos;
     for (; *line_start != 0; line_start = line_end)
     {
         while (*line_end != '\n' && *line_end != 0)
             ++ line_end;
         // sline will not contain the trailing '\n'.
-        std::string sline(line_start, line_end);
+        sline.assign(line_start, line_end);
         // CoolingLine will contain the trailing '\n'.
         if (*line_end == '\n')
             ++ line_end;
@@ -163,7 +168,7 @@ std::vector<PerExtruderAdjustments> GCodeEditor::parse_layer_gcode(
         if (line.type) {
             // G0, G1 or G92
             // Parse the G-code line.
-            std::vector<float> new_pos(current_pos);
+            new_pos = current_pos;
             const char *c = sline.data() + 3;
             for (;;) {
                 // Skip whitespaces.
@@ -192,14 +197,17 @@ std::vector<PerExtruderAdjustments> GCodeEditor::parse_layer_gcode(
                 // Skip this word.
                 for (; *c != ' ' && *c != '\t' && *c != 0; ++ c);
             }
-            bool external_perimeter = boost::contains(sline, ";_EXTERNAL_PERIMETER");
-            bool wipe               = boost::contains(sline, ";_WIPE");
+            // The cooling markers are part of the comment, which may directly follow the last word ("G1 F1800;_EXTRUDE_SET_SPEED").
+            const size_t           comment_start = sline.find(';');
+            const std::string_view comment = comment_start == std::string::npos ? std::string_view() : std::string_view(sline).substr(comment_start);
+            bool external_perimeter = comment.find(";_EXTERNAL_PERIMETER") != std::string_view::npos;
+            bool wipe               = comment.find(";_WIPE") != std::string_view::npos;
 
             record_wall_lines(append_inner_wall_ptr, line_idx, adjustment, node_pos);
 
             if (wipe)
                 line.type |= CoolingLine::TYPE_WIPE;
-            if (boost::contains(sline, ";_EXTRUDE_SET_SPEED") && !wipe && !not_join_cooling) {
+            if (comment.find(";_EXTRUDE_SET_SPEED") != std::string_view::npos && !wipe && !not_join_cooling) {
                 line.type |= CoolingLine::TYPE_ADJUSTABLE;
                 active_speed_modifier = adjustment->lines.size();
             }
@@ -278,7 +286,7 @@ std::vector<PerExtruderAdjustments> GCodeEditor::parse_layer_gcode(
                     line.type = 0;
                 }
             }
-            current_pos = std::move(new_pos);
+            current_pos.swap(new_pos);
         } else if (boost::starts_with(sline, "; Slow Down Start")) {
             not_join_cooling = true;
         } else if (boost::starts_with(sline, "; Slow Down End")) {
@@ -451,6 +459,8 @@ std::string GCodeEditor::write_layer_gcode(
     //BBS: start the fan earlier for overhangs
     float cumulative_time = 0.f;
     float search_time     = 0.f;
+    // Comment of the current line with the cooling markers removed, reused over the lines.
+    std::string comment;
 
     for (int i = 0,j = 0; i < lines.size(); i++) {
         const CoolingLine *line = lines[i];
@@ -585,7 +595,7 @@ std::string GCodeEditor::write_layer_gcode(
             if (end < line_end) {
                 if (line->type & (CoolingLine::TYPE_ADJUSTABLE | CoolingLine::TYPE_EXTERNAL_PERIMETER | CoolingLine::TYPE_WIPE)) {
                     // Process comments, remove ";_EXTRUDE_SET_SPEED", ";_EXTERNAL_PERIMETER", ";_WIPE"
-                    std::string comment(end, line_end);
+                    comment.assign(end, line_end);
                     boost::replace_all(comment, ";_EXTRUDE_SET_SPEED", "");
                     if (line->type & CoolingLine::TYPE_EXTERNAL_PERIMETER)
                         boost::replace_all(comment, ";_EXTERNAL_PERIMETER", "");
@@ -0,0 +1,139 @@
+#include "GCodeFileWriter.hpp"
+
+#include "../Thread.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <boost/log/trivial.hpp>
+
+namespace Slic3r {
+
+GCodeFileWriter::GCodeFileWriter(FILE *f, bool async, size_t chunk_size, size_t max_chunks) :
+    m_file(f), m_chunk_size(std::max<size_t>(chunk_size, 1)), m_max_chunks(std::max<size_t>(max_chunks, 2))
+{
+    if (m_file == nullptr)
+        return;
+    // The chunks are already large, stdio buffering would only add a copy.
+    ::setvbuf(m_file, nullptr, _IONBF, 0);
+    m_chunk.reserve(m_chunk_size);
+    m_num_chunks = 1;
+    if (async) {
+        try {
+            m_thread = create_thread([this]() { this->thread_proc(); });
+        } catch (const std::exception &ex) {
+            BOOST_LOG_TRIVIAL(warning) << "GCodeFileWriter: failed to start the writer thread, writing synchronously: " << ex.what();
+        }
+    }
+}
+
+bool GCodeFileWriter::is_error() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_error || (m_file != nullptr && ::ferror(m_file));
+}
+
+void GCodeFileWriter::write(const char *data, size_t len)
+{
+    assert(m_file != nullptr);
+    m_bytes_written += len;
+    while (len > 0) {
+        size_t n = std::min(len, m_chunk_size - m_chunk.size());
+        m_chunk.append(data, n);
+        data += n;
+        len  -= n;
+        if (m_chunk.size() >= m_chunk_size)
+            this->submit_chunk();
+    }
+}
+
+void GCodeFileWriter::write_chunk(const std::string &chunk)
+{
+    if (::fwrite(chunk.data(), 1, chunk.size(), m_file) != chunk.size()) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = true;
+    }
+}
+
+void GCodeFileWriter::submit_chunk()
+{
+    if (m_chunk.empty())
+        return;
+    if (! this->is_async()) {
+        this->write_chunk(m_chunk);
+        m_chunk.clear();
+        return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_queue.emplace_back(std::move(m_chunk));
+    m_cond_work.notify_one();
+    if (m_free.empty() && m_num_chunks < m_max_chunks)
+        ++ m_num_chunks;
+    else {
+        // All the chunks are taken, wait for the background thread to return one.
+        m_cond_done.wait(lock, [this]() { return ! m_free.empty(); });
+    }
+    if (m_free.empty())
+        m_chunk = std::string();
+    else {
+        m_chunk = std::move(m_free.back());
+        m_free.pop_back();
+    }
+    m_chunk.clear();
+    m_chunk.reserve(m_chunk_size);
+}
+
+void GCodeFileWriter::thread_proc()
+{
+    set_current_thread_name("bbl_gcode_writer");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_cond_work.wait(lock, [this]() { return m_stop || ! m_queue.empty(); });
+        if (m_queue.empty())
+            break;
+        std::string chunk = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_writing = true;
+        lock.unlock();
+        bool failed = ::fwrite(chunk.data(), 1, chunk.size(), m_file) != chunk.size();
+        chunk.clear();
+        lock.lock();
+        m_error |= failed;
+        m_writing = false;
+        m_free.emplace_back(std::move(chunk));
+        m_cond_done.notify_all();
+    }
+}
+
+void GCodeFileWriter::flush()
+{
+    if (m_file == nullptr)
+        return;
+    this->submit_chunk();
+    if (this->is_async()) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond_done.wait(lock, [this]() { return m_queue.empty() && ! m_writing; });
+    }
+    ::fflush(m_file);
+}
+
+void GCodeFileWriter::close()
+{
+    if (m_file == nullptr)
+        return;
+    this->flush();
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond_work.notify_one();
+        m_thread.join();
+    }
+    ::fclose(m_file);
+    m_file = nullptr;
+    std::vector<std::string>().swap(m_free);
+    std::string().swap(m_chunk);
+}
+
+} // namespace Slic3r
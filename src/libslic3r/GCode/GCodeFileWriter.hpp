@@ -0,0 +1,72 @@
+#ifndef slic3r_GCode_GCodeFileWriter_hpp_
+#define slic3r_GCode_GCodeFileWriter_hpp_
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+namespace Slic3r {
+
+// BBS: collects the exported G-code into large chunks and writes them to the file, optionally on a background
+// thread, so that the G-code generator does not wait for the disk. The chunks are recycled, thus the memory
+// used is bounded by max_chunks * chunk_size whatever the size of the G-code.
+class GCodeFileWriter
+{
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+    static constexpr size_t DEFAULT_MAX_CHUNKS = 4;
+
+    // Takes the ownership of the file, which is closed by close().
+    GCodeFileWriter(FILE *f, bool async, size_t chunk_size = DEFAULT_CHUNK_SIZE, size_t max_chunks = DEFAULT_MAX_CHUNKS);
+    ~GCodeFileWriter() { this->close(); }
+    GCodeFileWriter(const GCodeFileWriter&) = delete;
+    GCodeFileWriter& operator=(const GCodeFileWriter&) = delete;
+
+    bool is_open() const { return m_file != nullptr; }
+    bool is_async() const { return m_thread.joinable(); }
+    // Writing of any of the chunks failed. Only reliable after flush().
+    bool is_error() const;
+
+    void write(const char *data, size_t len);
+    // Write out the pending chunks and wait for the background thread to finish them.
+    void flush();
+    void close();
+
+    // Number of bytes passed to write() since the file was opened.
+    size_t bytes_written() const { return m_bytes_written; }
+
+private:
+    void submit_chunk();
+    void write_chunk(const std::string &chunk);
+    void thread_proc();
+
+    FILE                       *m_file { nullptr };
+    size_t                      m_chunk_size;
+    size_t                      m_max_chunks;
+    size_t                      m_bytes_written { 0 };
+    // Chunk being filled by write().
+    std::string                 m_chunk;
+
+    boost::thread               m_thread;
+    mutable std::mutex          m_mutex;
+    std::condition_variable     m_cond_work;
+    std::condition_variable     m_cond_done;
+    // Chunks waiting for the background thread.
+    std::deque<std::string>     m_queue;
+    // Written chunks to be reused, their capacity is kept.
+    std::vector<std::string>    m_free;
+    // Number of chunks allocated, either queued, being written, free or being filled.
+    size_t                      m_num_chunks { 0 };
+    bool                        m_writing { false };
+    bool                        m_stop { false };
+    bool                        m_error { false };
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_GCode_GCodeFileWriter_hpp_
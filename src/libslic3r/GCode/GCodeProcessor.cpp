@@ -363,6 +363,16 @@ void planner_reverse_pass_kernel(GCodeProcessor::TimeBlock& curr, GCodeProcessor
     }
 }
 
+// Calculates the trapezoid of the block for the given exit feedrate, leaving the stored exit feedrate untouched.
+// Cheaper than calculating the trapezoid on a copy of the whole block.
+static void calculate_trapezoid_with_exit(GCodeProcessor::TimeBlock& block, float exit_feedrate)
+{
+    const float exit = block.feedrate_profile.exit;
+    block.feedrate_profile.exit = exit_feedrate;
+    block.calculate_trapezoid();
+    block.feedrate_profile.exit = exit;
+}
+
 static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& blocks)
 {
     GCodeProcessor::TimeBlock* curr = nullptr;
@@ -378,10 +388,7 @@ static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& block
             // Recalculate if current block entry or exit junction speed has changed.
             if (curr->flags.recalculate || next->flags.recalculate) {
                 // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-                GCodeProcessor::TimeBlock block = *curr;
-                block.feedrate_profile.exit = next->feedrate_profile.entry;
-                block.calculate_trapezoid();
-                curr->trapezoid = block.trapezoid;
+                calculate_trapezoid_with_exit(*curr, next->feedrate_profile.entry);
                 curr->flags.recalculate = false; // Reset current only to ensure next trapezoid is computed
             }
         }
@@ -389,10 +396,7 @@ static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& block
 
     // Last/newest block in buffer. Always recalculated.
     if (next != nullptr) {
-        GCodeProcessor::TimeBlock block = *next;
-        block.feedrate_profile.exit = next->safe_feedrate;
-        block.calculate_trapezoid();
-        next->trapezoid = block.trapezoid;
+        calculate_trapezoid_with_exit(*next, next->safe_feedrate);
         next->flags.recalculate = false;
     }
 }
@@ -424,6 +428,8 @@ void GCodeProcessor::TimeMachine::calculate_time(size_t keep_last_n_blocks, floa
 
     size_t n_blocks_process = blocks.size() - keep_last_n_blocks;
     bool found_target_block = false;
+    // The blocks are ordered by their G1 line, thus the stop time placeholders are searched from the last one found on.
+    auto it_stop_time_first = stop_times.begin();
     for (size_t i = 0; i < n_blocks_process; ++i) {
         const TimeBlock& block = blocks[i];
         float block_time = block.time();
@@ -458,8 +464,9 @@ void GCodeProcessor::TimeMachine::calculate_time(size_t keep_last_n_blocks, floa
         else
             g1_times_cache.push_back({ block.g1_line_id, time });
         // update times for remaining time to printer stop placeholders
-        auto it_stop_time = std::lower_bound(stop_times.begin(), stop_times.end(), block.g1_line_id,
+        auto it_stop_time = std::lower_bound(it_stop_time_first, stop_times.end(), block.g1_line_id,
             [](const StopTime& t, unsigned int value) { return t.g1_line_id < value; });
+        it_stop_time_first = it_stop_time;
         if (it_stop_time != stop_times.end() && it_stop_time->g1_line_id == block.g1_line_id)
             it_stop_time->elapsed_time = time;
     }
@@ -880,7 +887,8 @@ void GCodeProcessor::TimeProcessor::post_process(const std::string& filename, st
         return true;
     };
 
-    constexpr int buffer_size_in_KB = 64;
+    // BBS: large blocks, the post processing of huge G-codes is dominated by the number of read / write calls.
+    constexpr int buffer_size_in_KB = 1024;
     std::vector<FilamentUsageBlock> filament_blocks;
     std::vector<ExtruderUsageBlcok> extruder_blocks = { ExtruderUsageBlcok() }; // the first use of extruder will not generate nozzle change tag, so manually add a dummy block
     std::vector<std::pair<unsigned int, unsigned int>> offsets;
@@ -1339,6 +1347,7 @@ void GCodeProcessorResult::reset() {
     lock();
 
     moves = std::vector<GCodeProcessorResult::MoveVertex>();
+    arc_interpolation_points = std::vector<Vec3f>();
     printable_area = Pointfs();
     //BBS: add bed exclude area
     bed_exclude_area = Pointfs();
@@ -1366,6 +1375,7 @@ void GCodeProcessorResult::reset() {
     lock();
 
     moves.clear();
+    arc_interpolation_points.clear();
     lines_ends.clear();
     printable_area = Pointfs();
     //BBS: add bed exclude area
@@ -1587,8 +1597,8 @@ bool GCodeProcessor::check_multi_extruder_gcode_valid(const std::vector<Polygons
     for (const GCodeProcessorResult::MoveVertex &move : m_result.moves) {
         if (move.type == EMoveType::Extrude/* || move.type == EMoveType::Travel*/) {
             if (move.is_arc_move_with_interpolation_points()) {
-                for (int i = 0; i < move.interpolation_points.size(); i++) {
-                    gcode_path_pos[move.object_label_id][int(move.extruder_id)].pos.emplace_back(to_2d(move.interpolation_points[i].cast<double>()));
+                for (const Vec3f &point : m_result.interpolation_points(move)) {
+                    gcode_path_pos[move.object_label_id][int(move.extruder_id)].pos.emplace_back(to_2d(point.cast<double>()));
                 }
             }
             else {
@@ -2268,7 +2278,8 @@ void GCodeProcessor::process_file(const std::string& filename, std::function<voi
     // 1st move must be a dummy move
     m_result.moves.emplace_back(GCodeProcessorResult::MoveVertex());
     size_t parse_line_callback_cntr = 10000;
-    m_parser.parse_file(filename, [this, cancel_callback, &parse_line_callback_cntr](GCodeReader& reader, const GCodeReader::GCodeLine& line) {
+    // The lines are tokenized in parallel, the moves are processed in order as they depend on the state of the previous lines.
+    m_parser.parse_file_parallel(filename, [this, cancel_callback, &parse_line_callback_cntr](GCodeReader& reader, const GCodeReader::GCodeLine& line) {
         if (-- parse_line_callback_cntr == 0) {
             // Don't call the cancel_callback() too often, do it every at every 10000'th line.
             parse_line_callback_cntr = 10000;
@@ -2298,9 +2309,14 @@ void GCodeProcessor::initialize(const std::string& filename)
 }
 
 void GCodeProcessor::process_buffer(const std::string &buffer)
+{
+    this->process_buffer(buffer.c_str(), buffer.c_str() + buffer.size());
+}
+
+void GCodeProcessor::process_buffer(const char *begin, const char *end)
 {
     //FIXME maybe cache GCodeLine gline to be over multiple parse_buffer() invocations.
-    m_parser.parse_buffer(buffer, [this](GCodeReader&, const GCodeReader::GCodeLine& line) {
+    m_parser.parse_buffer(begin, end, [this](GCodeReader&, const GCodeReader::GCodeLine& line) {
         this->process_gcode_line(line, false);
     });
 }
@@ -5477,14 +5493,18 @@ void GCodeProcessor::store_move_vertex(EMoveType type, EMovePathType path_type)
         ((type == EMoveType::Seam) ? m_last_line_id : m_line_id);
 
     //BBS: apply plate's and extruder's offset to arc interpolation points
+    uint32_t interpolation_points_offset = 0;
+    uint32_t interpolation_points_count  = 0;
     if (path_type == EMovePathType::Arc_move_cw ||
         path_type == EMovePathType::Arc_move_ccw) {
+        interpolation_points_offset = uint32_t(m_result.arc_interpolation_points.size());
+        interpolation_points_count  = uint32_t(m_interpolation_points.size());
         for (size_t i = 0; i < m_interpolation_points.size(); i++)
-            m_interpolation_points[i] =
+            m_result.arc_interpolation_points.emplace_back(
                 Vec3f(m_interpolation_points[i].x() + m_x_offset,
                       m_interpolation_points[i].y() + m_y_offset,
                       m_processing_start_custom_gcode ? m_first_layer_height : m_interpolation_points[i].z()) +
-                m_extruder_offsets[filament_id];
+                m_extruder_offsets[filament_id]);
     }
 
     m_result.moves.push_back({
@@ -5506,8 +5526,8 @@ void GCodeProcessor::store_move_vertex(EMoveType type, EMovePathType path_type)
         {0.f,0.f}, // prefix sum of move time to this move : set later
         //BBS: add plate's offset to the rendering vertices
         Vec3f(m_end_position[X] + m_x_offset, m_end_position[Y] + m_y_offset, m_processing_start_custom_gcode ? m_first_layer_height : m_end_position[Z]) + m_extruder_offsets[filament_id],
-        Vec3f(m_arc_center(0, 0) + m_x_offset, m_arc_center(1, 0) + m_y_offset, m_arc_center(2, 0)) + m_extruder_offsets[filament_id],
-        m_interpolation_points,
+        interpolation_points_offset,
+        interpolation_points_count,
         m_object_label_id,
         m_print_z
     });
@@ -207,21 +207,35 @@ namespace Slic3r {
             std::array<float, 2>time{ 0.f,0.f }; // prefix sum of time, assigned during finalize()
 
             Vec3f position{ Vec3f::Zero() }; // mm
-            Vec3f arc_center_position{ Vec3f::Zero() };      // mm
-            std::vector<Vec3f> interpolation_points;     // interpolation points of arc for drawing
+            // interpolation points of arc for drawing, stored in GCodeProcessorResult::arc_interpolation_points
+            uint32_t interpolation_points_offset{ 0 };
+            uint32_t interpolation_points_count{ 0 };
             int  object_label_id{-1};
             float print_z{0.0f};
 
             float volumetric_rate() const { return feedrate * mm3_per_mm; }
             //BBS: new function to support arc move
             bool is_arc_move_with_interpolation_points() const {
-                return (move_path_type == EMovePathType::Arc_move_ccw || move_path_type == EMovePathType::Arc_move_cw) && interpolation_points.size();
+                return (move_path_type == EMovePathType::Arc_move_ccw || move_path_type == EMovePathType::Arc_move_cw) && interpolation_points_count;
             }
             bool is_arc_move() const {
                 return move_path_type == EMovePathType::Arc_move_ccw || move_path_type == EMovePathType::Arc_move_cw;
             }
         };
 
+        // Interpolation points of a single arc move.
+        struct InterpolationPoints
+        {
+            const Vec3f *points{ nullptr };
+            size_t       count{ 0 };
+
+            size_t       size() const { return count; }
+            bool         empty() const { return count == 0; }
+            const Vec3f& operator[](size_t idx) const { assert(idx < count); return points[idx]; }
+            const Vec3f* begin() const { return points; }
+            const Vec3f* end() const { return points + count; }
+        };
+
         struct SliceWarning {
             int         level;                  // 0: normal tips, 1: warning; 2: error
             std::string msg;                    // enum string
@@ -232,6 +246,8 @@ namespace Slic3r {
         std::string filename;
         unsigned int id;
         std::vector<MoveVertex> moves;
+        // Interpolation points of all the arc moves in a single buffer, so that the moves do not own any heap memory.
+        std::vector<Vec3f> arc_interpolation_points;
         // Positions of ends of lines of the final G-code this->filename after TimeProcessor::post_process() finalizes the G-code.
         std::vector<size_t> lines_ends;
         Pointfs printable_area;
@@ -277,6 +293,9 @@ namespace Slic3r {
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
         void reset();
 
+        InterpolationPoints interpolation_points(const MoveVertex &move) const
+            { return { arc_interpolation_points.data() + move.interpolation_points_offset, move.interpolation_points_count }; }
+
         //BBS: add mutex for protection of gcode result
         mutable std::mutex result_mutex;
         GCodeProcessorResult& operator=(const GCodeProcessorResult &other)
@@ -284,6 +303,7 @@ namespace Slic3r {
             filename = other.filename;
             id = other.id;
             moves = other.moves;
+            arc_interpolation_points = other.arc_interpolation_points;
             lines_ends = other.lines_ends;
             printable_area = other.printable_area;
             bed_exclude_area = other.bed_exclude_area;
@@ -1112,6 +1132,8 @@ namespace Slic3r {
         const GCodeProcessorResult& get_result() const { return m_result; }
         GCodeProcessorResult& result() { return m_result; }
         GCodeProcessorResult&& extract_result() { return std::move(m_result); }
+        // Unique id for a result not produced by a GCodeProcessor, for example loaded from a GCodeResultCache.
+        static unsigned int next_result_id() { return ++s_result_id; }
 
         // Load a G-code into a stand-alone G-code viewer.
         // throws CanceledException through print->throw_if_canceled() (sent by the caller as callback).
@@ -1120,6 +1142,8 @@ namespace Slic3r {
         // Streaming interface, for processing G-codes just generated by PrusaSlicer in a pipelined fashion.
         void initialize(const std::string& filename);
         void process_buffer(const std::string& buffer);
+        // Process the G-code of [begin, end) in place, *end has to be a zero or a new line.
+        void process_buffer(const char* begin, const char* end);
         void finalize(bool post_process);
 
         float get_time(PrintEstimatedStatistics::ETimeMode mode) const;
@@ -0,0 +1,272 @@
+#include "../libslic3r.h"
+#include "GCodeProcessor.hpp"
+
+#include "GCodeResultCache.hpp"
+
+#include <cstdio>
+
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/array.hpp>
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/unordered_map.hpp>
+#include <cereal/types/utility.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <openssl/md5.h>
+
+namespace Slic3r {
+
+namespace CustomGCode {
+template<class Archive> void serialize(Archive &ar, Item &item) { ar(item.print_z, item.type, item.extruder, item.color, item.extra); }
+}
+
+template<class Archive> void serialize(Archive &ar, PrintEstimatedStatistics::Mode &mode)
+{
+    ar(mode.time, mode.prepare_time, mode.custom_gcode_times, mode.moves_times, mode.roles_times, mode.layers_times);
+}
+
+template<class Archive> void serialize(Archive &ar, PrintEstimatedStatistics &stats)
+{
+    ar(stats.volumes_per_color_change, stats.model_volumes_per_extruder, stats.wipe_tower_volumes_per_extruder, stats.support_volumes_per_extruder,
+       stats.total_volumes_per_extruder, stats.flush_per_filament, stats.used_filaments_per_role, stats.modes, stats.total_filament_changes,
+       stats.total_extruder_changes);
+}
+
+template<class Archive> void serialize(Archive &ar, GCodeCheckResult &check)
+{
+    ar(check.error_code, check.print_area_error_infos, check.print_height_error_infos);
+}
+
+template<class Archive> void serialize(Archive &ar, FilamentPrintableResult &printable)
+{
+    ar(printable.conflict_filament, printable.plate_name);
+}
+
+template<class Archive> void serialize(Archive &ar, GCodeProcessorResult::SettingsIds &ids)
+{
+    ar(ids.print, ids.filament, ids.printer);
+}
+
+template<class Archive> void serialize(Archive &ar, GCodeProcessorResult::SliceWarning &warning)
+{
+    ar(warning.level, warning.msg, warning.error_code, warning.params);
+}
+
+namespace GCodeResultCache {
+
+// "BBSGCRES", then the format version and the size of a move, which depends on the compiler.
+static const std::string CACHE_MAGIC = "BBSGCRES";
+
+using MoveVertex = GCodeProcessorResult::MoveVertex;
+
+// The moves and the arc points are most of the data, they are stored as raw blocks.
+template<class T> static void save_block(cereal::BinaryOutputArchive &ar, const std::vector<T> &data)
+{
+    ar(uint64_t(data.size()));
+    ar(cereal::binary_data(data.data(), data.size() * sizeof(T)));
+}
+
+// max_bytes bounds the size of a damaged block to the size of the file.
+template<class T> static void load_block(cereal::BinaryInputArchive &ar, std::vector<T> &data, uint64_t max_bytes)
+{
+    uint64_t size;
+    ar(size);
+    if (size > max_bytes / sizeof(T))
+        throw Slic3r::FileIOError("Block size exceeds the file size");
+    data.resize(size_t(size));
+    ar(cereal::binary_data(data.data(), data.size() * sizeof(T)));
+}
+
+// The same fields as copied by GCodeProcessorResult::operator=(), except for the file name and the id,
+// which belong to the file being loaded. The moves and the arc points are stored separately.
+template<class Archive> static void serialize_fields(Archive &ar, GCodeProcessorResult &result)
+{
+    ar(result.lines_ends, result.printable_area, result.bed_exclude_area, result.toolpath_outside, result.label_object_enabled,
+       result.long_retraction_when_cut, result.timelapse_warning_code, result.printable_height, result.settings_ids, result.filaments_count,
+       result.extruder_colors, result.filament_diameters, result.filament_densities, result.filament_costs, result.print_statistics,
+       result.custom_gcode_per_print_z, result.spiral_vase_layers, result.warnings, result.bed_type, result.gcode_check_result,
+       result.limit_filament_maps, result.filament_printable_reuslt, result.layer_filaments, result.filament_change_count_map,
+       result.skippable_part_time);
+}
+
+// Everything the G-code viewer indexes by the loaded values, thus a damaged snapshot is refused instead of crashing the preview.
+static bool validate(const GCodeProcessorResult &result, std::string &error)
+{
+    for (size_t i = 1; i < result.lines_ends.size(); ++ i)
+        if (result.lines_ends[i] < result.lines_ends[i - 1]) {
+            error = "decreasing line ends";
+            return false;
+        }
+    for (const MoveVertex &move : result.moves) {
+        if (move.type >= EMoveType::Count || move.extrusion_role >= erCount || move.move_path_type >= EMovePathType::Count) {
+            error = "move type out of range";
+            return false;
+        }
+        if (move.extruder_id >= result.filaments_count) {
+            error = "extruder out of range";
+            return false;
+        }
+        if (! result.lines_ends.empty() && move.gcode_id > result.lines_ends.size()) {
+            error = "G-code line out of range";
+            return false;
+        }
+        if (uint64_t(move.interpolation_points_offset) + uint64_t(move.interpolation_points_count) > result.arc_interpolation_points.size()) {
+            error = "arc interpolation points out of range";
+            return false;
+        }
+    }
+    for (const auto &[z, range] : result.spiral_vase_layers)
+        if (range.first > range.second || range.second >= result.moves.size()) {
+            error = "spiral vase layer out of range";
+            return false;
+        }
+    for (const CustomGCode::Item &item : result.custom_gcode_per_print_z)
+        if (item.type < CustomGCode::ColorChange || item.type > CustomGCode::Unknown || item.extruder < 0 || size_t(item.extruder) > result.filaments_count) {
+            error = "custom G-code out of range";
+            return false;
+        }
+    for (const PrintEstimatedStatistics::Mode &mode : result.print_statistics.modes) {
+        for (const auto &[type, times] : mode.custom_gcode_times)
+            if (type < CustomGCode::ColorChange || type > CustomGCode::Unknown) {
+                error = "custom G-code time out of range";
+                return false;
+            }
+        for (const auto &[type, time] : mode.moves_times)
+            if (type >= EMoveType::Count) {
+                error = "move time out of range";
+                return false;
+            }
+        for (const auto &[role, time] : mode.roles_times)
+            if (role >= erCount) {
+                error = "role time out of range";
+                return false;
+            }
+    }
+    for (const auto &[role, used] : result.print_statistics.used_filaments_per_role)
+        if (role >= erCount) {
+            error = "filament role out of range";
+            return false;
+        }
+    // The filaments of a layer are hashed as bits of a 64 bit mask.
+    for (const auto &[filaments, layers] : result.layer_filaments)
+        for (unsigned int filament : filaments)
+            if (filament >= 64 || filament >= result.filaments_count) {
+                error = "layer filament out of range";
+                return false;
+            }
+    for (const auto &[type, time] : result.skippable_part_time)
+        if (type < stTimelapse || type > stNone) {
+            error = "skippable part out of range";
+            return false;
+        }
+    if (result.bed_type < btDefault || result.bed_type > btCount) {
+        error = "bed type out of range";
+        return false;
+    }
+    return true;
+}
+
+std::string file_md5(const std::string &path)
+{
+    boost::nowide::ifstream ifs(path, std::ios::binary);
+    if (! ifs)
+        return std::string();
+    unsigned char digest[16];
+    MD5_CTX       ctx;
+    MD5_Init(&ctx);
+    std::string buf(64 * 1024, 0);
+    while (ifs) {
+        ifs.read(buf.data(), buf.size());
+        MD5_Update(&ctx, (unsigned char*)buf.data(), size_t(ifs.gcount()));
+    }
+    MD5_Final(digest, &ctx);
+    char md5_str[33];
+    for (int i = 0; i < 16; ++ i)
+        sprintf(&md5_str[i * 2], "%02X", (unsigned int)digest[i]);
+    return std::string(md5_str);
+}
+
+bool save(const GCodeProcessorResult &result, const std::string &gcode_md5, const Vec2d &xy_offset, const std::string &path)
+{
+    // Written to a temporary file first, so that a failed write never leaves a damaged snapshot behind.
+    const std::string temp_path = path + ".tmp";
+    try {
+        {
+            boost::nowide::ofstream ofs(temp_path, std::ios::binary);
+            if (! ofs)
+                return false;
+            cereal::BinaryOutputArchive ar(ofs);
+            ar(CACHE_MAGIC, FORMAT_VERSION, uint32_t(sizeof(MoveVertex)), gcode_md5, xy_offset.x(), xy_offset.y());
+            save_block(ar, result.moves);
+            save_block(ar, result.arc_interpolation_points);
+            serialize_fields(ar, const_cast<GCodeProcessorResult&>(result));
+            if (! ofs)
+                throw Slic3r::FileIOError("Failed to write " + temp_path);
+        }
+        boost::filesystem::rename(temp_path, path);
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": failed to write %1%: %2%") % path % ex.what();
+        boost::system::error_code ec;
+        boost::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+bool load(GCodeProcessorResult &result, const std::string &gcode_md5, const Vec2d &xy_offset, const std::string &path)
+{
+    boost::system::error_code ec;
+    if (gcode_md5.empty() || ! boost::filesystem::exists(path, ec))
+        return false;
+
+    GCodeProcessorResult loaded;
+    try {
+        boost::nowide::ifstream ifs(path, std::ios::binary);
+        if (! ifs)
+            return false;
+        cereal::BinaryInputArchive ar(ifs);
+        std::string magic, md5;
+        uint32_t    version, move_size;
+        double      x_offset, y_offset;
+        ar(magic, version, move_size);
+        if (magic != CACHE_MAGIC || version != FORMAT_VERSION || move_size != sizeof(MoveVertex)) {
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": %1% was written by another version, ignored") % path;
+            return false;
+        }
+        ar(md5, x_offset, y_offset);
+        if (md5 != gcode_md5 || x_offset != xy_offset.x() || y_offset != xy_offset.y()) {
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": %1% does not match its G-code, ignored") % path;
+            return false;
+        }
+        const uint64_t file_size = boost::filesystem::file_size(path);
+        load_block(ar, loaded.moves, file_size);
+        load_block(ar, loaded.arc_interpolation_points, file_size);
+        serialize_fields(ar, loaded);
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": failed to read %1%: %2%") % path % ex.what();
+        return false;
+    }
+    if (std::string error; ! validate(loaded, error)) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": %1% is damaged, %2%, ignored") % path % error;
+        return false;
+    }
+
+    // Move the big buffers instead of copying them by operator=().
+    std::vector<MoveVertex> moves                    = std::move(loaded.moves);
+    std::vector<Vec3f>      arc_interpolation_points = std::move(loaded.arc_interpolation_points);
+    std::vector<size_t>     lines_ends               = std::move(loaded.lines_ends);
+    result                          = loaded;
+    result.moves                    = std::move(moves);
+    result.arc_interpolation_points = std::move(arc_interpolation_points);
+    result.lines_ends               = std::move(lines_ends);
+    return true;
+}
+
+} // namespace GCodeResultCache
+} // namespace Slic3r
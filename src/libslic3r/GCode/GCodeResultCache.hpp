@@ -0,0 +1,36 @@
+#ifndef slic3r_GCode_GCodeResultCache_hpp_
+#define slic3r_GCode_GCodeResultCache_hpp_
+
+#include "../Point.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace Slic3r {
+
+struct GCodeProcessorResult;
+
+// BBS: binary snapshot of the GCodeProcessorResult of a G-code file, stored next to the G-code as "<gcode file>.result"
+// and, if enabled by SaveStrategy::WithGcodeResult, inside the project 3mf as "Metadata/plate_N.gcode.result". It lets a sliced project be previewed after reopening
+// without parsing its G-code again. The snapshot is only accepted if it was written by the same format version for
+// the same G-code (compared by MD5) and the same plate offset, otherwise the G-code has to be processed again.
+namespace GCodeResultCache {
+
+// Bump whenever the layout of GCodeProcessorResult or of the file changes, snapshots of other versions are refused.
+static constexpr uint32_t FORMAT_VERSION = 1;
+// Appended to the name of the G-code file.
+static constexpr const char *FILE_EXTENSION = ".result";
+
+// Upper case hex MD5 of the whole file, the same as stored in "Metadata/plate_N.gcode.md5". Empty if the file can not be read.
+std::string file_md5(const std::string &path);
+
+// Returns false if the snapshot could not be written.
+bool save(const GCodeProcessorResult &result, const std::string &gcode_md5, const Vec2d &xy_offset, const std::string &path);
+// Returns false if the snapshot is missing, damaged or does not match gcode_md5 and xy_offset. The result is only modified on success.
+// The indices and enums of the loaded result are validated, a snapshot referencing outside of its moves or arc points is damaged.
+bool load(GCodeProcessorResult &result, const std::string &gcode_md5, const Vec2d &xy_offset, const std::string &path);
+
+} // namespace GCodeResultCache
+} // namespace Slic3r
+
+#endif /* slic3r_GCode_GCodeResultCache_hpp_ */
@@ -0,0 +1,116 @@
+#include "PipelineStats.hpp"
+
+#include <algorithm>
+
+#include <boost/format.hpp>
+
+#include <tbb/task_arena.h>
+
+namespace Slic3r {
+
+// The export pipeline has at most 6 serial stages, tokens above a few per stage only buffer
+// the G-code of the layers waiting for the slowest stage.
+static constexpr size_t PIPELINE_MIN_TOKENS = 4;
+static constexpr size_t PIPELINE_MAX_TOKENS = 32;
+// Size of the G-code of a layer assumed before any layer was exported.
+static constexpr size_t PIPELINE_DEFAULT_LAYER_BYTES = 512 * 1024;
+
+size_t gcode_pipeline_tokens(size_t configured_tokens, size_t memory_budget_mb, size_t layer_bytes, size_t num_layers)
+{
+    size_t tokens = configured_tokens;
+    if (tokens == 0) {
+        tokens = std::clamp<size_t>(size_t(tbb::this_task_arena::max_concurrency()), PIPELINE_MIN_TOKENS, PIPELINE_MAX_TOKENS);
+        if (memory_budget_mb > 0) {
+            if (layer_bytes == 0)
+                layer_bytes = PIPELINE_DEFAULT_LAYER_BYTES;
+            // Keep at least two layers in flight, so that the G-code generation overlaps with the output.
+            tokens = std::min(tokens, std::max<size_t>(2, memory_budget_mb * 1024 * 1024 / layer_bytes));
+        }
+    }
+    return std::max<size_t>(1, std::min(tokens, std::max<size_t>(1, num_layers)));
+}
+
+template<typename T> static void atomic_max(std::atomic<T> &value, T candidate)
+{
+    T prev = value.load(std::memory_order_relaxed);
+    while (prev < candidate && ! value.compare_exchange_weak(prev, candidate, std::memory_order_relaxed)) ;
+}
+
+std::chrono::steady_clock::time_point GCodePipelineTracker::stage_started(Stage &stage)
+{
+    // Serial stage, no other thread is modifying the counters of this stage.
+    size_t started = stage.started.fetch_add(1, std::memory_order_relaxed);
+    if (started == 0)
+        stage.base = m_pass_base.load(std::memory_order_acquire);
+    size_t produced = m_produced.load(std::memory_order_acquire) - stage.base;
+    if (produced > started + 1)
+        atomic_max(stage.max_backlog, produced - started - 1);
+    auto now = std::chrono::steady_clock::now();
+    if (started > 0)
+        stage.wait_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(now - stage.last_finished).count(), std::memory_order_relaxed);
+    return now;
+}
+
+void GCodePipelineTracker::stage_finished(Stage &stage, std::chrono::steady_clock::time_point start, size_t bytes)
+{
+    stage.last_finished = std::chrono::steady_clock::now();
+    stage.busy_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(stage.last_finished - start).count(), std::memory_order_relaxed);
+    stage.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stage.items.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Called by a source before it starts a layer, so that the first stage_started() of a pass, the one of the source,
+// already sees the base of the pass.
+void GCodePipelineTracker::producing()
+{
+    // The sources are serial, m_produced is only modified by the running source.
+    size_t produced = m_produced.load(std::memory_order_relaxed);
+    if (produced == m_consumed.load(std::memory_order_acquire))
+        m_pass_base.store(produced, std::memory_order_release);
+}
+
+void GCodePipelineTracker::produced()
+{
+    size_t consumed = m_consumed.load(std::memory_order_acquire);
+    size_t produced = m_produced.load(std::memory_order_relaxed);
+    m_produced.store(++ produced, std::memory_order_release);
+    size_t in_flight = produced - consumed;
+    atomic_max(m_max_in_flight, in_flight);
+    if (in_flight >= m_max_tokens)
+        m_stalls.fetch_add(1, std::memory_order_relaxed);
+}
+
+void GCodePipelineTracker::consumed(size_t layer_bytes)
+{
+    m_consumed.fetch_add(1, std::memory_order_acq_rel);
+    m_total_layer_bytes.fetch_add(layer_bytes, std::memory_order_relaxed);
+    atomic_max(m_max_layer_bytes, layer_bytes);
+}
+
+GCodePipelineStats GCodePipelineTracker::stats() const
+{
+    GCodePipelineStats out;
+    out.max_tokens        = m_max_tokens;
+    out.max_in_flight     = m_max_in_flight.load();
+    out.stalls            = m_stalls.load();
+    out.layers            = m_consumed.load();
+    out.total_layer_bytes = m_total_layer_bytes.load();
+    out.max_layer_bytes   = m_max_layer_bytes.load();
+    out.wall_ms           = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+    for (const Stage &stage : m_stages)
+        out.stages.push_back({ stage.name, stage.items.load(), double(stage.busy_ns.load()) * 1e-6, double(stage.wait_ns.load()) * 1e-6,
+                               stage.bytes.load(), stage.max_backlog.load() });
+    return out;
+}
+
+std::string GCodePipelineStats::to_string() const
+{
+    std::string out = (boost::format("tokens %1%, max in flight %2%, stalls %3%, layers %4%, average layer %5% bytes, max layer %6% bytes, wall %7$.1f ms")
+        % max_tokens % max_in_flight % stalls % layers % average_layer_bytes() % max_layer_bytes % wall_ms).str();
+    for (const Stage &stage : stages)
+        out += (boost::format("; %1%: items %2%, busy %3$.1f ms, wait %4$.1f ms, %5% bytes, max backlog %6%")
+            % stage.name % stage.items % stage.busy_ms % stage.wait_ms % stage.bytes % stage.max_backlog).str();
+    return out;
+}
+
+} // namespace Slic3r
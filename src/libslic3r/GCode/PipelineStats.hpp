@@ -0,0 +1,162 @@
+#ifndef slic3r_GCode_PipelineStats_hpp_
+#define slic3r_GCode_PipelineStats_hpp_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Profiler.hpp"
+
+namespace Slic3r {
+
+// BBS: counters of a tbb::parallel_pipeline exporting the layers, see GCode::process_layers().
+struct GCodePipelineStats
+{
+    struct Stage
+    {
+        std::string     name;
+        size_t          items { 0 };
+        double          busy_ms { 0. };
+        // Time between finishing a layer and starting the next one, spent waiting for the neighbor stages or for a token.
+        double          wait_ms { 0. };
+        // G-code produced by the stage, only counted for stages returning std::string and for the sinks.
+        size_t          bytes { 0 };
+        // Maximum number of layers the source produced ahead of this stage.
+        size_t          max_backlog { 0 };
+    };
+
+    size_t              max_tokens { 0 };
+    size_t              max_in_flight { 0 };
+    // Number of layers produced while all the tokens were taken, thus the source had to wait for the serial stages.
+    size_t              stalls { 0 };
+    size_t              layers { 0 };
+    size_t              total_layer_bytes { 0 };
+    size_t              max_layer_bytes { 0 };
+    double              wall_ms { 0. };
+    std::vector<Stage>  stages;
+
+    size_t              average_layer_bytes() const { return layers == 0 ? 0 : total_layer_bytes / layers; }
+    std::string         to_string() const;
+};
+
+// Number of layers to be kept in flight by the G-code export pipeline.
+// configured_tokens: user override, 0 to derive the count from the hardware concurrency.
+// memory_budget_mb: memory allowed for the G-code of the layers in flight, 0 for no limit.
+// layer_bytes: estimated size of the G-code of a single layer, 0 if not known yet.
+size_t gcode_pipeline_tokens(size_t configured_tokens, size_t memory_budget_mb, size_t layer_bytes, size_t num_layers);
+
+// Wraps the functors of the pipeline filters to collect GCodePipelineStats. The tracker may be shared
+// by several pipelines running one after the other, the source and sink wrappers keep the count of the
+// layers in flight. If compiled with SLIC3R_PROFILE, every layer passing a stage is recorded as a profiler
+// zone named by the stage, thus the stages show up in the Chrome trace written by PROFILE_OUTPUT_TRACE().
+class GCodePipelineTracker
+{
+public:
+    explicit GCodePipelineTracker(size_t max_tokens) : m_max_tokens(max_tokens), m_start(std::chrono::steady_clock::now()) {}
+    GCodePipelineTracker(const GCodePipelineTracker&) = delete;
+    GCodePipelineTracker& operator=(const GCodePipelineTracker&) = delete;
+
+    size_t max_tokens() const { return m_max_tokens; }
+
+    // First filter of a pipeline, called with tbb::flow_control&.
+    // at_end() returns true if the next call of the source is going to stop the pipeline.
+    template<typename Fn, typename AtEnd> auto source(const char *name, Fn fn, AtEnd at_end)
+    {
+        Stage &stage = this->add_stage(name);
+        return [this, &stage, fn, at_end](auto &fc) {
+            if (at_end())
+                return fn(fc);
+            this->producing();
+            auto start = this->stage_started(stage);
+#ifdef SLIC3R_PROFILE
+            Profiler::ScopedZone zone(stage.name);
+#endif
+            auto out   = fn(fc);
+            this->stage_finished(stage, start, output_bytes(out));
+            this->produced();
+            return out;
+        };
+    }
+    // Intermediate filter, called with the layer produced by the previous one.
+    template<typename Fn> auto stage(const char *name, Fn fn)
+    {
+        Stage &stage = this->add_stage(name);
+        return [this, &stage, fn](auto &&... args) {
+            auto start = this->stage_started(stage);
+#ifdef SLIC3R_PROFILE
+            Profiler::ScopedZone zone(stage.name);
+#endif
+            auto out   = fn(std::forward<decltype(args)>(args)...);
+            this->stage_finished(stage, start, output_bytes(out));
+            return out;
+        };
+    }
+    // Last filter of a pipeline returning void, layer_bytes(input) gives the size of the G-code of the layer.
+    template<typename Fn, typename LayerBytes> auto sink(const char *name, Fn fn, LayerBytes layer_bytes)
+    {
+        Stage &stage = this->add_stage(name);
+        return [this, &stage, fn, layer_bytes](auto &&in) {
+            auto   start = this->stage_started(stage);
+            size_t bytes = layer_bytes(in);
+            {
+#ifdef SLIC3R_PROFILE
+                Profiler::ScopedZone zone(stage.name);
+#endif
+                fn(std::forward<decltype(in)>(in));
+            }
+            this->stage_finished(stage, start, bytes);
+            this->consumed(bytes);
+        };
+    }
+
+    GCodePipelineStats stats() const;
+
+private:
+    struct Stage
+    {
+        explicit Stage(const char *name) : name(name) {}
+        const char             *name;
+        std::atomic<size_t>     started { 0 };
+        std::atomic<size_t>     items { 0 };
+        std::atomic<int64_t>    busy_ns { 0 };
+        std::atomic<int64_t>    wait_ns { 0 };
+        std::atomic<size_t>     bytes { 0 };
+        std::atomic<size_t>     max_backlog { 0 };
+        // Layers produced before the pass this stage takes part in.
+        size_t                  base { 0 };
+        // End of the last layer, only accessed by the stage itself.
+        std::chrono::steady_clock::time_point   last_finished;
+    };
+
+    template<typename T> static size_t output_bytes(const T &out)
+        { if constexpr (std::is_same_v<T, std::string>) return out.size(); else return 0; }
+
+    Stage&                                  add_stage(const char *name) { return m_stages.emplace_back(name); }
+    std::chrono::steady_clock::time_point   stage_started(Stage &stage);
+    void                                    stage_finished(Stage &stage, std::chrono::steady_clock::time_point start, size_t bytes);
+    void                                    producing();
+    void                                    produced();
+    void                                    consumed(size_t layer_bytes);
+
+    size_t                                  m_max_tokens;
+    std::chrono::steady_clock::time_point   m_start;
+    // References to the stages are held by the wrappers, std::deque keeps them valid while adding stages.
+    std::deque<Stage>                       m_stages;
+    std::atomic<size_t>                     m_produced { 0 };
+    std::atomic<size_t>                     m_consumed { 0 };
+    // Value of m_produced when the pipeline was empty the last time, the start of the current pass.
+    std::atomic<size_t>                     m_pass_base { 0 };
+    std::atomic<size_t>                     m_max_in_flight { 0 };
+    std::atomic<size_t>                     m_stalls { 0 };
+    std::atomic<size_t>                     m_total_layer_bytes { 0 };
+    std::atomic<size_t>                     m_max_layer_bytes { 0 };
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_GCode_PipelineStats_hpp_
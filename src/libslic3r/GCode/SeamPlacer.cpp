@@ -268,8 +268,9 @@ struct CoordinateFunctor
     const float &operator()(size_t idx, size_t dim) const { return coordinates->operator[](idx)[dim]; }
 };
 
-// structure to store global information about the model - occlusion hits, enforcers, blockers
-struct GlobalModelInfo
+// Visibility of the mesh of an object, sampled by raycasting. It depends on the meshes of the object and their transformation only,
+// thus it is shared by the objects printing the same meshes.
+struct MeshVisibility
 {
     TriangleSetSamples                          mesh_samples;
     std::vector<float>                          mesh_samples_visibility;
@@ -277,24 +278,10 @@ struct GlobalModelInfo
     KDTreeIndirect<3, float, CoordinateFunctor> mesh_samples_tree{CoordinateFunctor{}};
     float                                       mesh_samples_radius;
 
-    indexed_triangle_set             enforcers;
-    indexed_triangle_set             blockers;
-    AABBTreeIndirect::Tree<3, float> enforcers_tree;
-    AABBTreeIndirect::Tree<3, float> blockers_tree;
-
-    bool is_enforced(const Vec3f &position, float radius) const
-    {
-        if (enforcers.empty()) { return false; }
-        float radius_sqr = radius * radius;
-        return AABBTreeIndirect::is_any_triangle_in_radius(enforcers.vertices, enforcers.indices, enforcers_tree, position, radius_sqr);
-    }
-
-    bool is_blocked(const Vec3f &position, float radius) const
-    {
-        if (blockers.empty()) { return false; }
-        float radius_sqr = radius * radius;
-        return AABBTreeIndirect::is_any_triangle_in_radius(blockers.vertices, blockers.indices, blockers_tree, position, radius_sqr);
-    }
+    MeshVisibility() = default;
+    // mesh_samples_tree references mesh_samples.
+    MeshVisibility(const MeshVisibility &) = delete;
+    MeshVisibility &operator=(const MeshVisibility &) = delete;
 
     float calculate_point_visibility(const Vec3f &position) const
     {
@@ -366,6 +353,36 @@ struct GlobalModelInfo
 #endif
 };
 
+// structure to store global information about the model - occlusion hits, enforcers, blockers
+struct GlobalModelInfo
+{
+    std::shared_ptr<const MeshVisibility> mesh_visibility;
+
+    indexed_triangle_set             enforcers;
+    indexed_triangle_set             blockers;
+    AABBTreeIndirect::Tree<3, float> enforcers_tree;
+    AABBTreeIndirect::Tree<3, float> blockers_tree;
+
+    bool is_enforced(const Vec3f &position, float radius) const
+    {
+        if (enforcers.empty()) { return false; }
+        float radius_sqr = radius * radius;
+        return AABBTreeIndirect::is_any_triangle_in_radius(enforcers.vertices, enforcers.indices, enforcers_tree, position, radius_sqr);
+    }
+
+    bool is_blocked(const Vec3f &position, float radius) const
+    {
+        if (blockers.empty()) { return false; }
+        float radius_sqr = radius * radius;
+        return AABBTreeIndirect::is_any_triangle_in_radius(blockers.vertices, blockers.indices, blockers_tree, position, radius_sqr);
+    }
+
+    float calculate_point_visibility(const Vec3f &position) const
+    {
+        return mesh_visibility ? mesh_visibility->calculate_point_visibility(position) : 1.0f;
+    }
+};
+
 // Extract perimeter polygons of the given layer
 Polygons extract_perimeter_polygons(const Layer *layer, const SeamPosition configured_seam_preference, std::vector<const LayerRegion *> &corresponding_regions_out)
 {
@@ -567,9 +584,11 @@ std::pair<size_t, size_t> find_previous_and_next_perimeter_point(const std::vect
     return {size_t(prev), size_t(next)};
 }
 
-// Computes all global model info - transforms object, performs raycasting
-void compute_global_occlusion(GlobalModelInfo &result, const PrintObject *po, std::function<void(void)> throw_if_canceled)
+// Computes the visibility of the mesh of the object - transforms object, performs raycasting
+std::shared_ptr<const MeshVisibility> compute_global_occlusion(const PrintObject *po, std::function<void(void)> throw_if_canceled)
 {
+    auto            result_ptr = std::make_shared<MeshVisibility>();
+    MeshVisibility &result     = *result_ptr;
     BOOST_LOG_TRIVIAL(debug) << "SeamPlacer: gather occlusion meshes: start";
     auto                 obj_transform = po->trafo_centered();
     indexed_triangle_set triangle_set;
@@ -636,6 +655,24 @@ void compute_global_occlusion(GlobalModelInfo &result, const PrintObject *po, st
 #ifdef DEBUG_FILES
     result.debug_export(triangle_set);
 #endif
+    return result_ptr;
+}
+
+// Whether the raycasted visibility of po2 is the same as the visibility of po1: the objects are made of the same meshes,
+// transformed the same way, typically copies of one object.
+bool same_occlusion_meshes(const PrintObject *po1, const PrintObject *po2)
+{
+    if (! po1->trafo_centered().isApprox(po2->trafo_centered(), 0.))
+        return false;
+    auto occluding = [](const ModelVolume *mv) { return mv->type() == ModelVolumeType::MODEL_PART || mv->type() == ModelVolumeType::NEGATIVE_VOLUME; };
+    std::vector<const ModelVolume*> volumes1, volumes2;
+    std::copy_if(po1->model_object()->volumes.begin(), po1->model_object()->volumes.end(), std::back_inserter(volumes1), occluding);
+    std::copy_if(po2->model_object()->volumes.begin(), po2->model_object()->volumes.end(), std::back_inserter(volumes2), occluding);
+    return std::equal(volumes1.begin(), volumes1.end(), volumes2.begin(), volumes2.end(), [](const ModelVolume *mv1, const ModelVolume *mv2) {
+        return mv1->type() == mv2->type() && mv1->get_matrix().isApprox(mv2->get_matrix(), 0.) &&
+               (mv1->mesh_ptr() == mv2->mesh_ptr() ||
+                (mv1->mesh().its.vertices == mv2->mesh().its.vertices && mv1->mesh().its.indices == mv2->mesh().its.indices));
+    });
 }
 
 void gather_enforcers_blockers(GlobalModelInfo &result, const PrintObject *po)
@@ -1341,7 +1378,35 @@ void SeamPlacer::init(const Print &print, std::function<void(void)> throw_if_can
     using namespace SeamPlacerImpl;
     m_seam_per_object.clear();
 
-    for (const PrintObject *po : print.objects()) {
+    // The raycasted visibility is the most expensive part of the seam placement, it is computed once for the objects
+    // sharing their meshes and in parallel for the different meshes.
+    const std::vector<const PrintObject*> objects(print.objects().begin(), print.objects().end());
+    std::vector<size_t>                   visibility_idx(objects.size(), size_t(-1));
+    std::vector<size_t>                   visibility_objects;
+    for (size_t object_idx = 0; object_idx < objects.size(); ++ object_idx) {
+        const SeamPosition seam_position = objects[object_idx]->config().seam_position.value;
+        if (seam_position != spAligned && seam_position != spNearest)
+            continue;
+        auto it = std::find_if(visibility_objects.begin(), visibility_objects.end(),
+            [&](size_t other_idx) { return same_occlusion_meshes(objects[other_idx], objects[object_idx]); });
+        visibility_idx[object_idx] = it - visibility_objects.begin();
+        if (it == visibility_objects.end())
+            visibility_objects.emplace_back(object_idx);
+    }
+    BOOST_LOG_TRIVIAL(debug) << "SeamPlacer: raycasting the visibility of " << visibility_objects.size() << " meshes for " << objects.size() << " objects";
+    std::vector<std::shared_ptr<const MeshVisibility>> visibilities(visibility_objects.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, visibility_objects.size(), 1), [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i)
+            visibilities[i] = compute_global_occlusion(objects[visibility_objects[i]], throw_if_canceled_func);
+    });
+    // Number of objects still to be processed using each of the visibilities, to release them as soon as possible.
+    std::vector<size_t> visibility_users(visibilities.size(), 0);
+    for (size_t idx : visibility_idx)
+        if (idx != size_t(-1))
+            ++ visibility_users[idx];
+
+    for (size_t object_idx = 0; object_idx < objects.size(); ++ object_idx) {
+        const PrintObject *po = objects[object_idx];
         throw_if_canceled_func();
         SeamPosition   configured_seam_preference = po->config().seam_position.value;
         SeamComparator comparator{configured_seam_preference};
@@ -1350,7 +1415,11 @@ void SeamPlacer::init(const Print &print, std::function<void(void)> throw_if_can
             GlobalModelInfo global_model_info{};
             gather_enforcers_blockers(global_model_info, po);
             throw_if_canceled_func();
-            if (configured_seam_preference == spAligned || configured_seam_preference == spNearest) { compute_global_occlusion(global_model_info, po, throw_if_canceled_func); }
+            if (size_t idx = visibility_idx[object_idx]; idx != size_t(-1)) {
+                global_model_info.mesh_visibility = visibilities[idx];
+                if (-- visibility_users[idx] == 0)
+                    visibilities[idx].reset();
+            }
             throw_if_canceled_func();
             BOOST_LOG_TRIVIAL(debug) << "SeamPlacer: gather_seam_candidates: start";
             gather_seam_candidates(po, global_model_info, configured_seam_preference);
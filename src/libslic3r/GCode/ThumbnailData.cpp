@@ -22,6 +22,8 @@ void ThumbnailData::reset()
     width = 0;
     height = 0;
     pixels.clear();
+    scene_fingerprint = 0;
+    pixels_hash = 0;
 }
 
 bool ThumbnailData::is_valid() const
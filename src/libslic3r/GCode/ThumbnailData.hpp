@@ -15,6 +15,10 @@ struct ThumbnailData
     unsigned int width;
     unsigned int height;
     std::vector<unsigned char> pixels;
+    // BBS: hash of the scene the pixels were rendered from and hash of the rendered pixels, zero if unknown.
+    // The renderer skips rendering the same scene again, unless the pixels were overwritten since.
+    size_t scene_fingerprint;
+    size_t pixels_hash;
 
     ThumbnailData() { reset(); }
     void set(unsigned int w, unsigned int h);
@@ -24,6 +28,8 @@ struct ThumbnailData
     void load_from(ThumbnailData &data) {
         this->set(data.width, data.height);
         pixels = data.pixels;
+        scene_fingerprint = data.scene_fingerprint;
+        pixels_hash = data.pixels_hash;
     }
 };
 
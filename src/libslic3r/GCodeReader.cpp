@@ -11,11 +11,115 @@
 
 #include "LocalesUtils.hpp"
 
-#include <Shiny/Shiny.h>
+#include "Profiler.hpp"
 #include <fast_float/fast_float.h>
 
+#include <atomic>
+
+#include <tbb/task_arena.h>
+// Intel redesigned some TBB interface considerably when merging TBB with their oneAPI set of libraries, see GH #7332.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SLIC3R_GCODEREADER_SSE2
+    #include <emmintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+    #define SLIC3R_GCODEREADER_NEON
+    #include <arm_neon.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#endif
+
 namespace Slic3r {
 
+// The G-code lines are short, the vectorized search pays off for the long comments and when splitting
+// the file buffer into lines. SSE2 and NEON are part of the x86-64 and AArch64 baselines,
+// thus no run time dispatch is needed.
+template<bool StopAtZero>
+static inline const char* find_line_end_impl(const char *begin, const char *end)
+{
+    const char *c = begin;
+#if defined(SLIC3R_GCODEREADER_SSE2)
+    const __m128i cr   = _mm_set1_epi8('\r');
+    const __m128i lf   = _mm_set1_epi8('\n');
+    const __m128i zero = _mm_setzero_si128();
+    for (; end - c >= 16; c += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c));
+        __m128i match = _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf));
+        if (StopAtZero)
+            match = _mm_or_si128(match, _mm_cmpeq_epi8(chunk, zero));
+        if (unsigned int mask = unsigned(_mm_movemask_epi8(match)); mask != 0) {
+#ifdef _MSC_VER
+            unsigned long idx;
+            _BitScanForward(&idx, mask);
+            return c + idx;
+#else
+            return c + __builtin_ctz(mask);
+#endif
+        }
+    }
+#elif defined(SLIC3R_GCODEREADER_NEON)
+    const uint8x16_t cr   = vdupq_n_u8('\r');
+    const uint8x16_t lf   = vdupq_n_u8('\n');
+    const uint8x16_t zero = vdupq_n_u8(0);
+    for (; end - c >= 16; c += 16) {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(c));
+        uint8x16_t match = vorrq_u8(vceqq_u8(chunk, cr), vceqq_u8(chunk, lf));
+        if (StopAtZero)
+            match = vorrq_u8(match, vceqq_u8(chunk, zero));
+        // Narrow the byte mask to 4 bits per byte to locate the first match.
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+        if (mask != 0) {
+#ifdef _MSC_VER
+            unsigned long idx;
+            _BitScanForward64(&idx, mask);
+            return c + (idx >> 2);
+#else
+            return c + (__builtin_ctzll(mask) >> 2);
+#endif
+        }
+    }
+#endif
+    for (; c != end; ++ c)
+        if (*c == '\r' || *c == '\n' || (StopAtZero && *c == 0))
+            break;
+    return c;
+}
+
+const char* GCodeReader::find_end_of_line(const char *begin, const char *end)
+{
+    return find_line_end_impl<true>(begin, end);
+}
+
+const char* GCodeReader::find_line_break(const char *begin, const char *end)
+{
+    return find_line_end_impl<false>(begin, end);
+}
+
+const char* GCodeReader::simd_name()
+{
+#if defined(SLIC3R_GCODEREADER_SSE2)
+    return "SSE2";
+#elif defined(SLIC3R_GCODEREADER_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
 void GCodeReader::apply_config(const GCodeConfig &config)
 {
     m_config = config;
@@ -30,6 +134,19 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
 {
     PROFILE_FUNC();
 
+    const char *c = parse_line_tokens(ptr, end, gline, command);
+
+    if (gline.has(E) && m_config.use_relative_e_distances)
+        m_position[E] = 0;
+
+    if (m_verbose)
+        std::cout << gline.m_raw << std::endl;
+
+    return c;
+}
+
+const char* GCodeReader::parse_line_tokens(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command)
+{
     assert(is_decimal_separator_point());
     
     // command and args
@@ -82,11 +199,11 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
                 c = skip_word(c);
         }
     }
-    
-    if (gline.has(E) && m_config.use_relative_e_distances)
-        m_position[E] = 0;
 
-    // Skip the rest of the line.
+    // Skip the rest of the line, usually a comment.
+    // The line may continue past end up to a zero or a new line, see parse_buffer().
+    if (c < end)
+        c = find_end_of_line(c, end);
     for (; ! is_end_of_line(*c); ++ c);
 
     // Copy the raw string including the comment, without the trailing newlines.
@@ -101,13 +218,10 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
 	if (*c == '\n')
 		++ c;
 
-    if (m_verbose)
-        std::cout << gline.m_raw << std::endl;
-
     return c;
 }
 
-void GCodeReader::update_coordinates(GCodeLine &gline, std::pair<const char*, const char*> &command)
+void GCodeReader::update_coordinates(const GCodeLine &gline, std::pair<const char*, const char*> &command)
 {
     PROFILE_FUNC();
     if (*command.first == 'G') {
@@ -142,11 +256,8 @@ bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLine
         auto it_bufend = buffer.begin() + cnt_read;
         while (it != it_bufend || (eof && ! gcode_line.empty())) {
             // Find end of line.
-            bool eol    = false;
-            auto it_end = it;
-            for (; it_end != it_bufend && ! (eol = *it_end == '\r' || *it_end == '\n'); ++ it_end)
-                if (*it_end == '\n')
-                    line_end_callback(file_pos + (it_end - buffer.begin()) + 1);
+            auto it_end = buffer.begin() + (find_line_break(buffer.data() + (it - buffer.begin()), buffer.data() + cnt_read) - buffer.data());
+            bool eol    = it_end != it_bufend;
             // End of line is indicated also if end of file was reached.
             eol |= eof && it_end == it_bufend;
             if (eol) {
@@ -178,6 +289,15 @@ bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLine
     return true;
 }
 
+// Skip the optional line number "N123" of a G-code line.
+static inline const char* skip_line_number(const char *c)
+{
+    c = GCodeReader::skip_whitespaces(c);
+    if (std::toupper(*c) == 'N')
+        c = GCodeReader::skip_word(c);
+    return GCodeReader::skip_whitespaces(c);
+}
+
 template<typename ParseLineCallback, typename LineEndCallback>
 bool GCodeReader::parse_file_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
 {
@@ -185,13 +305,7 @@ bool GCodeReader::parse_file_internal(const std::string &filename, ParseLineCall
     return this->parse_file_raw_internal(filename, 
         [this, &gline, parse_line_callback](const char *begin, const char *end) {
             gline.reset();
-
-            const char* begin_new = begin;
-            begin_new = skip_whitespaces(begin_new);
-            if (std::toupper(*begin_new) == 'N')
-                begin_new = skip_word(begin_new);
-            begin_new = skip_whitespaces(begin_new);
-            this->parse_line(begin_new, end, gline, parse_line_callback);
+            this->parse_line(skip_line_number(begin), end, gline, parse_line_callback);
         }, 
         line_end_callback);
 }
@@ -215,6 +329,127 @@ bool GCodeReader::parse_file(const std::string &file, callback_t callback, std::
     return ret;
 }
 
+namespace {
+// Whole lines of a G-code file, tokenized by the parallel stage of GCodeReader::parse_file_parallel().
+struct GCodeChunk
+{
+    std::string                         text;
+    std::vector<GCodeReader::GCodeLine> lines;
+    // Position in the file after the new line ending the line, zero if the line is not ended by a new line.
+    std::vector<size_t>                 lines_ends;
+    size_t                              file_pos { 0 };
+};
+} // namespace
+
+bool GCodeReader::parse_file_parallel(const std::string &filename, callback_t callback, std::vector<size_t> &lines_ends)
+{
+    // Large enough to amortize the pipeline overhead, small enough to keep all workers busy on a few MB of G-code.
+    static constexpr const size_t chunk_size = 1024 * 1024;
+
+    lines_ends.clear();
+    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(":  before parse_file_parallel %1%") % filename.c_str();
+
+    FilePtr in{ boost::nowide::fopen(filename.c_str(), "rb") };
+    if (in.f == nullptr)
+        return false;
+
+    std::string       carry;
+    size_t            file_pos = 0;
+    bool              error    = false;
+    bool              eof      = false;
+    // Set by the serial output stage, read by the serial input stage running on another thread.
+    std::atomic<bool> stop { false };
+    m_parsing = true;
+
+    // Read the file up to the last new line of a chunk, the rest of the chunk is carried over to the next one.
+    const auto reader = tbb::make_filter<void, GCodeChunk>(slic3r_tbb_filtermode::serial_in_order,
+        [&in, &carry, &file_pos, &error, &eof, &stop](tbb::flow_control &fc) -> GCodeChunk {
+            GCodeChunk chunk;
+            if (! eof && ! stop) {
+                chunk.text     = std::move(carry);
+                chunk.file_pos = file_pos;
+                carry.clear();
+                for (;;) {
+                    size_t old_size = chunk.text.size();
+                    chunk.text.resize(old_size + chunk_size);
+                    size_t cnt_read = ::fread(chunk.text.data() + old_size, 1, chunk_size, in.f);
+                    chunk.text.resize(old_size + cnt_read);
+                    if (::ferror(in.f)) {
+                        error = true;
+                        chunk.text.clear();
+                        break;
+                    }
+                    if (cnt_read == 0) {
+                        eof = true;
+                        break;
+                    }
+                    // The carried over text does not contain any new line.
+                    if (size_t last_eol = chunk.text.rfind('\n'); last_eol != std::string::npos && last_eol >= old_size) {
+                        carry.assign(chunk.text.begin() + last_eol + 1, chunk.text.end());
+                        chunk.text.resize(last_eol + 1);
+                        break;
+                    }
+                }
+                file_pos += chunk.text.size();
+            }
+            if (chunk.text.empty())
+                fc.stop();
+            return chunk;
+        });
+
+    // Tokenize the lines of a chunk, this does not depend on the lines before.
+    const auto tokenizer = tbb::make_filter<GCodeChunk, GCodeChunk>(slic3r_tbb_filtermode::parallel,
+        [](GCodeChunk chunk) -> GCodeChunk {
+            // The locale is set per thread on Linux and macOS.
+            CNumericLocalesSetter locales_setter;
+            const char *begin = chunk.text.c_str();
+            const char *end   = begin + chunk.text.size();
+            for (const char *c = begin; c != end;) {
+                // The line is terminated by a new line or by the zero at the end of the chunk.
+                const char *line_end = find_line_break(c, end);
+                chunk.lines.emplace_back();
+                std::pair<const char*, const char*> command;
+                parse_line_tokens(skip_line_number(c), line_end, chunk.lines.back(), command);
+                size_t new_line = 0;
+                c = line_end;
+                if (c != end && *c == '\r')
+                    ++ c;
+                if (c != end && *c == '\n')
+                    new_line = chunk.file_pos + (++ c - begin);
+                chunk.lines_ends.emplace_back(new_line);
+            }
+            return chunk;
+        });
+
+    // Update the state depending on the previous lines and call the callback in the order of the lines.
+    const auto output = tbb::make_filter<GCodeChunk, void>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &callback, &lines_ends, &stop](GCodeChunk chunk) {
+            CNumericLocalesSetter locales_setter;
+            for (size_t i = 0; i < chunk.lines.size() && ! stop; ++ i) {
+                const GCodeLine &gline = chunk.lines[i];
+                if (gline.has(E) && m_config.use_relative_e_distances)
+                    m_position[E] = 0;
+                if (m_verbose)
+                    std::cout << gline.m_raw << std::endl;
+                callback(*this, gline);
+                std::pair<const char*, const char*> command;
+                command.first  = skip_whitespaces(gline.m_raw.c_str());
+                command.second = skip_word(command.first);
+                update_coordinates(gline, command);
+                if (chunk.lines_ends[i] != 0)
+                    lines_ends.emplace_back(chunk.lines_ends[i]);
+                if (! m_parsing)
+                    // The callback wishes to exit.
+                    stop = true;
+            }
+        });
+
+    tbb::parallel_pipeline(std::max<size_t>(2, 2 * size_t(tbb::this_task_arena::max_concurrency())), reader & tokenizer & output);
+
+    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(":  finished parse_file_parallel %1%") % filename.c_str();
+    return ! error;
+}
+
 bool GCodeReader::parse_file_raw(const std::string &filename, raw_line_callback_t line_callback)
 {
     return this->parse_file_raw_internal(filename,
@@ -247,7 +482,8 @@ bool GCodeReader::GCodeLine::has(char axis) const
 bool GCodeReader::GCodeLine::has_value(char axis, float &value) const
 {
     assert(is_decimal_separator_point());
-    const char *c = m_raw.c_str();
+    const char *c   = m_raw.c_str();
+    const char *end = c + m_raw.size();
     // Skip the whitespaces.
     c = skip_whitespaces(c);
     // Skip the command.
@@ -261,9 +497,9 @@ bool GCodeReader::GCodeLine::has_value(char axis, float &value) const
         // Check the name of the axis.
         if (*c == axis) {
             // Try to parse the numeric value.
-            char   *pend = nullptr;
-            double  v = strtod(++ c, &pend);
-            if (pend != nullptr && is_end_of_word(*pend)) {
+            double v;
+            auto [pend, ec] = fast_float::from_chars(++ c, end, v);
+            if (pend != c && is_end_of_word(*pend)) {
                 // The axis value has been parsed correctly.
                 value = float(v);
                 return true;
@@ -101,12 +101,16 @@ public:
 
     template<typename Callback>
     void parse_buffer(const std::string &buffer, Callback callback)
+        { this->parse_buffer(buffer.c_str(), buffer.c_str() + buffer.size(), callback); }
+
+    // Parse the lines of [ptr, end) without copying them. The line following the last one at end
+    // has to be terminated by a zero or by a new line, as the lines are parsed up to their end of line.
+    template<typename Callback>
+    void parse_buffer(const char *ptr, const char *end, Callback callback)
     {
-        const char *ptr = buffer.c_str();
-        const char *end = ptr + buffer.size();
         GCodeLine gline;
         m_parsing = true;
-        while (m_parsing && *ptr != 0) {
+        while (m_parsing && ptr < end && *ptr != 0) {
             gline.reset();
             ptr = this->parse_line(ptr, end, gline, callback);
         }
@@ -134,6 +138,10 @@ public:
     // Collect positions of line ends in the binary G-code to be used by the G-code viewer when memory mapping and displaying section of G-code
     // as an overlay in the 3D scene.
     bool parse_file(const std::string &file, callback_t callback, std::vector<size_t> &lines_ends);
+    // Same as parse_file() with lines_ends, the lines are tokenized on multiple threads in chunks of whole lines.
+    // The callback is called on a single thread at a time in the order of the lines, though not necessarily the calling one,
+    // with the numeric locale set to "C".
+    bool parse_file_parallel(const std::string &file, callback_t callback, std::vector<size_t> &lines_ends);
     // Just read the G-code file line by line, calls callback (const char *begin, const char *end). Returns false if reading the file failed.
     bool parse_file_raw(const std::string &file, raw_line_callback_t callback);
 
@@ -170,6 +178,13 @@ public:
             ; // silence -Wempty-body
         return c;
     }
+    // Find the first '\r', '\n' or zero in [begin, end), returns end if there is none.
+    // Scans 16 characters at a time with SSE2 or NEON when available.
+    static const char*  find_end_of_line(const char *begin, const char *end);
+    // Find the first '\r' or '\n' in [begin, end), returns end if there is none.
+    static const char*  find_line_break(const char *begin, const char *end);
+    // Name of the vector instruction set used by find_end_of_line() and find_line_break().
+    static const char*  simd_name();
 private:
     template<typename ParseLineCallback, typename LineEndCallback>
     bool        parse_file_raw_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback);
@@ -177,7 +192,9 @@ private:
     bool        parse_file_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback);
 
     const char* parse_line_internal(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command);
-    void        update_coordinates(GCodeLine &gline, std::pair<const char*, const char*> &command);
+    // Tokenize a line into gline, independent of the state of the reader.
+    static const char* parse_line_tokens(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command);
+    void        update_coordinates(const GCodeLine &gline, std::pair<const char*, const char*> &command);
 
     GCodeConfig m_config;
     float       m_position[NUM_AXES];
@@ -24,7 +24,10 @@ typename boost::polygon::enable_if<
         typename boost::polygon::geometry_concept<typename std::iterator_traits<SegmentIterator>::value_type>::type>::type>::type,
     void>::type
 VoronoiDiagram::construct_voronoi(const SegmentIterator segment_begin, const SegmentIterator segment_end, const bool try_to_repair_if_needed) {
-    boost::polygon::construct_voronoi(segment_begin, segment_end, &m_voronoi_diagram);
+    // Same as boost::polygon::construct_voronoi(), just with the builder owned by this VoronoiDiagram.
+    m_builder.clear();
+    boost::polygon::insert(segment_begin, segment_end, &m_builder);
+    m_builder.construct(&m_voronoi_diagram);
     if (try_to_repair_if_needed) {
         if (m_issue_type = detect_known_issues(*this, segment_begin, segment_end); m_issue_type != IssueType::NO_ISSUE_DETECTED) {
             if (m_issue_type == IssueType::MISSING_VORONOI_VERTEX) {
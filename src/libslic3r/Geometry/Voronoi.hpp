@@ -161,6 +161,8 @@ private:
     static bool has_finite_edge_with_non_finite_vertex(const VoronoiDiagram &voronoi_diagram);
 
     voronoi_diagram_type  m_voronoi_diagram;
+    // Kept between the constructions, so a VoronoiDiagram reused for several inputs also reuses the buffers of the builder.
+    boost::polygon::default_voronoi_builder m_builder;
     vertex_container_type m_vertices;
     edge_container_type   m_edges;
     cell_container_type   m_cells;
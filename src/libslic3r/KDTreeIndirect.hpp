@@ -7,6 +7,8 @@
 #include <limits>
 #include <vector>
 
+#include <tbb/parallel_invoke.h>
+
 #include "Utils.hpp" // for next_highest_power_of_2()
 
 namespace Slic3r {
@@ -76,6 +78,16 @@ public:
         visit_recursive(0, 0, visitor);
     }
 
+    // Visit the tree for a closest point search. The child on the side of the query point is descended first, the other child
+    // is only descended if its splitting plane is still closer than the search radius after the first child was visited.
+    // Visitor::operator()(idx) is called for each visited point, Visitor::search_radius() returns the current squared search radius.
+    template<typename PointType, typename Visitor>
+    void visit_closest_first(const PointType &point, Visitor &visitor) const
+    {
+        if (! m_nodes.empty())
+            visit_closest_first_recursive(0, 0, point, visitor);
+    }
+
     CoordinateFn coordinate;
 
 private:
@@ -102,11 +114,23 @@ private:
         size_t next_dimension = dimension;
         if (++ next_dimension == NumDimensions)
             next_dimension = 0;
-        if (center > left)
-            build_recursive(input, node * 2 + 1, next_dimension, left, center - 1);
-        build_recursive(input, node * 2 + 2, next_dimension, center + 1, right);
+        // The subtrees occupy disjoint ranges of both the input and m_nodes, thus large subtrees are built in parallel.
+        auto build_left = [&]() {
+            if (center > left)
+                build_recursive(input, node * 2 + 1, next_dimension, left, center - 1);
+        };
+        auto build_right = [&]() { build_recursive(input, node * 2 + 2, next_dimension, center + 1, right); };
+        if (right - left > ParallelBuildThreshold)
+            tbb::parallel_invoke(build_left, build_right);
+        else {
+            build_left();
+            build_right();
+        }
     }
 
+    // Minimum number of points in a subtree to build its two children in parallel.
+    static constexpr size_t ParallelBuildThreshold = 16384;
+
        // Partition the input m_nodes <left, right> at "k" and "dimension" using the QuickSelect method:
        // https://en.wikipedia.org/wiki/Quickselect
        // Items left of the k'th item are lower than the k'th item in the "dimension",
@@ -186,6 +210,24 @@ private:
         }
     }
 
+    template<typename PointType, typename Visitor>
+    void visit_closest_first_recursive(size_t node, size_t dimension, const PointType &point, Visitor &visitor) const
+    {
+        if (node >= m_nodes.size() || m_nodes[node] == npos)
+            return;
+
+        size_t idx = m_nodes[node];
+        visitor(idx);
+        CoordType dist           = CoordType(point[dimension]) - this->coordinate(idx, dimension);
+        size_t    near_node      = (dist > CoordType(0)) ? node * 2 + 2 : node * 2 + 1;
+        size_t    far_node       = (dist > CoordType(0)) ? node * 2 + 1 : node * 2 + 2;
+        size_t    next_dimension = (dimension + 1 == NumDimensions) ? 0 : dimension + 1;
+        visit_closest_first_recursive(near_node, next_dimension, point, visitor);
+        // The plane intersects a hypersphere centered at point of the search radius, which may have shrunk while visiting near_node.
+        if (dist * dist < visitor.search_radius() + CoordType(EPSILON))
+            visit_closest_first_recursive(far_node, next_dimension, point, visitor);
+    }
+
     std::vector<size_t> m_nodes;
 };
 
@@ -218,7 +260,7 @@ std::array<size_t, K> find_closest_points(
             results.fill(std::make_pair(Tree::npos,
                                         std::numeric_limits<CoordT>::max()));
         }
-        unsigned int operator()(size_t idx, size_t dimension)
+        void operator()(size_t idx)
         {
             if (this->filter(idx)) {
                 auto dist = CoordT(0);
@@ -238,13 +280,12 @@ std::array<size_t, K> find_closest_points(
                     *it = res;
                 }
             }
-            return kdtree.descent_mask(point[dimension],
-                                       results.front().second, idx,
-                                       dimension);
         }
+        // Squared distance of the K-th closest point found so far.
+        CoordT search_radius() const { return results.back().second; }
     } visitor(kdtree, point, filter);
 
-    kdtree.visit(visitor);
+    kdtree.visit_closest_first(point, visitor);
     std::array<size_t, K> ret;
     for (size_t i = 0; i < K; i++) ret[i] = visitor.results[i].first;
 
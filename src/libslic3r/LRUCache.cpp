@@ -0,0 +1,94 @@
+#include "LRUCache.hpp"
+
+#include <algorithm>
+#include <optional>
+
+namespace Slic3r {
+
+namespace {
+
+struct LRUCacheRegistry
+{
+    std::mutex                      mutex;
+    std::vector<LRUCacheBase*>      caches;
+    std::optional<size_t>           total_capacity;
+};
+
+LRUCacheRegistry& lru_cache_registry()
+{
+    static LRUCacheRegistry registry;
+    return registry;
+}
+
+} // anonymous namespace
+
+void LRUCacheBase::set_capacity(size_t capacity)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    this->evict();
+}
+
+size_t LRUCacheBase::capacity() const
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+void LRUCacheBase::clear()
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    this->clear_entries();
+    m_size = 0;
+}
+
+LRUCacheBase::Stats LRUCacheBase::stats() const
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    return { m_hits, m_misses, this->num_entries(), m_size };
+}
+
+void LRUCacheBase::distribute_capacity(const std::vector<LRUCacheBase*> &caches, size_t total_capacity)
+{
+    size_t total_default = 0;
+    for (const LRUCacheBase *cache : caches)
+        total_default += cache->m_default_capacity;
+    for (LRUCacheBase *cache : caches)
+        cache->set_capacity(total_default == 0 ? 0 : size_t(double(total_capacity) * double(cache->m_default_capacity) / double(total_default)));
+}
+
+void LRUCacheBase::register_cache()
+{
+    LRUCacheRegistry &registry = lru_cache_registry();
+    std::scoped_lock<std::mutex> lock(registry.mutex);
+    registry.caches.emplace_back(this);
+    if (registry.total_capacity)
+        distribute_capacity(registry.caches, *registry.total_capacity);
+}
+
+void LRUCacheBase::unregister_cache()
+{
+    LRUCacheRegistry &registry = lru_cache_registry();
+    std::scoped_lock<std::mutex> lock(registry.mutex);
+    registry.caches.erase(std::remove(registry.caches.begin(), registry.caches.end(), this), registry.caches.end());
+    if (registry.total_capacity)
+        distribute_capacity(registry.caches, *registry.total_capacity);
+}
+
+void LRUCacheBase::set_total_capacity(size_t capacity)
+{
+    LRUCacheRegistry &registry = lru_cache_registry();
+    std::scoped_lock<std::mutex> lock(registry.mutex);
+    registry.total_capacity = capacity;
+    distribute_capacity(registry.caches, capacity);
+}
+
+void LRUCacheBase::clear_all()
+{
+    LRUCacheRegistry &registry = lru_cache_registry();
+    std::scoped_lock<std::mutex> lock(registry.mutex);
+    for (LRUCacheBase *cache : registry.caches)
+        cache->clear();
+}
+
+} // namespace Slic3r
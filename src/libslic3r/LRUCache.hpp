@@ -0,0 +1,159 @@
+#ifndef slic3r_LRUCache_hpp_
+#define slic3r_LRUCache_hpp_
+
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Slic3r {
+
+// Type independent part of LRUCache. All the caches of the process are registered, so that the application
+// may bound their total memory footprint and drop their content when the project is closed.
+class LRUCacheBase
+{
+public:
+    virtual ~LRUCacheBase() = default;
+
+    // Capacity in bytes of the estimated memory footprint of the cached entries, 0 disables the cache.
+    void                    set_capacity(size_t capacity);
+    size_t                  capacity() const;
+    void                    clear();
+
+    struct Stats {
+        size_t              hits { 0 };
+        size_t              misses { 0 };
+        size_t              entries { 0 };
+        size_t              size { 0 };
+    };
+    Stats                   stats() const;
+
+    // Split the capacity among all the caches of the process in proportion to their default capacities.
+    // The split is applied to the caches constructed later as well.
+    static void             set_total_capacity(size_t capacity);
+    // Drop the content of all the caches of the process, for example when the project is closed.
+    static void             clear_all();
+
+protected:
+    explicit LRUCacheBase(size_t default_capacity) : m_default_capacity(default_capacity), m_capacity(default_capacity) {}
+
+    // To be called by the derived class once it is fully constructed, respectively before it is destructed.
+    void                    register_cache();
+    void                    unregister_cache();
+    // Called with the registry locked.
+    static void             distribute_capacity(const std::vector<LRUCacheBase*> &caches, size_t total_capacity);
+
+    // Called with m_mutex locked.
+    virtual void            clear_entries() = 0;
+    virtual void            evict() = 0;
+    virtual size_t          num_entries() const = 0;
+
+    mutable std::mutex      m_mutex;
+    const size_t            m_default_capacity;
+    size_t                  m_capacity;
+    size_t                  m_size { 0 };
+    size_t                  m_hits { 0 };
+    size_t                  m_misses { 0 };
+};
+
+// Thread safe cache of values, which are expensive to calculate, bounded by the estimated memory footprint of the entries.
+// Least recently used entries are dropped once the cache exceeds its capacity.
+// Key shall hold everything the value is calculated from, as a hash collision must not return a wrong value.
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUCache : public LRUCacheBase
+{
+public:
+    explicit LRUCache(size_t default_capacity) : LRUCacheBase(default_capacity) { this->register_cache(); }
+    ~LRUCache() override { this->unregister_cache(); }
+
+    // Returns true and copies the cached value to out if key is cached.
+    bool get(const Key &key, Value &out)
+    {
+        std::scoped_lock<std::mutex> lock(m_mutex);
+        if (m_capacity == 0)
+            return false;
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            ++ m_misses;
+            return false;
+        }
+        ++ m_hits;
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+        out = it->second.value;
+        return true;
+    }
+
+    // Returns true and moves the cached value to out if key is cached. The entry is removed from the cache.
+    bool take(const Key &key, Value &out)
+    {
+        std::scoped_lock<std::mutex> lock(m_mutex);
+        if (m_capacity == 0)
+            return false;
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            ++ m_misses;
+            return false;
+        }
+        ++ m_hits;
+        out = std::move(it->second.value);
+        m_size -= it->second.size;
+        m_lru.erase(it->second.lru);
+        m_entries.erase(it);
+        return true;
+    }
+
+    // size is the estimated memory footprint of the key and of the value. An entry already cached is kept,
+    // it was calculated concurrently from the same inputs.
+    void put(Key key, Value value, size_t size)
+    {
+        size += sizeof(Entry) + sizeof(Key);
+        std::scoped_lock<std::mutex> lock(m_mutex);
+        if (size > m_capacity)
+            return;
+        auto [it, inserted] = m_entries.try_emplace(std::move(key));
+        if (! inserted)
+            return;
+        it->second.value = std::move(value);
+        it->second.size  = size;
+        it->second.lru   = m_lru.insert(m_lru.begin(), &it->first);
+        m_size += size;
+        this->evict();
+    }
+
+protected:
+    void clear_entries() override
+    {
+        m_entries.clear();
+        m_lru.clear();
+    }
+
+    void evict() override
+    {
+        while (m_size > m_capacity && ! m_lru.empty()) {
+            auto it = m_entries.find(*m_lru.back());
+            assert(it != m_entries.end());
+            m_size -= it->second.size;
+            m_lru.pop_back();
+            m_entries.erase(it);
+        }
+    }
+
+    size_t num_entries() const override { return m_entries.size(); }
+
+private:
+    struct Entry {
+        Value                                   value;
+        size_t                                  size;
+        typename std::list<const Key*>::iterator lru;
+    };
+
+    std::unordered_map<Key, Entry, Hash>        m_entries;
+    // Most recently used first.
+    std::list<const Key*>                       m_lru;
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_LRUCache_hpp_
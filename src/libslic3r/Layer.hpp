@@ -19,6 +19,7 @@ class LayerRegion;
 using LayerRegionPtrs = std::vector<LayerRegion*>;
 class PrintRegion;
 class PrintObject;
+class PerimeterIslandCache;
 
 namespace FillAdaptive {
     struct Octree;
@@ -81,7 +82,8 @@ public:
     void    prepare_fill_surfaces();
     //BBS
     void    auto_circle_compensation(SurfaceCollection &slices, const AutoContourHolesCompensationParams &auto_contour_holes_compensation_params, float manual_offset = 0.0f);
-    void    make_perimeters(const SurfaceCollection &slices, SurfaceCollection* fill_surfaces, ExPolygons* fill_no_overlap, std::vector<LoopNode> &loop_nodes);
+    // island_cache, if set, shares the perimeters between identical islands of the object.
+    void    make_perimeters(const SurfaceCollection &slices, SurfaceCollection* fill_surfaces, ExPolygons* fill_no_overlap, std::vector<LoopNode> &loop_nodes, PerimeterIslandCache *island_cache = nullptr);
     void    process_external_surfaces(const Layer *lower_layer, const Polygons *lower_layer_covered);
     double  infill_area_threshold() const;
     // Trim surfaces by trimming polygons. Used by the elephant foot compensation at the 1st layer.
@@ -183,7 +185,7 @@ public:
         for (const LayerRegion *layerm : m_regions) if (layerm->slices.any_bottom_contains(item)) return true;
         return false;
     }
-    void                    make_perimeters();
+    void                    make_perimeters(PerimeterIslandCache *island_cache = nullptr);
     //BBS
     void                    calculate_perimeter_continuity(std::vector<LoopNode> &prev_nodes);
     void                    recrod_cooling_node_for_each_extrusion();
@@ -136,7 +136,9 @@ void MeasuringImpl::update_planes()
     const size_t             num_of_facets = m_its.indices.size();
     m_face_to_plane.resize(num_of_facets, size_t(-1));
     const std::vector<Vec3f> face_normals = its_face_normals(m_its);
-    const std::vector<Vec3i> face_neighbors = its_face_neighbors(m_its);
+    // The surface mesh is needed for walking the borders below anyway, reuse its (parallel computed) face neighbors.
+    const SurfaceMesh        sm(m_its);
+    const std::vector<Vec3i>& face_neighbors = sm.face_neighbors();
     std::vector<int>         facet_queue(num_of_facets, 0);
     int                      facet_queue_cnt = 0;
     const stl_normal*        normal_ptr      = nullptr;
@@ -189,8 +191,6 @@ void MeasuringImpl::update_planes()
     assert(std::none_of(m_face_to_plane.begin(), m_face_to_plane.end(), [](size_t val) { return val == size_t(-1); }));
 
     // Now we will walk around each of the planes and save vertices which form the border.
-    const SurfaceMesh sm(m_its);
-
     const auto& face_to_plane = m_face_to_plane;
     auto& planes = m_planes;
 
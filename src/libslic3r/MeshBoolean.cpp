@@ -28,6 +28,8 @@
 #include "mcut/include/mcut/mcut.h"
 #include "boost/log/trivial.hpp"
 
+#include <chrono>
+
 namespace Slic3r {
 namespace MeshBoolean {
 
@@ -496,41 +498,44 @@ struct McutMesh
 void McutMeshDeleter::operator()(McutMesh *ptr) { delete ptr; }
 
 bool empty(const McutMesh &mesh) { return mesh.vertexCoordsArray.empty() || mesh.faceIndicesArray.empty(); }
-void triangle_mesh_to_mcut(const TriangleMesh &src_mesh, McutMesh &srcMesh, const Transform3d &src_nm = Transform3d::Identity())
+static void its_to_mcut(const indexed_triangle_set &its, McutMesh &srcMesh, const Transform3d &src_nm = Transform3d::Identity())
 {
     // vertices precision convention and copy
-    srcMesh.vertexCoordsArray.reserve(src_mesh.its.vertices.size() * 3);
-    for (int i = 0; i < src_mesh.its.vertices.size(); ++i) {
-        const Vec3d v = src_nm * src_mesh.its.vertices[i].cast<double>();
+    srcMesh.vertexCoordsArray.reserve(its.vertices.size() * 3);
+    for (int i = 0; i < its.vertices.size(); ++i) {
+        const Vec3d v = src_nm * its.vertices[i].cast<double>();
         srcMesh.vertexCoordsArray.push_back(v[0]);
         srcMesh.vertexCoordsArray.push_back(v[1]);
         srcMesh.vertexCoordsArray.push_back(v[2]);
     }
 
     // faces copy
-    srcMesh.faceIndicesArray.reserve(src_mesh.its.indices.size() * 3);
-    srcMesh.faceSizesArray.reserve(src_mesh.its.indices.size());
-    for (int i = 0; i < src_mesh.its.indices.size(); ++i) {
-        const int &f0 = src_mesh.its.indices[i][0];
-        const int &f1 = src_mesh.its.indices[i][1];
-        const int &f2 = src_mesh.its.indices[i][2];
+    srcMesh.faceIndicesArray.reserve(its.indices.size() * 3);
+    srcMesh.faceSizesArray.assign(its.indices.size(), (uint32_t) 3);
+    for (int i = 0; i < its.indices.size(); ++i) {
+        const int &f0 = its.indices[i][0];
+        const int &f1 = its.indices[i][1];
+        const int &f2 = its.indices[i][2];
         srcMesh.faceIndicesArray.push_back(f0);
         srcMesh.faceIndicesArray.push_back(f1);
         srcMesh.faceIndicesArray.push_back(f2);
-
-        srcMesh.faceSizesArray.push_back((uint32_t) 3);
     }
 }
 
+void triangle_mesh_to_mcut(const TriangleMesh &src_mesh, McutMesh &srcMesh, const Transform3d &src_nm = Transform3d::Identity())
+{
+    its_to_mcut(src_mesh.its, srcMesh, src_nm);
+}
+
 McutMeshPtr triangle_mesh_to_mcut(const indexed_triangle_set &M)
 {
     std::unique_ptr<McutMesh, McutMeshDeleter> out(new McutMesh{});
-    TriangleMesh                               trimesh(M);
-    triangle_mesh_to_mcut(trimesh, *out.get());
+    its_to_mcut(M, *out.get());
     return out;
 }
 
-TriangleMesh mcut_to_triangle_mesh(const McutMesh &mcutmesh)
+// Intermediate results of the booleans only need the triangles, not the stats a TriangleMesh computes.
+static indexed_triangle_set mcut_to_its(const McutMesh &mcutmesh)
 {
     uint32_t ccVertexCount = mcutmesh.vertexCoordsArray.size() / 3;
     auto    &ccVertices    = mcutmesh.vertexCoordsArray;
@@ -558,17 +563,22 @@ TriangleMesh mcut_to_triangle_mesh(const McutMesh &mcutmesh)
         faceVertexOffsetBase += faceSize;
     }
 
-    TriangleMesh out(vertices, faces);
+    indexed_triangle_set out;
+    out.indices  = std::move(faces);
+    out.vertices = std::move(vertices);
+    out.properties.resize(out.indices.size());
     return out;
 }
 
+TriangleMesh mcut_to_triangle_mesh(const McutMesh &mcutmesh)
+{
+    return TriangleMesh(mcut_to_its(mcutmesh));
+}
+
 void merge_mcut_meshes(McutMesh& src, const McutMesh& cut) {
-    indexed_triangle_set all_its;
-    TriangleMesh tri_src = mcut_to_triangle_mesh(src);
-    TriangleMesh tri_cut = mcut_to_triangle_mesh(cut);
-    its_merge(all_its, tri_src.its);
-    its_merge(all_its, tri_cut.its);
-    src = *triangle_mesh_to_mcut(all_its);
+    indexed_triangle_set all_its = mcut_to_its(src);
+    its_merge(all_its, mcut_to_its(cut));
+    src = std::move(*triangle_mesh_to_mcut(all_its));
     }
 
 MCAPI_ATTR void MCAPI_CALL mcDebugOutput(McDebugSource source,
@@ -753,7 +763,7 @@ bool do_boolean_single(McutMesh &srcMesh, const McutMesh &cutMesh, const std::st
     // destroy context
     err = mcReleaseContext(context);
 
-    srcMesh = outMesh;
+    srcMesh = std::move(outMesh);
 
     return true;
 }
@@ -761,11 +771,8 @@ bool do_boolean_single(McutMesh &srcMesh, const McutMesh &cutMesh, const std::st
 void do_boolean(McutMesh& srcMesh, const McutMesh& cutMesh, const std::string& boolean_opts)
 {
     try {
-        TriangleMesh                      tri_src   = mcut_to_triangle_mesh(srcMesh);
-        std::vector<indexed_triangle_set> src_parts = its_split(tri_src.its);
-
-        TriangleMesh                      tri_cut   = mcut_to_triangle_mesh(cutMesh);
-        std::vector<indexed_triangle_set> cut_parts = its_split(tri_cut.its);
+        std::vector<indexed_triangle_set> src_parts = its_split(mcut_to_its(srcMesh));
+        std::vector<indexed_triangle_set> cut_parts = its_split(mcut_to_its(cutMesh));
 
         if (src_parts.empty() && boolean_opts == "UNION") {
             srcMesh = cutMesh;
@@ -773,6 +780,12 @@ void do_boolean(McutMesh& srcMesh, const McutMesh& cutMesh, const std::string& b
         }
         if (cut_parts.empty()) return;
 
+        // each cut part is used against every source part, convert them to mcut only once
+        std::vector<McutMeshPtr> mcut_cut_parts;
+        mcut_cut_parts.reserve(cut_parts.size());
+        for (const indexed_triangle_set &cut_part : cut_parts)
+            mcut_cut_parts.emplace_back(triangle_mesh_to_mcut(cut_part));
+
         // when src mesh has multiple connected components, mcut refuses to work.
         // But we can force it to work by spliting the src mesh into disconnected components,
         // and do booleans seperately, then merge all the results.
@@ -780,27 +793,22 @@ void do_boolean(McutMesh& srcMesh, const McutMesh& cutMesh, const std::string& b
         if (boolean_opts == "UNION" || boolean_opts == "A_NOT_B") {
             for (size_t i = 0; i < src_parts.size(); i++) {
                 auto src_part = triangle_mesh_to_mcut(src_parts[i]);
-                for (size_t j = 0; j < cut_parts.size(); j++) {
-                    auto cut_part = triangle_mesh_to_mcut(cut_parts[j]);
-                    do_boolean_single(*src_part, *cut_part, boolean_opts);
-                }
-                TriangleMesh tri_part = mcut_to_triangle_mesh(*src_part);
-                its_merge(all_its, tri_part.its);
+                for (size_t j = 0; j < cut_parts.size(); j++)
+                    do_boolean_single(*src_part, *mcut_cut_parts[j], boolean_opts);
+                its_merge(all_its, mcut_to_its(*src_part));
             }
         } else if (boolean_opts == "INTERSECTION") {
             for (size_t i = 0; i < src_parts.size(); i++) {
+                McutMeshPtr src_mcut = triangle_mesh_to_mcut(src_parts[i]);
                 for (size_t j = 0; j < cut_parts.size(); j++) {
-                    auto src_part = triangle_mesh_to_mcut(src_parts[i]);
-                    auto cut_part = triangle_mesh_to_mcut(cut_parts[j]);
-                    bool success  = do_boolean_single(*src_part, *cut_part, boolean_opts);
-                    if (success) {
-                        TriangleMesh tri_part = mcut_to_triangle_mesh(*src_part);
-                        its_merge(all_its, tri_part.its);
-                    }
+                    McutMesh src_part = *src_mcut;
+                    bool success  = do_boolean_single(src_part, *mcut_cut_parts[j], boolean_opts);
+                    if (success)
+                        its_merge(all_its, mcut_to_its(src_part));
                 }
             }
         }
-        srcMesh = *triangle_mesh_to_mcut(all_its);
+        srcMesh = std::move(*triangle_mesh_to_mcut(all_its));
     } catch (const std::exception &e) {
         BOOST_LOG_TRIVIAL(error) << "check error:" << e.what();
     }
@@ -808,12 +816,16 @@ void do_boolean(McutMesh& srcMesh, const McutMesh& cutMesh, const std::string& b
 
 void make_boolean(const TriangleMesh &src_mesh, const TriangleMesh &cut_mesh, std::vector<TriangleMesh> &dst_mesh, const std::string &boolean_opts)
 {
+    auto start = std::chrono::steady_clock::now();
     McutMesh srcMesh, cutMesh;
     triangle_mesh_to_mcut(src_mesh, srcMesh);
     triangle_mesh_to_mcut(cut_mesh, cutMesh);
     //dst_mesh = make_boolean(srcMesh, cutMesh, boolean_opts);
     do_boolean(srcMesh, cutMesh, boolean_opts);
     TriangleMesh tri_src = mcut_to_triangle_mesh(srcMesh);
+    BOOST_LOG_TRIVIAL(info) << "mcut " << boolean_opts << " of " << src_mesh.facets_count() << " and " << cut_mesh.facets_count() << " facets into "
+                            << tri_src.facets_count() << " facets took "
+                            << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() << " ms";
     if (!tri_src.empty())
         dst_mesh.push_back(std::move(tri_src));
 }
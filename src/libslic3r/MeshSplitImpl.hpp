@@ -5,6 +5,8 @@
 #include "libnest2d/tools/benchmark.h"
 #include "Execution/ExecutionTBB.hpp"
 
+#include <numeric>
+
 namespace Slic3r {
 
 template<class ExPolicy>
@@ -89,6 +91,33 @@ private:
     size_t                       m_seed { 0 };
 };
 
+// Label all the facets with the index of their patch first, then bucket them by the patch index. The facets of each patch
+// are thus listed in increasing order without sorting, which used to dominate splitting of large meshes.
+// The facets of the i-th patch are stored in facets[part_begin[i] .. part_begin[i + 1]).
+template<class NeighborIndex>
+void collect_patches(NeighborVisitor<NeighborIndex> &visitor, std::vector<size_t> &facets, std::vector<size_t> &part_begin)
+{
+    const size_t        num_facets = visitor.its.indices.size();
+    std::vector<size_t> facet_part(num_facets);
+    size_t              num_parts  = 0;
+    for (;; ++ num_parts) {
+        bool has_some = false;
+        visitor.visit([&facet_part, &has_some, num_parts](size_t idx) { facet_part[idx] = num_parts; has_some = true; return true; });
+        if (! has_some)
+            break;
+    }
+
+    part_begin.assign(num_parts + 1, 0);
+    for (size_t part_id : facet_part)
+        ++ part_begin[part_id + 1];
+    std::partial_sum(part_begin.begin(), part_begin.end(), part_begin.begin());
+
+    std::vector<size_t> cursor(part_begin.begin(), part_begin.end() - 1);
+    facets.assign(num_facets, 0);
+    for (size_t face_id = 0; face_id < num_facets; ++ face_id)
+        facets[cursor[facet_part[face_id]] ++] = face_id;
+}
+
 } // namespace meshsplit_detail
 
 // Funky wrapper for timinig of its_split() using various neighbor index creating methods, see sandboxes/its_neighbor_index/main.cpp
@@ -139,21 +168,18 @@ void its_split(const Its &m, OutputIt out_it)
 
     meshsplit_detail::NeighborVisitor visitor(its, meshsplit_detail::ItsWithNeighborsIndex_<Its>::get_index(m));
 
-    std::vector<size_t> facets;
-    for (size_t part_id = 0;; ++part_id) {
-        // Collect all faces of the next patch.
-        facets.clear();
-        visitor.visit([&facets](size_t idx) { facets.emplace_back(idx); return true; });
-        if (facets.empty())
-            break;
-        std::sort(facets.begin(),facets.end());
+    std::vector<size_t> facets, part_begin;
+    collect_patches(visitor, facets, part_begin);
+    for (size_t part_id = 0; part_id + 1 < part_begin.size(); ++part_id) {
+        const size_t num_facets = part_begin[part_id + 1] - part_begin[part_id];
         // Create a new mesh for the part that was just split off.
         indexed_triangle_set mesh;
-        mesh.indices.reserve(facets.size());
-        mesh.vertices.reserve(std::min(facets.size() * 3, its.vertices.size()));
+        mesh.indices.reserve(num_facets);
+        mesh.vertices.reserve(std::min(num_facets * 3, its.vertices.size()));
 
         // Assign the facets to the new mesh.
-        for (size_t face_id : facets) {
+        for (size_t i = part_begin[part_id]; i < part_begin[part_id + 1]; ++i) {
+            const size_t face_id = facets[i];
             const auto &face = its.indices[face_id];
             Vec3i       new_face;
             for (size_t v = 0; v < 3; ++v) {
@@ -201,23 +227,18 @@ void its_split_and_keep_relationship(const Its &m, OutputIt out_it, OutputIt_shi
 
     meshsplit_detail::NeighborVisitor visitor(its, meshsplit_detail::ItsWithNeighborsIndex_<Its>::get_index(m));
 
-    std::vector<size_t> facets;
-    for (size_t part_id = 0;; ++part_id) {
-        // Collect all faces of the next patch.
-        facets.clear();
-        visitor.visit([&facets](size_t idx) {
-            facets.emplace_back(idx);
-            return true;
-        });
-        if (facets.empty()) break;
-        std::sort(facets.begin(), facets.end());
+    std::vector<size_t> facets, part_begin;
+    collect_patches(visitor, facets, part_begin);
+    for (size_t part_id = 0; part_id + 1 < part_begin.size(); ++part_id) {
+        const size_t num_facets = part_begin[part_id + 1] - part_begin[part_id];
         // Create a new mesh for the part that was just split off.
         indexed_triangle_set mesh;
-        mesh.indices.reserve(facets.size());
-        mesh.vertices.reserve(std::min(facets.size() * 3, its.vertices.size()));
+        mesh.indices.reserve(num_facets);
+        mesh.vertices.reserve(std::min(num_facets * 3, its.vertices.size()));
         std::unordered_map<int, int> relationship;
         // Assign the facets to the new mesh.
-        for (size_t face_id : facets) {
+        for (size_t i = part_begin[part_id]; i < part_begin[part_id + 1]; ++i) {
+            const size_t face_id = facets[i];
             const auto &face = its.indices[face_id];
             Vec3i       new_face;
             for (size_t v = 0; v < 3; ++v) {
@@ -21,6 +21,7 @@
 #include <float.h>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/container_hash/hash.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/string_file.hpp>
@@ -345,6 +346,8 @@ Model Model::read_from_file(const std::string&
     for (ModelObject *o : model.objects)
         o->input_file = input_file;
 
+    model.share_identical_meshes();
+
     if (options & LoadStrategy::AddDefaultInstances)
         model.add_default_instances();
 
@@ -901,6 +904,57 @@ int Model::removed_objects_with_zero_volume()
     return removed;
 }
 
+static size_t its_content_hash(const indexed_triangle_set &its)
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, its.vertices.size());
+    boost::hash_combine(seed, its.indices.size());
+    for (const stl_vertex &v : its.vertices)
+        for (int i = 0; i < 3; ++ i)
+            boost::hash_combine(seed, v(i));
+    for (const stl_triangle_vertex_indices &f : its.indices)
+        for (int i = 0; i < 3; ++ i)
+            boost::hash_combine(seed, f(i));
+    return seed;
+}
+
+static bool meshes_identical(const TriangleMesh &lhs, const TriangleMesh &rhs)
+{
+    if (lhs.its.vertices != rhs.its.vertices || lhs.its.indices != rhs.its.indices || lhs.get_init_shift() != rhs.get_init_shift() ||
+        lhs.its.properties.size() != rhs.its.properties.size())
+        return false;
+    for (size_t i = 0; i < lhs.its.properties.size(); ++ i)
+        if (lhs.its.properties[i].type != rhs.its.properties[i].type || lhs.its.properties[i].area != rhs.its.properties[i].area)
+            return false;
+    return true;
+}
+
+size_t Model::share_identical_meshes()
+{
+    // Copied parts and repeated components of imported assemblies often carry the very same mesh, store it only once.
+    std::unordered_map<size_t, std::vector<ModelVolume*>> volumes_by_hash;
+    size_t shared = 0;
+    for (ModelObject *object : this->objects)
+        for (ModelVolume *volume : object->volumes) {
+            const TriangleMesh &mesh = volume->mesh();
+            if (mesh.empty())
+                continue;
+            std::vector<ModelVolume*> &candidates = volumes_by_hash[its_content_hash(mesh.its)];
+            auto it = std::find_if(candidates.begin(), candidates.end(), [&mesh](const ModelVolume *other) {
+                return other->mesh_ptr() == &mesh || meshes_identical(other->mesh(), mesh);
+            });
+            if (it == candidates.end()) {
+                candidates.emplace_back(volume);
+            } else if ((*it)->mesh_ptr() != &mesh) {
+                volume->m_mesh = (*it)->m_mesh;
+                if ((*it)->m_convex_hull)
+                    volume->m_convex_hull = (*it)->m_convex_hull;
+                ++ shared;
+            }
+        }
+    return shared;
+}
+
 void Model::adjust_min_z()
 {
     if (objects.empty())
@@ -2842,8 +2896,15 @@ unsigned int ModelObject::update_instances_print_volume_state(const BuildVolume
                     case BuildVolume::Type::Convex:
                     case BuildVolume::Type::Custom:
                     default:
-                        state = build_volume.object_state(vol->mesh().its, matrix.cast<float>(), true /* may be below print bed */);
+                    {
+                        // BBS: all the tested build volumes are convex, thus the volume is inside if its convex hull is inside,
+                        // and it is below the print bed if its convex hull is. Only test the vertices of the full mesh near the boundary.
+                        const Transform3f trafo = matrix.cast<float>();
+                        state = build_volume.object_state(vol->get_convex_hull().its, trafo, true /* may be below print bed */);
+                        if (state != BuildVolume::ObjectState::Inside && state != BuildVolume::ObjectState::Below)
+                            state = build_volume.object_state(vol->mesh().its, trafo, true /* may be below print bed */);
                         break;
+                    }
                 }
 
                 if (state == BuildVolume::ObjectState::Inside)
@@ -3116,6 +3177,7 @@ void ModelVolume::center_geometry_after_creation(bool update_source_offset)
     Vec3d shift = this->mesh().bounding_box().center();
     if (!shift.isApprox(Vec3d::Zero()))
     {
+        this->detach_shared_geometry();
         if (m_mesh) {
             const_cast<TriangleMesh*>(m_mesh.get())->translate(-(float)shift(0), -(float)shift(1), -(float)shift(2));
             const_cast<TriangleMesh*>(m_mesh.get())->set_init_shift(shift);
@@ -3129,6 +3191,15 @@ void ModelVolume::center_geometry_after_creation(bool update_source_offset)
         source.mesh_offset = shift;
 }
 
+void ModelVolume::detach_shared_geometry()
+{
+    // The mesh and the convex hull may be shared with other volumes (see Model::share_identical_meshes()) or with the undo / redo stack.
+    if (m_mesh && m_mesh.use_count() > 1)
+        m_mesh = std::make_shared<const TriangleMesh>(*m_mesh);
+    if (m_convex_hull && m_convex_hull.use_count() > 1)
+        m_convex_hull = std::make_shared<const TriangleMesh>(*m_convex_hull);
+}
+
 void ModelVolume::calculate_convex_hull()
 {
     m_convex_hull = std::make_shared<TriangleMesh>(this->mesh().convex_hull_3d());
@@ -3418,6 +3489,7 @@ void ModelVolume::mirror(Axis axis)
 // This method could only be called before the meshes of this ModelVolumes are not shared!
 void ModelVolume::scale_geometry_after_creation(const Vec3f& versor)
 {
+    this->detach_shared_geometry();
 	const_cast<TriangleMesh*>(m_mesh.get())->scale(versor);
     if (m_convex_hull->empty())
         //BBS: recompute the convex hull if it is null for previous too small
@@ -4085,7 +4157,9 @@ std::string FacetsAnnotation::get_triangle_as_string(int triangle_idx) const
     if (triangle_it != m_data.first.end() && triangle_it->first == triangle_idx) {
         int offset = triangle_it->second;
         int end    = ++ triangle_it == m_data.first.end() ? int(m_data.second.size()) : triangle_it->second;
-        while (offset < end) {
+        // The nibbles are written in reverse order, fill the string from its back instead of inserting at its front.
+        out.assign(size_t(end - offset) / 4, '0');
+        for (auto digit_it = out.rbegin(); offset < end; ++ digit_it) {
             int next_code = 0;
             for (int i=3; i>=0; --i) {
                 next_code = next_code << 1;
@@ -4094,8 +4168,7 @@ std::string FacetsAnnotation::get_triangle_as_string(int triangle_idx) const
             offset += 4;
 
             assert(next_code >=0 && next_code <= 15);
-            char digit = next_code < 10 ? next_code + '0' : (next_code-10)+'A';
-            out.insert(out.begin(), digit);
+            *digit_it = next_code < 10 ? next_code + '0' : (next_code-10)+'A';
         }
     }
     return out;
@@ -4121,7 +4194,7 @@ void FacetsAnnotation::set_triangle_from_string(int triangle_id, const std::stri
 
         // Convert to binary and append into code.
         for (int i=0; i<4; ++i)
-            m_data.second.insert(m_data.second.end(), bool(dec & (1 << i)));
+            m_data.second.push_back(bool(dec & (1 << i)));
     }
 }
 
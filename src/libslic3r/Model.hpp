@@ -992,12 +992,12 @@ public:
     void                rotate(double angle, const Vec3d& axis);
     void                mirror(Axis axis);
 
-    // This method could only be called before the meshes of this ModelVolumes are not shared!
+    // Scales the mesh in place, a mesh shared with other volumes is detached first.
     void                scale_geometry_after_creation(const Vec3f &versor);
     void                scale_geometry_after_creation(const float scale) { this->scale_geometry_after_creation(Vec3f(scale, scale, scale)); }
 
     // Translates the mesh and the convex hull so that the origin of their vertices is in the center of this volume's bounding box.
-    // Attention! This method may only be called just after ModelVolume creation! It must not be called once the TriangleMesh of this ModelVolume is shared!
+    // Attention! This method may only be called just after ModelVolume creation! A mesh shared with other volumes is detached first.
     void                center_geometry_after_creation(bool update_source_offset = true);
 
     void                calculate_convex_hull();
@@ -1097,6 +1097,8 @@ private:
 
     //BBS: add convex_hell_2d related logic
     void  calculate_convex_hull_2d(const Geometry::Transformation &transformation) const;
+    // Take private copies of the mesh and the convex hull if they are shared, before modifying them in place.
+    void  detach_shared_geometry();
 
     // flag to optimize the checking if the volume is splittable
     //     -1   ->   is unknown value (before first cheking)
@@ -1678,6 +1680,8 @@ public:
     bool          looks_like_saved_in_meters() const;
     void          convert_from_meters(bool only_small_volumes);
     int           removed_objects_with_zero_volume();
+    // Let the volumes with byte-identical meshes share a single TriangleMesh and convex hull, returns the number of volumes re-pointed.
+    size_t        share_identical_meshes();
 
     // Ensures that the min z of the model is not negative
     void 		  adjust_min_z();
@@ -11,9 +11,11 @@
 #include <utility>
 #include <unordered_set>
 
+#include <boost/container_hash/hash.hpp>
 #include <boost/log/trivial.hpp>
 #include <tbb/parallel_for.h>
 #include <mutex>
+#include <string_view>
 #include <boost/thread/lock_guard.hpp>
 
 //#define MM_SEGMENTATION_DEBUG_PAINT_LINE
@@ -2091,6 +2093,81 @@ static bool has_layer_only_one_color(const std::vector<ColoredLines> &colored_po
     return true;
 }
 
+MultiMaterialSegmentationCache& MultiMaterialSegmentationCache::instance()
+{
+    static MultiMaterialSegmentationCache cache;
+    return cache;
+}
+
+bool MultiMaterialSegmentationCacheKey::Painting::operator==(const Painting &rhs) const
+{
+    if (hash != rhs.hash || num_extruders != rhs.num_extruders || trafo.matrix() != rhs.trafo.matrix() || center_offset != rhs.center_offset ||
+        volumes.size() != rhs.volumes.size())
+        return false;
+    for (size_t i = 0; i < volumes.size(); ++ i) {
+        const Volume &l = volumes[i];
+        const Volume &r = rhs.volumes[i];
+        if (l.matrix.matrix() != r.matrix.matrix() || l.facets != r.facets ||
+            (l.mesh != r.mesh && (l.mesh->its.vertices != r.mesh->its.vertices || l.mesh->its.indices != r.mesh->its.indices)))
+            return false;
+    }
+    return true;
+}
+
+// Everything the projection of the painted triangles depends on, except for the layer slices.
+static std::shared_ptr<const MultiMaterialSegmentationCacheKey::Painting> mmu_painting(const PrintObject &print_object, const size_t num_extruders)
+{
+    std::hash<std::string_view> hash;
+    auto hash_bytes = [&hash](const void *data, size_t size) { return hash(std::string_view(reinterpret_cast<const char*>(data), size)); };
+    auto painting = std::make_shared<MultiMaterialSegmentationCacheKey::Painting>();
+    painting->num_extruders = num_extruders;
+    painting->trafo         = print_object.trafo();
+    painting->center_offset = print_object.center_offset();
+    size_t seed = num_extruders;
+    boost::hash_combine(seed, hash_bytes(print_object.trafo().data(), 16 * sizeof(double)));
+    boost::hash_combine(seed, print_object.center_offset().x());
+    boost::hash_combine(seed, print_object.center_offset().y());
+    for (const ModelVolume *mv : print_object.model_object()->volumes) {
+        if (! mv->is_model_part() || mv->mmu_segmentation_facets.empty())
+            continue;
+        const indexed_triangle_set &its = mv->mesh().its;
+        painting->volumes.push_back({ mv->get_mesh_shared_ptr(), mv->get_matrix(), mv->mmu_segmentation_facets.get_data() });
+        const auto &data = painting->volumes.back().facets;
+        boost::hash_combine(seed, hash_bytes(its.vertices.data(), its.vertices.size() * sizeof(stl_vertex)));
+        boost::hash_combine(seed, hash_bytes(its.indices.data(), its.indices.size() * sizeof(stl_triangle_vertex_indices)));
+        boost::hash_combine(seed, hash_bytes(mv->get_matrix().data(), 16 * sizeof(double)));
+        boost::hash_combine(seed, hash_bytes(data.first.data(), data.first.size() * sizeof(std::pair<int, int>)));
+        boost::hash_combine(seed, std::hash<std::vector<bool>>()(data.second));
+    }
+    painting->hash = seed;
+    return painting;
+}
+
+static size_t expolygons_hash(const ExPolygons &expolygons)
+{
+    std::hash<std::string_view> hash;
+    auto hash_points = [&hash](const Points &points) { return hash(std::string_view(reinterpret_cast<const char*>(points.data()), points.size() * sizeof(Point))); };
+    size_t seed = expolygons.size();
+    for (const ExPolygon &expolygon : expolygons) {
+        boost::hash_combine(seed, hash_points(expolygon.contour.points));
+        boost::hash_combine(seed, expolygon.holes.size());
+        for (const Polygon &hole : expolygon.holes)
+            boost::hash_combine(seed, hash_points(hole.points));
+    }
+    return seed;
+}
+
+static size_t expolygons_memory_size(const ExPolygons &expolygons)
+{
+    size_t size = expolygons.size() * sizeof(ExPolygon);
+    for (const ExPolygon &expolygon : expolygons) {
+        size += expolygon.contour.size() * sizeof(Point);
+        for (const Polygon &hole : expolygon.holes)
+            size += sizeof(Polygon) + hole.size() * sizeof(Point);
+    }
+    return size;
+}
+
 std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(const PrintObject &print_object, const std::function<void()> &throw_on_cancel_callback)
 {
     const size_t                          num_extruders = print_object.print()->config().filament_colour.size();
@@ -2102,6 +2179,11 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
     std::vector<EdgeGrid::Grid>           edge_grids(num_layers);
     const ConstLayerPtrsAdaptor           layers = print_object.layers();
     std::vector<ExPolygons>               input_expolygons(num_layers);
+    // BBS: Layers segmented already by a previous slicing with the same painting and the same layer slices.
+    MultiMaterialSegmentationCache       &cache         = MultiMaterialSegmentationCache::instance();
+    const std::shared_ptr<const MultiMaterialSegmentationCacheKey::Painting> painting = mmu_painting(print_object, num_extruders);
+    std::vector<MultiMaterialSegmentationCacheKey> cache_keys(num_layers);
+    std::vector<uint8_t>                  layer_cached(num_layers, false);
 
     throw_on_cancel_callback();
 
@@ -2111,7 +2193,7 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
 
     // Merge all regions and remove small holes
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - slices preparation in parallel - begin";
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layers, &input_expolygons, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layers, &input_expolygons, &cache, &painting, &cache_keys, &layer_cached, &segmented_regions, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
         for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
             throw_on_cancel_callback();
             ExPolygons ex_polygons;
@@ -2135,10 +2217,19 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
 #ifdef MM_SEGMENTATION_DEBUG_INPUT
             export_processed_input_expolygons_to_svg(debug_out_path("mm-input-%d-%d.svg", layer_idx, iRun), layers[layer_idx]->regions(), input_expolygons[layer_idx]);
 #endif // MM_SEGMENTATION_DEBUG_INPUT
+
+            size_t hash = painting->hash;
+            boost::hash_combine(hash, expolygons_hash(input_expolygons[layer_idx]));
+            boost::hash_combine(hash, layers[layer_idx]->slice_z);
+            cache_keys[layer_idx]   = { painting, input_expolygons[layer_idx], layers[layer_idx]->slice_z, hash };
+            layer_cached[layer_idx] = cache.get(cache_keys[layer_idx], segmented_regions[layer_idx]);
         }
     }); // end of parallel_for
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - slices preparation in parallel - end";
 
+    const size_t num_layers_cached = std::count(layer_cached.begin(), layer_cached.end(), uint8_t(true));
+    BOOST_LOG_TRIVIAL(debug) << "MM segmentation - layers found in the cache: " << num_layers_cached << " of " << num_layers;
+
     std::vector<BoundingBox> layer_bboxes(num_layers);
     for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
         throw_on_cancel_callback();
@@ -2146,130 +2237,146 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
         layer_bboxes[layer_idx].merge(get_extents(input_expolygons[layer_idx]));
     }
 
-    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
-        throw_on_cancel_callback();
-        BoundingBox bbox = layer_bboxes[layer_idx];
-        // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
-        // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
-        // every projected triangle will be inside the resulting bounding box.
-        if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
-        if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
-        // Projected triangles may slightly exceed the input polygons.
-        bbox.offset(30 * SCALED_EPSILON);
-        edge_grids[layer_idx].set_bbox(bbox);
-        edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layer_bboxes, &layer_cached, &edge_grids, &input_expolygons, &num_layers, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            if (layer_cached[layer_idx])
+                continue;
+            BoundingBox bbox = layer_bboxes[layer_idx];
+            // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
+            // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
+            // every projected triangle will be inside the resulting bounding box.
+            if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
+            if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
+            // Projected triangles may slightly exceed the input polygons.
+            bbox.offset(30 * SCALED_EPSILON);
+            edge_grids[layer_idx].set_bbox(bbox);
+            edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
+        }
+    }); // end of parallel_for
 
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - projection of painted triangles - begin";
-    for (const ModelVolume *mv : print_object.model_object()->volumes) {
+    // BBS: All pairs of a painted volume and an extruder are projected in parallel.
+    std::vector<std::pair<const ModelVolume*, size_t>> painted_volumes;
+    if (num_layers_cached < num_layers)
+        for (const ModelVolume *mv : print_object.model_object()->volumes)
+            if (mv->is_model_part() && !mv->mmu_segmentation_facets.empty())
+                for (size_t extruder_idx = 1; extruder_idx < num_extruders + 1; ++extruder_idx)
+                    painted_volumes.emplace_back(mv, extruder_idx);
 #ifndef MM_SEGMENTATION_DEBUG_PAINT_LINE
-        tbb::parallel_for(tbb::blocked_range<size_t>(1, num_extruders + 1), [&mv, &print_object, &layers, &edge_grids, &painted_lines, &painted_lines_mutex, &input_expolygons, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
-            for (size_t extruder_idx = range.begin(); extruder_idx < range.end(); ++extruder_idx) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, painted_volumes.size(), 1), [&painted_volumes, &print_object, &layers, &edge_grids, &painted_lines, &painted_lines_mutex, &input_expolygons, &layer_cached, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t painted_idx = range.begin(); painted_idx < range.end(); ++painted_idx) {
 #else
-            for (size_t extruder_idx = 1; extruder_idx < num_extruders + 1; ++extruder_idx) {
+        for (size_t painted_idx = 0; painted_idx < painted_volumes.size(); ++painted_idx) {
 #endif
-                throw_on_cancel_callback();
-                const indexed_triangle_set custom_facets = mv->mmu_segmentation_facets.get_facets(*mv, EnforcerBlockerType(extruder_idx));
-                if (!mv->is_model_part() || custom_facets.indices.empty())
-                    continue;
+            throw_on_cancel_callback();
+            const ModelVolume          *mv            = painted_volumes[painted_idx].first;
+            const size_t                extruder_idx  = painted_volumes[painted_idx].second;
+            indexed_triangle_set        custom_facets = mv->mmu_segmentation_facets.get_facets(*mv, EnforcerBlockerType(extruder_idx));
+            if (custom_facets.indices.empty())
+                continue;
 
-                const Transform3f tr = print_object.trafo().cast<float>() * mv->get_matrix().cast<float>();
+            // Transform the shared vertices once instead of three times per facet.
+            const Transform3f tr = print_object.trafo().cast<float>() * mv->get_matrix().cast<float>();
+            for (Vec3f &vertex : custom_facets.vertices)
+                vertex = tr * vertex;
 #ifndef MM_SEGMENTATION_DEBUG_PAINT_LINE
-                tbb::parallel_for(tbb::blocked_range<size_t>(0, custom_facets.indices.size()), [&tr, &custom_facets, &print_object, &layers, &edge_grids, &input_expolygons, &painted_lines, &painted_lines_mutex, &extruder_idx](const tbb::blocked_range<size_t> &range) {
-                    for (size_t facet_idx = range.begin(); facet_idx < range.end(); ++facet_idx) {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, custom_facets.indices.size()), [&custom_facets, &print_object, &layers, &edge_grids, &input_expolygons, &layer_cached, &painted_lines, &painted_lines_mutex, &extruder_idx](const tbb::blocked_range<size_t> &range) {
+                for (size_t facet_idx = range.begin(); facet_idx < range.end(); ++facet_idx) {
 #else
-                    for (size_t facet_idx = 0; facet_idx < custom_facets.indices.size(); ++facet_idx) {
+                for (size_t facet_idx = 0; facet_idx < custom_facets.indices.size(); ++facet_idx) {
 #endif
-                        float min_z = std::numeric_limits<float>::max();
-                        float max_z = std::numeric_limits<float>::lowest();
-
-                        std::array<Vec3f, 3> facet;
-                        for (int p_idx = 0; p_idx < 3; ++p_idx) {
-                            facet[p_idx] = tr * custom_facets.vertices[custom_facets.indices[facet_idx](p_idx)];
-                            max_z        = std::max(max_z, facet[p_idx].z());
-                            min_z        = std::min(min_z, facet[p_idx].z());
-                        }
+                    float min_z = std::numeric_limits<float>::max();
+                    float max_z = std::numeric_limits<float>::lowest();
+
+                    std::array<Vec3f, 3> facet;
+                    for (int p_idx = 0; p_idx < 3; ++p_idx) {
+                        facet[p_idx] = custom_facets.vertices[custom_facets.indices[facet_idx](p_idx)];
+                        max_z        = std::max(max_z, facet[p_idx].z());
+                        min_z        = std::min(min_z, facet[p_idx].z());
+                    }
 
-                        if (is_equal(min_z, max_z))
-                            continue;
+                    if (is_equal(min_z, max_z))
+                        continue;
 
-                        // Sort the vertices by z-axis for simplification of projected_facet on slices
-                        std::sort(facet.begin(), facet.end(), [](const Vec3f &p1, const Vec3f &p2) { return p1.z() < p2.z(); });
+                    // Sort the vertices by z-axis for simplification of projected_facet on slices
+                    std::sort(facet.begin(), facet.end(), [](const Vec3f &p1, const Vec3f &p2) { return p1.z() < p2.z(); });
 
-                        // Find lowest slice not below the triangle.
-                        auto first_layer = std::upper_bound(layers.begin(), layers.end(), float(min_z - EPSILON),
-                                                            [](float z, const Layer *l1) { return z < l1->slice_z; });
-                        auto last_layer  = std::upper_bound(layers.begin(), layers.end(), float(max_z + EPSILON),
-                                                           [](float z, const Layer *l1) { return z < l1->slice_z; });
-                        --last_layer;
+                    // Find lowest slice not below the triangle.
+                    auto first_layer = std::upper_bound(layers.begin(), layers.end(), float(min_z - EPSILON),
+                                                        [](float z, const Layer *l1) { return z < l1->slice_z; });
+                    auto last_layer  = std::upper_bound(layers.begin(), layers.end(), float(max_z + EPSILON),
+                                                       [](float z, const Layer *l1) { return z < l1->slice_z; });
+                    --last_layer;
 
-                        for (auto layer_it = first_layer; layer_it != (last_layer + 1); ++layer_it) {
-                            const Layer *layer     = *layer_it;
-                            size_t       layer_idx = layer_it - layers.begin();
-                            if (input_expolygons[layer_idx].empty() || is_less(layer->slice_z, facet[0].z()) || is_less(facet[2].z(), layer->slice_z))
-                                continue;
+                    for (auto layer_it = first_layer; layer_it != (last_layer + 1); ++layer_it) {
+                        const Layer *layer     = *layer_it;
+                        size_t       layer_idx = layer_it - layers.begin();
+                        if (layer_cached[layer_idx] || input_expolygons[layer_idx].empty() || is_less(layer->slice_z, facet[0].z()) || is_less(facet[2].z(), layer->slice_z))
+                            continue;
 
-                            // https://kandepet.com/3d-printing-slicing-3d-objects/
-                            float t            = (float(layer->slice_z) - facet[0].z()) / (facet[2].z() - facet[0].z());
-                            Vec3f line_start_f = facet[0] + t * (facet[2] - facet[0]);
-                            Vec3f line_end_f;
+                        // https://kandepet.com/3d-printing-slicing-3d-objects/
+                        float t            = (float(layer->slice_z) - facet[0].z()) / (facet[2].z() - facet[0].z());
+                        Vec3f line_start_f = facet[0] + t * (facet[2] - facet[0]);
+                        Vec3f line_end_f;
 
-                            // BBS: When one side of a triangle coincides with the slice_z.
-                            if ((is_equal(facet[0].z(), facet[1].z()) && is_equal(facet[1].z(), layer->slice_z))
-                                || (is_equal(facet[1].z(), facet[2].z()) && is_equal(facet[1].z(), layer->slice_z))) {
-                                line_end_f = facet[1];
-                            }
-                            else if (facet[1].z() > layer->slice_z) {
-                                // [P0, P2] and [P0, P1]
-                                float t1   = (float(layer->slice_z) - facet[0].z()) / (facet[1].z() - facet[0].z());
-                                line_end_f = facet[0] + t1 * (facet[1] - facet[0]);
-                            } else {
-                                // [P0, P2] and [P1, P2]
-                                float t2   = (float(layer->slice_z) - facet[1].z()) / (facet[2].z() - facet[1].z());
-                                line_end_f = facet[1] + t2 * (facet[2] - facet[1]);
-                            }
+                        // BBS: When one side of a triangle coincides with the slice_z.
+                        if ((is_equal(facet[0].z(), facet[1].z()) && is_equal(facet[1].z(), layer->slice_z))
+                            || (is_equal(facet[1].z(), facet[2].z()) && is_equal(facet[1].z(), layer->slice_z))) {
+                            line_end_f = facet[1];
+                        }
+                        else if (facet[1].z() > layer->slice_z) {
+                            // [P0, P2] and [P0, P1]
+                            float t1   = (float(layer->slice_z) - facet[0].z()) / (facet[1].z() - facet[0].z());
+                            line_end_f = facet[0] + t1 * (facet[1] - facet[0]);
+                        } else {
+                            // [P0, P2] and [P1, P2]
+                            float t2   = (float(layer->slice_z) - facet[1].z()) / (facet[2].z() - facet[1].z());
+                            line_end_f = facet[1] + t2 * (facet[2] - facet[1]);
+                        }
 
-                            Line line_to_test(Point(scale_(line_start_f.x()), scale_(line_start_f.y())),
-                                              Point(scale_(line_end_f.x()), scale_(line_end_f.y())));
-                            line_to_test.translate(-print_object.center_offset());
-
-                            // BoundingBoxes for EdgeGrids are computed from printable regions. It is possible that the painted line (line_to_test) could
-                            // be outside EdgeGrid's BoundingBox, for example, when the negative volume is used on the painted area (GH #7618).
-                            // To ensure that the painted line is always inside EdgeGrid's BoundingBox, it is clipped by EdgeGrid's BoundingBox in cases
-                            // when any of the endpoints of the line are outside the EdgeGrid's BoundingBox.
-                            const BoundingBox& edge_grid_bbox = edge_grids[layer_idx].bbox();
-                            if (!edge_grid_bbox.contains(line_to_test.a) || !edge_grid_bbox.contains(line_to_test.b)) {
-                                // If the painted line (line_to_test) is entirely outside EdgeGrid's BoundingBox, skip this painted line.
-                                if (!edge_grid_bbox.overlap(BoundingBox(Points{line_to_test.a, line_to_test.b})) ||
-                                    !line_to_test.clip_with_bbox(edge_grid_bbox))
-                                    continue;
-                            }
+                        Line line_to_test(Point(scale_(line_start_f.x()), scale_(line_start_f.y())),
+                                          Point(scale_(line_end_f.x()), scale_(line_end_f.y())));
+                        line_to_test.translate(-print_object.center_offset());
+
+                        // BoundingBoxes for EdgeGrids are computed from printable regions. It is possible that the painted line (line_to_test) could
+                        // be outside EdgeGrid's BoundingBox, for example, when the negative volume is used on the painted area (GH #7618).
+                        // To ensure that the painted line is always inside EdgeGrid's BoundingBox, it is clipped by EdgeGrid's BoundingBox in cases
+                        // when any of the endpoints of the line are outside the EdgeGrid's BoundingBox.
+                        const BoundingBox& edge_grid_bbox = edge_grids[layer_idx].bbox();
+                        if (!edge_grid_bbox.contains(line_to_test.a) || !edge_grid_bbox.contains(line_to_test.b)) {
+                            // If the painted line (line_to_test) is entirely outside EdgeGrid's BoundingBox, skip this painted line.
+                            if (!edge_grid_bbox.overlap(BoundingBox(Points{line_to_test.a, line_to_test.b})) ||
+                                !line_to_test.clip_with_bbox(edge_grid_bbox))
+                                continue;
+                        }
 
-                            size_t mutex_idx = layer_idx & 0x3F;
-                            assert(mutex_idx < painted_lines_mutex.size());
+                        size_t mutex_idx = layer_idx & 0x3F;
+                        assert(mutex_idx < painted_lines_mutex.size());
 
-                            PaintedLineVisitor visitor(edge_grids[layer_idx], painted_lines[layer_idx], painted_lines_mutex[mutex_idx], 16);
-                            visitor.line_to_test = line_to_test;
-                            visitor.color        = int(extruder_idx);
-                            edge_grids[layer_idx].visit_cells_intersecting_line(line_to_test.a, line_to_test.b, visitor, true);
-                        }
+                        PaintedLineVisitor visitor(edge_grids[layer_idx], painted_lines[layer_idx], painted_lines_mutex[mutex_idx], 16);
+                        visitor.line_to_test = line_to_test;
+                        visitor.color        = int(extruder_idx);
+                        edge_grids[layer_idx].visit_cells_intersecting_line(line_to_test.a, line_to_test.b, visitor, true);
                     }
+                }
 #ifndef MM_SEGMENTATION_DEBUG_PAINT_LINE
-                }); // end of parallel_for
+            }); // end of parallel_for
 #endif
-            }
+        }
 #ifndef MM_SEGMENTATION_DEBUG_PAINT_LINE
-        }); // end of parallel_for
+    }); // end of parallel_for
 #endif
-    }
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - projection of painted triangles - end";
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - painted layers count: "
                              << std::count_if(painted_lines.begin(), painted_lines.end(), [](const std::vector<PaintedLine> &pl) { return !pl.empty(); });
 
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - layers segmentation in parallel - begin";
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&edge_grids, &input_expolygons, &painted_lines, &segmented_regions, &num_extruders, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&edge_grids, &input_expolygons, &painted_lines, &segmented_regions, &num_extruders, &cache, &cache_keys, &layer_cached, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
         for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
             throw_on_cancel_callback();
+            if (layer_cached[layer_idx])
+                continue;
             if (!painted_lines[layer_idx].empty()) {
 #ifdef MM_SEGMENTATION_DEBUG_PAINTED_LINES
                 export_painted_lines_to_svg(debug_out_path("0-mm-painted-lines-%d-%d.svg", layer_idx, iRun), {painted_lines[layer_idx]}, input_expolygons[layer_idx]);
@@ -2304,6 +2411,10 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
                 export_regions_to_svg(debug_out_path("3-mm-regions-sides-%d-%d.svg", layer_idx, iRun), segmented_regions[layer_idx], input_expolygons[layer_idx]);
 #endif // MM_SEGMENTATION_DEBUG_REGIONS
             }
+            size_t size = expolygons_memory_size(cache_keys[layer_idx].slices) + segmented_regions[layer_idx].size() * sizeof(ExPolygons);
+            for (const ExPolygons &expolygons : segmented_regions[layer_idx])
+                size += expolygons_memory_size(expolygons);
+            cache.put(std::move(cache_keys[layer_idx]), segmented_regions[layer_idx], size);
         }
     }); // end of parallel_for
     BOOST_LOG_TRIVIAL(debug) << "MM segmentation - layers segmentation in parallel - end";
@@ -1,14 +1,18 @@
 #ifndef slic3r_MultiMaterialSegmentation_hpp_
 #define slic3r_MultiMaterialSegmentation_hpp_
 
+#include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "ExPolygon.hpp"
+#include "LRUCache.hpp"
+#include "TriangleMesh.hpp"
+
 namespace Slic3r {
 
 class PrintObject;
-class ExPolygon;
-using ExPolygons = std::vector<ExPolygon>;
 
 struct ColoredLine
 {
@@ -23,6 +27,56 @@ using ColoredLines = std::vector<ColoredLine>;
 // Returns MMU segmentation based on painting in MMU segmentation gizmo
 std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(const PrintObject &print_object, const std::function<void()> &throw_on_cancel_callback);
 
+struct MultiMaterialSegmentationCacheKey
+{
+    // Everything the projection of the painted triangles depends on, shared by the keys of all layers of a PrintObject.
+    struct Painting
+    {
+        struct Volume
+        {
+            // The mesh is held, not copied: the meshes of ModelVolumes are shared and immutable.
+            std::shared_ptr<const TriangleMesh>                             mesh;
+            Transform3d                                                     matrix;
+            std::pair<std::vector<std::pair<int, int>>, std::vector<bool>>  facets;
+        };
+
+        size_t                  num_extruders;
+        Transform3d             trafo;
+        Point                   center_offset;
+        std::vector<Volume>     volumes;
+        size_t                  hash;
+
+        bool operator==(const Painting &rhs) const;
+    };
+
+    std::shared_ptr<const Painting> painting;
+    // Merged slices of the layer.
+    ExPolygons                      slices;
+    double                          slice_z;
+    size_t                          hash;
+
+    bool operator==(const MultiMaterialSegmentationCacheKey &rhs) const {
+        return hash == rhs.hash && slice_z == rhs.slice_z && slices == rhs.slices && (painting == rhs.painting || *painting == *rhs.painting);
+    }
+};
+
+struct MultiMaterialSegmentationCacheKeyHash
+{
+    size_t operator()(const MultiMaterialSegmentationCacheKey &key) const { return key.hash; }
+};
+
+// BBS: Cache of the per layer segmentation by painting, shared by all PrintObjects of all Prints of the process,
+// thus a PrintObject resliced without a change of its painting nor of its layer slices is not segmented again.
+// The key is the painting of all the volumes of the object, the slice_z and the merged slices of a layer.
+class MultiMaterialSegmentationCache : public LRUCache<MultiMaterialSegmentationCacheKey, std::vector<ExPolygons>, MultiMaterialSegmentationCacheKeyHash>
+{
+public:
+    static MultiMaterialSegmentationCache& instance();
+
+private:
+    MultiMaterialSegmentationCache() : LRUCache(size_t(128) << 20) {}
+};
+
 } // namespace Slic3r
 
 namespace boost::polygon {
@@ -76,12 +76,15 @@ public:
         if (num_cluster < 1) {
             if (!this->more_than_request(image8UC3, max_cluster)) max_cluster = compute_num_colors(image8UC3);
             num_cluster = fmin(num_cluster, max_cluster);
-            cur_score  = cv::kmeans(image32FC3, 1, this->m_flatten_labels, cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 300, 0.5), 3, cv::KMEANS_PP_CENTERS);
+            // BBS: the cluster count is only searched for, thus score the candidates on an evenly strided sample of
+            // the colours of large scans. The final clustering below still runs over all the colours.
+            const cv::Mat search_image32FC3 = sample_rows(image32FC3, 100000);
+            cur_score  = cv::kmeans(search_image32FC3, 1, this->m_flatten_labels, cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 300, 0.5), 3, cv::KMEANS_PP_CENTERS);
             best_score = cur_score;
 
             for (int cur_cluster = 2; cur_cluster < max_cluster + 1; cur_cluster++) {
                 cv::Mat centers32FC3;
-                cur_score = cv::kmeans(image32FC3, cur_cluster, this->m_flatten_labels, cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 300, 0.5), 3,
+                cur_score = cv::kmeans(search_image32FC3, cur_cluster, this->m_flatten_labels, cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 300, 0.5), 3,
                                        cv::KMEANS_PP_CENTERS, centers32FC3);
                 if (this->repeat_center(cur_cluster, centers32FC3, color_space))
                     break;
@@ -115,6 +118,16 @@ public:
         }
     }
 
+    cv::Mat sample_rows(const cv::Mat &image, int max_rows)
+    {
+        if (image.rows <= max_rows)
+            return image;
+        cv::Mat sample(max_rows, 1, image.type());
+        for (int i = 0; i < max_rows; i++)
+            image.row(int(int64_t(i) * image.rows / max_rows)).copyTo(sample.row(i));
+        return sample;
+    }
+
     bool more_than_request(const cv::Mat &image8UC3, int target_num)
     {
         std::vector<cv::Vec3b> uniqueImage;
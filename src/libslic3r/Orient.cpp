@@ -64,10 +64,17 @@ public:
     Eigen::MatrixXf normals, normals_quantize, normals_hull, normals_hull_quantize;
     Eigen::VectorXf areas, areas_hull;
     Eigen::VectorXf is_apperance; // whether a facet is outer apperance
-    Eigen::MatrixXf z_projected;
-    Eigen::VectorXf z_max, z_max_hull;  // max of projected z
-    Eigen::VectorXf z_median;  // median of projected z
-    Eigen::VectorXf z_mean;  // mean of projected z
+    // Facet heights along one candidate orientation. Kept per candidate so that the candidates can be scored in parallel.
+    struct Projection {
+        Eigen::MatrixXf z_projected;
+        Eigen::VectorXf z_max, z_max_hull;  // max of projected z
+        Eigen::VectorXf z_median;  // median of projected z
+        Eigen::VectorXf z_mean;  // mean of projected z
+    };
+    // orientation independent statistics of the mesh
+    float mesh_area_total = 0.f;
+    float mesh_radius = 0.f;
+    float mesh_volume = 0.f;
     std::vector<Vec3f> face_normals;
     std::vector<Vec3f> face_normals_hull;
     OrientParams params;
@@ -128,17 +135,27 @@ public:
         if (progressind)
             progressind(30);
 
+        mesh_area_total = mesh->bounding_box().area();
+        mesh_radius = mesh->bounding_box().radius();
+        mesh_volume = mesh->stats().volume > 0 ? mesh->stats().volume : its_volume(mesh->its);
+
+        std::vector<CostItems> orientation_costs(orientations.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, orientations.size()), [this, &orientation_costs](const tbb::blocked_range<size_t>& range) {
+            Projection projection;
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                auto orientation = -orientations[i];
+                project_vertices(orientation, projection);
+                orientation_costs[i] = get_features(orientation, projection, params.min_volume);
+                target_function(orientation_costs[i], params.min_volume);
+            }
+        });
+
         std::unordered_map<Vec3f, CostItems, VecHash> results;
         BOOST_LOG_TRIVIAL(info) << CostItems::field_names();
         std::cout << CostItems::field_names() << std::endl;
         for (int i = 0; i < orientations.size();i++) {
             auto orientation = -orientations[i];
-
-            project_vertices(orientation);
-
-            auto cost_items = get_features(orientation, params.min_volume);
-
-            float unprintability = target_function(cost_items, params.min_volume);
+            auto &cost_items = orientation_costs[i];
 
             results[orientation] = cost_items;
 
@@ -183,7 +200,7 @@ public:
         int count_apperance = 0;
         {
             int face_count = mesh->facets_count();
-            auto its = mesh->its;
+            indexed_triangle_set &its = mesh->its;
             face_normals = its_face_normals(its);
             areas = Eigen::VectorXf::Zero(face_count);
             is_apperance = Eigen::VectorXf::Zero(face_count);
@@ -209,7 +226,7 @@ public:
             //mesh_convex_hull.write_binary("convex_hull_debug.stl");
 
             int face_count = mesh_convex_hull.facets_count();
-            auto its = mesh_convex_hull.its;
+            const indexed_triangle_set &its = mesh_convex_hull.its;
             face_count_hull = mesh_convex_hull.facets_count();
             face_normals_hull = its_face_normals(its);
             areas_hull = Eigen::VectorXf::Zero(face_count);
@@ -316,14 +333,15 @@ public:
         }
     }
 
-    void project_vertices(Vec3f orientation)
+    void project_vertices(Vec3f orientation, Projection &projection) const
     {
         int face_count = mesh->facets_count();
-        auto its = mesh->its;
+        const indexed_triangle_set &its = mesh->its;
+        Eigen::MatrixXf &z_projected = projection.z_projected;
         z_projected.resize(face_count, 3);
-        z_max.resize(face_count, 1);
-        z_median.resize(face_count, 1);
-        z_mean.resize(face_count, 1);
+        projection.z_max.resize(face_count, 1);
+        projection.z_median.resize(face_count, 1);
+        projection.z_mean.resize(face_count, 1);
         for (size_t i = 0; i < face_count; i++)
         {
             float z0 = its.get_vertex(i,0).dot(orientation);
@@ -332,19 +350,19 @@ public:
             z_projected(i, 0) = z0;
             z_projected(i, 1) = z1;
             z_projected(i, 2) = z2;
-            z_max(i) = MAX3(z0,z1,z2);
-            z_median(i) = MEDIAN3(z0,z1,z2);
-            z_mean(i) = (z0 + z1 + z2) / 3;
+            projection.z_max(i) = MAX3(z0,z1,z2);
+            projection.z_median(i) = MEDIAN3(z0,z1,z2);
+            projection.z_mean(i) = (z0 + z1 + z2) / 3;
         }
 
-        z_max_hull.resize(mesh_convex_hull.facets_count(), 1);
-        its = mesh_convex_hull.its;
-        for (auto i = 0; i < z_max_hull.rows(); i++)
+        const indexed_triangle_set &its_hull = mesh_convex_hull.its;
+        projection.z_max_hull.resize(mesh_convex_hull.facets_count(), 1);
+        for (auto i = 0; i < projection.z_max_hull.rows(); i++)
         {
-            float z0 = its.get_vertex(i,0).dot(orientation);
-            float z1 = its.get_vertex(i,1).dot(orientation);
-            float z2 = its.get_vertex(i,2).dot(orientation);
-            z_max_hull(i) = MAX3(z0, z1, z2);
+            float z0 = its_hull.get_vertex(i,0).dot(orientation);
+            float z1 = its_hull.get_vertex(i,1).dot(orientation);
+            float z2 = its_hull.get_vertex(i,2).dot(orientation);
+            projection.z_max_hull(i) = MAX3(z0, z1, z2);
         }
     }
 
@@ -372,15 +390,16 @@ public:
     }
 
     // previously calc_overhang
-    CostItems get_features(Vec3f orientation, bool min_volume = true)
+    CostItems get_features(Vec3f orientation, const Projection &projection, bool min_volume = true) const
     {
+        const Eigen::VectorXf &z_max = projection.z_max, &z_max_hull = projection.z_max_hull, &z_mean = projection.z_mean;
         CostItems costs;
-        costs.area_total = mesh->bounding_box().area();
-        costs.radius = mesh->bounding_box().radius();
+        costs.area_total = mesh_area_total;
+        costs.radius = mesh_radius;
         // volume
-        costs.volume = mesh->stats().volume > 0 ? mesh->stats().volume : its_volume(mesh->its);
+        costs.volume = mesh_volume;
 
-        float total_min_z = z_projected.minCoeff();
+        float total_min_z = projection.z_projected.minCoeff();
         // filter bottom area
         auto bottom_condition = z_max.array() < total_min_z + this->params.FIRST_LAY_H - EPSILON;
         auto bottom_condition_hull = z_max_hull.array() < total_min_z + this->params.FIRST_LAY_H - EPSILON;
@@ -392,11 +411,7 @@ public:
         costs.bottom = bottom_condition.select(areas, 0).sum()*0.5 + bottom_condition_2nd.select(areas, 0).sum();
 
         // filter overhang
-        Eigen::VectorXf normal_projection(normals.rows(), 1);// = this->normals.dot(orientation);
-        for (auto i = 0; i < normals.rows(); i++)
-        {
-            normal_projection(i) = normals.row(i).dot(orientation);
-        }
+        Eigen::VectorXf normal_projection = normals * orientation;
         auto areas_appearance = areas.cwiseProduct((is_apperance * params.APPERANCE_FACE_SUPP + Eigen::VectorXf::Ones(is_apperance.rows(), is_apperance.cols())));
         auto overhang_areas = ((normal_projection.array() < params.ASCENT) * (!bottom_condition_2nd)).select(areas_appearance, 0);
         Eigen::MatrixXf inner = normal_projection.array() - params.ASCENT;
@@ -418,12 +433,12 @@ public:
 #else
             float contour = 0;
             int face_count = mesh->facets_count();
-            auto its = mesh->its;
+            const indexed_triangle_set &its = mesh->its;
             int contour_amout = 0;
             for (size_t i = 0; i < face_count; i++)
             {
                 if (bottom_condition(i)) {
-                    Eigen::VectorXi index = argsort(z_projected.row(i));
+                    Eigen::VectorXi index = argsort(projection.z_projected.row(i));
                     stl_vertex line = its.get_vertex(i, index(0)) - its.get_vertex(i, index(1));
                     contour += line.norm();
                     contour_amout++;
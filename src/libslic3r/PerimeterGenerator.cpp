@@ -14,6 +14,9 @@
 #include <thread>
 #include <unordered_set>
 #include "libslic3r/AABBTreeLines.hpp"
+
+#include <tbb/parallel_for.h>
+
 static const int overhang_sampling_number = 6;
 static const double narrow_loop_length_threshold = 10;
 static const double min_degree_gap = 0.1;
@@ -36,6 +39,24 @@ static double random_value() {
     return dist(gen);
 }
 
+// Medial axes of separate expolygons are independent, thus an island with many thin walls or gaps computes them in parallel.
+// The polylines are appended in the order of the expolygons, so that the result does not depend on scheduling.
+static void medial_axis_parallel(const ExPolygons &expolygons, double min_width, double max_width, ThickPolylines &polylines_out)
+{
+    if (expolygons.size() < 2) {
+        for (const ExPolygon &ex : expolygons)
+            ex.medial_axis(min_width, max_width, &polylines_out);
+        return;
+    }
+    std::vector<ThickPolylines> polylines(expolygons.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, expolygons.size(), 1), [&expolygons, &polylines, min_width, max_width](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i)
+            expolygons[i].medial_axis(min_width, max_width, &polylines[i]);
+    });
+    for (ThickPolylines &pl : polylines)
+        polylines_out.insert(polylines_out.end(), std::make_move_iterator(pl.begin()), std::make_move_iterator(pl.end()));
+}
+
 // Hierarchy of perimeters.
 class PerimeterGeneratorLoop {
 public:
@@ -1194,6 +1215,177 @@ static Polygons to_polygons_with_flag(const ExPolygon& src, const bool contour_f
 }
 
 
+bool PerimeterIslandCache::Key::operator==(const Key &rhs) const
+{
+    return this->hash == rhs.hash && this->config == rhs.config && this->layer_id == rhs.layer_id && this->layer_height == rhs.layer_height &&
+        this->perimeter_flow == rhs.perimeter_flow && this->ext_perimeter_flow == rhs.ext_perimeter_flow &&
+        this->overhang_flow == rhs.overhang_flow && this->solid_infill_flow == rhs.solid_infill_flow &&
+        this->has_lower_slices == rhs.has_lower_slices && this->has_upper_slices == rhs.has_upper_slices &&
+        this->extra_perimeters == rhs.extra_perimeters && this->counter_circle_compensation == rhs.counter_circle_compensation &&
+        this->holes_circle_compensation == rhs.holes_circle_compensation &&
+        this->island == rhs.island && this->lower_slices == rhs.lower_slices && this->upper_slices == rhs.upper_slices;
+}
+
+std::shared_ptr<const PerimeterIslandCache::Result> PerimeterIslandCache::find(const Key &key)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        ++ m_misses;
+        return nullptr;
+    }
+    ++ m_hits;
+    return it->second;
+}
+
+void PerimeterIslandCache::insert(Key &&key, std::shared_ptr<const Result> result)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    m_entries.try_emplace(std::move(key), std::move(result));
+}
+
+PerimeterIslandCache::Stats PerimeterIslandCache::stats() const
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    return { m_hits, m_misses, m_entries.size() };
+}
+
+static void hash_points(size_t &seed, const Points &points)
+{
+    boost::hash_combine(seed, points.size());
+    for (const Point &pt : points) {
+        boost::hash_combine(seed, pt.x());
+        boost::hash_combine(seed, pt.y());
+    }
+}
+
+std::optional<PerimeterIslandCache::Key> PerimeterGenerator::island_cache_key(const Surface &surface, Point &origin) const
+{
+    // Fuzzy skin is random and the loop nodes refer to the other islands of the layer by index.
+    if (this->island_cache == nullptr || m_spiral_vase || this->config->fuzzy_skin != FuzzySkinType::None || this->print_config->z_direction_outwall_speed_continuous)
+        return std::nullopt;
+
+    PerimeterIslandCache::Key key;
+    key.config                      = this->config;
+    key.layer_id                    = std::min(this->layer_id, this->object_config->raft_layers.value + 1);
+    key.layer_height                = this->layer_height;
+    key.perimeter_flow              = this->perimeter_flow;
+    key.ext_perimeter_flow          = this->ext_perimeter_flow;
+    key.overhang_flow               = this->overhang_flow;
+    key.solid_infill_flow           = this->solid_infill_flow;
+    key.has_lower_slices            = this->lower_slices != nullptr;
+    key.has_upper_slices            = this->upper_slices != nullptr;
+    key.extra_perimeters            = surface.extra_perimeters;
+    key.counter_circle_compensation = surface.counter_circle_compensation;
+    key.holes_circle_compensation   = surface.holes_circle_compensation;
+
+    BoundingBox bbox = get_extents(surface.expolygon);
+    origin           = bbox.min;
+    key.island       = surface.expolygon;
+    key.island.translate(- origin);
+
+    // The lower slices are grown by up to half the nozzle diameter for the overhang detection, the upper slices are only
+    // looked at inside the island. Anything further than twice the widest extrusion does not change the perimeters.
+    const double nozzle_diameter = this->print_config->nozzle_diameter.get_at(this->config->wall_filament - 1);
+    bbox.offset(scaled<coord_t>(2. * std::max({ nozzle_diameter, double(this->perimeter_flow.width()), double(this->ext_perimeter_flow.width()), double(this->overhang_flow.width()) })));
+    auto clip_slices = [&bbox, &origin](const ExPolygons *slices) {
+        Polygons out;
+        if (slices != nullptr) {
+            out = ClipperUtils::clip_clipper_polygons_with_subject_bbox(*slices, bbox);
+            for (Polygon &polygon : out)
+                polygon.translate(- origin);
+        }
+        return out;
+    };
+    key.lower_slices = clip_slices(this->lower_slices);
+    key.upper_slices = clip_slices(this->upper_slices);
+
+    size_t seed = std::hash<const void*>()(key.config);
+    boost::hash_combine(seed, key.layer_id);
+    boost::hash_combine(seed, key.layer_height);
+    boost::hash_combine(seed, key.extra_perimeters);
+    hash_points(seed, key.island.contour.points);
+    for (const Polygon &hole : key.island.holes)
+        hash_points(seed, hole.points);
+    for (const Polygon &polygon : key.lower_slices)
+        hash_points(seed, polygon.points);
+    boost::hash_combine(seed, key.lower_slices.size());
+    for (const Polygon &polygon : key.upper_slices)
+        hash_points(seed, polygon.points);
+    key.hash = seed;
+    return key;
+}
+
+void PerimeterGenerator::append_cached_island(const PerimeterIslandCache::Result &result, const Point &origin)
+{
+    auto append_translated = [&origin](ExtrusionEntityCollection &dst, const ExtrusionEntityCollection &src) {
+        size_t first = dst.entities.size();
+        dst.append(src.entities);
+        for (size_t i = first; i < dst.entities.size(); ++ i)
+            dst.entities[i]->translate(origin);
+    };
+    append_translated(*this->loops, result.loops);
+    append_translated(*this->gap_fill, result.gap_fill);
+    ExPolygons fill_expolygons = result.fill_expolygons;
+    translate(fill_expolygons, origin);
+    this->fill_surfaces->append(std::move(fill_expolygons), stInternal);
+    size_t first = this->fill_no_overlap->size();
+    append(*this->fill_no_overlap, result.fill_no_overlap);
+    for (size_t i = first; i < this->fill_no_overlap->size(); ++ i)
+        (*this->fill_no_overlap)[i].translate(origin);
+}
+
+// Redirects the outputs of a PerimeterGenerator while one island is generated, so that the island can be stored into
+// the PerimeterIslandCache. The outputs are restored on destruction, even if no commit() happened.
+class PerimeterIslandCapture
+{
+public:
+    explicit PerimeterIslandCapture(PerimeterGenerator &generator) :
+        m_generator(generator), m_loops(generator.loops), m_gap_fill(generator.gap_fill),
+        m_fill_surfaces(generator.fill_surfaces), m_fill_no_overlap(generator.fill_no_overlap),
+        m_result(std::make_shared<PerimeterIslandCache::Result>())
+    {
+        generator.loops           = &m_result->loops;
+        generator.gap_fill        = &m_result->gap_fill;
+        generator.fill_surfaces   = &m_island_fill_surfaces;
+        generator.fill_no_overlap = &m_result->fill_no_overlap;
+    }
+    ~PerimeterIslandCapture() { this->restore(); }
+
+    // Appends the outputs of the island to the outputs of the generator and stores them, relative to origin, into the cache.
+    void commit(PerimeterIslandCache::Key &&key, const Point &origin)
+    {
+        this->restore();
+        m_result->fill_expolygons = to_expolygons(std::move(m_island_fill_surfaces.surfaces));
+        m_loops->append(m_result->loops.entities);
+        m_gap_fill->append(m_result->gap_fill.entities);
+        m_fill_surfaces->append(m_result->fill_expolygons, stInternal);
+        append(*m_fill_no_overlap, m_result->fill_no_overlap);
+        m_result->loops.translate(- origin);
+        m_result->gap_fill.translate(- origin);
+        translate(m_result->fill_expolygons, - origin);
+        translate(m_result->fill_no_overlap, - origin);
+        m_generator.island_cache->insert(std::move(key), std::move(m_result));
+    }
+
+private:
+    void restore()
+    {
+        m_generator.loops           = m_loops;
+        m_generator.gap_fill        = m_gap_fill;
+        m_generator.fill_surfaces   = m_fill_surfaces;
+        m_generator.fill_no_overlap = m_fill_no_overlap;
+    }
+
+    PerimeterGenerator                             &m_generator;
+    ExtrusionEntityCollection                      *m_loops;
+    ExtrusionEntityCollection                      *m_gap_fill;
+    SurfaceCollection                              *m_fill_surfaces;
+    ExPolygons                                     *m_fill_no_overlap;
+    SurfaceCollection                               m_island_fill_surfaces;
+    std::shared_ptr<PerimeterIslandCache::Result>   m_result;
+};
+
 void PerimeterGenerator::process_classic()
 {
     // other perimeters
@@ -1259,6 +1451,17 @@ void PerimeterGenerator::process_classic()
     std::vector<size_t> surface_order = chain_expolygons(surface_exp);
     for (size_t order_idx = 0; order_idx < surface_order.size(); order_idx++) {
         const Surface &surface = this->slices->surfaces[surface_order[order_idx]];
+        // Take the perimeters of an identical island generated before, or remember this one for its copies.
+        Point                                    island_origin;
+        std::optional<PerimeterIslandCache::Key> island_key = this->island_cache_key(surface, island_origin);
+        if (island_key)
+            if (std::shared_ptr<const PerimeterIslandCache::Result> cached = this->island_cache->find(*island_key)) {
+                this->append_cached_island(*cached, island_origin);
+                continue;
+            }
+        std::optional<PerimeterIslandCapture> island_capture;
+        if (island_key)
+            island_capture.emplace(*this);
         // detect how many perimeters must be generated for this island
         int        loop_number = this->config->wall_loops + surface.extra_perimeters - 1;  // 0-indexed loops
         //BBS: set the topmost and bottom most layer to be one wall
@@ -1315,8 +1518,7 @@ void PerimeterGenerator::process_classic()
                             diff_ex(last, offset(offsets, float(ext_perimeter_width / 2.) + ClipperSafetyOffset)),
                             float(min_width / 2.));
                         // the maximum thickness of our thin wall area is equal to the minimum thickness of a single loop
-                        for (ExPolygon &ex : expp)
-                            ex.medial_axis(min_width, ext_perimeter_width + ext_perimeter_spacing2, &thin_walls);
+                        medial_axis_parallel(expp, min_width, ext_perimeter_width + ext_perimeter_spacing2, thin_walls);
                     } else {
                         coord_t ext_perimeter_smaller_width = this->smaller_ext_perimeter_flow.scaled_width();
                         for (const ExPolygon& expolygon : last) {
@@ -1675,11 +1877,10 @@ void PerimeterGenerator::process_classic()
                 opening_ex(gaps, float(min / 2.)),
                 offset2_ex(gaps, - float(max / 2.), float(max / 2. + ClipperSafetyOffset)));
             ThickPolylines polylines;
-            for (ExPolygon& ex : gaps_ex) {
-                //BBS: Use DP simplify to avoid duplicated points and accelerate medial-axis calculation as well.
+            //BBS: Use DP simplify to avoid duplicated points and accelerate medial-axis calculation as well.
+            for (ExPolygon& ex : gaps_ex)
                 ex.douglas_peucker(surface_simplify_resolution);
-                ex.medial_axis(min, max, &polylines);
-            }
+            medial_axis_parallel(gaps_ex, min, max, polylines);
 
 #ifdef GAPS_OF_PERIMETER_DEBUG_TO_SVG
             {
@@ -1771,6 +1972,8 @@ void PerimeterGenerator::process_classic()
             this->fill_no_overlap->insert(this->fill_no_overlap->end(), polyWithoutOverlap.begin(), polyWithoutOverlap.end());
         }
 
+        if (island_capture)
+            island_capture->commit(std::move(*island_key), island_origin);
     } // for each island
 }
 
@@ -1842,54 +2045,112 @@ void PerimeterGenerator::process_arachne()
     double surface_simplify_resolution = (print_config->enable_arc_fitting && this->config->fuzzy_skin == FuzzySkinType::None) ? 0.2 * m_scaled_resolution : m_scaled_resolution;
     // we need to process each island separately because we might have different
     // extra perimeters for each one
+    struct ArachneIsland
+    {
+        int              loop_number;
+        bool             apply_circle_compensation;
+        ExPolygons       last;
+        Polygons         last_p;
+        std::vector<int> circle_poly_indices;
+        bool             is_one_wall;
+        bool             seperate_wall_generation;
+        // Sharing of the perimeters with identical islands.
+        std::optional<PerimeterIslandCache::Key>      key;
+        Point                                         origin;
+        std::shared_ptr<const PerimeterIslandCache::Result> cached;
+        // An identical island comes earlier in this layer, it will be in the cache once that island is generated.
+        bool                                          same_as_earlier { false };
+    };
 
-    for (const Surface& surface : this->slices->surfaces) {
-        // detect how many perimeters must be generated for this island
-        int loop_number = this->config->wall_loops + surface.extra_perimeters - 1; // 0-indexed loops
+    double min_nozzle_diameter = *std::min_element(print_config->nozzle_diameter.values.begin(), print_config->nozzle_diameter.values.end());
+    Arachne::WallToolPathsParams input_params;
+    {
+        if (const auto& min_feature_size_opt = object_config->min_feature_size)
+            input_params.min_feature_size = min_feature_size_opt.value * 0.01 * min_nozzle_diameter;
 
-        bool apply_circle_compensation = true;
-        ExPolygons last = offset_ex(surface.expolygon.simplify_p(surface_simplify_resolution), -float(ext_perimeter_width / 2. - ext_perimeter_spacing / 2.));
-        int new_size = std::accumulate(last.begin(), last.end(), 0, [](int prev, const ExPolygon& expoly) { return prev + expoly.num_contours(); });
-        if (last.size() != 1 || new_size != surface.expolygon.num_contours())
-            apply_circle_compensation = false;
+        if (const auto& min_bead_width_opt = object_config->min_bead_width)
+            input_params.min_bead_width = min_bead_width_opt.value * 0.01 * min_nozzle_diameter;
 
-        std::vector<int> circle_poly_indices;
-        Polygons   last_p;
-        if (apply_circle_compensation)
-            last_p = to_polygons_with_flag(last.front(), surface.counter_circle_compensation, surface.holes_circle_compensation, circle_poly_indices);
-        else
-            last_p = to_polygons(last);
+        if (const auto& wall_transition_filter_deviation_opt = object_config->wall_transition_filter_deviation)
+            input_params.wall_transition_filter_deviation = wall_transition_filter_deviation_opt.value * 0.01 * min_nozzle_diameter;
 
-        std::vector<Arachne::VariableWidthLines> total_perimeters;
-        ExPolygons infill_contour;
+        if (const auto& wall_transition_length_opt = object_config->wall_transition_length)
+            input_params.wall_transition_length = wall_transition_length_opt.value * 0.01 * min_nozzle_diameter;
 
-        if (loop_number >= 0) {
-            bool generate_one_wall_by_first_layer = this->object_config->only_one_wall_first_layer && layer_id == 0;
-            bool generate_one_wall_by_top_most = this->object_config->top_one_wall_type != TopOneWallType::None && this->upper_slices == nullptr;
-            bool generate_one_wall_by_top = this->object_config->top_one_wall_type == TopOneWallType::Alltop && this->upper_slices != nullptr;
+        input_params.wall_transition_angle = this->object_config->wall_transition_angle.value;
+        input_params.wall_distribution_count = this->object_config->wall_distribution_count.value;
+    }
 
-            bool is_one_wall = loop_number == 0 || generate_one_wall_by_first_layer || generate_one_wall_by_top_most;
-            // whether to seperate the generatation of wall into two parts,first generate outer wall,then generate the remaining wall
-            bool seperate_wall_generation = !is_one_wall && generate_one_wall_by_top;
+    bool generate_one_wall_by_first_layer = this->object_config->only_one_wall_first_layer && layer_id == 0;
+    bool generate_one_wall_by_top_most = this->object_config->top_one_wall_type != TopOneWallType::None && this->upper_slices == nullptr;
+    bool generate_one_wall_by_top = this->object_config->top_one_wall_type == TopOneWallType::Alltop && this->upper_slices != nullptr;
 
-            double min_nozzle_diameter = *std::min_element(print_config->nozzle_diameter.values.begin(), print_config->nozzle_diameter.values.end());
-            Arachne::WallToolPathsParams input_params;
-            {
-                if (const auto& min_feature_size_opt = object_config->min_feature_size)
-                    input_params.min_feature_size = min_feature_size_opt.value * 0.01 * min_nozzle_diameter;
+    std::vector<ArachneIsland> islands;
+    islands.reserve(this->slices->surfaces.size());
+    for (const Surface& surface : this->slices->surfaces) {
+        ArachneIsland &island = islands.emplace_back();
+        if (island.key = this->island_cache_key(surface, island.origin); island.key) {
+            island.cached = this->island_cache->find(*island.key);
+            if (! island.cached)
+                island.same_as_earlier = std::any_of(islands.begin(), islands.end() - 1,
+                    [&island](const ArachneIsland &other) { return ! other.cached && ! other.same_as_earlier && other.key && *other.key == *island.key; });
+            if (island.cached || island.same_as_earlier)
+                continue;
+        }
+        // detect how many perimeters must be generated for this island
+        island.loop_number = this->config->wall_loops + surface.extra_perimeters - 1; // 0-indexed loops
 
-                if (const auto& min_bead_width_opt = object_config->min_bead_width)
-                    input_params.min_bead_width = min_bead_width_opt.value * 0.01 * min_nozzle_diameter;
+        island.apply_circle_compensation = true;
+        island.last = offset_ex(surface.expolygon.simplify_p(surface_simplify_resolution), -float(ext_perimeter_width / 2. - ext_perimeter_spacing / 2.));
+        int new_size = std::accumulate(island.last.begin(), island.last.end(), 0, [](int prev, const ExPolygon& expoly) { return prev + expoly.num_contours(); });
+        if (island.last.size() != 1 || new_size != surface.expolygon.num_contours())
+            island.apply_circle_compensation = false;
 
-                if (const auto& wall_transition_filter_deviation_opt = object_config->wall_transition_filter_deviation)
-                    input_params.wall_transition_filter_deviation = wall_transition_filter_deviation_opt.value * 0.01 * min_nozzle_diameter;
+        if (island.apply_circle_compensation)
+            island.last_p = to_polygons_with_flag(island.last.front(), surface.counter_circle_compensation, surface.holes_circle_compensation, island.circle_poly_indices);
+        else
+            island.last_p = to_polygons(island.last);
 
-                if (const auto& wall_transition_length_opt = object_config->wall_transition_length)
-                    input_params.wall_transition_length = wall_transition_length_opt.value * 0.01 * min_nozzle_diameter;
+        island.is_one_wall = island.loop_number == 0 || generate_one_wall_by_first_layer || generate_one_wall_by_top_most;
+        // whether to seperate the generatation of wall into two parts,first generate outer wall,then generate the remaining wall
+        island.seperate_wall_generation = !island.is_one_wall && generate_one_wall_by_top;
+    }
 
-                input_params.wall_transition_angle = this->object_config->wall_transition_angle.value;
-                input_params.wall_distribution_count = this->object_config->wall_distribution_count.value;
-            }
+    // Generate the first walls of all the islands of this layer in one batch, which shares the Arachne buffers between
+    // the islands. When the wall generation is seperated, the first wall is generated alone.
+    std::vector<Arachne::WallToolPaths> first_wall_paths;
+    first_wall_paths.reserve(islands.size());
+    for (const ArachneIsland &island : islands) {
+        if (island.cached || island.same_as_earlier || island.loop_number < 0)
+            continue;
+        size_t inset_count = (island.is_one_wall || island.seperate_wall_generation) ? 1 : island.loop_number + 1;
+        Arachne::WallToolPaths &paths = first_wall_paths.emplace_back(island.last_p, ext_perimeter_spacing, perimeter_spacing, inset_count, 0, layer_height, input_params);
+        if (island.apply_circle_compensation)
+            paths.EnableHoleCompensation(true, island.circle_poly_indices);
+    }
+    Arachne::WallToolPaths::generateBatch(first_wall_paths);
+
+    auto first_wall_paths_it = first_wall_paths.begin();
+    for (ArachneIsland &island : islands) {
+        if (island.same_as_earlier)
+            island.cached = this->island_cache->find(*island.key);
+        if (island.cached) {
+            this->append_cached_island(*island.cached, island.origin);
+            continue;
+        }
+        std::optional<PerimeterIslandCapture> island_capture;
+        if (island.key)
+            island_capture.emplace(*this);
+
+        const int   loop_number = island.loop_number;
+        ExPolygons &last        = island.last;
+
+        std::vector<Arachne::VariableWidthLines> total_perimeters;
+        ExPolygons infill_contour;
+
+        if (loop_number >= 0) {
+            Arachne::WallToolPaths &wall_paths = *first_wall_paths_it++;
+            bool seperate_wall_generation = island.seperate_wall_generation;
 
             // these variables are only valid if need to seperate wall generation
             ExPolygons top_expolys_by_one_wall;
@@ -1898,12 +2159,8 @@ void PerimeterGenerator::process_arachne()
 
             // do detail check whether to enable one wall
             if (seperate_wall_generation) {
-                Arachne::WallToolPaths one_wall_paths(last_p, ext_perimeter_spacing, perimeter_spacing, 1, 0, layer_height, input_params);
-                if (apply_circle_compensation)
-                    one_wall_paths.EnableHoleCompensation(true, circle_poly_indices);
-
-                first_perimeters = one_wall_paths.getToolPaths();
-                infill_contour_by_one_wall = union_ex(one_wall_paths.getInnerContour());
+                first_perimeters = wall_paths.getToolPaths();
+                infill_contour_by_one_wall = union_ex(wall_paths.getInnerContour());
 
                 BoundingBox infill_bbox = get_extents(infill_contour_by_one_wall);
                 infill_bbox.offset(EPSILON);
@@ -1931,8 +2188,8 @@ void PerimeterGenerator::process_arachne()
                 // deal with remaining walls to be generated
                 if (loop_number > 0) {
                     last = diff_ex(infill_contour_by_one_wall, top_expolys_by_one_wall);
-                    last_p = to_polygons(last); // disable contour compensation in remaining walls
-                    Arachne::WallToolPaths paths_new(last_p, perimeter_spacing, perimeter_spacing, loop_number, 0, layer_height, input_params);
+                    Polygons remaining_p = to_polygons(last); // disable contour compensation in remaining walls
+                    Arachne::WallToolPaths paths_new(remaining_p, perimeter_spacing, perimeter_spacing, loop_number, 0, layer_height, input_params);
                     auto new_perimeters = paths_new.getToolPaths();
                     for (auto& perimeters : new_perimeters) {
                         if (!perimeters.empty()) {
@@ -1946,23 +2203,18 @@ void PerimeterGenerator::process_arachne()
                     infill_contour = intersection_ex(infill_contour, infill_contour_by_one_wall);
                 }
             }
+            else if (island.seperate_wall_generation) {
+                // The top one wall was rejected, plan wall width as normal.
+                Arachne::WallToolPaths normal_paths(island.last_p, ext_perimeter_spacing, perimeter_spacing, loop_number + 1, 0, layer_height, input_params);
+                if (island.apply_circle_compensation)
+                    normal_paths.EnableHoleCompensation(true, island.circle_poly_indices);
+                total_perimeters = normal_paths.getToolPaths();
+                infill_contour = union_ex(normal_paths.getInnerContour());
+            }
             else {
-                if (is_one_wall) {
-                    // plan wall width as one wall
-                    Arachne::WallToolPaths one_wall_paths(last_p, ext_perimeter_spacing, perimeter_spacing, 1, 0, layer_height, input_params);
-                    if (apply_circle_compensation)
-                        one_wall_paths.EnableHoleCompensation(true, circle_poly_indices);
-                    total_perimeters = one_wall_paths.getToolPaths();
-                    infill_contour = union_ex(one_wall_paths.getInnerContour());
-                }
-                else {
-                    // plan wall width as noraml
-                    Arachne::WallToolPaths normal_paths(last_p, ext_perimeter_spacing, perimeter_spacing, loop_number + 1, 0, layer_height, input_params);
-                    if (apply_circle_compensation)
-                        normal_paths.EnableHoleCompensation(true, circle_poly_indices);
-                    total_perimeters = normal_paths.getToolPaths();
-                    infill_contour = union_ex(normal_paths.getInnerContour());
-                }
+                // plan wall width as one wall or as normal, already generated in the batch above
+                total_perimeters = wall_paths.getToolPaths();
+                infill_contour = union_ex(wall_paths.getInnerContour());
             }
         }
         else {
@@ -2171,6 +2423,8 @@ void PerimeterGenerator::process_arachne()
         // append infill areas to fill_surfaces
         add_infill_contour_for_arachne(infill_contour, loop_number, ext_perimeter_spacing, perimeter_spacing, min_perimeter_infill_spacing, spacing, false);
 
+        if (island_capture)
+            island_capture->commit(std::move(*island.key), island.origin);
     }
 }
 
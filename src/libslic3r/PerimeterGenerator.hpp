@@ -2,7 +2,11 @@
 #define slic3r_PerimeterGenerator_hpp_
 
 #include "libslic3r.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
+#include "ExtrusionEntityCollection.hpp"
 #include "Flow.hpp"
 #include "Polygon.hpp"
 #include "PrintConfig.hpp"
@@ -10,6 +14,67 @@
 
 namespace Slic3r {
 
+// Shares the perimeters of identical islands of a PrintObject, both between the islands of one layer and between layers.
+// An island is identified by its shape, by the lower and upper slices around it and by everything else PerimeterGenerator
+// reads, all relative to the corner of the island's bounding box. Identical islands are generated once, the copies get
+// the extrusions and infill areas of the first one translated to their own position.
+class PerimeterIslandCache
+{
+public:
+    struct Key
+    {
+        const PrintRegionConfig *config { nullptr };
+        // Clamped to raft_layers + 1, above that PerimeterGenerator does not depend on the layer index.
+        int                      layer_id { 0 };
+        double                   layer_height { 0. };
+        Flow                     perimeter_flow;
+        Flow                     ext_perimeter_flow;
+        Flow                     overhang_flow;
+        Flow                     solid_infill_flow;
+        bool                     has_lower_slices { false };
+        bool                     has_upper_slices { false };
+        unsigned short           extra_perimeters { 0 };
+        bool                     counter_circle_compensation { false };
+        std::vector<int>         holes_circle_compensation;
+        ExPolygon                island;
+        // Lower and upper slices clipped to the bounding box of the island inflated by the reach of PerimeterGenerator.
+        Polygons                 lower_slices;
+        Polygons                 upper_slices;
+        size_t                   hash { 0 };
+
+        bool operator==(const Key &rhs) const;
+    };
+
+    // Outputs of PerimeterGenerator for one island.
+    struct Result
+    {
+        ExtrusionEntityCollection loops;
+        ExtrusionEntityCollection gap_fill;
+        ExPolygons                fill_expolygons;
+        ExPolygons                fill_no_overlap;
+    };
+
+    struct Stats
+    {
+        size_t hits;
+        size_t misses;
+        size_t entries;
+    };
+
+    std::shared_ptr<const Result> find(const Key &key);
+    // If an identical island was stored concurrently by another layer, the first result is kept.
+    void                          insert(Key &&key, std::shared_ptr<const Result> result);
+    Stats                         stats() const;
+
+private:
+    struct KeyHash { size_t operator()(const Key &key) const { return key.hash; } };
+
+    mutable std::mutex                                                    m_mutex;
+    std::unordered_map<Key, std::shared_ptr<const Result>, KeyHash>      m_entries;
+    size_t                                                                m_hits { 0 };
+    size_t                                                                m_misses { 0 };
+};
+
 class PerimeterGenerator {
 public:
     // Inputs:
@@ -25,6 +90,8 @@ public:
     const PrintRegionConfig     *config;
     const PrintObjectConfig     *object_config;
     const PrintConfig           *print_config;
+    // Islands identical to an island generated before take its perimeters from here, if set.
+    PerimeterIslandCache        *island_cache;
     // Outputs:
     ExtrusionEntityCollection   *loops;
     ExtrusionEntityCollection   *gap_fill;
@@ -64,7 +131,7 @@ public:
         : slices(slices), upper_slices(nullptr), lower_slices(nullptr), layer_height(layer_height),
             layer_id(-1), perimeter_flow(flow), ext_perimeter_flow(flow),
             overhang_flow(flow), solid_infill_flow(flow),
-            config(config), object_config(object_config), print_config(print_config),
+            config(config), object_config(object_config), print_config(print_config), island_cache(nullptr),
             m_spiral_vase(spiral_mode),
             m_scaled_resolution(scaled<double>(print_config->resolution.value > EPSILON ? print_config->resolution.value : EPSILON)), loops(loops),
         gap_fill(gap_fill),
@@ -93,6 +160,12 @@ private:
     std::vector<Polygons>     generate_lower_polygons_series(float width);
     std::pair<double, double> dist_boundary(double width);
 
+    // Key of the surface in the island cache, empty if its perimeters cannot be shared.
+    // origin is the corner of the bounding box of the surface, relative to which the key and the cached result are stored.
+    std::optional<PerimeterIslandCache::Key> island_cache_key(const Surface &surface, Point &origin) const;
+    // Appends the outputs of a cached island, translated to origin.
+    void                      append_cached_island(const PerimeterIslandCache::Result &result, const Point &origin);
+
 private:
     bool        m_spiral_vase;
     double      m_scaled_resolution;
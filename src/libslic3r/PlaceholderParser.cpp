@@ -1508,6 +1508,11 @@ namespace client
 
 static std::string process_macro(const std::string &templ, client::MyContext &context)
 {
+    if (! context.just_boolean_expression && templ.find_first_of("[{") == std::string::npos)
+        // Plain text without any macro or legacy variable expansion, such as most of the custom G-codes, is output verbatim.
+        // Don't run the parser over it.
+        return templ;
+
     typedef std::string::const_iterator iterator_type;
     typedef client::macro_processor<iterator_type> macro_processor;
 
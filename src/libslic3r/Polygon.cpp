@@ -724,6 +724,60 @@ bool contains(const Polygons &polygons, const Point &p, bool border_result)
     return (poly_count_inside % 2) == 1;
 }
 
+std::vector<bool> contains_points(const Polygon &polygon, const Points &points, bool border_result)
+{
+    std::vector<bool> out(points.size(), false);
+    if (polygon.size() < 3 || points.empty())
+        return out;
+
+    // Points outside of the bounding box are outside of the polygon, the remaining ones are sorted by Y.
+    BoundingBox         bbox = get_extents<true>(polygon.points);
+    std::vector<size_t> sorted;
+    for (size_t i = 0; i < points.size(); ++ i)
+        if (bbox.contains(points[i]))
+            sorted.emplace_back(i);
+    if (sorted.empty())
+        return out;
+    std::sort(sorted.begin(), sorted.end(), [&points](size_t l, size_t r) { return points[l].y() < points[r].y(); });
+
+    // Same edge rules as ClipperLib::PointInPolygon(), evaluated edge by edge.
+    // 0: outside, 1: inside, -1: on the boundary.
+    std::vector<int8_t> result(points.size(), 0);
+    Point ip = polygon.points.back();
+    for (const Point &ip_next : polygon.points) {
+        auto begin = std::lower_bound(sorted.begin(), sorted.end(), std::min(ip.y(), ip_next.y()),
+            [&points](size_t idx, coord_t y) { return points[idx].y() < y; });
+        auto end   = std::upper_bound(begin, sorted.end(), std::max(ip.y(), ip_next.y()),
+            [&points](coord_t y, size_t idx) { return y < points[idx].y(); });
+        for (auto it = begin; it != end; ++ it) {
+            int8_t &res = result[*it];
+            if (res == -1)
+                continue;
+            const Point &pt = points[*it];
+            if (ip_next.y() == pt.y() && (ip_next.x() == pt.x() || (ip.y() == pt.y() && ((ip_next.x() > pt.x()) == (ip.x() < pt.x()))))) {
+                res = -1;
+                continue;
+            }
+            if ((ip.y() < pt.y()) != (ip_next.y() < pt.y())) {
+                if (ip.x() >= pt.x() && ip_next.x() > pt.x()) {
+                    res = 1 - res;
+                } else if (ip.x() >= pt.x() || ip_next.x() > pt.x()) {
+                    double d = double(ip.x() - pt.x()) * (ip_next.y() - pt.y()) - double(ip_next.x() - pt.x()) * (ip.y() - pt.y());
+                    if (d == 0)
+                        res = -1;
+                    else if ((d > 0) == (ip_next.y() > ip.y()))
+                        res = 1 - res;
+                }
+            }
+        }
+        ip = ip_next;
+    }
+
+    for (size_t idx : sorted)
+        out[idx] = result[idx] == -1 ? border_result : result[idx] == 1;
+    return out;
+}
+
 Polygon make_circle(double radius, double error)
 {
     double angle = 2. * acos(1. - error / radius);
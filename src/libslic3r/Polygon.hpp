@@ -18,6 +18,9 @@ using ConstPolygonPtrs  = std::vector<const Polygon*>;
 // Returns true if inside. Returns border_result if on boundary.
 bool contains(const Polygon& polygon, const Point& p, bool border_result = true);
 bool contains(const Polygons& polygons, const Point& p, bool border_result = true);
+// Batch version of contains() testing many points against a single polygon, with the same results.
+// The points are sorted by Y, so that each polygon edge only visits the points within its Y span.
+std::vector<bool> contains_points(const Polygon& polygon, const Points& points, bool border_result = true);
 
 class Polygon : public MultiPoint
 {
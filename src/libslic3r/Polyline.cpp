@@ -146,6 +146,8 @@ Points Polyline::equally_spaced_points(double distance) const
 void Polyline::simplify(double tolerance)
 {
     this->points = MultiPoint::_douglas_peucker(this->points, tolerance);
+    // BBS: the simplified toolpaths are kept until the G-code is exported, do not keep the capacity of the growing vector.
+    this->points.shrink_to_fit();
     this->fitting_result.clear();
 }
 
@@ -153,6 +155,8 @@ void Polyline::simplify_by_fitting_arc(double tolerance)
 {
     //BBS: do arc fit first, then use DP simplify to handle the straight part to reduce point.
     ArcFitter::do_arc_fitting_and_simplify(this->points, this->fitting_result, tolerance);
+    // BBS: the simplified points are gathered into a buffer reserved for all the input points.
+    this->points.shrink_to_fit();
 }
 
 Polylines Polyline::equally_spaced_lines(double distance) const
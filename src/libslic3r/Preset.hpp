@@ -358,8 +358,15 @@ protected:
     friend class        PresetBundle;
 };
 
-bool is_compatible_with_print  (const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_print, const PresetWithVendorProfile &active_printer);
-bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer, const DynamicPrintConfig *extra_config);
+// Results of the compatible_printers_condition / compatible_prints_condition expressions already evaluated against the same
+// active printer (print) and extra config, by condition string. Many presets share their condition, so a caller testing
+// a whole collection against one printer evaluates each distinct condition only once.
+using CompatibleConditionResults = std::unordered_map<std::string, bool>;
+
+bool is_compatible_with_print  (const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_print, const PresetWithVendorProfile &active_printer,
+                                CompatibleConditionResults *condition_results = nullptr);
+bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer, const DynamicPrintConfig *extra_config,
+                                CompatibleConditionResults *condition_results = nullptr);
 bool is_compatible_with_printer(const PresetWithVendorProfile &preset, const PresetWithVendorProfile &active_printer);
 
 enum class PresetSelectCompatibleType {
@@ -24,6 +24,9 @@
 #include <boost/log/trivial.hpp>
 #include <miniz/miniz.h>
 
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
 
 // Store the print/filament/printer presets into a "presets" subdirectory of the Slic3rPE config dir.
 // This breaks compatibility with the upstream Slic3r if the --datadir is used to switch between the two versions.
@@ -2143,10 +2146,11 @@ void PresetBundle::set_calibrate_printer(std::string name)
     const ConfigOption *opt = active_printer.preset.config.option("nozzle_diameter");
     if (opt) config.set_key_value("num_extruders", new ConfigOptionInt((int) static_cast<const ConfigOptionFloatsNullable *>(opt)->values.size()));
     calibrate_filaments.clear();
+    CompatibleConditionResults condition_results;
     for (size_t i = filaments.num_default_presets(); i < filaments.size(); ++i) {
         const Preset &                preset                          = filaments.m_presets[i];
         const PresetWithVendorProfile this_preset_with_vendor_profile = filaments.get_preset_with_vendor_profile(preset);
-        bool                          is_compatible                   = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config);
+        bool                          is_compatible                   = is_compatible_with_printer(this_preset_with_vendor_profile, active_printer, &config, &condition_results);
         if (is_compatible) calibrate_filaments.insert(&preset);
     }
 }
@@ -3862,11 +3866,39 @@ std::pair<PresetsConfigSubstitutions, size_t> PresetBundle::load_vendor_configs_
     PresetCollection         *presets = nullptr;
     size_t                   presets_loaded = 0;
 
+    // Reading and parsing the json files is independent of the inheritance resolution below,
+    // do it for all the subfiles in parallel, the presets are then created in the order of the vendor profile.
+    struct ParsedSubfile
+    {
+        DynamicPrintConfig                  config;
+        std::map<std::string, std::string>  key_values;
+        std::string                         reason;
+        ConfigSubstitutions                 substitutions;
+        std::exception_ptr                  error;
+    };
+    auto parse_subfiles = [&path, &vendor_name, compatibility_rule](const std::vector<std::pair<std::string, std::string>>& subfiles) {
+        std::vector<ParsedSubfile> parsed(subfiles.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, subfiles.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                ParsedSubfile& out = parsed[i];
+                try {
+                    ConfigSubstitutionContext context{ compatibility_rule };
+                    out.config.load_from_json(path + "/" + vendor_name + "/" + subfiles[i].second, context, false, out.key_values, out.reason);
+                    out.substitutions = std::move(context.substitutions);
+                } catch (...) {
+                    out.error = std::current_exception();
+                }
+            }
+        });
+        return parsed;
+    };
+
     auto parse_subfile = [this, path, vendor_name, presets_loaded, current_vendor_profile](\
         ConfigSubstitutionContext& substitution_context,
         PresetsConfigSubstitutions& substitutions,
         LoadConfigBundleAttributes& flags,
         std::pair<std::string, std::string>& subfile_iter,
+        ParsedSubfile& parsed,
         std::map<std::string, DynamicPrintConfig>& config_maps,
         std::map<std::string, std::string>& filament_id_maps,
         PresetCollection* presets_collection,
@@ -3882,12 +3914,14 @@ std::pair<PresetsConfigSubstitutions, size_t> PresetBundle::load_vendor_configs_
         const DynamicPrintConfig* default_config = nullptr;
         std::string               reason;
         try {
-            std::map<std::string, std::string> key_values;
-            substitution_context.substitutions.clear();
+            if (parsed.error)
+                std::rethrow_exception(parsed.error);
+            std::map<std::string, std::string>& key_values = parsed.key_values;
+            substitution_context.substitutions = std::move(parsed.substitutions);
 
             //parse the json elements
-            DynamicPrintConfig config_src;
-            config_src.load_from_json(subfile, substitution_context, false, key_values, reason);
+            const DynamicPrintConfig& config_src = parsed.config;
+            reason = parsed.reason;
             if (!reason.empty()) {
                 BOOST_LOG_TRIVIAL(error) << __FUNCTION__<< ": load config file "<<subfile<<" Failed!";
                 return reason;
@@ -4066,9 +4100,11 @@ std::pair<PresetsConfigSubstitutions, size_t> PresetBundle::load_vendor_configs_
     presets = &this->prints;
     configs.clear();
     filament_id_maps.clear();
-    for (auto& subfile : process_subfiles)
+    std::vector<ParsedSubfile> parsed_process_subfiles = parse_subfiles(process_subfiles);
+    for (size_t i = 0; i < process_subfiles.size(); ++ i)
     {
-        std::string reason = parse_subfile(substitution_context, substitutions, flags, subfile, configs, filament_id_maps, presets, presets_loaded, description_maps);
+        auto& subfile = process_subfiles[i];
+        std::string reason = parse_subfile(substitution_context, substitutions, flags, subfile, parsed_process_subfiles[i], configs, filament_id_maps, presets, presets_loaded, description_maps);
         if (!reason.empty()) {
             //parse error
             std::string subfile_path = path + "/" + vendor_name + "/" + subfile.second;
@@ -4081,9 +4117,11 @@ std::pair<PresetsConfigSubstitutions, size_t> PresetBundle::load_vendor_configs_
     presets = &this->filaments;
     configs.clear();
     filament_id_maps.clear();
-    for (auto& subfile : filament_subfiles)
+    std::vector<ParsedSubfile> parsed_filament_subfiles = parse_subfiles(filament_subfiles);
+    for (size_t i = 0; i < filament_subfiles.size(); ++ i)
     {
-        std::string reason = parse_subfile(substitution_context, substitutions, flags, subfile, configs, filament_id_maps, presets, presets_loaded, description_maps);
+        auto& subfile = filament_subfiles[i];
+        std::string reason = parse_subfile(substitution_context, substitutions, flags, subfile, parsed_filament_subfiles[i], configs, filament_id_maps, presets, presets_loaded, description_maps);
         if (!reason.empty()) {
             //parse error
             std::string subfile_path = path + "/" + vendor_name + "/" + subfile.second;
@@ -4096,9 +4134,11 @@ std::pair<PresetsConfigSubstitutions, size_t> PresetBundle::load_vendor_configs_
     presets = &this->printers;
     configs.clear();
     filament_id_maps.clear();
-    for (auto& subfile : machine_subfiles)
+    std::vector<ParsedSubfile> parsed_machine_subfiles = parse_subfiles(machine_subfiles);
+    for (size_t i = 0; i < machine_subfiles.size(); ++ i)
     {
-        std::string reason = parse_subfile(substitution_context, substitutions, flags, subfile, configs, filament_id_maps, presets, presets_loaded, description_maps);
+        auto& subfile = machine_subfiles[i];
+        std::string reason = parse_subfile(substitution_context, substitutions, flags, subfile, parsed_machine_subfiles[i], configs, filament_id_maps, presets, presets_loaded, description_maps);
         if (!reason.empty()) {
             //parse error
             std::string subfile_path = path + "/" + vendor_name + "/" + subfile.second;
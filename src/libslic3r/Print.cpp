@@ -13,12 +13,14 @@
 #include "Time.hpp"
 #include "GCode.hpp"
 #include "GCode/WipeTower.hpp"
+#include "GCode/GCodeResultCache.hpp"
 #include "Utils.hpp"
 #include "PrintConfig.hpp"
 #include "Model.hpp"
 #include <float.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <unordered_set>
 #include <boost/filesystem/path.hpp>
@@ -28,6 +30,7 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #include "format.hpp"
 
@@ -35,6 +38,7 @@
 #include "nlohmann/json.hpp"
 
 #include "GCode/ConflictChecker.hpp"
+#include "Format/SliceCache.hpp"
 
 #include <codecvt>
 
@@ -582,6 +586,8 @@ StringObjectException Print::sequential_print_clearance_valid(const Print &print
     {
         // sequential_print_horizontal_clearance_valid
         Polygons convex_hulls_other;
+        // Bounding boxes of convex_hulls_other, the expensive polygon intersections are only calculated for overlapping boxes.
+        BoundingBoxes convex_hulls_other_bboxes;
         if (polygons != nullptr)
             polygons->clear();
         std::vector<size_t> intersecting_idxs;
@@ -622,6 +628,7 @@ StringObjectException Print::sequential_print_clearance_valid(const Print &print
                     convex_hull.translate(instance.shift - print_object->center_offset());
                 }
                 convex_hull_no_offset.translate(instance.shift - print_object->center_offset());
+                const BoundingBox convex_hull_bbox = convex_hull.bounding_box();
                 //juedge the exclude area
                 if (!intersection(exclude_polys, convex_hull_no_offset).empty()) {
                     if (single_object_exception.string.empty()) {
@@ -639,7 +646,7 @@ StringObjectException Print::sequential_print_clearance_valid(const Print &print
 
                 // if output needed, collect indices (inside convex_hulls_other) of intersecting hulls
                 for (size_t i = 0; i < convex_hulls_other.size(); ++i) {
-                    if (! intersection(convex_hulls_other[i], convex_hull).empty()) {
+                    if (convex_hulls_other_bboxes[i].overlap(convex_hull_bbox) && ! intersection(convex_hulls_other[i], convex_hull).empty()) {
                         bool has_exception = false;
                         if (single_object_exception.string.empty()) {
                             single_object_exception.string = (boost::format(L("%1% is too close to others, and collisions may be caused.")) %instance.model_instance->get_object()->name).str();
@@ -660,11 +667,12 @@ StringObjectException Print::sequential_print_clearance_valid(const Print &print
                         if (has_exception) break;
                     }
                 }
-                struct print_instance_info print_info {&instance, convex_hull.bounding_box(), convex_hull};
+                struct print_instance_info print_info {&instance, convex_hull_bbox, convex_hull};
                 print_info.height = instance.print_object->height();
                 print_info.object_index = find_object_index(print.model(), print_object->model_object());
                 print_instance_with_bounding_box.push_back(std::move(print_info));
                 convex_hulls_other.emplace_back(std::move(convex_hull));
+                convex_hulls_other_bboxes.emplace_back(convex_hull_bbox);
             }
         }
         if (!intersecting_idxs.empty()) {
@@ -1631,8 +1639,49 @@ std::map<ObjectID, unsigned int> getObjectExtruderMap(const Print& print) {
 }
 
 // Slicing process, running at a background thread.
+const char* step_name(PrintStep step)
+{
+    switch (step) {
+    case psWipeTower:       return "wipe_tower";
+    case psSkirtBrim:       return "skirt_brim";
+    case psGCodeExport:     return "gcode_export";
+    case psConflictCheck:   return "conflict_check";
+    default:                return "unknown";
+    }
+}
+
+const char* step_name(PrintObjectStep step)
+{
+    switch (step) {
+    case posSlice:                  return "slice";
+    case posPerimeters:             return "make_perimeters";
+    case posPrepareInfill:          return "prepare_infill";
+    case posInfill:                 return "infill";
+    case posIroning:                return "ironing";
+    case posSupportMaterial:        return "generate_support_material";
+    case posDetectOverhangsForLift: return "detect_overhangs_for_lift";
+    case posSimplifyWall:           return "simplify_wall";
+    case posSimplifyInfill:         return "simplify_infill";
+    case posSimplifySupportPath:    return "simplify_support_path";
+    default:                        return "unknown";
+    }
+}
+
+// Does the print need its own task arena to stay within its concurrency quota?
+static bool needs_own_task_arena(int max_concurrency)
+{
+    return max_concurrency > 0 && max_concurrency < tbb::this_task_arena::max_concurrency();
+}
+
 void Print::process(std::unordered_map<std::string, long long>* slice_time, bool use_cache)
 {
+    if (needs_own_task_arena(this->get_max_concurrency())) {
+        // All the parallel loops of the steps run in the arena of their caller, thus they honour its concurrency.
+        tbb::task_arena arena(this->get_max_concurrency());
+        arena.execute([this, slice_time, use_cache]() { this->process(slice_time, use_cache); });
+        return;
+    }
+
     long long start_time = 0, end_time = 0;
     if (slice_time) {
         (*slice_time)[TIME_USING_CACHE] = 0;
@@ -1643,9 +1692,10 @@ void Print::process(std::unordered_map<std::string, long long>* slice_time, bool
 
 
     name_tbb_thread_pool_threads_set_locale();
+    this->slicing_profiler().clear();
 
     //compute the PrintObject with the same geometries
-    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": this=%1%, enter, use_cache=%2%, object size=%3%")%this%use_cache%m_objects.size();
+    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": this=%1%, enter, use_cache=%2%, object size=%3%, concurrency=%4%")%this%use_cache%m_objects.size()%tbb::this_task_arena::max_concurrency();
     if (m_objects.empty())
         return;
 
@@ -1749,90 +1799,44 @@ void Print::process(std::unordered_map<std::string, long long>* slice_time, bool
 
     const AutoContourHolesCompensationParams &auto_contour_holes_compensation_params = AutoContourHolesCompensationParams(m_config);
     if (!use_cache) {
-
-        if (slice_time) {
-            start_time = (long long)Slic3r::Utils::get_current_milliseconds_time_utc();
-        }
-
-
-        for (PrintObject* obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->set_auto_circle_compenstaion_params(auto_contour_holes_compensation_params);
-                obj->make_perimeters();
-            }
-            else {
-                if (obj->set_started(posSlice))
-                    obj->set_done(posSlice);
-                if (obj->set_started(posPerimeters))
-                    obj->set_done(posPerimeters);
-            }
-        }
-
-        if (slice_time) {
-            end_time = (long long)Slic3r::Utils::get_current_milliseconds_time_utc();
-            (*slice_time)[TIME_MAKE_PERIMETERS] = (*slice_time)[TIME_MAKE_PERIMETERS] + end_time - start_time;
-            start_time = (long long)Slic3r::Utils::get_current_milliseconds_time_utc();
-        }
-
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->infill();
-            }
-            else {
-                if (obj->set_started(posPrepareInfill))
-                    obj->set_done(posPrepareInfill);
-                if (obj->set_started(posInfill))
-                    obj->set_done(posInfill);
-            }
-        }
-
-        if (slice_time) {
-            end_time = (long long)Slic3r::Utils::get_current_milliseconds_time_utc();
-            (*slice_time)[TIME_INFILL] = (*slice_time)[TIME_INFILL] + end_time - start_time;
-        }
-
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->ironing();
-            }
-            else {
-                if (obj->set_started(posIroning))
-                    obj->set_done(posIroning);
-            }
-        }
-
-        if (slice_time) {
-            start_time = (long long)Slic3r::Utils::get_current_milliseconds_time_utc();
-        }
-
-        tbb::parallel_for(tbb::blocked_range<int>(0, int(m_objects.size())),
-            [this, need_slicing_objects](const tbb::blocked_range<int>& range) {
+        // BBS: every object walks through its own steps as a separate task, so that the small objects of a mixed size plate
+        // do not wait for the huge ones after each step and the serial tails of the steps of different objects overlap.
+        // The steps of a single object still run in their order. The step times are thus summed over the objects.
+        std::atomic<long long> perimeters_time { 0 }, infill_time { 0 }, support_time { 0 };
+        auto timed_step = [slice_time](std::atomic<long long> &total, auto &&step) {
+            long long step_start_time = slice_time ? (long long)Slic3r::Utils::get_current_milliseconds_time_utc() : 0;
+            step();
+            if (slice_time)
+                total += (long long)Slic3r::Utils::get_current_milliseconds_time_utc() - step_start_time;
+        };
+
+        tbb::parallel_for(tbb::blocked_range<int>(0, int(m_objects.size()), 1),
+            [this, &need_slicing_objects, &auto_contour_holes_compensation_params, &timed_step, &perimeters_time, &infill_time, &support_time](const tbb::blocked_range<int>& range) {
                 for (int i = range.begin(); i < range.end(); i++) {
                     PrintObject* obj = m_objects[i];
                     if (need_slicing_objects.count(obj) != 0) {
-                        obj->generate_support_material();
+                        timed_step(perimeters_time, [obj, &auto_contour_holes_compensation_params]() {
+                            obj->set_auto_circle_compenstaion_params(auto_contour_holes_compensation_params);
+                            obj->make_perimeters();
+                        });
+                        timed_step(infill_time, [obj]() { obj->infill(); });
+                        obj->ironing();
+                        timed_step(support_time, [obj]() { obj->generate_support_material(); });
+                        obj->detect_overhangs_for_lift();
                     }
                     else {
-                        if (obj->set_started(posSupportMaterial))
-                            obj->set_done(posSupportMaterial);
+                        for (PrintObjectStep step : { posSlice, posPerimeters, posPrepareInfill, posInfill, posIroning, posSupportMaterial, posDetectOverhangsForLift })
+                            if (obj->set_started(step))
+                                obj->set_done(step);
                     }
                 }
-            }
-        );
+            },
+            tbb::simple_partitioner());
 
         if (slice_time) {
-            end_time = (long long)Slic3r::Utils::get_current_milliseconds_time_utc();
-            (*slice_time)[TIME_GENERATE_SUPPORT] = (*slice_time)[TIME_GENERATE_SUPPORT] + end_time - start_time;
-        }
-
-        for (PrintObject* obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->detect_overhangs_for_lift();
-            }
-            else {
-                if (obj->set_started(posDetectOverhangsForLift))
-                    obj->set_done(posDetectOverhangsForLift);
-            }
+            (*slice_time)[TIME_MAKE_PERIMETERS] = (*slice_time)[TIME_MAKE_PERIMETERS] + perimeters_time;
+            (*slice_time)[TIME_INFILL] = (*slice_time)[TIME_INFILL] + infill_time;
+            (*slice_time)[TIME_GENERATE_SUPPORT] = (*slice_time)[TIME_GENERATE_SUPPORT] + support_time;
         }
     }
     else {
@@ -1894,8 +1898,11 @@ void Print::process(std::unordered_map<std::string, long long>* slice_time, bool
         }
         else if (this->config().print_sequence != PrintSequence::ByObject) {
             // Initialize the tool ordering, so it could be used by the G-code preview slider for planning tool changes and filament switches.
-            m_tool_ordering = ToolOrdering(*this, -1, false);
-            m_tool_ordering.sort_and_build_data(*this, -1, false);
+            if (! this->restore_tool_ordering()) {
+                m_tool_ordering = ToolOrdering(*this, -1, false);
+                m_tool_ordering.sort_and_build_data(*this, -1, false);
+                this->memoize_tool_ordering();
+            }
             if (m_tool_ordering.empty() || m_tool_ordering.last_extruder() == unsigned(-1))
                 throw Slic3r::SlicingError("The print is empty. The model is not printable with current print settings.");
 
@@ -2098,6 +2105,13 @@ void Print::process(std::unordered_map<std::string, long long>* slice_time, bool
 // It is up to the caller to show an error message.
 std::string Print::export_gcode(const std::string& path_template, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb)
 {
+    if (needs_own_task_arena(this->get_max_concurrency())) {
+        tbb::task_arena arena(this->get_max_concurrency());
+        std::string out;
+        arena.execute([this, &out, &path_template, result, &thumbnail_cb]() { out = this->export_gcode(path_template, result, thumbnail_cb); });
+        return out;
+    }
+
     // output everything to a G-code file
     // The following call may die if the filename_format template substitution fails.
     std::string path = this->output_filepath(path_template);
@@ -2117,6 +2131,7 @@ std::string Print::export_gcode(const std::string& path_template, GCodeProcessor
     const Vec3d origin = this->get_plate_origin();
     gcode.set_gcode_offset(origin(0), origin(1));
     gcode.do_export(this, path.c_str(), result, thumbnail_cb);
+    m_gcode_pipeline_stats = gcode.pipeline_stats();
     gcode.export_layer_filaments(result);
     //BBS
     if (result != nullptr)
@@ -2634,47 +2649,56 @@ void Print::_make_wipe_tower()
 
     // Let the ToolOrdering class know there will be initial priming extrusions at the start of the print.
     // BBS: priming logic is removed, so don't consider it in tool ordering
-    m_wipe_tower_data.tool_ordering = ToolOrdering(*this, (unsigned int)-1, false);
-    m_wipe_tower_data.tool_ordering.sort_and_build_data(*this, (unsigned int)-1, false);
-
-    if (!m_wipe_tower_data.tool_ordering.has_wipe_tower())
-        // Don't generate any wipe tower.
-        return;
+    // The memoized tool ordering already has the support layers below the object inserted.
+    if (this->restore_tool_ordering()) {
+        if (!m_wipe_tower_data.tool_ordering.has_wipe_tower())
+            return;
+    } else {
+        m_wipe_tower_data.tool_ordering = ToolOrdering(*this, (unsigned int)-1, false);
+        m_wipe_tower_data.tool_ordering.sort_and_build_data(*this, (unsigned int)-1, false);
 
-    // Check whether there are any layers in m_tool_ordering, which are marked with has_wipe_tower,
-    // they print neither object, nor support. These layers are above the raft and below the object, and they
-    // shall be added to the support layers to be printed.
-    // see https://github.com/prusa3d/PrusaSlicer/issues/607
-    {
-        size_t idx_begin = size_t(-1);
-        size_t idx_end   = m_wipe_tower_data.tool_ordering.layer_tools().size();
-        // Find the first wipe tower layer, which does not have a counterpart in an object or a support layer.
-        for (size_t i = 0; i < idx_end; ++ i) {
-            const LayerTools &lt = m_wipe_tower_data.tool_ordering.layer_tools()[i];
-            if (lt.has_wipe_tower && ! lt.has_object && ! lt.has_support) {
-                idx_begin = i;
-                break;
-            }
+        if (!m_wipe_tower_data.tool_ordering.has_wipe_tower()) {
+            // Don't generate any wipe tower.
+            this->memoize_tool_ordering();
+            return;
         }
-        if (idx_begin != size_t(-1)) {
-            // Find the position in m_objects.first()->support_layers to insert these new support layers.
-            double wipe_tower_new_layer_print_z_first = m_wipe_tower_data.tool_ordering.layer_tools()[idx_begin].print_z;
-            auto it_layer = m_objects.front()->support_layers().begin();
-            auto it_end   = m_objects.front()->support_layers().end();
-            for (; it_layer != it_end && (*it_layer)->print_z - EPSILON < wipe_tower_new_layer_print_z_first; ++ it_layer);
-            // Find the stopper of the sequence of wipe tower layers, which do not have a counterpart in an object or a support layer.
-            for (size_t i = idx_begin; i < idx_end; ++ i) {
-                LayerTools &lt = const_cast<LayerTools&>(m_wipe_tower_data.tool_ordering.layer_tools()[i]);
-                if (! (lt.has_wipe_tower && ! lt.has_object && ! lt.has_support))
+
+        // Check whether there are any layers in m_tool_ordering, which are marked with has_wipe_tower,
+        // they print neither object, nor support. These layers are above the raft and below the object, and they
+        // shall be added to the support layers to be printed.
+        // see https://github.com/prusa3d/PrusaSlicer/issues/607
+        {
+            size_t idx_begin = size_t(-1);
+            size_t idx_end   = m_wipe_tower_data.tool_ordering.layer_tools().size();
+            // Find the first wipe tower layer, which does not have a counterpart in an object or a support layer.
+            for (size_t i = 0; i < idx_end; ++ i) {
+                const LayerTools &lt = m_wipe_tower_data.tool_ordering.layer_tools()[i];
+                if (lt.has_wipe_tower && ! lt.has_object && ! lt.has_support) {
+                    idx_begin = i;
                     break;
-                lt.has_support = true;
-                // Insert the new support layer.
-                double height    = lt.print_z - (i == 0 ? 0. : m_wipe_tower_data.tool_ordering.layer_tools()[i-1].print_z);
-                //FIXME the support layer ID is set to -1, as Vojtech hopes it is not being used anyway.
-                it_layer = m_objects.front()->insert_support_layer(it_layer, -1, 0, height, lt.print_z, lt.print_z - 0.5 * height);
-                ++ it_layer;
+                }
+            }
+            if (idx_begin != size_t(-1)) {
+                // Find the position in m_objects.first()->support_layers to insert these new support layers.
+                double wipe_tower_new_layer_print_z_first = m_wipe_tower_data.tool_ordering.layer_tools()[idx_begin].print_z;
+                auto it_layer = m_objects.front()->support_layers().begin();
+                auto it_end   = m_objects.front()->support_layers().end();
+                for (; it_layer != it_end && (*it_layer)->print_z - EPSILON < wipe_tower_new_layer_print_z_first; ++ it_layer);
+                // Find the stopper of the sequence of wipe tower layers, which do not have a counterpart in an object or a support layer.
+                for (size_t i = idx_begin; i < idx_end; ++ i) {
+                    LayerTools &lt = const_cast<LayerTools&>(m_wipe_tower_data.tool_ordering.layer_tools()[i]);
+                    if (! (lt.has_wipe_tower && ! lt.has_object && ! lt.has_support))
+                        break;
+                    lt.has_support = true;
+                    // Insert the new support layer.
+                    double height    = lt.print_z - (i == 0 ? 0. : m_wipe_tower_data.tool_ordering.layer_tools()[i-1].print_z);
+                    //FIXME the support layer ID is set to -1, as Vojtech hopes it is not being used anyway.
+                    it_layer = m_objects.front()->insert_support_layer(it_layer, -1, 0, height, lt.print_z, lt.print_z - 0.5 * height);
+                    ++ it_layer;
+                }
             }
         }
+        this->memoize_tool_ordering();
     }
     this->throw_if_canceled();
 
@@ -2809,6 +2833,51 @@ void Print::_make_wipe_tower()
     m_fake_wipe_tower.outer_wall = wipe_tower.get_outer_wall();
 }
 
+std::string Print::tool_ordering_fingerprint() const
+{
+    // Options consumed by the wipe tower generation only, the ToolOrdering does not depend on them.
+    static const std::unordered_set<std::string> wipe_tower_only_keys {
+        "flush_multiplier", "filament_prime_volume", "filament_minimal_purge_on_wipe_tower", "grab_length",
+        "wipe_tower_x", "wipe_tower_y", "wipe_tower_rotation_angle",
+        "prime_tower_width", "prime_tower_brim_width", "prime_tower_max_speed", "prime_tower_lift_speed", "prime_tower_lift_height",
+        "prime_tower_rib_wall", "prime_tower_extra_rib_length", "prime_tower_rib_width", "prime_tower_fillet_wall",
+        "prime_tower_enable_framework", "prime_tower_skip_points", "filament_adhesiveness_category"
+    };
+    std::string fingerprint = this->has_wipe_tower() ? "wipe_tower\n" : "\n";
+    for (const t_config_option_key &opt_key : m_config.keys())
+        if (wipe_tower_only_keys.find(opt_key) == wipe_tower_only_keys.end())
+            fingerprint += opt_key + "=" + m_config.opt_serialize(opt_key) + "\n";
+    // Any step of an object being executed again gives it a new timestamp.
+    for (const PrintObject *object : m_objects) {
+        fingerprint += std::to_string(uintptr_t(object));
+        for (int step = 0; step < int(posCount); ++ step)
+            fingerprint += " " + std::to_string(object->step_state_with_timestamp(PrintObjectStep(step)).timestamp);
+        fingerprint += "\n";
+        for (const t_config_option_key &opt_key : object->config().keys())
+            fingerprint += opt_key + "=" + object->config().opt_serialize(opt_key) + "\n";
+        for (size_t region_id = 0; region_id < object->num_printing_regions(); ++ region_id)
+            for (const t_config_option_key &opt_key : object->printing_region(region_id).config().keys())
+                fingerprint += opt_key + "=" + object->printing_region(region_id).config().opt_serialize(opt_key) + "\n";
+    }
+    return fingerprint;
+}
+
+bool Print::restore_tool_ordering()
+{
+    if (! m_tool_ordering_memo || !(m_tool_ordering_memo->custom_gcodes == m_model.get_curr_plate_custom_gcodes()) ||
+        m_tool_ordering_memo->fingerprint != this->tool_ordering_fingerprint())
+        return false;
+    m_tool_ordering = m_tool_ordering_memo->tool_ordering;
+    BOOST_LOG_TRIVIAL(debug) << "Tool ordering reused from the previous wipe tower generation";
+    return true;
+}
+
+void Print::memoize_tool_ordering()
+{
+    // The fingerprint is taken after the ToolOrdering was generated, which may have updated the filament maps of the config.
+    m_tool_ordering_memo = ToolOrderingMemo{ this->tool_ordering_fingerprint(), m_model.get_curr_plate_custom_gcodes(), m_tool_ordering };
+}
+
 // Generate a recommended G-code output file name based on the format template, default extension, and template parameters
 // (timestamps, object placeholders derived from the model, current placeholder prameters and print statistics.
 // Use the final print statistics if available, or just keep the print statistics placeholders if not available yet (before G-code is finalized).
@@ -2840,9 +2909,20 @@ void Print::set_gcode_file_invalidated()
 //BBS: add gcode file preload logic
 void Print::export_gcode_from_previous_file(const std::string& file, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb)
 {
+    //BBS: reuse the processed result stored next to the G-code, if it was written for the very same G-code and plate
+    const Vec3d       origin     = this->get_plate_origin();
+    const Vec2d       xy_offset(origin(0), origin(1));
+    const std::string cache_file = file + GCodeResultCache::FILE_EXTENSION;
+    const std::string gcode_md5  = GCodeResultCache::file_md5(file);
+    if (GCodeResultCache::load(*result, gcode_md5, xy_offset, cache_file)) {
+        result->filename = file;
+        result->id       = GCodeProcessor::next_result_id();
+        BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": loaded the processed G-code file %1% from %2%") % file % cache_file;
+        return;
+    }
+
     try {
         GCodeProcessor processor;
-        const Vec3d origin = this->get_plate_origin();
         processor.set_xy_offset(origin(0), origin(1));
         //processor.enable_producers(true);
         processor.process_file(file);
@@ -2855,6 +2935,8 @@ void Print::export_gcode_from_previous_file(const std::string& file, GCodeProces
     }
 
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ <<  boost::format(":  process the G-code file %1% successfully")%file.c_str();
+    if (! gcode_md5.empty())
+        GCodeResultCache::save(*result, gcode_md5, xy_offset, cache_file);
 }
 
 DynamicConfig PrintStatistics::config() const
@@ -3647,7 +3729,7 @@ static void from_json(const json& j, groupedVolumeSlices& firstlayer_group)
     }
 }
 
-int Print::export_cached_data(const std::string& directory, bool with_space)
+int Print::export_cached_data(const std::string& directory, bool with_space, CachedDataFormat format)
 {
     int ret = 0;
     boost::filesystem::path directory_path(directory);
@@ -3696,6 +3778,28 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
         return;
     };
 
+    // the volume ids of the first layer groups are saved as indices of the volumes
+    auto convert_first_layer_groups = [](const PrintObject* obj) {
+        std::vector<groupedVolumeSlices> groups = obj->firstLayerObjGroups();
+        //BBS: support shared object logic
+        const PrintObject* shared_object = obj->get_shared_object();
+        if (!shared_object)
+            shared_object = obj;
+        const ModelVolumePtrs& volumes_ptr = shared_object->model_object()->volumes;
+        for (groupedVolumeSlices& group : groups) {
+            for (ObjectID& obj_id : group.volume_ids)
+            {
+                for (size_t index = 0; index < volumes_ptr.size(); index ++) {
+                    if (volumes_ptr[index]->id() == obj_id) {
+                        obj_id.id = index;
+                        break;
+                    }
+                }
+            }
+        }
+        return groups;
+    };
+
     //firstly clear this directory
     if (fs::exists(directory_path)) {
         fs::remove_all(directory_path);
@@ -3715,6 +3819,7 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
     int count = 0;
     std::vector<std::string> filename_vector;
     std::vector<json> json_vector;
+    std::vector<std::pair<const PrintObject*, size_t>> binary_objects;
     for (PrintObject *obj : m_objects) {
         const ModelObject* model_obj = obj->model_object();
         if (obj->get_shared_object()) {
@@ -3725,6 +3830,10 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
         const PrintInstance &print_instance = obj->instances()[0];
         const ModelInstance *model_instance = print_instance.model_instance;
         size_t identify_id = (model_instance->loaded_id > 0)?model_instance->loaded_id: model_instance->id().id;
+        if (format == CachedDataFormat::Binary) {
+            binary_objects.push_back({obj, identify_id});
+            continue;
+        }
         std::string file_name = directory +"/obj_"+std::to_string(identify_id)+".json";
 
         BOOST_LOG_TRIVIAL(info) << boost::format("begin to dump object %1%, identify_id %2% to %3%")%model_obj->name %identify_id %file_name;
@@ -3838,29 +3947,7 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
             } // for each layer*/
             root_json[JSON_SUPPORT_LAYERS] = std::move(support_layers_json);
 
-            const std::vector<groupedVolumeSlices> &first_layer_obj_groups =  obj->firstLayerObjGroups();
-            for (size_t s_group_index = 0; s_group_index < first_layer_obj_groups.size(); ++ s_group_index) {
-                groupedVolumeSlices group = first_layer_obj_groups[s_group_index];
-
-                //convert the id
-                for (ObjectID& obj_id : group.volume_ids)
-                {
-                    const ModelVolume* currentModelVolumePtr = nullptr;
-                    //BBS: support shared object logic
-                    const PrintObject* shared_object = obj->get_shared_object();
-                    if (!shared_object)
-                        shared_object = obj;
-                    const ModelVolumePtrs& volumes_ptr = shared_object->model_object()->volumes;
-                    size_t volume_count = volumes_ptr.size();
-                    for (size_t index = 0; index < volume_count; index ++) {
-                        currentModelVolumePtr = volumes_ptr[index];
-                        if (currentModelVolumePtr->id() == obj_id) {
-                            obj_id.id = index;
-                            break;
-                        }
-                    }
-                }
-
+            for (const groupedVolumeSlices &group : convert_first_layer_groups(obj)) {
                 json first_layer_group_json;
 
                 first_layer_group_json = group;
@@ -3887,6 +3974,26 @@ int Print::export_cached_data(const std::string& directory, bool with_space)
     }
 
     boost::mutex mutex;
+    //BBS: binary cache, the layers are encoded in parallel inside export_object
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, binary_objects.size()),
+        [&binary_objects, &directory, &convert_first_layer_groups, &ret, &count, &mutex](const tbb::blocked_range<size_t>& object_range) {
+            for (size_t object_index = object_range.begin(); object_index < object_range.end(); ++ object_index) {
+                const PrintObject* obj = binary_objects[object_index].first;
+                size_t identify_id = binary_objects[object_index].second;
+                std::string file_name = directory + "/obj_" + std::to_string(identify_id) + SliceCache::FILE_EXTENSION;
+
+                BOOST_LOG_TRIVIAL(info) << boost::format("begin to dump object %1%, identify_id %2% to %3%")%obj->model_object()->name %identify_id %file_name;
+                int object_ret = SliceCache::export_object(*obj, obj->model_object()->name, identify_id, convert_first_layer_groups(obj), file_name);
+                boost::unique_lock l(mutex);
+                if (object_ret)
+                    ret = object_ret;
+                else
+                    count ++;
+            }
+        }
+    );
+
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, filename_vector.size()),
         [filename_vector, &json_vector, with_space, &ret, &mutex](const tbb::blocked_range<size_t>& output_range) {
@@ -3937,7 +4044,7 @@ int Print::load_cached_data(const std::string& directory)
     };
 
     int count = 0;
-    std::vector<std::pair<std::string, PrintObject*>> object_filenames;
+    std::vector<std::pair<std::string, PrintObject*>> object_filenames, binary_filenames;
     for (PrintObject *obj : m_objects) {
         const ModelObject* model_obj = obj->model_object();
         const PrintInstance &print_instance = obj->instances()[0];
@@ -3953,6 +4060,11 @@ int Print::load_cached_data(const std::string& directory)
             BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": object %1%'s loaded_id is 0, need to use the instance_id %2%")%model_obj->name %identify_id;
             //continue;
         }
+        std::string binary_file_name = directory +"/obj_"+std::to_string(identify_id)+SliceCache::FILE_EXTENSION;
+        if (fs::exists(binary_file_name)) {
+            binary_filenames.push_back({binary_file_name, obj});
+            continue;
+        }
         std::string file_name = directory +"/obj_"+std::to_string(identify_id)+".json";
 
         if (!fs::exists(file_name)) {
@@ -3962,6 +4074,99 @@ int Print::load_cached_data(const std::string& directory)
         object_filenames.push_back({file_name, obj});
     }
 
+    //BBS: binary cache, the file is mapped and every layer is decoded on its own
+    for (const std::pair<std::string, PrintObject*>& binary_filename : binary_filenames) {
+        const std::string& file_name = binary_filename.first;
+        PrintObject *obj = binary_filename.second;
+        SliceCache::ObjectReader reader;
+
+        ret = reader.open(file_name);
+        if (ret)
+            return ret;
+
+        try {
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__<<boost::format(":will load %1%, identify_id %2%, layer_count %3%, support_layer_count %4%")
+                %reader.name() %reader.identify_id() %reader.layers().size() %reader.support_layers().size();
+
+            Layer* previous_layer = NULL;
+            for (size_t index = 0; index < reader.layers().size(); index++)
+            {
+                const SliceCache::LayerRecord& record = reader.layers()[index];
+                Layer* new_layer = obj->add_layer(record.id, record.height, record.print_z, record.slice_z);
+                if (!new_layer) {
+                    BOOST_LOG_TRIVIAL(error) <<__FUNCTION__<< boost::format(":create_layer failed, out of memory");
+                    return CLI_OUT_OF_MEMORY;
+                }
+                if (previous_layer) {
+                    previous_layer->upper_layer = new_layer;
+                    new_layer->lower_layer = previous_layer;
+                }
+                previous_layer = new_layer;
+
+                for (size_t region_index = 0; region_index < record.region_hashes.size(); region_index++)
+                {
+                    const PrintRegion *print_region = find_region(obj, record.region_hashes[region_index]);
+                    if (!print_region) {
+                        BOOST_LOG_TRIVIAL(error) <<__FUNCTION__<< boost::format(":can not find print region of object %1%, layer %2%, print_z %3%, layer_region %4%")
+                            %reader.name() % index %new_layer->print_z %region_index;
+                        return CLI_IMPORT_CACHE_DATA_CAN_NOT_USE;
+                    }
+                    new_layer->add_region(print_region);
+                }
+            }
+
+            Layer* previous_support_layer = NULL;
+            for (const SliceCache::LayerRecord& record : reader.support_layers())
+            {
+                SupportLayer* new_support_layer = obj->add_support_layer(record.id, record.interface_id, record.height, record.print_z);
+                if (!new_support_layer) {
+                    BOOST_LOG_TRIVIAL(error) <<__FUNCTION__<< boost::format(":add_support_layer failed, out of memory");
+                    return CLI_OUT_OF_MEMORY;
+                }
+                if (previous_support_layer) {
+                    previous_support_layer->upper_layer = new_support_layer;
+                    new_support_layer->lower_layer = previous_support_layer;
+                }
+                previous_support_layer = new_support_layer;
+            }
+
+            const size_t layer_count = obj->layer_count();
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, layer_count + obj->support_layer_count()),
+                [&reader, obj, layer_count](const tbb::blocked_range<size_t>& layer_range) {
+                    for (size_t layer_index = layer_range.begin(); layer_index < layer_range.end(); ++ layer_index) {
+                        if (layer_index < layer_count)
+                            reader.load_layer(layer_index, *obj->get_layer(int(layer_index)));
+                        else
+                            reader.load_support_layer(layer_index - layer_count, *obj->get_support_layer(int(layer_index - layer_count)));
+                    }
+                }
+            );
+
+            std::vector<groupedVolumeSlices>& firstlayer_objgroups = obj->firstLayerObjGroupsMod();
+            ModelVolumePtrs& volumes_ptr = obj->model_object()->volumes;
+            for (groupedVolumeSlices& firstlayer_group : reader.load_first_layer_groups()) {
+                for (ObjectID& obj_id : firstlayer_group.volume_ids)
+                {
+                    if (obj_id.id >= volumes_ptr.size()) {
+                        BOOST_LOG_TRIVIAL(error) << __FUNCTION__<< boost::format(": can not find volume_id %1% from object file %2% in firstlayer groups, volume_count %3%!")
+                            %obj_id.id %file_name %volumes_ptr.size();
+                        return CLI_IMPORT_CACHE_LOAD_FAILED;
+                    }
+                    obj_id = volumes_ptr[obj_id.id]->id();
+                }
+                firstlayer_objgroups.push_back(std::move(firstlayer_group));
+            }
+
+            count ++;
+            BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(": load object %1% from %2% successfully.")%count%file_name;
+        }
+        catch(std::exception &err) {
+            BOOST_LOG_TRIVIAL(error) << __FUNCTION__<< ": load from "<<file_name<<" got a generic exception, reason = " << err.what();
+            return CLI_IMPORT_CACHE_LOAD_FAILED;
+        }
+    }
+
     boost::mutex mutex;
     std::vector<json> object_jsons(object_filenames.size());
     tbb::parallel_for(
@@ -15,6 +15,7 @@
 #include "GCode/WipeTower.hpp"
 #include "GCode/ThumbnailData.hpp"
 #include "GCode/GCodeProcessor.hpp"
+#include "GCode/PipelineStats.hpp"
 #include "MultiMaterialSegmentation.hpp"
 
 #include "libslic3r.h"
@@ -104,6 +105,10 @@ enum PrintObjectStep {
     posCount,
 };
 
+// BBS: names of the steps as reported by the SlicingProfiler.
+const char* step_name(PrintStep step);
+const char* step_name(PrintObjectStep step);
+
 // A PrintRegion object represents a group of volumes to print
 // sharing the same config (including the same assigned extruder(s))
 class PrintRegion
@@ -514,6 +519,10 @@ private:
     // It may be called for both the PrintObjectConfig and PrintRegionConfig.
     bool                    invalidate_state_by_config_options(
         const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys);
+    // Invalidate steps based on a set of parameters of a single PrintRegion changed. If the change invalidates the perimeters
+    // but not the slices, the layers not containing the region keep their perimeters.
+    bool                    invalidate_state_by_region_config_options(int region_id,
+        const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys);
     // If ! m_slicing_params.valid, recalculate.
     void                    update_slicing_parameters();
 
@@ -557,7 +566,7 @@ private:
     void combine_infill();
     void _generate_support_material();
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> prepare_adaptive_infill_data(
-        const std::vector<std::pair<const Surface*, float>>& surfaces_w_bottom_z) const;
+        const std::vector<std::pair<const Surface*, float>>& surfaces_w_bottom_z);
     FillLightning::GeneratorPtr prepare_lightning_infill_data();
 
     // BBS
@@ -589,8 +598,16 @@ private:
     // this is set to true when LayerRegion->slices is split in top/internal/bottom
     // so that next call to make_perimeters() performs a union() before computing loops
     bool                    				m_typed_slices = false;
+    // BBS: set by Print::apply() when only the configs of some regions changed, which invalidated posPerimeters but not posSlice,
+    // for example by editing a height range modifier. The next make_perimeters() then regenerates just the layers containing
+    // one of m_perimeters_invalid_regions and keeps the perimeters of the other layers.
+    bool                                    m_perimeters_partially_valid = false;
+    std::vector<int>                        m_perimeters_invalid_regions;
 
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> m_adaptive_fill_octrees;
+    // BBS: hashes of the inputs of m_adaptive_fill_octrees: the transformed mesh, the internal bridges and the line spacing.
+    // An octree is reused by prepare_adaptive_infill_data() if its inputs did not change, for example after editing the infill speed.
+    std::pair<size_t, size_t>               m_adaptive_fill_octrees_hash { 0, 0 };
     FillLightning::GeneratorPtr m_lightning_generator;
 
     std::vector < VolumeSlices >            firstLayerObjSliceByVolume;
@@ -815,7 +832,7 @@ public:
     // If preview_data is not null, the preview_data is filled in for the G-code visualization (not used by the command line Slic3r).
     std::string         export_gcode(const std::string& path_template, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb = nullptr);
     //return 0 means successful
-    int                 export_cached_data(const std::string& dir_path, bool with_space=false);
+    int                 export_cached_data(const std::string& dir_path, bool with_space=false, CachedDataFormat format=CachedDataFormat::Binary);
     int                 load_cached_data(const std::string& directory);
 
     // methods for handling state
@@ -976,6 +993,15 @@ public:
     void set_check_multi_filaments_compatibility(bool check) { m_need_check_multi_filaments_compatibility = check; }
     bool need_check_multi_filaments_compatibility() const { return m_need_check_multi_filaments_compatibility; }
 
+    //BBS: layers in flight in the G-code export pipeline, 0 to derive them from the hardware concurrency
+    void   set_gcode_pipeline_tokens(size_t tokens) { m_gcode_pipeline_tokens = tokens; }
+    size_t gcode_pipeline_tokens() const { return m_gcode_pipeline_tokens; }
+    //BBS: memory allowed for the G-code of the layers in flight in MB, 0 for no limit
+    void   set_gcode_pipeline_memory_budget(size_t budget_mb) { m_gcode_pipeline_memory_budget = budget_mb; }
+    size_t gcode_pipeline_memory_budget() const { return m_gcode_pipeline_memory_budget; }
+    // Counters of the pipelines of the last export_gcode(), one per process_layers() pass.
+    const std::vector<GCodePipelineStats>& gcode_pipeline_stats() const { return m_gcode_pipeline_stats; }
+
     // scaled point
     Vec2d translate_to_print_space(const Point& point) const;
     static FilamentTempType get_filament_temp_type(const std::string& filament_type);
@@ -1009,6 +1035,11 @@ private:
     void                _make_skirt();
     void                _make_wipe_tower();
     void                finalize_first_layer_convex_hull();
+    // Fingerprint of the layers and of the options the ToolOrdering is generated from.
+    std::string         tool_ordering_fingerprint() const;
+    // Restores the ToolOrdering memoized by the previous wipe tower step into m_tool_ordering, if its fingerprint still matches.
+    bool                restore_tool_ordering();
+    void                memoize_tool_ordering();
 
     // Islands of objects and their supports extruded at the 1st layer.
     Polygons            first_layer_islands() const;
@@ -1038,6 +1069,14 @@ private:
     // Following section will be consumed by the GCodeGenerator.
     ToolOrdering 							m_tool_ordering;
     WipeTowerData                           m_wipe_tower_data {m_tool_ordering};
+    // ToolOrdering as generated from the layers, before the wipe tower planned its tool changes into it.
+    // Reused when the wipe tower is regenerated with the layers unchanged, for example after a change of the flushing volumes.
+    struct ToolOrderingMemo {
+        std::string                         fingerprint;
+        CustomGCode::Info                   custom_gcodes;
+        ToolOrdering                        tool_ordering;
+    };
+    std::optional<ToolOrderingMemo>         m_tool_ordering_memo;
 
     // Estimated print time, filament consumed.
     PrintStatistics                         m_print_statistics;
@@ -1063,6 +1102,10 @@ private:
 
     bool m_need_check_multi_filaments_compatibility{true};
 
+    size_t                          m_gcode_pipeline_tokens{0};
+    size_t                          m_gcode_pipeline_memory_budget{0};
+    std::vector<GCodePipelineStats> m_gcode_pipeline_stats;
+
     // To allow GCode to set the Print's GCodeExport step status.
     friend class GCode;
     // Allow PrintObject to access m_mutex and m_cancel_callback.
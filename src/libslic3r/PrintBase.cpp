@@ -8,6 +8,8 @@
 
 #include "I18N.hpp"
 
+#include <nlohmann/json.hpp>
+
 //! macro used to mark string used at localization,
 //! return same string
 #define L(s) Slic3r::I18N::translate(s)
@@ -136,6 +138,31 @@ void PrintBase::status_update_warnings(int step, PrintStateBase::WarningLevel wa
 }
 
 
+void PrintBase::profile_step_started(const char *step, const PrintObjectBase *print_object) const
+{
+    m_slicing_profiler.step_started(step, print_object ? print_object->id() : ObjectID());
+}
+
+void PrintBase::profile_step_finished(const char *step, const PrintObjectBase *print_object) const
+{
+    SlicingProfiler::StepRecord record = m_slicing_profiler.step_finished(step, print_object ? print_object->id() : ObjectID(),
+        print_object ? print_object->model_object()->name : std::string());
+    if (record.count > 0 && m_slicing_profiler.report_status() && m_status_callback) {
+        nlohmann::json record_json;
+        record_json["step"]           = record.step;
+        record_json["object_id"]      = record.object_id.id;
+        record_json["wall_time_ms"]   = record.wall_time_ms;
+        record_json["cpu_time_ms"]    = record.cpu_time_ms;
+        record_json["peak_rss_delta"] = record.peak_rss_delta;
+        if (AllocationTracker::enabled()) {
+            record_json["allocated_bytes"]       = record.allocated_bytes;
+            record_json["allocations"]           = record.allocations;
+            record_json["peak_live_bytes_delta"] = record.peak_live_bytes_delta;
+        }
+        this->set_status(-1, record_json.dump(), SlicingStatus::UPDATE_SLICING_PROFILE);
+    }
+}
+
 std::mutex& PrintObjectBase::state_mutex(PrintBase *print)
 {
 	return print->state_mutex();
@@ -146,6 +173,16 @@ std::function<void()> PrintObjectBase::cancel_callback(PrintBase *print)
 	return print->cancel_callback();
 }
 
+void PrintObjectBase::profile_step_started(PrintBase *print, const char *step)
+{
+    print->profile_step_started(step, this);
+}
+
+void PrintObjectBase::profile_step_finished(PrintBase *print, const char *step)
+{
+    print->profile_step_finished(step, this);
+}
+
 void PrintObjectBase::status_update_warnings(PrintBase *print, int step, PrintStateBase::WarningLevel warning_level,
     const std::string &message, PrintStateBase::SlicingNotificationType message_id)
 {
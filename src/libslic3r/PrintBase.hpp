@@ -13,6 +13,7 @@
 #include "Model.hpp"
 #include "PlaceholderParser.hpp"
 #include "PrintConfig.hpp"
+#include "SlicingProfiler.hpp"
 
 namespace Slic3r {
 
@@ -348,6 +349,9 @@ protected:
     void status_update_warnings(PrintBase *print, int step, PrintStateBase::WarningLevel warning_level,
         const std::string &message, PrintStateBase::SlicingNotificationType message_id = PrintStateBase::SlicingDefaultNotification);
     void emptylayer_update_msg(PrintBase* print, int type, const std::string& message, bool overwrite);
+    // BBS: feed the slicing profiler of the print with the timing of a step of this object.
+    void profile_step_started(PrintBase *print, const char *step);
+    void profile_step_finished(PrintBase *print, const char *step);
 
     ModelObject                  *m_model_object;
 };
@@ -424,7 +428,13 @@ public:
     virtual void            set_task(const TaskParams &params) {}
     // Perform the calculation. This is the only method that is to be called at a worker thread.
     virtual void            process(std::unordered_map<std::string, long long>* slice_time = nullptr, bool use_cache = false) = 0;
-    virtual int             export_cached_data(const std::string& dir_path, bool with_space=false) { return 0;}
+    // BBS: layout of the slicing data written by export_cached_data(), load_cached_data() detects it from the files found.
+    // Json is human readable and kept for debugging, binary is much faster to write and to load.
+    enum class CachedDataFormat : unsigned char {
+        Json,
+        Binary
+    };
+    virtual int             export_cached_data(const std::string& dir_path, bool with_space=false, CachedDataFormat format=CachedDataFormat::Binary) { return 0;}
     virtual int            load_cached_data(const std::string& directory) { return 0;}
     // Clean up after process() finished, either with success, error or if canceled.
     // The adjustments on the Print / PrintObject data due to set_task() are to be reverted here.
@@ -456,7 +466,10 @@ public:
             RELOAD_SLA_PREVIEW                  = 1 << 3,
             // UPDATE_PRINT_STEP_WARNINGS is mutually exclusive with UPDATE_PRINT_OBJECT_STEP_WARNINGS.
             UPDATE_PRINT_STEP_WARNINGS          = 1 << 4,
-            UPDATE_PRINT_OBJECT_STEP_WARNINGS   = 1 << 5
+            UPDATE_PRINT_OBJECT_STEP_WARNINGS   = 1 << 5,
+            // BBS: a step was finished, text contains its SlicingProfiler record in json,
+            // only sent if SlicingProfiler::report_status() is enabled.
+            UPDATE_SLICING_PROFILE              = 1 << 6
         };
         // Bitmap of FlagBits
         unsigned int    flags;
@@ -521,6 +534,14 @@ public:
     std::string get_plate_name() const { return m_plate_name; }
     void set_plate_name(const std::string &name) { m_plate_name = name; }
 
+    //BBS: maximum number of the TBB threads working on process() / export_gcode() of this print, 0 for all the cores.
+    // Lets several jobs of a single process slice concurrently without oversubscribing the cores.
+    int get_max_concurrency() const { return m_max_concurrency; }
+    void set_max_concurrency(int max_concurrency) { m_max_concurrency = max_concurrency; }
+
+    //BBS: wall time, cpu time and peak memory of the steps processed since the last Print::process()
+    SlicingProfiler&       slicing_profiler() const { return m_slicing_profiler; }
+
 protected:
 	friend class PrintObjectBase;
     friend class BackgroundSlicingProcess;
@@ -536,6 +557,9 @@ protected:
     //BBS: add api to update printobject's warnings
 	void                   status_update_warnings(int step, PrintStateBase::WarningLevel warning_level,
 	    const std::string& message, PrintObjectBase &object, PrintStateBase::SlicingNotificationType message_id = PrintStateBase::SlicingDefaultNotification);
+    //BBS: record the timing of a step, print_object is null for the Print steps.
+    void                   profile_step_started(const char *step, const PrintObjectBase *print_object = nullptr) const;
+    void                   profile_step_finished(const char *step, const PrintObjectBase *print_object = nullptr) const;
 
     // If the background processing stop was requested, throw CanceledException.
     // To be called by the worker thread and its sub-threads (mostly launched on the TBB thread pool) regularly.
@@ -556,6 +580,7 @@ protected:
     //BBS: add plate id into print base
     int m_plate_index{ 0 };
     bool m_no_check = false;
+    int m_max_concurrency{ 0 };
 
     // current plate name
     std::string m_plate_name;   // utf8 string
@@ -573,6 +598,8 @@ private:
     // while the data influencing the stage is modified.
     mutable std::mutex                      m_state_mutex;
 
+    mutable SlicingProfiler                 m_slicing_profiler;
+
     friend PrintTryCancel;
 };
 
@@ -585,9 +612,16 @@ public:
     PrintStateBase::StateWithWarnings  step_state_with_warnings(PrintStepEnum step) const { return m_state.state_with_warnings(step, this->state_mutex()); }
 
 protected:
-    bool            set_started(PrintStepEnum step) { return m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); }); }
+    // step_name() is declared next to PrintStepEnum by the derived print.
+    bool            set_started(PrintStepEnum step) {
+        bool started = m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (started)
+            this->profile_step_started(step_name(step));
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintStepEnum step) {
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        this->profile_step_finished(step_name(step));
         if (status.second)
             this->status_update_warnings(static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
         return status.first;
@@ -635,10 +669,15 @@ public:
 protected:
 	PrintObjectBaseWithState(PrintType *print, ModelObject *model_object) : PrintObjectBase(model_object), m_print(print) {}
 
-    bool            set_started(PrintObjectStepEnum step)
-        { return m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintObjectStepEnum step) {
+        bool started = m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (started)
+            this->profile_step_started(m_print, step_name(step));
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintObjectStepEnum step) {
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        this->profile_step_finished(m_print, step_name(step));
         if (status.second)
             this->status_update_warnings(m_print, static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
         return status.first;
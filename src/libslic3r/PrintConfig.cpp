@@ -7796,6 +7796,13 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->cli_params = "level";
     def->set_default_value(new ConfigOptionInt(1));
 
+    def = this->add("max_slicing_threads", coInt);
+    def->label = "Maximum slicing threads";
+    def->tooltip = "Limits the number of threads slicing and exporting each plate, 0 for all the cores. Useful when several slicing jobs share a machine.";
+    def->cli_params = "count";
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(0));
+
     def = this->add("enable_timelapse", coBool);
     def->label = "Enable timeplapse for print";
     def->tooltip = "If enabled, this slicing will be considered using timelapse";
@@ -7876,6 +7883,20 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->tooltip = "Allow 3mf with newer version to be sliced";
     def->cli_params = "option";
     def->set_default_value(new  ConfigOptionBool(false));
+
+    def = this->add("gcode_pipeline_tokens", coInt);
+    def->label = "G-code pipeline tokens";
+    def->tooltip = "Number of layers in flight while exporting G-code, 0 to derive it from the number of CPU cores.";
+    def->cli_params = "count";
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(0));
+
+    def = this->add("gcode_pipeline_memory", coInt);
+    def->label = "G-code pipeline memory";
+    def->tooltip = "Memory in MB allowed for the G-code of the layers in flight while exporting G-code, 0 for no limit. Ignored if gcode_pipeline_tokens is set.";
+    def->cli_params = "MB";
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(0));
 }
 
 const CLIActionsConfigDef    cli_actions_config_def;
@@ -18,19 +18,22 @@
 #include "Fill/FillLightning.hpp"
 #include "Format/STL.hpp"
 #include "InternalBridgeDetector.hpp"
+#include "PerimeterGenerator.hpp"
 #include "AABBTreeLines.hpp"
 
+#include <atomic>
 #include <float.h>
 #include <string_view>
 #include <utility>
 
+#include <boost/container_hash/hash.hpp>
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/concurrent_unordered_set.h>
 
-#include <Shiny/Shiny.h>
+#include "Profiler.hpp"
 
 #include "format.hpp"
 
@@ -326,6 +329,7 @@ void PrintObject::make_perimeters()
     if (! this->set_started(posPerimeters))
         return;
 
+    PROFILE_FUNC();
     m_print->set_status(15, L("Generating walls"));
     BOOST_LOG_TRIVIAL(info) << "Generating walls..." << log_memory_info();
 
@@ -422,18 +426,41 @@ void PrintObject::make_perimeters()
     }
 #endif
 
+    // BBS: only the configs of some regions changed since the perimeters were generated, keep the layers not containing these regions.
+    auto layer_needs_perimeters = [this](const Layer &layer) {
+        if (! m_perimeters_partially_valid)
+            return true;
+        for (const LayerRegion *layerm : layer.regions())
+            if (! layerm->slices.empty() &&
+                std::binary_search(m_perimeters_invalid_regions.begin(), m_perimeters_invalid_regions.end(), layerm->region().print_object_region_id()))
+                return true;
+        return false;
+    };
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
+    std::atomic<size_t> num_layers_generated(0);
+    // Islands with the same shape and surroundings, typically the layers of a prismatic part, share their perimeters.
+    PerimeterIslandCache island_cache;
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, m_layers.size()),
-        [this](const tbb::blocked_range<size_t>& range) {
+        [this, &layer_needs_perimeters, &num_layers_generated, &island_cache](const tbb::blocked_range<size_t>& range) {
+            PROFILE_BLOCK(PrintObject_make_perimeters_range);
             for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                 m_print->throw_if_canceled();
-                m_layers[layer_idx]->make_perimeters();
+                if (layer_needs_perimeters(*m_layers[layer_idx])) {
+                    m_layers[layer_idx]->make_perimeters(&island_cache);
+                    ++ num_layers_generated;
+                }
             }
         }
     );
     m_print->throw_if_canceled();
-    BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - end";
+    BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - end, " << num_layers_generated.load() << " of " << m_layers.size() << " layers generated";
+    {
+        PerimeterIslandCache::Stats stats = island_cache.stats();
+        BOOST_LOG_TRIVIAL(debug) << "Perimeter island cache: " << stats.hits << " hits, " << stats.misses << " misses, " << stats.entries << " entries";
+    }
+    m_perimeters_partially_valid = false;
+    m_perimeters_invalid_regions.clear();
 
     if (this->m_print->m_config.z_direction_outwall_speed_continuous) {
         // BBS: get continuity of nodes
@@ -501,7 +528,10 @@ void PrintObject::prepare_infill()
     // Then the classifcation of $layerm->slices is transfered onto
     // the $layerm->fill_surfaces by clipping $layerm->fill_surfaces
     // by the cummulative area of the previous $layerm->fill_surfaces.
-    this->detect_surfaces_type();
+    {
+        SlicingProfiler::Scope profile(m_print->slicing_profiler(), "detect_surfaces_type", this->id(), this->model_object()->name);
+        this->detect_surfaces_type();
+    }
     m_print->throw_if_canceled();
 
     // Also tiny stInternal surfaces are turned to stInternalSolid.
@@ -513,7 +543,10 @@ void PrintObject::prepare_infill()
         }
 
     // Add solid fills to ensure the shell vertical thickness.
-    this->discover_vertical_shells();
+    {
+        SlicingProfiler::Scope profile(m_print->slicing_profiler(), "discover_vertical_shells", this->id(), this->model_object()->name);
+        this->discover_vertical_shells();
+    }
     m_print->throw_if_canceled();
 
 
@@ -614,6 +647,7 @@ void PrintObject::infill()
     this->prepare_infill();
 
     if (this->set_started(posInfill)) {
+        PROFILE_FUNC();
         m_print->set_status(35, L("Generating infill toolpath"));
 
         const auto& adaptive_fill_octree = this->m_adaptive_fill_octrees.first;
@@ -623,6 +657,7 @@ void PrintObject::infill()
         tbb::parallel_for(
            tbb::blocked_range<size_t>(0, m_layers.size()),
            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree](const tbb::blocked_range<size_t>& range) {
+               PROFILE_BLOCK(PrintObject_infill_range);
                for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                    m_print->throw_if_canceled();
                    m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get());
@@ -685,10 +720,46 @@ void PrintObject::detect_overhangs_for_lift()
             [this, min_overlap](const tbb::blocked_range<size_t>& range)
             {
                 for (size_t layer_id = range.begin(); layer_id < range.end(); ++layer_id) {
+                    m_print->throw_if_canceled();
                     Layer& layer = *m_layers[layer_id];
                     Layer& lower_layer = *layer.lower_layer;
 
-                    ExPolygons overhangs = diff_ex(layer.lslices, offset_ex(lower_layer.lslices, scale_(min_overlap)));
+                    // BBS: bounding box prefilter, only the lower islands close to an island take part in its diff.
+                    // The islands not close to any lower island are overhangs as a whole.
+                    // offset_ex() below uses mitered joins, which may grow sharp corners up to DefaultMiterLimit * delta.
+                    const coord_t overlap_margin = coord_t(std::ceil(DefaultMiterLimit * scale_(min_overlap))) + 1;
+                    std::vector<BoundingBox> lower_bboxes = lower_layer.lslices_bboxes;
+                    if (lower_bboxes.size() != lower_layer.lslices.size()) {
+                        lower_bboxes.clear();
+                        for (const ExPolygon &expoly : lower_layer.lslices)
+                            lower_bboxes.emplace_back(get_extents(expoly));
+                    }
+                    for (BoundingBox &bbox : lower_bboxes)
+                        bbox.offset(overlap_margin);
+
+                    ExPolygons overhangs;
+                    ExPolygons supported_islands;
+                    std::vector<char> lower_used(lower_layer.lslices.size(), false);
+                    for (const ExPolygon &island : layer.lslices) {
+                        BoundingBox island_bbox = get_extents(island);
+                        bool overlaps = false;
+                        for (size_t i = 0; i < lower_bboxes.size(); ++ i)
+                            if (lower_bboxes[i].overlap(island_bbox)) {
+                                lower_used[i] = true;
+                                overlaps = true;
+                            }
+                        if (overlaps)
+                            supported_islands.emplace_back(island);
+                        else
+                            overhangs.emplace_back(island);
+                    }
+                    if (! supported_islands.empty()) {
+                        ExPolygons lower_islands;
+                        for (size_t i = 0; i < lower_used.size(); ++ i)
+                            if (lower_used[i])
+                                lower_islands.emplace_back(lower_layer.lslices[i]);
+                        append(overhangs, diff_ex(supported_islands, offset_ex(lower_islands, scale_(min_overlap))));
+                    }
                     layer.loverhangs = std::move(offset2_ex(overhangs, -0.1f * scale_(m_config.line_width), 0.1f * scale_(m_config.line_width)));
                     layer.loverhangs_bbox = get_extents(layer.loverhangs);
                 }
@@ -801,13 +872,15 @@ void PrintObject::simplify_extrusion_path()
 }
 
 std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare_adaptive_infill_data(
-    const std::vector<std::pair<const Surface *, float>> &surfaces_w_bottom_z) const
+    const std::vector<std::pair<const Surface *, float>> &surfaces_w_bottom_z)
 {
     using namespace FillAdaptive;
 
     auto [adaptive_line_spacing, support_line_spacing] = adaptive_fill_line_spacing(*this);
-    if ((adaptive_line_spacing == 0. && support_line_spacing == 0.) || this->layers().empty())
+    if ((adaptive_line_spacing == 0. && support_line_spacing == 0.) || this->layers().empty()) {
+        m_adaptive_fill_octrees_hash = { 0, 0 };
         return std::make_pair(OctreePtr(), OctreePtr());
+    }
 
     indexed_triangle_set mesh = this->model_object()->raw_indexed_triangle_set();
     // Rotate mesh and build octree on it with axis-aligned (standart base) cubes.
@@ -832,9 +905,31 @@ std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare
     for (size_t i = 1; i < overhangs.size(); ++ i)
         append(overhangs.front(), std::move(overhangs[i]));
 
-    return std::make_pair(
-        adaptive_line_spacing ? build_octree(mesh, overhangs.front(), adaptive_line_spacing, false) : OctreePtr(),
-        support_line_spacing  ? build_octree(mesh, overhangs.front(), support_line_spacing, true) : OctreePtr());
+    // BBS: Reuse the octrees of the previous call if neither the mesh, its transformation, the internal bridges nor the line spacing changed.
+    std::hash<std::string_view> hash;
+    size_t input_hash = hash(std::string_view(reinterpret_cast<const char*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(stl_vertex)));
+    boost::hash_combine(input_hash, hash(std::string_view(reinterpret_cast<const char*>(mesh.indices.data()), mesh.indices.size() * sizeof(stl_triangle_vertex_indices))));
+    boost::hash_combine(input_hash, hash(std::string_view(reinterpret_cast<const char*>(overhangs.front().data()), overhangs.front().size() * sizeof(Vec3d))));
+    auto octree = [this, &mesh, &overhangs, input_hash](double line_spacing, bool support_overhangs_only) {
+        OctreePtr &old_octree = support_overhangs_only ? m_adaptive_fill_octrees.second : m_adaptive_fill_octrees.first;
+        size_t    &old_hash   = support_overhangs_only ? m_adaptive_fill_octrees_hash.second : m_adaptive_fill_octrees_hash.first;
+        if (line_spacing == 0.) {
+            old_hash = 0;
+            return OctreePtr();
+        }
+        size_t new_hash = input_hash;
+        boost::hash_combine(new_hash, line_spacing);
+        if (old_octree && old_hash == new_hash) {
+            BOOST_LOG_TRIVIAL(debug) << "Adaptive infill octree reused, " << (support_overhangs_only ? "support cubic" : "adaptive cubic");
+            return std::move(old_octree);
+        }
+        OctreePtr new_octree = build_octree(mesh, overhangs.front(), line_spacing, support_overhangs_only);
+        old_hash = new_hash;
+        return new_octree;
+    };
+    OctreePtr adaptive_octree = octree(adaptive_line_spacing, false);
+    OctreePtr support_octree  = octree(support_line_spacing, true);
+    return std::make_pair(std::move(adaptive_octree), std::move(support_octree));
 }
 
 FillLightning::GeneratorPtr PrintObject::prepare_lightning_infill_data()
@@ -856,6 +951,8 @@ void PrintObject::clear_layers()
             delete l;
         m_layers.clear();
     }
+    // The tree support caches are computed from the slices.
+    m_tree_support_preview_cache.reset();
 }
 
 Layer* PrintObject::add_layer(int id, coordf_t height, coordf_t print_z, coordf_t slice_z)
@@ -892,9 +989,17 @@ void PrintObject::clear_support_layers()
 
 std::shared_ptr<TreeSupportData> PrintObject::alloc_tree_support_preview_cache()
 {
+    const coordf_t xy_distance = m_config.support_object_xy_distance.value;
+    // Keep the collision and avoidance areas of the previous support generation while the slices and the clearance are the same.
+    if (m_tree_support_preview_cache &&
+        m_tree_support_preview_cache->m_cache_key != TreeSupportData::cache_key(*this, xy_distance, g_config_tree_support_collision_resolution))
+        m_tree_support_preview_cache.reset();
+
     if (!m_tree_support_preview_cache) {
-        const coordf_t xy_distance = m_config.support_object_xy_distance.value;
         m_tree_support_preview_cache = std::make_shared<TreeSupportData>(*this, xy_distance, g_config_tree_support_collision_resolution);
+    } else {
+        m_tree_support_preview_cache->clear_nodes();
+        m_tree_support_preview_cache->layer_heights.clear();
     }
 
     return m_tree_support_preview_cache;
@@ -1192,10 +1297,37 @@ bool PrintObject::invalidate_state_by_config_options(
     return invalidated;
 }
 
+bool PrintObject::invalidate_state_by_region_config_options(
+    int region_id, const ConfigOptionResolver &old_config, const ConfigOptionResolver &new_config, const std::vector<t_config_option_key> &opt_keys)
+{
+    // Perimeters of a layer only depend on the slices of the layer and its neighbors and on the configs of its regions,
+    // thus the layers not containing the modified region may keep their perimeters as long as the slices are kept.
+    const bool       perimeters_done  = this->is_step_done(posPerimeters);
+    const bool       partially_valid  = m_perimeters_partially_valid;
+    std::vector<int> invalid_regions  = m_perimeters_invalid_regions;
+    bool             invalidated      = this->invalidate_state_by_config_options(old_config, new_config, opt_keys);
+    const bool       perimeters_invalidated = perimeters_done ? ! this->is_step_done(posPerimeters) : partially_valid && ! m_perimeters_partially_valid;
+    if (perimeters_invalidated && this->is_step_done(posSlice) &&
+        // The z-direction continuity of the outer walls is calculated over all the layers.
+        ! m_print->config().z_direction_outwall_speed_continuous) {
+        if (auto it = std::lower_bound(invalid_regions.begin(), invalid_regions.end(), region_id); it == invalid_regions.end() || *it != region_id)
+            invalid_regions.insert(it, region_id);
+        m_perimeters_invalid_regions = std::move(invalid_regions);
+        m_perimeters_partially_valid = true;
+    }
+    return invalidated;
+}
+
 bool PrintObject::invalidate_step(PrintObjectStep step)
 {
 	bool invalidated = Inherited::invalidate_step(step);
 
+    if (step == posPerimeters || step == posSlice) {
+        // Regenerate the perimeters of all layers, see invalidate_state_by_region_config_options().
+        m_perimeters_partially_valid = false;
+        m_perimeters_invalid_regions.clear();
+    }
+
     // propagate to dependent steps
     if (step == posPerimeters) {
 		invalidated |= this->invalidate_steps({ posPrepareInfill, posInfill, posIroning, posSimplifyWall, posSimplifyInfill });
@@ -1230,6 +1362,8 @@ bool PrintObject::invalidate_all_steps()
     bool result = Inherited::invalidate_all_steps() | m_print->invalidate_all_steps();
 	// Then reset some of the depending values.
 	m_slicing_params.valid = false;
+    m_perimeters_partially_valid = false;
+    m_perimeters_invalid_regions.clear();
 	return result;
 }
 
@@ -1244,6 +1378,7 @@ bool PrintObject::invalidate_all_steps()
 // If a part of a region is of stBottom and stTop, the stBottom wins.
 void PrintObject::detect_surfaces_type()
 {
+    PROFILE_FUNC();
     BOOST_LOG_TRIVIAL(info) << "Detecting solid surfaces..." << log_memory_info();
 
     // Interface shells: the intersecting parts are treated as self standing objects supporting each other.
@@ -1278,6 +1413,9 @@ void PrintObject::detect_surfaces_type()
             		m_layers.size()),
             [this, spiral_mode, region_id, interface_shells, &surfaces_new](const tbb::blocked_range<size_t>& range) {
                 // BBS coconut: can't set to stBottom when soluable support is used, as the support may not be actaully generated, e.g. when "on build plate only" option is enabled. See github #3507.
+                PROFILE_BLOCK(PrintObject_detect_surfaces_type_range);
+                // BBS: reuse the memory of the Clipper temporaries over the layers of this task.
+                ClipperUtils::ScratchScope clipper_scratch;
                 SurfaceType surface_type_bottom_other = stBottomBridge;
                 for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
                     m_print->throw_if_canceled();
@@ -1506,6 +1644,7 @@ void PrintObject::process_external_surfaces()
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, m_layers.size()),
             [this, &surfaces_covered, region_id](const tbb::blocked_range<size_t>& range) {
+                ClipperUtils::ScratchScope clipper_scratch;
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
                     // BOOST_LOG_TRIVIAL(trace) << "Processing external surface, layer" << m_layers[layer_idx]->print_z;
@@ -1563,6 +1702,7 @@ void PrintObject::discover_vertical_shells()
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, num_layers, grain_size),
             [this, &cache_top_botom_regions](const tbb::blocked_range<size_t>& range) {
+                ClipperUtils::ScratchScope clipper_scratch;
                 const std::initializer_list<SurfaceType> surfaces_bottom{ stBottom, stBottomBridge };
                 const size_t num_regions = this->num_printing_regions();
                 for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++idx_layer) {
@@ -1626,6 +1766,7 @@ void PrintObject::discover_vertical_shells()
             tbb::parallel_for(
                 tbb::blocked_range<size_t>(0, num_layers, grain_size),
                 [this, region_id, &cache_top_botom_regions](const tbb::blocked_range<size_t>& range) {
+                    ClipperUtils::ScratchScope clipper_scratch;
                     const std::initializer_list<SurfaceType> surfaces_bottom { stBottom, stBottomBridge };
                     for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
                         m_print->throw_if_canceled();
@@ -1650,13 +1791,90 @@ void PrintObject::discover_vertical_shells()
             BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - end : cache top / bottom";
         }
 
+        // The layers projected to a layer: <idx_layer + 1, top_shell_end(idx_layer)) from above, <bottom_shell_begin(idx_layer), idx_layer) from below.
+        const PrintRegionConfig &shell_config = region.config();
+        auto top_shell_end = [this, &shell_config, &cache_top_botom_regions](size_t idx_layer) {
+            int i = int(idx_layer) + 1;
+            if (int n_top_layers = shell_config.top_shell_layers.value; n_top_layers > 0) {
+                coordf_t print_z = m_layers[idx_layer]->print_z;
+                int      itop    = int(idx_layer) + n_top_layers;
+                for (; i < int(cache_top_botom_regions.size()) &&
+                       (i < itop || m_layers[i]->print_z - print_z < shell_config.top_shell_thickness - EPSILON);
+                     ++ i) ;
+            }
+            return i;
+        };
+        auto bottom_shell_begin = [this, &shell_config](size_t idx_layer) {
+            int i = int(idx_layer) - 1;
+            if (int n_bottom_layers = shell_config.bottom_shell_layers.value; n_bottom_layers > 0) {
+                coordf_t bottom_z = m_layers[idx_layer]->bottom_z();
+                int      ibottom  = int(idx_layer) - n_bottom_layers;
+                for (; i >= 0 &&
+                       (i > ibottom || bottom_z - m_layers[i]->bottom_z() < shell_config.bottom_shell_thickness - EPSILON);
+                     -- i) ;
+            }
+            return i + 1;
+        };
+        const bool combine_shell_holes = shell_config.ensure_vertical_shell_thickness.value != EnsureVerticalThicknessLevel::evtPartial;
+
+        // BBS: the top / bottom surfaces united and the holes intersected over runs of 2^(level + 1) layers, so that each layer
+        // combines two overlapping runs instead of all its shell layers one by one. Union and intersection are idempotent,
+        // the overlap of the two runs does not change the result.
+        std::vector<std::vector<DiscoverVerticalShellsCacheEntry>> shell_runs;
+        {
+            int max_shell_layers = 0;
+            for (size_t idx_layer = 0; idx_layer < num_layers; ++ idx_layer)
+                max_shell_layers = std::max(max_shell_layers, std::max(top_shell_end(idx_layer) - int(idx_layer) - 1, int(idx_layer) - bottom_shell_begin(idx_layer)));
+            // Not worth the memory for the short runs.
+            if (max_shell_layers >= 4) {
+                for (int run = 2; run <= max_shell_layers && run <= int(num_layers); run *= 2) {
+                    const std::vector<DiscoverVerticalShellsCacheEntry> &half_runs = shell_runs.empty() ? cache_top_botom_regions : shell_runs.back();
+                    std::vector<DiscoverVerticalShellsCacheEntry>        runs(num_layers + 1 - run);
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, runs.size()),
+                        [this, &half_runs, &runs, half = size_t(run / 2), combine_shell_holes](const tbb::blocked_range<size_t>& range) {
+                            ClipperUtils::ScratchScope clipper_scratch;
+                            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                                m_print->throw_if_canceled();
+                                const DiscoverVerticalShellsCacheEntry &lower = half_runs[i];
+                                const DiscoverVerticalShellsCacheEntry &upper = half_runs[i + half];
+                                runs[i].top_surfaces    = union_(lower.top_surfaces, upper.top_surfaces);
+                                runs[i].bottom_surfaces = union_(lower.bottom_surfaces, upper.bottom_surfaces);
+                                if (combine_shell_holes && ! lower.holes.empty() && ! upper.holes.empty())
+                                    runs[i].holes = intersection(lower.holes, upper.holes);
+                            }
+                        });
+                    shell_runs.emplace_back(std::move(runs));
+                }
+                m_print->throw_if_canceled();
+            }
+        }
+        // Union (or intersection for the holes) of a member over the layers <begin, end), end > begin.
+        auto combine_shell_layers = [&shell_runs, &cache_top_botom_regions](int begin, int end, Polygons DiscoverVerticalShellsCacheEntry::*member, bool intersect) {
+            auto combine = [intersect](const Polygons &a, const Polygons &b) {
+                return intersect ? (a.empty() || b.empty() ? Polygons() : intersection(a, b)) : union_(a, b);
+            };
+            int level = 0;
+            while ((2 << level) <= end - begin && level < int(shell_runs.size()))
+                ++ level;
+            if (level == 0 || (4 << (level - 1)) <= end - begin) {
+                // Too few layers, or the runs are not long enough.
+                Polygons out = cache_top_botom_regions[begin].*member;
+                for (int i = begin + 1; i < end; ++ i)
+                    out = combine(out, cache_top_botom_regions[i].*member);
+                return out;
+            }
+            const std::vector<DiscoverVerticalShellsCacheEntry> &runs = shell_runs[level - 1];
+            int last = end - (2 << (level - 1));
+            return last == begin ? runs[begin].*member : combine(runs[begin].*member, runs[last].*member);
+        };
+
         BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : ensure vertical wall thickness";
         grain_size = 1;
         // 从第低到高按层遍历
 #if USE_TBB_IN_INFILL
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, num_layers, grain_size),
-            [this, region_id, &cache_top_botom_regions]
+            [this, region_id, &cache_top_botom_regions, &top_shell_end, &bottom_shell_begin, &combine_shell_layers, combine_shell_holes]
             (const tbb::blocked_range<size_t>& range) {
                 // printf("discover_vertical_shells from %d to %d\n", range.begin(), range.end());
                 for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
@@ -1664,6 +1882,7 @@ void PrintObject::discover_vertical_shells()
         for (size_t idx_layer = 0; idx_layer < num_layers; ++idx_layer) {
 #endif
                     m_print->throw_if_canceled();
+                    ClipperUtils::ScratchScope clipper_scratch;
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
         			static size_t debug_idx = 0;
         			++ debug_idx;
@@ -1708,19 +1927,14 @@ void PrintObject::discover_vertical_shells()
 			        if (int n_top_layers = region_config.top_shell_layers.value; n_top_layers > 0) {
                         // Gather top regions projected to this layer.
                         coordf_t print_z = layer->print_z;
-                        int i = int(idx_layer) + 1;
+                        int i = top_shell_end(idx_layer);
                         int itop = int(idx_layer) + n_top_layers;
-                        bool at_least_one_top_projected = false;
-	                    for (; i < int(cache_top_botom_regions.size()) &&
-	                         (i < itop || m_layers[i]->print_z - print_z < region_config.top_shell_thickness - EPSILON);
-	                        ++ i) {
-                            at_least_one_top_projected = true;
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-                            if (region_config.ensure_vertical_shell_thickness.value != EnsureVerticalThicknessLevel::evtPartial) {
-                                combine_holes(cache.holes);
-                            }
-                            combine_shells(cache.top_surfaces);
-	                    }
+                        bool at_least_one_top_projected = i > int(idx_layer) + 1;
+                        if (at_least_one_top_projected) {
+                            if (combine_shell_holes)
+                                combine_holes(combine_shell_layers(int(idx_layer) + 1, i, &DiscoverVerticalShellsCacheEntry::holes, true));
+                            combine_shells(combine_shell_layers(int(idx_layer) + 1, i, &DiscoverVerticalShellsCacheEntry::top_surfaces, false));
+                        }
                         if (!at_least_one_top_projected && i < int(cache_top_botom_regions.size())) {
                             // Lets consider this a special case - with only 1 top solid and minimal shell thickness settings, the
                             // boundaries of solid layers are not anchored over/under perimeters, so lets fix it by adding at least one
@@ -1739,19 +1953,14 @@ void PrintObject::discover_vertical_shells()
 	                if (int n_bottom_layers = region_config.bottom_shell_layers.value; n_bottom_layers > 0) {
                         // Gather bottom regions projected to this layer.
                         coordf_t bottom_z = layer->bottom_z();
-                        int i = int(idx_layer) - 1;
+                        int i = bottom_shell_begin(idx_layer) - 1;
                         int ibottom = int(idx_layer) - n_bottom_layers;
-                        bool at_least_one_bottom_projected = false;
-	                    for (; i >= 0 &&
-	                         (i > ibottom || bottom_z - m_layers[i]->bottom_z() < region_config.bottom_shell_thickness - EPSILON);
-	                        -- i) {
-                                at_least_one_bottom_projected = true;
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-                            if (region_config.ensure_vertical_shell_thickness.value != EnsureVerticalThicknessLevel::evtPartial) {
-                                combine_holes(cache.holes);
-                            }
-                            combine_shells(cache.bottom_surfaces);
-	                    }
+                        bool at_least_one_bottom_projected = i < int(idx_layer) - 1;
+                        if (at_least_one_bottom_projected) {
+                            if (combine_shell_holes)
+                                combine_holes(combine_shell_layers(i + 1, int(idx_layer), &DiscoverVerticalShellsCacheEntry::holes, true));
+                            combine_shells(combine_shell_layers(i + 1, int(idx_layer), &DiscoverVerticalShellsCacheEntry::bottom_surfaces, false));
+                        }
 
                         if (!at_least_one_bottom_projected && i >= 0) {
                             Polygons anchor_area = intersection(expand(cache_top_botom_regions[idx_layer].bottom_surfaces,
@@ -1891,6 +2100,7 @@ void PrintObject::discover_vertical_shells()
     // Write the profiler measurements to file
 //    PROFILE_UPDATE();
 //    PROFILE_OUTPUT(debug_out_path("discover_vertical_shells-profile.txt").c_str());
+//    PROFILE_OUTPUT_TRACE(debug_out_path("discover_vertical_shells-profile.trace.json").c_str());
 }
 
 
@@ -1902,6 +2112,7 @@ void PrintObject::discover_shell_for_perimeters()
     tbb::parallel_for(tbb::blocked_range<size_t>(0, m_layers.size()),
         [this,num_regions](const tbb::blocked_range<size_t> &range){
             for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++idx_layer) {
+                m_print->throw_if_canceled();
                 Layer* layer = m_layers[idx_layer];
                 if (!layer->lower_layer)
                     continue;
@@ -1987,6 +2198,7 @@ void PrintObject::bridge_over_infill()
         auto po = static_cast<const PrintObject*>(this);
         for(size_t lidx =0;lidx<this->layers().size();++lidx){
 #endif
+                    po->print()->throw_if_canceled();
                     const Layer *layer = po->get_layer(lidx);
                     if (layer->lower_layer == nullptr) {
                         continue;
@@ -2019,7 +2231,7 @@ void PrintObject::bridge_over_infill()
                     for (LayerRegion *region : layer->regions()) {
                         auto region_internal_solids =  region->fill_surfaces.filter_by_type(stInternalSolid); // 取当前层的实心区域
                         for (const Surface *s : region_internal_solids) {
-                            Polygons unsupported         = intersection(to_polygons(s->expolygon), unsupported_area); // 当前层需要生成桥接的区域，通过当前层的实心区域与下一层的非实心区域求交得到
+                            Polygons unsupported         = intersection_clipped(to_polygons(s->expolygon), unsupported_area); // 当前层需要生成桥接的区域，通过当前层的实心区域与下一层的非实心区域求交得到
                             // The following flag marks those surfaces, which overlap with unuspported area, but at least part of them is supported.
                             // These regions can be filtered by area, because they for sure are touching solids on lower layers, and it does not make sense to bridge their tiny overhangs
                             bool     partially_supported = area(unsupported) < area(to_polygons(s->expolygon)) - EPSILON;
@@ -2085,6 +2297,7 @@ void PrintObject::bridge_over_infill()
                 for (size_t lidx = r.begin(); lidx < r.end(); lidx++) {
                     if (surfaces_by_layer.find(lidx) == surfaces_by_layer.end())
                         continue;
+                    po->print()->throw_if_canceled();
 
                     Layer       *layer       = po->get_layer(lidx);
                     const Layer *lower_layer = layer->lower_layer;
@@ -2175,6 +2388,7 @@ void PrintObject::bridge_over_infill()
             &layers_to_generate_infill,
             &infill_lines](tbb::blocked_range<size_t> r) {
                 for (size_t job_idx = r.begin(); job_idx < r.end(); job_idx++) {
+                    po->print()->throw_if_canceled();
                     size_t lidx = layers_to_generate_infill[job_idx];
                     infill_lines.at(
                         lidx) = po->get_layer(lidx)->generate_sparse_infill_polylines_for_anchoring(po->m_adaptive_fill_octrees.first.get(),
@@ -2202,11 +2416,12 @@ void PrintObject::bridge_over_infill()
 
         // prepare inflated filter for each candidate on each layer. layers will be put into single thread cluster if they are close to each other (z-axis-wise)
         // and if the inflated AABB polygons overlap somewhere
-        tbb::parallel_for(tbb::blocked_range<size_t>(0, layers_with_candidates.size()), [&layers_with_candidates, &surfaces_by_layer,
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, layers_with_candidates.size()), [this, &layers_with_candidates, &surfaces_by_layer,
             &layer_area_covered_by_candidates](
                 tbb::blocked_range<size_t> r) {
                     // 按层并行
                     for (size_t job_idx = r.begin(); job_idx < r.end(); job_idx++) {
+                        m_print->throw_if_canceled();
                         size_t lidx = layers_with_candidates[job_idx];
                         for (const auto &candidate : surfaces_by_layer.at(lidx)) {
                             Polygon candiate_inflated_aabb = get_extents(candidate.new_polys).inflated(scale_(7)).polygon();
@@ -2543,6 +2758,7 @@ void PrintObject::bridge_over_infill()
             tbb::blocked_range<size_t> r) {
                 for (size_t cluster_idx = r.begin(); cluster_idx < r.end(); cluster_idx++) {
                     for (size_t job_idx = 0; job_idx < clustered_layers_for_threads[cluster_idx].size(); job_idx++) {
+                        po->print()->throw_if_canceled();
                         size_t       lidx  = clustered_layers_for_threads[cluster_idx][job_idx];
                         const Layer *layer = po->get_layer(lidx);
                         // this thread has exclusive access to all surfaces in layers enumerated in
@@ -2625,8 +2841,20 @@ void PrintObject::bridge_over_infill()
                         total_fill_area   = closing(total_fill_area, float(SCALED_EPSILON));
                         expansion_area    = closing(expansion_area, float(SCALED_EPSILON));
                         expansion_area    = intersection(expansion_area, deep_infill_area);
-                        Polylines anchors = intersection_pl(infill_lines[lidx - 1], shrink(expansion_area, spacing));
+                        Polygons  anchoring_area = shrink(expansion_area, spacing);
+                        Polylines anchors;
+                        if (!anchoring_area.empty()) {
+                            // Only the infill lines of the lower layer crossing the anchoring area bounding box are clipped.
+                            BoundingBox anchoring_bbox = get_extents(anchoring_area);
+                            Polylines   anchor_candidates;
+                            for (const Polyline &pl : infill_lines[lidx - 1])
+                                if (anchoring_bbox.overlap(get_extents(pl)))
+                                    anchor_candidates.push_back(pl);
+                            anchors = intersection_pl(anchor_candidates, anchoring_area);
+                        }
                         Polygons internal_unsupported_area = shrink(deep_infill_area, spacing * 4.5);
+                        // Outlines of the expanded fill area, shared by the candidates with the same bridging flow spacing.
+                        std::vector<std::pair<coord_t, Polylines>> fill_boundaries;
 
 #ifdef DEBUG_BRIDGE_OVER_INFILL
                         debug_draw(std::to_string(lidx) + "_" + std::to_string(cluster_idx) + "_" + std::to_string(job_idx) + "_" + "_total_area",
@@ -2638,11 +2866,11 @@ void PrintObject::bridge_over_infill()
                         for (const CandidateSurface &candidate : surfaces_by_layer[lidx]) {
                             const Flow &flow              = candidate.region->bridging_flow(frSolidInfill, true);
                             Polygons    area_to_be_bridge = expand(candidate.new_polys, flow.scaled_spacing()); // 待生成桥接区域
-                            area_to_be_bridge             = intersection(area_to_be_bridge, deep_infill_area);
+                            area_to_be_bridge             = intersection_clipped(area_to_be_bridge, deep_infill_area);
                             ExPolygons area_to_be_bridge_ex = union_ex(area_to_be_bridge);
                             area_to_be_bridge_ex.erase(std::remove_if(area_to_be_bridge_ex.begin(), area_to_be_bridge_ex.end(),
-                                [internal_unsupported_area](const ExPolygon &p) {
-                                    return intersection({p}, internal_unsupported_area).empty();
+                                [&internal_unsupported_area](const ExPolygon &p) {
+                                    return intersection_clipped(to_polygons(p), internal_unsupported_area).empty();
                                 }),
                                 area_to_be_bridge_ex.end());
 
@@ -2653,7 +2881,13 @@ void PrintObject::bridge_over_infill()
                             if (area_to_be_bridge.empty())
                                 continue;
 
-                            Polylines boundary_plines = to_polylines(expand(total_fill_area, 1.3 * flow.scaled_spacing()));
+                            auto fill_boundary = std::find_if(fill_boundaries.begin(), fill_boundaries.end(),
+                                [&flow](const std::pair<coord_t, Polylines> &b) { return b.first == flow.scaled_spacing(); });
+                            if (fill_boundary == fill_boundaries.end()) {
+                                fill_boundaries.emplace_back(flow.scaled_spacing(), to_polylines(expand(total_fill_area, 1.3 * flow.scaled_spacing())));
+                                fill_boundary = std::prev(fill_boundaries.end());
+                            }
+                            Polylines boundary_plines = fill_boundary->second;
                             {
                                 Polylines limiting_plines = to_polylines(expand(limiting_area, 0.3*flow.spacing()));
                                 boundary_plines.insert(boundary_plines.end(), limiting_plines.begin(), limiting_plines.end());
@@ -2731,6 +2965,7 @@ void PrintObject::bridge_over_infill()
             // 如果既不需要生成桥接，也不是桥接的下一层，不处理
             if (surfaces_by_layer.find(lidx) == surfaces_by_layer.end() && surfaces_by_layer.find(lidx + 1) == surfaces_by_layer.end())
                 continue;
+            po->print()->throw_if_canceled();
             Layer *layer = po->get_layer(lidx);
 
             Polygons cut_from_infill{}; // 桥接区域
@@ -4,6 +4,7 @@
 #include "MultiMaterialSegmentation.hpp"
 #include "Print.hpp"
 #include "ClipperUtils.hpp"
+#include "TriangleMeshSlicerCache.hpp"
 #include "Interlocking/InterlockingGenerator.hpp"
 //BBS
 #include "ShortestPath.hpp"
@@ -54,14 +55,19 @@ static std::vector<ExPolygons> slice_volume(
 {
     std::vector<ExPolygons> layers;
     if (! zs.empty()) {
-        indexed_triangle_set its = volume.mesh().its;
-        if (its.indices.size() > 0) {
+        const indexed_triangle_set &mesh_its = volume.mesh().its;
+        if (mesh_its.indices.size() > 0) {
             MeshSlicingParamsEx params2 { params };
             params2.trafo = params2.trafo * volume.get_matrix();
+            // BBS: the same mesh may have been sliced already with the same parameters, by another plate or before an unrelated change.
+            if (TriangleMeshSlicerCache::instance().get(volume.get_mesh_shared_ptr(), zs, params2, layers))
+                return layers;
+            indexed_triangle_set its = mesh_its;
             if (params2.trafo.rotation().determinant() < 0.)
                 its_flip_triangles(its);
             layers = slice_mesh_ex(its, zs, params2, throw_on_cancel_callback);
             throw_on_cancel_callback();
+            TriangleMeshSlicerCache::instance().put(volume.get_mesh_shared_ptr(), zs, params2, layers);
         }
     }
     return layers;
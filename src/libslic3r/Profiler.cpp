@@ -0,0 +1,211 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include <boost/format.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+namespace Slic3r {
+namespace Profiler {
+
+namespace {
+
+struct Zone
+{
+    const char  *name;
+    int64_t      start_ns;
+    int64_t      end_ns;
+    uint32_t     depth;
+};
+
+// Zones of a single thread. The mutex is only contended while the buffers are cleared or merged.
+struct ThreadBuffer
+{
+    std::mutex          mutex;
+    size_t              thread_idx;
+    std::vector<Zone>   zones;
+};
+
+struct Registry
+{
+    std::mutex                                  mutex;
+    // Buffers are kept alive after their thread exits, so that its zones end up in the output.
+    std::vector<std::shared_ptr<ThreadBuffer>>  buffers;
+    int64_t                                     origin_ns { now_ns() };
+};
+
+Registry& registry()
+{
+    static Registry s_registry;
+    return s_registry;
+}
+
+ThreadBuffer& thread_buffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+        auto buffer = std::make_shared<ThreadBuffer>();
+        Registry &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffer->thread_idx = reg.buffers.size();
+        buffer->zones.reserve(4096);
+        reg.buffers.emplace_back(buffer);
+        return buffer;
+    }();
+    return *buffer;
+}
+
+// Copy of all zones of all threads, sorted by thread and start time.
+std::vector<std::pair<size_t, Zone>> collect_zones(int64_t &origin_ns)
+{
+    std::vector<std::pair<size_t, Zone>> out;
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    origin_ns = reg.origin_ns;
+    for (const std::shared_ptr<ThreadBuffer> &buffer : reg.buffers) {
+        std::lock_guard<std::mutex> lock_buffer(buffer->mutex);
+        for (const Zone &zone : buffer->zones)
+            out.emplace_back(buffer->thread_idx, zone);
+    }
+    std::sort(out.begin(), out.end(), [](const auto &l, const auto &r) {
+        return l.first < r.first || (l.first == r.first && (l.second.start_ns < r.second.start_ns ||
+            // The enclosing zone starts at the same time as the nested one on a coarse clock.
+            (l.second.start_ns == r.second.start_ns && l.second.depth < r.second.depth)));
+    });
+    return out;
+}
+
+std::string escape_json(const char *str)
+{
+    std::string out;
+    for (; *str != 0; ++ str) {
+        if (*str == '"' || *str == '\\')
+            out += '\\';
+        out += *str;
+    }
+    return out;
+}
+
+} // namespace
+
+int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t& thread_depth()
+{
+    thread_local uint32_t depth = 0;
+    return depth;
+}
+
+void record(const char *name, int64_t start_ns, int64_t end_ns, uint32_t depth)
+{
+    ThreadBuffer &buffer = thread_buffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.zones.push_back({ name, start_ns, end_ns, depth });
+}
+
+void clear()
+{
+    Registry &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const std::shared_ptr<ThreadBuffer> &buffer : reg.buffers) {
+        std::lock_guard<std::mutex> lock_buffer(buffer->mutex);
+        buffer->zones.clear();
+    }
+    reg.origin_ns = now_ns();
+}
+
+std::string flat_report()
+{
+    struct Stats
+    {
+        size_t  calls { 0 };
+        int64_t total_ns { 0 };
+        int64_t self_ns { 0 };
+    };
+    // Keyed by the zone name, not by the pointer, PROFILE_FUNC() of inlined functions may produce several copies.
+    std::map<std::string, Stats> stats;
+
+    int64_t origin_ns;
+    std::vector<std::pair<size_t, Zone>> zones = collect_zones(origin_ns);
+    size_t num_threads = 0;
+    // Zones are sorted by thread and start, thus the parent of a zone is the last open zone one level up.
+    std::vector<Stats*> stack;
+    size_t              thread_idx = size_t(-1);
+    for (const auto &[idx, zone] : zones) {
+        if (idx != thread_idx) {
+            thread_idx = idx;
+            stack.clear();
+            ++ num_threads;
+        }
+        Stats  &s        = stats[zone.name];
+        int64_t duration = zone.end_ns - zone.start_ns;
+        ++ s.calls;
+        s.total_ns += duration;
+        s.self_ns  += duration;
+        stack.resize(zone.depth + 1, nullptr);
+        if (zone.depth > 0 && stack[zone.depth - 1] != nullptr)
+            stack[zone.depth - 1]->self_ns -= duration;
+        stack[zone.depth] = &s;
+    }
+
+    std::vector<std::pair<std::string, Stats>> sorted(stats.begin(), stats.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto &l, const auto &r) { return l.second.self_ns > r.second.self_ns; });
+
+    std::ostringstream out;
+    out << boost::format("Profiled zones of %1% threads, total and self times are summed over the threads\n") % num_threads;
+    out << boost::format("%1$-60s %2$12s %3$14s %4$14s %5$14s\n") % "zone" % "calls" % "self [ms]" % "total [ms]" % "avg [us]";
+    for (const auto &[name, s] : sorted)
+        out << boost::format("%1$-60s %2$12d %3$14.3f %4$14.3f %5$14.3f\n") % name % s.calls %
+            (double(s.self_ns) * 1e-6) % (double(s.total_ns) * 1e-6) % (double(s.total_ns) * 1e-3 / double(s.calls));
+    return out.str();
+}
+
+bool output(const char *path)
+{
+    boost::nowide::ofstream file(path);
+    if (! file.good()) {
+        BOOST_LOG_TRIVIAL(error) << "Profiler: can not open " << path;
+        return false;
+    }
+    file << flat_report();
+    return file.good();
+}
+
+bool output_trace(const char *path)
+{
+    boost::nowide::ofstream file(path);
+    if (! file.good()) {
+        BOOST_LOG_TRIVIAL(error) << "Profiler: can not open " << path;
+        return false;
+    }
+
+    int64_t origin_ns;
+    std::vector<std::pair<size_t, Zone>> zones = collect_zones(origin_ns);
+    // Chrome trace event format, complete events ("ph":"X") with microsecond timestamps.
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool   first      = true;
+    size_t thread_idx = size_t(-1);
+    for (const auto &[idx, zone] : zones) {
+        if (idx != thread_idx) {
+            thread_idx = idx;
+            file << (first ? "" : ",\n") << boost::format("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%1%,\"args\":{\"name\":\"thread %1%\"}}") % idx;
+            first = false;
+        }
+        file << boost::format(",\n{\"ph\":\"X\",\"name\":\"%1%\",\"pid\":1,\"tid\":%2%,\"ts\":%3$.3f,\"dur\":%4$.3f}") %
+            escape_json(zone.name) % idx % (double(zone.start_ns - origin_ns) * 1e-3) % (double(zone.end_ns - zone.start_ns) * 1e-3);
+    }
+    file << "\n]}\n";
+    return file.good();
+}
+
+} // namespace Profiler
+} // namespace Slic3r
@@ -0,0 +1,73 @@
+#ifndef slic3r_Profiler_hpp_
+#define slic3r_Profiler_hpp_
+
+// Thread safe intrusive profiler, replacing the Shiny profiler inside libslic3r.
+// Every thread records its zones into its own buffer, thus the TBB pools keep running at full
+// parallelism while profiling. The buffers are merged when the results are written, either as
+// a flat text report (Shiny style) or as a Chrome trace / Perfetto json showing the occupancy
+// of the worker threads.
+//
+// Enabled with the SLIC3R_PROFILE cmake option, otherwise the PROFILE_xxx() macros are empty:
+//     PROFILE_FUNC()                  measure the enclosing function
+//     PROFILE_BLOCK(name)             measure the enclosing block, name is an identifier
+//     PROFILE_CLEAR()                 drop all recorded zones of all threads
+//     PROFILE_UPDATE()                kept for compatibility with Shiny, does nothing
+//     PROFILE_OUTPUT(path)            write the flat text report
+//     PROFILE_OUTPUT_TRACE(path)      write the Chrome trace json
+
+#include <cstdint>
+#include <string>
+
+namespace Slic3r {
+namespace Profiler {
+
+// Nanoseconds of a monotonic clock.
+int64_t     now_ns();
+// Append a finished zone to the buffer of the calling thread. The name is not copied,
+// it has to be a string literal or to outlive the next clear().
+void        record(const char *name, int64_t start_ns, int64_t end_ns, uint32_t depth);
+// Nesting level of the zones opened by the calling thread.
+uint32_t&   thread_depth();
+
+void        clear();
+// Per zone name: number of calls, total time and self time (total minus the nested zones), summed over all threads.
+std::string flat_report();
+bool        output(const char *path);
+bool        output_trace(const char *path);
+
+class ScopedZone
+{
+public:
+    explicit ScopedZone(const char *name) : m_name(name), m_depth(thread_depth() ++), m_start(now_ns()) {}
+    ~ScopedZone() { record(m_name, m_start, now_ns(), m_depth); -- thread_depth(); }
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    const char *m_name;
+    uint32_t    m_depth;
+    int64_t     m_start;
+};
+
+} // namespace Profiler
+} // namespace Slic3r
+
+#ifdef SLIC3R_PROFILE
+    #define SLIC3R_PROFILE_CONCAT_(a, b)    a##b
+    #define SLIC3R_PROFILE_CONCAT(a, b)     SLIC3R_PROFILE_CONCAT_(a, b)
+    #define PROFILE_FUNC()                  ::Slic3r::Profiler::ScopedZone SLIC3R_PROFILE_CONCAT(slic3r_profile_zone_, __LINE__)(__FUNCTION__)
+    #define PROFILE_BLOCK(name)             ::Slic3r::Profiler::ScopedZone SLIC3R_PROFILE_CONCAT(slic3r_profile_zone_, __LINE__)(#name)
+    #define PROFILE_CLEAR()                 ::Slic3r::Profiler::clear()
+    #define PROFILE_UPDATE()
+    #define PROFILE_OUTPUT(path)            ::Slic3r::Profiler::output(path)
+    #define PROFILE_OUTPUT_TRACE(path)      ::Slic3r::Profiler::output_trace(path)
+#else
+    #define PROFILE_FUNC()
+    #define PROFILE_BLOCK(name)
+    #define PROFILE_CLEAR()
+    #define PROFILE_UPDATE()
+    #define PROFILE_OUTPUT(path)
+    #define PROFILE_OUTPUT_TRACE(path)
+#endif
+
+#endif /* slic3r_Profiler_hpp_ */
@@ -443,6 +443,7 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
     int status_offset = 0;
     TriangleInfos t_infos(its.indices.size());
     VertexInfos   v_infos(its.vertices.size());
+    EdgeInfos     e_infos(its.indices.size() * 3);
     {
         std::vector<SymMat> triangle_quadrics(its.indices.size());
         // calculate normals
@@ -462,37 +463,61 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
         }); // END parallel for
         status_offset += status_normal_size;
 
-        // sum quadrics
+        // count vertex triangles
+        for (const Triangle &t : its.indices)
+            for (size_t e = 0; e < 3; e++)
+                ++v_infos[t[e]].count; // triangle count
+
+        // set offseted starts
+        uint32_t triangle_start = 0;
+        for (VertexInfo &v_info : v_infos) {
+            v_info.start = triangle_start;
+            triangle_start += v_info.count;
+            // set filled vertex to zero
+            v_info.count = 0;
+        }
+        assert(its.indices.size() * 3 == triangle_start);
+
+        status_offset += status_set_offsets;
+        throw_on_cancel();
+        status_fn(status_offset);
+
+        // create reference
         for (size_t i = 0; i < its.indices.size(); i++) {
             const Triangle &t = its.indices[i];
-            const SymMat &  q = triangle_quadrics[i];
-            for (size_t e = 0; e < 3; e++) {
-                VertexInfo &v_info = v_infos[t[e]];
-                v_info.q += q;
-                ++v_info.count; // triangle count
+            for (size_t j = 0; j < 3; ++j) {
+                VertexInfo &v_info = v_infos[t[j]];
+                size_t ei = v_info.start + v_info.count;
+                assert(ei < e_infos.size());
+                EdgeInfo &e_info = e_infos[ei];
+                e_info.t_index  = i;
+                e_info.edge      = j;
+                ++v_info.count;
             }
             if (i % 1000000 == 0) {
                 throw_on_cancel();
-                status_fn(status_offset + (i * status_sum_quadric) / its.indices.size());
+                status_fn(status_offset + (i * status_create_refs) / its.indices.size());
             }
         }
+        status_offset += status_create_refs;
+
+        // sum quadrics, per vertex over its triangles in ascending order, the same order as a serial sum over triangles
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, v_infos.size()),
+        [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t vi = range.begin(); vi < range.end(); ++vi) {
+                VertexInfo &v_info = v_infos[vi];
+                uint32_t end = v_info.start + v_info.count;
+                for (uint32_t ei = v_info.start; ei < end; ++ei)
+                    v_info.q += triangle_quadrics[e_infos[ei].t_index];
+                if (vi % 1000000 == 0) {
+                    throw_on_cancel();
+                    status_fn(status_offset + (vi * status_sum_quadric) / v_infos.size());
+                }
+            }
+        }); // END parallel for
         status_offset += status_sum_quadric;
     } // remove triangle quadrics
 
-    // set offseted starts
-    uint32_t triangle_start = 0;
-    for (VertexInfo &v_info : v_infos) {
-        v_info.start = triangle_start;
-        triangle_start += v_info.count;
-        // set filled vertex to zero
-        v_info.count = 0;
-    }
-    assert(its.indices.size() * 3 == triangle_start);
-
-    status_offset += status_set_offsets;
-    throw_on_cancel();
-    status_fn(status_offset);
-
     // calc error
     Errors errors(its.indices.size());
     tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
@@ -509,30 +534,9 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
         }
     }); // END parallel for
 
-    status_offset += status_calc_errors;
-    
-    // create reference
-    EdgeInfos e_infos(its.indices.size() * 3);
-    for (size_t i = 0; i < its.indices.size(); i++) {
-        const Triangle &t = its.indices[i];       
-        for (size_t j = 0; j < 3; ++j) {
-            VertexInfo &v_info = v_infos[t[j]];
-            size_t ei = v_info.start + v_info.count;
-            assert(ei < e_infos.size());
-            EdgeInfo &e_info = e_infos[ei];
-            e_info.t_index  = i;
-            e_info.edge      = j;
-            ++v_info.count;
-        }
-        if (i % 1000000 == 0) {
-            throw_on_cancel();
-            status_fn(status_offset + (i * status_create_refs) / its.indices.size());
-        }
-    }
-
     throw_on_cancel();
     status_fn(100);
-    return {t_infos, v_infos, e_infos, errors};
+    return {std::move(t_infos), std::move(v_infos), std::move(e_infos), std::move(errors)};
 }
 
 std::optional<uint32_t> QuadricEdgeCollapse::find_triangle_index1(uint32_t          vi,
@@ -4,6 +4,8 @@
 #include <libslic3r/AABBTreeIndirect.hpp>
 #include <libslic3r/TriangleMesh.hpp>
 
+#include <map>
+#include <mutex>
 #include <numeric>
 
 #ifdef SLIC3R_HOLE_RAYCASTER
@@ -14,23 +16,71 @@ namespace Slic3r {
 
 namespace sla {
 
+namespace {
+
+// AABB trees of meshes shared through shared_ptr<const TriangleMesh>, like the meshes of ModelVolumes.
+// Raycasters over the same volume meshes are created again whenever a gizmo opens, while a changed
+// volume gets a new mesh object. An entry is therefore valid for as long as its mesh is alive.
+struct SharedTree
+{
+    std::weak_ptr<const TriangleMesh>               mesh;
+    std::shared_ptr<const AABBTreeIndirect::Tree3f> tree;
+    double                                          average_edge_length = 0.;
+};
+
+std::mutex                                g_shared_trees_mutex;
+std::map<const TriangleMesh*, SharedTree> g_shared_trees;
+
+SharedTree shared_tree(const std::shared_ptr<const TriangleMesh> &mesh)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_shared_trees_mutex);
+        auto it = g_shared_trees.find(mesh.get());
+        // A live entry at the same address is the same mesh, an expired one was a mesh freed since.
+        if (it != g_shared_trees.end() && !it->second.mesh.expired())
+            return it->second;
+    }
+
+    SharedTree entry;
+    entry.mesh                = mesh;
+    entry.tree                = std::make_shared<const AABBTreeIndirect::Tree3f>(
+        AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(mesh->its.vertices, mesh->its.indices));
+    entry.average_edge_length = its_average_edge_length(mesh->its);
+
+    std::lock_guard<std::mutex> lock(g_shared_trees_mutex);
+    for (auto it = g_shared_trees.begin(); it != g_shared_trees.end();)
+        it = it->second.mesh.expired() ? g_shared_trees.erase(it) : std::next(it);
+    g_shared_trees[mesh.get()] = entry;
+    return entry;
+}
+
+} // namespace
+
 class IndexedMesh::AABBImpl {
 private:
-    AABBTreeIndirect::Tree3f m_tree;
-    double                   m_triangle_ray_epsilon;
+    std::shared_ptr<const AABBTreeIndirect::Tree3f> m_tree;
+    double                                          m_triangle_ray_epsilon;
+
+    void set_epsilon(bool calculate_epsilon, double average_edge_length)
+    {
+        m_triangle_ray_epsilon = 0.000001;
+        // Calculate epsilon from average triangle edge length.
+        if (calculate_epsilon && average_edge_length > 0)
+            m_triangle_ray_epsilon = 0.000001 * average_edge_length * average_edge_length;
+    }
 
 public:
     void init(const indexed_triangle_set &its, bool calculate_epsilon)
     {
-        m_triangle_ray_epsilon = 0.000001;
-        if (calculate_epsilon) {
-            // Calculate epsilon from average triangle edge length.
-            double l = its_average_edge_length(its);
-            if (l > 0)
-                m_triangle_ray_epsilon = 0.000001 * l * l;
-        }
-        m_tree = AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(
-            its.vertices, its.indices);
+        set_epsilon(calculate_epsilon, calculate_epsilon ? its_average_edge_length(its) : 0.);
+        m_tree = std::make_shared<const AABBTreeIndirect::Tree3f>(
+            AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(its.vertices, its.indices));
+    }
+
+    void init(const SharedTree &shared, bool calculate_epsilon)
+    {
+        set_epsilon(calculate_epsilon, shared.average_edge_length);
+        m_tree = shared.tree;
     }
 
     void intersect_ray(const indexed_triangle_set &its,
@@ -39,7 +89,7 @@ public:
                        igl::Hit &                  hit)
     {
         AABBTreeIndirect::intersect_ray_first_hit(its.vertices, its.indices,
-                                                  m_tree, s, dir, hit, m_triangle_ray_epsilon);
+                                                  *m_tree, s, dir, hit, m_triangle_ray_epsilon);
     }
 
     void intersect_ray(const indexed_triangle_set &its,
@@ -48,7 +98,7 @@ public:
                        std::vector<igl::Hit> &     hits)
     {
         AABBTreeIndirect::intersect_ray_all_hits(its.vertices, its.indices,
-                                                 m_tree, s, dir, hits, m_triangle_ray_epsilon);
+                                                 *m_tree, s, dir, hits, m_triangle_ray_epsilon);
     }
 
     double squared_distance(const indexed_triangle_set & its,
@@ -60,7 +110,7 @@ public:
         Vec3d  closest_vec3d(closest);
         double dist =
             AABBTreeIndirect::squared_distance_to_indexed_triangle_set(
-                its.vertices, its.indices, m_tree, point, idx_unsigned,
+                its.vertices, its.indices, *m_tree, point, idx_unsigned,
                 closest_vec3d);
         i       = int(idx_unsigned);
         closest = closest_vec3d;
@@ -89,6 +139,13 @@ IndexedMesh::IndexedMesh(const TriangleMesh &mesh, bool calculate_epsilon)
     init(mesh, calculate_epsilon);
 }
 
+IndexedMesh::IndexedMesh(const std::shared_ptr<const TriangleMesh> &mesh, bool calculate_epsilon)
+    : m_aabb(new AABBImpl()), m_tm(&mesh->its)
+{
+    m_ground_level += bounding_box(*mesh).min(Z);
+    m_aabb->init(shared_tree(mesh), calculate_epsilon);
+}
+
 IndexedMesh::~IndexedMesh() {}
 
 IndexedMesh::IndexedMesh(const IndexedMesh &other):
@@ -50,6 +50,9 @@ public:
     // If set to false, a default epsilon is used, which works for "reasonable" meshes.
     explicit IndexedMesh(const indexed_triangle_set &tmesh, bool calculate_epsilon = false);
     explicit IndexedMesh(const TriangleMesh &mesh, bool calculate_epsilon = false);
+    // The AABB tree of a mesh held through a shared pointer is cached while the mesh lives and reused
+    // by the next IndexedMesh over the same mesh, so such a mesh must not be modified in place.
+    explicit IndexedMesh(const std::shared_ptr<const TriangleMesh> &mesh, bool calculate_epsilon = false);
     
     IndexedMesh(const IndexedMesh& other);
     IndexedMesh& operator=(const IndexedMesh&);
@@ -31,8 +31,7 @@ EncodedRaster PNGRasterEncoder::operator()(const void *ptr, size_t w, size_t h,
     
     auto pptr = static_cast<std::uint8_t*>(rawdata);
     
-    buf.reserve(s);
-    std::copy(pptr, pptr + s, std::back_inserter(buf));
+    buf.assign(pptr, pptr + s);
     
     MZ_FREE(rawdata);
     return EncodedRaster(std::move(buf), "png");
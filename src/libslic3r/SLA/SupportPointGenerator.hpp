@@ -138,9 +138,12 @@ public:
     };
     
     struct PointGrid3D {
+        // std::hash<int> is the identity with the common standard libraries, xoring small multiples of
+        // the neighbouring cell indices produced long collision chains, which every collides_with() query walked.
+        // Only lookups depend on the hash, thus the generated points do not change.
         struct GridHash {
             std::size_t operator()(const Vec3i &cell_id) const {
-                return std::hash<int>()(cell_id.x()) ^ std::hash<int>()(cell_id.y() * 593) ^ std::hash<int>()(cell_id.z() * 7919);
+                return (size_t(uint32_t(cell_id.x())) * 73856093u) ^ (size_t(uint32_t(cell_id.y())) * 19349663u) ^ (size_t(uint32_t(cell_id.z())) * 83492791u);
             }
         };
         typedef std::unordered_multimap<Vec3i, RichSupportPoint, GridHash> Grid;
@@ -181,9 +184,10 @@ public:
         
     private:
         bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) {
+            const float radius2 = radius * radius;
             for (Grid::const_iterator it = it_begin; it != it_end; ++ it) {
                 float dist2 = (it->second.position - pos).squaredNorm();
-                if (dist2 < radius * radius)
+                if (dist2 < radius2)
                     return true;
             }
             return false;
@@ -686,12 +686,36 @@ bool SLAPrint::invalidate_step(SLAPrintStep step)
     return invalidated;
 }
 
+const char* step_name(SLAPrintStep step)
+{
+    switch (step) {
+    case slapsMergeSlicesAndEval:   return "merge_slices_and_eval";
+    case slapsRasterize:            return "rasterize";
+    default:                        return "unknown";
+    }
+}
+
+const char* step_name(SLAPrintObjectStep step)
+{
+    switch (step) {
+    case slaposHollowing:           return "hollowing";
+    case slaposDrillHoles:          return "drill_holes";
+    case slaposObjectSlice:         return "object_slice";
+    case slaposSupportPoints:       return "support_points";
+    case slaposSupportTree:         return "support_tree";
+    case slaposPad:                 return "pad";
+    case slaposSliceSupports:       return "slice_supports";
+    default:                        return "unknown";
+    }
+}
+
 void SLAPrint::process(std::unordered_map<std::string, long long>* slice_time, bool use_cache)
 {
     if (m_objects.empty())
         return;
 
     name_tbb_thread_pool_threads_set_locale();
+    this->slicing_profiler().clear();
 
     // Assumption: at this point the print objects should be populated only with
     // the model objects we have to process and the instances are also filtered
@@ -29,6 +29,10 @@ enum SLAPrintObjectStep : unsigned int {
 	slaposCount
 };
 
+// BBS: names of the steps as reported by the SlicingProfiler.
+const char* step_name(SLAPrintStep step);
+const char* step_name(SLAPrintObjectStep step);
+
 class SLAPrint;
 class GLCanvas;
 
@@ -345,9 +349,15 @@ private:
         sla::InteriorPtr interior;
         mutable TriangleMesh hollow_mesh_with_holes; // caching the complete hollowed mesh
         mutable TriangleMesh hollow_mesh_with_holes_trimmed;
+
+        // Inputs the interior was generated from.
+        sla::HollowingConfig config;
+        size_t               mesh_hash = 0;
     };
 
     std::unique_ptr<HollowingData> m_hollowing_data;
+    // Previously generated interior, reused if the hollowing is enabled again or set back to its parameters.
+    std::unique_ptr<HollowingData> m_hollowing_cache;
 };
 
 using PrintObjects = std::vector<SLAPrintObject*>;
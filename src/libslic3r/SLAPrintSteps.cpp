@@ -17,6 +17,7 @@
 
 #include <libslic3r/ClipperUtils.hpp>
 
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 
 #include "I18N.hpp"
@@ -117,12 +118,39 @@ void SLAPrint::Steps::apply_printer_corrections(SLAPrintObject &po, SliceOrigin
     }
 }
 
+static size_t hash_mesh(const indexed_triangle_set &its)
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, its.vertices.size());
+    for (const stl_vertex &v : its.vertices) {
+        boost::hash_combine(seed, v.x());
+        boost::hash_combine(seed, v.y());
+        boost::hash_combine(seed, v.z());
+    }
+    boost::hash_combine(seed, its.indices.size());
+    for (const stl_triangle_vertex_indices &f : its.indices) {
+        boost::hash_combine(seed, f(0));
+        boost::hash_combine(seed, f(1));
+        boost::hash_combine(seed, f(2));
+    }
+    return seed;
+}
+
 void SLAPrint::Steps::hollow_model(SLAPrintObject &po)
 {
-    po.m_hollowing_data.reset();
+    // Keep the last two interiors, generating an interior is by far the most expensive part of the hollowing.
+    // Switching the hollowing off and on or setting a parameter back then reuses the interior.
+    std::unique_ptr<SLAPrintObject::HollowingData> previous = std::move(po.m_hollowing_data);
+    if (previous && ! previous->interior)
+        previous.reset();
+    auto keep_previous = [&po, &previous]() {
+        if (previous)
+            po.m_hollowing_cache = std::move(previous);
+    };
 
     if (! po.m_config.hollowing_enable.getBool()) {
         BOOST_LOG_TRIVIAL(info) << "Skipping hollowing step!";
+        keep_previous();
         return;
     }
 
@@ -132,6 +160,23 @@ void SLAPrint::Steps::hollow_model(SLAPrintObject &po)
     double quality  = po.m_config.hollowing_quality.getFloat();
     double closing_d = po.m_config.hollowing_closing_distance.getFloat();
     sla::HollowingConfig hlwcfg{thickness, quality, closing_d};
+    size_t mesh_hash = hash_mesh(po.transformed_mesh().its);
+
+    auto matches = [&](const std::unique_ptr<SLAPrintObject::HollowingData> &data) {
+        return data && data->mesh_hash == mesh_hash && data->config.min_thickness == thickness &&
+               data->config.quality == quality && data->config.closing_distance == closing_d;
+    };
+    if (matches(previous) || matches(po.m_hollowing_cache)) {
+        BOOST_LOG_TRIVIAL(info) << "Reusing the hollowed interior!";
+        if (matches(previous))
+            po.m_hollowing_data = std::move(previous);
+        else {
+            po.m_hollowing_data = std::move(po.m_hollowing_cache);
+            keep_previous();
+        }
+        return;
+    }
+    keep_previous();
 
     sla::InteriorPtr interior = generate_interior(po.transformed_mesh(), hlwcfg);
 
@@ -140,6 +185,8 @@ void SLAPrint::Steps::hollow_model(SLAPrintObject &po)
     else {
         po.m_hollowing_data.reset(new SLAPrintObject::HollowingData());
         po.m_hollowing_data->interior = std::move(interior);
+        po.m_hollowing_data->config = hlwcfg;
+        po.m_hollowing_data->mesh_hash = mesh_hash;
     }
 }
 
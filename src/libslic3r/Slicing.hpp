@@ -19,6 +19,7 @@ class PrintConfig;
 class PrintObjectConfig;
 class ModelConfig;
 class ModelObject;
+class SlicingAdaptive;
 class DynamicPrintConfig;
 
 // Parameters to guide object slicing and support generation.
@@ -141,6 +142,12 @@ extern std::vector<double> layer_height_profile_adaptive(
     const SlicingParameters& slicing_params,
     const ModelObject& object, float quality_factor);
 
+// Variant of the above reusing the faces collected by SlicingAdaptive::prepare(),
+// so that the layer height editing may recalculate the profile for a new quality factor cheaply.
+extern std::vector<double> layer_height_profile_adaptive(
+    const SlicingParameters& slicing_params,
+    SlicingAdaptive& adaptive, float quality_factor);
+
 struct HeightProfileSmoothingParams
 {
     unsigned int radius;
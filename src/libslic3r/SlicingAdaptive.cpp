@@ -6,6 +6,8 @@
 #include <boost/log/trivial.hpp>
 #include <cfloat>
 
+#include <tbb/parallel_for.h>
+
 // Based on the work of Florens Waserfall (@platch on github)
 // and his paper
 // Florens Wasserfall, Norman Hendrich, Jianwei Zhang:
@@ -70,26 +72,61 @@ static inline float layer_height_from_slope(const SlicingAdaptive::FaceZ &face,
 void SlicingAdaptive::clear()
 {
 	m_faces.clear();
+	m_volumes.clear();
+}
+
+// Model part volumes of the object with their transformations composed with the first instance transformation.
+static std::vector<std::pair<std::shared_ptr<const TriangleMesh>, Transform3d>> adaptive_slicing_volumes(const ModelObject &object)
+{
+    std::vector<std::pair<std::shared_ptr<const TriangleMesh>, Transform3d>> out;
+    const Transform3d instance_matrix = object.instances.front()->get_matrix();
+    for (const ModelVolume *volume : object.volumes)
+        if (volume->is_model_part())
+            out.emplace_back(volume->get_mesh_shared_ptr(), instance_matrix * volume->get_matrix());
+    return out;
+}
+
+bool SlicingAdaptive::is_prepared_for(const ModelObject &object) const
+{
+    std::vector<std::pair<std::shared_ptr<const TriangleMesh>, Transform3d>> volumes = adaptive_slicing_volumes(object);
+    return volumes.size() == m_volumes.size() &&
+        std::equal(volumes.begin(), volumes.end(), m_volumes.begin(), [](const auto &v1, const auto &v2) { return v1.first == v2.first && v1.second.isApprox(v2.second, 0.); });
 }
 
 void SlicingAdaptive::prepare(const ModelObject &object)
 {
     this->clear();
 
-    TriangleMesh		 mesh			= object.raw_mesh();
-    const ModelInstance &first_instance = *object.instances.front();
-    mesh.transform(first_instance.get_matrix(), first_instance.is_left_handed());
-
-    // 1) Collect faces from mesh.
-    m_faces.reserve(mesh.facets_count());
-	for (stl_triangle_vertex_indices face : mesh.its.indices) {
-		stl_vertex vertex[3] = { mesh.its.vertices[face[0]], mesh.its.vertices[face[1]], mesh.its.vertices[face[2]] };
-		stl_vertex n         = face_normal_normalized(vertex);
-		std::pair<float, float> face_z_span {
-			std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
-			std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
-		};
-		m_faces.emplace_back(FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) }));
+    m_volumes = adaptive_slicing_volumes(object);
+    size_t num_faces = 0;
+    for (const auto &volume : m_volumes)
+        num_faces += volume.first->its.indices.size();
+
+    // 1) Collect faces from the meshes transformed to the first instance, without merging the meshes into a temporary one.
+    // Only the absolute values of the normal components are stored, thus flipping the faces of a left handed transformation is not needed.
+    m_faces.resize(num_faces);
+    std::vector<stl_vertex> vertices;
+    size_t face_offset = 0;
+    for (const auto &[mesh, trafo] : m_volumes) {
+        const indexed_triangle_set &its = mesh->its;
+        vertices.resize(its.vertices.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, its.vertices.size()), [&its, &vertices, &trafo = trafo](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                vertices[i] = (trafo * its.vertices[i].cast<double>()).cast<float>();
+        });
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()), [this, &its, &vertices, face_offset](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const stl_triangle_vertex_indices &face = its.indices[i];
+                stl_vertex vertex[3] = { vertices[face[0]], vertices[face[1]], vertices[face[2]] };
+                stl_vertex n         = face_normal_normalized(vertex);
+                std::pair<float, float> face_z_span {
+                    std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
+                    std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
+                };
+                m_faces[face_offset + i] = FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) });
+            }
+        });
+        face_offset += its.indices.size();
     }
 
 	// 2) Sort faces lexicographically by their Z span.
@@ -100,7 +137,7 @@ void SlicingAdaptive::prepare(const ModelObject &object)
 // where this function will start from.
 // print_z - the top print surface of the previous layer.
 // returns height of the next layer.
-float SlicingAdaptive::next_layer_height(const float print_z, float quality_factor, size_t &current_facet)
+float SlicingAdaptive::next_layer_height(const float print_z, float quality_factor, size_t &current_facet) const
 {
 	float  height = (float)m_slicing_params.max_layer_height;
 
@@ -196,7 +233,7 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 
 // Returns the distance to the next horizontal facet in Z-dir 
 // to consider horizontal object features in slice thickness
-float SlicingAdaptive::horizontal_facet_distance(float z)
+float SlicingAdaptive::horizontal_facet_distance(float z) const
 {
 	for (size_t i = 0; i < m_faces.size(); ++ i) {
         std::pair<float, float> zspan = m_faces[i].z_span;
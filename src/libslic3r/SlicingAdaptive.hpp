@@ -4,12 +4,17 @@
 #define slic3r_SlicingAdaptive_hpp_
 
 #include "Slicing.hpp"
+#include "Point.hpp"
 #include "admesh/stl.h"
 
+#include <memory>
+
 namespace Slic3r
 {
 
+class ModelObject;
 class ModelVolume;
+class TriangleMesh;
 
 class SlicingAdaptive
 {
@@ -17,11 +22,15 @@ public:
     void  clear();
     void  set_slicing_parameters(SlicingParameters params) { m_slicing_params = params; }
     void  prepare(const ModelObject &object);
+    // Are the faces collected by prepare() still valid for the current meshes and transformations of the object?
+    // The faces do not depend on the slicing parameters, thus the adaptive profile may be recalculated
+    // for another quality factor without calling prepare() again.
+    bool  is_prepared_for(const ModelObject &object) const;
     // Return next layer height starting from the last print_z, using a quality measure
     // (quality in range from 0 to 1, 0 - highest quality at low layer heights, 1 - lowest print quality at high layer heights).
     // The layer height curve shall be centered roughly around the default profile's layer height for quality 0.5.
-	float next_layer_height(const float print_z, float quality, size_t &current_facet);
-    float horizontal_facet_distance(float z);
+	float next_layer_height(const float print_z, float quality, size_t &current_facet) const;
+    float horizontal_facet_distance(float z) const;
 
 	struct FaceZ {
 		std::pair<float, float> z_span;
@@ -35,6 +44,9 @@ protected:
 	SlicingParameters 		m_slicing_params;
 
 	std::vector<FaceZ>		m_faces;
+
+	// Meshes and their transformations (including the first instance transformation) m_faces were collected from.
+	std::vector<std::pair<std::shared_ptr<const TriangleMesh>, Transform3d>> m_volumes;
 };
 
 }; // namespace Slic3r
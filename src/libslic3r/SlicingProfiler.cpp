@@ -0,0 +1,132 @@
+#include "SlicingProfiler.hpp"
+
+#ifdef WIN32
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/time.h>
+    #include <sys/resource.h>
+#endif
+
+#include <nlohmann/json.hpp>
+
+namespace Slic3r {
+
+double SlicingProfiler::process_cpu_time_ms()
+{
+#ifdef WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (! GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+        return 0.;
+    auto to_100ns = [](const FILETIME &ft) { return (uint64_t(ft.dwHighDateTime) << 32) | uint64_t(ft.dwLowDateTime); };
+    return double(to_100ns(kernel_time) + to_100ns(user_time)) * 1e-4;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0.;
+    auto to_ms = [](const timeval &tv) { return double(tv.tv_sec) * 1e3 + double(tv.tv_usec) * 1e-3; };
+    return to_ms(usage.ru_utime) + to_ms(usage.ru_stime);
+#endif
+}
+
+size_t SlicingProfiler::peak_memory_usage()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return size_t(pmc.PeakWorkingSetSize);
+    return 0;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    #ifdef __APPLE__
+    return size_t(usage.ru_maxrss);
+    #else
+    // getrusage returns the value in kB on linux
+    return size_t(usage.ru_maxrss) * 1024;
+    #endif
+#endif
+}
+
+void SlicingProfiler::step_started(const char *step, ObjectID object_id)
+{
+    Running running { std::chrono::steady_clock::now(), process_cpu_time_ms(), peak_memory_usage(), AllocationTracker::stats() };
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running[Key(step, object_id.id)] = running;
+}
+
+SlicingProfiler::StepRecord SlicingProfiler::step_finished(const char *step, ObjectID object_id, const std::string &object_name)
+{
+    auto   wall_end = std::chrono::steady_clock::now();
+    double cpu_end  = process_cpu_time_ms();
+    size_t peak_end = peak_memory_usage();
+    AllocationTracker::Stats allocations_end = AllocationTracker::stats();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Key  key(step, object_id.id);
+    auto it_running = m_running.find(key);
+    if (it_running == m_running.end())
+        return StepRecord();
+
+    auto it_index = m_record_index.find(key);
+    if (it_index == m_record_index.end()) {
+        it_index = m_record_index.emplace(key, m_records.size()).first;
+        m_records.emplace_back();
+        StepRecord &record = m_records.back();
+        record.step        = step;
+        record.object_id   = object_id;
+        record.object_name = object_name;
+    }
+    StepRecord    &record  = m_records[it_index->second];
+    const Running &running = it_running->second;
+    record.wall_time_ms   += std::chrono::duration<double, std::milli>(wall_end - running.wall_start).count();
+    record.cpu_time_ms    += cpu_end - running.cpu_start;
+    record.peak_rss_delta += int64_t(peak_end) - int64_t(running.peak_rss_start);
+    record.allocated_bytes       += allocations_end.allocated_bytes - running.allocations_start.allocated_bytes;
+    record.allocations           += allocations_end.allocations - running.allocations_start.allocations;
+    record.peak_live_bytes_delta += allocations_end.peak_live_bytes - running.allocations_start.peak_live_bytes;
+    ++ record.count;
+    m_running.erase(it_running);
+    return record;
+}
+
+void SlicingProfiler::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running.clear();
+    m_record_index.clear();
+    m_records.clear();
+}
+
+std::vector<SlicingProfiler::StepRecord> SlicingProfiler::records() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records;
+}
+
+nlohmann::json SlicingProfiler::to_json() const
+{
+    nlohmann::json out = nlohmann::json::array();
+    for (const StepRecord &record : this->records()) {
+        nlohmann::json record_json;
+        record_json["step"]           = record.step;
+        if (record.object_id.valid()) {
+            record_json["object_id"]   = record.object_id.id;
+            record_json["object_name"] = record.object_name;
+        }
+        record_json["wall_time_ms"]   = record.wall_time_ms;
+        record_json["cpu_time_ms"]    = record.cpu_time_ms;
+        record_json["peak_rss_delta"] = record.peak_rss_delta;
+        record_json["count"]          = record.count;
+        if (AllocationTracker::enabled()) {
+            record_json["allocated_bytes"]       = record.allocated_bytes;
+            record_json["allocations"]           = record.allocations;
+            record_json["peak_live_bytes_delta"] = record.peak_live_bytes_delta;
+        }
+        out.push_back(std::move(record_json));
+    }
+    return out;
+}
+
+} // namespace Slic3r
@@ -0,0 +1,105 @@
+#ifndef slic3r_SlicingProfiler_hpp_
+#define slic3r_SlicingProfiler_hpp_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include "AllocationTracker.hpp"
+#include "ObjectID.hpp"
+
+namespace Slic3r {
+
+// BBS: always compiled, lightweight profiler of the Print / PrintObject steps.
+// PrintBaseWithState / PrintObjectBaseWithState feed it from set_started() / set_done(), finer grained stages
+// are measured by SlicingProfiler::Scope. For every step and object it accumulates the wall time, the CPU time
+// of the whole process and the growth of the process peak resident memory. If compiled with SLIC3R_ALLOCATION_TRACKING,
+// the heap allocations of the whole process and the growth of the peak live heap bytes are recorded as well.
+// Steps running in parallel (for example the support generation of several objects) overlap, thus their CPU
+// times and memory deltas are not additive.
+class SlicingProfiler
+{
+public:
+    struct StepRecord
+    {
+        std::string step;
+        // Invalid for Print steps.
+        ObjectID    object_id;
+        std::string object_name;
+        double      wall_time_ms { 0. };
+        double      cpu_time_ms { 0. };
+        // Growth of the process peak resident set size while the step was running, in bytes.
+        int64_t     peak_rss_delta { 0 };
+        // Only filled in if AllocationTracker::enabled().
+        uint64_t    allocated_bytes { 0 };
+        uint64_t    allocations { 0 };
+        // Growth of the peak of the live heap bytes while the step was running.
+        int64_t     peak_live_bytes_delta { 0 };
+        // Number of times the step was finished since the last clear().
+        int         count { 0 };
+    };
+
+    // Measures the lifetime of a scope, the measured stage is accumulated the same way as a step.
+    class Scope
+    {
+    public:
+        Scope(SlicingProfiler &profiler, const char *step, ObjectID object_id = ObjectID(), const std::string &object_name = std::string())
+            : m_profiler(profiler), m_step(step), m_object_id(object_id), m_object_name(object_name)
+            { m_profiler.step_started(m_step, m_object_id); }
+        ~Scope() { m_profiler.step_finished(m_step, m_object_id, m_object_name); }
+        Scope(const Scope &) = delete;
+        Scope& operator=(const Scope &) = delete;
+
+    private:
+        SlicingProfiler    &m_profiler;
+        const char         *m_step;
+        ObjectID            m_object_id;
+        std::string         m_object_name;
+    };
+
+    void                    step_started(const char *step, ObjectID object_id = ObjectID());
+    // Returns the accumulated record of the step, an empty record if step_started() was not called before.
+    StepRecord              step_finished(const char *step, ObjectID object_id = ObjectID(), const std::string &object_name = std::string());
+    void                    clear();
+
+    // Records in the order the steps were finished for the first time.
+    std::vector<StepRecord> records() const;
+    // Array of {"step", "object_id", "object_name", "wall_time_ms", "cpu_time_ms", "peak_rss_delta", "count"},
+    // with "allocated_bytes", "allocations" and "peak_live_bytes_delta" added if AllocationTracker::enabled().
+    nlohmann::json          to_json() const;
+
+    // Emit a SlicingStatus with the UPDATE_SLICING_PROFILE flag whenever a step finishes.
+    bool                    report_status() const { return m_report_status; }
+    void                    set_report_status(bool report) { m_report_status = report; }
+
+    // Process wide CPU time (user + system) of all threads in milliseconds.
+    static double           process_cpu_time_ms();
+    // Peak resident set size of the process in bytes, 0 if not available.
+    static size_t           peak_memory_usage();
+
+private:
+    using Key = std::pair<std::string, size_t>;
+    struct Running
+    {
+        std::chrono::steady_clock::time_point   wall_start;
+        double                                  cpu_start;
+        size_t                                  peak_rss_start;
+        AllocationTracker::Stats                allocations_start;
+    };
+
+    mutable std::mutex          m_mutex;
+    std::map<Key, Running>      m_running;
+    std::map<Key, size_t>       m_record_index;
+    std::vector<StepRecord>     m_records;
+    bool                        m_report_status { false };
+};
+
+} // namespace Slic3r
+
+#endif /* slic3r_SlicingProfiler_hpp_ */
@@ -18,6 +18,7 @@
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
 
 #include "SupportCommon.hpp"
 #include "SupportLayer.hpp"
@@ -1556,11 +1557,13 @@ void generate_support_toolpaths(
         size_t idx_layer_interface        = size_t(-1);
         size_t idx_layer_base_interface   = size_t(-1);
         const auto fill_type_first_layer  = ipRectilinear;
+        // The regions of a single layer are filled concurrently, thus each of them needs its own filler.
         auto filler_interface       = std::unique_ptr<Fill>(Fill::new_from_type(support_params.contact_fill_pattern));
-        // Filler for the 1st layer interface, if different from filler_interface.
-        auto filler_first_layer_ptr = std::unique_ptr<Fill>(range.begin() == 0 && support_params.contact_fill_pattern != fill_type_first_layer ? Fill::new_from_type(fill_type_first_layer) : nullptr);
-        // Pointer to the 1st layer interface filler.
-        auto filler_first_layer     = filler_first_layer_ptr ? filler_first_layer_ptr.get() : filler_interface.get();
+        auto filler_bottom_contact  = std::unique_ptr<Fill>(Fill::new_from_type(support_params.contact_fill_pattern));
+        auto filler_interface_layer = std::unique_ptr<Fill>(Fill::new_from_type(support_params.contact_fill_pattern));
+        // Filler for the 1st layer base flange. Outside of the range starting at layer 0 it falls back to the interface pattern,
+        // as a copy of its own, because the interface filler is used by another task of the same layer.
+        auto filler_first_layer_ptr = std::unique_ptr<Fill>(Fill::new_from_type(range.begin() == 0 ? fill_type_first_layer : support_params.contact_fill_pattern));
         // Filler for the 1st layer interface, if different from filler_interface.
         auto filler_raft_contact_ptr = std::unique_ptr<Fill>(range.begin() == n_raft_layers && config.support_interface_top_layers.value == 0 ?
             Fill::new_from_type(support_params.raft_interface_fill_pattern) : nullptr);
@@ -1570,9 +1573,12 @@ void generate_support_toolpaths(
         auto filler_base_interface  = std::unique_ptr<Fill>(base_interface_layers.empty() ? nullptr :
             Fill::new_from_type(support_params.interface_density > 0.95 || support_params.with_sheath ? ipRectilinear : ipSupportBase));
         auto filler_support         = std::unique_ptr<Fill>(Fill::new_from_type(support_params.base_fill_pattern));
+        // Pointer to the 1st layer filler.
+        auto filler_first_layer     = filler_first_layer_ptr.get();
         filler_interface->set_bounding_box(bbox_object);
-        if (filler_first_layer_ptr)
-            filler_first_layer_ptr->set_bounding_box(bbox_object);
+        filler_bottom_contact->set_bounding_box(bbox_object);
+        filler_interface_layer->set_bounding_box(bbox_object);
+        filler_first_layer_ptr->set_bounding_box(bbox_object);
         if (filler_raft_contact_ptr)
             filler_raft_contact_ptr->set_bounding_box(bbox_object);
         if (filler_base_interface)
@@ -1653,13 +1659,13 @@ void generate_support_toolpaths(
 
             // Top and bottom contacts, interface layers.
             enum class InterfaceLayerType { TopContact, BottomContact, RaftContact, Interface, InterfaceAsBase };
-            auto extrude_interface = [&](SupportGeneratorLayerExtruded &layer_ex, InterfaceLayerType interface_layer_type) {
+            auto extrude_interface = [&](SupportGeneratorLayerExtruded &layer_ex, InterfaceLayerType interface_layer_type, Fill *layer_filler) {
                 if (! layer_ex.empty() && ! layer_ex.polygons_to_extrude().empty()) {
                     bool interface_as_base = interface_layer_type == InterfaceLayerType::InterfaceAsBase;
                     bool raft_contact      = interface_layer_type == InterfaceLayerType::RaftContact;
                     //FIXME Bottom interfaces are extruded with the briding flow. Some bridging layers have its height slightly reduced, therefore
                     // the bridging flow does not quite apply. Reduce the flow to area of an ellipse? (A = pi * a * b)
-                    auto *filler = raft_contact ? filler_raft_contact : filler_interface.get();
+                    auto *filler = raft_contact ? filler_raft_contact : layer_filler;
                     auto interface_flow = layer_ex.layer->bridging ?
                         Flow::bridging_flow(layer_ex.layer->height, support_params.support_material_bottom_interface_flow.nozzle_diameter()) :
                         (raft_contact ? &support_params.raft_interface_flow :
@@ -1686,79 +1692,93 @@ void generate_support_toolpaths(
             };
             const bool top_interfaces = config.support_interface_top_layers.value != 0;
             const bool bottom_interfaces = top_interfaces && config.support_interface_bottom_layers != 0;
-            extrude_interface(top_contact_layer,    raft_layer ? InterfaceLayerType::RaftContact : top_interfaces ? InterfaceLayerType::TopContact : InterfaceLayerType::InterfaceAsBase);
-            extrude_interface(bottom_contact_layer, bottom_interfaces ? InterfaceLayerType::BottomContact : InterfaceLayerType::InterfaceAsBase);
-            extrude_interface(interface_layer,      top_interfaces ? InterfaceLayerType::Interface : InterfaceLayerType::InterfaceAsBase);
+            // The regions of this layer write to their own extrusion collections, fill them concurrently
+            // so that a single heavy layer does not hold up the end of the parallel loop over layers.
+            tbb::task_group task_group;
+            task_group.run([&]() {
+                extrude_interface(top_contact_layer, raft_layer ? InterfaceLayerType::RaftContact : top_interfaces ? InterfaceLayerType::TopContact : InterfaceLayerType::InterfaceAsBase,
+                    filler_interface.get());
+            });
+            task_group.run([&]() {
+                extrude_interface(bottom_contact_layer, bottom_interfaces ? InterfaceLayerType::BottomContact : InterfaceLayerType::InterfaceAsBase, filler_bottom_contact.get());
+            });
+            task_group.run([&]() {
+                extrude_interface(interface_layer, top_interfaces ? InterfaceLayerType::Interface : InterfaceLayerType::InterfaceAsBase, filler_interface_layer.get());
+            });
 
             // Base interface layers under soluble interfaces
-            if ( ! base_interface_layer.empty() && ! base_interface_layer.polygons_to_extrude().empty()) {
-                Fill *filler = filler_base_interface.get();
-                //FIXME Bottom interfaces are extruded with the briding flow. Some bridging layers have its height slightly reduced, therefore
-                // the bridging flow does not quite apply. Reduce the flow to area of an ellipse? (A = pi * a * b)
-                assert(! base_interface_layer.layer->bridging);
-                Flow interface_flow = support_params.support_material_flow.with_height(float(base_interface_layer.layer->height));
-                filler->angle   = interface_angles[(support_layer_id + 1) % interface_angles.size()]; // need to be the same as the interface layer above
-                filler->spacing = support_params.support_material_interface_flow.spacing();
-                filler->link_max_length = coord_t(scale_(filler->spacing * link_max_length_factor / support_params.interface_density));
-                fill_expolygons_generate_paths(
-                    // Destination
-                    base_interface_layer.extrusions,
-                    //base_layer_interface.extrusions,
-                    // Regions to fill
-                    union_safety_offset_ex(base_interface_layer.polygons_to_extrude()),
-                    // Filler and its parameters
-                    filler, float(support_params.interface_density),
-                    // Extrusion parameters
-                    ExtrusionRole::erSupportMaterial, interface_flow);
-            }
-
-            // Base support or flange.
-            if (! base_layer.empty() && ! base_layer.polygons_to_extrude().empty()) {
-                Fill             *filler          = filler_support.get();
-                filler->angle = angles[support_layer_id % angles.size()];
-                // We don't use $base_flow->spacing because we need a constant spacing
-                // value that guarantees that all layers are correctly aligned.
-                assert(! base_layer.layer->bridging);
-                auto flow = support_params.support_material_flow.with_height(float(base_layer.layer->height));
-                filler->spacing = support_params.support_material_flow.spacing();
-                filler->link_max_length = coord_t(scale_(filler->spacing * link_max_length_factor / support_params.support_density));
-                float density = float(support_params.support_density);
-                bool  sheath  = support_params.with_sheath;
-                bool  no_sort = false;
-                bool  done    = false;
-                if (base_layer.layer->bottom_z < EPSILON) {
-                    // Base flange (the 1st layer).
-                    filler = filler_first_layer;
-                    filler->angle = Geometry::deg2rad(float(config.support_angle.value + 90.));
-                    density = float(config.raft_first_layer_density.value * 0.01);
-                    flow = support_params.first_layer_flow;
-                    // use the proper spacing for first layer as we don't need to align
-                    // its pattern to the other layers
-                    //FIXME When paralellizing, each thread shall have its own copy of the fillers.
-                    filler->spacing = flow.spacing();
-                    filler->link_max_length = coord_t(scale_(filler->spacing * link_max_length_factor / density));
-                    sheath  = true;
-                    no_sort = true;
-                } else if (support_params.support_style == SupportMaterialStyle::smsTreeOrganic) {
-                    // if the tree supports are too tall, use double wall to make it stronger
-                    SupportParameters support_params2 = support_params;
-                    if (support_layer.print_z > 100.0)
-                        support_params2.tree_branch_diameter_double_wall_area_scaled = 0.1;
-                    tree_supports_generate_paths(base_layer.extrusions, base_layer.polygons_to_extrude(), flow, support_params2);
-                    done = true;
-                }
-                if (! done)
-                    fill_expolygons_with_sheath_generate_paths(
+            task_group.run([&]() {
+                if ( ! base_interface_layer.empty() && ! base_interface_layer.polygons_to_extrude().empty()) {
+                    Fill *filler = filler_base_interface.get();
+                    //FIXME Bottom interfaces are extruded with the briding flow. Some bridging layers have its height slightly reduced, therefore
+                    // the bridging flow does not quite apply. Reduce the flow to area of an ellipse? (A = pi * a * b)
+                    assert(! base_interface_layer.layer->bridging);
+                    Flow interface_flow = support_params.support_material_flow.with_height(float(base_interface_layer.layer->height));
+                    filler->angle   = interface_angles[(support_layer_id + 1) % interface_angles.size()]; // need to be the same as the interface layer above
+                    filler->spacing = support_params.support_material_interface_flow.spacing();
+                    filler->link_max_length = coord_t(scale_(filler->spacing * link_max_length_factor / support_params.interface_density));
+                    fill_expolygons_generate_paths(
                         // Destination
-                        base_layer.extrusions,
+                        base_interface_layer.extrusions,
+                        //base_layer_interface.extrusions,
                         // Regions to fill
-                        base_layer.polygons_to_extrude(),
+                        union_safety_offset_ex(base_interface_layer.polygons_to_extrude()),
                         // Filler and its parameters
-                        filler, density,
+                        filler, float(support_params.interface_density),
                         // Extrusion parameters
-                        ExtrusionRole::erSupportMaterial, flow,
-                        support_params, sheath, no_sort);
-            }
+                        ExtrusionRole::erSupportMaterial, interface_flow);
+                }
+            });
+
+            // Base support or flange.
+            task_group.run([&]() {
+                if (! base_layer.empty() && ! base_layer.polygons_to_extrude().empty()) {
+                    Fill             *filler          = filler_support.get();
+                    filler->angle = angles[support_layer_id % angles.size()];
+                    // We don't use $base_flow->spacing because we need a constant spacing
+                    // value that guarantees that all layers are correctly aligned.
+                    assert(! base_layer.layer->bridging);
+                    auto flow = support_params.support_material_flow.with_height(float(base_layer.layer->height));
+                    filler->spacing = support_params.support_material_flow.spacing();
+                    filler->link_max_length = coord_t(scale_(filler->spacing * link_max_length_factor / support_params.support_density));
+                    float density = float(support_params.support_density);
+                    bool  sheath  = support_params.with_sheath;
+                    bool  no_sort = false;
+                    bool  done    = false;
+                    if (base_layer.layer->bottom_z < EPSILON) {
+                        // Base flange (the 1st layer).
+                        filler = filler_first_layer;
+                        filler->angle = Geometry::deg2rad(float(config.support_angle.value + 90.));
+                        density = float(config.raft_first_layer_density.value * 0.01);
+                        flow = support_params.first_layer_flow;
+                        // use the proper spacing for first layer as we don't need to align
+                        // its pattern to the other layers
+                        filler->spacing = flow.spacing();
+                        filler->link_max_length = coord_t(scale_(filler->spacing * link_max_length_factor / density));
+                        sheath  = true;
+                        no_sort = true;
+                    } else if (support_params.support_style == SupportMaterialStyle::smsTreeOrganic) {
+                        // if the tree supports are too tall, use double wall to make it stronger
+                        SupportParameters support_params2 = support_params;
+                        if (support_layer.print_z > 100.0)
+                            support_params2.tree_branch_diameter_double_wall_area_scaled = 0.1;
+                        tree_supports_generate_paths(base_layer.extrusions, base_layer.polygons_to_extrude(), flow, support_params2);
+                        done = true;
+                    }
+                    if (! done)
+                        fill_expolygons_with_sheath_generate_paths(
+                            // Destination
+                            base_layer.extrusions,
+                            // Regions to fill
+                            base_layer.polygons_to_extrude(),
+                            // Filler and its parameters
+                            filler, density,
+                            // Extrusion parameters
+                            ExtrusionRole::erSupportMaterial, flow,
+                            support_params, sheath, no_sort);
+                }
+            });
+            task_group.wait();
 
             // Merge base_interface_layers to base_layers to avoid unneccessary retractions
             if (! base_layer.empty() && ! base_interface_layer.empty() && ! base_layer.polygons_to_extrude().empty() && ! base_interface_layer.polygons_to_extrude().empty() &&
@@ -2606,6 +2606,40 @@ SupportGeneratorLayersPtr PrintObjectSupportMaterial::bottom_contact_layers_and_
     // Sum of unsupported enforcer contact areas above the current layer.print_z.
     // Only used if "supports on build plate only" is enabled and both automatic and support enforcers are enabled.
     Polygons  enforcers_projection;
+    // Merge the contact areas of each top contact layer up front, in parallel. The sweep below only depends on these merged
+    // projections, not on the order they are computed in, thus it only has to append the ones it reaches.
+    // Only the contact layers the sweep reaches are consumed, as the sweep ends at the first object layer.
+    std::vector<Polygons> contact_projections(top_contacts.size());
+    std::vector<Polygons> enforcer_projections(top_contacts.size());
+    const coordf_t        min_projected_print_z = object.total_layer_count() < 2 ? std::numeric_limits<coordf_t>::max() : object.get_layer(0)->print_z - EPSILON;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, top_contacts.size()),
+        [&top_contacts, &contact_projections, &enforcer_projections, min_projected_print_z](const tbb::blocked_range<size_t>& range) {
+            for (size_t contact_idx = range.begin(); contact_idx < range.end(); ++ contact_idx) {
+                SupportGeneratorLayer &top_contact = *top_contacts[contact_idx];
+                if (top_contact.print_z <= min_projected_print_z)
+                    continue;
+                Polygons polygons_new;
+                // Contact surfaces are expanded away from the object, trimmed by the object.
+                // Use a slight positive offset to overlap the touching regions.
+#if 0
+                // Merge and collect the contact polygons. The contact polygons are inflated, but not extended into a grid form.
+                polygons_append(polygons_new, offset(*top_contact.contact_polygons, SCALED_EPSILON));
+                if (top_contact.enforcer_polygons)
+                    polygons_append(enforcer_projections[contact_idx], offset(*top_contact.enforcer_polygons, SCALED_EPSILON));
+#else
+                // Consume the contact_polygons. The contact polygons are already expanded into a grid form, and they are a tiny bit smaller
+                // than the grid cells.
+                polygons_append(polygons_new, std::move(*top_contact.contact_polygons));
+                if (top_contact.enforcer_polygons)
+                    polygons_append(enforcer_projections[contact_idx], std::move(*top_contact.enforcer_polygons));
+#endif
+                // These are the overhang surfaces. They are touching the object and they are not expanded away from the object.
+                // Use a slight positive offset to overlap the touching regions.
+                polygons_append(polygons_new, expand(*top_contact.overhang_polygons, float(SCALED_EPSILON)));
+                contact_projections[contact_idx] = union_(polygons_new);
+            }
+        });
+
     // Last top contact layer visited when collecting the projection of contact areas.
     int       contact_idx = int(top_contacts.size()) - 1;
     for (int layer_id = int(object.total_layer_count()) - 2; layer_id >= 0; -- layer_id) {
@@ -2614,33 +2648,13 @@ SupportGeneratorLayersPtr PrintObjectSupportMaterial::bottom_contact_layers_and_
         // Collect projections of all contact areas above or at the same level as this top surface.
 #ifdef SLIC3R_DEBUG
         Polygons polygons_new;
-        Polygons enforcers_new;
 #endif // SLIC3R_DEBUG
         for (; contact_idx >= 0 && top_contacts[contact_idx]->print_z > layer.print_z - EPSILON; -- contact_idx) {
-            SupportGeneratorLayer &top_contact = *top_contacts[contact_idx];
-#ifndef SLIC3R_DEBUG
-            Polygons polygons_new;
-            Polygons enforcers_new;
+#ifdef SLIC3R_DEBUG
+            polygons_append(polygons_new, contact_projections[contact_idx]);
 #endif // SLIC3R_DEBUG
-            // Contact surfaces are expanded away from the object, trimmed by the object.
-            // Use a slight positive offset to overlap the touching regions.
-#if 0
-            // Merge and collect the contact polygons. The contact polygons are inflated, but not extended into a grid form.
-            polygons_append(polygons_new,  offset(*top_contact.contact_polygons,  SCALED_EPSILON));
-            if (top_contact.enforcer_polygons)
-                polygons_append(enforcers_new, offset(*top_contact.enforcer_polygons, SCALED_EPSILON));
-#else
-            // Consume the contact_polygons. The contact polygons are already expanded into a grid form, and they are a tiny bit smaller
-            // than the grid cells.
-            polygons_append(polygons_new,  std::move(*top_contact.contact_polygons));
-            if (top_contact.enforcer_polygons)
-                polygons_append(enforcers_new, std::move(*top_contact.enforcer_polygons));
-#endif
-            // These are the overhang surfaces. They are touching the object and they are not expanded away from the object.
-            // Use a slight positive offset to overlap the touching regions.
-            polygons_append(polygons_new, expand(*top_contact.overhang_polygons, float(SCALED_EPSILON)));
-            polygons_append(overhangs_projection, union_(polygons_new));
-            polygons_append(enforcers_projection, enforcers_new);
+            polygons_append(overhangs_projection, std::move(contact_projections[contact_idx]));
+            polygons_append(enforcers_projection, std::move(enforcer_projections[contact_idx]));
         }
         if (overhangs_projection.empty() && enforcers_projection.empty())
             continue;
@@ -21,6 +21,7 @@
 
 #include <string_view>
 
+#include <boost/container_hash/hash.hpp>
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
@@ -51,6 +52,14 @@ static Polygons calculateMachineBorderCollision(Polygon machine_border)
 #endif
 }
 
+static void hash_polygons(size_t &seed, const Polygons &polygons)
+{
+    std::hash<std::string_view> hash;
+    boost::hash_combine(seed, polygons.size());
+    for (const Polygon &polygon : polygons)
+        boost::hash_combine(seed, hash(std::string_view(reinterpret_cast<const char*>(polygon.points.data()), polygon.points.size() * sizeof(Point))));
+}
+
 TreeModelVolumes::TreeModelVolumes(
     const PrintObject &print_object,
     const BuildVolume &build_volume,
@@ -123,6 +132,34 @@ TreeModelVolumes::TreeModelVolumes(
         m_min_resolution = std::min(m_min_resolution, data_pair.first.resolution);
     }
 
+    if (TreeModelVolumesCache::instance().capacity() > 0) {
+        // Keep everything the collisions and placeable areas are calculated from.
+        auto key = std::make_shared<TreeModelVolumesCacheKey::Collision>();
+        key->parameters = { coord_t(m_current_outline_idx), m_current_min_xy_dist, m_current_min_xy_dist_delta, m_min_resolution, coord_t(m_support_rests_on_model) };
+        key->layer_outlines.reserve(m_layer_outlines.size());
+        for (const auto &[settings, outlines] : m_layer_outlines) {
+            key->parameters.insert(key->parameters.end(), { settings.layer_height, settings.resolution, settings.support_xy_distance, settings.support_top_distance, settings.support_bottom_distance });
+            key->layer_outlines.emplace_back(outlines);
+        }
+        key->anti_overhang  = m_anti_overhang;
+        key->machine_border = m_machine_border;
+        key->raft_layers    = m_raft_layers;
+        size_t seed = key->layer_outlines.size();
+        boost::hash_range(seed, key->parameters.begin(), key->parameters.end());
+        for (const std::vector<Polygons> &outlines : key->layer_outlines) {
+            boost::hash_combine(seed, outlines.size());
+            for (const Polygons &layer : outlines)
+                hash_polygons(seed, layer);
+        }
+        boost::hash_combine(seed, m_anti_overhang.size());
+        for (const Polygons &layer : m_anti_overhang)
+            hash_polygons(seed, layer);
+        hash_polygons(seed, m_machine_border);
+        boost::hash_range(seed, m_raft_layers.begin(), m_raft_layers.end());
+        key->hash = seed;
+        m_collision_key = std::move(key);
+    }
+
 
 #if 0
     for (size_t mesh_idx = 0; mesh_idx < storage.meshes.size(); mesh_idx++) {
@@ -181,6 +218,20 @@ void TreeModelVolumes::precalculate(const PrintObject& print_object, const coord
                 m_ignorable_radii.emplace_back(radius_eval);
     }
 
+    if (m_collision_key) {
+        // The avoidances additionally depend on the branch movement and on the radii the collisions are rounded up to.
+        m_avoidance_key = { m_max_move, m_max_move_slow, m_increase_until_radius, m_radius_0 };
+        append(m_avoidance_key, m_ignorable_radii);
+        // Continue the calculation of the same slices and settings of a previous support generation.
+        TreeModelVolumesCache &cache = TreeModelVolumesCache::instance();
+        bool collisions_cached = cache.take(m_collision_key, {}, { &m_collision_cache, &m_placeable_areas_cache });
+        bool avoidances_cached = cache.take(m_collision_key, m_avoidance_key, { &m_collision_cache_holefree,
+            &m_avoidance_cache, &m_avoidance_cache_slow, &m_avoidance_cache_to_model, &m_avoidance_cache_to_model_slow,
+            &m_avoidance_cache_holefree, &m_avoidance_cache_holefree_to_model, &m_wall_restrictions_cache, &m_wall_restrictions_cache_min });
+        if (collisions_cached || avoidances_cached)
+            BOOST_LOG_TRIVIAL(debug) << "Tree support volumes reused from cache: collisions " << collisions_cached << ", avoidances " << avoidances_cached;
+    }
+
     if (throw_on_cancel)
         throw_on_cancel();
 
@@ -421,8 +472,12 @@ void TreeModelVolumes::calculateCollision(const coord_t radius, const LayerIndex
     std::sort(layer_outline_indices.begin(), layer_outline_indices.end(),
         [this](size_t i, size_t j) { return m_layer_outlines[i].second.size() < m_layer_outlines[j].second.size(); });
 
+    // The collisions may have already been calculated up to max_layer_idx by a previous support generation, see TreeModelVolumesCache.
+    const LayerIndex            first_layer_idx = m_collision_cache.getMaxCalculatedLayer(radius) + 1;
+    if (first_layer_idx > max_layer_idx)
+        return;
     LayerPolygonCache           data;
-    data.allocate(m_collision_cache.getMaxCalculatedLayer(radius) + 1, max_layer_idx + 1);
+    data.allocate(first_layer_idx, max_layer_idx + 1);
 
     const bool                  calculate_placable = m_support_rests_on_model && radius == 0;
     LayerPolygonCache           data_placeable;
@@ -588,7 +643,7 @@ void TreeModelVolumes::calculateCollisionHolefree(const std::vector<RadiusLayerP
         data.reserve(range.size() * keys.size());
         for (LayerIndex layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
             for (RadiusLayerPair key : keys)
-                if (layer_idx <= key.second) {
+                if (layer_idx <= key.second && ! m_collision_cache_holefree.getArea({ key.first, layer_idx })) {
                     // Logically increase the collision by m_increase_until_radius
                     coord_t radius = key.first;
                     assert(radius == this->ceilRadius(radius));
@@ -800,6 +855,9 @@ void TreeModelVolumes::calculateWallRestrictions(const std::vector<RadiusLayerPa
             const coord_t    radius             = keys[key_idx].first;
             const LayerIndex max_required_layer = keys[key_idx].second;
             const coord_t    min_layer_bottom   = std::max(1, m_wall_restrictions_cache.getMaxCalculatedLayer(radius));
+            if (min_layer_bottom > max_required_layer)
+                // Already calculated by a previous support generation, see TreeModelVolumesCache.
+                continue;
             const size_t     buffer_size        = max_required_layer + 1 - min_layer_bottom;
             std::vector<Polygons> data(buffer_size, Polygons{});
             std::vector<Polygons> data_min;
@@ -828,6 +886,31 @@ void TreeModelVolumes::calculateWallRestrictions(const std::vector<RadiusLayerPa
     });
 }
 
+void TreeModelVolumes::move_to_cache()
+{
+    this->move_to_cache_all_but_object_collision();
+    if (! m_avoidance_key.empty())
+        TreeModelVolumesCache::instance().put(m_collision_key, {}, { &m_collision_cache, &m_placeable_areas_cache });
+    this->clear();
+}
+
+void TreeModelVolumes::move_to_cache_all_but_object_collision()
+{
+    if (! m_avoidance_key.empty())
+        TreeModelVolumesCache::instance().put(m_collision_key, m_avoidance_key, { &m_collision_cache_holefree,
+            &m_avoidance_cache, &m_avoidance_cache_slow, &m_avoidance_cache_to_model, &m_avoidance_cache_to_model_slow,
+            &m_avoidance_cache_holefree, &m_avoidance_cache_holefree_to_model, &m_wall_restrictions_cache, &m_wall_restrictions_cache_min });
+    m_collision_cache_holefree.clear();
+    m_avoidance_cache.clear();
+    m_avoidance_cache_slow.clear();
+    m_avoidance_cache_to_model.clear();
+    m_avoidance_cache_to_model_slow.clear();
+    m_avoidance_cache_holefree.clear();
+    m_avoidance_cache_holefree_to_model.clear();
+    m_wall_restrictions_cache.clear();
+    m_wall_restrictions_cache_min.clear();
+}
+
 coord_t TreeModelVolumes::ceilRadius(const coord_t radius) const
 {
     if (radius == 0)
@@ -859,24 +942,111 @@ coord_t TreeModelVolumes::ceilRadius(const coord_t radius) const
 
 void TreeModelVolumes::RadiusLayerPolygonCache::allocate_layers(size_t num_layers)
 {
-    if (num_layers > m_data.size()) {
-        if (num_layers > m_data.capacity())
-            m_data.reserve(next_highest_power_of_2(num_layers));
-        m_data.resize(num_layers, {});
+    if (num_layers > this->num_layers()) {
+        // Called with m_mutex locked. The elements of a concurrent_vector stay in place, thus concurrent readers are not affected.
+        m_data.grow_to_at_least(num_layers);
+        m_num_layers.store(num_layers, std::memory_order_release);
     }
 }
 
+void TreeModelVolumes::RadiusLayerPolygonCache::clear_all_but_radius0()
+{
+    for (size_t layer_idx = 0; layer_idx < this->num_layers(); ++ layer_idx) {
+        LayerData  &layer    = m_data[layer_idx];
+        const Node *smallest = nullptr;
+        for (const Node *node = layer.head.load(); node; node = node->next)
+            if (smallest == nullptr || node->radius < smallest->radius)
+                smallest = node;
+        if (smallest == nullptr)
+            continue;
+        const coord_t radius   = smallest->radius;
+        Polygons      polygons = std::move(const_cast<Node*>(smallest)->polygons);
+        layer.clear();
+        layer.emplace(radius, std::move(polygons));
+    }
+}
+
+size_t TreeModelVolumes::RadiusLayerPolygonCache::memory_size() const
+{
+    size_t size = m_data.size() * sizeof(LayerData);
+    for (size_t layer_idx = 0; layer_idx < this->num_layers(); ++ layer_idx)
+        for (const Node *node = m_data[layer_idx].head.load(std::memory_order_acquire); node; node = node->next) {
+            size += sizeof(Node) + node->polygons.capacity() * sizeof(Polygon);
+            for (const Polygon &polygon : node->polygons)
+                size += polygon.points.capacity() * sizeof(Point);
+        }
+    return size;
+}
+
 // For debugging purposes, sorted by layer index, then by radius.
 std::vector<std::pair<TreeModelVolumes::RadiusLayerPair, std::reference_wrapper<const Polygons>>> TreeModelVolumes::RadiusLayerPolygonCache::sorted() const
 {
     std::vector<std::pair<RadiusLayerPair, std::reference_wrapper<const Polygons>>> out;
-    for (auto &layer : m_data) {
-        auto layer_idx = LayerIndex(&layer - m_data.data());
-        for (auto &radius_polygons : layer)
-            out.emplace_back(std::make_pair(radius_polygons.first, layer_idx), radius_polygons.second);
+    for (size_t layer_idx = 0; layer_idx < this->num_layers(); ++ layer_idx) {
+        const size_t first = out.size();
+        for (const Node *node = m_data[layer_idx].head.load(std::memory_order_acquire); node; node = node->next)
+            out.emplace_back(std::make_pair(node->radius, LayerIndex(layer_idx)), node->polygons);
+        std::sort(out.begin() + first, out.end(), [](auto &l, auto &r){ return l.first.first < r.first.first; });
     }
-    assert(std::is_sorted(out.begin(), out.end(), [](auto &l, auto &r){ return l.first.second < r.first.second || (l.first.second == r.first.second) && l.first.first < r.first.first; }));
     return out;
 }
 
+TreeModelVolumesCache& TreeModelVolumesCache::instance()
+{
+    static TreeModelVolumesCache cache;
+    return cache;
+}
+
+static size_t polygons_memory_size(const Polygons &polygons)
+{
+    size_t size = polygons.size() * sizeof(Polygon);
+    for (const Polygon &polygon : polygons)
+        size += polygon.size() * sizeof(Point);
+    return size;
+}
+
+size_t TreeModelVolumesCacheKey::Collision::memory_size() const
+{
+    size_t size = parameters.size() * sizeof(coord_t) + raft_layers.size() * sizeof(double) + polygons_memory_size(machine_border);
+    for (const std::vector<Polygons> &outlines : layer_outlines)
+        for (const Polygons &layer : outlines)
+            size += sizeof(Polygons) + polygons_memory_size(layer);
+    for (const Polygons &layer : anti_overhang)
+        size += sizeof(Polygons) + polygons_memory_size(layer);
+    return size;
+}
+
+TreeModelVolumesCacheKey TreeModelVolumesCache::make_key(const std::shared_ptr<const TreeModelVolumesCacheKey::Collision> &collision, const std::vector<coord_t> &avoidance)
+{
+    size_t seed = collision->hash;
+    boost::hash_range(seed, avoidance.begin(), avoidance.end());
+    return { collision, avoidance, seed };
+}
+
+bool TreeModelVolumesCache::take(const std::shared_ptr<const TreeModelVolumesCacheKey::Collision> &collision, const std::vector<coord_t> &avoidance, const std::vector<RadiusLayerPolygonCache*> &caches)
+{
+    std::vector<RadiusLayerPolygonCache> cached;
+    if (! LRUCache::take(make_key(collision, avoidance), cached))
+        return false;
+    assert(cached.size() == caches.size());
+    for (size_t i = 0; i < caches.size(); ++ i)
+        *caches[i] = std::move(cached[i]);
+    return true;
+}
+
+void TreeModelVolumesCache::put(const std::shared_ptr<const TreeModelVolumesCacheKey::Collision> &collision, const std::vector<coord_t> &avoidance, const std::vector<RadiusLayerPolygonCache*> &caches)
+{
+    if (this->capacity() == 0 || std::all_of(caches.begin(), caches.end(), [](const RadiusLayerPolygonCache *cache) { return cache->empty(); }))
+        return;
+    // The collision inputs are shared by the collision and the avoidance entries, both account for them.
+    size_t size = collision->memory_size() + avoidance.size() * sizeof(coord_t);
+    std::vector<RadiusLayerPolygonCache> cached;
+    cached.reserve(caches.size());
+    for (RadiusLayerPolygonCache *cache : caches) {
+        size += cache->memory_size();
+        cached.emplace_back(std::move(*cache));
+    }
+    LRUCache::put(make_key(collision, avoidance), std::move(cached), size);
+}
+
 } // namespace Slic3r::TreeSupport3D
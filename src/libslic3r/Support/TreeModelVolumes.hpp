@@ -9,13 +9,14 @@
 #ifndef slic3r_TreeModelVolumes_hpp
 #define slic3r_TreeModelVolumes_hpp
 
-#include <mutex>
-#include <unordered_map>
+#include <atomic>
+#include <memory>
 
-#include <boost/functional/hash.hpp>
+#include <tbb/concurrent_vector.h>
 
 #include "TreeSupportCommon.hpp"
 
+#include "../LRUCache.hpp"
 #include "../Point.hpp"
 #include "../Polygon.hpp"
 #include "../PrintConfig.hpp"
@@ -34,6 +35,45 @@ static constexpr const coord_t SUPPORT_TREE_EXPONENTIAL_THRESHOLD = scaled<coord
 static constexpr const coord_t SUPPORT_TREE_COLLISION_RESOLUTION = scaled<coord_t>(0.5);
 static constexpr const bool    SUPPORT_TREE_AVOID_SUPPORT_BLOCKER = true;
 
+class TreeModelVolumesCache;
+
+// Key of TreeModelVolumesCache, holding all the inputs of the cached collisions and avoidances.
+struct TreeModelVolumesCacheKey
+{
+    // Inputs of the collisions and placeable areas: the object outlines, support blockers, machine border, raft layers
+    // and the distances to the object. Shared by the keys of the collisions and of the avoidances.
+    struct Collision
+    {
+        std::vector<coord_t>                parameters;
+        std::vector<std::vector<Polygons>>  layer_outlines;
+        std::vector<Polygons>               anti_overhang;
+        Polygons                            machine_border;
+        std::vector<double>                 raft_layers;
+        size_t                              hash;
+
+        bool operator==(const Collision &rhs) const {
+            return hash == rhs.hash && parameters == rhs.parameters && raft_layers == rhs.raft_layers && machine_border == rhs.machine_border &&
+                   anti_overhang == rhs.anti_overhang && layer_outlines == rhs.layer_outlines;
+        }
+        size_t memory_size() const;
+    };
+
+    std::shared_ptr<const Collision>    collision;
+    // Additional inputs of the avoidances and wall restrictions: the branch movement and the radii.
+    // Empty for the entries holding collisions.
+    std::vector<coord_t>                avoidance;
+    size_t                              hash;
+
+    bool operator==(const TreeModelVolumesCacheKey &rhs) const {
+        return hash == rhs.hash && avoidance == rhs.avoidance && (collision == rhs.collision || *collision == *rhs.collision);
+    }
+};
+
+struct TreeModelVolumesCacheKeyHash
+{
+    size_t operator()(const TreeModelVolumesCacheKey &key) const { return key.hash; }
+};
+
 class TreeModelVolumes
 {
 public:
@@ -69,6 +109,13 @@ public:
         m_wall_restrictions_cache_min.clear();
     }
 
+    // Hand the calculated collisions and avoidances over to TreeModelVolumesCache, so that the next support generation
+    // of the same slices with the same support settings will not recalculate them. This object is cleared.
+    void move_to_cache();
+    // Like clear_all_but_object_collision(), though the avoidances are handed over to TreeModelVolumesCache.
+    // The placeable areas are kept, they are cached together with the collisions they were calculated from.
+    void move_to_cache_all_but_object_collision();
+
     enum class AvoidanceType : int8_t
     {
         Slow,
@@ -169,6 +216,8 @@ public:
     Polygon m_bed_area;
 
 private:
+    friend class TreeModelVolumesCache;
+
     // Caching polygons for a range of layers.
     class LayerPolygonCache {
     public:
@@ -197,19 +246,55 @@ private:
      */
     using RadiusLayerPair             = std::pair<coord_t, LayerIndex>;
     class RadiusLayerPolygonCache {
-        // Map from radius to Polygons. Cache of one layer collision regions.
-        using LayerData = std::map<coord_t, Polygons>;
-        // Vector of layers, at each layer map of radius to Polygons.
-        // Reference to Polygons returned shall be stable to insertion.
-        using Layers = std::vector<LayerData>;
+        // Polygons of one radius at one layer.
+        struct Node {
+            coord_t             radius;
+            Polygons            polygons;
+            const Node         *next;
+        };
+        // Cache of one layer collision regions: Singly linked list of the radii calculated.
+        // Nodes are only ever prepended and they are not released until clear(), thus a reader may traverse the list
+        // without locking while another thread is inserting. Reference to Polygons returned is stable to insertion.
+        struct LayerData {
+            LayerData() = default;
+            // concurrent_vector::grow_to_at_least() copy constructs the new layers from an empty one.
+            LayerData(const LayerData &rhs) { assert(rhs.head.load() == nullptr); }
+            LayerData& operator=(const LayerData&) = delete;
+            ~LayerData() { this->clear(); }
+
+            const Node* find(coord_t radius) const {
+                for (const Node *node = head.load(std::memory_order_acquire); node; node = node->next)
+                    if (node->radius == radius)
+                        return node;
+                return nullptr;
+            }
+            // Only called by a single writer at a time, readers may run concurrently.
+            void emplace(coord_t radius, Polygons &&polygons) {
+                if (! this->find(radius))
+                    head.store(new Node{ radius, std::move(polygons), head.load(std::memory_order_relaxed) }, std::memory_order_release);
+            }
+            void clear() {
+                for (const Node *node = head.exchange(nullptr); node;) {
+                    const Node *next = node->next;
+                    delete node;
+                    node = next;
+                }
+            }
+
+            std::atomic<const Node*> head { nullptr };
+        };
+        // Vector of layers, at each layer list of radii with their Polygons.
+        // A concurrent_vector does not move its elements when growing.
+        using Layers = tbb::concurrent_vector<LayerData>;
     public:
         RadiusLayerPolygonCache() = default;
-        RadiusLayerPolygonCache(RadiusLayerPolygonCache &&rhs) : m_data(std::move(rhs.m_data)) {}
-        RadiusLayerPolygonCache& operator=(RadiusLayerPolygonCache &&rhs) { m_data = std::move(rhs.m_data); return *this; }
+        RadiusLayerPolygonCache(RadiusLayerPolygonCache &&rhs) : m_data(std::move(rhs.m_data)), m_num_layers(rhs.m_num_layers.exchange(0)) {}
+        RadiusLayerPolygonCache& operator=(RadiusLayerPolygonCache &&rhs) { m_data = std::move(rhs.m_data); m_num_layers = rhs.m_num_layers.exchange(0); return *this; }
 
         RadiusLayerPolygonCache(const RadiusLayerPolygonCache&) = delete;
         RadiusLayerPolygonCache& operator=(const RadiusLayerPolygonCache&) = delete;
 
+        // Insertions are serialized, lookups do not lock.
         void insert(std::vector<std::pair<RadiusLayerPair, Polygons>> &&in) {
             std::lock_guard<std::mutex> guard(m_mutex);
             for (auto &d : in)
@@ -240,29 +325,23 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         std::optional<std::reference_wrapper<const Polygons>> getArea(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
-            if (key.second >= m_data.size())
+            if (key.second >= this->num_layers())
                 return std::optional<std::reference_wrapper<const Polygons>>{};
-            const auto &layer = m_data[key.second];
-            auto it = layer.find(key.first);
-            return it == layer.end() ? 
-                std::optional<std::reference_wrapper<const Polygons>>{} : std::optional<std::reference_wrapper<const Polygons>>{ it->second };
+            const Node *node = m_data[key.second].find(key.first);
+            return node == nullptr ? 
+                std::optional<std::reference_wrapper<const Polygons>>{} : std::optional<std::reference_wrapper<const Polygons>>{ node->polygons };
         }
         // Get a collision area at a given layer for a radius that is a lower or equial to the key radius.
         std::optional<std::pair<coord_t, std::reference_wrapper<const Polygons>>> get_lower_bound_area(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
-            if (key.second >= m_data.size())
+            if (key.second >= this->num_layers())
                 return {};
-            const auto &layer = m_data[key.second];
-            if (layer.empty())
+            const Node *best = nullptr;
+            for (const Node *node = m_data[key.second].head.load(std::memory_order_acquire); node; node = node->next)
+                if (node->radius <= key.first && (best == nullptr || node->radius > best->radius))
+                    best = node;
+            if (best == nullptr)
                 return {};
-            auto it = layer.lower_bound(key.first);
-            if (it == layer.end() || it->first != key.first) {
-                if (it == layer.begin())
-                    return {};
-                -- it;
-            }
-            return std::make_pair(it->first, std::reference_wrapper<const Polygons>(it->second));
+            return std::make_pair(best->radius, std::reference_wrapper<const Polygons>(best->polygons));
         }
         /*!
          * \brief Get the highest already calculated layer in the cache.
@@ -272,10 +351,9 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         LayerIndex getMaxCalculatedLayer(coord_t radius) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
-            auto layer_idx = LayerIndex(m_data.size()) - 1;
+            auto layer_idx = LayerIndex(this->num_layers()) - 1;
             for (; layer_idx > 0; -- layer_idx)
-                if (const auto &layer = m_data[layer_idx]; layer.find(radius) != layer.end())
+                if (m_data[layer_idx].find(radius))
                     break;
             // The placeable on model areas do not exist on layer 0, as there can not be model below it. As such it may be possible that layer 1 is available, but layer 0 does not exist.
             return layer_idx == 0 ? -1 : layer_idx;
@@ -284,17 +362,16 @@ private:
         // For debugging purposes, sorted by layer index, then by radius.
         [[nodiscard]] std::vector<std::pair<RadiusLayerPair, std::reference_wrapper<const Polygons>>> sorted() const;
 
-        void clear() { m_data.clear(); }
-        void clear_all_but_radius0() { 
-            for (LayerData &l : m_data) {
-                auto begin = l.begin();
-                auto end = l.end();
-                if (begin != end && ++ begin != end)
-                    l.erase(begin, end);
-            }
-        }
+        // Not thread safe, shall not be called concurrently with any other method.
+        void clear() { m_data.clear(); m_num_layers = 0; }
+        bool empty() const { return this->num_layers() == 0; }
+        // Estimated memory footprint in bytes.
+        size_t memory_size() const;
+        void clear_all_but_radius0();
 
     private:
+        // Number of layers constructed. May be lower than m_data.size(), which counts layers being constructed by a concurrent insertion.
+        size_t              num_layers() const { return m_num_layers.load(std::memory_order_acquire); }
         LayerData&          get_allocate_layer_data(LayerIndex layer_idx) {
             allocate_layers(layer_idx + 1);
             return m_data[layer_idx];
@@ -302,7 +379,9 @@ private:
         void                allocate_layers(size_t num_layers);
 
         Layers              m_data;
-        mutable std::mutex  m_mutex;
+        std::atomic<size_t> m_num_layers { 0 };
+        // Serializes insertions.
+        std::mutex          m_mutex;
     };
 
 
@@ -492,6 +571,11 @@ private:
     // Z heights of the raft layers (additional layers below the object, last raft layer aligned with the bottom of the first object layer).
     std::vector<double>         m_raft_layers;
 
+    // Keys of TreeModelVolumesCache: all the inputs of the collisions and placeable areas, null if the cache is disabled,
+    // and the additional inputs of the avoidances and wall restrictions, empty if not calculated yet.
+    std::shared_ptr<const TreeModelVolumesCacheKey::Collision> m_collision_key;
+    std::vector<coord_t>        m_avoidance_key;
+
     /*!
      * \brief Caches for the collision, avoidance and areas on the model where support can be placed safely
      * at given radius and layer indices.
@@ -549,6 +633,32 @@ private:
 #endif // SLIC3R_TREESUPPORTS_PROGRESS
 };
 
+// Content addressed cache of the collisions and avoidances calculated by TreeModelVolumes, shared by all PrintObjects
+// of all Prints of the process, thus regenerating tree supports after a change of the support settings, which does not
+// affect the object slices, only recalculates what the changed settings affect.
+// The collisions and placeable areas are stored under a key holding the object outlines, support blockers, raft layers
+// and the distances to the object; the avoidances and wall restrictions are stored under a key additionally holding
+// the branch movement and the radii. Cached entries are moved into TreeModelVolumes, which continues where
+// the cached calculation stopped if more layers or radii are requested.
+class TreeModelVolumesCache : public LRUCache<TreeModelVolumesCacheKey, std::vector<TreeModelVolumes::RadiusLayerPolygonCache>, TreeModelVolumesCacheKeyHash>
+{
+public:
+    static TreeModelVolumesCache& instance();
+
+private:
+    friend class TreeModelVolumes;
+    using RadiusLayerPolygonCache = TreeModelVolumes::RadiusLayerPolygonCache;
+
+    TreeModelVolumesCache() : LRUCache(size_t(256) << 20) {}
+
+    // Returns true and moves the cached polygons into caches if a matching entry is cached. The entry is removed from the cache.
+    bool                    take(const std::shared_ptr<const TreeModelVolumesCacheKey::Collision> &collision, const std::vector<coord_t> &avoidance, const std::vector<RadiusLayerPolygonCache*> &caches);
+    // Moves the polygons of caches into the cache.
+    void                    put(const std::shared_ptr<const TreeModelVolumesCacheKey::Collision> &collision, const std::vector<coord_t> &avoidance, const std::vector<RadiusLayerPolygonCache*> &caches);
+
+    static TreeModelVolumesCacheKey make_key(const std::shared_ptr<const TreeModelVolumesCacheKey::Collision> &collision, const std::vector<coord_t> &avoidance);
+};
+
 } // namespace TreeSupport3D
 } // namespace Slic3r
 
@@ -669,7 +669,6 @@ void TreeSupport::detect_overhangs(bool check_support_necessity/* = false*/)
 
     // Clear and create Tree Support Layers
     m_object->clear_support_layers();
-    m_object->clear_tree_support_preview_cache();
 
     const PrintObjectConfig& config = m_object->config();
     SupportType stype = support_type;
@@ -2732,6 +2731,8 @@ void TreeSupport::drop_nodes()
         // parallel pre-compute avoidance
         tbb::parallel_for(tbb::blocked_range<size_t>(0, contact_nodes.size() - 1), [&](const tbb::blocked_range<size_t> &range) {
             for (size_t layer_nr = range.begin(); layer_nr < range.end(); layer_nr++) {
+            if (m_object->print()->canceled())
+                break;
             for (auto node_radius : all_layer_radius[layer_nr]) {
                 size_t obj_layer_nr= layer_heights[layer_nr].obj_layer_nr;
                 m_ts_data->get_avoidance(node_radius, obj_layer_nr);
@@ -3914,6 +3915,7 @@ void TreeSupport::insert_dropped_node(std::vector<SupportNode*>& nodes_layer, Su
 TreeSupportData::TreeSupportData(const PrintObject &object, coordf_t xy_distance, coordf_t radius_sample_resolution)
     : m_xy_distance(xy_distance), m_radius_sample_resolution(radius_sample_resolution)
 {
+    m_cache_key = cache_key(object, xy_distance, radius_sample_resolution);
     branch_scale_factor = tan(object.config().tree_support_branch_angle.value * M_PI / 180.);
     clear_nodes();
     m_max_move_distances.resize(object.layers().size(), 0);
@@ -3937,6 +3939,21 @@ TreeSupportData::TreeSupportData(const PrintObject &object, coordf_t xy_distance
     }
 }
 
+TreeSupportData::CacheKey TreeSupportData::cache_key(const PrintObject &object, coordf_t xy_distance, coordf_t radius_sample_resolution)
+{
+    CacheKey key;
+    key.xy_distance              = xy_distance;
+    key.radius_sample_resolution = radius_sample_resolution;
+    key.branch_angle             = object.config().tree_support_branch_angle.value;
+    key.layer_heights.reserve(object.layer_count());
+    key.layer_slices.reserve(object.layer_count());
+    for (const Layer *layer : object.layers()) {
+        key.layer_heights.emplace_back(layer->height);
+        key.layer_slices.emplace_back(layer->lslices);
+    }
+    return key;
+}
+
 const ExPolygons& TreeSupportData::get_collision(coordf_t radius, size_t layer_nr) const
 {
     profiler.tic();
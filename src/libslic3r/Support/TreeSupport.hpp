@@ -249,6 +249,32 @@ public:
     SupportNode* create_node(const Point position, const int distance_to_top, const int obj_layer_nr, const int support_roof_layers_below, const bool to_buildplate, SupportNode* parent,
         coordf_t     print_z_, coordf_t height_, coordf_t dist_mm_to_top_ = 0, coordf_t radius_ = 0);
     void clear_nodes();
+
+    /*!
+     * \brief The slices and settings the collision and avoidance caches are
+     * computed from.
+     *
+     * PrintObject keeps this object between support generations as long as
+     * the key compares equal, so the caches are only filled for new radii.
+     */
+    struct CacheKey
+    {
+        coordf_t                xy_distance{0};
+        coordf_t                radius_sample_resolution{0};
+        double                  branch_angle{0};
+        std::vector<coordf_t>   layer_heights;
+        std::vector<ExPolygons> layer_slices;
+
+        bool operator==(const CacheKey &rhs) const
+        {
+            return xy_distance == rhs.xy_distance && radius_sample_resolution == rhs.radius_sample_resolution && branch_angle == rhs.branch_angle &&
+                   layer_heights == rhs.layer_heights && layer_slices == rhs.layer_slices;
+        }
+        bool operator!=(const CacheKey &rhs) const { return !(*this == rhs); }
+    };
+    static CacheKey cache_key(const PrintObject &object, coordf_t xy_distance, coordf_t radius_sample_resolution);
+    CacheKey m_cache_key;
+
     std::vector<LayerHeightData> layer_heights;
 
     std::vector<std::unique_ptr<SupportNode>> contact_nodes;
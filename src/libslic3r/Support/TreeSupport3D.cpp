@@ -4266,6 +4266,8 @@ static void generate_support_areas(Print &print, TreeSupport* tree_support, cons
         }
 #endif /* SLIC3R_DEBUG */
 
+        // Keep the collisions and avoidances for the next support generation of the same slices.
+        volumes.move_to_cache();
         ++ counter;
     }
 
@@ -4337,7 +4339,8 @@ void organic_draw_branches(
     organic_smooth_branches_avoid_collisions(print_object, volumes, config, elements_with_link_down, linear_data_layers, throw_on_cancel);
 
     // Reduce memory footprint. After this point only finalize_interface_and_support_areas() will use volumes and from that only collisions with zero radius will be used.
-    volumes.clear_all_but_object_collision();
+    // The avoidances are kept by TreeModelVolumesCache for the next support generation.
+    volumes.move_to_cache_all_but_object_collision();
 
     // Unmark all nodes.
     for (SupportElements& elements : move_bounds)
@@ -222,12 +222,6 @@ void name_tbb_thread_pool_threads_set_locale()
 	const size_t nthreads_hw = tbb::this_task_arena::max_concurrency();
 	size_t       nthreads    = nthreads_hw;
 
-#ifdef SLIC3R_PROFILE
-	// Shiny profiler is not thread safe, thus disable parallelization.
-	disable_multi_threading();
-	nthreads = 1;
-#endif
-
 	size_t                  nthreads_running(0);
 	std::condition_variable cv;
 	std::mutex				cv_m;
@@ -17,6 +17,7 @@
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
 
 #ifndef NDEBUG
 //    #define EXPENSIVE_DEBUG_CHECKS
@@ -481,18 +482,17 @@ void slice_facet_at_zs(
     const Vec3i                                      &edge_ids,
     // Scaled or unscaled zs. If vertices have their zs scaled or transform_vertex_fn scales them, then zs have to be scaled as well.
     const std::vector<float>                         &zs,
-    std::vector<IntersectionLines>                   &lines,
-    std::array<std::mutex, 64>                       &lines_mutex)
+    // Layer range of the facet, see slice_make_lines().
+    std::vector<float>::const_iterator                min_layer,
+    std::vector<float>::const_iterator                max_layer,
+    // Lines of the calling thread.
+    std::vector<IntersectionLines>                   &lines)
 {
     stl_vertex vertices[3] { transform_vertex_fn(mesh_vertices[indices(0)]), transform_vertex_fn(mesh_vertices[indices(1)]), transform_vertex_fn(mesh_vertices[indices(2)]) };
 
     // find facet extents
     const float min_z = fminf(vertices[0].z(), fminf(vertices[1].z(), vertices[2].z()));
     const float max_z = fmaxf(vertices[0].z(), fmaxf(vertices[1].z(), vertices[2].z()));
-
-    // find layer extents
-    auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
-    auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
     int  idx_vertex_lowest = (vertices[1].z() == min_z) ? 1 : ((vertices[2].z() == min_z) ? 2 : 0);
 
     for (auto it = min_layer; it != max_layer; ++ it) {
@@ -500,9 +500,7 @@ void slice_facet_at_zs(
         // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
         if (min_z != max_z && slice_facet(*it, vertices, indices, edge_ids, idx_vertex_lowest, false, il) == FacetSliceType::Slicing) {
             assert(il.edge_type != IntersectionLine::FacetEdgeType::Horizontal);
-            size_t slice_id = it - zs.begin();
-            boost::lock_guard<std::mutex> l(lines_mutex[slice_id % lines_mutex.size()]);
-            lines[slice_id].emplace_back(il);
+            lines[it - zs.begin()].emplace_back(il);
         }
     }
 }
@@ -516,18 +514,49 @@ static inline std::vector<IntersectionLines> slice_make_lines(
     const std::vector<float>                        &zs,
     const ThrowOnCancel                              throw_on_cancel_fn)
 {
-    std::vector<IntersectionLines>  lines(zs.size(), IntersectionLines());
-    std::array<std::mutex, 64>      lines_mutex;
+    // Z of the transformed vertices stored separately. Facets of a fine mesh are mostly smaller than the layer height,
+    // thus most of them do not cross any plane and they are rejected by reading just this compact array,
+    // without transforming their vertices.
+    std::vector<float> vertex_zs(vertices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, vertices.size()), [&vertices, &transform_vertex_fn, &vertex_zs](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++ i)
+            vertex_zs[i] = transform_vertex_fn(vertices[i]).z();
+    });
+
+    // Each thread collects its own lines, they are merged per layer at the end, instead of locking a layer for each line.
+    tbb::enumerable_thread_specific<std::vector<IntersectionLines>> thread_lines([&zs]() { return std::vector<IntersectionLines>(zs.size()); });
     tbb::parallel_for(
         tbb::blocked_range<int>(0, int(indices.size())),
-        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
+        [&vertices, &vertex_zs, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &thread_lines, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
+            std::vector<IntersectionLines> &lines = thread_lines.local();
             for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
                 if ((face_idx & 0x0ffff) == 0)
                     throw_on_cancel_fn();
-                slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, lines, lines_mutex);
+                const stl_triangle_vertex_indices &face = indices[face_idx];
+                const float z0 = vertex_zs[face(0)], z1 = vertex_zs[face(1)], z2 = vertex_zs[face(2)];
+                // find layer extents
+                auto min_layer = std::lower_bound(zs.begin(), zs.end(), fminf(z0, fminf(z1, z2))); // first layer whose slice_z is >= min_z
+                if (min_layer == zs.end() || *min_layer > fmaxf(z0, fmaxf(z1, z2)))
+                    continue;
+                auto max_layer = std::upper_bound(min_layer, zs.end(), fmaxf(z0, fmaxf(z1, z2))); // first layer whose slice_z is > max_z
+                slice_facet_at_zs(vertices, transform_vertex_fn, face, face_edge_ids[face_idx], zs, min_layer, max_layer, lines);
             }
         }
     );
+
+    std::vector<IntersectionLines> lines(zs.size(), IntersectionLines());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, zs.size()), [&thread_lines, &lines](const tbb::blocked_range<size_t> &range) {
+        for (size_t slice_id = range.begin(); slice_id < range.end(); ++ slice_id) {
+            size_t cnt = 0;
+            for (const std::vector<IntersectionLines> &tl : thread_lines)
+                cnt += tl[slice_id].size();
+            lines[slice_id].reserve(cnt);
+            for (std::vector<IntersectionLines> &tl : thread_lines) {
+                append(lines[slice_id], std::move(tl[slice_id]));
+                tl[slice_id] = IntersectionLines();
+            }
+        }
+    });
     return lines;
 }
 
@@ -2000,6 +2029,92 @@ Polygons slice_mesh(
     return layers.front();
 }
 
+ParallelPlanesSlicer::ParallelPlanesSlicer(const indexed_triangle_set &mesh, const MeshSlicingParams &params) :
+    m_mesh(mesh), m_params(params)
+{
+    m_face_edge_ids = its_face_edge_ids(mesh);
+
+    m_vertex_zs.assign(mesh.vertices.size(), 0.f);
+    if (is_identity(params.trafo)) {
+        for (size_t i = 0; i < mesh.vertices.size(); ++ i)
+            m_vertex_zs[i] = mesh.vertices[i].z();
+    } else {
+        Transform3f tf = make_trafo_for_slicing(params.trafo);
+        for (size_t i = 0; i < mesh.vertices.size(); ++ i)
+            m_vertex_zs[i] = (tf * mesh.vertices[i]).z();
+    }
+    if (mesh.indices.empty())
+        return;
+
+    auto face_span = [this](const Vec3i &face) {
+        const float z0 = m_vertex_zs[face(0)], z1 = m_vertex_zs[face(1)], z2 = m_vertex_zs[face(2)];
+        return std::make_pair(fminf(z0, fminf(z1, z2)), fmaxf(z0, fmaxf(z1, z2)));
+    };
+    m_min_z = std::numeric_limits<float>::max();
+    m_max_z = std::numeric_limits<float>::lowest();
+    for (const Vec3i &face : mesh.indices) {
+        auto [min_z, max_z] = face_span(face);
+        m_min_z = std::min(m_min_z, min_z);
+        m_max_z = std::max(m_max_z, max_z);
+    }
+
+    // Most faces of a dense mesh fall into a single bin or two.
+    const size_t num_bins = std::clamp<size_t>(mesh.indices.size() / 64, 1, 4096);
+    m_bin_height = std::max((m_max_z - m_min_z) / float(num_bins), std::numeric_limits<float>::min());
+    auto bin_of = [this, num_bins](float z) { return std::min(size_t((z - m_min_z) / m_bin_height), num_bins - 1); };
+
+    m_bin_start.assign(num_bins + 1, 0);
+    for (const Vec3i &face : mesh.indices) {
+        auto [min_z, max_z] = face_span(face);
+        for (size_t bin = bin_of(min_z); bin <= bin_of(max_z); ++ bin)
+            ++ m_bin_start[bin + 1];
+    }
+    for (size_t bin = 0; bin < num_bins; ++ bin)
+        m_bin_start[bin + 1] += m_bin_start[bin];
+    m_bin_faces.assign(m_bin_start.back(), -1);
+    std::vector<size_t> bin_end(m_bin_start.begin(), m_bin_start.end() - 1);
+    for (int face_idx = 0; face_idx < int(mesh.indices.size()); ++ face_idx) {
+        auto [min_z, max_z] = face_span(mesh.indices[face_idx]);
+        for (size_t bin = bin_of(min_z); bin <= bin_of(max_z); ++ bin)
+            m_bin_faces[bin_end[bin] ++] = face_idx;
+    }
+}
+
+Polygons ParallelPlanesSlicer::slice(const float plane_z) const
+{
+    std::vector<IntersectionLines> lines(1);
+    if (! m_bin_start.empty() && plane_z >= m_min_z && plane_z <= m_max_z) {
+        const size_t num_bins = m_bin_start.size() - 1;
+        const size_t bin      = std::min(size_t((plane_z - m_min_z) / m_bin_height), num_bins - 1);
+        const bool        trafo_identity = is_identity(m_params.trafo);
+        const Transform3f tf             = make_trafo_for_slicing(m_params.trafo);
+        for (size_t i = m_bin_start[bin]; i < m_bin_start[bin + 1]; ++ i) {
+            const int    face_idx = m_bin_faces[i];
+            const Vec3i &indices  = m_mesh.indices[face_idx];
+            const float  z0 = m_vertex_zs[indices(0)], z1 = m_vertex_zs[indices(1)], z2 = m_vertex_zs[indices(2)];
+            // Only the faces crossing the plane, see slice_mesh() above.
+            if (fminf(z0, fminf(z1, z2)) > plane_z || fmaxf(z0, fmaxf(z1, z2)) < plane_z)
+                continue;
+            stl_vertex vertices[3];
+            for (int j = 0; j < 3; ++ j) {
+                const Vec3f &p = m_mesh.vertices[indices(j)];
+                vertices[j] = trafo_identity ? Vec3f(scaled<float>(p.x()), scaled<float>(p.y()), p.z()) : Vec3f(tf * p);
+            }
+            const float min_z             = fminf(vertices[0].z(), fminf(vertices[1].z(), vertices[2].z()));
+            const float max_z             = fmaxf(vertices[0].z(), fmaxf(vertices[1].z(), vertices[2].z()));
+            int         idx_vertex_lowest = (vertices[1].z() == min_z) ? 1 : ((vertices[2].z() == min_z) ? 2 : 0);
+            IntersectionLine il;
+            // Ignore horizontal triangles, see slice_make_lines().
+            if (min_z != max_z && slice_facet(plane_z, vertices, indices, m_face_edge_ids[face_idx], idx_vertex_lowest, false, il) == FacetSliceType::Slicing)
+                lines.front().emplace_back(il);
+        }
+    }
+
+    std::vector<Polygons> layers = make_loops(lines, m_params, [](){});
+    assert(layers.size() == 1);
+    return layers.front();
+}
+
 std::vector<ExPolygons> slice_mesh_ex(
     const indexed_triangle_set       &mesh,
     const std::vector<float>         &zs,
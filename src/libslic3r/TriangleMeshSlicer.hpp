@@ -69,6 +69,33 @@ Polygons                        slice_mesh(
     const float                       plane_z,
     const MeshSlicingParams          &params);
 
+// Slices a mesh by one plane at a time out of a family of parallel planes, for example while a cut plane is being dragged.
+// Produces the same result as slice_mesh(mesh, plane_z, params). The face edge IDs and the Z coordinates of the transformed
+// vertices are calculated once and the faces are binned by their Z span, so that a slice only visits the faces near the plane.
+// The mesh is referenced, the caller must make sure that it stays valid and unchanged.
+class ParallelPlanesSlicer
+{
+public:
+    ParallelPlanesSlicer(const indexed_triangle_set &mesh, const MeshSlicingParams &params);
+
+    const indexed_triangle_set& mesh() const { return m_mesh; }
+    const MeshSlicingParams&    params() const { return m_params; }
+
+    Polygons slice(const float plane_z) const;
+
+private:
+    const indexed_triangle_set &m_mesh;
+    MeshSlicingParams           m_params;
+    std::vector<Vec3i>          m_face_edge_ids;
+    std::vector<float>          m_vertex_zs;
+    float                       m_min_z { 0.f };
+    float                       m_max_z { 0.f };
+    float                       m_bin_height { 0.f };
+    // Faces overlapping the n-th bin are m_bin_faces[m_bin_start[n] .. m_bin_start[n + 1]).
+    std::vector<size_t>         m_bin_start;
+    std::vector<int>            m_bin_faces;
+};
+
 std::vector<ExPolygons>         slice_mesh_ex(
     const indexed_triangle_set       &mesh,
     const std::vector<float>         &zs,
@@ -0,0 +1,61 @@
+#include "TriangleMeshSlicerCache.hpp"
+
+#include <boost/container_hash/hash.hpp>
+
+#include <string_view>
+
+namespace Slic3r {
+
+TriangleMeshSlicerCache& TriangleMeshSlicerCache::instance()
+{
+    static TriangleMeshSlicerCache cache;
+    return cache;
+}
+
+bool TriangleMeshSlicerCacheKey::operator==(const TriangleMeshSlicerCacheKey &rhs) const
+{
+    return hash == rhs.hash && zs == rhs.zs &&
+           params.mode == rhs.params.mode && params.slicing_mode_normal_below_layer == rhs.params.slicing_mode_normal_below_layer &&
+           params.mode_below == rhs.params.mode_below && params.trafo.matrix() == rhs.params.trafo.matrix() &&
+           params.closing_radius == rhs.params.closing_radius && params.extra_offset == rhs.params.extra_offset &&
+           params.resolution == rhs.params.resolution &&
+           (mesh == rhs.mesh || (mesh->its.vertices == rhs.mesh->its.vertices && mesh->its.indices == rhs.mesh->its.indices));
+}
+
+TriangleMeshSlicerCacheKey TriangleMeshSlicerCache::make_key(const std::shared_ptr<const TriangleMesh> &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params)
+{
+    // Hashing the raw mesh data is much cheaper than slicing the mesh.
+    const indexed_triangle_set &its = mesh->its;
+    std::hash<std::string_view> hash;
+    size_t seed = hash(std::string_view(reinterpret_cast<const char*>(its.vertices.data()), its.vertices.size() * sizeof(stl_vertex)));
+    boost::hash_combine(seed, hash(std::string_view(reinterpret_cast<const char*>(its.indices.data()), its.indices.size() * sizeof(stl_triangle_vertex_indices))));
+    boost::hash_combine(seed, zs.size());
+    boost::hash_range(seed, zs.begin(), zs.end());
+    boost::hash_range(seed, params.trafo.data(), params.trafo.data() + 16);
+    boost::hash_combine(seed, params.closing_radius);
+    boost::hash_combine(seed, params.extra_offset);
+    return { mesh, params, zs, seed };
+}
+
+bool TriangleMeshSlicerCache::get(const std::shared_ptr<const TriangleMesh> &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params, std::vector<ExPolygons> &out)
+{
+    return this->capacity() > 0 && LRUCache::get(make_key(mesh, zs, params), out);
+}
+
+void TriangleMeshSlicerCache::put(const std::shared_ptr<const TriangleMesh> &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params, const std::vector<ExPolygons> &slices)
+{
+    if (this->capacity() == 0)
+        return;
+    // The mesh is accounted for as well, it is kept alive by the cache.
+    size_t size = mesh->its.vertices.size() * sizeof(stl_vertex) + mesh->its.indices.size() * sizeof(stl_triangle_vertex_indices) +
+                  zs.size() * sizeof(float) + slices.size() * sizeof(ExPolygons);
+    for (const ExPolygons &expolygons : slices)
+        for (const ExPolygon &expolygon : expolygons) {
+            size += sizeof(ExPolygon) + expolygon.contour.size() * sizeof(Point);
+            for (const Polygon &hole : expolygon.holes)
+                size += sizeof(Polygon) + hole.size() * sizeof(Point);
+        }
+    LRUCache::put(make_key(mesh, zs, params), slices, size);
+}
+
+} // namespace Slic3r
@@ -0,0 +1,51 @@
+#ifndef slic3r_TriangleMeshSlicerCache_hpp_
+#define slic3r_TriangleMeshSlicerCache_hpp_
+
+#include "ExPolygon.hpp"
+#include "LRUCache.hpp"
+#include "TriangleMesh.hpp"
+#include "TriangleMeshSlicer.hpp"
+
+#include <memory>
+
+namespace Slic3r {
+
+struct TriangleMeshSlicerCacheKey
+{
+    // The mesh is held, not copied: the meshes of ModelVolumes are shared and immutable.
+    std::shared_ptr<const TriangleMesh> mesh;
+    MeshSlicingParamsEx                 params;
+    std::vector<float>                  zs;
+    // Hash of all the above, the mesh data is compared in full by operator==.
+    size_t                              hash;
+
+    bool operator==(const TriangleMeshSlicerCacheKey &rhs) const;
+};
+
+struct TriangleMeshSlicerCacheKeyHash
+{
+    size_t operator()(const TriangleMeshSlicerCacheKey &key) const { return key.hash; }
+};
+
+// Content addressed cache of the results of slice_mesh_ex(), shared by all PrintObjects of all Prints of the process,
+// thus identical volumes on other plates, other instances of the same ModelObject or a PrintObject resliced after
+// an unrelated change are only sliced once.
+// The key is the mesh, the slicing parameters including the transformation and the slicing planes.
+class TriangleMeshSlicerCache : public LRUCache<TriangleMeshSlicerCacheKey, std::vector<ExPolygons>, TriangleMeshSlicerCacheKeyHash>
+{
+public:
+    static TriangleMeshSlicerCache& instance();
+
+    // Returns true and fills in the slices if a matching result is cached.
+    bool                    get(const std::shared_ptr<const TriangleMesh> &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params, std::vector<ExPolygons> &out);
+    void                    put(const std::shared_ptr<const TriangleMesh> &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params, const std::vector<ExPolygons> &slices);
+
+private:
+    TriangleMeshSlicerCache() : LRUCache(size_t(256) << 20) {}
+
+    static TriangleMeshSlicerCacheKey make_key(const std::shared_ptr<const TriangleMesh> &mesh, const std::vector<float> &zs, const MeshSlicingParamsEx &params);
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_TriangleMeshSlicerCache_hpp_
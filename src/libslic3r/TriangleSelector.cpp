@@ -352,8 +352,10 @@ void TriangleSelector::seed_fill_select_triangles(const Vec3f &hit, int facet_st
                         // Child triangle shares normal with its parent. Select it.
                         facet_queue.push(child);
                 }
-            } else
+            } else {
                 m_triangles[current_facet].select_by_seed_fill();
+                this->mark_facet_dirty(m_triangles[current_facet].source_triangle);
+            }
 
             if (current_facet < m_orig_size_indices)
                 // Propagate over the original triangles.
@@ -491,6 +493,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
 
     if (!propagate) {
         m_triangles[start_facet_idx].select_by_seed_fill();
+        this->mark_facet_dirty(m_triangles[start_facet_idx].source_triangle);
         return;
     }
 
@@ -525,6 +528,7 @@ void TriangleSelector::bucket_fill_select_triangles(const Vec3f& hit, int facet_
 
         if (!visited[current_facet]) {
             m_triangles[current_facet].select_by_seed_fill();
+            this->mark_facet_dirty(m_triangles[current_facet].source_triangle);
 
             std::vector<int> touching_triangles = get_all_touching_triangles(current_facet, neighbors[current_facet], neighbors_propagated[current_facet]);
             for(const int tr_idx : touching_triangles) {
@@ -562,6 +566,7 @@ bool TriangleSelector::select_triangle(int facet_idx, EnforcerBlockerType type,
 
     if (! select_triangle_recursive(facet_idx, neighbors, type, triangle_splitting))
         return false;
+    this->mark_facet_dirty(m_triangles[facet_idx].source_triangle);
 
     // In case that all children are leafs and have the same state now,
     // they may be removed and substituted by the parent triangle.
@@ -959,6 +964,37 @@ void TriangleSelector::set_facet(int facet_idx, EnforcerBlockerType state)
     undivide_triangle(facet_idx);
     assert(! m_triangles[facet_idx].is_split());
     m_triangles[facet_idx].set_state(state);
+    this->mark_facet_dirty(facet_idx);
+}
+
+void TriangleSelector::mark_facet_dirty(int source_facet)
+{
+    assert(source_facet >= 0 && source_facet < m_orig_size_indices);
+    if (! m_all_facets_dirty && ! m_dirty_facets_mask[source_facet]) {
+        m_dirty_facets_mask[source_facet] = 1;
+        m_dirty_facets.emplace_back(source_facet);
+    }
+}
+
+void TriangleSelector::mark_all_facets_dirty()
+{
+    for (int facet_idx : m_dirty_facets)
+        m_dirty_facets_mask[facet_idx] = 0;
+    m_dirty_facets.clear();
+    m_all_facets_dirty = true;
+}
+
+bool TriangleSelector::take_dirty_facets(std::vector<int> &dirty_facets)
+{
+    dirty_facets.clear();
+    if (m_all_facets_dirty) {
+        m_all_facets_dirty = false;
+        return false;
+    }
+    dirty_facets.swap(m_dirty_facets);
+    for (int facet_idx : dirty_facets)
+        m_dirty_facets_mask[facet_idx] = 0;
+    return true;
 }
 
 // called by select_patch()->select_triangle()...select_triangle()
@@ -1290,6 +1326,8 @@ void TriangleSelector::reset()
     }
     m_orig_size_vertices = int(m_vertices.size());
     m_orig_size_indices  = int(m_triangles.size());
+    m_dirty_facets_mask.assign(m_orig_size_indices, 0);
+    this->mark_all_facets_dirty();
 }
 
 void TriangleSelector::set_edge_limit(float edge_limit)
@@ -1720,6 +1758,7 @@ void TriangleSelector::deserialize(const std::pair<std::vector<std::pair<int, in
 {
     if (needs_reset)
         reset(); // dump any current state
+    this->mark_all_facets_dirty();
     for (auto [triangle_id, ibit] : data.first) {
         if (triangle_id >= int(m_triangles.size())) {
             BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << "array bound:error:triangle_id >= int(m_triangles.size())";
@@ -1904,15 +1943,19 @@ bool TriangleSelector::has_facets(const std::pair<std::vector<std::pair<int, int
 void TriangleSelector::seed_fill_unselect_all_triangles()
 {
     for (Triangle &triangle : m_triangles)
-        if (!triangle.is_split())
+        if (!triangle.is_split() && triangle.is_selected_by_seed_fill()) {
             triangle.unselect_by_seed_fill();
+            this->mark_facet_dirty(triangle.source_triangle);
+        }
 }
 
 void TriangleSelector::seed_fill_apply_on_triangles(EnforcerBlockerType new_state)
 {
     for (Triangle &triangle : m_triangles)
-        if (!triangle.is_split() && triangle.is_selected_by_seed_fill())
+        if (!triangle.is_split() && triangle.is_selected_by_seed_fill()) {
             triangle.set_state(new_state);
+            this->mark_facet_dirty(triangle.source_triangle);
+        }
 
     for (Triangle &triangle : m_triangles)
         if (triangle.is_split() && triangle.valid()) {
@@ -288,7 +288,14 @@ public:
     // The operation may merge split triangles if they are being assigned the same color.
     void seed_fill_apply_on_triangles(EnforcerBlockerType new_state);
 
+    // Moves the indices of the facets of the original mesh, whose division tree or state changed since the last call, to dirty_facets.
+    // Returns false if the whole mesh has to be considered changed (after reset() or deserialize()), dirty_facets is left empty then.
+    bool take_dirty_facets(std::vector<int> &dirty_facets);
+
 protected:
+    // To be called after the states of the triangles were changed directly, bypassing the selection functions.
+    void mark_all_facets_dirty();
+
     // Triangle and info about how it's split.
     class Triangle {
     public:
@@ -384,9 +391,29 @@ protected:
     // Zero indicates an uninitialized state.
     float m_old_cursor_radius_sqr = 0;
 
+    // Calls fn(const Triangle&) for all valid leaves of the division tree of a facet.
+    template<typename Fn> void for_each_leaf_triangle(int facet_idx, Fn &&fn) const
+    {
+        const Triangle &tr = m_triangles[facet_idx];
+        if (! tr.valid())
+            return;
+        if (tr.is_split()) {
+            for (int i = 0; i <= tr.number_of_split_sides(); ++ i)
+                this->for_each_leaf_triangle(tr.children[i], fn);
+        } else
+            fn(tr);
+    }
+
+    // Facets of the original mesh changed since the last take_dirty_facets(), each one stored once.
+    std::vector<int>     m_dirty_facets;
+    std::vector<uint8_t> m_dirty_facets_mask;
+    // The whole mesh changed, m_dirty_facets is not maintained.
+    bool                 m_all_facets_dirty = true;
+
     // Private functions:
 private:
     bool select_triangle(int facet_idx, EnforcerBlockerType type, bool triangle_splitting);
+    void mark_facet_dirty(int source_facet);
     bool select_triangle_recursive(int facet_idx, const Vec3i &neighbors, EnforcerBlockerType type, bool triangle_splitting);
     void undivide_triangle(int facet_idx);
     void split_triangle(int facet_idx, const Vec3i &neighbors);
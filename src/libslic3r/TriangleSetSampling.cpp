@@ -1,12 +1,15 @@
 #include "TriangleSetSampling.hpp"
-#include <map>
-#include <random>
+#include <algorithm>
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
 
 namespace Slic3r {
 
 TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const indexed_triangle_set &triangle_set) {
+    return TriangleSetSampler(triangle_set).samples(samples_count);
+}
+
+TriangleSetSampler::TriangleSetSampler(const indexed_triangle_set &triangle_set) : m_triangle_set(triangle_set) {
     std::vector<double> triangles_area(triangle_set.indices.size());
 
     tbb::parallel_for(tbb::blocked_range<size_t>(0, triangle_set.indices.size()),
@@ -21,50 +24,62 @@ TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const index
                 }
             });
 
-    std::map<double, size_t> area_sum_to_triangle_idx;
-    float area_sum = 0;
+    m_area_sums.resize(triangles_area.size());
+    double area_sum = 0;
     for (size_t t_idx = 0; t_idx < triangles_area.size(); ++t_idx) {
         area_sum += triangles_area[t_idx];
-        area_sum_to_triangle_idx[area_sum] = t_idx;
+        m_area_sums[t_idx] = area_sum;
     }
+    m_samples.total_area = this->total_area();
+}
 
-    std::mt19937_64 mersenne_engine { 27644437 };
-    // random numbers on interval [0, 1)
-    std::uniform_real_distribution<double> fdistribution;
+TriangleSetSamples TriangleSetSampler::samples(size_t samples_count) {
+    std::scoped_lock<std::mutex> lock(m_mutex);
 
-    auto get_random = [&fdistribution, &mersenne_engine]() {
-        return Vec3d { fdistribution(mersenne_engine), fdistribution(mersenne_engine), fdistribution(mersenne_engine) };
-    };
+    if (m_area_sums.empty() || m_area_sums.back() <= 0.)
+        return { this->total_area(), {}, {}, {} };
 
-    std::vector<Vec3d> random_samples(samples_count);
-    std::generate(random_samples.begin(), random_samples.end(), get_random);
+    if (size_t first_new = m_samples.positions.size(); first_new < samples_count) {
+        // Extend the sequence, the random numbers are drawn sequentially to keep the samples independent of the requested counts.
+        // random numbers on interval [0, 1)
+        std::uniform_real_distribution<double> fdistribution;
+        std::vector<Vec3d> random_samples(samples_count - first_new);
+        for (Vec3d &random_sample : random_samples)
+            random_sample = Vec3d { fdistribution(m_mersenne_engine), fdistribution(m_mersenne_engine), fdistribution(m_mersenne_engine) };
 
-    TriangleSetSamples result;
-    result.total_area = area_sum;
-    result.positions.resize(samples_count);
-    result.normals.resize(samples_count);
-    result.triangle_indices.resize(samples_count);
+        m_samples.positions.resize(samples_count);
+        m_samples.normals.resize(samples_count);
+        m_samples.triangle_indices.resize(samples_count);
 
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, samples_count),
-            [&triangle_set, &area_sum_to_triangle_idx, &area_sum, &random_samples, &result](
-                    tbb::blocked_range<size_t> r) {
-                for (size_t s_idx = r.begin(); s_idx < r.end(); ++s_idx) {
-                    double t_sample = random_samples[s_idx].x() * area_sum;
-                    size_t t_idx = area_sum_to_triangle_idx.upper_bound(t_sample)->second;
+        tbb::parallel_for(tbb::blocked_range<size_t>(first_new, samples_count),
+                [this, first_new, &random_samples](
+                        tbb::blocked_range<size_t> r) {
+                    const double area_sum = m_area_sums.back();
+                    for (size_t s_idx = r.begin(); s_idx < r.end(); ++s_idx) {
+                        const Vec3d &random_sample = random_samples[s_idx - first_new];
+                        double t_sample = random_sample.x() * area_sum;
+                        // First triangle whose running area sum exceeds t_sample, thus never a zero area triangle.
+                        size_t t_idx = std::min<size_t>(std::upper_bound(m_area_sums.begin(), m_area_sums.end(), t_sample) - m_area_sums.begin(), m_area_sums.size() - 1);
 
-                    double sq_u = std::sqrt(random_samples[s_idx].y());
-                    double v = random_samples[s_idx].z();
+                        double sq_u = std::sqrt(random_sample.y());
+                        double v = random_sample.z();
 
-                    Vec3f A = triangle_set.vertices[triangle_set.indices[t_idx].x()];
-                    Vec3f B = triangle_set.vertices[triangle_set.indices[t_idx].y()];
-                    Vec3f C = triangle_set.vertices[triangle_set.indices[t_idx].z()];
+                        Vec3f A = m_triangle_set.vertices[m_triangle_set.indices[t_idx].x()];
+                        Vec3f B = m_triangle_set.vertices[m_triangle_set.indices[t_idx].y()];
+                        Vec3f C = m_triangle_set.vertices[m_triangle_set.indices[t_idx].z()];
 
-                    result.positions[s_idx] = A * (1 - sq_u) + B * (sq_u * (1 - v)) + C * (v * sq_u);
-                    result.normals[s_idx] = ((B - A).cross(C - B)).normalized();
-                    result.triangle_indices[s_idx] = t_idx;
-                }
-            });
+                        m_samples.positions[s_idx] = A * (1 - sq_u) + B * (sq_u * (1 - v)) + C * (v * sq_u);
+                        m_samples.normals[s_idx] = ((B - A).cross(C - B)).normalized();
+                        m_samples.triangle_indices[s_idx] = t_idx;
+                    }
+                });
+    }
 
+    TriangleSetSamples result;
+    result.total_area = m_samples.total_area;
+    result.positions.assign(m_samples.positions.begin(), m_samples.positions.begin() + samples_count);
+    result.normals.assign(m_samples.normals.begin(), m_samples.normals.begin() + samples_count);
+    result.triangle_indices.assign(m_samples.triangle_indices.begin(), m_samples.triangle_indices.begin() + samples_count);
     return result;
 }
 
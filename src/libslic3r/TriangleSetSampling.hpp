@@ -4,6 +4,9 @@
 #include <admesh/stl.h>
 #include "libslic3r/Point.hpp"
 
+#include <mutex>
+#include <random>
+
 namespace Slic3r {
 
 struct TriangleSetSamples {
@@ -15,6 +18,29 @@ struct TriangleSetSamples {
 
 TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const indexed_triangle_set &triangle_set);
 
+// Uniform samples of a triangle set, shared by the consumers asking for different sample counts.
+// The triangle areas are accumulated once, the samples form a single sequence, of which each request
+// gets a prefix, thus a smaller request returns a subset of a larger one and the sequence is only extended
+// when a larger count is requested.
+// The triangle set is referenced, the caller must make sure that it stays valid and unchanged.
+class TriangleSetSampler {
+public:
+    explicit TriangleSetSampler(const indexed_triangle_set &triangle_set);
+
+    float              total_area() const { return float(m_area_sums.empty() ? 0. : m_area_sums.back()); }
+    // Thread safe.
+    TriangleSetSamples samples(size_t samples_count);
+
+private:
+    const indexed_triangle_set &m_triangle_set;
+    // Running sum of the triangle areas.
+    std::vector<double>         m_area_sums;
+
+    std::mutex                  m_mutex;
+    std::mt19937_64             m_mersenne_engine { 27644437 };
+    TriangleSetSamples          m_samples;
+};
+
 }
 
 #endif /* SRC_LIBSLIC3R_TRIANGLESETSAMPLING_HPP_ */
@@ -180,7 +180,7 @@ void trace(unsigned int level, const char *message)
 
 void disable_multi_threading()
 {
-    // Disable parallelization so the Shiny profiler works
+    // Disable parallelization, for example to debug the slicing in a single thread
 #ifdef TBB_HAS_GLOBAL_CONTROL
     tbb::global_control(tbb::global_control::max_allowed_parallelism, 1);
 #else // TBB_HAS_GLOBAL_CONTROL
@@ -37,6 +37,8 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <tbb/task_arena.h>
+
 #include <boost/filesystem/operations.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -153,6 +155,7 @@ void GLIndexedVertexArray::load_mesh_full_shading(const TriangleMesh& mesh, bool
 void GLIndexedVertexArray::load_mesh_full_shading(const TriangleMesh& mesh)
 #endif // ENABLE_SMOOTH_NORMALS
 {
+    this->wait_loaded();
     assert(triangle_indices.empty() && vertices_and_normals_interleaved_size == 0);
     assert(quad_indices.empty() && triangle_indices_size == 0);
     assert(vertices_and_normals_interleaved.size() % 6 == 0 && quad_indices_size == vertices_and_normals_interleaved.size());
@@ -201,8 +204,28 @@ void GLIndexedVertexArray::load_its_flat_shading(const indexed_triangle_set &its
             %this %its.indices.size() %this->vertices_and_normals_interleaved.size() %this->triangle_indices.size() ;
 }
 
+// BBS: the meshes are loaded by the TBB workers, so that loading a large project does not start a thread per volume.
+// No slot is reserved for a master thread, the tasks are only enqueued and waited for through their futures.
+static tbb::task_arena& mesh_loading_arena()
+{
+    static tbb::task_arena arena(tbb::this_task_arena::max_concurrency(), 0);
+    return arena;
+}
+
+void GLIndexedVertexArray::load_mesh_async(std::shared_ptr<const TriangleMesh> mesh)
+{
+    this->wait_loaded();
+    assert(triangle_indices.empty() && vertices_and_normals_interleaved_size == 0);
+    assert(vertices_and_normals_interleaved_VBO_id == 0);
+    // The worker keeps the mesh alive, the destructor of this array waits for the worker through release_geometry().
+    auto task = std::make_shared<std::packaged_task<void()>>([this, mesh = std::move(mesh)]() { this->load_its_flat_shading(mesh->its); });
+    m_loading = task->get_future();
+    mesh_loading_arena().enqueue([task]() { (*task)(); });
+}
+
 void GLIndexedVertexArray::finalize_geometry(bool opengl_initialized)
 {
+    this->wait_loaded();
     assert(this->vertices_and_normals_interleaved_VBO_id == 0);
     assert(this->triangle_indices_VBO_id == 0);
     assert(this->quad_indices_VBO_id == 0);
@@ -239,6 +262,7 @@ void GLIndexedVertexArray::finalize_geometry(bool opengl_initialized)
 
 void GLIndexedVertexArray::release_geometry()
 {
+    this->wait_loaded();
     if (this->vertices_and_normals_interleaved_VBO_id) {
         glsafe(::glDeleteBuffers(1, &this->vertices_and_normals_interleaved_VBO_id));
         this->vertices_and_normals_interleaved_VBO_id = 0;
@@ -302,6 +326,9 @@ void GLIndexedVertexArray::render(
     const std::pair<size_t, size_t>& tverts_range,
     const std::pair<size_t, size_t>& qverts_range) const
 {
+    // The vertex data is still being built by load_mesh_async(), skip the volume until it is done.
+    if (this->is_loading())
+        return;
     if (0 == vertices_and_normals_interleaved_VBO_id) {
         if (!vertices_and_normals_interleaved.empty()) {
             BOOST_LOG_TRIVIAL(info) << boost::format("finalize_geometry");
@@ -652,9 +679,13 @@ bool GLVolume::simplify_mesh(const TriangleMesh &mesh, std::shared_ptr<GLIndexed
 }
 #define SUPER_LARGE_FACES 500000
 #define LARGE_FACES 100000
+// Meshes with fewer faces are loaded on the UI thread, starting a worker does not pay off.
+#define ASYNC_LOADING_FACES 20000
 bool GLVolume::simplify_mesh(const indexed_triangle_set &_its, std::shared_ptr<GLIndexedVertexArray> va, LOD_LEVEL lod) const
 {
     if (_its.indices.size() == 0 || _its.vertices.size() == 0) { return false; }
+    // The simplified mesh of a small mesh is thrown away below, do not copy it and start a worker for nothing.
+    if (_its.indices.size() < 200) { return false; }
     auto its = std::make_unique<indexed_triangle_set>(_its);
     auto m_state = std::make_unique<State>();
     if (lod == LOD_LEVEL::MIDDLE) {
@@ -695,8 +726,8 @@ bool GLVolume::simplify_mesh(const indexed_triangle_set &_its, std::shared_ptr<G
                 state->result.reset();
                 state->status = State::Status::running;
             }
-            int          init_face_count = its->indices.size();
-            TriangleMesh origin_mesh(*its);
+            int           init_face_count = its->indices.size();
+            BoundingBoxf3 origin_bbox     = bounding_box(*its);
             try { // Start the actual calculation.
                 its_quadric_edge_collapse(*its, triangle_count, &max_error, throw_on_cancel, statusfn);
             } catch (std::exception&) {
@@ -709,17 +740,18 @@ bool GLVolume::simplify_mesh(const indexed_triangle_set &_its, std::shared_ptr<G
             }
             if (state->result) {
                 int          end_face_count = (*state->result).indices.size();
-                if (init_face_count < 200 || (init_face_count < 1000 && end_face_count < init_face_count * 0.5)) {
+                if (init_face_count < 1000 && end_face_count < init_face_count * 0.5) {
                     return;
                 }
-                TriangleMesh mesh(*state->result);
-                float        eps        = 1.0f;
-                Vec3f        origin_min = origin_mesh.stats().min - Vec3f(eps, eps, eps);
-                Vec3f        origin_max = origin_mesh.stats().max + Vec3f(eps, eps, eps);
-                if (origin_min.x() < mesh.stats().min.x() && origin_min.y() < mesh.stats().min.y() && origin_min.z() < mesh.stats().min.z()&&
-                    origin_max.x() > mesh.stats().max.x() && origin_max.y() > mesh.stats().max.y() && origin_max.z() > mesh.stats().max.z()) {
+                BoundingBoxf3 bbox       = bounding_box(*state->result);
+                double        eps        = 1.0;
+                Vec3d         origin_min = origin_bbox.min - Vec3d(eps, eps, eps);
+                Vec3d         origin_max = origin_bbox.max + Vec3d(eps, eps, eps);
+                if (origin_min.x() < bbox.min.x() && origin_min.y() < bbox.min.y() && origin_min.z() < bbox.min.z()&&
+                    origin_max.x() > bbox.max.x() && origin_max.y() > bbox.max.y() && origin_max.z() > bbox.max.z()) {
                     if (va && va.use_count() >= 2) {
-                        va->load_mesh(mesh);
+                        // same as load_mesh() without building a TriangleMesh (and its stats) from the result
+                        va->load_its_flat_shading(*state->result);
                     }
                 }
                 else {
@@ -846,7 +878,7 @@ void GLVolume::render(const Transform3d& view_matrix, bool with_outline, const s
     if (this->is_left_handed())
         glFrontFace(GL_CW);
     glsafe(::glCullFace(GL_BACK));
-    auto camera = GUI::wxGetApp().plater()->get_camera();
+    const GUI::Camera &camera = GUI::wxGetApp().plater()->get_camera();
     auto zoom = camera.get_zoom();
     Transform3d               vier_mat      = camera.get_view_matrix();
     Matrix4d                  vier_proj_mat = camera.get_projection_matrix().matrix() * vier_mat.matrix();
@@ -1300,7 +1332,8 @@ int GLVolumeCollection::load_object_volume(
     bool 				 opengl_initialized,
     bool                 in_assemble_view,
     bool                 use_loaded_id,
-    bool                 lod_enabled)
+    bool                 lod_enabled,
+    bool                 async_mesh_loading)
 {
     const ModelVolume   *model_volume = model_object->volumes[volume_idx];
     const int            extruder_id  = model_volume->extruder_id();
@@ -1344,6 +1377,7 @@ int GLVolumeCollection::load_object_volume(
     if (need_create_mesh) {
 #if ENABLE_SMOOTH_NORMALS
         v.indexed_vertex_array->load_mesh(mesh, true);
+        v.indexed_vertex_array->finalize_geometry(opengl_initialized);
 #else
         if (lod_enabled) {
             if (v.indexed_vertex_array_middle == nullptr)
@@ -1360,9 +1394,14 @@ int GLVolumeCollection::load_object_volume(
             v.simplify_mesh(mesh, v.indexed_vertex_array_small, LOD_LEVEL::SMALL);
         }
 
-        v.indexed_vertex_array->load_mesh(mesh);
+        if (async_mesh_loading && opengl_initialized && mesh.its.indices.size() > ASYNC_LOADING_FACES)
+            // Sent to the GPU by the first render() after the worker is done.
+            v.indexed_vertex_array->load_mesh_async(model_volume->get_mesh_shared_ptr());
+        else {
+            v.indexed_vertex_array->load_mesh(mesh);
+            v.indexed_vertex_array->finalize_geometry(opengl_initialized);
+        }
 #endif // ENABLE_SMOOTH_NORMALS
-        v.indexed_vertex_array->finalize_geometry(opengl_initialized);
     }
     v.composite_id = GLVolume::CompositeID(obj_idx, volume_idx, instance_idx);
     if (model_volume->is_model_part())
@@ -1390,6 +1429,11 @@ int GLVolumeCollection::load_object_volume(
     return int(this->volumes.size() - 1);
 }
 
+bool GLVolumeCollection::has_loading_volumes() const
+{
+    return std::any_of(this->volumes.begin(), this->volumes.end(), [](const GLVolume *v) { return v->indexed_vertex_array->is_loading(); });
+}
+
 void GLVolumeCollection::clear()
 {
     for (auto* v : volumes)
@@ -1603,8 +1647,15 @@ GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCo
         );
     }
     else if (type == GLVolumeCollection::ERenderType::Opaque && list.size() > 1) {
+        // keep the instances sharing the same vertex buffers next to each other, so that consecutive draw calls reuse the bound buffers
         std::sort(list.begin(), list.end(),
-            [](const GLVolumeWithIdAndZ& v1, const GLVolumeWithIdAndZ& v2) -> bool { return v1.first->selected && !v2.first->selected; }
+            [](const GLVolumeWithIdAndZ& v1, const GLVolumeWithIdAndZ& v2) -> bool {
+                if (v1.first->selected != v2.first->selected)
+                    return v1.first->selected;
+                if (v1.first->indexed_vertex_array != v2.first->indexed_vertex_array)
+                    return v1.first->indexed_vertex_array < v2.first->indexed_vertex_array;
+                return v1.second.first < v2.second.first;
+            }
         );
     }
 
@@ -1632,6 +1683,11 @@ void GLVolumeCollection::render(GUI::ERenderPipelineStage             render_pip
                                 std::vector<double> *                 printable_heights) const
 {
     GLVolumeWithIdAndZList to_render = volumes_to_render(volumes, type, view_matrix, filter_func);
+    // cull the volumes outside of the view frustum before any per volume state is set up
+    const GUI::Camera &camera = GUI::wxGetApp().plater()->get_camera();
+    to_render.erase(std::remove_if(to_render.begin(), to_render.end(),
+        [&frustum = camera.getFrustum()](const GLVolumeWithIdAndZ &volume) { return ! frustum.intersects(volume.first->transformed_bounding_box()); }),
+        to_render.end());
     if (to_render.empty())
         return;
 
@@ -1652,12 +1708,38 @@ void GLVolumeCollection::render(GUI::ERenderPipelineStage             render_pip
         glsafe(::glEnable(GL_CULL_FACE));
     }
 
-    auto camera = GUI::wxGetApp().plater()->get_camera();
-    for (GLVolumeWithIdAndZ& volume : to_render) {
-        auto world_box = volume.first->transformed_bounding_box();
-        if (!camera.getFrustum().intersects(world_box)) {
-            continue;
+    // the same for all the volumes, looked up once instead of per draw call
+    bool  enable_support;
+    int   support_threshold_angle = get_selection_support_threshold_angle(enable_support);
+    float normal_z = -::cos(Geometry::deg2rad((float)support_threshold_angle));
+#if ENABLE_ENVIRONMENT_MAP
+    unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
+    bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get("use_environment_map") == "1";
+#endif // ENABLE_ENVIRONMENT_MAP
+
+    // the uniforms shared by all the volumes are only uploaded once, the program keeps them while the sinking contours are rendered by another shader
+    if (GUI::ERenderPipelineStage::Silhouette != render_pipeline_stage) {
+        shader->set_uniform("z_range", m_z_range, 2);
+        shader->set_uniform("clipping_plane", m_clipping_plane, 4);
+        if (printable_heights) {
+            std::array<float, 3> extruder_printable_heights;
+            if ((*printable_heights).size() > 0) {
+                extruder_printable_heights[0] = 2.0f;
+                extruder_printable_heights[1] = (*printable_heights)[0];
+                extruder_printable_heights[2] = (*printable_heights)[1];
+                shader->set_uniform("extruder_printable_heights", extruder_printable_heights);
+                shader->set_uniform("print_volume.xy_data", m_print_volume.data);
+            }
+            else {
+                extruder_printable_heights[0] = 0.0f;
+                shader->set_uniform("extruder_printable_heights", extruder_printable_heights);
+            }
         }
+        shader->set_uniform("slope.normal_z", normal_z);
+        shader->set_uniform("projection_matrix", projection_matrix);
+    }
+
+    for (GLVolumeWithIdAndZ& volume : to_render) {
 #if ENABLE_MODIFIERS_ALWAYS_TRANSPARENT
         if (type == ERenderType::Transparent) {
             volume.first->force_transparent = true;
@@ -1683,11 +1765,13 @@ void GLVolumeCollection::render(GUI::ERenderPipelineStage             render_pip
                 }
         }
 
+        // GLVolume::render() draws nothing for inactive volumes, skip setting up their uniforms
+        if (! volume.first->is_active)
+            continue;
+
         if (GUI::ERenderPipelineStage::Silhouette != render_pipeline_stage) {
             shader->set_uniform("is_text_shape", volume.first->is_text_shape);
             shader->set_uniform("uniform_color", volume.first->render_color);
-            shader->set_uniform("z_range", m_z_range, 2);
-            shader->set_uniform("clipping_plane", m_clipping_plane, 4);
             //BOOST_LOG_TRIVIAL(info) << boost::format("set uniform_color to {%1%, %2%, %3%, %4%}, with_outline=%5%, selected %6%")
             //    %volume.first->render_color[0]%volume.first->render_color[1]%volume.first->render_color[2]%volume.first->render_color[3]
             //    %with_outline%volume.first->selected;
@@ -1696,20 +1780,6 @@ void GLVolumeCollection::render(GUI::ERenderPipelineStage             render_pip
             //shader->set_uniform("print_volume.type", static_cast<int>(m_render_volume.type));
             //shader->set_uniform("print_volume.xy_data", m_render_volume.data);
             //shader->set_uniform("print_volume.z_data", m_render_volume.zs);
-            if (printable_heights) {
-                std::array<float, 3> extruder_printable_heights;
-                if ((*printable_heights).size() > 0) {
-                    extruder_printable_heights[0] = 2.0f;
-                    extruder_printable_heights[1] = (*printable_heights)[0];
-                    extruder_printable_heights[2] = (*printable_heights)[1];
-                    shader->set_uniform("extruder_printable_heights", extruder_printable_heights);
-                    shader->set_uniform("print_volume.xy_data", m_print_volume.data);
-                }
-                else {
-                    extruder_printable_heights[0] = 0.0f;
-                    shader->set_uniform("extruder_printable_heights", extruder_printable_heights);
-                }
-            }
             if (volume.first->partly_inside && partly_inside_enable) {
                 //only partly inside volume need to be painted with boundary check
                 shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
@@ -1723,19 +1793,11 @@ void GLVolumeCollection::render(GUI::ERenderPipelineStage             render_pip
                 shader->set_uniform("print_volume.type", -1);
             }
 
-            bool  enable_support;
-            int   support_threshold_angle = get_selection_support_threshold_angle(enable_support);
-
-            float normal_z = -::cos(Geometry::deg2rad((float)support_threshold_angle));
-
             shader->set_uniform("volume_world_matrix", volume.first->world_matrix());
             shader->set_uniform("slope.actived", m_slope.isGlobalActive && !volume.first->is_modifier && !volume.first->is_wipe_tower);
             shader->set_uniform("slope.volume_world_normal_matrix", static_cast<Matrix3f>(volume.first->world_matrix().matrix().block(0, 0, 3, 3).inverse().transpose().cast<float>()));
-            shader->set_uniform("slope.normal_z", normal_z);
 
 #if ENABLE_ENVIRONMENT_MAP
-            unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
-            bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get("use_environment_map") == "1";
             shader->set_uniform("use_environment_tex", use_environment_texture);
             if (use_environment_texture)
                 glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
@@ -1744,7 +1806,6 @@ void GLVolumeCollection::render(GUI::ERenderPipelineStage             render_pip
 
             const Transform3d matrix = view_matrix * volume.first->world_matrix();
             shader->set_uniform("view_model_matrix", matrix);
-            shader->set_uniform("projection_matrix", projection_matrix);
             shader->set_uniform("normal_matrix", (Matrix3d)matrix.matrix().block(0, 0, 3, 3).inverse().transpose());
 
             //BBS: add outline related logic
@@ -17,6 +17,8 @@
 #include <functional>
 #include <optional>
 #include <memory>
+#include <future>
+#include <chrono>
 
 #ifndef NDEBUG
 #define HAS_GLSAFE
@@ -160,6 +162,14 @@ public:
 
     void load_its_flat_shading(const indexed_triangle_set &its);
 
+    // Build the interleaved vertex data of the mesh on a worker thread, so that loading a large mesh does not block the UI.
+    // The data is sent to the GPU lazily by render() on the UI thread, nothing is rendered until the worker is done.
+    void load_mesh_async(std::shared_ptr<const TriangleMesh> mesh);
+    // Is the worker started by load_mesh_async() still building the vertex data?
+    bool is_loading() const { return m_loading.valid() && m_loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready; }
+    // Block until the worker started by load_mesh_async() is done.
+    void wait_loaded() { if (m_loading.valid()) m_loading.get(); }
+
     inline bool has_VBOs() const { return vertices_and_normals_interleaved_VBO_id != 0; }
 
     inline void reserve(size_t sz) {
@@ -236,6 +246,7 @@ public:
     bool empty() const { return vertices_and_normals_interleaved_size == 0; }
 
     void clear() {
+        this->wait_loaded();
         this->vertices_and_normals_interleaved.clear();
         this->triangle_indices.clear();
         this->quad_indices.clear();
@@ -272,6 +283,8 @@ public:
 
 private:
     BoundingBox m_bounding_box;
+    // Worker started by load_mesh_async(), waited for before the vertex data is touched on the UI thread.
+    std::future<void> m_loading;
 };
 enum LOD_LEVEL {
     HIGH, // Origin data
@@ -480,6 +493,9 @@ public:
 
     // Bounding box of this volume, in unscaled coordinates.
     BoundingBoxf3 bounding_box() const {
+        // The vertex data is still being built on a worker thread, the source mesh has the same bounding box.
+        if (this->ori_mesh != nullptr && this->indexed_vertex_array->is_loading())
+            return this->ori_mesh->bounding_box();
         BoundingBoxf3 out;
         if (! this->indexed_vertex_array->bounding_box().isEmpty()) {
             out.min = this->indexed_vertex_array->bounding_box().min().cast<double>();
@@ -579,7 +595,7 @@ public:
     // convex hull
     const TriangleMesh*  convex_hull() const { return m_convex_hull.get(); }
 
-    bool                empty() const { return this->indexed_vertex_array->empty(); }
+    bool                empty() const { return ! this->indexed_vertex_array->is_loading() && this->indexed_vertex_array->empty(); }
 
     void                set_range(double low, double high);
 
@@ -704,7 +720,9 @@ public:
         bool 			   opengl_initialized,
         bool               in_assemble_view = false,
         bool               use_loaded_id = false,
-        bool               lod_enabled = true);
+        bool               lod_enabled = true,
+        // Build the vertex data of large meshes on a worker thread, see GLIndexedVertexArray::load_mesh_async().
+        bool               async_mesh_loading = false);
 
     // Load SLA auxiliary GLVolumes (for support trees or pad).
     void load_object_auxiliary(
@@ -751,6 +769,8 @@ public:
     void release_volume (GLVolume* volume);
 
     bool empty() const { return volumes.empty(); }
+    // Is any mesh still being prepared by GLIndexedVertexArray::load_mesh_async()?
+    bool has_loading_volumes() const;
     void set_range(double low, double high) { for (GLVolume *vol : this->volumes) vol->set_range(low, high); }
 
     void set_print_volume(const PrintVolume& print_volume) { m_print_volume = print_volume; }
@@ -82,6 +82,13 @@ void AVVideoDecoder::close()
 {
 }
 
+// The gaussian filter costs several times as much as the bilinear one per output pixel, while the difference is not visible
+// on a live camera stream. Without scaling, only the pixel format is converted.
+int AVVideoDecoder::scale_flags(wxSize const &size) const
+{
+    return (size.GetWidth() == frame_->width && size.GetHeight() == frame_->height) ? SWS_POINT : SWS_BILINEAR;
+}
+
 bool AVVideoDecoder::toWxImage(wxImage &image, wxSize const &size2)
 {
     if (!got_frame_)
@@ -102,7 +109,7 @@ bool AVVideoDecoder::toWxImage(wxImage &image, wxSize const &size2)
     sws_ctx_   = sws_getCachedContext(sws_ctx_,
                                     frame_->width, frame_->height, AVPixelFormat(frame_->format),
                                     size1.GetWidth(), size1.GetHeight(), wxFmt,
-                                    SWS_GAUSS,
+                                    scale_flags(size1),
                                     nullptr, nullptr, nullptr);
     if (sws_ctx_ == nullptr)
         return false;
@@ -143,7 +150,7 @@ bool AVVideoDecoder::toWxBitmap(wxBitmap &bitmap, wxSize const &size2)
     sws_ctx_ = sws_getCachedContext(sws_ctx_,
                                     frame_->width, frame_->height, AVPixelFormat(frame_->format),
                                     size1.GetWidth(), size1.GetHeight(), wxFmt,
-                                    SWS_GAUSS,
+                                    scale_flags(size1),
                                     nullptr, nullptr, nullptr);
     if (sws_ctx_ == nullptr)
         return false;
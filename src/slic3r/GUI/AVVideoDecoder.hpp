@@ -34,6 +34,9 @@ public:
 
     bool toWxBitmap(wxBitmap &bitmap, wxSize const & size);
 
+private:
+    int  scale_flags(wxSize const &size) const;
+
 private:
     AVCodecContext *codec_ctx_ = nullptr;
     AVFrame *       frame_     = nullptr;
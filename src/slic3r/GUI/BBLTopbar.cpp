@@ -347,7 +347,7 @@ void BBLTopbar::OnSaveProject(wxAuiToolBarEvent& event)
 {
     MainFrame* main_frame = dynamic_cast<MainFrame*>(m_frame);
     Plater* plater = main_frame->plater();
-    plater->save_project();
+    plater->save_project_in_background();
 }
 
 void BBLTopbar::OnUndo(wxAuiToolBarEvent& event)
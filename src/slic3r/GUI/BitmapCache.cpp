@@ -5,6 +5,9 @@
 #include "GUI.hpp"
 #include "GUI_Utils.hpp"
 
+#include <memory>
+#include <mutex>
+
 #include <boost/filesystem.hpp>
 #include <boost/nowide/cstdio.hpp>
 
@@ -307,6 +310,37 @@ error:
     return NULL;
 }
 
+// BBS: the parsed SVG images do not depend on the rasterization size, thus they are shared by all the BitmapCache instances.
+// An icon requested in several sizes, in both the light and dark mode or after a DPI change is read and parsed just once.
+// Only the parses with a fixed set of replaces shall be cached, so that the cache is bounded by the number of icons:
+// an image recolored to an arbitrary color (filament colors for example) is parsed again and released after use.
+static std::shared_ptr<NSVGimage> parse_svg_cached(const std::string &filename, const std::map<std::string, std::string> &replaces, bool cache)
+{
+    auto parse = [&filename, &replaces]() {
+        NSVGimage *image = BitmapCache::nsvgParseFromFileWithReplace(filename.c_str(), "px", 96.0f, replaces);
+        return image == nullptr ? std::shared_ptr<NSVGimage>() : std::shared_ptr<NSVGimage>(image, ::nsvgDelete);
+    };
+    if (! cache)
+        return parse();
+
+    static std::mutex                                        mutex;
+    static std::map<std::string, std::shared_ptr<NSVGimage>> images;
+
+    std::string key = filename;
+    for (const auto &replace : replaces)
+        key += '\n' + replace.first + '\n' + replace.second;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = images.find(key);
+    if (it == images.end()) {
+        std::shared_ptr<NSVGimage> image = parse();
+        if (image == nullptr)
+            return nullptr;
+        it = images.emplace(std::move(key), std::move(image)).first;
+    }
+    return it->second;
+}
+
 wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_width, unsigned target_height, 
     const bool grayscale/* = false*/, const bool dark_mode/* = false*/, const std::string& new_color /*= ""*/, const float scale_in_center/* = 0*/)
 {
@@ -339,13 +373,13 @@ wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_
     if (!new_color.empty())
         replaces["\"#00AE42\""] = "\"" + new_color + "\"";
 
-     NSVGimage *image = nullptr;
+    std::shared_ptr<NSVGimage> image;
     if (strstr(bitmap_name.c_str(), "printer_thumbnail") == NULL) {
-        image =  nsvgParseFromFileWithReplace(Slic3r::var(bitmap_name + ".svg").c_str(), "px", 96.0f, replaces);
+        image = parse_svg_cached(Slic3r::var(bitmap_name + ".svg"), replaces, new_color.empty());
     }
     else {
         std::map<std::string, std::string> temp_replaces;
-        image =  nsvgParseFromFileWithReplace(Slic3r::var(bitmap_name + ".svg").c_str(), "px", 96.0f, temp_replaces);
+        image = parse_svg_cached(Slic3r::var(bitmap_name + ".svg"), temp_replaces, true);
     }
 
     if (image == nullptr)
@@ -363,27 +397,22 @@ wxBitmap* BitmapCache::load_svg(const std::string &bitmap_name, unsigned target_
     int   width    = (int)(svg_scale * image->width + 0.5f);
     int   height   = (int)(svg_scale * image->height + 0.5f);
     int   n_pixels = width * height;
-    if (n_pixels <= 0) {
-        ::nsvgDelete(image);
+    if (n_pixels <= 0)
         return nullptr;
-    }
 
     NSVGrasterizer *rast = ::nsvgCreateRasterizer();
-    if (rast == nullptr) {
-        ::nsvgDelete(image);
+    if (rast == nullptr)
         return nullptr;
-    }
 
     std::vector<unsigned char> data(n_pixels * 4, 0);
     // BBS: support resize by fill border
     if (scale_in_center > 0 && scale_in_center < svg_scale) {
         int w = (int)(image->width * scale_in_center);
         int h = (int)(image->height * scale_in_center);
-        ::nsvgRasterize(rast, image, 0, 0, scale_in_center, data.data() + int(height - h) / 2 * width * 4 + int(width - w) / 2 * 4, w, h, width * 4);
+        ::nsvgRasterize(rast, image.get(), 0, 0, scale_in_center, data.data() + int(height - h) / 2 * width * 4 + int(width - w) / 2 * 4, w, h, width * 4);
     } else
-        ::nsvgRasterize(rast, image, 0, 0, svg_scale, data.data(), width, height, width * 4);
+        ::nsvgRasterize(rast, image.get(), 0, 0, svg_scale, data.data(), width, height, width * 4);
     ::nsvgDeleteRasterizer(rast);
-    ::nsvgDelete(image);
 
     return this->insert_raw_rgba(bitmap_key, width, height, data.data(), grayscale);
 }
@@ -399,8 +428,7 @@ wxBitmap* BitmapCache::load_svg2(const std::string& bitmap_name, unsigned target
     }
     
 
-    NSVGimage* image = nullptr;
-    image = nsvgParseFromFileWithReplace(Slic3r::var(bitmap_name + ".svg").c_str(), "px", 96.0f, replaces);
+    std::shared_ptr<NSVGimage> image = parse_svg_cached(Slic3r::var(bitmap_name + ".svg"), replaces, replaces.empty());
 
     if (image == nullptr)
         return nullptr;
@@ -417,28 +445,23 @@ wxBitmap* BitmapCache::load_svg2(const std::string& bitmap_name, unsigned target
     int   width = (int)(svg_scale * image->width + 0.5f);
     int   height = (int)(svg_scale * image->height + 0.5f);
     int   n_pixels = width * height;
-    if (n_pixels <= 0) {
-        ::nsvgDelete(image);
+    if (n_pixels <= 0)
         return nullptr;
-    }
 
     NSVGrasterizer* rast = ::nsvgCreateRasterizer();
-    if (rast == nullptr) {
-        ::nsvgDelete(image);
+    if (rast == nullptr)
         return nullptr;
-    }
 
     std::vector<unsigned char> data(n_pixels * 4, 0);
     // BBS: support resize by fill border
     if (scale_in_center > 0 && scale_in_center < svg_scale) {
         int w = (int)(image->width * scale_in_center);
         int h = (int)(image->height * scale_in_center);
-        ::nsvgRasterize(rast, image, 0, 0, scale_in_center, data.data() + int(height - h) / 2 * width * 4 + int(width - w) / 2 * 4, w, h, width * 4);
+        ::nsvgRasterize(rast, image.get(), 0, 0, scale_in_center, data.data() + int(height - h) / 2 * width * 4 + int(width - w) / 2 * 4, w, h, width * 4);
     }
     else
-        ::nsvgRasterize(rast, image, 0, 0, svg_scale, data.data(), width, height, width * 4);
+        ::nsvgRasterize(rast, image.get(), 0, 0, svg_scale, data.data(), width, height, width * 4);
     ::nsvgDeleteRasterizer(rast);
-    ::nsvgDelete(image);
 
     const unsigned char * raw_data = data.data();
     wxImage wx_image(width, height);
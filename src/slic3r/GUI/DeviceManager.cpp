@@ -3168,7 +3168,7 @@ static ENUM enum_index_of(char const *key, char const **enum_names, int enum_cou
     return defl;
 }
 
-int MachineObject::parse_json(std::string payload, bool key_field_only)
+int MachineObject::parse_json(const std::string &payload, bool key_field_only)
 {
     parse_msg_count++;
     std::chrono::system_clock::time_point clock_start = std::chrono::system_clock::now();
@@ -3188,16 +3188,18 @@ int MachineObject::parse_json(std::string payload, bool key_field_only)
     }
     catch(...) {
         parse_ok = false;
-        /* post process payload */
-        sanitizeToUtf8(payload);
         BOOST_LOG_TRIVIAL(info) << "parse_json: sanitize to utf8";
     }
 
     try {
         bool restored_json = false;
         json j;
-        if (!parse_ok)
-            j_pre = json::parse(payload);
+        if (!parse_ok) {
+            /* post process payload, only copy it when it is malformed */
+            std::string sanitized_payload = payload;
+            sanitizeToUtf8(sanitized_payload);
+            j_pre = json::parse(sanitized_payload);
+        }
         CNumericLocalesSetter locales_setter;
         if (j_pre.empty()) {
             return 0;
@@ -3259,7 +3261,7 @@ int MachineObject::parse_json(std::string payload, bool key_field_only)
             }
         }
         if (!restored_json) {
-            j = j_pre;
+            j = std::move(j_pre);
         }
 
         uint64_t t_utc = j.value("t_utc", 0ULL);
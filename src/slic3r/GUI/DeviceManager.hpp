@@ -1292,7 +1292,7 @@ public:
     int publish_json(std::string json_str, int qos = 0, int flag = 0);
     int cloud_publish_json(std::string json_str, int qos = 0, int flag = 0);
     int local_publish_json(std::string json_str, int qos = 0, int flag = 0);
-    int parse_json(std::string payload, bool key_filed_only = false);
+    int parse_json(const std::string &payload, bool key_filed_only = false);
     int publish_gcode(std::string gcode_str);
 
     std::string setting_id_to_type(std::string setting_id, std::string tray_type);
@@ -784,6 +784,7 @@ void TextCtrl::propagate_value()
 
 void TextCtrl::set_value(const boost::any& value, bool change_event/* = false*/) {
     m_disable_change_event = !change_event;
+    m_reloaded_value.clear();
     if (m_opt.nullable) {
         const bool m_is_na_val = value.empty() || (boost::any_cast<wxString>(value) == na_value());
         if (!m_is_na_val)
@@ -915,6 +916,7 @@ void CheckBox::BUILD() {
 void CheckBox::set_value(const bool value, bool change_event)
 {
 	m_disable_change_event = !change_event;
+	m_reloaded_value.clear();
     dynamic_cast<::CheckBox *>(window)->SetValue(value); // BBS
 	m_disable_change_event = false;
 }
@@ -922,6 +924,7 @@ void CheckBox::set_value(const bool value, bool change_event)
 void CheckBox::set_value(const boost::any& value, bool change_event)
 {
     m_disable_change_event = !change_event;
+    m_reloaded_value.clear();
     if (m_opt.nullable) {
         m_is_na_val = value.empty() || boost::any_cast<unsigned char>(value) == ConfigOptionBoolsNullable::nil_value();
         if (!m_is_na_val)
@@ -1127,6 +1130,7 @@ void SpinCtrl::propagate_value()
 
 void SpinCtrl::set_value(const boost::any& value, bool change_event) {
     m_disable_change_event = !change_event;
+    m_reloaded_value.clear();
     m_value = value;
     if (value.empty()) { // BBS: null value
         dynamic_cast<SpinInput*>(window)->SetValue(m_opt.min);
@@ -1389,6 +1393,7 @@ void Choice::set_selection()
 void Choice::set_value(const std::string& value, bool change_event)  //! Redundant?
 {
     m_disable_change_event = !change_event;
+    m_reloaded_value.clear();
 
 	size_t idx=0;
 	for (auto el : m_opt.enum_values)
@@ -1409,6 +1414,7 @@ void Choice::set_value(const std::string& value, bool change_event)  //! Redunda
 void Choice::set_value(const boost::any& value, bool change_event)
 {
 	m_disable_change_event = !change_event;
+	m_reloaded_value.clear();
 
     choice_ctrl* field = dynamic_cast<choice_ctrl*>(window);
 
@@ -1740,6 +1746,7 @@ void ColourPicker::set_undef_value(wxColourPickerCtrl* field)
 void ColourPicker::set_value(const boost::any& value, bool change_event)
 {
     m_disable_change_event = !change_event;
+    m_reloaded_value.clear();
     const wxString clr_str(boost::any_cast<wxString>(value));
     auto field = dynamic_cast<wxColourPickerCtrl*>(window);
 
@@ -1940,6 +1947,7 @@ void PointCtrl::propagate_value(wxTextCtrl* win)
 void PointCtrl::set_value(const Vec2d& value, bool change_event)
 {
 	m_disable_change_event = !change_event;
+	m_reloaded_value.clear();
 
 	double val = value(0);
 	x_textctrl->SetValue(val - int(val) == 0 ? wxString::Format(_T("%i"), int(val)) : wxNumberFormatter::ToString(val, 2, wxNumberFormatter::Style_None));
@@ -2080,6 +2088,7 @@ void SliderCtrl::BUILD()
 void SliderCtrl::set_value(const boost::any& value, bool change_event)
 {
 	m_disable_change_event = !change_event;
+	m_reloaded_value.clear();
 
 	m_slider->SetValue(boost::any_cast<int>(value)*m_scale);
 	int val = boost::any_cast<int>(get_value());
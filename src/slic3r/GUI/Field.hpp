@@ -90,6 +90,9 @@ public:
     bool			m_disable_change_event {false};
     bool			m_is_modified_value {false};
 	bool			m_is_nonsys_value {true};
+	// Serialized config value ConfigOptionsGroup::reload_config() last set the field to.
+	// Cleared by every set_value(), so that the next reload refreshes a field set by any other path.
+	std::string		m_reloaded_value;
 
     /// Copy of ConfigOption for deduction purposes
     const ConfigOptionDef			m_opt {ConfigOptionDef()};
@@ -259,6 +262,7 @@ public:
 
     void	set_value(const std::string& value, bool change_event = false) {
 		m_disable_change_event = !change_event;
+		m_reloaded_value.clear();
         dynamic_cast<wxTextCtrl*>(window)->SetValue(wxString(value));
 		m_disable_change_event = false;
     }
@@ -320,6 +324,7 @@ public:
 
     void			set_value(const std::string& value, bool change_event = false) {
 		m_disable_change_event = !change_event;
+		m_reloaded_value.clear();
 		dynamic_cast<SpinInput*>(window)->SetValue(value);
 		m_disable_change_event = false;
     }
@@ -414,6 +419,7 @@ public:
 
 	void			set_value(const std::string& value, bool change_event = false) {
 		m_disable_change_event = !change_event;
+		m_reloaded_value.clear();
 		dynamic_cast<wxColourPickerCtrl*>(window)->SetColour(value);
 		m_disable_change_event = false;
 	 	}
@@ -479,11 +485,13 @@ public:
 
 	void			set_value(const std::string& value, bool change_event = false) {
 		m_disable_change_event = !change_event;
+		m_reloaded_value.clear();
 		dynamic_cast<wxStaticText*>(window)->SetLabel(wxString::FromUTF8(value.data()));
 		m_disable_change_event = false;
 	}
 	void			set_value(const boost::any& value, bool change_event = false) override {
 		m_disable_change_event = !change_event;
+		m_reloaded_value.clear();
 		dynamic_cast<wxStaticText*>(window)->SetLabel(boost::any_cast<wxString>(value));
 		m_disable_change_event = false;
 	}
@@ -33,6 +33,7 @@
 #include <GL/glew.h>
 #include <boost/log/trivial.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <tbb/parallel_for.h>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <wx/progdlg.h>
@@ -41,6 +42,7 @@
 #include <array>
 #include <algorithm>
 #include <chrono>
+#include <string_view>
 
 namespace Slic3r {
 namespace GUI {
@@ -542,6 +544,8 @@ void GCodeViewer::SequentialView::GCodeWindow::load_gcode(const std::string& fil
 
     m_selected_line_id = 0;
     m_last_lines_size = 0;
+    m_lines_start_id = 0;
+    m_lines.clear();
 
     try
     {
@@ -559,37 +563,49 @@ void GCodeViewer::SequentialView::GCodeWindow::load_gcode(const std::string& fil
 void GCodeViewer::SequentialView::GCodeWindow::render(float top, float bottom, float right, uint64_t curr_line_id) const
 //void GCodeViewer::SequentialView::GCodeWindow::render(float top, float bottom, uint64_t curr_line_id) const
 {
-    auto update_lines = [this](uint64_t start_id, uint64_t end_id) {
+    auto parse_line = [this](uint64_t id) {
+        // read line from file
+        const size_t start = id == 1 ? 0 : m_lines_ends[id - 2];
+        const size_t len   = m_lines_ends[id - 1] - start;
+        std::string_view gline(m_file.data() + start, len);
+        while (!gline.empty() && (gline.back() == '\n' || gline.back() == '\r'))
+            gline.remove_suffix(1);
+
+        Line line;
+        // extract comment
+        const size_t comment_pos = gline.find(';');
+        if (comment_pos != std::string_view::npos) {
+            line.comment = std::string(gline.substr(comment_pos));
+            gline = gline.substr(0, comment_pos);
+        }
+
+        // extract gcode command and parameters, collapsing runs of spaces
+        const size_t command_end = std::min(gline.find(' '), gline.size());
+        line.command = std::string(gline.substr(0, command_end));
+        for (size_t i = command_end; i < gline.size();) {
+            const size_t word_start = gline.find_first_not_of(' ', i);
+            if (word_start == std::string_view::npos)
+                break;
+            const size_t word_end = std::min(gline.find(' ', word_start), gline.size());
+            line.parameters += ' ';
+            line.parameters.append(gline.data() + word_start, word_end - word_start);
+            i = word_end;
+        }
+        return line;
+    };
+
+    // lines already parsed for the previous window are moved over, only the newly exposed ones are read from file
+    auto update_lines = [this, &parse_line](uint64_t start_id, uint64_t end_id) {
+        std::vector<Line> &old_lines = *const_cast<std::vector<Line>*>(&m_lines);
+        const uint64_t old_start_id = m_lines_start_id;
+        const uint64_t old_end_id   = old_start_id + old_lines.size();
         std::vector<Line> ret;
         ret.reserve(end_id - start_id + 1);
         for (uint64_t id = start_id; id <= end_id; ++id) {
-            // read line from file
-            const size_t start = id == 1 ? 0 : m_lines_ends[id - 2];
-            const size_t len   = m_lines_ends[id - 1] - start;
-            std::string gline(m_file.data() + start, len);
-
-            std::string command;
-            std::string parameters;
-            std::string comment;
-
-            // extract comment
-            std::vector<std::string> tokens;
-            boost::split(tokens, gline, boost::is_any_of(";"), boost::token_compress_on);
-            command = tokens.front();
-            if (tokens.size() > 1)
-                comment = ";" + tokens.back();
-
-            // extract gcode command and parameters
-            if (!command.empty()) {
-                boost::split(tokens, command, boost::is_any_of(" "), boost::token_compress_on);
-                command = tokens.front();
-                if (tokens.size() > 1) {
-                    for (size_t i = 1; i < tokens.size(); ++i) {
-                        parameters += " " + tokens[i];
-                    }
-                }
-            }
-            ret.push_back({ command, parameters, comment });
+            if (old_start_id <= id && id < old_end_id)
+                ret.push_back(std::move(old_lines[id - old_start_id]));
+            else
+                ret.push_back(parse_line(id));
         }
         return ret;
     };
@@ -628,9 +644,11 @@ void GCodeViewer::SequentialView::GCodeWindow::render(float top, float bottom, f
         try
         {
             *const_cast<std::vector<Line>*>(&m_lines) = update_lines(start_id, end_id);
+            *const_cast<uint64_t*>(&m_lines_start_id) = start_id;
         }
         catch (...)
         {
+            const_cast<std::vector<Line>*>(&m_lines)->clear();
             BOOST_LOG_TRIVIAL(error) << "Error while loading from file " << m_filename << ". Cannot show G-code window.";
             return;
         }
@@ -1007,6 +1025,7 @@ void GCodeViewer::load(const GCodeProcessorResult& gcode_result, const Print& pr
 
     //BBS: add logs
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": gcode result %1%, new id %2%, gcode file %3% ") % (&gcode_result) % m_last_result_id % gcode_result.filename;
+    SlicingProfiler::Scope profile(print.slicing_profiler(), "gcode_viewer_load");
 
     // release gpu memory, if used
     reset();
@@ -1869,7 +1888,7 @@ void GCodeViewer::update_layers_slider_mode()
 
 void GCodeViewer::update_marker_curr_move() {
     if ((int)m_last_result_id != -1) {
-        auto it = std::find_if(m_gcode_result->moves.begin(), m_gcode_result->moves.end(), [this](auto move) {
+        auto it = std::find_if(m_gcode_result->moves.begin(), m_gcode_result->moves.end(), [this](const GCodeProcessorResult::MoveVertex &move) {
                 if (m_sequential_view.current.last < m_sequential_view.gcode_ids.size() && m_sequential_view.current.last >= 0) {
                     return move.gcode_id == static_cast<uint64_t>(m_sequential_view.gcode_ids[m_sequential_view.current.last]);
                 }
@@ -2131,7 +2150,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
     };
 
     // format data into the buffers to be rendered as lines
-    auto add_vertices_as_line = [](const GCodeProcessorResult::MoveVertex& prev, const GCodeProcessorResult::MoveVertex& curr, VertexBuffer& vertices) {
+    auto add_vertices_as_line = [&gcode_result](const GCodeProcessorResult::MoveVertex& prev, const GCodeProcessorResult::MoveVertex& curr, VertexBuffer& vertices) {
         auto add_vertex = [&vertices](const Vec3f& position, const Vec3f& normal) {
             // add position
             vertices.push_back(position.x());
@@ -2144,10 +2163,10 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         };
         // x component of the normal to the current segment (the normal is parallel to the XY plane)
         //BBS: Has modified a lot for this function to support arc move
-        size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points.size() : 0;
+        size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count : 0;
         for (size_t i = 0; i < loop_num + 1; i++) {
-            const Vec3f &previous = (i == 0? prev.position : curr.interpolation_points[i-1]);
-            const Vec3f &current = (i == loop_num? curr.position : curr.interpolation_points[i]);
+            const Vec3f &previous = (i == 0? prev.position : gcode_result.interpolation_points(curr)[i-1]);
+            const Vec3f &current = (i == loop_num? curr.position : gcode_result.interpolation_points(curr)[i]);
             const Vec3f dir = (current - previous).normalized();
             Vec3f normal(dir.y(), -dir.x(), 0.0);
             normal.normalize();
@@ -2167,7 +2186,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
             }
 
             Path& last_path = buffer.paths.back();
-            size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points.size() : 0;
+            size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count : 0;
             for (size_t i = 0; i < loop_num + 1; i++) {
                 //BBS: add previous index
                 indices.push_back(static_cast<IBufferType>(indices.size()));
@@ -2179,16 +2198,10 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
     };
 
     // format data into the buffers to be rendered as solid.
-    auto add_vertices_as_solid = [](const GCodeProcessorResult::MoveVertex& prev, const GCodeProcessorResult::MoveVertex& curr, TBuffer& buffer, unsigned int vbuffer_id, VertexBuffer& vertices, size_t move_id) {
+    auto add_vertices_as_solid = [&gcode_result](const GCodeProcessorResult::MoveVertex& prev, const GCodeProcessorResult::MoveVertex& curr, TBuffer& buffer, unsigned int vbuffer_id, VertexBuffer& vertices, size_t move_id) {
         auto store_vertex = [](VertexBuffer& vertices, const Vec3f& position, const Vec3f& normal) {
-            // append position
-            vertices.push_back(position.x());
-            vertices.push_back(position.y());
-            vertices.push_back(position.z());
-            // append normal
-            vertices.push_back(normal.x());
-            vertices.push_back(normal.y());
-            vertices.push_back(normal.z());
+            // append position and normal with a single insertion
+            vertices.insert(vertices.end(), { position.x(), position.y(), position.z(), normal.x(), normal.y(), normal.z() });
         };
 
         if (buffer.paths.empty() || prev.type != curr.type || !buffer.paths.back().matches(curr)) {
@@ -2198,10 +2211,10 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
 
         Path& last_path = buffer.paths.back();
         //BBS: Has modified a lot for this function to support arc move
-        size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points.size() : 0;
+        size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count : 0;
         for (size_t i = 0; i < loop_num + 1; i++) {
-            const Vec3f &prev_position = (i == 0? prev.position : curr.interpolation_points[i-1]);
-            const Vec3f &curr_position = (i == loop_num? curr.position : curr.interpolation_points[i]);
+            const Vec3f &prev_position = (i == 0? prev.position : gcode_result.interpolation_points(curr)[i-1]);
+            const Vec3f &curr_position = (i == loop_num? curr.position : gcode_result.interpolation_points(curr)[i]);
 
             const Vec3f dir = (curr_position - prev_position).normalized();
             const Vec3f right = Vec3f(dir.y(), -dir.x(), 0.0f).normalized();
@@ -2292,10 +2305,10 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
             std::array<IBufferType, 8> first_seg_v_offsets = convert_vertices_offset(vbuffer_size, { 0, 1, 2, 3, 4, 5, 6, 7 });
             std::array<IBufferType, 8> non_first_seg_v_offsets = convert_vertices_offset(vbuffer_size, { -4, 0, -2, 1, 2, 3, 4, 5 });
 
-            size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points.size() : 0;
+            size_t loop_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count : 0;
             for (size_t i = 0; i < loop_num + 1; i++) {
-                const Vec3f &prev_position = (i == 0? prev.position : curr.interpolation_points[i-1]);
-                const Vec3f &curr_position = (i == loop_num? curr.position : curr.interpolation_points[i]);
+                const Vec3f &prev_position = (i == 0? prev.position : gcode_result.interpolation_points(curr)[i-1]);
+                const Vec3f &curr_position = (i == loop_num? curr.position : gcode_result.interpolation_points(curr)[i]);
 
                 const Vec3f dir = (curr_position - prev_position).normalized();
                 const Vec3f right = Vec3f(dir.y(), -dir.x(), 0.0f).normalized();
@@ -2480,14 +2493,14 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
 
         //if (wxGetApp().is_gcode_viewer())
         //if (m_only_gcode_in_preview)
-        //    for (int i = 0; i < move.interpolation_points.size(); i++)
-        //        m_paths_bounding_box.merge(move.interpolation_points[i].cast<double>());
+        //    for (int i = 0; i < move.interpolation_points_count; i++)
+        //        m_paths_bounding_box.merge(gcode_result.interpolation_points(move)[i].cast<double>());
         //else {
             if (move.type == EMoveType::Extrude && move.width != 0.0f && move.height != 0.0f)
-                for (int i = 0; i < move.interpolation_points.size(); i++) {
-                    m_paths_bounding_box.merge(move.interpolation_points[i].cast<double>());
+                for (int i = 0; i < move.interpolation_points_count; i++) {
+                    m_paths_bounding_box.merge(gcode_result.interpolation_points(move)[i].cast<double>());
                     //BBS: use convex_hull for toolpath outside check
-                    pts.emplace_back(Point(scale_(move.interpolation_points[i].x()), scale_(move.interpolation_points[i].y())));
+                    pts.emplace_back(Point(scale_(gcode_result.interpolation_points(move)[i].x()), scale_(gcode_result.interpolation_points(move)[i].y())));
                 }
         //}
     }
@@ -2533,6 +2546,8 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
     }
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__<< boost::format(",m_contained_in_bed %1%\n")%m_contained_in_bed;
 
+    apply_toolpaths_memory_budget(gcode_result);
+
     std::vector<MultiVertexBuffer> vertices(m_buffers.size());
     std::vector<MultiIndexBuffer> indices(m_buffers.size());
     std::vector<InstanceBuffer> instances(m_buffers.size());
@@ -2587,7 +2602,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         // if adding the vertices for the current segment exceeds the threshold size of the current vertex buffer
         // add another vertex buffer
         // BBS: get the point number and then judge whether the remaining buffer is enough
-        size_t points_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points.size() + 1 : 1;
+        size_t points_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count + 1 : 1;
         size_t vertices_size_to_add = (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) ? t_buffer.model.data.vertices_size_bytes() : points_num * t_buffer.max_vertices_per_segment_size_bytes();
         if (v_multibuffer.back().size() * sizeof(float) > t_buffer.vertices.max_size_bytes() - vertices_size_to_add) {
             v_multibuffer.push_back(VertexBuffer());
@@ -2652,10 +2667,11 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         return (new_id == size_t(-1)) ? id : new_id;
     };
     //BBS: generate map from ssid to move id in advance to reduce computation
-    m_ssid_to_moveid_map.clear();
-    m_ssid_to_moveid_map.reserve( m_moves_count - biased_seams_ids.size());
-    for (size_t i = 0; i < m_moves_count - biased_seams_ids.size(); i++)
-        m_ssid_to_moveid_map.push_back(extract_move_id(i));
+    m_ssid_to_moveid_map.assign(m_moves_count - biased_seams_ids.size(), 0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_ssid_to_moveid_map.size()), [this, &extract_move_id](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+            m_ssid_to_moveid_map[i] = extract_move_id(i);
+    });
 
     //BBS: smooth toolpaths corners for the given TBuffer using triangles
     auto smooth_triangle_toolpaths_corners = [&gcode_result, this](const TBuffer& t_buffer, MultiVertexBuffer& v_multibuffer) {
@@ -2675,11 +2691,11 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
                 size_t temp_offset = prev_sub_path.last.s_id - curr_s_id;
                 for (size_t i = prev_sub_path.last.s_id; i > curr_s_id; i--) {
                     size_t move_id = m_ssid_to_moveid_map[i];
-                    temp_offset += (gcode_result.moves[move_id].is_arc_move() ? gcode_result.moves[move_id].interpolation_points.size() : 0);
+                    temp_offset += (gcode_result.moves[move_id].is_arc_move() ? gcode_result.moves[move_id].interpolation_points_count : 0);
                 }
                 if (is_internal_point) {
                     size_t move_id = m_ssid_to_moveid_map[curr_s_id];
-                    temp_offset += (gcode_result.moves[move_id].interpolation_points.size() - interpolation_point_id);
+                    temp_offset += (gcode_result.moves[move_id].interpolation_points_count - interpolation_point_id);
                 }
                 const size_t next_1st_offset = temp_offset * 6 * vertex_size_floats;
                 // offset into the vertex buffer of the right vertex of the previous segment
@@ -2717,11 +2733,11 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
                 size_t temp_offset = prev_sub_path.last.s_id - curr_s_id;
                 for (size_t i = prev_sub_path.last.s_id; i > curr_s_id; i--) {
                     size_t move_id = m_ssid_to_moveid_map[i];
-                    temp_offset += (gcode_result.moves[move_id].is_arc_move() ? gcode_result.moves[move_id].interpolation_points.size() : 0);
+                    temp_offset += (gcode_result.moves[move_id].is_arc_move() ? gcode_result.moves[move_id].interpolation_points_count : 0);
                 }
                 if (is_internal_point) {
                     size_t move_id = m_ssid_to_moveid_map[curr_s_id];
-                    temp_offset += (gcode_result.moves[move_id].interpolation_points.size() - interpolation_point_id);
+                    temp_offset += (gcode_result.moves[move_id].interpolation_points_count - interpolation_point_id);
                 }
                 const size_t next_1st_offset = temp_offset * 6 * vertex_size_floats;
                 // offset into the vertex buffer of the left vertex of the previous segment
@@ -2752,94 +2768,98 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         };
 
         size_t vertex_size_floats = t_buffer.vertices.vertex_size_floats();
-        for (const Path& path : t_buffer.paths) {
-            //BBS: the two segments of the path sharing the current vertex may belong
-            //to two different vertex buffers
-            size_t prev_sub_path_id = 0;
-            size_t next_sub_path_id = 0;
-            const size_t path_vertices_count = path.vertices_count();
-            const float half_width = 0.5f * path.width;
-            // BBS: modify a lot to support arc move which has internal points
-            for (size_t j = 1; j < path_vertices_count; ++j) {
-                size_t curr_s_id = path.sub_paths.front().first.s_id + j;
-                size_t move_id = m_ssid_to_moveid_map[curr_s_id];
-                int interpolation_points_num = gcode_result.moves[move_id].is_arc_move_with_interpolation_points()?
-                                                    gcode_result.moves[move_id].interpolation_points.size() : 0;
-                int loop_num = interpolation_points_num;
-                //BBS: select the subpaths which contains the previous/next segments
-                if (!path.sub_paths[prev_sub_path_id].contains(curr_s_id))
-                    ++prev_sub_path_id;
-                if (j == path_vertices_count - 1) {
-                    if (!gcode_result.moves[move_id].is_arc_move_with_interpolation_points())
-                        break;   // BBS: the last move has no internal point.
-                    loop_num--;  //BBS: don't need to handle the endpoint of the last arc move of path
-                    next_sub_path_id = prev_sub_path_id;
-                } else {
-                    if (!path.sub_paths[next_sub_path_id].contains(curr_s_id + 1))
-                        ++next_sub_path_id;
-                }
-                const Path::Sub_Path& prev_sub_path = path.sub_paths[prev_sub_path_id];
-                const Path::Sub_Path& next_sub_path = path.sub_paths[next_sub_path_id];
-
-                // BBS: smooth triangle toolpaths corners including arc move which has internal interpolation point
-                for (int k = 0; k <= loop_num; k++) {
-                    const Vec3f& prev = k==0?
-                                        gcode_result.moves[move_id - 1].position :
-                                        gcode_result.moves[move_id].interpolation_points[k-1];
-                    const Vec3f& curr = k==interpolation_points_num?
-                                        gcode_result.moves[move_id].position :
-                                        gcode_result.moves[move_id].interpolation_points[k];
-                    const Vec3f& next = k < interpolation_points_num - 1?
-                                        gcode_result.moves[move_id].interpolation_points[k+1]:
-                                        (k == interpolation_points_num - 1? gcode_result.moves[move_id].position :
-                                        (gcode_result.moves[move_id + 1].is_arc_move_with_interpolation_points()?
-                                        gcode_result.moves[move_id + 1].interpolation_points[0] :
-                                        gcode_result.moves[move_id + 1].position));
-
-                    const Vec3f prev_dir = (curr - prev).normalized();
-                    const Vec3f prev_right = Vec3f(prev_dir.y(), -prev_dir.x(), 0.0f).normalized();
-                    const Vec3f prev_up = prev_right.cross(prev_dir);
-
-                    const Vec3f next_dir = (next - curr).normalized();
-
-                    const bool is_right_turn = prev_up.dot(prev_dir.cross(next_dir)) <= 0.0f;
-                    const float cos_dir = prev_dir.dot(next_dir);
-                    // whether the angle between adjacent segments is greater than 45 degrees
-                    const bool is_sharp = cos_dir < 0.7071068f;
-
-                    float displacement = 0.0f;
-                    if (cos_dir > -0.9998477f) {
-                        // if the angle between adjacent segments is smaller than 179 degrees
-                        Vec3f med_dir = (prev_dir + next_dir).normalized();
-                        displacement = half_width * ::tan(::acos(std::clamp(next_dir.dot(med_dir), -1.0f, 1.0f)));
+        // each path owns its own range of vertices, so the paths can be smoothed concurrently
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, t_buffer.paths.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t path_id = range.begin(); path_id < range.end(); ++path_id) {
+                const Path& path = t_buffer.paths[path_id];
+                //BBS: the two segments of the path sharing the current vertex may belong
+                //to two different vertex buffers
+                size_t prev_sub_path_id = 0;
+                size_t next_sub_path_id = 0;
+                const size_t path_vertices_count = path.vertices_count();
+                const float half_width = 0.5f * path.width;
+                // BBS: modify a lot to support arc move which has internal points
+                for (size_t j = 1; j < path_vertices_count; ++j) {
+                    size_t curr_s_id = path.sub_paths.front().first.s_id + j;
+                    size_t move_id = m_ssid_to_moveid_map[curr_s_id];
+                    int interpolation_points_num = gcode_result.moves[move_id].is_arc_move_with_interpolation_points()?
+                                                        gcode_result.moves[move_id].interpolation_points_count : 0;
+                    int loop_num = interpolation_points_num;
+                    //BBS: select the subpaths which contains the previous/next segments
+                    if (!path.sub_paths[prev_sub_path_id].contains(curr_s_id))
+                        ++prev_sub_path_id;
+                    if (j == path_vertices_count - 1) {
+                        if (!gcode_result.moves[move_id].is_arc_move_with_interpolation_points())
+                            break;   // BBS: the last move has no internal point.
+                        loop_num--;  //BBS: don't need to handle the endpoint of the last arc move of path
+                        next_sub_path_id = prev_sub_path_id;
+                    } else {
+                        if (!path.sub_paths[next_sub_path_id].contains(curr_s_id + 1))
+                            ++next_sub_path_id;
                     }
+                    const Path::Sub_Path& prev_sub_path = path.sub_paths[prev_sub_path_id];
+                    const Path::Sub_Path& next_sub_path = path.sub_paths[next_sub_path_id];
+
+                    // BBS: smooth triangle toolpaths corners including arc move which has internal interpolation point
+                    for (int k = 0; k <= loop_num; k++) {
+                        const Vec3f& prev = k==0?
+                                            gcode_result.moves[move_id - 1].position :
+                                            gcode_result.interpolation_points(gcode_result.moves[move_id])[k-1];
+                        const Vec3f& curr = k==interpolation_points_num?
+                                            gcode_result.moves[move_id].position :
+                                            gcode_result.interpolation_points(gcode_result.moves[move_id])[k];
+                        const Vec3f& next = k < interpolation_points_num - 1?
+                                            gcode_result.interpolation_points(gcode_result.moves[move_id])[k+1]:
+                                            (k == interpolation_points_num - 1? gcode_result.moves[move_id].position :
+                                            (gcode_result.moves[move_id + 1].is_arc_move_with_interpolation_points()?
+                                            gcode_result.interpolation_points(gcode_result.moves[move_id + 1])[0] :
+                                            gcode_result.moves[move_id + 1].position));
+
+                        const Vec3f prev_dir = (curr - prev).normalized();
+                        const Vec3f prev_right = Vec3f(prev_dir.y(), -prev_dir.x(), 0.0f).normalized();
+                        const Vec3f prev_up = prev_right.cross(prev_dir);
+
+                        const Vec3f next_dir = (next - curr).normalized();
+
+                        const bool is_right_turn = prev_up.dot(prev_dir.cross(next_dir)) <= 0.0f;
+                        const float cos_dir = prev_dir.dot(next_dir);
+                        // whether the angle between adjacent segments is greater than 45 degrees
+                        const bool is_sharp = cos_dir < 0.7071068f;
+
+                        float displacement = 0.0f;
+                        if (cos_dir > -0.9998477f) {
+                            // if the angle between adjacent segments is smaller than 179 degrees
+                            Vec3f med_dir = (prev_dir + next_dir).normalized();
+                            displacement = half_width * ::tan(::acos(std::clamp(next_dir.dot(med_dir), -1.0f, 1.0f)));
+                        }
 
-                    const float sq_prev_length = (curr - prev).squaredNorm();
-                    const float sq_next_length = (next - curr).squaredNorm();
-                    const float sq_displacement = sqr(displacement);
-                    const bool can_displace = displacement > 0.0f && sq_displacement < sq_prev_length&& sq_displacement < sq_next_length;
-                    bool is_internal_point = interpolation_points_num > k;
+                        const float sq_prev_length = (curr - prev).squaredNorm();
+                        const float sq_next_length = (next - curr).squaredNorm();
+                        const float sq_displacement = sqr(displacement);
+                        const bool can_displace = displacement > 0.0f && sq_displacement < sq_prev_length&& sq_displacement < sq_next_length;
+                        bool is_internal_point = interpolation_points_num > k;
 
-                    if (can_displace) {
-                        // displacement to apply to the vertices to match
-                        Vec3f displacement_vec = displacement * prev_dir;
-                        // matches inner corner vertices
-                        if (is_right_turn)
-                            match_right_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, -displacement_vec);
-                        else
-                            match_left_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, -displacement_vec);
-
-                        if (!is_sharp) {
-                            //BBS: matches outer corner vertices
+                        if (can_displace) {
+                            // displacement to apply to the vertices to match
+                            Vec3f displacement_vec = displacement * prev_dir;
+                            // matches inner corner vertices
                             if (is_right_turn)
-                                match_left_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, displacement_vec);
+                                match_right_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, -displacement_vec);
                             else
-                                match_right_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, displacement_vec);
+                                match_left_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, -displacement_vec);
+
+                            if (!is_sharp) {
+                                //BBS: matches outer corner vertices
+                                if (is_right_turn)
+                                    match_left_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, displacement_vec);
+                                else
+                                    match_right_vertices_with_internal_point(prev_sub_path, next_sub_path, curr_s_id, is_internal_point, k, vertex_size_floats, displacement_vec);
+                            }
                         }
                     }
                 }
             }
-        }
+        });
     };
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
@@ -2985,7 +3005,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         // if adding the indices for the current segment exceeds the threshold size of the current index buffer
         // create another index buffer
         // BBS: get the point number and then judge whether the remaining buffer is enough
-        size_t points_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points.size() + 1 : 1;
+        size_t points_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count + 1 : 1;
         size_t indiced_size_to_add = (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) ? t_buffer.model.data.indices_size_bytes() : points_num * t_buffer.max_indices_per_segment_size_bytes();
         if (i_multibuffer.back().size() * sizeof(IBufferType) >= IBUFFER_THRESHOLD_BYTES - indiced_size_to_add) {
             i_multibuffer.push_back(IndexBuffer());
@@ -3194,6 +3214,55 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         progress_dialog->Destroy();
 }
 
+void GCodeViewer::apply_toolpaths_memory_budget(const GCodeProcessorResult& gcode_result)
+{
+    auto set_solid_toolpaths = [this](bool solid) {
+        for (EMoveType type : { EMoveType::Extrude, EMoveType::Wipe }) {
+            TBuffer& buffer = m_buffers[buffer_id(type)];
+            buffer.render_primitive_type = solid ? TBuffer::ERenderPrimitiveType::Triangle : TBuffer::ERenderPrimitiveType::Line;
+            buffer.shader = solid ? "gouraud_light" : "toolpaths_lines";
+        }
+        m_toolpaths_as_lines = !solid;
+    };
+
+    const std::string budget = wxGetApp().app_config->get("gcode_preview_memory_budget");
+    m_toolpaths_memory_budget = budget.empty() ? 0 : std::max<int64_t>(0, std::atoll(budget.c_str())) * 1024 * 1024;
+
+    set_solid_toolpaths(true);
+    m_toolpaths_estimated_size = estimate_toolpaths_size(gcode_result);
+    if (m_toolpaths_memory_budget > 0 && m_toolpaths_estimated_size > m_toolpaths_memory_budget) {
+        // Lines need a fraction of the vertices and indices of the solid toolpaths.
+        const int64_t solid_size = m_toolpaths_estimated_size;
+        set_solid_toolpaths(false);
+        m_toolpaths_estimated_size = estimate_toolpaths_size(gcode_result);
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": solid toolpaths need %1% MB over the budget of %2% MB, rendering the extrusions as lines using %3% MB")
+            % (solid_size >> 20) % (m_toolpaths_memory_budget >> 20) % (m_toolpaths_estimated_size >> 20);
+    }
+}
+
+int64_t GCodeViewer::estimate_toolpaths_size(const GCodeProcessorResult& gcode_result) const
+{
+    int64_t size = 0;
+    for (size_t i = 1; i < m_moves_count; ++i) {
+        const GCodeProcessorResult::MoveVertex& curr = gcode_result.moves[i];
+        const TBuffer& t_buffer = m_buffers[buffer_id(curr.type)];
+        switch (t_buffer.render_primitive_type)
+        {
+        case TBuffer::ERenderPrimitiveType::InstancedModel: { break; }
+        case TBuffer::ERenderPrimitiveType::BatchedModel: {
+            size += static_cast<int64_t>(t_buffer.model.data.vertices_size_bytes() + t_buffer.model.data.indices_size_bytes());
+            break;
+        }
+        default: {
+            const size_t points_num = curr.is_arc_move_with_interpolation_points() ? curr.interpolation_points_count + 1 : 1;
+            size += static_cast<int64_t>(points_num * (t_buffer.max_vertices_per_segment_size_bytes() + t_buffer.max_indices_per_segment_size_bytes()));
+            break;
+        }
+        }
+    }
+    return size;
+}
+
 //BBS: always load shell when preview
 void GCodeViewer::load_shells(const Print& print, bool initialized, bool force_previewing)
 {
@@ -3397,30 +3466,34 @@ void GCodeViewer::refresh_render_paths(bool keep_sequential_current_first, bool
     };
 
 
-    auto is_travel_in_layers_range = [this](size_t path_id, size_t min_id, size_t max_id) {
-        const TBuffer& buffer = m_buffers[buffer_id(EMoveType::Travel)];
-        if (path_id >= buffer.paths.size())
-            return false;
-
-        Path path = buffer.paths[path_id];
-        size_t first = path_id;
-        size_t last = path_id;
-
-        // check adjacent paths
-        while (first > 0 && path.sub_paths.front().first.position.isApprox(buffer.paths[first - 1].sub_paths.back().last.position)) {
-            --first;
-            path.sub_paths.front().first = buffer.paths[first].sub_paths.front().first;
+    // s_ids of the first and of the last vertex of each travel path extended by its adjacent travel paths,
+    // calculated once instead of walking (and copying) the adjacent paths for each query.
+    std::vector<std::pair<size_t, size_t>> travel_extents;
+    if (const TBuffer& buffer = m_buffers[buffer_id(EMoveType::Travel)]; buffer.visible) {
+        const size_t count = buffer.paths.size();
+        travel_extents.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const Path::Endpoint& first = buffer.paths[i].sub_paths.front().first;
+            travel_extents[i].first = (i > 0 && first.position.isApprox(buffer.paths[i - 1].sub_paths.back().last.position)) ?
+                travel_extents[i - 1].first : first.s_id;
         }
-        while (last < buffer.paths.size() - 1 && path.sub_paths.back().last.position.isApprox(buffer.paths[last + 1].sub_paths.front().first.position)) {
-            ++last;
-            path.sub_paths.back().last = buffer.paths[last].sub_paths.back().last;
+        for (size_t i = count; i > 0; --i) {
+            const Path::Endpoint& last = buffer.paths[i - 1].sub_paths.back().last;
+            travel_extents[i - 1].second = (i < count && last.position.isApprox(buffer.paths[i].sub_paths.front().first.position)) ?
+                travel_extents[i].second : last.s_id;
         }
+    }
 
+    auto is_travel_in_layers_range = [this, &travel_extents](size_t path_id, size_t min_id, size_t max_id) {
+        if (path_id >= travel_extents.size())
+            return false;
+
+        const auto [first_s_id, last_s_id] = travel_extents[path_id];
         const size_t min_s_id = m_layers.get_endpoints_at(min_id).first;
         const size_t max_s_id = m_layers.get_endpoints_at(max_id).last;
 
-        return (min_s_id <= path.sub_paths.front().first.s_id && path.sub_paths.front().first.s_id <= max_s_id) ||
-            (min_s_id <= path.sub_paths.back().last.s_id && path.sub_paths.back().last.s_id <= max_s_id);
+        return (min_s_id <= first_s_id && first_s_id <= max_s_id) ||
+            (min_s_id <= last_s_id && last_s_id <= max_s_id);
     };
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
@@ -3547,7 +3620,7 @@ void GCodeViewer::refresh_render_paths(bool keep_sequential_current_first, bool
                                     size_t move_id = m_ssid_to_moveid_map[i];
                                     const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
                                     if (curr.is_arc_move()) {
-                                        offset += curr.interpolation_points.size();
+                                        offset += curr.interpolation_points_count;
                                     }
                                 }
                                 offset = 2 * offset - 1;
@@ -3559,7 +3632,7 @@ void GCodeViewer::refresh_render_paths(bool keep_sequential_current_first, bool
                                     size_t move_id = m_ssid_to_moveid_map[i];
                                     const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
                                     if (curr.is_arc_move()) {
-                                        offset += curr.interpolation_points.size();
+                                        offset += curr.interpolation_points_count;
                                     }
                                 }
                                 offset = indices_count * (offset - 1) + (indices_count - 2);
@@ -3661,7 +3734,7 @@ void GCodeViewer::refresh_render_paths(bool keep_sequential_current_first, bool
                 size_t move_id = m_ssid_to_moveid_map[i];
                 const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
                 if (curr.is_arc_move()) {
-                    segments_count += curr.interpolation_points.size();
+                    segments_count += curr.interpolation_points_count;
                 }
             }
             size_in_indices = buffer.indices_per_segment() * segments_count;
@@ -4306,11 +4379,22 @@ void GCodeViewer::render_all_plates_stats(const std::vector<const GCodeProcessor
     float window_padding = 4.0f * m_scale;
     const float icon_size = ImGui::GetTextLineHeight() * 0.7;
     std::map<std::string, float> offsets;
-    std::map<int, double> model_volume_of_extruders_all_plates; // map<extruder_idx, volume>
-    std::map<int, double> flushed_volume_of_extruders_all_plates; // map<extruder_idx, flushed volume>
-    std::map<int, double> wipe_tower_volume_of_extruders_all_plates; // map<extruder_idx, flushed volume>
-    std::map<int, double> support_volume_of_extruders_all_plates; // map<extruder_idx, flushed volume>
-    std::map<int, double> plate_time; // map<plate_idx, time>
+    // The sums over the plates only change with the slicing results, they are not recomputed for each frame.
+    std::vector<std::pair<const GCodeProcessorResult*, unsigned int>> results;
+    results.reserve(gcode_result_list.size());
+    for (const GCodeProcessorResult* gcode_result : gcode_result_list)
+        results.emplace_back(gcode_result, gcode_result->id);
+    const bool update_sums = m_all_plates_stats.results != results || m_all_plates_stats.time_mode != m_time_estimate_mode;
+    if (update_sums) {
+        m_all_plates_stats = AllPlatesStats();
+        m_all_plates_stats.results = std::move(results);
+        m_all_plates_stats.time_mode = m_time_estimate_mode;
+    }
+    std::map<int, double>& model_volume_of_extruders_all_plates = m_all_plates_stats.model_volumes;
+    std::map<int, double>& flushed_volume_of_extruders_all_plates = m_all_plates_stats.flushed_volumes;
+    std::map<int, double>& wipe_tower_volume_of_extruders_all_plates = m_all_plates_stats.wipe_tower_volumes;
+    std::map<int, double>& support_volume_of_extruders_all_plates = m_all_plates_stats.support_volumes;
+    std::map<int, double>& plate_time = m_all_plates_stats.plate_times;
     std::vector<double> model_used_filaments_m_all_plates;
     std::vector<double> model_used_filaments_g_all_plates;
     std::vector<double> flushed_filaments_m_all_plates;
@@ -4319,8 +4403,8 @@ void GCodeViewer::render_all_plates_stats(const std::vector<const GCodeProcessor
     std::vector<double> wipe_tower_used_filaments_g_all_plates;
     std::vector<double> support_used_filaments_m_all_plates;
     std::vector<double> support_used_filaments_g_all_plates;
-    float total_time_all_plates = 0.0f;
-    float total_cost_all_plates = 0.0f;
+    float& total_time_all_plates = m_all_plates_stats.total_time;
+    float& total_cost_all_plates = m_all_plates_stats.total_cost;
     double unit_conver = imperial_units ? GizmoObjectManipulation::oz_to_g : 1.0;
     struct ColumnData {
         enum {
@@ -4405,9 +4489,10 @@ void GCodeViewer::render_all_plates_stats(const std::vector<const GCodeProcessor
     // title and item data
     {
         PartPlateList& plate_list = wxGetApp().plater()->get_partplate_list();
-        for (auto plate : plate_list.get_nonempty_plate_list())
+        std::vector<PartPlate*> plates_to_sum = update_sums ? plate_list.get_nonempty_plate_list() : std::vector<PartPlate*>();
+        for (auto plate : plates_to_sum)
         {
-            auto plate_print_statistics = plate->get_slice_result()->print_statistics;
+            const PrintEstimatedStatistics& plate_print_statistics = plate->get_slice_result()->print_statistics;
             auto plate_extruders = plate->get_extruders(true);
             for (size_t extruder_id : plate_extruders) {
                 extruder_id -= 1;
@@ -6386,6 +6471,10 @@ void GCodeViewer::render_statistics()
     }
 
     if (ImGui::CollapsingHeader("GPU memory")) {
+        add_memory(std::string("Toolpaths estimate:"), m_toolpaths_estimated_size);
+        add_memory(std::string("Toolpaths budget:"), m_toolpaths_memory_budget);
+        add_counter(std::string("Extrusions as lines:"), m_toolpaths_as_lines ? 1 : 0);
+        ImGui::Separator();
         add_memory(std::string("Vertices:"), m_statistics.total_vertices_gpu_size);
         add_memory(std::string("Indices:"), m_statistics.total_indices_gpu_size);
         add_memory(std::string("Instances:"), m_statistics.total_instances_gpu_size);
@@ -651,6 +651,8 @@ public:
             bool m_visible{ true };
             uint64_t m_selected_line_id{ 0 };
             size_t m_last_lines_size{ 0 };
+            // id of the first line stored in m_lines
+            uint64_t m_lines_start_id{ 0 };
             std::string m_filename;
             boost::iostreams::mapped_file_source m_file;
             // map for accessing data in file by line number
@@ -803,6 +805,20 @@ private:
     float m_legend_height;
     PrintEstimatedStatistics m_print_statistics;
     PrintEstimatedStatistics::ETimeMode m_time_estimate_mode{ PrintEstimatedStatistics::ETimeMode::Normal };
+    // Sums shown by render_all_plates_stats(), valid for the listed slicing results (identified by their ids) and time mode.
+    struct AllPlatesStats
+    {
+        std::vector<std::pair<const GCodeProcessorResult*, unsigned int>> results;
+        PrintEstimatedStatistics::ETimeMode time_mode{ PrintEstimatedStatistics::ETimeMode::Normal };
+        std::map<int, double> model_volumes;      // map<extruder_idx, volume>
+        std::map<int, double> flushed_volumes;
+        std::map<int, double> wipe_tower_volumes;
+        std::map<int, double> support_volumes;
+        std::map<int, double> plate_times;        // map<plate_idx, time>
+        float total_time{ 0.0f };
+        float total_cost{ 0.0f };
+    };
+    mutable AllPlatesStats m_all_plates_stats;
 #if ENABLE_GCODE_VIEWER_STATISTICS
     Statistics m_statistics;
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
@@ -812,6 +828,10 @@ private:
     std::vector<CustomGCode::Item> m_custom_gcode_per_print_z;
 
     bool m_contained_in_bed{ true };
+    // BBS: the extrusions are rendered as lines when their solid toolpaths would exceed the "gcode_preview_memory_budget" (MB) of the app config
+    bool    m_toolpaths_as_lines{ false };
+    int64_t m_toolpaths_memory_budget{ 0 };
+    int64_t m_toolpaths_estimated_size{ 0 };
     bool m_is_dark = false;
 
 public:
@@ -917,6 +937,9 @@ public:
 
 private:
     void load_toolpaths(const GCodeProcessorResult& gcode_result, const BuildVolume& build_volume, const std::vector<BoundingBoxf3>& exclude_bounding_box);
+    // Select solid or line toolpaths for the extrusions and wipes, according to the memory budget.
+    void apply_toolpaths_memory_budget(const GCodeProcessorResult& gcode_result);
+    int64_t estimate_toolpaths_size(const GCodeProcessorResult& gcode_result) const;
     //BBS: always load shell at preview
     //void load_shells(const Print& print, bool initialized);
     void refresh_render_paths(bool keep_sequential_current_first, bool keep_sequential_current_last) const;
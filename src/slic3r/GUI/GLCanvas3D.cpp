@@ -61,13 +61,16 @@
 
 #include <tbb/parallel_for.h>
 #include <tbb/spin_mutex.h>
+#include <tbb/task_arena.h>
 
 #include <boost/log/trivial.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #include <iostream>
 #include <float.h>
 #include <algorithm>
+#include <string_view>
 #include <cmath>
 
 #ifndef IMGUI_DEFINE_MATH_OPERATORS
@@ -212,6 +215,7 @@ void GLCanvas3D::LayersEditing::select_object(const Model& model, int object_id)
         m_layer_height_profile.clear();
         delete m_slicing_parameters;
         m_slicing_parameters = nullptr;
+        m_slicing_adaptive.clear();
         m_layers_texture.valid = false;
         this->last_object_id = object_id;
         m_model_object = model_object_new;
@@ -720,7 +724,9 @@ void GLCanvas3D::LayersEditing::reset_layer_height_profile(GLCanvas3D & canvas)
 void GLCanvas3D::LayersEditing::adaptive_layer_height_profile(GLCanvas3D & canvas, float quality_factor)
 {
     this->update_slicing_parameters();
-    m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, *m_model_object, quality_factor);
+    if (! m_slicing_adaptive.is_prepared_for(*m_model_object))
+        m_slicing_adaptive.prepare(*m_model_object);
+    m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, m_slicing_adaptive, quality_factor);
     const_cast<ModelObject*>(m_model_object)->layer_height_profile.set(m_layer_height_profile);
     m_layers_texture.valid = false;
     canvas.post_event(SimpleEvent(EVT_GLCANVAS_SCHEDULE_BACKGROUND_PROCESS));
@@ -2360,6 +2366,9 @@ void GLCanvas3D::render(bool only_init)
         imgui.end();
     }
 
+    if (wxGetApp().plater()->is_slicing_profile_dialog_visible())
+        _render_slicing_profile();
+
 #if ENABLE_PROJECT_DIRTY_STATE_DEBUG_WINDOW
     if (wxGetApp().is_editor() && wxGetApp().plater()->is_view3D_shown())
         wxGetApp().plater()->render_project_state_debug_window();
@@ -2932,7 +2941,7 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
                     // Note the index of the loaded volume, so that we can reload the main model GLVolume with the hollowed mesh
                     // later in this function.
                     it->volume_idx = m_volumes.volumes.size();
-                    m_volumes.load_object_volume(&model_object, obj_idx, volume_idx, instance_idx, m_color_by, m_initialized, m_canvas_type == ECanvasType::CanvasAssembleView, false, enable_lod);
+                    m_volumes.load_object_volume(&model_object, obj_idx, volume_idx, instance_idx, m_color_by, m_initialized, m_canvas_type == ECanvasType::CanvasAssembleView, false, enable_lod, true);
                     m_volumes.volumes.back()->geometry_id = key.geometry_id;
                     update_object_list = true;
                 } else {
@@ -3938,6 +3947,9 @@ void GLCanvas3D::on_key(wxKeyEvent& evt)
                 } else if ((evt.ShiftDown() && evt.ControlDown() && keyCode == 'L')) {
                     wxGetApp().plater()->toggle_non_manifold_edges();
                     m_dirty = true;
+                } else if (evt.ShiftDown() && evt.ControlDown() && keyCode == 'U') {
+                    wxGetApp().plater()->toggle_slicing_profile_dialog();
+                    m_dirty = true;
                 }
                 else if (m_tab_down && keyCode == WXK_TAB && !evt.HasAnyModifiers()) {
                     // Enable switching between 3D and Preview with Tab
@@ -6291,6 +6303,132 @@ static void debug_output_thumbnail(const ThumbnailData& thumbnail_data)
 }
 #endif // ENABLE_THUMBNAIL_GENERATOR_DEBUG_OUTPUT
 
+// Collects the volumes shown in a thumbnail of the given plate, and the plate build volume they are clipped to.
+static void thumbnail_visible_volumes(const ThumbnailsParams& thumbnail_params, PartPlateList& partplate_list, const GLVolumeCollection& volumes,
+    GLVolumePtrs& visible_volumes, BoundingBoxf3& plate_build_volume)
+{
+    if (thumbnail_params.use_plate_box) {
+        int           plate_idx = thumbnail_params.plate_id;
+        PartPlate* plate = partplate_list.get_plate(plate_idx);
+        plate_build_volume = plate->get_build_volume();
+        plate_build_volume.min(0) -= Slic3r::BuildVolume::SceneEpsilon;
+        plate_build_volume.min(1) -= Slic3r::BuildVolume::SceneEpsilon;
+        plate_build_volume.min(2) -= Slic3r::BuildVolume::SceneEpsilon;
+        plate_build_volume.max(0) += Slic3r::BuildVolume::SceneEpsilon;
+        plate_build_volume.max(1) += Slic3r::BuildVolume::SceneEpsilon;
+        plate_build_volume.max(2) += Slic3r::BuildVolume::SceneEpsilon;
+        /*if (m_config != nullptr) {
+            double h = m_config->opt_float("printable_height");
+            plate_build_volume.min(2) = std::min(plate_build_volume.min(2), -h);
+            plate_build_volume.max(2) = std::max(plate_build_volume.max(2), h);
+        }*/
+
+        auto is_visible = [plate_idx, plate_build_volume](const GLVolume& v) {
+            bool ret = v.printable;
+            if (plate_idx >= 0) {
+                bool          contained = false;
+                BoundingBoxf3 plate_bbox = plate_build_volume;
+                plate_bbox.min(2) = -1e10;
+                const BoundingBoxf3& volume_bbox = v.transformed_convex_hull_bounding_box();
+                if (plate_bbox.contains(volume_bbox) && (volume_bbox.max(2) > 0)) { contained = true; }
+                ret &= contained;
+            }
+            else {
+                ret &= (!v.shader_outside_printer_detection_enabled || !v.is_outside);
+            }
+            return ret;
+            };
+
+        for (GLVolume* vol : volumes.volumes) {
+            if (!vol->is_modifier && !vol->is_wipe_tower && (!thumbnail_params.parts_only || vol->composite_id.volume_id >= 0)) {
+                if (is_visible(*vol)) { visible_volumes.emplace_back(vol); }
+            }
+        }
+    }
+    else {
+        visible_volumes = volumes.volumes;
+    }
+    // A thumbnail is rendered just once, the meshes still being prepared on a worker thread have to be complete.
+    for (GLVolume* vol : visible_volumes)
+        vol->indexed_vertex_array->wait_loaded();
+}
+
+// Hash of everything _render_thumbnail_internal() draws, used to skip rendering a thumbnail again when the scene did not change.
+// Zero if a visible volume is not rendered from a ModelVolume, as its geometry cannot be identified.
+static size_t thumbnail_fingerprint(unsigned int w, unsigned int h, const ThumbnailsParams& thumbnail_params, PartPlateList& partplate_list, ModelObjectPtrs& model_objects,
+    const GLVolumeCollection& volumes, const std::vector<std::array<float, 4>>& extruder_colors, const std::shared_ptr<GLShaderProgram>& shader,
+    Camera::EType camera_type, Camera::ViewAngleType camera_view_angle_type, bool for_picking, bool ban_light)
+{
+    GLVolumePtrs  visible_volumes;
+    BoundingBoxf3 plate_build_volume;
+    thumbnail_visible_volumes(thumbnail_params, partplate_list, volumes, visible_volumes, plate_build_volume);
+
+    size_t seed = 0;
+    auto hash_floats = [&seed](const auto* data, size_t count) {
+        for (size_t i = 0; i < count; ++i)
+            boost::hash_combine(seed, data[i]);
+    };
+    boost::hash_combine(seed, w);
+    boost::hash_combine(seed, h);
+    boost::hash_combine(seed, thumbnail_params.printable_only);
+    boost::hash_combine(seed, thumbnail_params.parts_only);
+    boost::hash_combine(seed, thumbnail_params.show_bed);
+    boost::hash_combine(seed, thumbnail_params.transparent_background);
+    boost::hash_combine(seed, thumbnail_params.plate_id);
+    boost::hash_combine(seed, thumbnail_params.use_plate_box);
+    boost::hash_combine(seed, thumbnail_params.post_processing_enabled);
+    hash_floats(thumbnail_params.background_color.data(), 4);
+    boost::hash_combine(seed, shader.get());
+    boost::hash_combine(seed, int(camera_type));
+    boost::hash_combine(seed, int(camera_view_angle_type));
+    boost::hash_combine(seed, for_picking);
+    boost::hash_combine(seed, ban_light);
+    hash_floats(plate_build_volume.min.data(), 3);
+    hash_floats(plate_build_volume.max.data(), 3);
+    for (const std::array<float, 4>& color : extruder_colors)
+        hash_floats(color.data(), 4);
+
+    std::hash<std::string_view> hash;
+    for (const GLVolume* vol : visible_volumes) {
+        if (vol->object_idx() < 0 || vol->object_idx() >= int(model_objects.size()) || vol->volume_idx() < 0 ||
+            vol->volume_idx() >= int(model_objects[vol->object_idx()]->volumes.size()))
+            return 0;
+        // the vertex buffers of the volume are built from the mesh of the model volume
+        const ModelVolume*          model_volume = model_objects[vol->object_idx()]->volumes[vol->volume_idx()];
+        const indexed_triangle_set& its          = model_volume->mesh().its;
+        boost::hash_combine(seed, model_volume->id().id);
+        boost::hash_combine(seed, hash(std::string_view(reinterpret_cast<const char*>(its.vertices.data()), its.vertices.size() * sizeof(stl_vertex))));
+        boost::hash_combine(seed, hash(std::string_view(reinterpret_cast<const char*>(its.indices.data()), its.indices.size() * sizeof(stl_triangle_vertex_indices))));
+        boost::hash_combine(seed, vol->tverts_range.first);
+        boost::hash_combine(seed, vol->tverts_range.second);
+        boost::hash_combine(seed, vol->qverts_range.first);
+        boost::hash_combine(seed, vol->qverts_range.second);
+        boost::hash_combine(seed, vol->model_object_ID);
+        boost::hash_combine(seed, vol->extruder_id);
+        boost::hash_combine(seed, bool(vol->printable));
+        boost::hash_combine(seed, vol->object_idx());
+        boost::hash_combine(seed, vol->volume_idx());
+        hash_floats(vol->color.data(), 4);
+        hash_floats(vol->world_matrix().data(), 16);
+        // the painted colors are rendered from the model volume, see GLVolume::simple_render()
+        if (vol->printable) {
+            boost::hash_combine(seed, model_volume->extruder_id());
+            boost::hash_combine(seed, model_volume->mmu_segmentation_facets.timestamp());
+        }
+    }
+    return seed == 0 ? 1 : seed;
+}
+
+static size_t thumbnail_pixels_hash(const ThumbnailData& thumbnail_data)
+{
+    const uint64_t* data = reinterpret_cast<const uint64_t*>(thumbnail_data.pixels.data());
+    const size_t    count = thumbnail_data.pixels.size() / sizeof(uint64_t);
+    size_t seed = boost::hash_range(data, data + count);
+    for (size_t i = count * sizeof(uint64_t); i < thumbnail_data.pixels.size(); ++i)
+        boost::hash_combine(seed, thumbnail_data.pixels[i]);
+    return seed;
+}
+
 void GLCanvas3D::render_thumbnail_framebuffer(const std::shared_ptr<OpenGLManager>& p_ogl_manager, ThumbnailData& thumbnail_data, unsigned int w, unsigned int h, const ThumbnailsParams& thumbnail_params,
     PartPlateList& partplate_list, ModelObjectPtrs& model_objects, const GLVolumeCollection& volumes, std::vector<std::array<float, 4>>& extruder_colors,
                                               const std::shared_ptr<GLShaderProgram>& shader,
@@ -6299,6 +6437,16 @@ void GLCanvas3D::render_thumbnail_framebuffer(const std::shared_ptr<OpenGLManage
                                               bool                               for_picking,
                                               bool                               ban_light)
 {
+    const size_t scene_fingerprint = thumbnail_fingerprint(w, h, thumbnail_params, partplate_list, model_objects, volumes, extruder_colors, shader,
+        camera_type, camera_view_angle_type, for_picking, ban_light);
+    // the pixel hash detects the thumbnails overwritten since, by loading a project for example
+    if (scene_fingerprint != 0 && thumbnail_data.scene_fingerprint == scene_fingerprint && thumbnail_data.is_valid() &&
+        thumbnail_data.width == w && thumbnail_data.height == h && thumbnail_data.pixels_hash == thumbnail_pixels_hash(thumbnail_data)) {
+        BOOST_LOG_TRIVIAL(info) << boost::format("render_thumbnail: plate %1% unchanged, reusing the thumbnail") % thumbnail_params.plate_id;
+        return;
+    }
+    thumbnail_data.scene_fingerprint = 0;
+
     thumbnail_data.set(w, h);
     if (!thumbnail_data.is_valid())
         return;
@@ -6358,6 +6506,8 @@ void GLCanvas3D::render_thumbnail_framebuffer(const std::shared_ptr<OpenGLManage
     }
 
     p_ogl_manager->read_pixel(write_to_framebuffer_name, 0, 0, w, h, EPixelFormat::RGBA, EPixelDataType::UByte, (void*)thumbnail_data.pixels.data());
+    thumbnail_data.scene_fingerprint = scene_fingerprint;
+    thumbnail_data.pixels_hash       = thumbnail_pixels_hash(thumbnail_data);
 
     const auto& p_fb = p_ogl_manager->get_frame_buffer(thumbnail_fb_name);
     int fb_id = 0;
@@ -6975,6 +7125,9 @@ void GLCanvas3D::_picking_pass()
 
         m_gizmos.render_current_gizmo_for_picking_pass();
 
+        // queue the read of the picked pixel now, it is fetched once the frame was swapped
+        p_ogl_manager->request_pixels(OpenGLManager::s_picking_frame, 0, 0, 1, 1, EPixelFormat::RGBA, EPixelDataType::UByte);
+
         const auto gpu_picking_callback = [this]()->void {
             std::vector<int>* hover_volume_idxs = const_cast<std::vector<int>*>(&m_hover_volume_idxs);
             std::vector<int>* hover_plate_idxs = const_cast<std::vector<int>*>(&m_hover_plate_idxs);
@@ -6993,7 +7146,8 @@ void GLCanvas3D::_picking_pass()
             GLubyte color[4] = { 0, 0, 0, 0 };
             bool inside = 0 <= m_mouse.position(0) && m_mouse.position(0) < cnv_size.get_width() && 0 <= m_mouse.position(1) && m_mouse.position(1) < cnv_size.get_height();
             if (inside) {
-                p_ogl_manager->read_pixel(OpenGLManager::s_picking_frame, 0, 0, 1, 1, EPixelFormat::RGBA, EPixelDataType::UByte, (void*)color);
+                if (!p_ogl_manager->fetch_requested_pixels(OpenGLManager::s_picking_frame, (void*)color, sizeof(color)))
+                    p_ogl_manager->read_pixel(OpenGLManager::s_picking_frame, 0, 0, 1, 1, EPixelFormat::RGBA, EPixelDataType::UByte, (void*)color);
                 if (picking_checksum_alpha_channel(color[0], color[1], color[2]) == color[3]) {
                     // Only non-interpolated colors are valid, those have their lowest three bits zeroed.
                     // we reserve color = (0,0,0) for occluders (as the printbed)
@@ -7099,6 +7253,10 @@ void GLCanvas3D::_rectangular_selection_picking_pass()
         //_render_bed_for_picking(!wxGetApp().plater()->get_camera().is_looking_downward());
 
         glsafe(::glDisable(GL_SCISSOR_TEST));
+
+        // queue the read of the selection rectangle now, it is fetched once the frame was swapped
+        if (viewport_x >= 0 && viewport_y >= 0)
+            p_ogl_manager->request_pixels("rectangular_selection_pickingframe", viewport_x, viewport_y, viewport_width, viewport_height, EPixelFormat::RGBA, EPixelDataType::UByte);
     }
 
     const auto gpu_picking_callback = [this, viewport_width, viewport_height]()->void {
@@ -7127,7 +7285,8 @@ void GLCanvas3D::_rectangular_selection_picking_pass()
 
                 std::vector<Pixel> frame(px_count);
                 const auto& p_ogl_manager = wxGetApp().get_opengl_manager();
-                p_ogl_manager->read_pixel("rectangular_selection_pickingframe", left, top, viewport_width, viewport_height, EPixelFormat::RGBA, EPixelDataType::UByte, (void*)frame.data());
+                if (!p_ogl_manager->fetch_requested_pixels("rectangular_selection_pickingframe", (void*)frame.data(), frame.size() * sizeof(Pixel)))
+                    p_ogl_manager->read_pixel("rectangular_selection_pickingframe", left, top, viewport_width, viewport_height, EPixelFormat::RGBA, EPixelDataType::UByte, (void*)frame.data());
                 tbb::spin_mutex mutex;
                 tbb::parallel_for(tbb::blocked_range<size_t>(0, frame.size(), (size_t)viewport_width),
                     [this, &frame, &idxs, &mutex](const tbb::blocked_range<size_t>& range) {
@@ -7266,6 +7425,10 @@ void GLCanvas3D::_render_objects(GLVolumeCollection::ERenderType type, bool with
     if (m_volumes.empty())
         return;
 
+    // Render again shortly to show the meshes still being prepared on a worker thread once they are done.
+    if (m_volumes.has_loading_volumes())
+        schedule_extra_frame(100);
+
     glsafe(::glEnable(GL_DEPTH_TEST));
 
     m_camera_clipping_plane = m_gizmos.get_clipping_plane();
@@ -7663,6 +7826,65 @@ void GLCanvas3D::_render_overlays()
     _render_3d_navigator();
 }
 
+// BBS: slicing performance overlay (Shift+Ctrl+U), showing the SlicingProfiler records of the current plate while it is being sliced
+// and the statistics of the G-code export pipeline once the slicing finished.
+void GLCanvas3D::_render_slicing_profile()
+{
+    const Print &print   = wxGetApp().plater()->fff_print();
+    const bool   slicing = wxGetApp().plater()->is_background_process_slicing();
+
+    auto format_memory = [](int64_t bytes) {
+        return Slic3r::float_to_string_decimal_point(double(bytes) / (1024. * 1024.), 1) + " MB";
+    };
+
+    ImGuiWrapper &imgui = *wxGetApp().imgui();
+    imgui.begin(std::string("Slicing profile"), ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoCollapse);
+    imgui.text("Worker threads: " + std::to_string(tbb::this_task_arena::max_concurrency()));
+    imgui.text("Process peak memory: " + format_memory(int64_t(SlicingProfiler::peak_memory_usage())));
+    if (AllocationTracker::enabled()) {
+        AllocationTracker::Stats allocations = AllocationTracker::stats();
+        imgui.text("Live heap: " + format_memory(allocations.live_bytes) + ", peak: " + format_memory(allocations.peak_live_bytes));
+    }
+
+    // CPU time over wall time approximates the number of busy worker threads. CPU time is measured for the whole process,
+    // thus the utilization of steps running in parallel is overestimated.
+    ImGui::Separator();
+    std::vector<SlicingProfiler::StepRecord> records = print.slicing_profiler().records();
+    if (records.empty())
+        imgui.text(slicing ? "Waiting for the first step to finish" : "No slicing steps recorded");
+    else if (ImGui::BeginTable("steps", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+        for (const char *header : { "Step", "Object", "Wall [ms]", "CPU [ms]", "Threads", "Peak RSS growth" })
+            ImGui::TableSetupColumn(header);
+        ImGui::TableHeadersRow();
+        for (const SlicingProfiler::StepRecord &record : records) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); imgui.text(record.step);
+            ImGui::TableNextColumn(); imgui.text(record.object_name);
+            ImGui::TableNextColumn(); imgui.text(Slic3r::float_to_string_decimal_point(record.wall_time_ms, 1));
+            ImGui::TableNextColumn(); imgui.text(Slic3r::float_to_string_decimal_point(record.cpu_time_ms, 1));
+            ImGui::TableNextColumn(); imgui.text(record.wall_time_ms > 0. ? Slic3r::float_to_string_decimal_point(record.cpu_time_ms / record.wall_time_ms, 1) : std::string("-"));
+            ImGui::TableNextColumn(); imgui.text(format_memory(record.peak_rss_delta));
+        }
+        ImGui::EndTable();
+    }
+
+    // The pipeline statistics are written by the background thread while exporting, thus they are only shown when it is done.
+    if (! slicing && ! print.gcode_pipeline_stats().empty()) {
+        ImGui::Separator();
+        for (const GCodePipelineStats &stats : print.gcode_pipeline_stats()) {
+            imgui.text("G-code export: " + std::to_string(stats.layers) + " layers, tokens " + std::to_string(stats.max_tokens) +
+                ", max in flight " + std::to_string(stats.max_in_flight) + ", stalls " + std::to_string(stats.stalls));
+            for (const GCodePipelineStats::Stage &stage : stats.stages)
+                imgui.text("    " + stage.name + ": busy " + Slic3r::float_to_string_decimal_point(stage.busy_ms, 1) + " ms, max queue " + std::to_string(stage.max_backlog));
+        }
+    }
+    imgui.end();
+
+    // Refresh the timings while slicing.
+    if (slicing)
+        schedule_extra_frame(500);
+}
+
 void GLCanvas3D::_render_style_editor()
 {
     bool show_style_editor = true;
@@ -10293,49 +10515,11 @@ void GLCanvas3D::_render_thumbnail_internal(ThumbnailData& thumbnail_data, const
     static const std::array<float, 4> gray = { 0.64f, 0.64f, 0.64f, 1.0f };
     GLVolumePtrs                      visible_volumes;
     BoundingBoxf3                     plate_build_volume;
+    thumbnail_visible_volumes(thumbnail_params, partplate_list, volumes, visible_volumes, plate_build_volume);
     if (thumbnail_params.use_plate_box) {
-        int           plate_idx = thumbnail_params.plate_id;
-        PartPlate* plate = partplate_list.get_plate(plate_idx);
-        plate_build_volume = plate->get_build_volume();
-        plate_build_volume.min(0) -= Slic3r::BuildVolume::SceneEpsilon;
-        plate_build_volume.min(1) -= Slic3r::BuildVolume::SceneEpsilon;
-        plate_build_volume.min(2) -= Slic3r::BuildVolume::SceneEpsilon;
-        plate_build_volume.max(0) += Slic3r::BuildVolume::SceneEpsilon;
-        plate_build_volume.max(1) += Slic3r::BuildVolume::SceneEpsilon;
-        plate_build_volume.max(2) += Slic3r::BuildVolume::SceneEpsilon;
-        /*if (m_config != nullptr) {
-            double h = m_config->opt_float("printable_height");
-            plate_build_volume.min(2) = std::min(plate_build_volume.min(2), -h);
-            plate_build_volume.max(2) = std::max(plate_build_volume.max(2), h);
-        }*/
-
-        auto is_visible = [plate_idx, plate_build_volume](const GLVolume& v) {
-            bool ret = v.printable;
-            if (plate_idx >= 0) {
-                bool          contained = false;
-                BoundingBoxf3 plate_bbox = plate_build_volume;
-                plate_bbox.min(2) = -1e10;
-                const BoundingBoxf3& volume_bbox = v.transformed_convex_hull_bounding_box();
-                if (plate_bbox.contains(volume_bbox) && (volume_bbox.max(2) > 0)) { contained = true; }
-                ret &= contained;
-            }
-            else {
-                ret &= (!v.shader_outside_printer_detection_enabled || !v.is_outside);
-            }
-            return ret;
-            };
-
-        for (GLVolume* vol : volumes.volumes) {
-            if (!vol->is_modifier && !vol->is_wipe_tower && (!thumbnail_params.parts_only || vol->composite_id.volume_id >= 0)) {
-                if (is_visible(*vol)) { visible_volumes.emplace_back(vol); }
-            }
-        }
-        BOOST_LOG_TRIVIAL(info) << boost::format("render_thumbnail: plate_idx %1% volumes size %2%, shader %3%, use_top_view=%4%, for_picking=%5%") % plate_idx %
+        BOOST_LOG_TRIVIAL(info) << boost::format("render_thumbnail: plate_idx %1% volumes size %2%, shader %3%, use_top_view=%4%, for_picking=%5%") % thumbnail_params.plate_id %
             visible_volumes.size() % shader.get() % (int)camera_view_angle_type % for_picking;
     }
-    else {
-        visible_volumes = volumes.volumes;
-    }
     //BoundingBoxf3 volumes_box = plate_build_volume;
     BoundingBoxf3 volumes_box;
     volumes_box.min.z() = 0;
@@ -21,6 +21,7 @@
 #include "IMToolbar.hpp"
 #include "slic3r/GUI/3DBed.hpp"
 #include "libslic3r/Slicing.hpp"
+#include "libslic3r/SlicingAdaptive.hpp"
 #include "libslic3r/Point.hpp"
 #include "GLEnums.hpp"
 
@@ -241,6 +242,8 @@ class GLCanvas3D
         float                       m_object_max_z{ 0.0f };
         // Owned by LayersEditing.
         SlicingParameters* m_slicing_parameters{ nullptr };
+        // Faces of m_model_object sorted by Z, cached for repeated recalculation of the adaptive layer height profile.
+        SlicingAdaptive             m_slicing_adaptive;
         std::vector<double>         m_layer_height_profile;
 
         mutable float               m_adaptive_quality{ 0.5f };
@@ -1211,6 +1214,7 @@ private:
 #endif // ENABLE_RENDER_SELECTION_CENTER
     void _check_and_update_toolbar_icon_scale();
     void _render_overlays();
+    void _render_slicing_profile();
     void _render_style_editor();
     void _render_volumes_for_picking() const;
     void _render_current_gizmo() const;
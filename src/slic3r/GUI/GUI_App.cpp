@@ -23,6 +23,7 @@
 #include <cstdlib>
 #include <regex>
 #include <thread>
+#include <chrono>
 #include <string_view>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string.hpp>
@@ -59,6 +60,7 @@
 #include "libslic3r/I18N.hpp"
 #include "libslic3r/PresetBundle.hpp"
 #include "libslic3r/Thread.hpp"
+#include "libslic3r/LRUCache.hpp"
 #include "libslic3r/miniz_extension.hpp"
 #include "libslic3r/Utils.hpp"
 
@@ -1345,38 +1347,42 @@ void GUI_App::post_init()
     DeviceManager::load_filaments_blacklist_config();
 
     // remove old log files over LOG_FILES_MAX_NUM
+    // BBS: in a background thread, the log folder may be large and the startup shall not wait for it.
     std::string log_addr = data_dir();
     if (!log_addr.empty()) {
         auto log_folder = boost::filesystem::path(log_addr) / "log";
-        if (boost::filesystem::exists(log_folder)) {
-           std::vector<std::pair<time_t, std::string>> files_vec;
-           for (auto& it : boost::filesystem::directory_iterator(log_folder)) {
-               auto temp_path = it.path();
-               try {
-                   if (it.status().type() == boost::filesystem::regular_file) {
-                       std::time_t lw_t = boost::filesystem::last_write_time(temp_path) ;
-                       files_vec.push_back({ lw_t, temp_path.filename().string() });
+        Slic3r::create_thread([log_folder] {
+            boost::system::error_code ec;
+            if (boost::filesystem::exists(log_folder, ec)) {
+               std::vector<std::pair<time_t, std::string>> files_vec;
+               for (auto& it : boost::filesystem::directory_iterator(log_folder, ec)) {
+                   auto temp_path = it.path();
+                   try {
+                       if (it.status().type() == boost::filesystem::regular_file) {
+                           std::time_t lw_t = boost::filesystem::last_write_time(temp_path) ;
+                           files_vec.push_back({ lw_t, temp_path.filename().string() });
+                       }
+                   } catch (const std::exception &) {
                    }
-               } catch (const std::exception &) {
                }
-           }
-           std::sort(files_vec.begin(), files_vec.end(), [](
-               std::pair<time_t, std::string> &a, std::pair<time_t, std::string> &b) {
-               return a.first > b.first;
-           });
-
-           while (files_vec.size() > LOG_FILES_MAX_NUM) {
-               auto full_path = log_folder / boost::filesystem::path(files_vec[files_vec.size() - 1].second);
-               BOOST_LOG_TRIVIAL(info) << "delete log file over " << LOG_FILES_MAX_NUM << ", filename: "<< files_vec[files_vec.size() - 1].second;
-               try {
-                   boost::filesystem::remove(full_path);
-               }
-               catch (const std::exception& ex) {
-                   BOOST_LOG_TRIVIAL(error) << "failed to delete log file: "<< files_vec[files_vec.size() - 1].second << ". Error: " << ex.what();
+               std::sort(files_vec.begin(), files_vec.end(), [](
+                   std::pair<time_t, std::string> &a, std::pair<time_t, std::string> &b) {
+                   return a.first > b.first;
+               });
+
+               while (files_vec.size() > LOG_FILES_MAX_NUM) {
+                   auto full_path = log_folder / boost::filesystem::path(files_vec[files_vec.size() - 1].second);
+                   BOOST_LOG_TRIVIAL(info) << "delete log file over " << LOG_FILES_MAX_NUM << ", filename: "<< files_vec[files_vec.size() - 1].second;
+                   try {
+                       boost::filesystem::remove(full_path);
+                   }
+                   catch (const std::exception& ex) {
+                       BOOST_LOG_TRIVIAL(error) << "failed to delete log file: "<< files_vec[files_vec.size() - 1].second << ". Error: " << ex.what();
+                   }
+                   files_vec.pop_back();
                }
-               files_vec.pop_back();
-           }
-        }
+            }
+        }).detach();
     }
     BOOST_LOG_TRIVIAL(info) << "finished post_init";
 #ifdef _WIN32
@@ -2134,9 +2140,7 @@ void GUI_App::init_networking_callbacks()
             if (m_is_closing) {
                 return;
             }
-            CallAfter([this, dev_id, msg] {
-                if (m_is_closing)
-                    return;
+            queue_network_msg([this, dev_id, msg] {
                 this->process_network_msg(dev_id, msg);
 
                 MachineObject* obj = this->m_device_manager->get_user_machine(dev_id);
@@ -2159,8 +2163,7 @@ void GUI_App::init_networking_callbacks()
                     }
                 }
 
-                if (GUI::wxGetApp().plater())
-                    GUI::wxGetApp().plater()->update_machine_sync_status();
+                m_network_msg_update_sync = true;
             });
         };
 
@@ -2170,10 +2173,7 @@ void GUI_App::init_networking_callbacks()
             if (m_is_closing) {
                 return;
             }
-            CallAfter([this, user_id, msg] {
-                if (m_is_closing)
-                    return;
-
+            queue_network_msg([this, user_id, msg] {
                 //check user
                 if (user_id == m_agent->get_user_id()) {
                     this->m_user_manager->parse_json(msg);
@@ -2189,10 +2189,7 @@ void GUI_App::init_networking_callbacks()
             if (m_is_closing) {
                 return;
             }
-            CallAfter([this, dev_id, msg] {
-                if (m_is_closing)
-                    return;
-
+            queue_network_msg([this, dev_id, msg] {
                 this->process_network_msg(dev_id, msg);
                 MachineObject* obj = m_device_manager->get_my_machine(dev_id);
                 if (!obj || !obj->is_lan_mode_printer()) {
@@ -2210,8 +2207,7 @@ void GUI_App::init_networking_callbacks()
                     obj->parse_json(msg, DeviceManager::key_field_only);
                 }
 
-                if (GUI::wxGetApp().plater())
-                    GUI::wxGetApp().plater()->update_machine_sync_status();
+                m_network_msg_update_sync = true;
                 });
         };
         m_agent->set_on_local_message_fn(lan_message_arrive_fn);
@@ -2579,6 +2575,13 @@ std::string get_system_info()
 
 bool GUI_App::on_init_inner()
 {
+    // BBS: log the time spent in the startup stages to track the time to the first shown main frame.
+    const auto init_start = std::chrono::steady_clock::now();
+    auto log_init_stage = [init_start](const char *stage) {
+        BOOST_LOG_TRIVIAL(info) << "startup stage: " << stage << " finished at "
+                                << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - init_start).count() << " ms";
+    };
+
     wxLog::SetActiveTarget(new wxBoostLog());
 #if BBL_RELEASE_TO_PUBLIC
     wxLog::SetLogLevel(wxLOG_Message);
@@ -2689,6 +2692,7 @@ bool GUI_App::on_init_inner()
     init_label_colours();
     init_fonts();
     wxGetApp().Update_dark_mode_flag();
+    log_init_stage("language and fonts");
 
 
 #ifdef _MSW_DARK_MODE
@@ -2730,6 +2734,10 @@ bool GUI_App::on_init_inner()
     app_config->set("version", SLIC3R_VERSION);
     app_config->save();
 
+    // BBS: memory of the slicing caches shared by all plates: slices, multi-material segmentation and tree support volumes.
+    const std::string slicing_cache_size = app_config->get("slicing_cache_size");
+    LRUCacheBase::set_total_capacity(size_t(std::max<long long>(0, std::atoll(slicing_cache_size.c_str()))) << 20);
+
     const auto& p_ogl_manager = get_opengl_manager();
     if (p_ogl_manager) {
         const auto& msaa_type = app_config->get("msaa_type");
@@ -2764,6 +2772,7 @@ bool GUI_App::on_init_inner()
 #endif
         scrn->SetText(_L("Loading configuration")+ dots);
     }
+    log_init_stage("splash screen");
 
     BOOST_LOG_TRIVIAL(info) << "loading systen presets...";
     preset_bundle = new PresetBundle();
@@ -2904,6 +2913,7 @@ bool GUI_App::on_init_inner()
 
     copy_network_if_available();
     on_init_network();
+    log_init_stage("network plugin");
 
     if (m_agent && m_agent->is_user_login()) {
         enable_user_preset_folder(true);
@@ -2923,6 +2933,7 @@ bool GUI_App::on_init_inner()
             show_error(nullptr, ex.what());
         }
     //}
+    log_init_stage("presets");
 
 #ifdef WIN32
 #if !wxVERSION_EQUAL_OR_GREATER_THAN(3,1,3)
@@ -2936,6 +2947,7 @@ bool GUI_App::on_init_inner()
 
     BOOST_LOG_TRIVIAL(info) << "create the main window";
     mainframe = new MainFrame();
+    log_init_stage("main window");
     // hide settings tabs after first Layout
     if (is_editor()) {
         mainframe->select_tab(size_t(0));
@@ -2973,6 +2985,7 @@ bool GUI_App::on_init_inner()
 #endif
     mainframe->Show(true);
     BOOST_LOG_TRIVIAL(info) << "main frame firstly shown";
+    log_init_stage("main frame shown");
 
 //#if BBL_HAS_FIRST_PAGE
     //BBS: set tp3DEditor firstly
@@ -4927,6 +4940,47 @@ void GUI_App::check_cert()
     BOOST_LOG_TRIVIAL(info) << "check_cert";
 }
 
+void GUI_App::queue_network_msg(std::function<void()> fn)
+{
+    std::lock_guard<std::mutex> lock(m_network_msg_mutex);
+    m_network_msg_queue.emplace_back(std::move(fn));
+    // Messages arriving before the main thread gets to the pending delivery join its batch,
+    // thus a burst of messages costs a single event instead of one event per message.
+    if (! m_network_msg_delivery_posted) {
+        m_network_msg_delivery_posted = true;
+        CallAfter([this] { this->deliver_network_msgs(); });
+    }
+}
+
+void GUI_App::deliver_network_msgs()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_network_msg_mutex);
+        m_network_msg_delivery_posted = false;
+    }
+    // The messages are taken from the queue one by one: a message showing a modal dialog runs a nested event loop,
+    // which delivers the messages following it, thus the messages are still processed in their order of arrival.
+    ++ m_network_msg_delivery_depth;
+    Slic3r::ScopeGuard depth_guard([this]() { -- m_network_msg_delivery_depth; });
+    while (! m_is_closing) {
+        std::function<void()> fn;
+        {
+            std::lock_guard<std::mutex> lock(m_network_msg_mutex);
+            if (m_network_msg_queue.empty())
+                break;
+            fn = std::move(m_network_msg_queue.front());
+            m_network_msg_queue.pop_front();
+        }
+        fn();
+    }
+    // The sync status is updated once by the outermost delivery.
+    if (m_network_msg_delivery_depth == 1) {
+        if (m_network_msg_update_sync && ! m_is_closing && GUI::wxGetApp().plater())
+            GUI::wxGetApp().plater()->update_machine_sync_status();
+        m_network_msg_update_sync = false;
+    }
+}
+
 void GUI_App::process_network_msg(std::string dev_id, std::string msg)
 {
     if (dev_id.empty()) {
@@ -28,6 +28,7 @@
 #include <wx/snglinst.h>
 #include <wx/msgdlg.h>
 
+#include <deque>
 #include <mutex>
 #include <stack>
 
@@ -286,6 +287,14 @@ private:
     Slic3r::UserManager* m_user_manager { nullptr };
     Slic3r::TaskManager* m_task_manager { nullptr };
     NetworkAgent* m_agent { nullptr };
+    // Messages of the network agent waiting for the main thread, delivered in batches by a single CallAfter.
+    std::mutex                          m_network_msg_mutex;
+    std::deque<std::function<void()>>   m_network_msg_queue;
+    bool                                m_network_msg_delivery_posted { false };
+    // Nesting of deliveries, a message showing a modal dialog runs a nested event loop.
+    int                                 m_network_msg_delivery_depth { 0 };
+    // Set by the printer messages of the batch being delivered, the sync status is updated once per batch.
+    bool                                m_network_msg_update_sync { false };
     std::vector<std::string> need_delete_presets;   // store setting ids of preset
     std::vector<bool> m_create_preset_blocked { false, false, false, false, false, false }; // excceed limit
     bool m_networking_compatible { false };
@@ -465,6 +474,9 @@ public:
     void            check_new_version(bool show_tips = false, int by_user = 0);
     void            check_cert();
     void            process_network_msg(std::string dev_id, std::string msg);
+    // Called from the network threads, fn is run on the main thread together with the other messages queued meanwhile.
+    void            queue_network_msg(std::function<void()> fn);
+    void            deliver_network_msgs();
     void            check_beta_version();
     void            request_new_version(int by_user);
     void            enter_force_upgrade();
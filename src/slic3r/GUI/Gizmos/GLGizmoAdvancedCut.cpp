@@ -2836,7 +2836,7 @@ PartSelection::PartSelection(
         m_cut_parts[i].is_modifier = !volume->is_model_part();
         m_cut_parts[i].is_up_part = false;
         if (m_cut_parts[i].raycaster) { delete m_cut_parts[i].raycaster; }
-        m_cut_parts[i].raycaster = new MeshRaycaster(volume->mesh());
+        m_cut_parts[i].raycaster = new MeshRaycaster(volume->get_mesh_shared_ptr());
         m_cut_parts[i].glmodel.reset();
         m_cut_parts[i].glmodel.init_from(volume->mesh_ptr()->its);
         m_cut_parts[i].trans = Geometry::translation_transform(inst_offset) * model_object()->volumes[i]->get_matrix();
@@ -2912,7 +2912,7 @@ PartSelection::PartSelection(const ModelObject *object, int instance_idx_in) : m
         assert(volume != nullptr);
         m_cut_parts[i].is_modifier = !volume->is_model_part();
         if (m_cut_parts[i].raycaster) { delete m_cut_parts[i].raycaster; }
-        m_cut_parts[i].raycaster = new MeshRaycaster(volume->mesh());
+        m_cut_parts[i].raycaster = new MeshRaycaster(volume->get_mesh_shared_ptr());
         m_cut_parts[i].glmodel.reset();
         m_cut_parts[i].glmodel.init_from(volume->mesh_ptr()->its);
         m_cut_parts[i].trans    = Geometry::translation_transform(inst_offset) * model_object()->volumes[i]->get_matrix();
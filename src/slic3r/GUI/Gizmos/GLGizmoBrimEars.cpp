@@ -874,6 +874,20 @@ void GLGizmoBrimEars::first_layer_slicer()
     const Selection              &selection = m_parent.get_selection();
     const Selection::IndicesList &idxs      = selection.get_volume_idxs();
     if (idxs.size() <= 0) return;
+    std::vector<FirstLayerSource> sources;
+    for (auto idx : idxs) {
+        const GLVolume    *volume       = selection.get_volume(idx);
+        const ModelVolume *model_volume = get_model_volume(*volume, wxGetApp().model());
+        if (model_volume == nullptr) continue;
+        if (model_volume->type() == ModelVolumeType::MODEL_PART || model_volume->type() == ModelVolumeType::NEGATIVE_VOLUME)
+            sources.push_back({ model_volume->get_mesh_shared_ptr(), model_volume->type(),
+                                volume->get_instance_transformation().get_matrix() * volume->get_volume_transformation().get_matrix() });
+    }
+    if (sources == m_first_layer_sources)
+        // Neither the meshes nor their placement changed since the gizmo was open the last time.
+        return;
+    m_first_layer_sources = std::move(sources);
+
     std::vector<float>  slice_height(1, 0.1);
     MeshSlicingParamsEx params;
     params.mode           = MeshSlicingParams::SlicingMode::Regular;
@@ -882,23 +896,23 @@ void GLGizmoBrimEars::first_layer_slicer()
     params.resolution     = 0.01;
     ExPolygons part_ex;
     ExPolygons negative_ex;
-    for (auto idx : idxs) {
-        const GLVolume    *volume       = selection.get_volume(idx);
-        const ModelVolume *model_volume = get_model_volume(*volume, wxGetApp().model());
-        if (model_volume == nullptr) continue;
-        if (model_volume->type() == ModelVolumeType::MODEL_PART || model_volume->type() == ModelVolumeType::NEGATIVE_VOLUME) {
-            indexed_triangle_set volume_its = model_volume->mesh().its;
-            if (volume_its.indices.size() <= 0) continue;
-            Transform3d         trsf = volume->get_instance_transformation().get_matrix() * volume->get_volume_transformation().get_matrix();
-            MeshSlicingParamsEx params_ex(params);
-            params_ex.trafo = params_ex.trafo * trsf;
-            if (params_ex.trafo.rotation().determinant() < 0.) its_flip_triangles(volume_its);
-            ExPolygons sliced_layer = slice_mesh_ex(volume_its, slice_height, params_ex).front();
-            if (model_volume->type() == ModelVolumeType::MODEL_PART) {
-                part_ex = union_ex(part_ex, sliced_layer);
-            } else {
-                negative_ex = union_ex(negative_ex, sliced_layer);
-            }
+    for (const FirstLayerSource &source : m_first_layer_sources) {
+        const indexed_triangle_set &its = source.mesh->its;
+        if (its.indices.size() <= 0) continue;
+        MeshSlicingParamsEx params_ex(params);
+        params_ex.trafo = params_ex.trafo * source.trafo;
+        ExPolygons sliced_layer;
+        if (params_ex.trafo.rotation().determinant() < 0.) {
+            // Only a mirrored volume needs its own copy of the mesh.
+            indexed_triangle_set volume_its = its;
+            its_flip_triangles(volume_its);
+            sliced_layer = slice_mesh_ex(volume_its, slice_height, params_ex).front();
+        } else
+            sliced_layer = slice_mesh_ex(its, slice_height, params_ex).front();
+        if (source.type == ModelVolumeType::MODEL_PART) {
+            part_ex = union_ex(part_ex, sliced_layer);
+        } else {
+            negative_ex = union_ex(negative_ex, sliced_layer);
         }
     }
     m_first_layer = diff_ex(part_ex, negative_ex);
@@ -4,6 +4,7 @@
 #include "GLGizmoBase.hpp"
 #include "slic3r/GUI/GLSelectionRectangle.hpp"
 #include "libslic3r/BrimEarsPoint.hpp"
+#include "libslic3r/Model.hpp"
 #include "libslic3r/ObjectID.hpp"
 
 
@@ -119,6 +120,15 @@ private:
     GLSelectionRectangle m_selection_rectangle;
 
     ExPolygons m_first_layer;
+    // Volumes m_first_layer was sliced from, the slicing is skipped if the gizmo is opened again over the same geometry.
+    struct FirstLayerSource
+    {
+        std::shared_ptr<const TriangleMesh> mesh;
+        ModelVolumeType                     type;
+        Transform3d                         trafo;
+        bool operator==(const FirstLayerSource &rhs) const { return mesh == rhs.mesh && type == rhs.type && trafo.matrix() == rhs.trafo.matrix(); }
+    };
+    std::vector<FirstLayerSource> m_first_layer_sources;
 
     bool m_wait_for_up_event = false;
     bool m_selection_empty = true;
@@ -468,6 +468,7 @@ void GLGizmoMeasure::on_set_state()
         m_editing_distance = false;
         m_is_editing_distance_first_frame = true;
         std::map<GLVolume *, std::shared_ptr<Measure::Measuring>>().swap(m_mesh_measure_map);
+        std::map<GLVolume *, std::shared_ptr<const TriangleMesh>>().swap(m_mesh_measure_source_map);
     }
     else {
         m_mode = EMode::FeatureSelection;
@@ -2264,7 +2265,14 @@ void GLGizmoMeasure::register_single_mesh_pick()
             } else {
                 m_mesh_raycaster_map[v] = std::make_shared<PickRaycaster>(mesh, -1);
                 m_mesh_raycaster_map[v]->world_tran.set_from_transform(world_tran.get_matrix());
-                m_mesh_measure_map[v] = std::make_shared<Measure::Measuring>(mesh->its);
+                // the raycasters are reset on every selection change, the planes of an unchanged mesh are still valid
+                const ModelVolume *model_volume = get_model_volume(*v, *selection.get_model());
+                std::shared_ptr<const TriangleMesh> source = model_volume != nullptr && model_volume->mesh_ptr() == mesh ? model_volume->get_mesh_shared_ptr() : nullptr;
+                if (auto it = m_mesh_measure_source_map.find(v);
+                    source == nullptr || it == m_mesh_measure_source_map.end() || it->second != source || m_mesh_measure_map.find(v) == m_mesh_measure_map.end()) {
+                    m_mesh_measure_map[v]        = std::make_shared<Measure::Measuring>(mesh->its);
+                    m_mesh_measure_source_map[v] = std::move(source);
+                }
             }
         }
     }
@@ -141,6 +141,9 @@ protected:
     Measure::MeasurementResult m_measurement_result;
     Measure::AssemblyAction    m_assembly_action;
     std::map<GLVolume*, std::shared_ptr<Measure::Measuring>> m_mesh_measure_map;
+    // mesh each of m_mesh_measure_map was extracted from, the features are reused for as long as it stays the same.
+    // The mesh is held, so that another mesh allocated at the same address is not taken for it.
+    std::map<GLVolume*, std::shared_ptr<const TriangleMesh>> m_mesh_measure_source_map;
     std::shared_ptr<Measure::Measuring>                      m_curr_measuring{nullptr};
 
     //first feature
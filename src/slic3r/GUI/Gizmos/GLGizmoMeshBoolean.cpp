@@ -21,6 +21,20 @@ namespace GUI {
 static const std::string warning_text_common       = _u8L("Unable to perform boolean operation on selected parts");
 static const std::string warning_text_intersection = _u8L("Performed boolean intersection fails because the selected parts have no intersection");
 
+static void call_after_if_active(std::function<void()> fn, GUI_App* app = &wxGetApp())
+{
+    if (app == nullptr) return;
+    app->CallAfter([fn, app]() {
+        const Plater *plater = app->plater();
+        if (plater == nullptr) return;
+        const GLCanvas3D *canvas = plater->canvas3D();
+        if (canvas == nullptr) return;
+        // check if mesh boolean is still the active gizmo
+        if (canvas->get_gizmos_manager().get_current_type() != GLGizmosManager::MeshBoolean) return;
+        fn();
+    });
+}
+
 GLGizmoMeshBoolean::GLGizmoMeshBoolean(GLCanvas3D& parent, const std::string& icon_filename, unsigned int sprite_id)
     : GLGizmoBase(parent, icon_filename, sprite_id)
 {
@@ -28,6 +42,9 @@ GLGizmoMeshBoolean::GLGizmoMeshBoolean(GLCanvas3D& parent, const std::string& ic
 
 GLGizmoMeshBoolean::~GLGizmoMeshBoolean()
 {
+    stop_worker_thread_request();
+    if (m_worker.joinable())
+        m_worker.join();
 }
 
 void GLGizmoMeshBoolean::set_src_volume(ModelVolume* mv)
@@ -198,6 +215,7 @@ void GLGizmoMeshBoolean::on_set_state()
         m_selecting_state = MeshBooleanSelectingState::SelectSource;
     }
     else if (m_state == EState::Off) {
+        stop_worker_thread_request();
         m_src.reset();
         m_tool.reset();
         bool m_diff_delete_input = false;
@@ -371,85 +389,28 @@ void GLGizmoMeshBoolean::on_render_input_window(float x, float y, float bottom_l
         m_full_width     = max_tab_length * 3 + space_size *3;
     }
 
-    bool enable_button = m_src.mv && m_tool.mv;
+    bool is_running = is_boolean_running();
+    bool enable_button = m_src.mv && m_tool.mv && !is_running;
     int index =(int) m_operation_mode;
     if (m_operation_mode == MeshBooleanOperation::Union)
     {
-        if (operate_button(_L("Union") + "##btn", enable_button)) {
-            wxBusyCursor          temp_cursor;
-            csg::BooleanFailReason fail_reason;
-            m_warning_texts[index] = check_boolean_possible({m_src.mv, m_tool.mv}, fail_reason);
-            if (m_warning_texts[index] == "" || fail_reason == csg::BooleanFailReason::SelfIntersect) {
-                TriangleMesh temp_src_mesh = m_src.mv->mesh();
-                temp_src_mesh.transform(m_src.trafo);
-                TriangleMesh temp_tool_mesh = m_tool.mv->mesh();
-                temp_tool_mesh.transform(m_tool.trafo);
-                std::vector<TriangleMesh> temp_mesh_resuls;
-                Slic3r::MeshBoolean::mcut::make_boolean(temp_src_mesh, temp_tool_mesh, temp_mesh_resuls, "UNION");
-                if (temp_mesh_resuls.size() != 0) {
-                    generate_new_volume(true, *temp_mesh_resuls.begin());
-                    m_warning_texts[index] = "";
-                }
-                else {
-                    m_warning_texts[index] = warning_text_common;
-                }
-            }
-            m_selecting_state = MeshBooleanSelectingState::SelectSource;
-            m_src.reset();
-            m_tool.reset();
-        }
+        if (operate_button(_L("Union") + "##btn", enable_button))
+            process_boolean(true);
     }
     else if (m_operation_mode == MeshBooleanOperation::Difference) {
         m_imgui->bbl_checkbox(_L("Delete input"), m_diff_delete_input);
-        if (operate_button(_L("Difference") + "##btn", enable_button)) {
-            wxBusyCursor           temp_cursor;
-            csg::BooleanFailReason fail_reason;
-            m_warning_texts[index] = check_boolean_possible({m_src.mv, m_tool.mv}, fail_reason);
-            if (m_warning_texts[index] == "" || fail_reason == csg::BooleanFailReason::SelfIntersect) {
-                TriangleMesh temp_src_mesh = m_src.mv->mesh();
-                temp_src_mesh.transform(m_src.trafo);
-                TriangleMesh temp_tool_mesh = m_tool.mv->mesh();
-                temp_tool_mesh.transform(m_tool.trafo);
-                std::vector<TriangleMesh> temp_mesh_resuls;
-                Slic3r::MeshBoolean::mcut::make_boolean(temp_src_mesh, temp_tool_mesh, temp_mesh_resuls, "A_NOT_B");
-                if (temp_mesh_resuls.size() != 0) {
-                    generate_new_volume(m_diff_delete_input, *temp_mesh_resuls.begin());
-                    m_warning_texts[index] = "";
-                }
-                else {
-                    m_warning_texts[index] = warning_text_common;
-                }
-            }
-            m_selecting_state = MeshBooleanSelectingState::SelectSource;
-            m_src.reset();
-            m_tool.reset();
-        }
+        if (operate_button(_L("Difference") + "##btn", enable_button))
+            process_boolean(m_diff_delete_input);
     }
     else if (m_operation_mode == MeshBooleanOperation::Intersection){
         m_imgui->bbl_checkbox(_L("Delete input"), m_inter_delete_input);
-        if (operate_button(_L("Intersection") + "##btn", enable_button)) {
-            wxBusyCursor           temp_cursor;
-            csg::BooleanFailReason fail_reason;
-            m_warning_texts[index] = check_boolean_possible({m_src.mv, m_tool.mv}, fail_reason);
-            if (m_warning_texts[index] == "" || fail_reason == csg::BooleanFailReason::SelfIntersect) {
-                TriangleMesh temp_src_mesh = m_src.mv->mesh();
-                temp_src_mesh.transform(m_src.trafo);
-                TriangleMesh temp_tool_mesh = m_tool.mv->mesh();
-                temp_tool_mesh.transform(m_tool.trafo);
-                std::vector<TriangleMesh> temp_mesh_resuls;
-                Slic3r::MeshBoolean::mcut::make_boolean(temp_src_mesh, temp_tool_mesh, temp_mesh_resuls, "INTERSECTION");
-                if (temp_mesh_resuls.size() != 0) {
-                    generate_new_volume(m_inter_delete_input, *temp_mesh_resuls.begin());
-                    m_warning_texts[index] = "";
-                }
-                else {
-                    m_warning_texts[index] = warning_text_intersection;
-                }
-            }
-            m_selecting_state = MeshBooleanSelectingState::SelectSource;
-            m_src.reset();
-            m_tool.reset();
-        }
+        if (operate_button(_L("Intersection") + "##btn", enable_button))
+            process_boolean(m_inter_delete_input);
+    }
+    if (is_running) {
+        ImGui::SameLine();
+        ImGui::AlignTextToFramePadding();
+        m_imgui->text(_L("Processing..."));
     }
     if (index >= 0 && index < m_warning_texts.size()) {
         render_input_window_warning(m_warning_texts[index], m_full_width);
@@ -491,6 +452,118 @@ void GLGizmoMeshBoolean::on_save(cereal::BinaryOutputArchive &ar) const
     ar(m_enable, m_operation_mode, m_selecting_state, m_diff_delete_input, m_inter_delete_input, m_src, m_tool);
 }
 
+bool GLGizmoMeshBoolean::is_boolean_running()
+{
+    std::lock_guard lk(m_state_mutex);
+    return m_boolean.status != BooleanState::idle;
+}
+
+void GLGizmoMeshBoolean::process_boolean(bool delete_input)
+{
+    int index = (int)m_operation_mode;
+    csg::BooleanFailReason fail_reason;
+    m_warning_texts[index] = check_boolean_possible({m_src.mv, m_tool.mv}, fail_reason);
+    if (m_warning_texts[index] == "" || fail_reason == csg::BooleanFailReason::SelfIntersect) {
+        if (m_worker.joinable())
+            m_worker.join();
+
+        // The worker must not touch the model, pass it transformed copies of both meshes.
+        auto src_mesh = std::make_unique<TriangleMesh>(m_src.mv->mesh());
+        src_mesh->transform(m_src.trafo);
+        auto tool_mesh = std::make_unique<TriangleMesh>(m_tool.mv->mesh());
+        tool_mesh->transform(m_tool.trafo);
+
+        {
+            std::lock_guard lk(m_state_mutex);
+            m_boolean.status       = BooleanState::running;
+            m_boolean.operation    = m_operation_mode;
+            m_boolean.delete_input = delete_input;
+            m_boolean.src          = m_src;
+            m_boolean.tool         = m_tool;
+            m_boolean.result.reset();
+        }
+
+        std::string operation = m_operation_mode == MeshBooleanOperation::Union ? "UNION" :
+                                m_operation_mode == MeshBooleanOperation::Difference ? "A_NOT_B" : "INTERSECTION";
+        m_worker = std::thread([this, operation](std::unique_ptr<TriangleMesh> src_mesh, std::unique_ptr<TriangleMesh> tool_mesh) {
+            std::vector<TriangleMesh> temp_mesh_resuls;
+            try {
+                Slic3r::MeshBoolean::mcut::make_boolean(*src_mesh, *tool_mesh, temp_mesh_resuls, operation);
+            } catch (...) {
+                temp_mesh_resuls.clear();
+            }
+
+            std::lock_guard lk(m_state_mutex);
+            if (m_boolean.status == BooleanState::cancelling) {
+                // The gizmo was closed, drop the result.
+                m_boolean.status = BooleanState::idle;
+                return;
+            }
+            if (temp_mesh_resuls.size() != 0)
+                m_boolean.result = std::make_unique<TriangleMesh>(std::move(temp_mesh_resuls.front()));
+            m_boolean.status = BooleanState::idle;
+
+            // Apply the result on the UI thread.
+            call_after_if_active([this]() { worker_finished(); });
+        }, std::move(src_mesh), std::move(tool_mesh));
+    }
+    m_selecting_state = MeshBooleanSelectingState::SelectSource;
+    m_src.reset();
+    m_tool.reset();
+}
+
+void GLGizmoMeshBoolean::stop_worker_thread_request()
+{
+    std::lock_guard lk(m_state_mutex);
+    if (m_boolean.status == BooleanState::running)
+        m_boolean.status = BooleanState::cancelling;
+}
+
+// Called from the UI thread through CallAfter when the worker terminates.
+void GLGizmoMeshBoolean::worker_finished()
+{
+    std::unique_ptr<TriangleMesh> result;
+    MeshBooleanOperation          operation;
+    bool                          delete_input;
+    VolumeInfo                    src;
+    VolumeInfo                    tool;
+    {
+        std::lock_guard lk(m_state_mutex);
+        if (m_boolean.status != BooleanState::idle) {
+            // Another boolean was started before this callback was called.
+            return;
+        }
+        result       = std::move(m_boolean.result);
+        operation    = m_boolean.operation;
+        delete_input = m_boolean.delete_input;
+        src          = m_boolean.src;
+        tool         = m_boolean.tool;
+    }
+    if (m_worker.joinable())
+        m_worker.join();
+
+    int index = (int)operation;
+    if (index < 0 || index >= int(m_warning_texts.size()))
+        return;
+
+    // The parts may have been edited or deleted while the boolean was running.
+    const ModelObject* mo = m_c->selection_info() ? m_c->selection_info()->model_object() : nullptr;
+    auto is_valid = [mo](const VolumeInfo& info) {
+        return mo != nullptr && info.volume_idx >= 0 && info.volume_idx < int(mo->volumes.size()) && mo->volumes[info.volume_idx] == info.mv;
+    };
+    if (result && is_valid(src) && is_valid(tool)) {
+        m_src  = src;
+        m_tool = tool;
+        generate_new_volume(delete_input, *result);
+        m_warning_texts[index] = "";
+    }
+    else {
+        m_warning_texts[index] = result || operation != MeshBooleanOperation::Intersection ? warning_text_common : warning_text_intersection;
+    }
+    m_parent.set_as_dirty();
+    m_parent.request_extra_frame();
+}
+
 void GLGizmoMeshBoolean::generate_new_volume(bool delete_input, const TriangleMesh& mesh_result) {
 
     wxGetApp().plater()->take_snapshot("Mesh Boolean");
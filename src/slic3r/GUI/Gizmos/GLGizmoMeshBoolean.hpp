@@ -5,6 +5,9 @@
 #include "GLGizmosCommon.hpp"
 #include "libslic3r/Model.hpp"
 
+#include <mutex>
+#include <thread>
+
 namespace Slic3r {
 
 namespace GUI {
@@ -74,6 +77,28 @@ private:
     VolumeInfo m_src;
     VolumeInfo m_tool;
 
+    // The exact boolean runs on a worker thread, the result is applied on the UI thread.
+    struct BooleanState {
+        enum Status {
+            idle,
+            running,
+            cancelling
+        };
+        Status                        status{ idle };
+        MeshBooleanOperation          operation{ MeshBooleanOperation::Undef };
+        bool                          delete_input{ false };
+        VolumeInfo                    src;
+        VolumeInfo                    tool;
+        std::unique_ptr<TriangleMesh> result;
+    };
+    std::thread  m_worker;
+    std::mutex   m_state_mutex; // guards m_boolean
+    BooleanState m_boolean;     // accessed by both threads
+
+    bool is_boolean_running();
+    void process_boolean(bool delete_input);
+    void stop_worker_thread_request();
+    void worker_finished();
     void generate_new_volume(bool delete_input, const TriangleMesh& mesh_result);
 };
 
@@ -1284,19 +1284,21 @@ void TriangleSelectorGUI::render(ImGuiWrapper* imgui, const Transform3d& matrix)
     assert(shader->get_name() == "gouraud");
     ScopeGuard guard([shader]() { if (shader) shader->set_uniform("offset_depth_buffer", false);});
     shader->set_uniform("offset_depth_buffer", true);
-    for (auto iva : {std::make_pair(&m_iva_enforcers, enforcers_color),
-                     std::make_pair(&m_iva_blockers, blockers_color)}) {
-        iva.first->set_color(iva.second);
-        iva.first->render_geometry();
-    }
+    for (const std::unique_ptr<RenderChunk> &chunk : m_render_chunks) {
+        for (auto iva : {std::make_pair(&chunk->iva_enforcers, enforcers_color),
+                         std::make_pair(&chunk->iva_blockers, blockers_color)}) {
+            iva.first->set_color(iva.second);
+            iva.first->render_geometry();
+        }
 
-    for (auto& iva : m_iva_seed_fills) {
-        size_t                      color_idx = &iva - &m_iva_seed_fills.front();
-        const std::array<float, 4>& color = TriangleSelectorGUI::get_seed_fill_color(color_idx == 1 ? enforcers_color :
-            color_idx == 2 ? blockers_color :
-            GLVolume::NEUTRAL_COLOR);
-        iva.set_color(color);
-        iva.render_geometry();
+        for (auto& iva : chunk->iva_seed_fills) {
+            size_t                      color_idx = &iva - &chunk->iva_seed_fills.front();
+            const std::array<float, 4>& color = TriangleSelectorGUI::get_seed_fill_color(color_idx == 1 ? enforcers_color :
+                color_idx == 2 ? blockers_color :
+                GLVolume::NEUTRAL_COLOR);
+            iva.set_color(color);
+            iva.render_geometry();
+        }
     }
 
     ScopeGuard guard_gouraud([shader]() { wxGetApp().bind_shader(shader); });
@@ -1313,15 +1315,42 @@ void TriangleSelectorGUI::render(ImGuiWrapper* imgui, const Transform3d& matrix)
 }
 
 void TriangleSelectorGUI::update_render_data()
+{
+    const size_t num_chunks = size_t((m_orig_size_indices + RENDER_CHUNK_FACETS - 1) / RENDER_CHUNK_FACETS);
+    if (! this->take_dirty_facets(m_dirty_facets) || m_render_chunks.size() != num_chunks) {
+        // The whole mesh changed, triangulate all chunks.
+        m_render_chunks.clear();
+        m_render_chunks.reserve(num_chunks);
+        for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++ chunk_idx) {
+            m_render_chunks.emplace_back(std::make_unique<RenderChunk>());
+            this->update_render_chunk(*m_render_chunks.back(), int(chunk_idx) * RENDER_CHUNK_FACETS,
+                std::min(int(chunk_idx + 1) * RENDER_CHUNK_FACETS, m_orig_size_indices));
+        }
+    } else if (! m_dirty_facets.empty()) {
+        // Only re-triangulate the chunks containing facets touched since the last update.
+        std::vector<int> dirty_chunks;
+        dirty_chunks.reserve(m_dirty_facets.size());
+        for (int facet_idx : m_dirty_facets)
+            dirty_chunks.emplace_back(facet_idx / RENDER_CHUNK_FACETS);
+        sort_remove_duplicates(dirty_chunks);
+        for (int chunk_idx : dirty_chunks)
+            this->update_render_chunk(*m_render_chunks[chunk_idx], chunk_idx * RENDER_CHUNK_FACETS,
+                std::min((chunk_idx + 1) * RENDER_CHUNK_FACETS, m_orig_size_indices));
+    }
+
+    update_paint_contour();
+}
+
+void TriangleSelectorGUI::update_render_chunk(RenderChunk &chunk, int facet_begin, int facet_end)
 {
     int              enf_cnt = 0;
     int              blc_cnt = 0;
-    std::vector<int> seed_fill_cnt(m_iva_seed_fills.size(), 0);
+    std::vector<int> seed_fill_cnt(chunk.iva_seed_fills.size(), 0);
 
-    for (auto *iva : {&m_iva_enforcers, &m_iva_blockers})
+    for (auto *iva : {&chunk.iva_enforcers, &chunk.iva_blockers})
         iva->reset();
 
-    for (auto &iva : m_iva_seed_fills)
+    for (auto &iva : chunk.iva_seed_fills)
         iva.reset();
 
     GLModel::Geometry iva_enforcers_data;
@@ -1332,13 +1361,9 @@ void TriangleSelectorGUI::update_render_data()
     for (auto& data : iva_seed_fills_data)
         data.format = { GLModel::PrimitiveType::Triangles, GLModel::Geometry::EVertexLayout::P3N3 };
 
-    for (const Triangle &tr : m_triangles) {
-        bool is_valid = tr.valid();
-        bool is_split = tr.is_split();
-        EnforcerBlockerType type = tr.get_state();
-        bool is_select_by_seed_fill = tr.is_selected_by_seed_fill();
-        if (!tr.valid() || tr.is_split() || (tr.get_state() == EnforcerBlockerType::NONE && !tr.is_selected_by_seed_fill()))
-            continue;
+    auto append_triangle = [&](const Triangle &tr) {
+        if (tr.get_state() == EnforcerBlockerType::NONE && !tr.is_selected_by_seed_fill())
+            return;
 
         int tr_state = int(tr.get_state());
         GLModel::Geometry& iva = tr.is_selected_by_seed_fill()                   ? iva_seed_fills_data[tr_state] :
@@ -1358,18 +1383,18 @@ void TriangleSelectorGUI::update_render_data()
         iva.add_vertex(v2, n);
         iva.add_triangle((unsigned int)cnt, (unsigned int)cnt + 1, (unsigned int)cnt + 2);
         cnt += 3;
-    }
+    };
+    for (int facet_idx = facet_begin; facet_idx < facet_end; ++ facet_idx)
+        this->for_each_leaf_triangle(facet_idx, append_triangle);
 
     if (!iva_enforcers_data.is_empty())
-        m_iva_enforcers.init_from(std::move(iva_enforcers_data));
+        chunk.iva_enforcers.init_from(std::move(iva_enforcers_data));
     if (!iva_blockers_data.is_empty())
-        m_iva_blockers.init_from(std::move(iva_blockers_data));
-    for (size_t i = 0; i < m_iva_seed_fills.size(); ++i) {
+        chunk.iva_blockers.init_from(std::move(iva_blockers_data));
+    for (size_t i = 0; i < chunk.iva_seed_fills.size(); ++i) {
         if (!iva_seed_fills_data[i].is_empty())
-            m_iva_seed_fills[i].init_from(std::move(iva_seed_fills_data[i]));
+            chunk.iva_seed_fills[i].init_from(std::move(iva_seed_fills_data[i]));
     }
-
-    update_paint_contour();
 }
 
 void TriangleSelectorGUI::update_paint_contour()
@@ -1477,48 +1502,34 @@ void TriangleSelectorPatch::render(ImGuiWrapper* imgui, const Transform3d& matri
 
 void TriangleSelectorPatch::update_triangles_per_type()
 {
-    //BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", enter");
-    m_triangle_patches.resize((int)EnforcerBlockerType::ExtruderMax + 1);
-    for (int i = 0; i < m_triangle_patches.size(); i++) {
-        auto& patch = m_triangle_patches[i];
-        patch.type = (EnforcerBlockerType)i;
-        patch.triangle_indices.reserve(m_triangles.size() / 3);
-    }
-
-    for (auto& triangle : m_triangles) {
-        if (!triangle.valid() || triangle.is_split())
-            continue;
+    const int num_chunks = (m_orig_size_indices + RENDER_CHUNK_FACETS - 1) / RENDER_CHUNK_FACETS;
+    m_triangle_patches.assign(size_t(num_chunks) * PATCH_TYPES, TrianglePatch());
+    for (int chunk_idx = 0; chunk_idx < num_chunks; ++ chunk_idx)
+        update_triangles_per_type_chunk(chunk_idx);
+}
 
-        int state = (int)triangle.get_state();
-        auto& patch = m_triangle_patches[state];
-        //patch.triangle_indices.insert(patch.triangle_indices.end(), triangle.verts_idxs.begin(), triangle.verts_idxs.end());
-        for (int i = 0; i < 3; ++i) {
-            int j = triangle.verts_idxs[i];
-            int index = int(patch.patch_vertices.size() / 6);
-            //BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", Line %1%: i=%2%, j=%3%, index=%4%, v[%5%,%6%,%7%]")%__LINE__%i%j%index%m_vertices[j].v(0)%m_vertices[j].v(1)%m_vertices[j].v(2);
-            patch.patch_vertices.emplace_back(m_vertices[j].v(0));
-            patch.patch_vertices.emplace_back(m_vertices[j].v(1));
-            patch.patch_vertices.emplace_back(m_vertices[j].v(2));
-            if (i == 0) {
-                patch.patch_vertices.emplace_back(1.0);
-                patch.patch_vertices.emplace_back(0.0);
-                patch.patch_vertices.emplace_back(0.0);
-            }
-            else if (i == 1) {
-                patch.patch_vertices.emplace_back(0.0);
-                patch.patch_vertices.emplace_back(1.0);
-                patch.patch_vertices.emplace_back(0.0);
-            }
-            else {
-                patch.patch_vertices.emplace_back(0.0);
-                patch.patch_vertices.emplace_back(0.0);
-                patch.patch_vertices.emplace_back(1.0);
-            }
-            patch.triangle_indices.emplace_back( index);
+void TriangleSelectorPatch::update_triangles_per_type_chunk(int chunk_idx)
+{
+    TrianglePatch *patches = m_triangle_patches.data() + size_t(chunk_idx) * PATCH_TYPES;
+    for (int i = 0; i < PATCH_TYPES; ++ i) {
+        patches[i].type = EnforcerBlockerType(i);
+        patches[i].patch_vertices.clear();
+        patches[i].triangle_indices.clear();
+    }
+
+    auto append_triangle = [this, patches](const Triangle &triangle) {
+        TrianglePatch &patch = patches[int(triangle.get_state())];
+        for (int i = 0; i < 3; ++ i) {
+            const Vec3f &v     = m_vertices[triangle.verts_idxs[i]].v;
+            int          index = int(patch.patch_vertices.size() / 6);
+            // position followed by the barycentric coordinates used for the wireframe
+            patch.patch_vertices.insert(patch.patch_vertices.end(), { v.x(), v.y(), v.z(), i == 0 ? 1.f : 0.f, i == 1 ? 1.f : 0.f, i == 2 ? 1.f : 0.f });
+            patch.triangle_indices.emplace_back(index);
         }
-        //BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", Line %1%: state=%2%, vertice size=%3%, triangle size %4%")%__LINE__%state%patch.patch_vertices.size()%patch.triangle_indices.size();
-    }
-    //BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format("exit");
+    };
+    const int facet_end = std::min((chunk_idx + 1) * RENDER_CHUNK_FACETS, m_orig_size_indices);
+    for (int facet_idx = chunk_idx * RENDER_CHUNK_FACETS; facet_idx < facet_end; ++ facet_idx)
+        this->for_each_leaf_triangle(facet_idx, append_triangle);
 }
 
 void TriangleSelectorPatch::update_selector_triangles()
@@ -1532,6 +1543,7 @@ void TriangleSelectorPatch::update_selector_triangles()
             m_triangles[facet_idx].set_state(type);
         }
     }
+    this->mark_all_facets_dirty();
 }
 
 void TriangleSelectorPatch::update_triangles_per_patch()
@@ -1667,21 +1679,41 @@ void TriangleSelectorPatch::update_render_data()
 {
     //BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", m_paint_changed=%1%, m_triangle_patches.size %2%")%m_paint_changed%m_triangle_patches.size();
     if (m_paint_changed || (m_triangle_patches.size() == 0)) {
-        this->release_geometry();
+        std::vector<int> dirty_facets;
+        if (! m_filter_state && m_patches_per_type_chunks && this->take_dirty_facets(dirty_facets)) {
+            // Only rebuild the chunks containing facets touched since the last update.
+            std::vector<int> dirty_chunks;
+            dirty_chunks.reserve(dirty_facets.size());
+            for (int facet_idx : dirty_facets)
+                dirty_chunks.emplace_back(facet_idx / RENDER_CHUNK_FACETS);
+            sort_remove_duplicates(dirty_chunks);
+            for (int chunk_idx : dirty_chunks) {
+                const size_t buffer_begin = size_t(chunk_idx) * PATCH_TYPES;
+                this->release_geometry(buffer_begin, buffer_begin + PATCH_TYPES);
+                update_triangles_per_type_chunk(chunk_idx);
+                this->finalize_triangle_indices(buffer_begin, buffer_begin + PATCH_TYPES);
+            }
+        } else {
+            this->release_geometry();
 
-        /*m_patch_vertices.reserve(m_vertices.size() * 3);
-        for (const Vertex& vr : m_vertices) {
-            m_patch_vertices.emplace_back(vr.v.x());
-            m_patch_vertices.emplace_back(vr.v.y());
-            m_patch_vertices.emplace_back(vr.v.z());
-        }
-        this->finalize_vertices();*/
+            /*m_patch_vertices.reserve(m_vertices.size() * 3);
+            for (const Vertex& vr : m_vertices) {
+                m_patch_vertices.emplace_back(vr.v.x());
+                m_patch_vertices.emplace_back(vr.v.y());
+                m_patch_vertices.emplace_back(vr.v.z());
+            }
+            this->finalize_vertices();*/
 
-        if (m_filter_state)
-            update_triangles_per_patch();
-        else
-            update_triangles_per_type();
-        this->finalize_triangle_indices();
+            if (m_filter_state)
+                update_triangles_per_patch();
+            else {
+                // The full rebuild covers the facets changed so far, track the changes from now on.
+                this->take_dirty_facets(dirty_facets);
+                update_triangles_per_type();
+            }
+            this->finalize_triangle_indices();
+            m_patches_per_type_chunks = ! m_filter_state;
+        }
 
         m_paint_changed = false;
     }
@@ -1762,10 +1794,23 @@ void TriangleSelectorPatch::release_geometry()
         triangle_indices_VBO_id = 0;
     }
     this->clear();
+    m_patches_per_type_chunks = false;
 
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", Line %1%: released geometry")%__LINE__;
 }
 
+void TriangleSelectorPatch::release_geometry(size_t buffer_begin, size_t buffer_end)
+{
+    for (size_t buffer_idx = buffer_begin; buffer_idx < buffer_end; ++ buffer_idx) {
+        for (unsigned int *VBO_id : { &m_vertices_VBO_ids[buffer_idx], &m_triangle_indices_VBO_ids[buffer_idx] })
+            if (*VBO_id != 0) {
+                glsafe(::glDeleteBuffers(1, VBO_id));
+                *VBO_id = 0;
+            }
+        m_triangle_indices_sizes[buffer_idx] = 0;
+    }
+}
+
 void TriangleSelectorPatch::finalize_vertices()
 {
     /*assert(m_vertices_VBO_id == 0);
@@ -1784,8 +1829,12 @@ void TriangleSelectorPatch::finalize_triangle_indices()
     m_triangle_indices_VBO_ids.resize(m_triangle_patches.size());
     m_triangle_indices_sizes.resize(m_triangle_patches.size());
     assert(std::all_of(m_triangle_indices_VBO_ids.cbegin(), m_triangle_indices_VBO_ids.cend(), [](const auto& ti_VBO_id) { return ti_VBO_id == 0; }));
+    this->finalize_triangle_indices(0, m_triangle_patches.size());
+}
 
-    for (size_t buffer_idx = 0; buffer_idx < m_triangle_patches.size(); ++buffer_idx) {
+void TriangleSelectorPatch::finalize_triangle_indices(size_t buffer_begin, size_t buffer_end)
+{
+    for (size_t buffer_idx = buffer_begin; buffer_idx < buffer_end; ++buffer_idx) {
         std::vector<float>& patch_vertices = m_triangle_patches[buffer_idx].patch_vertices;
         if (!patch_vertices.empty()) {
             glsafe(::glGenBuffers(1, &m_vertices_VBO_ids[buffer_idx]));
@@ -103,12 +103,22 @@ protected:
 
     static std::array<float, 4> get_seed_fill_color(const std::array<float, 4> &base_color);
 
+    // BBS: The painted triangles are rendered in chunks of consecutive facets of the source mesh,
+    // so that a brush stroke only re-triangulates and uploads the chunks it touched.
+    static constexpr int RENDER_CHUNK_FACETS = 4096;
+
 private:
     void update_render_data();
 
-    GLModel                m_iva_enforcers;
-    GLModel                m_iva_blockers;
-    std::array<GLModel, 3> m_iva_seed_fills;
+    struct RenderChunk {
+        GLModel                iva_enforcers;
+        GLModel                iva_blockers;
+        std::array<GLModel, 3> iva_seed_fills;
+    };
+    void update_render_chunk(RenderChunk &chunk, int facet_begin, int facet_end);
+
+    std::vector<std::unique_ptr<RenderChunk>> m_render_chunks;
+    std::vector<int>                          m_dirty_facets;
     std::array<GLModel, 3> m_varrays;
 
 protected:
@@ -206,6 +216,15 @@ protected:
 private:
     void update_render_data();
     void render(int buffer_idx);
+
+    // BBS: In the per type mode, m_triangle_patches holds one patch per EnforcerBlockerType for each chunk of RENDER_CHUNK_FACETS
+    // source facets, so that a brush stroke only rebuilds and uploads the patches of the chunks it touched.
+    static constexpr int PATCH_TYPES = int(EnforcerBlockerType::ExtruderMax) + 1;
+    void update_triangles_per_type_chunk(int chunk_idx);
+    void release_geometry(size_t buffer_begin, size_t buffer_end);
+    void finalize_triangle_indices(size_t buffer_begin, size_t buffer_end);
+    // m_triangle_patches are laid out in chunks by update_triangles_per_type().
+    bool                        m_patches_per_type_chunks = false;
 };
 
 
@@ -328,22 +328,25 @@ void Raycaster::on_update()
         if (hollowed_mesh_tracker && hollowed_mesh_tracker->get_hollowed_mesh())
             meshes.push_back(hollowed_mesh_tracker->get_hollowed_mesh());
     }
+    // volume meshes are shared, so that their raycasters can reuse the cached AABB trees
+    std::vector<std::shared_ptr<const TriangleMesh>> shared_meshes;
     if (meshes.empty()) {
         for (const ModelVolume* mv : mvs) {
-            if (m_only_support_model_part) {
-                if (mv->is_model_part()) {
-                    meshes.push_back(&mv->mesh());
-                }
-            } else {
-                meshes.push_back(&mv->mesh());
-            }
+            if (m_only_support_model_part && !mv->is_model_part())
+                continue;
+            meshes.push_back(&mv->mesh());
+            shared_meshes.push_back(mv->get_mesh_shared_ptr());
         }
     }
 
     if (meshes != m_old_meshes) {
         m_raycasters.clear();
-        for (const TriangleMesh* mesh : meshes)
-            m_raycasters.emplace_back(new MeshRaycaster(*mesh));
+        for (size_t i = 0; i < meshes.size(); ++i) {
+            if (i < shared_meshes.size() && shared_meshes[i])
+                m_raycasters.emplace_back(new MeshRaycaster(shared_meshes[i]));
+            else
+                m_raycasters.emplace_back(new MeshRaycaster(*meshes[i]));
+        }
         m_old_meshes = meshes;
     }
 }
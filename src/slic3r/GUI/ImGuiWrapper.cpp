@@ -376,6 +376,18 @@ void ImGuiWrapper::set_language(const std::string &language)
         0x1EA0, 0x1EF9,
         0,
     };
+    // The ideographs and Hangul syllables are added on demand, see collect_missing_glyphs().
+    static const ImWchar ranges_cjk[] =
+    {
+        0x0020, 0x00FF, // Basic Latin + Latin Supplement
+        0x2000, 0x206F, // General Punctuation
+        0x3000, 0x30FF, // CJK Symbols and Punctuations, Hiragana, Katakana
+        0x3131, 0x3163, // Korean alphabets
+        0x31F0, 0x31FF, // Katakana Phonetic Extensions
+        0xFF00, 0xFFEF, // Half-width characters
+        0,
+    };
+    const bool was_korean = m_is_korean;
     m_font_cjk = false;
     m_is_korean = false;
     if (lang == "cs" || lang == "pl") {
@@ -386,22 +398,13 @@ void ImGuiWrapper::set_language(const std::string &language)
         ranges = ranges_turkish;
     } else if (lang == "vi") {
         ranges = ranges_vietnamese;
-    } else if (lang == "ja") {
-        ranges = ImGui::GetIO().Fonts->GetGlyphRangesJapanese(); // Default + Hiragana, Katakana, Half-Width, Selection of 1946 Ideographs
+    } else if (lang == "ja" || lang == "zh") {
+        ranges = ranges_cjk;
         m_font_cjk = true;
     } else if (lang == "ko") {
-        ranges = ImGui::GetIO().Fonts->GetGlyphRangesKorean(); // Default + Korean characters
+        ranges = ranges_cjk;
         m_font_cjk = true;
         m_is_korean = true;
-    } else if (lang == "zh") {
-        ranges = (language == "zh_TW") ?
-            // Traditional Chinese
-            // Default + Half-Width + Japanese Hiragana/Katakana + full set of about 21000 CJK Unified Ideographs
-            ImGui::GetIO().Fonts->GetGlyphRangesChineseFull() :
-            // Simplified Chinese
-            // Default + Half-Width + Japanese Hiragana/Katakana + set of 2500 CJK Unified Ideographs for common simplified Chinese
-            ImGui::GetIO().Fonts->GetGlyphRangesChineseSimplifiedCommon();
-        m_font_cjk = true;
     } else if (lang == "th") {
         ranges = ImGui::GetIO().Fonts->GetGlyphRangesThai(); // Default + Thai characters
     }
@@ -412,8 +415,9 @@ void ImGuiWrapper::set_language(const std::string &language)
         ranges = ImGui::GetIO().Fonts->GetGlyphRangesOthers();
     }
 
-    if (ranges != m_glyph_ranges) {
+    if (ranges != m_glyph_ranges || m_is_korean != was_korean) {
         m_glyph_ranges = ranges;
+        m_glyphs_on_demand.clear();
         //destroy_fonts_texture();
         destroy_font();
     }
@@ -552,6 +556,14 @@ void ImGuiWrapper::render()
     ImGui::Render();
     render_draw_data(ImGui::GetDrawData());
     m_new_frame_open = false;
+
+    if (m_font_cjk && collect_missing_glyphs()) {
+        // Rebuild the font atlas with the new glyphs by the next new_frame() and render the frame again.
+        destroy_font();
+#if ENABLE_ENHANCED_IMGUI_SLIDER_FLOAT
+        set_requires_extra_frame();
+#endif // ENABLE_ENHANCED_IMGUI_SLIDER_FLOAT
+    }
 }
 
 ImVec2 ImGuiWrapper::calc_text_size_new(std::string_view text, bool hide_text_after_double_hash, float wrap_width)
@@ -2592,6 +2604,8 @@ void ImGuiWrapper::init_font(bool compress)
     ImFontAtlas::GlyphRangesBuilder builder;
     builder.AddRanges(m_glyph_ranges);
     builder.AddRanges(ImGui::GetIO().Fonts->GetGlyphRangesDefault());
+    for (ImWchar c : m_glyphs_on_demand)
+        builder.AddChar(c);
 #ifdef __APPLE__
     if (m_font_cjk)
         // Apple keyboard shortcuts are only contained in the CJK fonts.
@@ -3029,6 +3043,18 @@ void ImGuiWrapper::destroy_font()
     }
 }
 
+bool ImGuiWrapper::collect_missing_glyphs()
+{
+    bool added = false;
+    for (ImFont *font : ImGui::GetIO().Fonts->Fonts) {
+        // A character missing in the font file stays in m_glyphs_on_demand, thus it triggers just a single rebuild.
+        for (ImWchar c : font->MissingGlyphs)
+            added |= m_glyphs_on_demand.insert(c).second;
+        font->MissingGlyphs.clear();
+    }
+    return added;
+}
+
 void ImGuiWrapper::destroy_fonts_texture() {
     //if (m_font_another_texture != 0) {
     //    if (m_new_frame_open) {
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <map>
+#include <set>
 
 #include <imgui/imgui.h>
 
@@ -51,6 +52,9 @@ class ImGuiWrapper
     // Chinese, Japanese, Korean
     bool m_font_cjk{ false };
     bool m_is_korean{ false };
+    // The ideographs and Hangul syllables of the CJK fonts are rasterized once they are rendered for the first time,
+    // instead of rasterizing tens of thousands of them up front.
+    std::set<ImWchar> m_glyphs_on_demand;
     float m_font_size{ 18.0 };
     unsigned m_font_texture{ 0 };
     unsigned m_font_another_texture{ 0 };
@@ -382,6 +386,8 @@ private:
     void render_draw_data(ImDrawData *draw_data);
     bool display_initialized() const;
     void destroy_font();
+    // Move the characters rendered with the fallback glyph into m_glyphs_on_demand, returns true if there were new ones.
+    bool collect_missing_glyphs();
     std::vector<unsigned char> load_svg(const std::string& bitmap_name, unsigned target_width, unsigned target_height, unsigned *outwidth, unsigned *outheight);
 
     static const char* clipboard_get(void* user_data);
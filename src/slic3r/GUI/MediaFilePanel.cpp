@@ -262,6 +262,7 @@ void MediaFilePanel::SetMachineObject(MachineObject* obj)
     } else {
         boost::shared_ptr<PrinterFileSystem> fs(new PrinterFileSystem);
         fs->Attached();
+        fs->SetThumbnailCacheDir(data_dir() + "/cache/printer_thumbnails/" + m_machine);
         m_image_grid->SetFileSystem(fs);
         m_image_grid->SetFileType(m_last_type, m_external ? "" : "internal");
         fs->Bind(EVT_FILE_CHANGED, [this, wfs = boost::weak_ptr(fs)](auto &e) {
@@ -50,6 +50,7 @@ void MeshClipper::set_mesh(const TriangleMesh& mesh)
 {
     if (m_mesh != &mesh) {
         m_mesh = &mesh;
+        m_slicer.reset();
         reset();
     }
 }
@@ -58,6 +59,7 @@ void MeshClipper::set_negative_mesh(const TriangleMesh& mesh)
 {
     if (m_negative_mesh != &mesh) {
         m_negative_mesh = &mesh;
+        m_negative_slicer.reset();
         reset();
     }
 }
@@ -204,14 +206,30 @@ void MeshClipper::recalculate_triangles()
     MeshSlicingParams slicing_params;
     slicing_params.trafo.rotate(Eigen::Quaternion<double, Eigen::DontAlign>::FromTwoVectors(up, Vec3d::UnitZ()));
 
+    // The slicers are only built once the plane was moved without changing its direction,
+    // rotating the plane slices the full meshes as before.
+    bool same_direction = m_slicing_trafo && m_slicing_trafo->matrix().isApprox(slicing_params.trafo.matrix());
+    if (! same_direction) {
+        m_slicing_trafo = slicing_params.trafo;
+        m_slicer.reset();
+        m_negative_slicer.reset();
+    }
+    auto slice = [&slicing_params, height_mesh, same_direction](const TriangleMesh &mesh, std::unique_ptr<ParallelPlanesSlicer> &slicer) {
+        if (! same_direction)
+            return slice_mesh(mesh.its, height_mesh, slicing_params);
+        if (! slicer)
+            slicer = std::make_unique<ParallelPlanesSlicer>(mesh.its, slicing_params);
+        return slicer->slice(height_mesh);
+    };
+
     ExPolygons expolys;
 
     // if (m_csgmesh.empty()) {
     if (m_mesh) {
-        expolys = union_ex(slice_mesh(m_mesh->its, height_mesh, slicing_params));
+        expolys = union_ex(slice(*m_mesh, m_slicer));
     }
     if (m_negative_mesh && !m_negative_mesh->empty()) {
-        const ExPolygons neg_expolys = union_ex(slice_mesh(m_negative_mesh->its, height_mesh, slicing_params));
+        const ExPolygons neg_expolys = union_ex(slice(*m_negative_mesh, m_negative_slicer));
         expolys                      = diff_ex(expolys, neg_expolys);
     }
 
@@ -434,6 +452,14 @@ MeshRaycaster::MeshRaycaster(const TriangleMesh &mesh)
     ;
 }
 
+MeshRaycaster::MeshRaycaster(std::shared_ptr<const TriangleMesh> mesh)
+    : m_mesh(std::move(mesh))
+    , m_emesh(m_mesh, true) // calculate epsilon for triangle-ray intersection from an average edge length
+    , m_normals(its_face_normals(m_mesh->its))
+{
+    ;
+}
+
 void MeshRaycaster::line_from_mouse_pos_static(const Vec2d &mouse_pos, const Transform3d &trafo, const Camera &camera, Vec3d &point, Vec3d &direction)
 {
     CameraUtils::ray_from_screen_pos(camera, mouse_pos, point, direction);
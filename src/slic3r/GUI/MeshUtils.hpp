@@ -13,6 +13,8 @@
 
 namespace Slic3r {
 
+class ParallelPlanesSlicer;
+
 namespace GUI {
 
 struct Camera;
@@ -118,6 +120,12 @@ private:
     const TriangleMesh *      m_mesh          = nullptr;
     const TriangleMesh *      m_negative_mesh = nullptr;
 
+    // While the plane only moves along its normal (e.g. dragging the cut plane), the meshes are sliced
+    // by slicers caching the vertex heights in the plane direction.
+    std::optional<Transform3d>            m_slicing_trafo;
+    std::unique_ptr<ParallelPlanesSlicer> m_slicer;
+    std::unique_ptr<ParallelPlanesSlicer> m_negative_slicer;
+
     ClippingPlane m_plane;
     ClippingPlane m_limiting_plane = ClippingPlane::ClipsNothing();
     /*std::vector<Vec2f> m_triangles2d;
@@ -152,6 +160,8 @@ public:
     // The class references extern TriangleMesh, which must stay alive
     // during MeshRaycaster existence.
     MeshRaycaster(const TriangleMesh &mesh);
+    // Shares the mesh and reuses the AABB tree cached for it while the mesh lives.
+    MeshRaycaster(std::shared_ptr<const TriangleMesh> mesh);
 
     static void line_from_mouse_pos_static(const Vec2d &mouse_pos, const Transform3d &trafo,
         const Camera &camera, Vec3d &point, Vec3d &direction);
@@ -208,6 +218,7 @@ public:
     Vec3f get_triangle_normal(size_t facet_idx) const;
 
 private:
+    std::shared_ptr<const TriangleMesh> m_mesh; // only set when constructed from a shared mesh
     sla::IndexedMesh m_emesh;
     std::vector<stl_normal> m_normals;
 };
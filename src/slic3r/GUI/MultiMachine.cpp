@@ -28,8 +28,10 @@ void DeviceItem::on_refresh(wxCommandEvent& evt)
     Refresh();
 }
 
-void DeviceItem::sync_state()
+bool DeviceItem::sync_state()
 {
+    auto old_state = std::make_tuple(state_online, state_dev_name, state_printable, state_enable_ams, state_device,
+                                     state_progress, state_left_time, state_stage, state_subtask_name);
     if (obj_) {
         state_online = obj_->is_online();
         state_dev_name = obj_->dev_name;
@@ -87,7 +89,14 @@ void DeviceItem::sync_state()
         else {
             state_device = 7;
         }
+
+        state_progress     = obj_->subtask_ ? obj_->subtask_->task_progress : -1;
+        state_left_time    = obj_->mc_left_time;
+        state_stage        = obj_->get_curr_stage();
+        state_subtask_name = obj_->subtask_name;
     }
+    return old_state != std::make_tuple(state_online, state_dev_name, state_printable, state_enable_ams, state_device,
+                                        state_progress, state_left_time, state_stage, state_subtask_name);
 }
 
 void DeviceItem::selected()
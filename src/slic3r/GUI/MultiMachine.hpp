@@ -4,6 +4,7 @@
 #include "GUI_Utils.hpp"
 #include "DeviceManager.hpp"
 #include <functional>
+#include <tuple>
 
 namespace Slic3r {
 namespace GUI {
@@ -34,6 +35,11 @@ public:
     int             state_cloud_task{ 0 };  //0-printing 1-printing finish 2-printing failed
     int             state_optional{0}; //0-Not optional 1-Optional
     std::string     m_send_time;
+    // Progress of the current print, only used to detect changes of what is shown by the items.
+    int             state_progress{ -1 };
+    int             state_left_time{ 0 };
+    wxString        state_stage;
+    std::string     state_subtask_name;
 
 public:
     
@@ -41,7 +47,8 @@ public:
     ~DeviceItem() {};
 
     void on_refresh(wxCommandEvent& evt);
-    void sync_state();
+    // Returns true if any of the shown states changed since the last call.
+    bool sync_state();
     wxString get_state_printable();
     wxString get_state_device();
     wxString get_local_state_task();
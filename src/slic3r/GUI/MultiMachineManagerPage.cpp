@@ -528,9 +528,10 @@ MultiMachineManagerPage::MultiMachineManagerPage(wxWindow* parent)
 
 void MultiMachineManagerPage::update_page()
 {
+    // Only the items of the current page exist, repaint those whose state changed.
     for (int i = 0; i < m_device_items.size(); i++) {
-        m_device_items[i]->sync_state();
-        m_device_items[i]->Refresh();
+        if (m_device_items[i]->sync_state())
+            m_device_items[i]->Refresh();
     }
 }
 
@@ -810,7 +810,14 @@ void ObjColorPanel::deal_algo(char cluster_number, bool redraw_ui)
     }
     wxBusyCursor cursor;
     m_last_cluster_number = cluster_number;
-    obj_color_deal_algo(m_input_colors, m_cluster_colors_from_algo, m_cluster_labels_from_algo, cluster_number,g_max_color);
+    if (auto it = m_algo_results_cache.find(cluster_number); it != m_algo_results_cache.end()) {
+        m_cluster_colors_from_algo = it->second.first;
+        m_cluster_labels_from_algo = it->second.second;
+    } else {
+        const char requested_cluster_number = cluster_number;
+        obj_color_deal_algo(m_input_colors, m_cluster_colors_from_algo, m_cluster_labels_from_algo, cluster_number, g_max_color);
+        m_algo_results_cache.emplace(requested_cluster_number, std::make_pair(m_cluster_colors_from_algo, m_cluster_labels_from_algo));
+    }
 
     m_cluster_colours.clear();
     m_cluster_colours.reserve(m_cluster_colors_from_algo.size());
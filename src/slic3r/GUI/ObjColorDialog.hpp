@@ -5,6 +5,7 @@
 #include "Camera.hpp"
 #include "GuiColor.hpp"
 #include "libslic3r/Format/OBJ.hpp"
+#include <map>
 #include <wx/sizer.h>
 #include <wx/spinctrl.h>
 #include <wx/stattext.h>
@@ -98,6 +99,8 @@ private:
     //algo result
     std::vector<Slic3r::RGBA> m_cluster_colors_from_algo;
     std::vector<int>          m_cluster_labels_from_algo;
+    // results of the previous requested cluster numbers, the dialog often switches back and forth between them
+    std::map<char, std::pair<std::vector<Slic3r::RGBA>, std::vector<int>>> m_algo_results_cache;
     //result
     bool                        m_is_add_filament{false};
     unsigned char&             m_first_extruder_id;
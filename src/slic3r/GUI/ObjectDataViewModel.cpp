@@ -621,6 +621,8 @@ wxDataViewItem ObjectDataViewModel::AddObject(ModelObject *model_object, std::st
     }
 
     m_objects.push_back(obj_node);
+    if (m_object_ids.size() + 1 == m_objects.size())
+        m_object_ids.emplace(obj_node, int(m_objects.size()) - 1);
     plate_node->GetChildren().push_back(obj_node);
 
     // notify control
@@ -987,6 +989,7 @@ wxDataViewItem ObjectDataViewModel::Delete(const wxDataViewItem &item)
                 i = (*it)->GetChildCount() - 1;
             }
             m_objects.erase(it);
+            m_object_ids.clear();
             node_parent->GetChildren().Remove(node);
         }
 
@@ -1195,6 +1198,7 @@ void ObjectDataViewModel::ResetAll()
     m_plates.clear();
     m_plate_outside = nullptr;
     m_objects.clear();
+    m_object_ids.clear();
 
     AddOutsidePlate();
 }
@@ -1408,12 +1412,18 @@ int ObjectDataViewModel::GetIdByItem(const wxDataViewItem& item) const
 	if(!item.IsOk())
         return -1;
 
-	ObjectDataViewModelNode *node = static_cast<ObjectDataViewModelNode*>(item.GetID());
-	auto it = find(m_objects.begin(), m_objects.end(), node);
-	if (it == m_objects.end())
-		return -1;
+	return GetObjectIndex(static_cast<ObjectDataViewModelNode*>(item.GetID()));
+}
 
-	return it - m_objects.begin();
+int ObjectDataViewModel::GetObjectIndex(const ObjectDataViewModelNode* node) const
+{
+    if (m_object_ids.size() != m_objects.size()) {
+        m_object_ids.clear();
+        for (size_t i = 0; i < m_objects.size(); ++ i)
+            m_object_ids.emplace(m_objects[i], int(i));
+    }
+    auto it = m_object_ids.find(node);
+    return it == m_object_ids.end() ? -1 : it->second;
 }
 
 int  ObjectDataViewModel::GetPlateIdByItem(const wxDataViewItem& item) const
@@ -1655,10 +1665,8 @@ void ObjectDataViewModel::GetItemInfo(const wxDataViewItem& item, ItemType& type
     while (parent_node->m_type != itObject)
         parent_node = parent_node->GetParent();
 
-    auto it = find(m_objects.begin(), m_objects.end(), parent_node);
-    if (it != m_objects.end())
-        obj_idx = it - m_objects.begin();
-    else
+    obj_idx = GetObjectIndex(parent_node);
+    if (obj_idx < 0)
         type = itUndef;
 }
 
@@ -1952,6 +1960,7 @@ wxDataViewItem ObjectDataViewModel::ReorganizeObjects(  const int current_id, co
     ItemDeleted(wxDataViewItem(deleted_node->m_parent), wxDataViewItem(deleted_node));
 
     m_objects.emplace(m_objects.begin() + new_id, deleted_node);
+    m_object_ids.clear();
     int plate_child_index = plate_node->GetChildIndex(new_node);
     if (current_id < new_id)
         plate_node->Insert(deleted_node, plate_child_index+1);
@@ -6,6 +6,7 @@
 #include <wx/dataview.h>
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "ExtraRenderers.hpp"
 
@@ -340,6 +341,9 @@ class ObjectDataViewModel :public wxDataViewModel
 {
     std::vector<ObjectDataViewModelNode*>       m_plates;
     std::vector<ObjectDataViewModelNode*>       m_objects;
+    // BBS: lookup of the index of an object node in m_objects, rebuilt lazily after m_objects is reordered or shrunk,
+    // so that mapping the selected items to the model objects is not quadratic with thousands of objects.
+    mutable std::unordered_map<const ObjectDataViewModelNode*, int> m_object_ids;
     std::vector<wxBitmap>                       m_volume_bmps;
     std::vector<wxBitmap>                       m_text_volume_bmps;
     std::vector<wxBitmap>                       m_svg_volume_bmps;
@@ -551,6 +555,8 @@ private:
     wxBitmap&       GetWarningBitmap(const std::string& warning_icon_name);
     void            ReparentObject(ObjectDataViewModelNode* plate, ObjectDataViewModelNode* object);
     wxDataViewItem  AddOutsidePlate(bool refresh = true);
+    // Index of the object node in m_objects, -1 if node is not an object node.
+    int             GetObjectIndex(const ObjectDataViewModelNode* node) const;
 
     void UpdateBitmapForNode(ObjectDataViewModelNode *node);
     void UpdateBitmapForNode(ObjectDataViewModelNode *node, const std::string &warning_icon_name, bool has_lock);
@@ -260,6 +260,39 @@ static GLenum get_pixel_data_type(Slic3r::GUI::EPixelDataType type) {
     return GL_INVALID_ENUM;
 }
 
+static size_t get_pixel_size(Slic3r::GUI::EPixelFormat format, Slic3r::GUI::EPixelDataType type) {
+    size_t components = 0;
+    switch (format)
+    {
+    case Slic3r::GUI::EPixelFormat::RGBA:
+        components = 4;
+        break;
+    case Slic3r::GUI::EPixelFormat::DepthComponent:
+    case Slic3r::GUI::EPixelFormat::StencilIndex:
+        components = 1;
+        break;
+    default:
+        // packed formats are not supported
+        return 0;
+    }
+
+    switch (type)
+    {
+    case Slic3r::GUI::EPixelDataType::UByte:
+    case Slic3r::GUI::EPixelDataType::Byte:
+        return components;
+    case Slic3r::GUI::EPixelDataType::UShort:
+    case Slic3r::GUI::EPixelDataType::Short:
+        return components * 2;
+    case Slic3r::GUI::EPixelDataType::UInt:
+    case Slic3r::GUI::EPixelDataType::Int:
+    case Slic3r::GUI::EPixelDataType::Float:
+        return components * 4;
+    default:
+        return 0;
+    }
+}
+
 static bool version_to_major_minor(const std::string& version, unsigned int& major, unsigned int& minor)
 {
     major = 0;
@@ -816,6 +849,33 @@ EMSAAType OpenGLManager::get_msaa_type() const
     return m_msaa_type;
 }
 
+bool OpenGLManager::request_pixels(const std::string& frame_name, uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type) const
+{
+    const auto& iter = m_name_to_framebuffer.find(frame_name);
+    if (iter == m_name_to_framebuffer.end() || !iter->second) {
+        return false;
+    }
+
+    const bool rt = iter->second->request_pixels(x, y, width, height, format, type);
+
+    const auto current_fb = m_current_binded_framebuffer.lock();
+    if (current_fb) {
+        current_fb->bind();
+    }
+
+    return rt;
+}
+
+bool OpenGLManager::fetch_requested_pixels(const std::string& frame_name, void* pixels, size_t size) const
+{
+    const auto& iter = m_name_to_framebuffer.find(frame_name);
+    if (iter == m_name_to_framebuffer.end() || !iter->second) {
+        return false;
+    }
+
+    return iter->second->fetch_requested_pixels(pixels, size);
+}
+
 bool OpenGLManager::read_pixel(const std::string& frame_name, uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type, void* pixels) const
 {
     std::shared_ptr<FrameBuffer> fb{ nullptr };
@@ -1097,6 +1157,12 @@ FrameBuffer::~FrameBuffer()
         m_depth_rbo_id = UINT32_MAX;
     }
 
+    if (UINT32_MAX != m_pixel_pack_buffer_id)
+    {
+        glsafe(::glDeleteBuffers(1, &m_pixel_pack_buffer_id));
+        m_pixel_pack_buffer_id = UINT32_MAX;
+    }
+
     if (UINT32_MAX != m_gl_id_for_back_fbo)
     {
         glsafe(BBS_GL_EXTENSION_FUNC(::glDeleteFramebuffers)(1, &m_gl_id_for_back_fbo));
@@ -1194,6 +1260,52 @@ void FrameBuffer::read_pixel(uint32_t x, uint32_t y, uint32_t width, uint32_t he
     glsafe(BBS_GL_EXTENSION_FUNC(::glBindFramebuffer)(BBS_GL_EXTENSION_PARAMETER(GL_FRAMEBUFFER), 0));
 }
 
+bool FrameBuffer::request_pixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type)
+{
+    m_requested_pixels_size = 0;
+    // pixel buffer objects are core since OpenGL 2.1
+    if (!OpenGLManager::get_gl_info().is_version_greater_or_equal_to(2, 1) || UINT32_MAX == m_gl_id) {
+        return false;
+    }
+
+    const size_t size = size_t(width) * size_t(height) * get_pixel_size(format, type);
+    if (0 == size) {
+        return false;
+    }
+
+    if (UINT32_MAX == m_pixel_pack_buffer_id) {
+        glsafe(::glGenBuffers(1, &m_pixel_pack_buffer_id));
+    }
+    glsafe(::glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixel_pack_buffer_id));
+    if (m_pixel_pack_buffer_size < size) {
+        glsafe(::glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ));
+        m_pixel_pack_buffer_size = size;
+    }
+    // with a pixel pack buffer bound, glReadPixels() writes at offset 0 of the buffer and returns without waiting for the GPU
+    read_pixel(x, y, width, height, format, type, nullptr);
+    glsafe(::glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    m_requested_pixels_size = size;
+    return true;
+}
+
+bool FrameBuffer::fetch_requested_pixels(void* pixels, size_t size)
+{
+    if (0 == m_requested_pixels_size || size != m_requested_pixels_size) {
+        return false;
+    }
+    m_requested_pixels_size = 0;
+
+    glsafe(::glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixel_pack_buffer_id));
+    const void* data = ::glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    if (data) {
+        ::memcpy(pixels, data, size);
+        glsafe(::glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+    }
+    glsafe(::glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+    return data != nullptr;
+}
+
 uint32_t FrameBuffer::get_height() const
 {
     return m_height;
@@ -68,6 +68,11 @@ struct FrameBuffer
 
     void read_pixel(uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type, void* pixels);
 
+    // Starts the transfer of the pixels into a pixel buffer object, without waiting for the rendering to finish.
+    bool request_pixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type);
+    // Copies the pixels of the last request into pixels, false if there is no pending request of size bytes.
+    bool fetch_requested_pixels(void* pixels, size_t size);
+
     uint32_t get_height() const;
 
     uint32_t get_width() const;
@@ -98,6 +103,9 @@ private:
     uint32_t m_gl_id{ UINT32_MAX };
     uint32_t m_color_texture_id{ UINT32_MAX };
     uint32_t m_depth_rbo_id{ UINT32_MAX };
+    uint32_t m_pixel_pack_buffer_id{ UINT32_MAX };
+    size_t m_pixel_pack_buffer_size{ 0 };
+    size_t m_requested_pixels_size{ 0 };
     bool m_needs_to_solve{ false };
     EBlitOptionType m_blit_option_type{ EBlitOptionType::Color };
 };
@@ -248,6 +256,10 @@ public:
     const std::shared_ptr<FrameBuffer>& get_frame_buffer(const std::string& name) const;
 
     bool read_pixel(const std::string& frame_name, uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type, void* pixels) const;
+    // Asynchronous version of read_pixel(): request_pixels() queues the read right after the frame was rendered,
+    // fetch_requested_pixels() gets the result later, when the GPU is likely done with it. Not supported for the back frame.
+    bool request_pixels(const std::string& frame_name, uint32_t x, uint32_t y, uint32_t width, uint32_t height, EPixelFormat format, EPixelDataType type) const;
+    bool fetch_requested_pixels(const std::string& frame_name, void* pixels, size_t size) const;
     void bind_vao();
     void unbind_vao();
     void release_vao();
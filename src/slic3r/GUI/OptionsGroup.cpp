@@ -623,6 +623,9 @@ Option ConfigOptionsGroup::get_option(const std::string& opt_key, int opt_index
 
 void ConfigOptionsGroup::on_change_OG(const t_config_option_key& opt_id, const boost::any& value)
 {
+	// The field was edited, it no longer shows what it was reloaded from.
+	if (Field *field = get_field(opt_id); field != nullptr)
+		field->m_reloaded_value.clear();
 	if (!m_opt_map.empty())
 	{
 		auto it = m_opt_map.find(opt_id);
@@ -725,7 +728,7 @@ void ConfigOptionsGroup::on_kill_focus(const std::string& opt_key)
 	    reload_config();
 }
 
-void ConfigOptionsGroup::reload_config()
+void ConfigOptionsGroup::reload_config(bool changed_only)
 {
 #if 0
     // BBS
@@ -761,7 +764,20 @@ void ConfigOptionsGroup::reload_config()
         if ((opt_id == "bed_temperature" || opt_id == "bed_temperature_initial_layer") && bed_type_field != nullptr)
             opt_index = default_bed_type;
 #endif
-		this->set_value(opt_id, config_value(opt_key, opt_index, option.gui_flags == "serialized"));
+		auto field = m_fields.find(opt_id);
+		if (field == m_fields.end())
+			continue;
+		// Vector options are compared as a whole, which may refresh a few fields needlessly but never misses a change.
+		// The index is part of the snapshot, as switching the extruder variant remaps it in place.
+		std::string serialized;
+		if (const ConfigOption *config_option = m_config->option(opt_key); config_option != nullptr) {
+			serialized = std::to_string(opt_index) + "#" + config_option->serialize();
+			if (changed_only && field->second->m_reloaded_value == serialized)
+				continue;
+		}
+		field->second->set_value(config_value(opt_key, opt_index, option.gui_flags == "serialized"), false);
+		// Recorded after set_value(), which clears it.
+		field->second->m_reloaded_value = std::move(serialized);
 	}
 }
 
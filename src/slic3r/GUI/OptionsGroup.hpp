@@ -260,7 +260,8 @@ public:
 
 	void 		set_config_category_and_type(const wxString &category, int type) { m_config_category = category; m_config_type = type; }
     void        set_config(DynamicPrintConfig* config) {
-		m_config = config; m_modelconfig = nullptr; }
+		m_config = config; m_modelconfig = nullptr;
+		for (auto &field : m_fields) field.second->m_reloaded_value.clear(); }
 	Option		get_option(const std::string& opt_key, int opt_index = -1);
 	Line		create_single_option_line(const std::string& title, const std::string& path = std::string(), int idx = -1) /*const*/{
 		Option option = get_option(title, idx);
@@ -283,7 +284,8 @@ public:
 	void		back_to_sys_value(const std::string& opt_key) override;
 	void		back_to_config_value(const DynamicPrintConfig& config, const std::string& opt_key);
     void		on_kill_focus(const std::string& opt_key) override;
-	void		reload_config();
+	// If changed_only, fields whose config value did not change since the last reload are not touched.
+	void		reload_config(bool changed_only = false);
     // return value shows visibility : false => all options are hidden
     void        Hide();
     void        Show(const bool show);
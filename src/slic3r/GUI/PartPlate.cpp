@@ -3511,6 +3511,59 @@ Vec2d PartPlateList::compute_shape_position(int index, int cols)
 	return pos;
 }
 
+//check whether the printable plates are at the origins of compute_origin()
+bool PartPlateList::is_plate_grid_valid()
+{
+	if (m_plate_list.empty() || (m_plate_cols <= 0) || (plate_stride_x() <= 0) || (plate_stride_y() <= 0))
+		return false;
+
+	for (int i = 0; i < (int)m_plate_list.size(); ++i)
+	{
+		Vec3d origin = compute_origin(i, m_plate_cols);
+		Vec3d plate_origin = m_plate_list[i]->get_origin();
+		if ((std::abs(plate_origin.x() - origin.x()) > EPSILON) || (std::abs(plate_origin.y() - origin.y()) > EPSILON))
+			return false;
+	}
+
+	return true;
+}
+
+//get the plates whose grid cell is touched by the bounding box
+std::vector<int> PartPlateList::get_candidate_plates(const BoundingBoxf3& bounding_box, bool grid_valid)
+{
+	std::vector<int> plates;
+	int count = (int)m_plate_list.size();
+
+	if (!grid_valid)
+	{
+		plates.reserve(count);
+		for (int i = 0; i < count; ++i)
+			plates.push_back(i);
+		return plates;
+	}
+
+	//all the plates share the box of the first plate, shifted by plate_stride_x() per column and -plate_stride_y() per row
+	//the ranges are rounded outwards, the exact test is still done by the caller
+	BoundingBoxf3 first_box = m_plate_list[0]->get_plate_box();
+	double stride_x = plate_stride_x();
+	double stride_y = plate_stride_y();
+	int rows = (count + m_plate_cols - 1) / m_plate_cols;
+	int col_min = std::max(0, (int)std::floor((bounding_box.min.x() - first_box.max.x()) / stride_x));
+	int col_max = std::min(m_plate_cols - 1, (int)std::ceil((bounding_box.max.x() - first_box.min.x()) / stride_x));
+	int row_min = std::max(0, (int)std::floor((first_box.min.y() - bounding_box.max.y()) / stride_y));
+	int row_max = std::min(rows - 1, (int)std::ceil((first_box.max.y() - bounding_box.min.y()) / stride_y));
+
+	for (int row = row_min; row <= row_max; ++row)
+		for (int col = col_min; col <= col_max; ++col)
+		{
+			int index = row * m_plate_cols + col;
+			if (index < count)
+				plates.push_back(index);
+		}
+
+	return plates;
+}
+
 //generate icon textures
 void PartPlateList::generate_icon_textures()
 {
@@ -4568,7 +4621,7 @@ int PartPlateList::notify_instance_update(int obj_id, int instance_id, bool is_n
 	};
 
 	//try to find a new plate
-	for (unsigned int i = 0; i < (unsigned int)m_plate_list.size(); ++i)
+	for (int i : get_candidate_plates(boundingbox, is_plate_grid_valid()))
 	{
 		PartPlate* plate = m_plate_list[i];
 		assert(plate != NULL);
@@ -4702,11 +4755,13 @@ int PartPlateList::add_to_plate(int obj_id, int instance_id, int plate_id)
 int PartPlateList::reload_all_objects(bool except_locked, int plate_index)
 {
 	int ret = 0;
-	unsigned int i, j, k;
+	unsigned int i, j;
 
 	clear(false, false, except_locked, plate_index);
 
 	BOOST_LOG_TRIVIAL(debug) << __FUNCTION__ << boost::format(": m_model->objects.size() is %1%") % m_model->objects.size();
+	//the plates do not move while reloading, check the grid once
+	bool grid_valid = is_plate_grid_valid();
 	//try to find a new plate
 	for (i = 0; i < (unsigned int)m_model->objects.size(); ++i)
 	{
@@ -4715,7 +4770,8 @@ int PartPlateList::reload_all_objects(bool except_locked, int plate_index)
 		{
 			ModelInstance* instance = object->instances[j];
 			BoundingBoxf3 boundingbox = object->instance_convex_hull_bounding_box(j);
-			for (k = 0; k < (unsigned int)m_plate_list.size(); ++k)
+			bool found = false;
+			for (int k : get_candidate_plates(boundingbox, grid_valid))
 			{
 				PartPlate* plate = m_plate_list[k];
 				assert(plate != NULL);
@@ -4731,11 +4787,12 @@ int PartPlateList::reload_all_objects(bool except_locked, int plate_index)
 					{
 						plate->m_ready_for_slice = false;
 					}*/
+					found = true;
 					break;
 				}
 			}
 
-			if ((k == m_plate_list.size()) && (unprintable_plate.intersect_instance(i, j, &boundingbox)))
+			if (!found && (unprintable_plate.intersect_instance(i, j, &boundingbox)))
 			{
 				//found in unprintable plate, add it to plate
 				unprintable_plate.add_instance(i, j, false, &boundingbox);
@@ -4754,10 +4811,16 @@ int PartPlateList::construct_objects_list_for_new_plate(int plate_index)
 	int ret = 0;
 	unsigned int i, j, k;
 	PartPlate* new_plate = m_plate_list[plate_index];
-	bool already_included;
 
 	BOOST_LOG_TRIVIAL(debug) << __FUNCTION__ << boost::format(": m_model->objects.size() is %1%") % m_model->objects.size();
 	unprintable_plate.clear();
+	//the instances of the previous plates, collected once instead of looking up every plate for every instance
+	std::set<std::pair<int, int>> included_instances;
+	for (k = 0; k < (unsigned int)plate_index; ++k)
+	{
+		std::set<std::pair<int, int>>& plate_instances = m_plate_list[k]->get_obj_and_inst_set();
+		included_instances.insert(plate_instances.begin(), plate_instances.end());
+	}
 	//try to find a new plate
 	for (i = 0; i < (unsigned int)m_model->objects.size(); ++i)
 	{
@@ -4765,19 +4828,8 @@ int PartPlateList::construct_objects_list_for_new_plate(int plate_index)
 		for (j = 0; j < (unsigned int)object->instances.size(); ++j)
 		{
 			ModelInstance* instance = object->instances[j];
-			already_included = false;
-
-			for (k = 0; k < (unsigned int)plate_index; ++k)
-			{
-				PartPlate* plate = m_plate_list[k];
-				if (plate->contain_instance(i, j))
-				{
-					already_included = true;
-					break;
-				}
-			}
 
-			if (already_included)
+			if (included_instances.find(std::pair<int, int>(i, j)) != included_instances.end())
 				continue;
 
 			BoundingBoxf3 boundingbox = object->instance_convex_hull_bounding_box(j);
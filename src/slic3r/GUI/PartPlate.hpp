@@ -599,6 +599,11 @@ class PartPlateList : public ObjectBase
     Vec3d compute_origin_for_unprintable();
     //compute shape position
     Vec2d compute_shape_position(int index, int cols);
+    //BBS: whether the printable plates are laid out in the grid of compute_origin()
+    bool is_plate_grid_valid();
+    //BBS: the plates whose grid cell is touched by the bounding box in XY, in ascending order, so that an instance
+    //is not tested against all the plates. All the plates are returned if the grid is not valid
+    std::vector<int> get_candidate_plates(const BoundingBoxf3& bounding_box, bool grid_valid);
     //generate icon textures
     void generate_icon_textures();
     void release_icon_textures();
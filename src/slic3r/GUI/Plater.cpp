@@ -1,6 +1,7 @@
 #include "Plater.hpp"
 #include <cstddef>
 #include <algorithm>
+#include <deque>
 #include <numeric>
 #include <vector>
 #include <string>
@@ -137,6 +138,7 @@
 #include "ObjColorDialog.hpp"
 
 #include "libslic3r/CustomGCode.hpp"
+#include "libslic3r/LRUCache.hpp"
 #include "libslic3r/Platform.hpp"
 #include "nlohmann/json.hpp"
 
@@ -3669,6 +3671,73 @@ void PlaterDropTarget::handleOnIdle(wxIdleEvent &event)
     //m_filenames.clear();
 }
 
+// Inputs of store_bbs_3mf(), collected on the UI thread. Owns the plate data and the project presets.
+// The thumbnail and bounding box pointers refer to the plates until take_snapshot() is called.
+struct ProjectStoreData
+{
+    std::string                 path;
+    DynamicPrintConfig          config;
+    PlateDataPtrs               plate_data_list;
+    std::vector<Preset*>        project_presets;
+    std::vector<ThumbnailData*> thumbnails;
+    std::vector<ThumbnailData*> no_light_thumbnails;
+    std::vector<ThumbnailData*> calibration_thumbnails;
+    std::vector<ThumbnailData*> top_thumbnails;
+    std::vector<ThumbnailData*> picking_thumbnails;
+    std::vector<PlateBBoxData*> plate_bboxes;
+    // The design info was added to the model for the export only.
+    bool                        reset_design_info { false };
+    StoreParams                 params;
+
+    // Private copies of the project data, filled in by take_snapshot().
+    std::unique_ptr<Model>      model_snapshot;
+    BBLProject                  project_snapshot;
+    std::deque<ThumbnailData>   thumbnail_copies;
+    std::deque<PlateBBoxData>   bbox_copies;
+
+    ProjectStoreData() = default;
+    ProjectStoreData(const ProjectStoreData &) = delete;
+    ProjectStoreData &operator=(const ProjectStoreData &) = delete;
+    ~ProjectStoreData()
+    {
+        // The snapshot borrows the backup directory of the live model, do not let it remove the directory.
+        if (model_snapshot)
+            model_snapshot->set_backup_path("detach");
+        for (Preset *preset : project_presets)
+            delete preset;
+        release_PlateData_list(plate_data_list);
+    }
+
+    // Make the store independent of the live project, so that it may run on a worker thread while the project is edited.
+    // Meshes are shared between the model and its copy, they are never modified in place.
+    void take_snapshot(Model &model, const BBLProject &project)
+    {
+        model_snapshot = std::make_unique<Model>(model);
+        model_snapshot->set_backup_path(model.get_backup_path());
+        // Keep the object file names of a synchronous save.
+        for (size_t i = 0; i < model.objects.size(); ++i)
+            model_snapshot->set_object_backup_id(*model_snapshot->objects[i], model.get_object_backup_id(*model.objects[i]));
+        project_snapshot = project;
+        params.model   = model_snapshot.get();
+        params.project = &project_snapshot;
+
+        auto copy_thumbnails = [this](const std::vector<ThumbnailData*> &src) {
+            std::vector<ThumbnailData*> dst;
+            for (const ThumbnailData *thumbnail : src)
+                dst.emplace_back(&thumbnail_copies.emplace_back(*thumbnail));
+            return dst;
+        };
+        params.thumbnail_data             = copy_thumbnails(thumbnails);
+        params.no_light_thumbnail_data    = copy_thumbnails(no_light_thumbnails);
+        params.top_thumbnail_data         = copy_thumbnails(top_thumbnails);
+        params.pick_thumbnail_data        = copy_thumbnails(picking_thumbnails);
+        params.calibration_thumbnail_data = copy_thumbnails(calibration_thumbnails);
+        params.id_bboxes.clear();
+        for (const PlateBBoxData *bbox : plate_bboxes)
+            params.id_bboxes.emplace_back(&bbox_copies.emplace_back(*bbox));
+    }
+};
+
 // State to manage showing after export notifications and device ejecting
 enum ExportingStatus{
     NOT_EXPORTING,
@@ -3746,6 +3815,8 @@ struct Plater::priv
     // UIThreadWorker can be used as a replacement for BoostThreadWorker if
     // no additional worker threads are desired (useful for debugging or profiling)
     PlaterWorker<BoostThreadWorker> m_worker;
+    // A project save queued to m_worker by Plater::save_project_in_background() has not finished yet.
+    bool m_project_save_running { false };
     // Jobs defined inside the group class will be managed so that only one can
     // run at a time. Also, the background process will be stopped if a job is
     // started. It is up the the plater to ensure that the background slicing
@@ -3822,6 +3893,7 @@ struct Plater::priv
     std::string                 label_btn_send;
 
     bool                        show_render_statistic_dialog{ false };
+    bool                        show_slicing_profile_dialog{ false };
     bool                        show_wireframe{ false };
     bool                        wireframe_enabled{ true };
     bool                        show_non_manifold_edges{false};
@@ -4177,6 +4249,12 @@ struct Plater::priv
     void generate_calibration_thumbnail(ThumbnailData& data, unsigned int w, unsigned int h, const ThumbnailsParams& thumbnail_params);
     PlateBBoxData generate_first_layer_bbox();
 
+    // BBS: project save
+    bool prepare_project_store(ProjectStoreData &data, const boost::filesystem::path &output_path, SaveStrategy strategy, int export_plate_idx, Export3mfProgressFn proFn);
+    void release_project_store_inputs(ProjectStoreData &data);
+    // Blocks until a project save running on m_worker has finished.
+    void wait_for_project_save();
+
     void bring_instance_forward() const;
 
     // returns the path to project file with the given extension (none if extension == wxEmptyString)
@@ -6508,6 +6586,8 @@ void Plater::priv::reset(bool apply_presets_change)
     // Stop and reset the Print content.
     this->background_process.reset();
     model.clear_objects();
+    // BBS: the slicing caches hold the meshes and slices of the closed project.
+    LRUCacheBase::clear_all();
     assemble_view->get_canvas3d()->reset_explosion_ratio();
     update();
 
@@ -10781,6 +10861,7 @@ void Plater::reset_flags_when_new_or_close_project()
 
 int Plater::new_project(bool skip_confirm, bool silent, const wxString &project_name)
 {
+    p->wait_for_project_save();
     bool transfer_preset_changes = false;
     // BBS: save confirm
     auto check = [this,&transfer_preset_changes](bool yes_or_no) {
@@ -11081,10 +11162,19 @@ int Plater::save_project(bool saveAs)
         return wxID_CANCEL;
 
     //BBS export 3mf without gcode
-    if (export_3mf(into_path(filename), SaveStrategy::SplitModel | SaveStrategy::ShareMesh | SaveStrategy::FullPathSources) < 0) {
+    bool stored = export_3mf(into_path(filename), SaveStrategy::SplitModel | SaveStrategy::ShareMesh | SaveStrategy::FullPathSources) >= 0;
+    on_project_saved(filename, stored, true);
+    return stored ? wxID_YES : wxID_CANCEL;
+}
+
+// The common epilogue of save_project() and save_project_in_background(). The project is marked as saved only if mark_saved,
+// a background save keeps it dirty if it was edited while it was being saved.
+void Plater::on_project_saved(const wxString &filename, bool stored, bool mark_saved)
+{
+    if (!stored) {
         MessageDialog(this, _L("Failed to save the project.\nPlease check whether the folder exists online or if other programs open the project file or if there is enough disk space."),
             _L("Save project"), wxOK | wxICON_WARNING).ShowModal();
-        return wxID_CANCEL;
+        return;
     }
 
     Slic3r::remove_backup(model(), false);
@@ -11092,11 +11182,13 @@ int Plater::save_project(bool saveAs)
     p->set_project_filename(filename);
     BOOST_LOG_TRIVIAL(trace) << __FUNCTION__ << __LINE__ << " call set_project_filename: " << filename;
 
-    up_to_date(true, false);
-    up_to_date(true, true);
+    if (mark_saved) {
+        up_to_date(true, false);
+        up_to_date(true, true);
 
-    wxGetApp().update_saved_preset_from_current_preset();
-    reset_project_dirty_after_save();
+        wxGetApp().update_saved_preset_from_current_preset();
+        reset_project_dirty_after_save();
+    }
     try {
         json j;
         boost::uintmax_t size = boost::filesystem::file_size(into_path(filename));
@@ -11107,10 +11199,59 @@ int Plater::save_project(bool saveAs)
         if (agent) agent->track_event("save_project", j.dump());
     }
     catch (...) {}
+}
 
-    return wxID_YES;
+// Same as save_project(), but the 3MF is written by the UI job worker from a copy of the project, so that the project
+// may be edited meanwhile. The project stays dirty if it was edited while it was being saved.
+void Plater::save_project_in_background(bool saveAs)
+{
+    // The previous save may still be writing the same file.
+    p->wait_for_project_save();
+
+    auto filename = get_project_filename(".3mf");
+    if (!saveAs && filename.IsEmpty())
+        saveAs = true;
+    if (saveAs)
+        filename = p->get_export_file(FT_3MF);
+    if (filename.empty() || filename == "<cancel>")
+        return;
+
+    auto data = std::make_shared<ProjectStoreData>();
+    bool prepared = p->prepare_project_store(*data, into_path(filename), SaveStrategy::SplitModel | SaveStrategy::ShareMesh | SaveStrategy::FullPathSources, -1, nullptr);
+    if (prepared)
+        data->take_snapshot(p->model, p->project);
+    p->release_project_store_inputs(*data);
+    if (!prepared) {
+        on_project_saved(filename, false, false);
+        return;
+    }
+
+    const size_t saved_snapshot_time = p->undo_redo_stack_main().active_snapshot_time();
+    auto         stored              = std::make_shared<bool>(false);
+    p->m_project_save_running = true;
+    queue_job(p->m_worker,
+        [data, stored](JobNew::Ctl &ctl) {
+            ctl.update_status(0, _u8L("Saving project"));
+            data->params.proFn = [&ctl](int export_stage, int current, int total, bool &cancel) {
+                ctl.update_status(export_stage * 100 / EXPORT_STAGE_FINISH, _u8L("Saving project"));
+                cancel = ctl.was_canceled();
+            };
+            *stored = Slic3r::store_bbs_3mf(data->params);
+        },
+        [this, data, stored, filename, saved_snapshot_time](bool canceled, std::exception_ptr &eptr) {
+            p->m_project_save_running = false;
+            // An exception is reported by the worker.
+            if (canceled || eptr)
+                return;
+            // Edits made after the snapshot was taken are not in the file.
+            bool edited = *stored && (p->undo_redo_stack_main().active_snapshot_time() != saved_snapshot_time ||
+                                      !wxGetApp().preset_bundle->full_config_secure().diff(data->config).empty());
+            on_project_saved(filename, *stored, !edited);
+        });
 }
 
+bool Plater::is_project_save_running() const { return p->m_project_save_running; }
+
 //BBS import model by model id
 void Plater::import_model_id(wxString download_info)
 {
@@ -12990,6 +13131,7 @@ void Plater::reset_with_confirm()
 // BBS: save logic
 int GUI::Plater::close_with_confirm(std::function<bool(bool)> second_check)
 {
+    p->wait_for_project_save();
     if (up_to_date(false, false)) {
         if (second_check && !second_check(false)) return wxID_CANCEL;
         model().set_backup_path("");
@@ -14027,29 +14169,28 @@ void publish(Model &model, SaveStrategy strategy)
 } // namespace
 
 // BBS: backup
-int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy strategy, int export_plate_idx, Export3mfProgressFn proFn)
+bool Plater::priv::prepare_project_store(ProjectStoreData &data, const boost::filesystem::path &output_path, SaveStrategy strategy, int export_plate_idx, Export3mfProgressFn proFn)
 {
-    int ret = 0;
-    //if (p->model.objects.empty()) {
+    //if (model.objects.empty()) {
     //    MessageDialog dialog(nullptr, _L("No objects to export."), _L("Save project"), wxYES);
     //    if (dialog.ShowModal() == wxYES)
-    //        return -1;
+    //        return false;
     //}
 
     if (output_path.empty())
-        return -1;
+        return false;
 
     bool export_config = true;
     wxString path = from_path(output_path);
 
     if (!path.Lower().EndsWith(".3mf"))
-        return -1;
+        return false;
     // take care about private data stored into .3mf
     // modify model
-    publish(p->model, strategy);
+    publish(model, strategy);
 
-    DynamicPrintConfig cfg = wxGetApp().preset_bundle->full_config_secure();
-    const std::string path_u8 = into_u8(path);
+    data.config = wxGetApp().preset_bundle->full_config_secure();
+    data.path = into_u8(path);
     wxBusyCursor wait;
 
     BOOST_LOG_TRIVIAL(trace) << __FUNCTION__ << boost::format(": path=%1%, backup=%2%, export_plate_idx=%3%, SaveStrategy=%4%")
@@ -14059,113 +14200,109 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
         % std::string("") % (strategy & SaveStrategy::Backup) % export_plate_idx % (unsigned int)strategy;
 
     //BBS: add plate logic for thumbnail generate
-    std::vector<ThumbnailData*> thumbnails;
-    std::vector<ThumbnailData*> no_light_thumbnails;
-    std::vector<ThumbnailData*> calibration_thumbnails;
-    std::vector<ThumbnailData*> top_thumbnails;
-    std::vector<ThumbnailData*> picking_thumbnails;
-    std::vector<PlateBBoxData*> plate_bboxes;
     // BBS: backup
     if (!(strategy & SaveStrategy::Backup)) {
-        for (int i = 0; i < p->partplate_list.get_plate_count(); i++) {
-            ThumbnailData* thumbnail_data = &p->partplate_list.get_plate(i)->thumbnail_data;
-            if (p->partplate_list.get_plate(i)->thumbnail_data.is_valid() &&  using_exported_file()) {
+        for (int i = 0; i < partplate_list.get_plate_count(); i++) {
+            ThumbnailData* thumbnail_data = &partplate_list.get_plate(i)->thumbnail_data;
+            if (partplate_list.get_plate(i)->thumbnail_data.is_valid() &&  q->using_exported_file()) {
                 //no need to generate thumbnail
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate thumbnail for gcode/exported mode of plate %1%")%i;
             }
             else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate thumbnail for plate %1%") % i;
                 const ThumbnailsParams thumbnail_params = { {}, false, true, true, true, i };
-                p->generate_thumbnail(p->partplate_list.get_plate(i)->thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second,
+                generate_thumbnail(partplate_list.get_plate(i)->thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second,
                                     thumbnail_params, Camera::EType::Ortho);
             }
-            thumbnails.push_back(thumbnail_data);
+            data.thumbnails.push_back(thumbnail_data);
 
-            ThumbnailData *no_light_thumbnail_data = &p->partplate_list.get_plate(i)->no_light_thumbnail_data;
-            if (p->partplate_list.get_plate(i)->no_light_thumbnail_data.is_valid() && using_exported_file()) {
+            ThumbnailData *no_light_thumbnail_data = &partplate_list.get_plate(i)->no_light_thumbnail_data;
+            if (partplate_list.get_plate(i)->no_light_thumbnail_data.is_valid() && q->using_exported_file()) {
                 // no need to generate thumbnail
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate thumbnail for gcode/exported mode of plate %1%") % i;
             } else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate thumbnail for plate %1%") % i;
                 const ThumbnailsParams thumbnail_params = {{}, false, true, true, true, i};
-                p->generate_thumbnail(p->partplate_list.get_plate(i)->no_light_thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second, thumbnail_params,
+                generate_thumbnail(partplate_list.get_plate(i)->no_light_thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second, thumbnail_params,
                                       Camera::EType::Ortho,  Camera::ViewAngleType::Iso, false, true);
             }
-            no_light_thumbnails.push_back(no_light_thumbnail_data);
-            //ThumbnailData* calibration_data = &p->partplate_list.get_plate(i)->cali_thumbnail_data;
+            data.no_light_thumbnails.push_back(no_light_thumbnail_data);
+            //ThumbnailData* calibration_data = &partplate_list.get_plate(i)->cali_thumbnail_data;
             //calibration_thumbnails.push_back(calibration_data);
-            PlateBBoxData* plate_bbox_data = &p->partplate_list.get_plate(i)->cali_bboxes_data;
-            plate_bboxes.push_back(plate_bbox_data);
+            PlateBBoxData* plate_bbox_data = &partplate_list.get_plate(i)->cali_bboxes_data;
+            data.plate_bboxes.push_back(plate_bbox_data);
 
             //generate top and picking thumbnails
-            ThumbnailData* top_thumbnail = &p->partplate_list.get_plate(i)->top_thumbnail_data;
-            if (top_thumbnail->is_valid() &&  using_exported_file()) {
+            ThumbnailData* top_thumbnail = &partplate_list.get_plate(i)->top_thumbnail_data;
+            if (top_thumbnail->is_valid() &&  q->using_exported_file()) {
                 //no need to generate thumbnail
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate top_thumbnail for gcode/exported mode of plate %1%")%i;
             }
             else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate top_thumbnail for plate %1%") % i;
                 const ThumbnailsParams thumbnail_params = { {}, false, true, false, true, i };
-                p->generate_thumbnail(p->partplate_list.get_plate(i)->top_thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second, thumbnail_params,
+                generate_thumbnail(partplate_list.get_plate(i)->top_thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second, thumbnail_params,
                                       Camera::EType::Ortho, Camera::ViewAngleType::Top_Plate, false);
             }
-            top_thumbnails.push_back(top_thumbnail);
+            data.top_thumbnails.push_back(top_thumbnail);
 
-            ThumbnailData* picking_thumbnail = &p->partplate_list.get_plate(i)->pick_thumbnail_data;
-            if (picking_thumbnail->is_valid() &&  using_exported_file()) {
+            ThumbnailData* picking_thumbnail = &partplate_list.get_plate(i)->pick_thumbnail_data;
+            if (picking_thumbnail->is_valid() &&  q->using_exported_file()) {
                 //no need to generate thumbnail
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": non need to re-generate pick_thumbnail for gcode/exported mode of plate %1%")%i;
             }
             else {
                 BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": re-generate pick_thumbnail for plate %1%") % i;
                 const ThumbnailsParams thumbnail_params = { {}, false, true, false, true, i };
-                p->generate_thumbnail(p->partplate_list.get_plate(i)->pick_thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second, thumbnail_params,
+                generate_thumbnail(partplate_list.get_plate(i)->pick_thumbnail_data, THUMBNAIL_SIZE_3MF.first, THUMBNAIL_SIZE_3MF.second, thumbnail_params,
                                       Camera::EType::Ortho, Camera::ViewAngleType::Top_Plate, true,true);
             }
-            picking_thumbnails.push_back(picking_thumbnail);
+            data.picking_thumbnails.push_back(picking_thumbnail);
         }
 
-        if (p->partplate_list.get_curr_plate()->is_slice_result_valid()) {
+        if (partplate_list.get_curr_plate()->is_slice_result_valid()) {
             //BBS generate BBS calibration thumbnails
-            int index = p->partplate_list.get_curr_plate_index();
+            int index = partplate_list.get_curr_plate_index();
             //ThumbnailData* calibration_data = calibration_thumbnails[index];
-            //const ThumbnailsParams calibration_params = { {}, false, true, true, true, p->partplate_list.get_curr_plate_index() };
+            //const ThumbnailsParams calibration_params = { {}, false, true, true, true, partplate_list.get_curr_plate_index() };
             //p->generate_calibration_thumbnail(*calibration_data, PartPlate::cali_thumbnail_width, PartPlate::cali_thumbnail_height, calibration_params);
-            if (using_exported_file()) {
+            if (q->using_exported_file()) {
                 //do nothing
             }
             else
-                *plate_bboxes[index] = p->generate_first_layer_bbox();
+                *data.plate_bboxes[index] = generate_first_layer_bbox();
         }
     }
 
     //BBS: add bbs 3mf logic
-    PlateDataPtrs plate_data_list;
-    p->partplate_list.store_to_3mf_structure(plate_data_list, (strategy & SaveStrategy::WithGcode || strategy & SaveStrategy::WithSliceInfo), export_plate_idx);
+    partplate_list.store_to_3mf_structure(data.plate_data_list, (strategy & SaveStrategy::WithGcode || strategy & SaveStrategy::WithSliceInfo), export_plate_idx);
 
     // BBS: backup
     PresetBundle& preset_bundle = *wxGetApp().preset_bundle;
-    std::vector<Preset*> project_presets = preset_bundle.get_current_project_embedded_presets();
+    data.project_presets = preset_bundle.get_current_project_embedded_presets();
 
-    StoreParams store_params;
-    store_params.path  = path_u8.c_str();
-    store_params.model = &p->model;
-    store_params.plate_data_list = plate_data_list;
+    StoreParams &store_params = data.params;
+    store_params.path  = data.path.c_str();
+    store_params.model = &model;
+    store_params.plate_data_list = data.plate_data_list;
     store_params.export_plate_idx = export_plate_idx;
-    store_params.project_presets = project_presets;
-    store_params.config = export_config ? &cfg : nullptr;
-    store_params.thumbnail_data = thumbnails;
-    store_params.no_light_thumbnail_data  = no_light_thumbnails;
-    store_params.top_thumbnail_data = top_thumbnails;
-    store_params.pick_thumbnail_data = picking_thumbnails;
-    store_params.calibration_thumbnail_data = calibration_thumbnails;
+    store_params.project_presets = data.project_presets;
+    store_params.config = export_config ? &data.config : nullptr;
+    store_params.thumbnail_data = data.thumbnails;
+    store_params.no_light_thumbnail_data  = data.no_light_thumbnails;
+    store_params.top_thumbnail_data = data.top_thumbnails;
+    store_params.pick_thumbnail_data = data.picking_thumbnails;
+    store_params.calibration_thumbnail_data = data.calibration_thumbnails;
     store_params.proFn = proFn;
-    store_params.id_bboxes = plate_bboxes;//BBS
-    store_params.project = &p->project;
+    store_params.id_bboxes = data.plate_bboxes;//BBS
+    store_params.project = &project;
     store_params.strategy = strategy | SaveStrategy::Zip64;
+    if (wxGetApp().app_config->get_bool("store_gcode_result_in_3mf"))
+        store_params.strategy = store_params.strategy | SaveStrategy::WithGcodeResult;
 
 
     // get type and color for platedata
+    const DynamicPrintConfig &cfg = data.config;
     auto* filament_color = dynamic_cast<const ConfigOptionStrings*>(cfg.option("filament_colour"));
     auto* nozzle_diameter_option = dynamic_cast<const ConfigOptionFloatsNullable*>(cfg.option("nozzle_diameter"));
     auto* filament_id_opt = dynamic_cast<const ConfigOptionStrings*>(cfg.option("filament_ids"));
@@ -14175,8 +14312,8 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
 
     std::string printer_model_id = preset_bundle.printers.get_edited_preset().get_printer_type(&preset_bundle);
 
-    for (int i = 0; i < plate_data_list.size(); i++) {
-        PlateData *plate_data = plate_data_list[i];
+    for (int i = 0; i < data.plate_data_list.size(); i++) {
+        PlateData *plate_data = data.plate_data_list[i];
         plate_data->printer_model_id = printer_model_id;
         plate_data->nozzle_diameters = nozzle_diameter_str;
         for (auto it = plate_data->slice_filaments_info.begin(); it != plate_data->slice_filaments_info.end(); it++) {
@@ -14185,7 +14322,7 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
             it->filament_id = filament_id_opt ? filament_id_opt->get_at(it->id) : "";
             it->color = filament_color ? filament_color->get_at(it->id) : "#FFFFFF";
             // save filament info used in curr plate
-            int index = p->partplate_list.get_curr_plate_index();
+            int index = partplate_list.get_curr_plate_index();
             if (store_params.id_bboxes.size() > index) {
                 store_params.id_bboxes[index]->filament_ids.push_back(it->id);
                 store_params.id_bboxes[index]->filament_colors.push_back(it->color);
@@ -14196,75 +14333,93 @@ int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy
     // handle Design Info
     bool has_design_info = false;
     ModelDesignInfo designInfo;
-    if (p->model.design_info != nullptr) {
-        if (!p->model.design_info->Designer.empty()) {
-            BOOST_LOG_TRIVIAL(trace) << "design_info, found designer = " << p->model.design_info->Designer;
+    if (model.design_info != nullptr) {
+        if (!model.design_info->Designer.empty()) {
+            BOOST_LOG_TRIVIAL(trace) << "design_info, found designer = " << model.design_info->Designer;
             has_design_info = true;
         }
     }
     if (!has_design_info) {
         // add Designed Info
-        if (p->model.design_info == nullptr) {
+        if (model.design_info == nullptr) {
             // set designInfo before export and reset after export
             if (wxGetApp().is_user_login()) {
-                p->model.design_info                 = std::make_shared<ModelDesignInfo>();
-                //p->model.design_info->Designer       = wxGetApp().getAgent()->get_user_nickanme();
-                p->model.design_info->Designer       = "";
-                p->model.design_info->DesignerUserId = wxGetApp().getAgent()->get_user_id();
+                model.design_info                 = std::make_shared<ModelDesignInfo>();
+                //model.design_info->Designer       = wxGetApp().getAgent()->get_user_nickanme();
+                model.design_info->Designer       = "";
+                model.design_info->DesignerUserId = wxGetApp().getAgent()->get_user_id();
                 BOOST_LOG_TRIVIAL(trace) << "design_info prepare, designer = "<< "";
-                BOOST_LOG_TRIVIAL(trace) << "design_info prepare, designer_user_id = " << p->model.design_info->DesignerUserId;
+                BOOST_LOG_TRIVIAL(trace) << "design_info prepare, designer_user_id = " << model.design_info->DesignerUserId;
             }
         }
     }
 
-    bool store_result = Slic3r::store_bbs_3mf(store_params);
-    // reset designed info
-    if (!has_design_info)
-        p->model.design_info = nullptr;
-
-    if (store_result) {
-        if (!(store_params.strategy & SaveStrategy::Silence)) {
-            // Success
-            p->set_project_filename(path);
-            BOOST_LOG_TRIVIAL(trace) << __FUNCTION__ << __LINE__ << " call set_project_filename: " << path;
-        }
-    }
-    else {
-        ret = -1;
-    }
+    data.reset_design_info = !has_design_info;
 
-    if (project_presets.size() > 0)
-    {
-        for (unsigned int i = 0; i < project_presets.size(); i++)
-        {
-            delete project_presets[i];
-        }
-        project_presets.clear();
-    }
+    return true;
+}
 
-    release_PlateData_list(plate_data_list);
+// Undo the changes prepare_project_store() made to the project for the export only.
+void Plater::priv::release_project_store_inputs(ProjectStoreData &data)
+{
+    // reset designed info
+    if (data.reset_design_info)
+        model.design_info = nullptr;
 
-    for (unsigned int i = 0; i < calibration_thumbnails.size(); i++)
+    for (unsigned int i = 0; i < data.calibration_thumbnails.size(); i++)
     {
         //release the data here, as it will always be generated when export
-        calibration_thumbnails[i]->reset();
+        data.calibration_thumbnails[i]->reset();
     }
-    for (unsigned int i = 0; i < no_light_thumbnails.size(); i++) {
+    for (unsigned int i = 0; i < data.no_light_thumbnails.size(); i++) {
         // release the data here, as it will always be generated when export
-        no_light_thumbnails[i]->reset();
+        data.no_light_thumbnails[i]->reset();
     }
-    for (unsigned int i = 0; i < top_thumbnails.size(); i++)
+    for (unsigned int i = 0; i < data.top_thumbnails.size(); i++)
     {
         //release the data here, as it will always be generated when export
-        top_thumbnails[i]->reset();
+        data.top_thumbnails[i]->reset();
     }
-    top_thumbnails.clear();
-    for (unsigned int i = 0; i < picking_thumbnails.size(); i++)
+    for (unsigned int i = 0; i < data.picking_thumbnails.size(); i++)
     {
         //release the data here, as it will always be generated when export
-        picking_thumbnails[i]->reset();;
+        data.picking_thumbnails[i]->reset();
+    }
+}
+
+void Plater::priv::wait_for_project_save()
+{
+    // Finalizing the job on this thread clears the flag.
+    while (m_project_save_running && !m_worker.is_idle())
+        m_worker.wait_for_current_job();
+}
+
+// BBS: backup
+int Plater::export_3mf(const boost::filesystem::path& output_path, SaveStrategy strategy, int export_plate_idx, Export3mfProgressFn proFn)
+{
+    // A save running in the background may write the same file and shares the backup directory.
+    p->wait_for_project_save();
+
+    int ret = 0;
+
+    ProjectStoreData data;
+    if (!p->prepare_project_store(data, output_path, strategy, export_plate_idx, proFn))
+        return -1;
+
+    wxBusyCursor wait;
+    bool store_result = Slic3r::store_bbs_3mf(data.params);
+    p->release_project_store_inputs(data);
+
+    if (store_result) {
+        if (!(data.params.strategy & SaveStrategy::Silence)) {
+            // Success
+            p->set_project_filename(from_path(output_path));
+            BOOST_LOG_TRIVIAL(trace) << __FUNCTION__ << __LINE__ << " call set_project_filename: " << from_path(output_path);
+        }
+    }
+    else {
+        ret = -1;
     }
-    picking_thumbnails.clear();
 
     return ret;
 }
@@ -16955,6 +17110,16 @@ bool Plater::is_render_statistic_dialog_visible() const
     return p->show_render_statistic_dialog;
 }
 
+void Plater::toggle_slicing_profile_dialog()
+{
+    p->show_slicing_profile_dialog = !p->show_slicing_profile_dialog;
+}
+
+bool Plater::is_slicing_profile_dialog_visible() const
+{
+    return p->show_slicing_profile_dialog;
+}
+
 void Plater::toggle_non_manifold_edges() {
     p->show_non_manifold_edges = !p->show_non_manifold_edges; }
 
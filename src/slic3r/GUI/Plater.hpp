@@ -299,6 +299,8 @@ public:
     // BBS: save & backup
     int load_project(wxString const & filename = "", wxString const & originfile = "-");
     int save_project(bool saveAs = false);
+    void save_project_in_background(bool saveAs = false);
+    bool is_project_save_running() const;
     //BBS download project by project id
     void import_model_id(wxString download_info);
     void download_project(const wxString& project_id);
@@ -801,6 +803,8 @@ public:
 
     void toggle_render_statistic_dialog();
     bool is_render_statistic_dialog_visible() const;
+    void toggle_slicing_profile_dialog();
+    bool is_slicing_profile_dialog_visible() const;
 
     void toggle_non_manifold_edges();
     bool is_show_non_manifold_edges();
@@ -874,6 +878,8 @@ private:
     void single_snapshots_leave(SingleSnapshot *single);
     // BBS: add project slice related functions
     int start_next_slice();
+    // BBS: save logic
+    void on_project_saved(const wxString &filename, bool stored, bool mark_saved);
 
     void _calib_pa_pattern(const Calib_Params &params);
     void _calib_pa_tower(const Calib_Params &params);
@@ -8,11 +8,14 @@
 #include "../BitmapCache.hpp"
 
 #include <boost/algorithm/hex.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/endian/conversion.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/uuid/detail/md5.hpp>
 #include <boost/regex.hpp>
 
+#include <wx/log.h>
 #include <wx/mstream.h>
 
 #include "nlohmann/json.hpp"
@@ -487,6 +490,8 @@ void PrinterFileSystem::SelectAll(bool select)
 
 size_t PrinterFileSystem::GetSelectCount() const { return m_select_count; }
 
+void PrinterFileSystem::SetThumbnailCacheDir(std::string const &dir) { m_thumbnail_cache_dir = dir; }
+
 void PrinterFileSystem::SetFocusRange(size_t start, size_t count)
 {
     m_lock_start = start;
@@ -772,6 +777,8 @@ void PrinterFileSystem::UpdateFocusThumbnail()
     m_task_flags &= ~FF_THUMNAIL;
     if (m_lock_start >= m_file_list.size() || m_lock_start >= m_lock_end)
         return;
+    if (LoadCachedThumbnails())
+        return;
     size_t start = m_lock_start;
     size_t end   = std::min(m_lock_end, GetCount());
     std::vector<File> names;
@@ -802,6 +809,147 @@ void PrinterFileSystem::UpdateFocusThumbnail()
         paths.empty() ? OldThumbnail : m_file_type == F_MODEL ? ModelMetadata : VideoThumbnail);
 }
 
+// Thumbnails are cached per printer, keyed by the storage, the path on the printer and the modification time,
+// so that a file replaced on the printer does not show a stale thumbnail. The thumbnails of the former versions are
+// removed when a new one is written. Models are not cached, as their thumbnails are fetched together with the metadata.
+std::string PrinterFileSystem::ThumbnailCachePath(File const &file) const
+{
+    if (m_thumbnail_cache_dir.empty() || m_file_type == F_MODEL)
+        return {};
+    std::string key = m_file_storage + "/" + (file.path.empty() ? file.name : file.path);
+    boost::uuids::detail::md5 md5;
+    md5.process_bytes(key.data(), key.size());
+    boost::uuids::detail::md5::digest_type digest;
+    md5.get_digest(digest);
+    std::string name;
+    const auto  char_digest = reinterpret_cast<const char *>(&digest[0]);
+    boost::algorithm::hex(char_digest, char_digest + sizeof(digest), std::back_inserter(name));
+    return m_thumbnail_cache_dir + "/" + name + "_" + std::to_string(file.time) + ".png";
+}
+
+struct CachedThumbnail
+{
+    std::string name;
+    std::string path;
+    time_t      time;
+    std::string cache_path;
+    wxImage     image;
+};
+
+// Looks up the focused files in the thumbnail cache once. The PNG files are decoded in a worker thread, then the
+// thumbnails found are applied and the rest is requested from the printer. Returns false if there is nothing to look up.
+bool PrinterFileSystem::LoadCachedThumbnails()
+{
+    if (m_thumbnail_cache_dir.empty() || m_file_type == F_MODEL)
+        return false;
+    auto   thumbnails = std::make_shared<std::vector<CachedThumbnail>>();
+    size_t end        = std::min(m_lock_end, GetCount());
+    for (size_t start = m_lock_start; start < end; ++start) {
+        auto &file = const_cast<File &>(GetFile(start));
+        if ((file.flags & (FF_THUMNAIL | FF_THUMNAIL_CACHE)) == 0) {
+            file.flags |= FF_THUMNAIL_CACHE;
+            thumbnails->push_back({file.name, file.path, file.time, ThumbnailCachePath(file), {}});
+        }
+    }
+    if (thumbnails->empty())
+        return false;
+    m_task_flags |= FF_THUMNAIL;
+    boost::thread([w = weak_from_this(), thumbnails] {
+        {
+            wxLogNull nolog;
+            for (auto &thumbnail : *thumbnails) {
+                boost::system::error_code ec;
+                if (boost::filesystem::exists(thumbnail.cache_path, ec))
+                    thumbnail.image.LoadFile(wxString::FromUTF8(thumbnail.cache_path), wxBITMAP_TYPE_PNG);
+            }
+        }
+        boost::shared_ptr<PrinterFileSystem> s = w.lock();
+        if (s) s->PostCallback([fs = s.get(), thumbnails] {
+            for (auto &thumbnail : *thumbnails) {
+                if (!thumbnail.image.IsOk())
+                    continue;
+                auto iter = std::find_if(fs->m_file_list.begin(), fs->m_file_list.end(), [&thumbnail](auto &f) {
+                    return f.name == thumbnail.name && f.path == thumbnail.path && f.time == thumbnail.time;
+                });
+                if (iter != fs->m_file_list.end() && (iter->flags & FF_THUMNAIL) == 0) {
+                    iter->thumbnail = wxBitmap(thumbnail.image);
+                    iter->flags |= FF_THUMNAIL;
+                    int index = iter - fs->m_file_list.begin();
+                    fs->SendChangedEvent(EVT_THUMBNAIL, index, iter->name);
+                }
+            }
+            if (fs->m_stopped)
+                fs->m_task_flags &= ~FF_THUMNAIL;
+            else
+                fs->UpdateFocusThumbnail();
+        });
+    }).detach();
+    return true;
+}
+
+static const boost::uintmax_t THUMBNAIL_CACHE_MAX_SIZE = 64 * 1024 * 1024;
+static boost::mutex           g_thumbnail_cache_mutex;
+
+// Removes the thumbnails of former versions of the file just written, then the least recently written thumbnails
+// of the printer until the cache fits THUMBNAIL_CACHE_MAX_SIZE.
+static void prune_thumbnail_cache(boost::filesystem::path const &path)
+{
+    namespace fs = boost::filesystem;
+    std::string const filename = path.filename().string();
+    std::string const prefix   = filename.substr(0, filename.find('_') + 1);
+    struct Entry
+    {
+        std::time_t      time;
+        boost::uintmax_t size;
+        fs::path         path;
+    };
+    std::vector<Entry> entries;
+    boost::uintmax_t   total = 0;
+    boost::system::error_code ec;
+    for (fs::directory_iterator it(path.parent_path(), ec), end; !ec && it != end; it.increment(ec)) {
+        fs::path const           &entry = it->path();
+        boost::system::error_code ec2;
+        if (entry != path && boost::algorithm::starts_with(entry.filename().string(), prefix)) {
+            fs::remove(entry, ec2);
+            continue;
+        }
+        boost::uintmax_t size = fs::file_size(entry, ec2);
+        if (ec2)
+            continue;
+        total += size;
+        if (entry != path)
+            entries.push_back({fs::last_write_time(entry, ec2), size, entry});
+    }
+    std::sort(entries.begin(), entries.end(), [](auto &l, auto &r) { return l.time < r.time; });
+    for (auto &entry : entries) {
+        if (total <= THUMBNAIL_CACHE_MAX_SIZE)
+            break;
+        boost::system::error_code ec2;
+        if (fs::remove(entry.path, ec2))
+            total -= entry.size;
+    }
+}
+
+void PrinterFileSystem::SaveCachedThumbnail(File const &file) const
+{
+    auto path = ThumbnailCachePath(file);
+    if (path.empty())
+        return;
+    // Encode and write in a worker thread. The image is owned by the shared_ptr only, as wxImage is not thread safe reference counted.
+    auto image = std::make_shared<wxImage>(file.thumbnail.ConvertToImage());
+    boost::thread([dir = m_thumbnail_cache_dir, path, image] {
+        boost::lock_guard<boost::mutex> lock(g_thumbnail_cache_mutex);
+        boost::system::error_code       ec;
+        boost::filesystem::create_directories(dir, ec);
+        wxLogNull nolog;
+        if (!image->SaveFile(wxString::FromUTF8(path), wxBITMAP_TYPE_PNG)) {
+            BOOST_LOG_TRIVIAL(info) << "PrinterFileSystem: cache thumbnail failed " << path;
+            return;
+        }
+        prune_thumbnail_cache(path);
+    }).detach();
+}
+
 bool PrinterFileSystem::ParseThumbnail(File &file)
 {
     std::istringstream iss(file.local_path, std::ios::binary);
@@ -970,6 +1118,7 @@ void PrinterFileSystem::UpdateFocusThumbnail2(std::shared_ptr<std::vector<File>>
                     iter->flags |= FF_THUMNAIL; // DOTO: retry on fail
                     if (file.thumbnail.IsOk()) {
                         iter->thumbnail = file.thumbnail;
+                        SaveCachedThumbnail(*iter);
                         int index       = iter - m_file_list.begin();
                         SendChangedEvent(EVT_THUMBNAIL, index, file.name);
                     }
@@ -112,6 +112,7 @@ public:
         FF_UPLOADDONE     = 1 << 6, // File upload done
         FF_UPLOADCANCEL   = 1 << 7, // File upload cancel
         FF_THUMNAIL_RETRY = 0x100,  // Thumbnail need retry
+        FF_THUMNAIL_CACHE = 0x200,  // Thumbnail cache looked up
     };
 
     enum UploadStatus
@@ -205,6 +206,9 @@ public:
 
     void SetFocusRange(size_t start, size_t count);
 
+    // Directory of the persistent thumbnail cache of this printer, no cache if empty.
+    void SetThumbnailCacheDir(std::string const &dir);
+
     File const &GetFile(size_t index);
 
     File const &GetFile(size_t index, bool &select);
@@ -251,6 +255,12 @@ private:
 
     void UpdateFocusThumbnail();
 
+    std::string ThumbnailCachePath(File const &file) const;
+
+    bool LoadCachedThumbnails();
+
+    void SaveCachedThumbnail(File const &file) const;
+
     static bool ParseThumbnail(File &file);
 
     static bool ParseThumbnail(File &file, std::istream &is);
@@ -363,6 +373,7 @@ private:
     size_t m_lock_start = 0;
     size_t m_lock_end   = 0;
     int m_task_flags = 0;
+    std::string m_thumbnail_cache_dir;
 
 private:
     struct Session
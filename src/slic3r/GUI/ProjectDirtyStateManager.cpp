@@ -32,11 +32,8 @@ void ProjectDirtyStateManager::update_from_presets()
         for (const auto &[type, name] : app.get_selected_presets()) { 
             if (type == Preset::Type::TYPE_FILAMENT) { 
                 m_presets_dirty |= m_initial_filament_presets_names != wxGetApp().preset_bundle->filament_presets;
-                if (ConfigOption *color_option = wxGetApp().preset_bundle->project_config.option("filament_colour")) {
-                    auto colors = static_cast<ConfigOptionStrings *>(color_option->clone());
+                if (const ConfigOptionStrings *colors = wxGetApp().preset_bundle->project_config.option<ConfigOptionStrings>("filament_colour"))
                     m_presets_dirty |= m_initial_filament_presets_colors != colors->values;
-                    delete colors;
-                }
             } else {
                 m_presets_dirty |= !m_initial_presets[type].empty() && m_initial_presets[type] != name;
             }
@@ -65,11 +62,8 @@ void ProjectDirtyStateManager::reset_initial_presets()
     for (const auto &[type, name] : app.get_selected_presets()) { 
         if (type == Preset::Type::TYPE_FILAMENT) {
             m_initial_filament_presets_names = wxGetApp().preset_bundle->filament_presets;
-            if (ConfigOption *color_option = wxGetApp().preset_bundle->project_config.option("filament_colour")) {
-                auto colors = static_cast<ConfigOptionStrings *>(color_option->clone());
+            if (const ConfigOptionStrings *colors = wxGetApp().preset_bundle->project_config.option<ConfigOptionStrings>("filament_colour"))
                 m_initial_filament_presets_colors = colors->values;
-                delete colors;
-            }
         } else {
             m_initial_presets[type] = name;
         }
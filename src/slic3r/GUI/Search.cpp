@@ -124,6 +124,7 @@ void OptionsSearcher::append_options(DynamicPrintConfig *config, Preset::Type ty
 
 inline void OptionsSearcher::sort_options()
 {
+    candidates_valid = false;
     std::sort(options.begin(), options.end(), [](const Option &o1, const Option &o2) { return o1.label < o2.label; });
     Option * last = nullptr;
     for (auto& opt : options) {
@@ -219,8 +220,18 @@ bool OptionsSearcher::search(const std::string &search, bool force /* = false*/,
         return marker_by_type(opt.type, printer_technology) + opt.category_local + sep + opt.group_local + sep + opt.label_local;
     };
 
+    std::wstring wsearch = boost::nowide::widen(search);
+    boost::trim_left(wsearch);
+    // BBS: the fuzzy match requires all the characters of the pattern in order, thus only the options matching the previous
+    // pattern may match its extension. Only those are scored when the user keeps typing.
+    const bool incremental = !full_list && candidates_valid && candidates_english == view_params.english && candidates_category == view_params.category &&
+                             boost::starts_with(wsearch, candidates_pattern);
+    std::vector<size_t> new_candidates;
+
     std::vector<uint16_t> matches, matches2;
-    for (size_t i = 0; i < options.size(); i++) {
+    const size_t num_options = incremental ? candidates.size() : options.size();
+    for (size_t idx = 0; idx < num_options; idx++) {
+        const size_t  i   = incremental ? candidates[idx] : idx;
         const Option &opt = options[i];
         if (full_list) {
             std::string label = into_u8(get_label(opt));
@@ -234,14 +245,12 @@ bool OptionsSearcher::search(const std::string &search, bool force /* = false*/,
             continue;
         }
 
-        std::wstring wsearch = boost::nowide::widen(search);
-        boost::trim_left(wsearch);
         std::wstring label         = get_label(opt, false);
         std::wstring label_english = get_label_english(opt, false);
         int          score         = std::numeric_limits<int>::min();
         int          score2;
         matches.clear();
-        fuzzy_match(wsearch, label, score, matches);
+        bool matched = fuzzy_match(wsearch, label, score, matches);
         // bbs hide the contents in parentheses
         /* if (fuzzy_match(wsearch, opt.key, score2, matches2) && score2 > score) {
              for (fts::pos_type &pos : matches2) pos += label.size() + 1;
@@ -249,11 +258,16 @@ bool OptionsSearcher::search(const std::string &search, bool force /* = false*/,
              append(matches, matches2);
              score = score2;
          }*/
-        if (view_params.english && fuzzy_match(wsearch, label_english, score2, matches2) && score2 > score) {
-            label   = std::move(label_english);
-            matches = std::move(matches2);
-            score   = score2;
+        if (view_params.english && fuzzy_match(wsearch, label_english, score2, matches2)) {
+            matched = true;
+            if (score2 > score) {
+                label   = std::move(label_english);
+                matches = std::move(matches2);
+                score   = score2;
+            }
         }
+        if (matched)
+            new_candidates.emplace_back(i);
         if (score > 90 /*std::numeric_limits<int>::min()*/) {
             label = mark_string(label, matches, opt.type, printer_technology);
             //label += L"  [" + std::to_wstring(score) + L"]"; // add score value
@@ -277,7 +291,14 @@ bool OptionsSearcher::search(const std::string &search, bool force /* = false*/,
         }
     }
 
-    if (!full_list) sort_found();
+    if (!full_list) {
+        sort_found();
+        candidates          = std::move(new_candidates);
+        candidates_pattern  = std::move(wsearch);
+        candidates_english  = view_params.english;
+        candidates_category = view_params.category;
+        candidates_valid    = true;
+    }
 
     if (search_line != search) search_line = search;
     if (search_type != type) search_type = type;
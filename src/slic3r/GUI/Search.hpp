@@ -99,6 +99,13 @@ class OptionsSearcher
     std::vector<Option>      options{};
     std::vector<FoundOption> found{};
 
+    // Indices of the options matching candidates_pattern, searched again if the pattern is extended.
+    std::vector<size_t>      candidates{};
+    std::wstring             candidates_pattern;
+    bool                     candidates_english{false};
+    bool                     candidates_category{false};
+    bool                     candidates_valid{false};
+
     void append_options(DynamicPrintConfig *config, Preset::Type type, ConfigOptionMode mode);
 
     void sort_options();
@@ -141,6 +148,7 @@ public:
 
     void sort_options_by_key()
     {
+        candidates_valid = false;
         std::sort(options.begin(), options.end(), [](const Option &o1, const Option &o2) { return o1.key < o2.key; });
     }
     void sort_options_by_label() { sort_options(); }
@@ -1663,8 +1663,8 @@ void SendMultiMachinePage::init_timer()
 void SendMultiMachinePage::on_timer(wxTimerEvent& event)
 {
     for (auto it = m_device_items.begin(); it != m_device_items.end(); it++) {
-        it->second->sync_state();
-        it->second->Refresh();
+        if (it->second->sync_state())
+            it->second->Refresh();
     }
 }
 
@@ -21,6 +21,7 @@
 #include <wx/imaglist.h>
 #include <wx/settings.h>
 #include <wx/filedlg.h>
+#include <wx/wupdlock.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
@@ -1186,7 +1187,7 @@ void Tab::load_config(const DynamicPrintConfig& config)
 void Tab::reload_config()
 {
     if (m_active_page)
-        m_active_page->reload_config();
+        m_active_page->reload_config(m_reload_changed_only);
 }
 
 void Tab::update_mode()
@@ -4581,6 +4582,9 @@ void Tab::load_current_preset()
     const Preset& preset = m_presets->get_edited_preset();
     int previous_extruder_count = 0;
 
+    // Field updates, relayouts and visibility changes below are painted once, when the tab is thawed.
+    wxWindowUpdateLocker freeze_guard(this);
+
     update_btns_enabling();
 
     if (m_type == Slic3r::Preset::TYPE_PRINTER) {
@@ -4604,7 +4608,9 @@ void Tab::load_current_preset()
 
     // Reload preset pages with the new configuration values.
     update_extruder_variants(-1, false);
+    m_reload_changed_only = true;
     reload_config();
+    m_reload_changed_only = false;
 
     update_ui_items_related_on_parent_preset(m_presets->get_selected_preset_parent());
 
@@ -6342,10 +6348,10 @@ Page::Page(wxWindow* parent, const wxString& title, int iconID, wxPanel* tab_own
     m_item_color = &wxGetApp().get_label_clr_default();
 }
 
-void Page::reload_config()
+void Page::reload_config(bool changed_only)
 {
     for (auto group : m_optgroups)
-        group->reload_config();
+        group->reload_config(changed_only);
 }
 
 void Page::update_visibility(ConfigOptionMode mode, bool update_contolls_visibility)
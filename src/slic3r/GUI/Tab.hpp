@@ -89,7 +89,7 @@ public:
 	const wxString&	title()	 const { return m_title; }
 	size_t		iconID() const { return m_iconID; }
 	void		set_config(DynamicPrintConfig* config_in) { m_config = config_in; }
-	void		reload_config();
+	void		reload_config(bool changed_only = false);
     void        update_visibility(ConfigOptionMode mode, bool update_contolls_visibility);
     void        activate(ConfigOptionMode mode, std::function<void()> throw_if_canceled);
     void        clear();
@@ -239,6 +239,8 @@ protected:
 	std::map<wxString, std::string>	m_category_icon;	// Map from a category name to an icon file name
 	std::vector<PageShp>			m_pages;
 	Page*				m_active_page {nullptr};
+	// Set while a preset is being loaded: reload_config() then only refreshes the fields whose values changed.
+	bool				m_reload_changed_only {false};
 	bool				m_disable_tree_sel_changed_event {false};
 	bool				m_show_incompatible_presets;
 	int					m_last_select_item = -1;
@@ -226,9 +226,13 @@ int TaskManager::schedule(TaskStateInfo* task)
             int result = m_agent->start_print(task->get_params(), task->update_status_fn, task->cancel_fn, task->wait_fn);
 #endif
             if (result == 0) {
-                last_sent_timestamp = std::chrono::system_clock::now();
-                task->set_sent_time(last_sent_timestamp);
+                auto sent_time = std::chrono::system_clock::now();
+                task->set_sent_time(sent_time);
                 task->set_state(TaskState::TS_SEND_COMPLETED);
+                // read by the schedule thread under the same lock
+                m_scedule_mutex.lock();
+                last_sent_timestamp = sent_time;
+                m_scedule_mutex.unlock();
             }
             else {
                 if (!task->is_canceled()) {
@@ -255,6 +259,19 @@ int TaskManager::schedule(TaskStateInfo* task)
     return 0;
 }
 
+// Release the finished sending threads, otherwise every sent task keeps its thread handle until exit.
+// Only called from the schedule thread, which is the only one touching m_sending_thread_list.
+void TaskManager::reap_sending_threads()
+{
+    auto it = std::remove_if(m_sending_thread_list.begin(), m_sending_thread_list.end(), [](boost::thread *thread) {
+        if (!thread->try_join_for(boost::chrono::milliseconds(0)))
+            return false;
+        delete thread;
+        return true;
+    });
+    m_sending_thread_list.erase(it, m_sending_thread_list.end());
+}
+
 void TaskManager::start()
 {
     if (m_started) {
@@ -285,6 +302,7 @@ void TaskManager::start()
                 }
                 m_scedule_mutex.unlock();
             }
+            this->reap_sending_threads();
             boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
         }
         BOOST_LOG_TRIVIAL(trace) << "task_manager: thread exit()";
@@ -160,6 +160,7 @@ public:
 
 private:
     int schedule(TaskStateInfo* task);
+    void reap_sending_threads();
 
     boost::thread                 m_scedule_thread;
 
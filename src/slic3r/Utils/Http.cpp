@@ -93,6 +93,9 @@ struct Http::priv
 		DEFAULT_TIMEOUT_CONNECT = 10,
         DEFAULT_TIMEOUT_MAX = 0,
 		DEFAULT_SIZE_LIMIT = 1024 * 1024 * 1024,
+		// curl sends uploads in 64kB pieces by default, which caps the throughput of large
+		// .gcode.3mf sends over fast links by the number of read callbacks and syscalls.
+		UPLOAD_BUFFER_SIZE = 1024 * 1024,
 	};
 
 	::CURL *curl;
@@ -233,10 +236,8 @@ int Http::priv::xfercb(void *userp, curl_off_t dltotal, curl_off_t dlnow, curl_o
 	bool cb_cancel = false;
 
 	if (self->progressfn) {
-		double speed;
-        curl_easy_getinfo(self->curl, CURLINFO_SPEED_UPLOAD, &speed);
-		if (speed > 0.01)
-			speed = speed;
+		double speed = 0.;
+		curl_easy_getinfo(self->curl, CURLINFO_SPEED_UPLOAD, &speed);
 		Progress progress(dltotal, dlnow, ultotal, ulnow, speed);
 		self->progressfn(progress, cb_cancel);
 	}
@@ -426,6 +427,12 @@ void Http::priv::http_perform()
 		::curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, postfields.size());
 	}
 
+#if LIBCURL_VERSION_NUM >= 0x073E00
+	if (form != nullptr || mime != nullptr || putFile) {
+		::curl_easy_setopt(curl, CURLOPT_UPLOAD_BUFFERSIZE, long(UPLOAD_BUFFER_SIZE));
+	}
+#endif
+
 	CURLcode res = ::curl_easy_perform(curl);
 
     putFile.reset();
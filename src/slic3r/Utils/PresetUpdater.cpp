@@ -1,6 +1,8 @@
 #include "PresetUpdater.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <set>
 #include <thread>
 #include <unordered_map>
 #include <ostream>
@@ -72,26 +74,58 @@ void copy_file_fix(const fs::path &source, const fs::path &target)
 	fs::permissions(target, perms);
 }
 
+// BBS: files of the same size are compared by content, thus the unchanged profiles of an updated bundle are not rewritten.
+static bool same_file_content(const fs::path &lhs, const fs::path &rhs)
+{
+    boost::system::error_code ec1, ec2;
+    auto lhs_size = fs::file_size(lhs, ec1);
+    auto rhs_size = fs::file_size(rhs, ec2);
+    if (ec1 || ec2 || lhs_size != rhs_size)
+        return false;
+    fs::ifstream lhs_stream(lhs, std::ios::binary);
+    fs::ifstream rhs_stream(rhs, std::ios::binary);
+    if (!lhs_stream || !rhs_stream)
+        return false;
+    char lhs_buf[16384], rhs_buf[16384];
+    while (lhs_stream && rhs_stream) {
+        lhs_stream.read(lhs_buf, sizeof(lhs_buf));
+        rhs_stream.read(rhs_buf, sizeof(rhs_buf));
+        if (lhs_stream.gcount() != rhs_stream.gcount() || memcmp(lhs_buf, rhs_buf, size_t(lhs_stream.gcount())) != 0)
+            return false;
+    }
+    return lhs_stream.eof() && rhs_stream.eof();
+}
+
 //BBS: add directory copy
+// Only the files which differ are copied, the files which are not in the source any more are removed.
 void copy_directory_fix(const fs::path &source, const fs::path &target)
 {
     BOOST_LOG_TRIVIAL(debug) << format("PresetUpdater: Copying %1% -> %2%", source, target);
     std::string error_message;
 
-    if (fs::exists(target))
-        fs::remove_all(target);
+    if (fs::exists(target) && !fs::is_directory(target))
+        fs::remove(target);
     fs::create_directories(target);
+    std::set<std::string> source_names;
+    size_t                unchanged = 0;
     for (auto &dir_entry : fs::directory_iterator(source))
     {
         std::string source_file = dir_entry.path().string();
         std::string name = dir_entry.path().filename().string();
         std::string target_file = target.string() + "/" + name;
+        source_names.insert(name);
 
         if (fs::is_directory(dir_entry)) {
             const auto target_path = target / name;
             copy_directory_fix(dir_entry, target_path);
         }
         else {
+            if (fs::is_directory(target_file))
+                fs::remove_all(target_file);
+            else if (same_file_content(dir_entry.path(), target_file)) {
+                ++unchanged;
+                continue;
+            }
             //CopyFileResult cfr = Slic3r::GUI::copy_file_gui(source_file, target_file, error_message, false);
             CopyFileResult cfr = copy_file(source_file, target_file, error_message, false);
             if (cfr != CopyFileResult::SUCCESS) {
@@ -102,6 +136,14 @@ void copy_directory_fix(const fs::path &source, const fs::path &target)
             }
         }
     }
+
+    std::vector<fs::path> removed;
+    for (auto &dir_entry : fs::directory_iterator(target))
+        if (source_names.find(dir_entry.path().filename().string()) == source_names.end())
+            removed.push_back(dir_entry.path());
+    for (auto &path : removed)
+        fs::remove_all(path);
+    BOOST_LOG_TRIVIAL(debug) << format("PresetUpdater: %1% files unchanged, %2% removed in %3%", unchanged, removed.size(), target);
     return;
 }
 
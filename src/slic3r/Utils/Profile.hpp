@@ -1,10 +1,10 @@
 #ifndef slic3r_GUI_Profile_hpp_
 #define slic3r_GUI_Profile_hpp_
 
-// Profiling support using the Shiny intrusive profiler
+// Profiling support using the thread safe intrusive profiler of libslic3r
 //#define SLIC3R_PROFILE_GUI
 #if defined(SLIC3R_PROFILE) && defined(SLIC3R_PROFILE_GUI)
-	#include <Shiny/Shiny.h>
+	#include <libslic3r/Profiler.hpp>
 	#define SLIC3R_GUI_PROFILE_FUNC() PROFILE_FUNC()
 	#define SLIC3R_GUI_PROFILE_BLOCK(name) PROFILE_BLOCK(name)
 	#define SLIC3R_GUI_PROFILE_UPDATE() PROFILE_UPDATE()
@@ -21,6 +21,8 @@
 #include <libslic3r/ObjectID.hpp>
 #include <libslic3r/Utils.hpp>
 
+#include "minilzo_extension.hpp"
+
 #include <boost/foreach.hpp>
 
 #ifndef NDEBUG
@@ -337,19 +339,47 @@ private:
 struct MutableHistoryInterval
 {
 private:
+	// Snapshots at least this large are stored LZO compressed, namely the ModelVolumes with painted facets.
+	static constexpr const size_t compress_threshold = 64 * 1024;
+	// The leading timestamp is always stored uncompressed, see matches_timestamp().
+	static constexpr const size_t raw_header_size = 8;
+
 	struct Data
 	{
 		// Reference counter of this data chunk. We may have used shared_ptr, but the shared_ptr is thread safe
 		// with the associated cost of CPU cache invalidation on refcount change.
 		size_t		refcnt;
+		// Number of bytes stored in data.
 		size_t		size;
+		// Size of the serialized data, larger than size if the data is compressed.
+		size_t		raw_size;
 		char 		data[1];
 
+		bool 		compressed() const { return this->raw_size != this->size; }
+
 		// The serialized data matches the data stored here.
-		bool 		matches(const std::string& rhs) { return this->size == rhs.size() && memcmp(this->data, rhs.data(), this->size) == 0; }
+		bool 		matches(const std::string& rhs) const {
+			if (this->raw_size != rhs.size())
+				return false;
+			if (! this->compressed())
+				return memcmp(this->data, rhs.data(), this->size) == 0;
+			return memcmp(this->data, rhs.data(), raw_header_size) == 0 && this->uncompressed() == rhs;
+		}
 
 		// The timestamp matches the timestamp serialized in the data stored here.
 		bool 		matches_timestamp(uint64_t timestamp) { assert(timestamp > 0);  assert(this->size > 8); return memcmp(this->data, &timestamp, 8) == 0; }
+
+		std::string uncompressed() const {
+			if (! this->compressed())
+				return std::string(this->data, this->data + this->size);
+			std::string out(this->raw_size, 0);
+			memcpy(out.data(), this->data, raw_header_size);
+			uint64_t out_len = this->raw_size - raw_header_size;
+			int ret = lzo_decompress((unsigned char*)this->data + raw_header_size, this->size - raw_header_size, (unsigned char*)out.data() + raw_header_size, &out_len);
+			assert(ret == 0 && out_len == this->raw_size - raw_header_size);
+			(void)ret;
+			return out;
+		}
 	};
 
 	Interval    m_interval;
@@ -357,9 +387,25 @@ private:
 
 public:
 	MutableHistoryInterval(const Interval &interval, const std::string &input_data) : m_interval(interval), m_data(nullptr) {
+		if (input_data.size() >= compress_threshold) {
+			// Worst case expansion of LZO1X.
+			size_t   payload = input_data.size() - raw_header_size;
+			std::vector<unsigned char> compressed(payload + payload / 16 + 64 + 3);
+			uint64_t compressed_len = compressed.size();
+			if (lzo_compress((unsigned char*)input_data.data() + raw_header_size, payload, compressed.data(), &compressed_len) == 0 && compressed_len < payload) {
+				m_data = (Data*)new char[offsetof(Data, data) + raw_header_size + compressed_len];
+				m_data->refcnt   = 1;
+				m_data->size     = raw_header_size + compressed_len;
+				m_data->raw_size = input_data.size();
+				memcpy(m_data->data, input_data.data(), raw_header_size);
+				memcpy(m_data->data + raw_header_size, compressed.data(), compressed_len);
+				return;
+			}
+		}
 		m_data = (Data*)new char[offsetof(Data, data) + input_data.size()];
 		m_data->refcnt = 1;
 		m_data->size = input_data.size();
+		m_data->raw_size = input_data.size();
 		memcpy(m_data->data, input_data.data(), input_data.size());
 	}
 
@@ -391,6 +437,8 @@ public:
 
 	const char* data() const { return m_data->data; }
 	size_t  	size() const { return m_data->size; }
+	// The serialized data, decompressed if needed.
+	std::string	serialized() const { return m_data->uncompressed(); }
 	size_t		refcnt() const { return m_data->refcnt; }
 	bool		matches(const std::string& data) { return m_data->matches(data); }
 	bool		matches_timestamp(uint64_t timestamp) { return m_data->matches_timestamp(timestamp); }
@@ -484,7 +532,7 @@ public:
 				--it;
 		}
 		//assert(timestamp >= it->begin() && timestamp < it->end());
-		return std::string(it->data(), it->data() + it->size());
+		return it->serialized();
 	}
 
 	// Currently all mutable snapshots are mandatory.
@@ -130,87 +130,45 @@ int json_diff::all2diff(json const &in, json &out)
     return 0;
 }
 
-int json_diff::restore_objects(json const &in, json &out, json const &base)
+int json_diff::restore_objects(json const &in, json &base)
 {
-    json jout;
+    /* apply the diff message onto the base in place,
+       only the elements carried by the input are touched */
+    for (auto& el: in.items()) {
+        auto it = base.find(el.key());
 
-    for (auto& el: base.items()) {
-        /*element not in input json,
-          use base element to restore*/
-        if (!in.contains(el.key()) ) {
-            out[el.key()] = el.value();
-            /*
-            BBL_LOG_INFO("json_c restore compressed key " << el.key()
+        /*a new element comming, but not be recoreded in base
+          need be added to base*/
+        if (it == base.end()) {
+            BOOST_LOG_TRIVIAL(trace) << "json_c append new " << el.key()
                         << " type: "  << el.value().type_name()
-                        << " value: " << el.value());
-            */
+                        << " value: " << el.value();
+            base[el.key()] = el.value();
             continue;
         }
 
         /*element in both base and input, but json type changed
            use input to restore*/
-        if (el.value().type() != in[el.key()].type() ){
-            out[el.key()] = in[el.key()];
+        if (it->type() != el.value().type()) {
             BOOST_LOG_TRIVIAL(trace) << "json_c restore type changed"
                   << " key: " << el.key() << " value: "
-                  << in[el.key()].dump()
-                  << " last value: " << el.value().dump();
+                  << el.value().dump()
+                  << " last value: " << it->dump();
+            *it = el.value();
             continue;
         }
 
         /*element in both base and input, it is a object
           recursive until basic type*/
         if (el.value().is_object()) {
-            json recur_out;
-            int recur_ret = restore_objects(
-                              in[el.key()], recur_out, el.value());
-            if (recur_ret == 0) {
-                out[el.key()] = recur_out;
-            }
+            restore_objects(el.value(), *it);
             continue;
         }
 
         /*element in both base and input, but value changed
           use input to restore*/
-        if (el.value() != in[el.key()]) {
-            out[el.key()] = in[el.key()];
-            continue;
-        }
-        /*element in both base and input,value is same
-          use base to restore*/
-        out[el.key()] = el.value();
-    }
-
-    if (out.empty())
-        return  -1;
-
-    return 0;
-}
-
-int json_diff::restore_append_objects(json const &in, json &out)
-{
-    /*a new element comming, but be recoreded in base
-      need be added to output*/
-    for (auto& el: in.items()) {
-
-        if (!out.contains(el.key()) ) {
-            BOOST_LOG_TRIVIAL(trace) << "json_c append new " << el.key()
-                        << " type: "  << el.value().type_name()
-                        << " value: " << el.value();
-            out[el.key()] = el.value();
-            continue;
-        }
-
-        if (el.value().is_object()) {
-            int recur_ret =
-                     restore_append_objects(el.value(), out[el.key()]);
-            if (recur_ret != 0) {
-                BOOST_LOG_TRIVIAL(trace) << "json_c append obj failed"
-                                 << " key: " << el.key()
-                                 << " value: " << el.value();
-                return recur_ret;
-            }
-        }
+        if (*it != el.value())
+            *it = el.value();
     }
     return 0;
 }
@@ -233,19 +191,13 @@ void json_diff::merge_objects(json const &in, json &out)
 int json_diff::diff2all(json const &in, json &out)
 {
     if (!diff2all_base.empty()) {
-        int ret = restore_objects(in, out, diff2all_base);
-        if (ret < 0) {
-            BOOST_LOG_TRIVIAL(trace) << "json_c restore failed";
-            decode_error_count++;
-            return ret;
-        }
+        restore_objects(in, diff2all_base);
     } else {
         BOOST_LOG_TRIVIAL(trace) << "json_c restore base empty";
         decode_error_count++;
         return -1;
     }
-    restore_append_objects(in, out);
-    diff2all_base = out;
+    out = diff2all_base;
     decode_error_count = 0;
     return 0;
 }
@@ -24,8 +24,7 @@ private:
     int  decode_error_count = 0;
 
     int  diff_objects(json const &in, json &out, json const &base);
-    int  restore_objects(json const &in, json &out, json const &base);
-    int  restore_append_objects(json const &in, json &out);
+    int  restore_objects(json const &in, json &base);
     void merge_objects(json const &in, json &out);
 
 public:
@@ -0,0 +1,149 @@
+// Micro-benchmarks of the geometry kernels the slicer spends most of its time in.
+// The inputs are slices of the real world models from tests/data, so that the numbers are comparable
+// between kernel optimizations, compilers and architectures.
+//
+// Usage: geometry_benchmarks [Catch2 arguments, for example "[ClipperUtils]" or --benchmark-samples 20]
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch_main.hpp>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/AABBTreeIndirect.hpp"
+#include "libslic3r/ClipperUtils.hpp"
+#include "libslic3r/EdgeGrid.hpp"
+#include "libslic3r/ExtrusionEntityCollection.hpp"
+#include "libslic3r/ShortestPath.hpp"
+#include "libslic3r/TriangleMesh.hpp"
+#include "libslic3r/TriangleMeshSlicer.hpp"
+#include "libslic3r/Format/OBJ.hpp"
+
+using namespace Slic3r;
+
+static TriangleMesh load_benchmark_model(const std::string &obj_filename)
+{
+    TriangleMesh mesh;
+    ObjInfo      obj_info;
+    std::string  message;
+    std::string  path = std::string(TEST_DATA_DIR) + "/" + obj_filename;
+    load_obj(path.c_str(), &mesh, obj_info, message);
+    return mesh;
+}
+
+static const std::vector<TriangleMesh>& benchmark_meshes()
+{
+    static const std::vector<TriangleMesh> meshes { load_benchmark_model("frog_legs.obj"), load_benchmark_model("extruder_idler.obj") };
+    return meshes;
+}
+
+// 50 layers of each of the benchmark meshes.
+static const std::vector<ExPolygons>& benchmark_slices()
+{
+    static const std::vector<ExPolygons> slices = [] {
+        std::vector<ExPolygons> out;
+        for (const TriangleMesh &mesh : benchmark_meshes()) {
+            const BoundingBoxf3 bbox = mesh.bounding_box();
+            std::vector<float> zs;
+            for (size_t i = 0; i < 50; ++ i)
+                zs.emplace_back(float(bbox.min.z() + (bbox.max.z() - bbox.min.z()) * (double(i) + 0.5) / 50.));
+            append(out, slice_mesh_ex(mesh.its, zs));
+        }
+        return out;
+    }();
+    return slices;
+}
+
+TEST_CASE("ClipperUtils kernels", "[ClipperUtils]") {
+    const std::vector<ExPolygons> &slices = benchmark_slices();
+    REQUIRE(! slices.empty());
+    const coord_t delta = scaled<coord_t>(0.4);
+
+    BENCHMARK("offset_ex") {
+        size_t cnt = 0;
+        for (const ExPolygons &layer : slices)
+            cnt += offset_ex(layer, - float(delta)).size();
+        return cnt;
+    };
+    BENCHMARK("union_ex") {
+        size_t cnt = 0;
+        for (const ExPolygons &layer : slices) {
+            Polygons polygons = to_polygons(layer);
+            Polygons shifted  = polygons;
+            for (Polygon &polygon : shifted)
+                polygon.translate(delta, delta);
+            append(polygons, std::move(shifted));
+            cnt += union_ex(polygons).size();
+        }
+        return cnt;
+    };
+    BENCHMARK("diff_ex") {
+        size_t cnt = 0;
+        for (const ExPolygons &layer : slices)
+            cnt += diff_ex(layer, offset(layer, - float(delta))).size();
+        return cnt;
+    };
+}
+
+TEST_CASE("EdgeGrid creation", "[EdgeGrid]") {
+    const std::vector<ExPolygons> &slices = benchmark_slices();
+    BENCHMARK("EdgeGrid::Grid::create") {
+        size_t cnt = 0;
+        for (const ExPolygons &layer : slices) {
+            EdgeGrid::Grid grid;
+            grid.set_bbox(get_extents(layer));
+            grid.create(layer, scaled<coord_t>(1.));
+            cnt += grid.rows() * grid.cols();
+        }
+        return cnt;
+    };
+}
+
+TEST_CASE("AABB tree construction", "[AABBTree]") {
+    const std::vector<TriangleMesh> &meshes = benchmark_meshes();
+    BENCHMARK("build_aabb_tree_over_indexed_triangle_set") {
+        size_t cnt = 0;
+        for (const TriangleMesh &mesh : meshes)
+            cnt += AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(mesh.its.vertices, mesh.its.indices).nodes().size();
+        return cnt;
+    };
+}
+
+TEST_CASE("Extrusion chaining", "[ShortestPath]") {
+    // Contours and holes of all the layers as open extrusion paths, so that the chaining may reverse them.
+    ExtrusionEntityCollection collection;
+    for (const ExPolygons &layer : benchmark_slices())
+        for (Polyline &polyline : to_polylines(layer)) {
+            ExtrusionPath path(erPerimeter, 0.05, 0.45f, 0.2f);
+            path.polyline = std::move(polyline);
+            collection.append(std::move(path));
+        }
+    REQUIRE(collection.entities.size() > 1000);
+    BENCHMARK("chain_extrusion_entities") {
+        return chain_extrusion_entities(collection.entities).size();
+    };
+}
+
+TEST_CASE("Point in polygon", "[Polygon]") {
+    // The vertices of all the layers tested against the largest island of each layer, the way support and seam code queries them.
+    std::vector<std::pair<const ExPolygon*, Points>> queries;
+    for (const ExPolygons &layer : benchmark_slices())
+        if (! layer.empty()) {
+            const ExPolygon *largest = &*std::max_element(layer.begin(), layer.end(),
+                [](const ExPolygon &l, const ExPolygon &r) { return l.area() < r.area(); });
+            queries.emplace_back(largest, to_points(layer));
+        }
+    REQUIRE(! queries.empty());
+    BENCHMARK("ExPolygon::contains") {
+        size_t cnt = 0;
+        for (const auto &[expoly, points] : queries)
+            for (const Point &pt : points)
+                cnt += expoly->contains(pt);
+        return cnt;
+    };
+    BENCHMARK("ExPolygon::contains_points") {
+        size_t cnt = 0;
+        for (const auto &[expoly, points] : queries)
+            for (bool inside : expoly->contains_points(points))
+                cnt += inside;
+        return cnt;
+    };
+}
@@ -0,0 +1,178 @@
+// End-to-end slicing benchmarks of synthetic reference projects.
+// Every benchmark runs Print::process() and Print::export_gcode() and records the wall times, the per step
+// SlicingProfiler records, the process peak memory and a hash of the G-code.
+//
+// Usage: slicer_benchmarks [--json <file>] [Catch2 arguments, for example a benchmark name or "[Benchmark]"]
+// The JSON report is written to stdout if --json is not given.
+
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/Model.hpp"
+#include "libslic3r/MultiMaterialSegmentation.hpp"
+#include "libslic3r/Print.hpp"
+#include "libslic3r/SlicingProfiler.hpp"
+#include "libslic3r/TriangleSelector.hpp"
+
+#include "test_data.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/cstdio.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include "nlohmann/json.hpp"
+
+using namespace Slic3r;
+using namespace Slic3r::Test;
+
+static nlohmann::json g_report = nlohmann::json::array();
+
+// FNV-1a, stable across platforms and standard library implementations, unlike std::hash.
+static uint64_t fnv1a_hash(const std::string &data)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Slice the meshes with the config, adjust_model may modify the model (for example paint it) before slicing.
+static void run_benchmark(const std::string &name, std::vector<TriangleMesh> &&meshes, std::initializer_list<ConfigBase::SetDeserializeItem> config_items,
+    std::function<void(Model&)> adjust_model = nullptr)
+{
+    DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+    config.set_deserialize_strict(config_items);
+
+    Model model;
+    Print print;
+    init_print(std::move(meshes), print, model, config);
+    if (adjust_model) {
+        adjust_model(model);
+        print.apply(model, print.full_print_config());
+    }
+
+    auto time_ms = [](auto start) { return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+    auto start = std::chrono::steady_clock::now();
+    print.process();
+    double process_ms = time_ms(start);
+
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    start = std::chrono::steady_clock::now();
+    print.export_gcode(temp.string(), nullptr, nullptr);
+    double export_ms = time_ms(start);
+    boost::nowide::ifstream t(temp.string());
+    std::string gcode((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
+    t.close();
+    boost::nowide::remove(temp.string().c_str());
+    REQUIRE(! gcode.empty());
+
+    char hash[17];
+    sprintf(hash, "%016llx", (unsigned long long)fnv1a_hash(gcode));
+    g_report.push_back({
+        { "name",           name },
+        { "objects",        print.objects().size() },
+        { "process_ms",     process_ms },
+        { "export_ms",      export_ms },
+        // Peak of the whole process, thus it never decreases from one benchmark to the next.
+        { "peak_memory",    SlicingProfiler::peak_memory_usage() },
+        { "gcode_size",     gcode.size() },
+        { "gcode_hash",     hash },
+        { "steps",          print.slicing_profiler().to_json() }
+    });
+    WARN(name << ": process " << process_ms << " ms, export " << export_ms << " ms");
+}
+
+TEST_CASE("many small parts", "[Benchmark]") {
+    std::vector<TriangleMesh> meshes;
+    for (size_t i = 0; i < 64; ++ i)
+        meshes.emplace_back((i % 2 == 0) ? mesh(TestMesh::cube_20x20x20, Vec3d::Zero(), 0.3) : mesh(TestMesh::small_dorito));
+    run_benchmark("many_small_parts", std::move(meshes), { { "sparse_infill_density", "15%" } });
+}
+
+TEST_CASE("tall vase", "[Benchmark]") {
+    std::vector<TriangleMesh> meshes;
+    meshes.emplace_back(mesh(TestMesh::cube_20x20x20, Vec3d::Zero(), Vec3d(4., 4., 10.)));
+    run_benchmark("tall_vase", std::move(meshes), {
+        { "spiral_mode",            1 },
+        { "wall_loops",             1 },
+        { "top_shell_layers",       0 },
+        { "sparse_infill_density",  "0%" }
+    });
+}
+
+TEST_CASE("dense organic supports", "[Benchmark]") {
+    std::vector<TriangleMesh> meshes;
+    meshes.emplace_back(mesh(TestMesh::sphere_50mm));
+    meshes.emplace_back(mesh(TestMesh::overhang));
+    meshes.emplace_back(mesh(TestMesh::ipadstand));
+    run_benchmark("dense_organic_supports", std::move(meshes), {
+        { "enable_support",         1 },
+        { "support_type",           "tree(auto)" },
+        { "sparse_infill_density",  "15%" }
+    });
+}
+
+TEST_CASE("8 colour MMU", "[Benchmark]") {
+    std::vector<TriangleMesh> meshes;
+    meshes.emplace_back(mesh(TestMesh::sphere_50mm));
+    // Paint the sphere into 8 sectors around the Z axis, one for each filament.
+    auto paint = [](Model &model) {
+        ModelVolume     *volume = model.objects.front()->volumes.front();
+        TriangleSelector selector(volume->mesh());
+        for (int facet_idx = 0; facet_idx < int(volume->mesh().its.indices.size()); ++ facet_idx) {
+            Vec3f n      = its_face_normal(volume->mesh().its, facet_idx);
+            int   sector = std::clamp(int(std::floor((std::atan2(n.y(), n.x()) + PI) / (2. * PI) * 8.)), 0, 7);
+            selector.set_facet(facet_idx, EnforcerBlockerType(int(EnforcerBlockerType::Extruder1) + sector));
+        }
+        volume->mmu_segmentation_facets.set(selector);
+        // Measure the segmentation itself, not the cache.
+        MultiMaterialSegmentationCache::instance().clear();
+    };
+    run_benchmark("mmu_8_colours", std::move(meshes), {
+        { "filament_colour",        "#FF0000;#00FF00;#0000FF;#FFFF00;#FF00FF;#00FFFF;#FFFFFF;#000000" },
+        { "filament_diameter",      "1.75,1.75,1.75,1.75,1.75,1.75,1.75,1.75" },
+        { "enable_prime_tower",     1 }
+    }, paint);
+}
+
+TEST_CASE("arachne heavy", "[Benchmark]") {
+    std::vector<TriangleMesh> meshes;
+    meshes.emplace_back(mesh(TestMesh::gt2_teeth));
+    meshes.emplace_back(mesh(TestMesh::two_hollow_squares));
+    meshes.emplace_back(mesh(TestMesh::A));
+    meshes.emplace_back(mesh(TestMesh::sloping_hole));
+    run_benchmark("arachne_heavy", std::move(meshes), {
+        { "wall_generator",         "arachne" },
+        { "wall_loops",             6 }
+    });
+}
+
+int main(int argc, char **argv)
+{
+    Catch::Session session;
+    std::string    json_path;
+    using namespace Catch::clara;
+    session.cli(session.cli() | Opt(json_path, "file")["--json"]("write the benchmark report to a file instead of stdout"));
+    if (int ret = session.applyCommandLine(argc, argv); ret != 0)
+        return ret;
+
+    int ret = session.run();
+    nlohmann::json report = { { "benchmarks", g_report } };
+    if (json_path.empty())
+        std::cout << report.dump(4) << std::endl;
+    else
+        boost::nowide::ofstream(json_path) << report.dump(4) << std::endl;
+    return ret;
+}
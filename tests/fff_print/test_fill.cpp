@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 
+#include <chrono>
 #include <numeric>
 #include <sstream>
 
@@ -429,6 +430,21 @@ for my $pattern (qw(rectilinear honeycomb hilbertcurve concentric)) {
 }
 */
 
+// Not run by default, measures the generation of the lightning infill of a large sparse object: ./fff_print_tests "[LightningBenchmark]"
+TEST_CASE("Fill: lightning infill benchmark", "[.][LightningBenchmark]") {
+    Slic3r::Print print;
+    DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+    config.set_deserialize_strict({
+        { "sparse_infill_pattern",  "lightning" },
+        { "sparse_infill_density",  "10%" },
+        { "layer_height",           0.2 }
+    });
+    auto start = std::chrono::steady_clock::now();
+    Slic3r::Test::init_and_process_print({ Slic3r::Test::mesh(Slic3r::Test::TestMesh::sphere_50mm, Vec3d::Zero(), 3.) }, print, config);
+    WARN("Slicing with lightning infill " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s");
+    REQUIRE(print.objects().front()->layers().size() > 0);
+}
+
 bool test_if_solid_surface_filled(const ExPolygon& expolygon, double flow_spacing, double angle, double density)
 {
     std::unique_ptr<Slic3r::Fill> filler(Slic3r::Fill::new_from_type("rectilinear"));
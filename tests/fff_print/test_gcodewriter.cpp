@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 
+#include <chrono>
 #include <memory>
 
 #include "libslic3r/GCodeWriter.hpp"
@@ -94,3 +95,57 @@ SCENARIO("set_speed emits values with fixed-point output.", "[GCodeWriter]") {
         }
     }
 }
+
+SCENARIO("Appending G1 moves to a buffer matches the returned strings.", "[GCodeWriter]") {
+    GIVEN("Two GCodeWriter instances with a single extruder") {
+        GCodeWriter writer, writer_append;
+        for (GCodeWriter *w : { &writer, &writer_append }) {
+            w->config.load(std::string(TEST_DATA_DIR) + "/fff_print_tests/test_gcodewriter/config_lift_unlift.ini", ForwardCompatibilitySubstitutionRule::Disable);
+            w->set_extruders({ 0 });
+            w->set_extruder(0);
+        }
+        WHEN("the same extrusions are emitted") {
+            std::string returned;
+            std::string appended;
+            for (int i = 0; i < 100; ++ i) {
+                Vec2d pt(0.37 * i, 100. - 0.11 * i);
+                returned += writer.extrude_to_xy(pt, 0.0123, "perimeter");
+                writer_append.extrude_to_xy(appended, pt, 0.0123, "perimeter");
+            }
+            THEN("the G-code is identical") {
+                REQUIRE(! appended.empty());
+                REQUIRE(returned == appended);
+            }
+        }
+    }
+}
+
+// Not run by default, measures the G1 emission throughput: ./fff_print_tests "[GCodeWriterBenchmark]"
+TEST_CASE("G1 emission benchmark", "[.][GCodeWriterBenchmark]") {
+    GCodeWriter writer;
+    writer.config.load(std::string(TEST_DATA_DIR) + "/fff_print_tests/test_gcodewriter/config_lift_unlift.ini", ForwardCompatibilitySubstitutionRule::Disable);
+    writer.set_extruders({ 0 });
+    writer.set_extruder(0);
+
+    constexpr const size_t num_lines = 2000000;
+    auto lines_per_s = [](std::chrono::steady_clock::time_point start) {
+        return double(num_lines) / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::string gcode;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_lines; ++ i)
+        gcode += writer.extrude_to_xy(Vec2d(double(i % 2560) * 0.1, double(i % 1920) * 0.1), 0.0123);
+    double returned_speed = lines_per_s(start);
+    size_t returned_size  = gcode.size();
+
+    gcode.clear();
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_lines; ++ i)
+        writer.extrude_to_xy(gcode, Vec2d(double(i % 2560) * 0.1, double(i % 1920) * 0.1), 0.0123);
+    double appended_speed = lines_per_s(start);
+
+    REQUIRE(gcode.size() > 0);
+    REQUIRE(returned_size > 0);
+    WARN("G1 lines per second: returned " << returned_speed << ", appended " << appended_speed);
+}
@@ -59,3 +59,43 @@ SCENARIO("Model construction", "[Model]") {
         }
     }
 }
+
+SCENARIO("Identical meshes are shared", "[Model]") {
+    GIVEN("A Model with two objects holding the same cube and one holding a different cube") {
+        Slic3r::Model model;
+        model.add_object()->add_volume(Slic3r::make_cube(20, 20, 20));
+        model.add_object()->add_volume(Slic3r::make_cube(20, 20, 20));
+        model.add_object()->add_volume(Slic3r::make_cube(10, 10, 10));
+        WHEN("share_identical_meshes() is called") {
+            size_t shared = model.share_identical_meshes();
+            THEN("only the duplicate cube is re-pointed") {
+                REQUIRE(shared == 1);
+                REQUIRE(model.objects[0]->volumes.front()->mesh_ptr() == model.objects[1]->volumes.front()->mesh_ptr());
+                REQUIRE(model.objects[0]->volumes.front()->mesh_ptr() != model.objects[2]->volumes.front()->mesh_ptr());
+            }
+            THEN("scaling one of the shared volumes leaves the other untouched") {
+                ModelVolume *volume = model.objects[1]->volumes.front();
+                volume->scale_geometry_after_creation(2.f);
+                REQUIRE(volume->mesh_ptr() != model.objects[0]->volumes.front()->mesh_ptr());
+                REQUIRE(model.objects[0]->volumes.front()->mesh().bounding_box().size().x() == Approx(20.));
+                REQUIRE(volume->mesh().bounding_box().size().x() == Approx(40.));
+            }
+        }
+    }
+}
+
+SCENARIO("Painted facets survive the 3MF string round trip", "[Model]") {
+    GIVEN("A volume with painting data set from 3MF strings") {
+        Slic3r::Model model;
+        ModelVolume *volume = model.add_object()->add_volume(Slic3r::make_cube(20, 20, 20));
+        const std::string first = "4";
+        const std::string second = "1C0EA3F4";
+        volume->mmu_segmentation_facets.set_triangle_from_string(0, first);
+        volume->mmu_segmentation_facets.set_triangle_from_string(5, second);
+        THEN("the strings read back are the same") {
+            REQUIRE(volume->mmu_segmentation_facets.get_triangle_as_string(0) == first);
+            REQUIRE(volume->mmu_segmentation_facets.get_triangle_as_string(5) == second);
+            REQUIRE(volume->mmu_segmentation_facets.get_triangle_as_string(3).empty());
+        }
+    }
+}
@@ -3,9 +3,13 @@
 #include "libslic3r/libslic3r.h"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/Layer.hpp"
+#include "libslic3r/ClipperUtils.hpp"
 
 #include "test_data.hpp"
 
+#include <chrono>
+#include <boost/filesystem.hpp>
+
 using namespace Slic3r;
 using namespace Slic3r::Test;
 
@@ -126,3 +130,122 @@ SCENARIO("Print: Brim generation", "[Print]") {
         }
     }
 }
+
+static void slice_cache_round_trip(PrintBase::CachedDataFormat format, const DynamicPrintConfig &config, const std::string &directory)
+{
+    Slic3r::Print print;
+    Slic3r::Model model;
+    Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+    print.process();
+    REQUIRE(print.export_cached_data(directory, false, format) == 0);
+
+    // the cache files are named after the instance ids, thus the same model is applied again
+    Slic3r::Print cached_print;
+    cached_print.apply(model, print.full_print_config());
+    REQUIRE(cached_print.load_cached_data(directory) == 0);
+
+    const PrintObject &object        = *print.objects().front();
+    const PrintObject &cached_object = *cached_print.objects().front();
+    REQUIRE(cached_object.layer_count() == object.layer_count());
+    REQUIRE(cached_object.support_layer_count() == object.support_layer_count());
+    for (size_t layer_id = 0; layer_id < object.layer_count(); ++ layer_id) {
+        const Layer &layer        = *object.get_layer(int(layer_id));
+        const Layer &cached_layer = *cached_object.get_layer(int(layer_id));
+        REQUIRE(cached_layer.print_z == Approx(layer.print_z));
+        REQUIRE(cached_layer.lslices.size() == layer.lslices.size());
+        REQUIRE(area(cached_layer.lslices) == Approx(area(layer.lslices)));
+        REQUIRE(cached_layer.regions().size() == layer.regions().size());
+        for (size_t region_id = 0; region_id < layer.regions().size(); ++ region_id) {
+            const LayerRegion &layerm        = *layer.regions()[region_id];
+            const LayerRegion &cached_layerm = *cached_layer.regions()[region_id];
+            REQUIRE(cached_layerm.perimeters.items_count() == layerm.perimeters.items_count());
+            REQUIRE(cached_layerm.fills.items_count() == layerm.fills.items_count());
+            REQUIRE(cached_layerm.fill_surfaces.size() == layerm.fill_surfaces.size());
+            REQUIRE(cached_layerm.perimeters.total_volume() == Approx(layerm.perimeters.total_volume()));
+        }
+    }
+}
+
+SCENARIO("Print: slicing data cache", "[Print]") {
+    DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+    config.set_deserialize_strict({ { "sparse_infill_density", "20%" }, { "enable_support", 1 } });
+    const std::string directory = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+    GIVEN("sliced 20mm cube") {
+        THEN("binary cache loads back the same layers") {
+            slice_cache_round_trip(PrintBase::CachedDataFormat::Binary, config, directory);
+        }
+        THEN("json cache loads back the same layers") {
+            slice_cache_round_trip(PrintBase::CachedDataFormat::Json, config, directory);
+        }
+    }
+    boost::filesystem::remove_all(directory);
+}
+
+// Not run by default, compares the binary cache with the json one: ./fff_print_tests "[SliceCacheBenchmark]"
+TEST_CASE("Print: slicing data cache benchmark", "[.][SliceCacheBenchmark]") {
+    Slic3r::Print print;
+    Slic3r::Model model;
+    Slic3r::Test::init_print({TestMesh::cube_20x20x20, TestMesh::overhang, TestMesh::pyramid, TestMesh::two_hollow_squares}, print, model,
+        { { "sparse_infill_density", "30%" }, { "enable_support", 1 } });
+    print.process();
+
+    const std::string directory = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path()).string();
+    for (PrintBase::CachedDataFormat format : { PrintBase::CachedDataFormat::Json, PrintBase::CachedDataFormat::Binary }) {
+        auto time_ms = [](std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        };
+        auto start = std::chrono::steady_clock::now();
+        REQUIRE(print.export_cached_data(directory, false, format) == 0);
+        long long export_ms = time_ms(start);
+
+        uintmax_t bytes = 0;
+        for (const boost::filesystem::directory_entry &entry : boost::filesystem::directory_iterator(directory))
+            bytes += boost::filesystem::file_size(entry.path());
+
+        Slic3r::Print cached_print;
+        cached_print.apply(model, print.full_print_config());
+        start = std::chrono::steady_clock::now();
+        REQUIRE(cached_print.load_cached_data(directory) == 0);
+        long long load_ms = time_ms(start);
+
+        WARN((format == PrintBase::CachedDataFormat::Json ? "json" : "binary") << " cache: export " << export_ms << " ms, load " << load_ms << " ms, " << bytes << " bytes");
+    }
+    boost::filesystem::remove_all(directory);
+}
+
+// Not run by default, compares the legacy Clipper with Clipper2 on perimeter and support generation: ./fff_print_tests "[Clipper2Benchmark]"
+TEST_CASE("Print: Clipper2 backend benchmark", "[.][Clipper2Benchmark]") {
+    for (uint32_t operations : { uint32_t(0), uint32_t(ClipperUtils::c2All) }) {
+        ClipperUtils::set_clipper2_operations(operations);
+        Slic3r::Print print;
+        Slic3r::Model model;
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20, TestMesh::overhang, TestMesh::pyramid, TestMesh::two_hollow_squares, TestMesh::ipadstand}, print, model,
+            { { "sparse_infill_density", "30%" }, { "enable_support", 1 }, { "wall_loops", 4 } });
+        auto start = std::chrono::steady_clock::now();
+        print.process();
+        double process_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1000.;
+
+        // The boolean operations and offsets of the perimeter generator and of the support generator on the sliced layers.
+        start = std::chrono::steady_clock::now();
+        double perimeters_area = 0., support_area = 0.;
+        for (const PrintObject *object : print.objects()) {
+            const Layer *lower = nullptr;
+            for (const Layer *layer : object->layers()) {
+                ExPolygons last = layer->lslices;
+                for (int loop = 0; loop < 4; ++ loop) {
+                    last = offset_ex(last, - scaled<float>(0.45));
+                    perimeters_area += area(last);
+                }
+                if (lower != nullptr) {
+                    ExPolygons overhangs = diff_ex(layer->lslices, offset_ex(lower->lslices, scaled<float>(0.2)));
+                    support_area += area(union_ex(diff_ex(offset_ex(overhangs, scaled<float>(1.)), layer->lslices)));
+                }
+                lower = layer;
+            }
+        }
+        double clipper_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1000.;
+        WARN((operations == 0 ? "legacy Clipper" : "Clipper2") << ": process " << process_ms << " ms, layer operations " << clipper_ms
+            << " ms, perimeters area " << perimeters_area << ", support area " << support_area);
+    }
+    ClipperUtils::set_clipper2_operations(0);
+}
@@ -2,10 +2,12 @@
 
 #include "libslic3r/libslic3r.h"
 #include "libslic3r/GCodeReader.hpp"
+#include "libslic3r/ModelArrange.hpp"
 
 #include "test_data.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <boost/regex.hpp>
 
 using namespace Slic3r;
@@ -269,3 +271,23 @@ SCENARIO( "PrintGCode basic functionality", "[PrintGCode]") {
         }
     }
 }
+
+// Not run by default, measures the G-code export of a plate full of small parts with holes: ./fff_print_tests "[AvoidCrossingPerimetersBenchmark]"
+TEST_CASE("PrintGCode: avoid crossing perimeters benchmark", "[.][AvoidCrossingPerimetersBenchmark]") {
+    for (bool reduce_crossing_wall : { false, true }) {
+        Slic3r::Print print;
+        Slic3r::Model model;
+        DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+        config.set_deserialize_strict({ { "reduce_crossing_wall", reduce_crossing_wall }, { "sparse_infill_density", "15%" } });
+        Slic3r::Test::init_print(std::vector<TriangleMesh>(25, mesh(TestMesh::cube_with_hole)), print, model, config);
+        // Each object printed twice to share the travels of its instances.
+        for (ModelObject *object : model.objects)
+            object->add_instance();
+        arrange_objects(model, InfiniteBed{}, ArrangeParams{ scaled(min_object_distance(print.full_print_config())) });
+        print.apply(model, print.full_print_config());
+        print.process();
+        auto start = std::chrono::steady_clock::now();
+        Slic3r::Test::gcode(print);
+        WARN("reduce_crossing_wall " << reduce_crossing_wall << ": G-code export " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s");
+    }
+}
@@ -3,6 +3,8 @@
 #include "libslic3r/libslic3r.h"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/Layer.hpp"
+#include "libslic3r/MultiMaterialSegmentation.hpp"
+#include "libslic3r/TriangleSelector.hpp"
 
 #include "test_data.hpp"
 
@@ -87,3 +89,144 @@ SCENARIO("PrintObject: object layer heights", "[PrintObject]") {
 #endif
     }
 }
+
+SCENARIO("PrintObject: editing a height range modifier regenerates the perimeters of its layers only", "[PrintObject]") {
+    GIVEN("20mm cube with a height range modifier from 10mm to 14mm") {
+        Slic3r::Print print;
+        Slic3r::Model model;
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, {
+            { "initial_layer_print_height", 1 },
+            { "layer_height",               1 },
+            { "wall_loops",                 2 }
+        });
+        ModelConfig &range_config = model.objects.front()->layer_config_ranges[{ 10., 14. }];
+        range_config.set("layer_height", 1.);
+        range_config.set("wall_loops", 3);
+        print.apply(model, print.full_print_config());
+        print.process();
+
+        // Perimeters of the region printing the layer.
+        auto perimeters_of = [](const Layer &layer) -> const ExtrusionEntityCollection* {
+            for (const LayerRegion *layerm : layer.regions())
+                if (! layerm->perimeters.empty())
+                    return &layerm->perimeters;
+            return nullptr;
+        };
+        std::vector<const ExtrusionEntity*> first_perimeters;
+        std::vector<size_t>                 perimeters_count;
+        for (const Layer *layer : print.objects().front()->layers()) {
+            const ExtrusionEntityCollection *perimeters = perimeters_of(*layer);
+            REQUIRE(perimeters != nullptr);
+            first_perimeters.emplace_back(perimeters->entities.front());
+            perimeters_count.emplace_back(perimeters->items_count());
+        }
+        WHEN("the wall loops of the modifier are changed") {
+            model.objects.front()->layer_config_ranges[{ 10., 14. }].set("wall_loops", 4);
+            print.apply(model, print.full_print_config());
+            print.process();
+            const PrintObject &object = *print.objects().front();
+            THEN("the layers are not resliced and only the layers of the modifier get new perimeters") {
+                REQUIRE(object.layers().size() == first_perimeters.size());
+                for (size_t i = 0; i < object.layers().size(); ++ i) {
+                    const Layer                     &layer      = *object.layers()[i];
+                    const ExtrusionEntityCollection *perimeters = perimeters_of(layer);
+                    REQUIRE(perimeters != nullptr);
+                    if (layer.print_z > 10. + EPSILON && layer.print_z < 14. - EPSILON)
+                        REQUIRE(perimeters->items_count() > perimeters_count[i]);
+                    else if (layer.print_z < 10. - EPSILON || layer.print_z > 14. + EPSILON)
+                        REQUIRE(perimeters->entities.front() == first_perimeters[i]);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("PrintObject: identical islands share their perimeters", "[PrintObject]") {
+    GIVEN("20mm cube sliced at 1mm") {
+        Slic3r::Print print;
+        Slic3r::Test::init_and_process_print({TestMesh::cube_20x20x20}, print, {
+            { "initial_layer_print_height", 1 },
+            { "layer_height",               1 },
+            { "wall_loops",                 3 }
+        });
+        ConstLayerPtrsAdaptor layers = print.objects().front()->layers();
+        auto perimeter_points = [](const Layer &layer) {
+            Points out;
+            for (const LayerRegion *layerm : layer.regions()) {
+                ExtrusionEntityCollection perimeters = layerm->perimeters.flatten();
+                for (const ExtrusionEntity *entity : perimeters.entities)
+                    append(out, entity->as_polyline().points);
+            }
+            return out;
+        };
+        THEN("the layers between the bottom and the top get the same perimeters") {
+            REQUIRE(layers.size() == 20);
+            const Points middle = perimeter_points(*layers[layers.size() / 2]);
+            REQUIRE(! middle.empty());
+            for (size_t i = 2; i + 2 < layers.size(); ++ i)
+                REQUIRE(perimeter_points(*layers[i]) == middle);
+        }
+    }
+}
+
+SCENARIO("PrintObject: multi material segmentation of an unchanged painting is cached", "[PrintObject]") {
+    GIVEN("20mm cube with the facets facing +X painted with the second filament") {
+        Slic3r::Model model;
+        Slic3r::Print print;
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, {
+            { "initial_layer_print_height", 1 },
+            { "layer_height",               1 },
+            { "filament_colour",            "#FF0000;#00FF00" },
+            { "filament_diameter",          "1.75,1.75" }
+        });
+        ModelVolume     *volume = model.objects.front()->volumes.front();
+        TriangleSelector selector(volume->mesh());
+        for (int facet_idx = 0; facet_idx < int(volume->mesh().its.indices.size()); ++ facet_idx)
+            if (its_face_normal(volume->mesh().its, facet_idx).x() > 0.5f)
+                selector.set_facet(facet_idx, EnforcerBlockerType::Extruder2);
+        volume->mmu_segmentation_facets.set(selector);
+        REQUIRE(model.objects.front()->is_mm_painted());
+
+        MultiMaterialSegmentationCache::instance().clear();
+        auto layer_slices = [](const Print &print) {
+            std::vector<std::vector<ExPolygons>> out;
+            for (const Layer *layer : print.objects().front()->layers()) {
+                out.emplace_back();
+                for (const LayerRegion *layerm : layer->regions())
+                    out.back().emplace_back(to_expolygons(layerm->slices.surfaces));
+            }
+            return out;
+        };
+        print.apply(model, print.full_print_config());
+        print.process();
+        const std::vector<std::vector<ExPolygons>> slices = layer_slices(print);
+        const MultiMaterialSegmentationCache::Stats stats = MultiMaterialSegmentationCache::instance().stats();
+        REQUIRE(stats.entries == print.objects().front()->layers().size());
+        // Two regions, one for each filament.
+        REQUIRE(print.objects().front()->layers().front()->regions().size() == 2);
+
+        WHEN("the same painting is sliced again by another Print") {
+            Slic3r::Print print2;
+            print2.apply(model, print.full_print_config());
+            print2.process();
+            THEN("all layers are taken from the cache and the regions are the same") {
+                REQUIRE(MultiMaterialSegmentationCache::instance().stats().hits == stats.hits + print2.objects().front()->layers().size());
+                REQUIRE(layer_slices(print2) == slices);
+            }
+        }
+        WHEN("the painting changes") {
+            selector.reset();
+            for (int facet_idx = 0; facet_idx < int(volume->mesh().its.indices.size()); ++ facet_idx)
+                if (its_face_normal(volume->mesh().its, facet_idx).y() > 0.5f)
+                    selector.set_facet(facet_idx, EnforcerBlockerType::Extruder2);
+            volume->mmu_segmentation_facets.set(selector);
+            Slic3r::Print print2;
+            print2.apply(model, print.full_print_config());
+            print2.process();
+            THEN("the layers are segmented again") {
+                REQUIRE(MultiMaterialSegmentationCache::instance().stats().hits == stats.hits);
+                REQUIRE(layer_slices(print2) != slices);
+            }
+        }
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "libslic3r/GCodeReader.hpp"
 #include "libslic3r/Layer.hpp"
+#include "libslic3r/Support/TreeModelVolumes.hpp"
 
 #include "test_data.hpp" // get access to init_print, etc
 
@@ -18,6 +19,37 @@ TEST_CASE("SupportMaterial: Three raft layers created", "[SupportMaterial]")
     REQUIRE(print.objects().front()->support_layers().size() == 3);
 }
 
+TEST_CASE("SupportMaterial: organic tree support volumes are reused", "[SupportMaterial]")
+{
+    DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+    config.set_deserialize_strict({
+        { "enable_support", true },
+        { "support_type",   "tree(auto)" },
+        { "support_style",  "tree_organic" }
+    });
+    auto support_islands = [](const Print &print) {
+        std::vector<ExPolygons> out;
+        for (const SupportLayer *layer : print.objects().front()->support_layers())
+            out.emplace_back(layer->support_islands);
+        return out;
+    };
+
+    TreeSupport3D::TreeModelVolumesCache &cache = TreeSupport3D::TreeModelVolumesCache::instance();
+    cache.clear();
+    Slic3r::Print print;
+    Slic3r::Test::init_and_process_print({ TestMesh::overhang }, print, config);
+    const std::vector<ExPolygons> islands = support_islands(print);
+    REQUIRE(! islands.empty());
+    REQUIRE(cache.stats().entries > 0);
+
+    // Same slices and support settings: collisions and avoidances are taken from the cache.
+    const TreeSupport3D::TreeModelVolumesCache::Stats stats = cache.stats();
+    Slic3r::Print print2;
+    Slic3r::Test::init_and_process_print({ TestMesh::overhang }, print2, config);
+    REQUIRE(cache.stats().hits > stats.hits);
+    REQUIRE(support_islands(print2) == islands);
+}
+
 SCENARIO("SupportMaterial: support_layers_z and contact_distance", "[SupportMaterial]")
 {
     // Box h = 20mm, hole bottom at 5mm, hole height 10mm (top edge at 15mm).
@@ -2,10 +2,12 @@
 
 #include "libslic3r/TriangleMesh.hpp"
 #include "libslic3r/TriangleMeshSlicer.hpp"
+#include "libslic3r/TriangleMeshSlicerCache.hpp"
 #include "libslic3r/Point.hpp"
 #include "libslic3r/Config.hpp"
 #include "libslic3r/Model.hpp"
 #include "libslic3r/libslic3r.h"
+#include "libslic3r/Format/OBJ.hpp"
 
 #include <algorithm>
 #include <future>
@@ -351,3 +353,92 @@ TEST_CASE("Profile test for issue #4486 - files take forever to slice") {
 
 }
 #endif //BUILD_PROFILE
+
+SCENARIO("TriangleMeshSlicerCache returns the slices of the same mesh and parameters", "[TriangleMeshSlicerCache]") {
+    TriangleMeshSlicerCache &cache = TriangleMeshSlicerCache::instance();
+    cache.clear();
+    GIVEN("A sliced 20mm cube") {
+        auto                      cube = std::make_shared<const TriangleMesh>(make_cube());
+        std::vector<float>        zs { 0.5f, 5.f, 10.f, 19.5f };
+        MeshSlicingParamsEx       params;
+        std::vector<ExPolygons>   slices = slice_mesh_ex(cube->its, zs, params);
+        cache.put(cube, zs, params, slices);
+        THEN("the same mesh with the same parameters hits the cache") {
+            std::vector<ExPolygons> cached;
+            auto                    copy = std::make_shared<const TriangleMesh>(*cube);
+            REQUIRE(cache.get(copy, zs, params, cached));
+            REQUIRE(cached.size() == slices.size());
+            for (size_t i = 0; i < slices.size(); ++ i)
+                REQUIRE(area(cached[i]) == Approx(area(slices[i])));
+        }
+        THEN("other slicing planes, a transformation or a modified mesh miss the cache") {
+            std::vector<ExPolygons> cached;
+            REQUIRE(! cache.get(cube, { 0.5f, 5.f }, params, cached));
+            MeshSlicingParamsEx params_translated = params;
+            params_translated.trafo.translate(Vec3d(1., 0., 0.));
+            REQUIRE(! cache.get(cube, zs, params_translated, cached));
+            TriangleMesh scaled_cube = *cube;
+            scaled_cube.scale(0.5f);
+            REQUIRE(! cache.get(std::make_shared<const TriangleMesh>(scaled_cube), zs, params, cached));
+        }
+        THEN("a cache without capacity is empty") {
+            const size_t capacity = cache.capacity();
+            cache.set_capacity(0);
+            std::vector<ExPolygons> cached;
+            REQUIRE(! cache.get(cube, zs, params, cached));
+            REQUIRE(cache.stats().entries == 0);
+            cache.set_capacity(capacity);
+        }
+        THEN("clearing all the caches of the process drops the slices") {
+            LRUCacheBase::clear_all();
+            std::vector<ExPolygons> cached;
+            REQUIRE(! cache.get(cube, zs, params, cached));
+            REQUIRE(cache.stats().entries == 0);
+        }
+    }
+    cache.clear();
+}
+
+SCENARIO("ParallelPlanesSlicer slices like slice_mesh()", "[ParallelPlanesSlicer]") {
+    GIVEN("A sphere sliced along a tilted direction") {
+        TriangleMesh      sphere = make_sphere(10., 2. * PI / 100.);
+        MeshSlicingParams params;
+        params.trafo.rotate(Eigen::Quaterniond::FromTwoVectors(Vec3d(1., 1., 1.).normalized(), Vec3d::UnitZ()));
+        ParallelPlanesSlicer slicer(sphere.its, params);
+        THEN("each plane gives the same contours as slicing the whole mesh") {
+            for (float z : { -12.f, -9.5f, -3.f, 0.f, 0.25f, 7.f, 9.9f, 12.f }) {
+                Polygons expected = slice_mesh(sphere.its, z, params);
+                Polygons sliced   = slicer.slice(z);
+                REQUIRE(sliced.size() == expected.size());
+                REQUIRE(area(sliced) == Approx(area(expected)));
+            }
+        }
+    }
+}
+
+// Not run by default, measures slice_mesh_ex() on the meshes of tests/data and on a high poly sphere: ./fff_print_tests "[SliceMeshBenchmark]"
+TEST_CASE("slice_mesh_ex benchmark", "[.][SliceMeshBenchmark]") {
+    auto benchmark = [](const std::string &name, const TriangleMesh &mesh) {
+        const BoundingBoxf3 bbox = mesh.bounding_box();
+        std::vector<float>  zs;
+        for (double z = bbox.min.z() + 0.1; z < bbox.max.z(); z += 0.2)
+            zs.emplace_back(float(z));
+        auto start = std::chrono::steady_clock::now();
+        std::vector<ExPolygons> slices = slice_mesh_ex(mesh.its, zs, MeshSlicingParamsEx{});
+        double time_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1000.;
+        REQUIRE(slices.size() == zs.size());
+        WARN(name << ": " << mesh.its.indices.size() << " triangles, " << zs.size() << " layers, " << time_ms << " ms");
+    };
+    for (const char *name : { "20mm_cube.obj", "extruder_idler.obj", "frog_legs.obj", "ipadstand.obj", "simplification.obj" }) {
+        TriangleMesh mesh;
+        ObjInfo      obj_info;
+        std::string  message;
+        REQUIRE(load_obj((std::string(TEST_DATA_DIR) + "/" + name).c_str(), &mesh, obj_info, message));
+        benchmark(name, mesh);
+    }
+    TriangleMesh prusa;
+    REQUIRE(prusa.ReadSTLFile((std::string(TEST_DATA_DIR) + "/test_3mf/Prusa.stl").c_str()));
+    benchmark("Prusa.stl", prusa);
+    // About 4M triangles, like a scanned model.
+    benchmark("sphere", make_sphere(50., 2. * PI / 2000.));
+}
@@ -58,3 +58,26 @@ TEST_CASE("Building a tree over a box, ray caster and closest query", "[AABBIndi
     REQUIRE(closest_point.y() == Approx(0.5));
     REQUIRE(closest_point.z() == Approx(1.));
 }
+
+TEST_CASE("First hit matches the closest of all hits", "[AABBIndirect]")
+{
+    TriangleMesh tmesh = make_sphere(1., 2. * PI / 90.);
+    tmesh.merge(make_cube(1., 1., 1.));
+
+    auto tree = AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(tmesh.its.vertices, tmesh.its.indices);
+    REQUIRE(! tree.empty());
+
+    for (int i = 0; i < 100; ++ i) {
+        double angle  = 2. * PI * i / 100.;
+        Vec3d  origin(5. * cos(angle), 5. * sin(angle), 0.2 * (i % 5));
+        Vec3d  dir    = (Vec3d(0.3, 0.2, 0.1 * (i % 7)) - origin).normalized();
+
+        igl::Hit hit;
+        bool intersected = AABBTreeIndirect::intersect_ray_first_hit(tmesh.its.vertices, tmesh.its.indices, tree, origin, dir, hit);
+        std::vector<igl::Hit> hits;
+        bool intersected2 = AABBTreeIndirect::intersect_ray_all_hits(tmesh.its.vertices, tmesh.its.indices, tree, origin, dir, hits);
+        REQUIRE(intersected == intersected2);
+        if (intersected)
+            REQUIRE(hit.t == Approx(hits.front().t));
+    }
+}
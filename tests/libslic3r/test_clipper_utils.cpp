@@ -299,3 +299,83 @@ TEST_CASE("Traversing Clipper PolyTree", "[ClipperUtils]") {
         REQUIRE(count_polys(output) == reference.size());
     }
 }
+
+TEST_CASE("Clipper scratch scope produces the same results", "[ClipperUtils]") {
+    // A row of overlapping squares with holes, shifted from layer to layer.
+    auto layer = [](coord_t shift) {
+        ExPolygons expolygons;
+        for (coord_t i = 0; i < 20; ++ i) {
+            ExPolygon expoly;
+            expoly.contour = Polygon::new_scale({ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } });
+            expoly.holes.emplace_back(Polygon::new_scale({ { 3, 3 }, { 3, 7 }, { 7, 7 }, { 7, 3 } }));
+            expoly.translate(scaled<coord_t>(7.) * i + shift, shift);
+            expolygons.emplace_back(std::move(expoly));
+        }
+        return expolygons;
+    };
+    auto run = [&layer]() {
+        std::vector<ExPolygons> out;
+        for (coord_t shift = 0; shift < scaled<coord_t>(2.); shift += scaled<coord_t>(0.5)) {
+            ExPolygons below = layer(shift);
+            ExPolygons above = layer(shift + scaled<coord_t>(0.3));
+            out.emplace_back(diff_ex(above, below));
+            out.emplace_back(intersection_ex(above, below));
+            out.emplace_back(union_ex(above));
+            // shrink_paths() reverses the solution of the Clipper, the following operations shall not be affected.
+            out.emplace_back(offset_ex(above, - scaled<float>(0.5)));
+            out.emplace_back(offset2_ex(below, - scaled<float>(1.), scaled<float>(0.5)));
+            out.emplace_back(diff_ex(below, above, ApplySafetyOffset::Yes));
+        }
+        return out;
+    };
+    std::vector<ExPolygons> reference = run();
+    std::vector<ExPolygons> scratch;
+    {
+        ClipperUtils::ScratchScope scope;
+        scratch = run();
+        {
+            ClipperUtils::ScratchScope nested;
+            REQUIRE(run() == scratch);
+        }
+        REQUIRE(run() == scratch);
+    }
+    REQUIRE(scratch == reference);
+    REQUIRE(run() == reference);
+}
+
+TEST_CASE("Clipper2 backend produces the same regions", "[ClipperUtils]") {
+    ExPolygons subject, clip;
+    for (coord_t i = 0; i < 10; ++ i) {
+        ExPolygon expoly;
+        expoly.contour = Polygon::new_scale({ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } });
+        expoly.holes.emplace_back(Polygon::new_scale({ { 3, 3 }, { 3, 7 }, { 7, 7 }, { 7, 3 } }));
+        expoly.translate(scaled<coord_t>(12.) * i, 0);
+        subject.emplace_back(expoly);
+        expoly.translate(scaled<coord_t>(5.), scaled<coord_t>(4.));
+        clip.emplace_back(std::move(expoly));
+    }
+    auto run = [&subject, &clip]() {
+        return std::vector<ExPolygons> {
+            diff_ex(subject, clip),
+            intersection_ex(subject, clip),
+            union_ex(subject, clip),
+            xor_ex(subject, clip),
+            diff_ex(subject, clip, ApplySafetyOffset::Yes),
+            union_ex(diff(to_polygons(subject), to_polygons(clip))),
+            offset_ex(subject, - scaled<float>(0.5)),
+            offset_ex(subject, scaled<float>(0.5)),
+            union_ex(offset(clip, scaled<float>(0.5), jtRound, scaled<double>(0.01)))
+        };
+    };
+    std::vector<ExPolygons> legacy = run();
+    ClipperUtils::set_clipper2_operations(ClipperUtils::c2All);
+    std::vector<ExPolygons> clipper2 = run();
+    ClipperUtils::set_clipper2_operations(0);
+    REQUIRE(clipper2.size() == legacy.size());
+    for (size_t i = 0; i < legacy.size(); ++ i) {
+        REQUIRE(! legacy[i].empty());
+        // The regions touching at a vertex may be split differently and the round joins are approximated differently.
+        REQUIRE(area(clipper2[i]) == Approx(area(legacy[i])).epsilon(1e-3));
+        REQUIRE(area(xor_ex(clipper2[i], legacy[i])) < 1e-3 * area(legacy[i]));
+    }
+}
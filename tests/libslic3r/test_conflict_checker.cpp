@@ -0,0 +1,55 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/GCode/ConflictChecker.hpp"
+
+#include <chrono>
+
+using namespace Slic3r;
+
+// Zig-zag of an object inside a square of the given size.
+static void add_object_lines(LineWithIDs &lines, const void *id, const Point &origin, coord_t size, int num_lines)
+{
+    for (int i = 0; i < num_lines; ++ i) {
+        coord_t y = origin.y() + size * i / num_lines;
+        lines.emplace_back(Line(Point(origin.x(), y), Point(origin.x() + size, y + size / num_lines)), id, erPerimeter);
+    }
+}
+
+TEST_CASE("Conflict checker finds intersections of lines of different objects", "[ConflictChecker]") {
+    int obj1, obj2;
+    LineWithIDs lines;
+    lines.emplace_back(Line(Point::new_scale(0, 0), Point::new_scale(10, 10)), &obj1, erPerimeter);
+    // Crossing lines of the same object are fine.
+    lines.emplace_back(Line(Point::new_scale(0, 10), Point::new_scale(10, 0)), &obj1, erPerimeter);
+    REQUIRE(! ConflictChecker::find_inter_of_lines(lines).has_value());
+
+    SECTION("other object crossing") {
+        lines.emplace_back(Line(Point::new_scale(2, 8), Point::new_scale(8, 2)), &obj2, erPerimeter);
+        ConflictComputeOpt conflict = ConflictChecker::find_inter_of_lines(lines);
+        REQUIRE(conflict.has_value());
+        REQUIRE(((conflict->_obj1 == &obj1 && conflict->_obj2 == &obj2) || (conflict->_obj1 == &obj2 && conflict->_obj2 == &obj1)));
+    }
+    SECTION("other object inside the bounding box without crossing") {
+        lines.emplace_back(Line(Point::new_scale(1, 0), Point::new_scale(9, 0)), &obj2, erPerimeter);
+        REQUIRE(! ConflictChecker::find_inter_of_lines(lines).has_value());
+    }
+    SECTION("other object far away") {
+        add_object_lines(lines, &obj2, Point::new_scale(20, 0), scaled<coord_t>(10.), 100);
+        REQUIRE(! ConflictChecker::find_inter_of_lines(lines).has_value());
+    }
+}
+
+// Not run by default, measures the conflict check of a layer of a full plate: ./libslic3r_tests "[ConflictCheckerBenchmark]"
+TEST_CASE("Conflict checker benchmark", "[.][ConflictCheckerBenchmark]") {
+    std::vector<int> objects(64);
+    LineWithIDs      lines;
+    for (size_t i = 0; i < objects.size(); ++ i)
+        add_object_lines(lines, &objects[i], Point::new_scale(30 * (i % 8), 30 * (i / 8)), scaled<coord_t>(25.), 2000);
+    auto start = std::chrono::steady_clock::now();
+    REQUIRE(! ConflictChecker::find_inter_of_lines(lines).has_value());
+    // Let an extrusion of an object reach into its neighbor.
+    lines.emplace_back(Line(Point::new_scale(200, 212), Point::new_scale(240, 230)), &objects[62], erPerimeter);
+    REQUIRE(ConflictChecker::find_inter_of_lines(lines).has_value());
+    double time_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1000.;
+    WARN(lines.size() << " lines: " << time_ms << " ms");
+}
@@ -0,0 +1,43 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/GCode/GCodeFileWriter.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/cstdio.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <iterator>
+
+using namespace Slic3r;
+
+static std::string read_file(const std::string &path)
+{
+    boost::nowide::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+TEST_CASE("G-code file writer keeps the order of the chunks", "[GCodeFileWriter]") {
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("gcode_writer_%%%%%%.gcode")).string();
+    bool async = GENERATE(false, true);
+    std::string expected;
+    {
+        // Tiny chunks to exercise the recycling of the chunks by the background thread.
+        GCodeFileWriter writer(boost::nowide::fopen(path.c_str(), "wb"), async, 64, 2);
+        REQUIRE(writer.is_open());
+        REQUIRE(writer.is_async() == async);
+        for (int i = 0; i < 5000; ++ i) {
+            std::string line = "G1 X" + std::to_string(i) + " Y" + std::to_string(5000 - i) + "\n";
+            writer.write(line.data(), line.size());
+            expected += line;
+        }
+        writer.flush();
+        REQUIRE(! writer.is_error());
+        REQUIRE(writer.bytes_written() == expected.size());
+        writer.write("M84\n", 4);
+        expected += "M84\n";
+        writer.close();
+        REQUIRE(! writer.is_open());
+    }
+    REQUIRE(read_file(path) == expected);
+    boost::filesystem::remove(path);
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/GCode/PipelineStats.hpp"
+
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+
+using namespace Slic3r;
+
+TEST_CASE("G-code pipeline token count", "[GCodePipeline]") {
+    SECTION("user override wins") {
+        REQUIRE(gcode_pipeline_tokens(7, 1, 1024 * 1024 * 1024, 100) == 7);
+    }
+    SECTION("never more tokens than layers") {
+        REQUIRE(gcode_pipeline_tokens(0, 0, 0, 1) == 1);
+        REQUIRE(gcode_pipeline_tokens(12, 0, 0, 3) == 3);
+    }
+    SECTION("memory budget limits the tokens") {
+        // 4 MB budget, 1 MB layers
+        REQUIRE(gcode_pipeline_tokens(0, 4, 1024 * 1024, 1000) <= 4);
+        // Always keep two layers in flight.
+        REQUIRE(gcode_pipeline_tokens(0, 1, 64 * 1024 * 1024, 1000) == 2);
+    }
+}
+
+TEST_CASE("G-code pipeline tracker", "[GCodePipeline]") {
+    const size_t         num_layers = 200;
+    GCodePipelineTracker tracker(4);
+    size_t               idx = 0;
+    size_t               exported = 0;
+    const auto generator = tbb::make_filter<void, std::string>(slic3r_tbb_filtermode::serial_in_order, tracker.source("generate",
+        [&idx, num_layers](tbb::flow_control &fc) -> std::string {
+            if (idx == num_layers) {
+                fc.stop();
+                return {};
+            }
+            return std::string(++ idx, 'G');
+        }, [&idx, num_layers]() { return idx == num_layers; }));
+    const auto process = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order, tracker.stage("process",
+        [](std::string in) -> std::string { return in + "\n"; }));
+    const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order, tracker.sink("output",
+        [&exported](std::string s) { exported += s.size(); }, [](const std::string &s) { return s.size(); }));
+    tbb::parallel_pipeline(tracker.max_tokens(), generator & process & output);
+
+    GCodePipelineStats stats = tracker.stats();
+    REQUIRE(stats.layers == num_layers);
+    REQUIRE(stats.stages.size() == 3);
+    for (const GCodePipelineStats::Stage &stage : stats.stages) {
+        REQUIRE(stage.items == num_layers);
+        REQUIRE(stage.wait_ms >= 0.);
+    }
+    // Layer i has i characters, one more added by the process stage.
+    REQUIRE(stats.stages[0].bytes == num_layers * (num_layers + 1) / 2);
+    REQUIRE(stats.stages[1].bytes == exported);
+    REQUIRE(stats.stages[2].bytes == exported);
+    REQUIRE(stats.max_in_flight <= 4);
+    REQUIRE(stats.total_layer_bytes == exported);
+    REQUIRE(stats.max_layer_bytes == num_layers + 1);
+}
+
+TEST_CASE("G-code pipeline tracker shared by two pipelines", "[GCodePipeline]") {
+    // The wrappers are driven by hand to get a deterministic interleaving: the first pass produces all its layers
+    // before consuming them, so they are all in flight when its source finishes.
+    struct FlowControl {};
+    const size_t         num_layers = 3;
+    GCodePipelineTracker tracker(4);
+    const std::pair<const char*, const char*> passes[] = { { "generate", "output" }, { "generate2", "output2" } };
+    for (const auto &[source_name, sink_name] : passes) {
+        size_t idx    = 0;
+        auto   source = tracker.source(source_name, [&idx](FlowControl &) { return idx ++; }, [&idx, num_layers]() { return idx == num_layers; });
+        auto   sink   = tracker.sink(sink_name, [](size_t) {}, [](size_t) { return size_t(1); });
+        FlowControl fc;
+        std::vector<size_t> layers;
+        for (size_t i = 0; i < num_layers; ++ i)
+            layers.emplace_back(source(fc));
+        for (size_t layer : layers)
+            sink(layer);
+    }
+
+    GCodePipelineStats stats = tracker.stats();
+    REQUIRE(stats.layers == 2 * num_layers);
+    REQUIRE(stats.stages.size() == 4);
+    for (const GCodePipelineStats::Stage &stage : stats.stages)
+        REQUIRE(stage.items == num_layers);
+    // The source is never behind itself, the sinks saw all the layers of their pass produced ahead.
+    REQUIRE(stats.stages[0].max_backlog == 0);
+    REQUIRE(stats.stages[1].max_backlog == num_layers - 1);
+    // The layers of the first pass do not count into the backlog of the second one.
+    REQUIRE(stats.stages[2].max_backlog == 0);
+    REQUIRE(stats.stages[3].max_backlog == num_layers - 1);
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/GCodeReader.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/cstdlib.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <chrono>
+#include <cstring>
+
+using namespace Slic3r;
+
+static std::string write_temp_gcode(const std::string &gcode)
+{
+    const std::string path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("gcode_reader_%%%%%%.gcode")).string();
+    boost::nowide::ofstream out(path, std::ios::binary);
+    out << gcode;
+    return path;
+}
+
+// Bambu like G-code: short moves, long comments and feature tags.
+static std::string synthetic_gcode(size_t layers)
+{
+    std::string gcode = "; HEADER_BLOCK_START\n; BambuStudio generated G-code for the reader tests, long header comment line\n; HEADER_BLOCK_END\r\n";
+    for (size_t layer = 0; layer < layers; ++ layer) {
+        gcode += "; CHANGE_LAYER\n; Z_HEIGHT: " + std::to_string(0.2 * (layer + 1)) + "\nG1 Z" + std::to_string(0.2 * (layer + 1)) + " F1200\n";
+        gcode += "; FEATURE: Outer wall\n; LINE_WIDTH: 0.42\n";
+        for (int i = 0; i < 200; ++ i)
+            gcode += "G1 X" + std::to_string(100 + i % 20) + ".123 Y" + std::to_string(80 + i / 20) + ".456 E.0217 ; move " + std::to_string(i) + "\n";
+        gcode += "M73 P" + std::to_string(layer) + " R12\n";
+    }
+    return gcode;
+}
+
+TEST_CASE("G-code reader line end search", "[GCodeReader]") {
+    std::string line(100, 'a');
+    for (size_t pos = 0; pos < line.size(); ++ pos) {
+        for (char c : { '\r', '\n', '\0' }) {
+            std::string s = line;
+            s[pos] = c;
+            REQUIRE(GCodeReader::find_end_of_line(s.data(), s.data() + s.size()) == s.data() + pos);
+            REQUIRE(GCodeReader::find_line_break(s.data(), s.data() + s.size()) == s.data() + (c == '\0' ? s.size() : pos));
+        }
+    }
+    REQUIRE(GCodeReader::find_end_of_line(line.data(), line.data() + line.size()) == line.data() + line.size());
+}
+
+TEST_CASE("G-code reader parses axes and comments", "[GCodeReader]") {
+    GCodeReader reader;
+    std::vector<std::string> raw;
+    reader.parse_buffer("G1 X10.5 Y-2 E.5 ; extrude with a comment long enough to be scanned in chunks\r\nG92 E0\nM104 S200 ;X99\n",
+        [&raw](GCodeReader &reader, const GCodeReader::GCodeLine &line) {
+            raw.emplace_back(line.raw());
+            if (line.cmd_is("G1")) {
+                REQUIRE(line.has_x());
+                REQUIRE(line.x() == Approx(10.5));
+                REQUIRE(line.y() == Approx(-2.));
+                REQUIRE(line.e() == Approx(0.5));
+                REQUIRE(! line.has_z());
+                float value = 0.f;
+                REQUIRE(line.has_value('Y', value));
+                REQUIRE(value == Approx(-2.));
+            } else if (line.cmd_is("M104")) {
+                REQUIRE(! line.has_x());
+                REQUIRE(line.comment() == "X99");
+            }
+        });
+    REQUIRE(raw.size() == 3);
+    REQUIRE(raw[0] == "G1 X10.5 Y-2 E.5 ; extrude with a comment long enough to be scanned in chunks");
+    REQUIRE(raw[1] == "G92 E0");
+    REQUIRE(reader.x() == Approx(10.5));
+}
+
+TEST_CASE("G-code reader collects the line ends of a file", "[GCodeReader]") {
+    // The lines span over the 640kB read buffer.
+    const std::string gcode = synthetic_gcode(200);
+    const std::string path  = write_temp_gcode(gcode);
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < gcode.size(); ++ i)
+        if (gcode[i] == '\n')
+            expected.emplace_back(i + 1);
+
+    GCodeReader reader;
+    size_t      lines = 0;
+    std::vector<size_t> lines_ends;
+    REQUIRE(reader.parse_file(path, [&lines](GCodeReader&, const GCodeReader::GCodeLine&) { ++ lines; }, lines_ends));
+    REQUIRE(lines == expected.size());
+    REQUIRE(lines_ends == expected);
+    boost::filesystem::remove(path);
+}
+
+TEST_CASE("G-code reader parses a file in parallel in the order of the lines", "[GCodeReader]") {
+    // Multiple chunks, line numbers, CRLF and a last line without a new line.
+    const std::string gcode = synthetic_gcode(300) + "N10 G1 X1 Y2\r\n\nG1 E-2 F3000";
+    const std::string path  = write_temp_gcode(gcode);
+
+    auto parse = [&path](bool parallel, std::vector<size_t> &lines_ends, std::vector<float> &position) {
+        GCodeReader reader;
+        std::vector<std::string> lines;
+        auto callback = [&lines](GCodeReader&, const GCodeReader::GCodeLine &line) { lines.emplace_back(line.raw() + " " + std::to_string(line.x()) + " " + std::to_string(line.e())); };
+        REQUIRE((parallel ? reader.parse_file_parallel(path, callback, lines_ends) : reader.parse_file(path, callback, lines_ends)));
+        position = { reader.x(), reader.y(), reader.z(), reader.e(), reader.f() };
+        return lines;
+    };
+    std::vector<size_t> lines_ends, lines_ends_parallel;
+    std::vector<float>  position, position_parallel;
+    std::vector<std::string> lines          = parse(false, lines_ends, position);
+    std::vector<std::string> lines_parallel = parse(true, lines_ends_parallel, position_parallel);
+    REQUIRE(lines_parallel == lines);
+    REQUIRE(lines_ends_parallel == lines_ends);
+    REQUIRE(position_parallel == position);
+    REQUIRE(lines.back() == "G1 E-2 F3000 0.000000 -2.000000");
+
+    SECTION("the callback stops the parsing") {
+        GCodeReader reader;
+        size_t cnt = 0;
+        std::vector<size_t> ends;
+        REQUIRE(reader.parse_file_parallel(path, [&cnt](GCodeReader &reader, const GCodeReader::GCodeLine&) { if (++ cnt == 1000) reader.quit_parsing(); }, ends));
+        REQUIRE(cnt == 1000);
+    }
+    boost::filesystem::remove(path);
+}
+
+// Not run by default, measures the reader throughput: ./libslic3r_tests "[GCodeReaderBenchmark]"
+// Set SLIC3R_GCODE_CORPUS to a directory of exported G-code files to measure real prints.
+TEST_CASE("G-code reader benchmark", "[.][GCodeReaderBenchmark]") {
+    std::vector<std::string> files;
+    bool temporary = false;
+    if (const char *corpus = boost::nowide::getenv("SLIC3R_GCODE_CORPUS"); corpus != nullptr) {
+        for (const boost::filesystem::directory_entry &entry : boost::filesystem::directory_iterator(corpus))
+            if (entry.path().extension() == ".gcode")
+                files.emplace_back(entry.path().string());
+    }
+    if (files.empty()) {
+        files.emplace_back(write_temp_gcode(synthetic_gcode(5000)));
+        temporary = true;
+    }
+
+    for (const std::string &file : files) {
+        const auto bytes = double(boost::filesystem::file_size(file));
+        auto mb_per_s = [bytes](std::chrono::steady_clock::time_point start) {
+            return bytes / (1024. * 1024.) / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        };
+        GCodeReader reader;
+        size_t lines = 0;
+        auto start = std::chrono::steady_clock::now();
+        REQUIRE(reader.parse_file_raw(file, [&lines](GCodeReader&, const char*, const char*) { ++ lines; }));
+        double raw_speed = mb_per_s(start);
+        start = std::chrono::steady_clock::now();
+        REQUIRE(reader.parse_file(file, [](GCodeReader&, const GCodeReader::GCodeLine&) {}));
+        double parse_speed = mb_per_s(start);
+        std::vector<size_t> lines_ends;
+        start = std::chrono::steady_clock::now();
+        REQUIRE(reader.parse_file_parallel(file, [](GCodeReader&, const GCodeReader::GCodeLine&) {}, lines_ends));
+        double parallel_speed = mb_per_s(start);
+        WARN(boost::filesystem::path(file).filename().string() << " (" << GCodeReader::simd_name() << "): " << lines << " lines, raw " << raw_speed << " MB/s, parsed " << parse_speed
+            << " MB/s, parsed in parallel " << parallel_speed << " MB/s");
+    }
+    if (temporary)
+        boost::filesystem::remove(files.front());
+}
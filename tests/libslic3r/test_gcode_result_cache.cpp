@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/GCode/GCodeProcessor.hpp"
+#include "libslic3r/GCode/GCodeResultCache.hpp"
+
+#include <boost/filesystem.hpp>
+
+using namespace Slic3r;
+
+static void make_result(GCodeProcessorResult &result)
+{
+    result.reset();
+    result.filaments_count = 2;
+    result.extruder_colors = { "#FF0000", "#00FF00" };
+    result.lines_ends      = { 10, 25, 40, 52 };
+    result.arc_interpolation_points = { Vec3f(1.f, 0.f, 0.2f), Vec3f(0.7f, 0.7f, 0.2f), Vec3f(0.f, 1.f, 0.2f) };
+    for (unsigned int i = 0; i < 4; ++ i) {
+        GCodeProcessorResult::MoveVertex move;
+        move.type           = i == 0 ? EMoveType::Travel : EMoveType::Extrude;
+        move.extrusion_role = i == 0 ? erNone : erExternalPerimeter;
+        move.extruder_id    = (unsigned char)(i % 2);
+        move.gcode_id       = i + 1;
+        move.position       = Vec3f(float(i), 0.f, 0.2f);
+        result.moves.emplace_back(move);
+    }
+    result.moves.back().move_path_type              = EMovePathType::Arc_move_ccw;
+    result.moves.back().interpolation_points_offset = 0;
+    result.moves.back().interpolation_points_count  = 3;
+}
+
+SCENARIO("GCodeResultCache round trip", "[GCodeResultCache]") {
+    const boost::filesystem::path path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.gcode.result");
+    const std::string             md5  = "0123456789ABCDEF0123456789ABCDEF";
+    const Vec2d                   offset(10., 20.);
+    GCodeProcessorResult          saved;
+    make_result(saved);
+
+    GIVEN("A saved snapshot") {
+        REQUIRE(GCodeResultCache::save(saved, md5, offset, path.string()));
+        THEN("it loads back the same moves and fields") {
+            GCodeProcessorResult loaded;
+            REQUIRE(GCodeResultCache::load(loaded, md5, offset, path.string()));
+            REQUIRE(loaded.moves.size() == saved.moves.size());
+            for (size_t i = 0; i < saved.moves.size(); ++ i) {
+                REQUIRE(loaded.moves[i].type == saved.moves[i].type);
+                REQUIRE(loaded.moves[i].extruder_id == saved.moves[i].extruder_id);
+                REQUIRE(loaded.moves[i].position == saved.moves[i].position);
+            }
+            REQUIRE(loaded.arc_interpolation_points == saved.arc_interpolation_points);
+            REQUIRE(loaded.lines_ends == saved.lines_ends);
+            REQUIRE(loaded.filaments_count == saved.filaments_count);
+            REQUIRE(loaded.extruder_colors == saved.extruder_colors);
+        }
+        THEN("another G-code or plate offset is refused") {
+            GCodeProcessorResult loaded;
+            REQUIRE(! GCodeResultCache::load(loaded, "FEDCBA9876543210FEDCBA9876543210", offset, path.string()));
+            REQUIRE(! GCodeResultCache::load(loaded, md5, Vec2d(0., 0.), path.string()));
+            REQUIRE(loaded.moves.empty());
+        }
+        THEN("a truncated snapshot is refused") {
+            std::string data;
+            boost::filesystem::load_string_file(path, data);
+            for (size_t size : { size_t(0), size_t(8), data.size() / 2, data.size() - 1 }) {
+                boost::filesystem::save_string_file(path, data.substr(0, size));
+                GCodeProcessorResult loaded;
+                REQUIRE(! GCodeResultCache::load(loaded, md5, offset, path.string()));
+                REQUIRE(loaded.moves.empty());
+            }
+        }
+    }
+    GIVEN("A snapshot with an arc referencing points past the end of the buffer") {
+        saved.moves.back().interpolation_points_offset = 2;
+        REQUIRE(GCodeResultCache::save(saved, md5, offset, path.string()));
+        THEN("it is refused") {
+            GCodeProcessorResult loaded;
+            REQUIRE(! GCodeResultCache::load(loaded, md5, offset, path.string()));
+        }
+    }
+    GIVEN("A snapshot with a move type out of range") {
+        saved.moves.front().type = EMoveType(200);
+        REQUIRE(GCodeResultCache::save(saved, md5, offset, path.string()));
+        THEN("it is refused") {
+            GCodeProcessorResult loaded;
+            REQUIRE(! GCodeResultCache::load(loaded, md5, offset, path.string()));
+        }
+    }
+    GIVEN("A snapshot with an extruder out of range") {
+        saved.moves.front().extruder_id = 2;
+        REQUIRE(GCodeResultCache::save(saved, md5, offset, path.string()));
+        THEN("it is refused") {
+            GCodeProcessorResult loaded;
+            REQUIRE(! GCodeResultCache::load(loaded, md5, offset, path.string()));
+        }
+    }
+    boost::system::error_code ec;
+    boost::filesystem::remove(path, ec);
+}
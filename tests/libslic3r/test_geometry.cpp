@@ -10,6 +10,7 @@
 #include "libslic3r/Geometry/ConvexHull.hpp"
 #include "libslic3r/ClipperUtils.hpp"
 #include "libslic3r/ShortestPath.hpp"
+#include "libslic3r/KDTreeIndirect.hpp"
 
 //#include <random>
 //#include "libnest2d/tools/benchmark.h"
@@ -17,6 +18,8 @@
 
 #include "../libnest2d/printer_parts.hpp"
 
+#include <chrono>
+#include <random>
 #include <unordered_set>
 
 using namespace Slic3r;
@@ -357,6 +360,56 @@ SCENARIO("Path chaining", "[Geometry]") {
 	}
 }
 
+TEST_CASE("KD tree closest point with a filter", "[Geometry]") {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<coord_t> coord(0, 1000000);
+    Points points(2000);
+    for (Point &pt : points)
+        pt = Point(coord(rng), coord(rng));
+    auto coordinate_fn = [&points](size_t idx, size_t dimension) -> double { return double(points[idx][dimension]); };
+    KDTreeIndirect<2, double, decltype(coordinate_fn)> kdtree(coordinate_fn, points.size());
+
+    std::vector<bool> taken(points.size(), false);
+    for (size_t i = 0; i < points.size(); ++ i) {
+        const Vec2d query = Point(coord(rng), coord(rng)).cast<double>();
+        size_t      found = find_closest_point(kdtree, query, [&taken](size_t idx) { return ! taken[idx]; });
+        REQUIRE(found < points.size());
+        double best = std::numeric_limits<double>::max();
+        for (size_t j = 0; j < points.size(); ++ j)
+            if (! taken[j])
+                best = std::min(best, (points[j].cast<double>() - query).squaredNorm());
+        REQUIRE((points[found].cast<double>() - query).squaredNorm() == Approx(best));
+        taken[found] = true;
+    }
+}
+
+// Not run by default, measures chaining of many short segments: ./libslic3r_tests "[ChainBenchmark]"
+TEST_CASE("Chaining benchmark", "[.][ChainBenchmark]") {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<coord_t> coord(0, scaled<coord_t>(250.));
+    std::uniform_int_distribution<coord_t> offset(-scaled<coord_t>(1.), scaled<coord_t>(1.));
+    for (size_t num_segments : { 1000, 10000, 100000 }) {
+        Polylines polylines;
+        Points    points;
+        polylines.reserve(num_segments);
+        points.reserve(num_segments);
+        for (size_t i = 0; i < num_segments; ++ i) {
+            Point pt(coord(rng), coord(rng));
+            polylines.push_back({ pt, pt + Point(offset(rng), offset(rng)) });
+            points.emplace_back(pt);
+        }
+        auto start = std::chrono::steady_clock::now();
+        Polylines chained = chain_polylines(std::move(polylines));
+        double polylines_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1000.;
+        start = std::chrono::steady_clock::now();
+        std::vector<Points::size_type> ordered = chain_points(points);
+        double points_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1000.;
+        REQUIRE(chained.size() == num_segments);
+        REQUIRE(ordered.size() == num_segments);
+        WARN(num_segments << " segments: chain_polylines " << polylines_ms << " ms, chain_points " << points_ms << " ms");
+    }
+}
+
 SCENARIO("Line distances", "[Geometry]"){
     GIVEN("A line"){
         Line line(Point(0, 0), Point(20, 0));
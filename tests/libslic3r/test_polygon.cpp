@@ -148,3 +148,23 @@ SCENARIO("Remove collinear points from Polygon", "[Polygon]") {
         }
     }
 }
+
+SCENARIO("Batch point in polygon test", "[Polygon]") {
+    GIVEN("A polygon with collinear points and a grid of points around it") {
+        Slic3r::Polygon p(collinear_circle);
+        Points          points;
+        for (coord_t x = -25; x <= 45; ++ x)
+            for (coord_t y = -5; y <= 45; ++ y)
+                points.emplace_back(Slic3r::Point::new_scale(x, y));
+        WHEN("the points are tested at once") {
+            std::vector<bool> inside           = contains_points(p, points);
+            std::vector<bool> inside_no_border = contains_points(p, points, false);
+            THEN("the results match testing each point alone, including the points on the boundary") {
+                for (size_t i = 0; i < points.size(); ++ i) {
+                    REQUIRE(inside[i] == p.contains(points[i]));
+                    REQUIRE(inside_no_border[i] == contains(p, points[i], false));
+                }
+            }
+        }
+    }
+}
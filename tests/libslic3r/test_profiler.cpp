@@ -0,0 +1,33 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/Profiler.hpp"
+
+#include <tbb/parallel_for.h>
+
+#include <atomic>
+
+using namespace Slic3r;
+
+// The zones are recorded by the Profiler::ScopedZone directly, so that the test does not depend on SLIC3R_PROFILE.
+TEST_CASE("Profiler records zones of all threads", "[Profiler]") {
+    Profiler::clear();
+
+    std::atomic<size_t> num_ranges { 0 };
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, 1000, 10), [&num_ranges](const tbb::blocked_range<size_t> &range) {
+        Profiler::ScopedZone zone("test_profiler_outer");
+        for (size_t i = range.begin(); i < range.end(); ++ i) {
+            Profiler::ScopedZone inner("test_profiler_inner");
+        }
+        ++ num_ranges;
+    });
+
+    std::string report = Profiler::flat_report();
+    REQUIRE(report.find("test_profiler_outer") != std::string::npos);
+    REQUIRE(report.find("test_profiler_inner") != std::string::npos);
+    REQUIRE(report.find(" " + std::to_string(num_ranges.load()) + " ") != std::string::npos);
+    REQUIRE(report.find(" 1000 ") != std::string::npos);
+    REQUIRE(Profiler::thread_depth() == 0);
+
+    Profiler::clear();
+    REQUIRE(Profiler::flat_report().find("test_profiler_outer") == std::string::npos);
+}
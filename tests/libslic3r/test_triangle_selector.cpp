@@ -0,0 +1,73 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/TriangleSelector.hpp"
+
+#include <map>
+
+using namespace Slic3r;
+
+// Division tree bits of each painted facet of the original mesh.
+static std::map<int, std::vector<bool>> facet_trees(const TriangleSelector &selector)
+{
+    auto [facets, bits] = selector.serialize();
+    std::map<int, std::vector<bool>> out;
+    for (size_t i = 0; i < facets.size(); ++ i) {
+        size_t end = i + 1 < facets.size() ? size_t(facets[i + 1].second) : bits.size();
+        out[facets[i].first] = std::vector<bool>(bits.begin() + facets[i].second, bits.begin() + end);
+    }
+    return out;
+}
+
+TEST_CASE("Triangle selector tracks the facets changed by painting", "[TriangleSelector]") {
+    TriangleMesh     mesh(its_make_sphere(10., 2. * PI / 100.));
+    TriangleSelector selector(mesh);
+    std::vector<int> dirty;
+
+    // Everything is dirty after construction.
+    REQUIRE(! selector.take_dirty_facets(dirty));
+    REQUIRE(dirty.empty());
+    REQUIRE(selector.take_dirty_facets(dirty));
+    REQUIRE(dirty.empty());
+
+    SECTION("set_facet") {
+        selector.set_facet(3, EnforcerBlockerType::ENFORCER);
+        selector.set_facet(5, EnforcerBlockerType::BLOCKER);
+        selector.set_facet(3, EnforcerBlockerType::BLOCKER);
+        REQUIRE(selector.take_dirty_facets(dirty));
+        REQUIRE(dirty == std::vector<int>{ 3, 5 });
+        REQUIRE(selector.take_dirty_facets(dirty));
+        REQUIRE(dirty.empty());
+    }
+
+    SECTION("brush strokes only touch the facets under the cursor") {
+        const Transform3d trafo = Transform3d::Identity();
+        for (int stroke = 0; stroke < 20; ++ stroke) {
+            const int   facet  = (stroke * 997) % int(mesh.its.indices.size());
+            const Vec3f center = its_face_normal(mesh.its, facet) * 10.f;
+            auto before = facet_trees(selector);
+            selector.select_patch(facet, std::make_unique<TriangleSelector::Sphere>(center, center * 2.f, 1.5f, trafo, TriangleSelector::ClippingPlane{}),
+                stroke % 3 == 2 ? EnforcerBlockerType::NONE : EnforcerBlockerType::ENFORCER, trafo, true);
+            auto after = facet_trees(selector);
+            REQUIRE(selector.take_dirty_facets(dirty));
+            REQUIRE(! dirty.empty());
+            REQUIRE(dirty.size() < mesh.its.indices.size() / 10);
+            std::sort(dirty.begin(), dirty.end());
+            for (const auto &[facet_idx, bits] : after)
+                if (auto it = before.find(facet_idx); it == before.end() || it->second != bits)
+                    REQUIRE(std::binary_search(dirty.begin(), dirty.end(), facet_idx));
+            for (const auto &[facet_idx, bits] : before)
+                if (after.find(facet_idx) == after.end())
+                    REQUIRE(std::binary_search(dirty.begin(), dirty.end(), facet_idx));
+        }
+    }
+
+    SECTION("reset and deserialize mark the whole mesh dirty") {
+        selector.set_facet(7, EnforcerBlockerType::ENFORCER);
+        auto data = selector.serialize();
+        selector.reset();
+        REQUIRE(! selector.take_dirty_facets(dirty));
+        selector.deserialize(data);
+        REQUIRE(! selector.take_dirty_facets(dirty));
+        REQUIRE(selector.has_facets(EnforcerBlockerType::ENFORCER));
+    }
+}
@@ -0,0 +1,70 @@
+#include <catch2/catch.hpp>
+
+#include "libslic3r/TriangleMesh.hpp"
+#include "libslic3r/TriangleSetSampling.hpp"
+
+using namespace Slic3r;
+
+static void require_same_samples(const TriangleSetSamples &prefix, const TriangleSetSamples &samples)
+{
+    REQUIRE(prefix.positions.size() <= samples.positions.size());
+    for (size_t i = 0; i < prefix.positions.size(); ++ i) {
+        REQUIRE(prefix.positions[i] == samples.positions[i]);
+        REQUIRE(prefix.normals[i] == samples.normals[i]);
+        REQUIRE(prefix.triangle_indices[i] == samples.triangle_indices[i]);
+    }
+}
+
+TEST_CASE("Smaller sample counts are prefixes of larger ones", "[TriangleSetSampling]") {
+    indexed_triangle_set cube = its_make_cube(10., 10., 10.);
+
+    TriangleSetSampler sampler(cube);
+    REQUIRE(sampler.total_area() == Approx(600.));
+    TriangleSetSamples small = sampler.samples(100);
+    TriangleSetSamples large = sampler.samples(1000);
+    REQUIRE(small.positions.size() == 100);
+    REQUIRE(large.positions.size() == 1000);
+    require_same_samples(small, large);
+    // Asking for a smaller count once the sequence was extended still returns its prefix.
+    require_same_samples(sampler.samples(10), small);
+
+    SECTION("The sequence does not depend on the order of the requests") {
+        TriangleSetSampler fresh(cube);
+        require_same_samples(fresh.samples(1000), large);
+        require_same_samples(large, sample_its_uniform_parallel(1000, cube));
+    }
+}
+
+TEST_CASE("Zero area triangles are never sampled", "[TriangleSetSampling]") {
+    indexed_triangle_set its;
+    its.vertices = { Vec3f(0.f, 0.f, 0.f), Vec3f(1.f, 0.f, 0.f), Vec3f(0.f, 1.f, 0.f), Vec3f(2.f, 0.f, 0.f), Vec3f(0.f, 0.f, 1.f) };
+    // Degenerate triangles at the start, in the middle and at the end of the set.
+    its.indices = { Vec3i(0, 1, 3), Vec3i(0, 1, 2), Vec3i(1, 1, 2), Vec3i(0, 1, 4), Vec3i(0, 3, 1) };
+
+    TriangleSetSamples samples = TriangleSetSampler(its).samples(10000);
+    REQUIRE(samples.total_area == Approx(1.f));
+    REQUIRE(samples.triangle_indices.size() == 10000);
+    for (size_t triangle_idx : samples.triangle_indices)
+        REQUIRE((triangle_idx == 1 || triangle_idx == 3));
+}
+
+TEST_CASE("Sampling a set without area returns no samples", "[TriangleSetSampling]") {
+    SECTION("Empty triangle set") {
+        indexed_triangle_set its;
+        TriangleSetSampler sampler(its);
+        REQUIRE(sampler.total_area() == 0.f);
+        TriangleSetSamples samples = sampler.samples(100);
+        REQUIRE(samples.total_area == 0.f);
+        REQUIRE(samples.positions.empty());
+        REQUIRE(samples.normals.empty());
+        REQUIRE(samples.triangle_indices.empty());
+    }
+    SECTION("Only zero area triangles") {
+        indexed_triangle_set its;
+        its.vertices = { Vec3f(0.f, 0.f, 0.f), Vec3f(1.f, 0.f, 0.f), Vec3f(2.f, 0.f, 0.f) };
+        its.indices  = { Vec3i(0, 1, 2), Vec3i(0, 0, 1) };
+        TriangleSetSamples samples = sample_its_uniform_parallel(100, its);
+        REQUIRE(samples.total_area == 0.f);
+        REQUIRE(samples.positions.empty());
+    }
+}
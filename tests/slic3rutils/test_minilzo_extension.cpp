@@ -0,0 +1,49 @@
+#include <catch2/catch.hpp>
+
+#include <random>
+#include <vector>
+
+#include "slic3r/Utils/minilzo_extension.hpp"
+
+using namespace Slic3r;
+
+// Compresses and decompresses data, the output buffer is sized for the worst case expansion of LZO1X.
+static std::vector<unsigned char> lzo_round_trip(std::vector<unsigned char> data, uint64_t &compressed_len)
+{
+    std::vector<unsigned char> compressed(data.size() + data.size() / 16 + 64 + 3);
+    compressed_len = compressed.size();
+    REQUIRE(lzo_compress(data.data(), data.size(), compressed.data(), &compressed_len) == 0);
+    REQUIRE(compressed_len <= compressed.size());
+
+    // One spare byte, so that the buffer is never empty and an overrun would be reported.
+    std::vector<unsigned char> decompressed(data.size() + 1);
+    uint64_t decompressed_len = decompressed.size();
+    REQUIRE(lzo_decompress(compressed.data(), compressed_len, decompressed.data(), &decompressed_len) == 0);
+    decompressed.resize(decompressed_len);
+    return decompressed;
+}
+
+TEST_CASE("LZO compression round trip", "[minilzo]") {
+    uint64_t compressed_len = 0;
+
+    SECTION("Empty buffer") {
+        REQUIRE(lzo_round_trip({}, compressed_len).empty());
+        REQUIRE(compressed_len > 0);
+    }
+    SECTION("Incompressible buffer") {
+        std::mt19937 rng(12345);
+        std::vector<unsigned char> data(256 * 1024);
+        for (unsigned char &c : data)
+            c = (unsigned char)(rng() & 0xFF);
+        REQUIRE(lzo_round_trip(data, compressed_len) == data);
+        // Random data expands, the caller keeps such payloads uncompressed.
+        REQUIRE(compressed_len >= data.size());
+    }
+    SECTION("Compressible buffer") {
+        std::vector<unsigned char> data(256 * 1024);
+        for (size_t i = 0; i < data.size(); ++ i)
+            data[i] = (unsigned char)(i % 17);
+        REQUIRE(lzo_round_trip(data, compressed_len) == data);
+        REQUIRE(compressed_len < data.size() / 10);
+    }
+}